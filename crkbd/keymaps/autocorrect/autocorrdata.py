@@ -0,0 +1,1123 @@
+#!/usr/bin/env python3
+"""
+Autocorrect Data Emitter for QMK
+Packs an autocorrect dictionary into the autocorrect_data.h trie read by QMK's
+process_autocorrect, sharing identical subtrees to save flash.
+"""
+
+import os
+import re
+import sys
+import json
+import random
+import argparse
+import tempfile
+import subprocess
+from bisect import bisect_right
+from datetime import date
+from functools import lru_cache
+from typing import Optional
+
+
+# region format
+# Byte format (same as `qmk generate-autocorrect-data`), trie over reversed typos:
+#   branch: [code | 64, link lo, link hi] [code, link lo, link hi]... 0
+#   chain:  code code ... 0                 (child follows inline)
+#   leaf:   128 + backspaces, correction suffix..., 0
+KC_A = 0x04
+KC_SPC = 0x2C
+KC_QUOT = 0x34
+
+TYPO_CHARS = frozenset("abcdefghijklmnopqrstuvwxyz':")
+# Root jump table slots (AUTOCORRECT_JUMP_TABLE): newest key a-z, ', boundary
+JUMP_CODES = [KC_A + i for i in range(26)] + [KC_QUOT, KC_SPC]
+MAX_LINK = 0xFFFF
+
+
+def char_to_code(c: str) -> int:
+    """Keycode the firmware stores in its typo buffer for a typo character."""
+    if c in ': ':
+        return KC_SPC
+    if c == "'":
+        return KC_QUOT
+    return KC_A + ord(c) - ord('a')
+
+
+# region parsing
+def parse_dictionary(lines) -> list[tuple[str, str]]:
+    """Parse `typo -> correction` lines, skipping blanks, comments and repeats."""
+    entries = []
+    seen = set()
+    for line_number, line in enumerate(lines, 1):
+        line = line.strip()
+        if not line or line.startswith('#'):
+            continue
+        if '->' not in line:
+            raise ValueError(f"line {line_number}: expected 'typo -> correction': {line!r}")
+        typo, correction = (part.strip() for part in line.split('->', 1))
+        typo = typo.lower()
+        if not typo.strip(':') or not set(typo) <= TYPO_CHARS:
+            raise ValueError(f"line {line_number}: typo {typo!r} may only contain a-z, ' and :")
+        if typo in seen:
+            print(f"# line {line_number}: ignoring repeated typo {typo!r}", file=sys.stderr)
+            continue
+        seen.add(typo)
+        entries.append((typo, correction))
+    return entries
+
+
+def load_dictionary(paths: list[str]) -> list[tuple[str, str]]:
+    lines = []
+    for path in paths:
+        with open(path, 'r', encoding='utf-8') as f:
+            lines.extend(f.readlines())
+    return parse_dictionary(lines)
+
+
+# region trie
+class Node:
+    """Trie node; identical subtrees are interned to a single Node."""
+    __slots__ = ('uid', 'kind', 'chars', 'children', 'data')
+
+    def __init__(self, uid: int, kind: str, chars: str = '', children: tuple = (), data: bytes = b''):
+        self.uid = uid
+        self.kind = kind            # 'leaf', 'chain' or 'branch'
+        self.chars = chars          # chain: chars in walk order; branch: sorted child chars
+        self.children = children    # chain: (child,); branch: one per char
+        self.data = data            # leaf: serialized bytes
+
+    def size(self) -> int:
+        if self.kind == 'leaf':
+            return len(self.data)
+        if self.kind == 'chain':
+            return len(self.chars) + 1
+        return 3 * len(self.chars) + 1
+
+
+def leaf_data(typo: str, correction: str) -> bytes:
+    """Backspace count plus the part of the correction that differs from the typo."""
+    word_boundary_ending = typo.endswith(':')
+    typo = typo.strip(':')
+    i = 0
+    while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+        i += 1
+    backspaces = len(typo) - i - 1 + word_boundary_ending
+    if not 0 <= backspaces <= 63:
+        raise ValueError(f"{typo!r} -> {correction!r}: {backspaces} backspaces out of range")
+    return bytes([128 + backspaces]) + correction[i:].encode('ascii') + b'\0'
+
+
+def build_trie(entries: list[tuple[str, str]]) -> Node:
+    """Build the reversed-typo trie, interning identical subtrees."""
+    root: dict = {}
+    for typo, correction in entries:
+        node = root
+        for c in reversed(typo):
+            node = node.setdefault(c, {})
+        node['LEAF'] = (typo, correction)
+
+    interned: dict[tuple, Node] = {}
+
+    def intern(kind: str, chars: str = '', children: tuple = (), data: bytes = b'') -> Node:
+        key = (kind, chars, tuple(child.uid for child in children), data)
+        node = interned.get(key)
+        if node is None:
+            node = interned[key] = Node(len(interned), kind, chars, children, data)
+        return node
+
+    def convert(trie: dict) -> Node:
+        if 'LEAF' in trie:
+            if len(trie) > 1:
+                typo = trie['LEAF'][0]
+                raise ValueError(f"typo {typo!r} is a suffix of a longer typo (correction conflict)")
+            return intern('leaf', data=leaf_data(*trie['LEAF']))
+        if len(trie) == 1:
+            chars = ''
+            while len(trie) == 1 and 'LEAF' not in trie:
+                c, trie = next(iter(trie.items()))
+                chars += c
+            return intern('chain', chars, (convert(trie),))
+        chars = ''.join(sorted(trie))
+        return intern('branch', chars, tuple(convert(trie[c]) for c in chars))
+
+    return convert(root)
+
+
+# region packing
+class Record:
+    """One serialized node at a fixed position in the output."""
+    __slots__ = ('kind', 'codes', 'links', 'data', 'offset')
+
+    def __init__(self, kind: str, codes: list[int] = None, data: bytes = b''):
+        self.kind = kind
+        self.codes = codes or []
+        self.links: list['Record'] = []
+        self.data = data
+        self.offset = 0
+
+    def size(self) -> int:
+        if self.kind == 'leaf':
+            return len(self.data)
+        if self.kind == 'chain':
+            return len(self.codes) + 1
+        return 3 * len(self.codes) + 1
+
+
+def pack_trie(root: Node, share: bool = True) -> bytes:
+    """
+    Serialize the trie in QMK's depth-first layout.
+
+    With share, a branch link to a subtree that was already written points at
+    the existing copy instead of writing it again. A chain's child must follow
+    it inline, so when that child already exists the chain's last character
+    becomes a one-way branch linking to it, if that is smaller than repeating
+    the child inline.
+
+    Links are always 2 bytes, so node order does not change the size; it only
+    has to keep every link target below 64 KiB.
+    """
+    records: list[Record] = []
+    first: dict[int, Record] = {}
+
+    def reinline_cost(node: Node) -> int:
+        """Bytes to write node again when all its descendants already exist."""
+        if node.kind != 'chain':
+            return node.size()
+        full = len(node.chars) + 1 + reinline_cost(node.children[0])
+        return min(full, split_cost(node))
+
+    def split_cost(node: Node) -> int:
+        return (len(node.chars) if len(node.chars) > 1 else 0) + 4
+
+    def place(node: Node) -> Record:
+        start = len(records)
+        if node.kind == 'leaf':
+            records.append(Record('leaf', data=node.data))
+        elif node.kind == 'chain':
+            child = node.children[0]
+            codes = [char_to_code(c) for c in node.chars]
+            existing = first.get(child.uid) if share else None
+            if existing and split_cost(node) < len(codes) + 1 + reinline_cost(child):
+                if len(codes) > 1:
+                    records.append(Record('chain', codes[:-1]))
+                branch = Record('branch', codes[-1:])
+                branch.links = [existing]
+                records.append(branch)
+            else:
+                records.append(Record('chain', codes))
+                place(child)
+        else:
+            branch = Record('branch', [char_to_code(c) for c in node.chars])
+            records.append(branch)
+            for child in node.children:
+                existing = first.get(child.uid) if share else None
+                branch.links.append(existing or place(child))
+        record = records[start]
+        first.setdefault(node.uid, record)
+        return record
+
+    place(root)
+
+    offset = 0
+    for record in records:
+        record.offset = offset
+        offset += record.size()
+
+    out = bytearray()
+    for record in records:
+        if record.kind == 'leaf':
+            out += record.data
+        elif record.kind == 'chain':
+            out += bytes(record.codes) + b'\0'
+        else:
+            for i, (code, link) in enumerate(zip(record.codes, record.links)):
+                if link.offset > MAX_LINK:
+                    raise ValueError(f"trie too large: link to byte {link.offset} exceeds 16 bits")
+                out += bytes([code | (64 if i == 0 else 0), link.offset & 0xFF, link.offset >> 8])
+            out += b'\0'
+    return bytes(out)
+
+
+# region verification
+class Autocorrect:
+    """Host model of QMK's process_autocorrect over a packed trie."""
+
+    def __init__(self, data: bytes, min_length: int, max_length: int):
+        self.data = data
+        self.min_length = min_length
+        self.max_length = max_length
+        self.buffer = [KC_SPC]
+        self.text = ''
+
+    def lookup(self) -> Optional[tuple[int, str]]:
+        """Walk the trie from the newest key; (backspaces, correction) on a hit."""
+        data = self.data
+        state = 0
+        code = data[state]
+        for key in reversed(self.buffer):
+            if code & 64:
+                code &= 63
+                while code != key:
+                    if not code:
+                        return None
+                    state += 3
+                    code = data[state]
+                state = data[state + 1] | data[state + 2] << 8
+            elif code != key:
+                return None
+            else:
+                state += 1
+                code = data[state]
+                if not code:
+                    state += 1
+            code = data[state]
+            if code & 128:
+                end = data.index(0, state + 1)
+                return code & 63, data[state + 1:end].decode('ascii')
+        return None
+
+    def press(self, c: str) -> bool:
+        """Type one character; returns True if it triggered a correction."""
+        key = char_to_code(c)
+        if len(self.buffer) >= self.max_length:
+            del self.buffer[0]
+        self.buffer.append(key)
+        hit = self.lookup() if len(self.buffer) >= self.min_length else None
+        if hit is None:
+            self.text += ' ' if key == KC_SPC else c
+            return False
+        backspaces, correction = hit
+        self.text = (self.text[:-backspaces] if backspaces else self.text) + correction
+        if key == KC_SPC:
+            self.text += ' '
+            self.buffer = [KC_SPC]
+        else:
+            self.buffer = []
+        return True
+
+
+def root_jump_table(data: bytes) -> list[int]:
+    """
+    For each JUMP_CODES key, the state the walk reaches after matching it at
+    the root (0 if nothing ends in that key), so the firmware can skip the
+    root's linear branch scan. Same steps as the first iteration of lookup().
+    """
+    table = []
+    for key in JUMP_CODES:
+        state = 0
+        code = data[state]
+        if code & 64:
+            code &= 63
+            while code != key and code:
+                state += 3
+                code = data[state]
+            state = data[state + 1] | data[state + 2] << 8 if code else 0
+        elif code == key:
+            state += 1
+            if not data[state]:
+                state += 1
+        else:
+            state = 0
+        table.append(state)
+    return table
+
+
+def length_bounds(entries: list[tuple[str, str]]) -> tuple[str, str]:
+    """Shortest and longest typo, as QMK reports them in the header."""
+    return min(entries, key=lambda e: len(e[0]))[0], max(entries, key=lambda e: len(e[0]))[0]
+
+
+def verify(data: bytes, entries: list[tuple[str, str]], model: type = None) -> list[str]:
+    """Type every typo after a space and check it fires once, on its last key, correctly."""
+    model = model or Autocorrect
+    shortest, longest = length_bounds(entries)
+    failures = []
+    for typo, correction in entries:
+        sim = model(data, len(shortest), len(longest))
+        keys = typo.lstrip(':').replace(':', ' ')
+        fired = [sim.press(c) for c in keys]
+        expected = correction + (' ' if typo.endswith(':') else '')
+        if any(fired[:-1]):
+            failures.append(f"{typo} -> {correction}: fired early ({sim.text!r})")
+        elif not fired[-1]:
+            failures.append(f"{typo} -> {correction}: did not fire")
+        elif sim.text != expected:
+            failures.append(f"{typo} -> {correction}: produced {sim.text!r}")
+    return failures
+
+
+# region compact
+# Bit-packed format (AUTOCORRECT_COMPACT_TRIE, lib/autocorrect_trie.h), most
+# significant bit first, over the same trie. Symbols are 5 bits: 1-26 a-z,
+# 27 ', 28 boundary; in corrections 28 is a space, 31 escapes a 7-bit ASCII
+# character and 0 ends the string.
+#   leaf:   00 backspaces:4 symbol... 0
+#   chain:  01 count-1:2 symbol x count            (child follows inline)
+#   branch: 10 count-1:5 width:5 symbol x count offset:width x (count-1)
+#   link:   11 width:5 offset:width
+# A branch's first symbol leads to the node that follows it; the others, and
+# links, lead to the end of the node plus a signed offset, so shared subtrees
+# (including leaves) are written once and reached from before or after.
+COMPACT_LEAF, COMPACT_CHAIN, COMPACT_BRANCH, COMPACT_LINK = range(4)
+COMPACT_QUOTE = 27
+COMPACT_BOUNDARY = 28
+COMPACT_ESCAPE = 31
+COMPACT_CHAIN_MAX = 4
+COMPACT_BACKSPACE_BITS = 4
+COMPACT_MAX_WIDTH = 25      # widest field the firmware reads in one go
+# A shared leaf this small costs less to write again than to link to
+COMPACT_REPEAT_BITS = 16
+
+
+def compact_symbol(c: str) -> int:
+    """5-bit symbol for a typo or correction character, 0 if it has none."""
+    if 'a' <= c <= 'z':
+        return ord(c) - ord('a') + 1
+    if c == "'":
+        return COMPACT_QUOTE
+    if c in ': ':
+        return COMPACT_BOUNDARY
+    return 0
+
+
+def signed_width(value: int) -> int:
+    """Bits to hold value in two's complement."""
+    return (value if value >= 0 else ~value).bit_length() + 1
+
+
+class CompactRecord:
+    """One node of the bit-packed layout; width and position settle in pack_compact."""
+    __slots__ = ('kind', 'symbols', 'targets', 'backspaces', 'width', 'pos')
+
+    def __init__(self, kind: int, symbols: list[int] = None, backspaces: int = 0):
+        self.kind = kind
+        self.symbols = symbols or []
+        self.targets: list['CompactRecord'] = []
+        self.backspaces = backspaces
+        self.width = 0
+        self.pos = 0
+
+    def bits(self) -> int:
+        if self.kind == COMPACT_LEAF:
+            escaped = sum(1 for s in self.symbols if s > 127)
+            return 2 + COMPACT_BACKSPACE_BITS + 5 * (len(self.symbols) + 1) + 7 * escaped
+        if self.kind == COMPACT_CHAIN:
+            return 4 + 5 * len(self.symbols)
+        if self.kind == COMPACT_LINK:
+            return 7 + self.width
+        return 12 + 5 * len(self.symbols) + self.width * (len(self.symbols) - 1)
+
+    def end(self) -> int:
+        return self.pos + self.bits()
+
+
+def compact_correction(correction: str) -> list[int]:
+    """Correction symbols; escaped characters are stored as 128 + ASCII."""
+    return [compact_symbol(c) or 128 + ord(c) for c in correction]
+
+
+def pack_compact(root: Node) -> bytes:
+    """
+    Serialize the trie in the bit-packed layout, depth first like pack_trie.
+
+    A branch's new children are written smallest first, which keeps its
+    offsets (all measured from the end of the branch) short. Offset widths and node positions depend on each
+    other, so widths start at 0 and grow until the layout stops changing.
+    """
+    records: list[CompactRecord] = []
+    first: dict[int, CompactRecord] = {}
+    subtree_bits: dict[int, int] = {}
+
+    def fresh_bits(node: Node) -> int:
+        """Rough size of node and everything under it written out in full."""
+        if node.uid not in subtree_bits:
+            if node.kind == 'leaf':
+                size = 2 + COMPACT_BACKSPACE_BITS + 5 * (len(node.data) - 1)
+            elif node.kind == 'chain':
+                pieces = -(-len(node.chars) // COMPACT_CHAIN_MAX)
+                size = 4 * pieces + 5 * len(node.chars) + fresh_bits(node.children[0])
+            else:
+                size = 12 + 10 * len(node.chars) + sum(fresh_bits(child) for child in set(node.children))
+            subtree_bits[node.uid] = size
+        return subtree_bits[node.uid]
+
+    def existing(node: Node) -> Optional[CompactRecord]:
+        record = first.get(node.uid)
+        if record and node.kind == 'leaf' and fresh_bits(node) <= COMPACT_REPEAT_BITS:
+            return None
+        return record
+
+    def link(target: CompactRecord) -> CompactRecord:
+        record = CompactRecord(COMPACT_LINK)
+        record.targets = [target]
+        records.append(record)
+        return record
+
+    def place(node: Node) -> CompactRecord:
+        start = len(records)
+        if node.kind == 'leaf':
+            if node.data[0] - 128 >= 1 << COMPACT_BACKSPACE_BITS:
+                raise ValueError(f"{node.data[0] - 128} backspaces do not fit the compact format")
+            records.append(CompactRecord(COMPACT_LEAF, compact_correction(node.data[1:-1].decode('ascii')),
+                                         node.data[0] - 128))
+        elif node.kind == 'chain':
+            symbols = [compact_symbol(c) for c in node.chars]
+            for i in range(0, len(symbols), COMPACT_CHAIN_MAX):
+                records.append(CompactRecord(COMPACT_CHAIN, symbols[i:i + COMPACT_CHAIN_MAX]))
+            child = node.children[0]
+            target = existing(child)
+            if target:
+                link(target)
+            else:
+                place(child)
+        else:
+            branch = CompactRecord(COMPACT_BRANCH)
+            records.append(branch)
+            new = []
+            for child in node.children:
+                if not existing(child) and child not in new:
+                    new.append(child)
+            new.sort(key=fresh_bits)
+            placed = {}
+            if not new:
+                # Every child exists already: the first one is reached through a link
+                placed[node.children[0].uid] = link(first[node.children[0].uid])
+            for child in new:
+                # An earlier sibling may have written it as one of its descendants
+                placed[child.uid] = existing(child) or place(child)
+            inline = node.children.index(new[0]) if new else 0
+            for i in [inline] + [i for i in range(len(node.chars)) if i != inline]:
+                child = node.children[i]
+                branch.symbols.append(compact_symbol(node.chars[i]))
+                branch.targets.append(placed.get(child.uid) or first[child.uid])
+        record = records[start]
+        first.setdefault(node.uid, record)
+        return record
+
+    place(root)
+
+    changed = True
+    while changed:
+        pos = 0
+        for record in records:
+            record.pos = pos
+            pos += record.bits()
+        changed = False
+        for record in records:
+            if record.kind == COMPACT_LINK or (record.kind == COMPACT_BRANCH and len(record.targets) > 1):
+                targets = record.targets if record.kind == COMPACT_LINK else record.targets[1:]
+                width = max(signed_width(target.pos - record.end()) for target in targets)
+                if width > record.width:
+                    record.width = width
+                    changed = True
+    if max(record.width for record in records) > COMPACT_MAX_WIDTH:
+        raise ValueError(f"trie too large: compact offsets exceed {COMPACT_MAX_WIDTH} bits")
+
+    fields: list[tuple[int, int]] = []
+    for record in records:
+        fields.append((record.kind, 2))
+        if record.kind == COMPACT_LEAF:
+            fields.append((record.backspaces, COMPACT_BACKSPACE_BITS))
+            for symbol in record.symbols:
+                fields += [(COMPACT_ESCAPE, 5), (symbol - 128, 7)] if symbol > 127 else [(symbol, 5)]
+            fields.append((0, 5))
+        elif record.kind == COMPACT_CHAIN:
+            fields.append((len(record.symbols) - 1, 2))
+            fields += [(symbol, 5) for symbol in record.symbols]
+        elif record.kind == COMPACT_LINK:
+            fields += [(record.width, 5), (record.targets[0].pos - record.end(), record.width)]
+        else:
+            fields += [(len(record.symbols) - 1, 5), (record.width, 5)]
+            fields += [(symbol, 5) for symbol in record.symbols]
+            if record.targets[0].pos != record.end():
+                raise AssertionError("branch's first child is not inline")
+            fields += [(target.pos - record.end(), record.width) for target in record.targets[1:]]
+    bits = ''.join(f"{value & ((1 << width) - 1):0{width}b}" for value, width in fields)
+    bits += '0' * (-len(bits) % 8)
+    return int(bits, 2).to_bytes(len(bits) // 8, 'big')
+
+
+@lru_cache(maxsize=4)
+def bit_string(data: bytes) -> str:
+    return ''.join(f"{b:08b}" for b in data)
+
+
+class CompactAutocorrect(Autocorrect):
+    """Autocorrect over a pack_compact trie, walked the way the firmware does."""
+
+    def __init__(self, data: bytes, min_length: int, max_length: int):
+        super().__init__(data, min_length, max_length)
+        self.bit_string = bit_string(data)
+
+    def read(self, pos: int, width: int) -> int:
+        return int(self.bit_string[pos:pos + width], 2)
+
+    def read_offset(self, pos: int, width: int) -> int:
+        value = self.read(pos, width)
+        return value - (1 << width) if value >> (width - 1) else value
+
+    def node(self, pos: int) -> tuple[int, int]:
+        """Tag of the node at pos after following links, and the position past the tag."""
+        while (tag := self.read(pos, 2)) == COMPACT_LINK:
+            width = self.read(pos + 2, 5)
+            pos += 7 + width + self.read_offset(pos + 7, width)
+        return tag, pos + 2
+
+    def lookup(self) -> Optional[tuple[int, str]]:
+        tag, pos = self.node(0)
+        left = 0
+        for key in reversed(self.buffer):
+            key = {KC_QUOT: COMPACT_QUOTE, KC_SPC: COMPACT_BOUNDARY}.get(key, key - KC_A + 1)
+            if tag == COMPACT_CHAIN:
+                if not left:
+                    left = self.read(pos, 2) + 1
+                    pos += 2
+                if self.read(pos, 5) != key:
+                    return None
+                pos += 5
+                left -= 1
+                if left:
+                    continue
+            else:
+                count = self.read(pos, 5) + 1
+                width = self.read(pos + 5, 5)
+                symbols = [self.read(pos + 10 + 5 * j, 5) for j in range(count)]
+                if key not in symbols:
+                    return None
+                j = symbols.index(key)
+                offsets = pos + 10 + 5 * count
+                pos = offsets + width * (count - 1)
+                if j:
+                    pos += self.read_offset(offsets + width * (j - 1), width)
+            tag, pos = self.node(pos)
+            if tag == COMPACT_LEAF:
+                return self.read(pos, COMPACT_BACKSPACE_BITS), self.correction(pos + COMPACT_BACKSPACE_BITS)
+        return None
+
+    def correction(self, pos: int) -> str:
+        chars = []
+        while symbol := self.read(pos, 5):
+            if symbol == COMPACT_ESCAPE:
+                chars.append(chr(self.read(pos + 5, 7)))
+                pos += 7
+            else:
+                chars.append({COMPACT_QUOTE: "'", COMPACT_BOUNDARY: ' '}.get(symbol, chr(ord('a') + symbol - 1)))
+            pos += 5
+        return ''.join(chars)
+
+
+# region budget
+# Relative likelihood of each typo type, scaled into an entry's value
+TYPO_TYPE_WEIGHTS = {
+    'transposition': 1.0,
+    'deletion': 0.8,
+    'insertion': 0.6,
+    'replacement': 0.6,
+    'other': 0.3,
+}
+
+
+def typo_type(typo: str, correction: str) -> str:
+    """Classify a typo as a single-edit error of its correction."""
+    t, w = typo.strip(':'), correction
+    if len(t) == len(w):
+        diff = [i for i in range(len(t)) if t[i] != w[i]]
+        if len(diff) == 1:
+            return 'replacement'
+        if len(diff) == 2 and diff[1] == diff[0] + 1 and t[diff[0]] == w[diff[1]] and t[diff[1]] == w[diff[0]]:
+            return 'transposition'
+    elif len(t) + 1 == len(w):
+        if any(w[:i] + w[i + 1:] == t for i in range(len(w))):
+            return 'deletion'
+    elif len(t) == len(w) + 1:
+        if any(t[:i] + t[i + 1:] == w for i in range(len(t))):
+            return 'insertion'
+    return 'other'
+
+
+def entry_values(entries: list[tuple[str, str]], frequency) -> list[float]:
+    """Expected corrected keystrokes: target frequency x typo-type weight x word length."""
+    return [
+        frequency(correction) * TYPO_TYPE_WEIGHTS[typo_type(typo, correction)] * len(correction)
+        for typo, correction in entries
+    ]
+
+
+def entry_costs(entries: list[tuple[str, str]]) -> list[float]:
+    """
+    Approximate trie bytes per entry: its leaf, plus every node on its path
+    split evenly between the entries below that node.
+    """
+    root: dict = {}
+    for n, (typo, _) in enumerate(entries):
+        node = root
+        for c in reversed(typo):
+            node = node.setdefault(c, {})
+        node[None] = n
+
+    costs = [0.0] * len(entries)
+
+    def count(node: dict) -> int:
+        if None not in node:
+            node[''] = sum(count(child) for key, child in node.items() if key != '')
+        return node.get('', 1)
+
+    def walk(node: dict, inherited: float):
+        if None in node:
+            n = node[None]
+            costs[n] = inherited + len(leaf_data(*entries[n]))
+            return
+        children = [child for key, child in node.items() if key != '']
+        own = (3 * len(children) + 1) if len(children) > 1 else 1
+        for child in children:
+            walk(child, inherited + own / node[''])
+
+    count(root)
+    walk(root, 0.0)
+    return costs
+
+
+def packed_size(entries: list[tuple[str, str]], share: bool = True) -> int:
+    return len(pack_trie(build_trie(entries), share)) if entries else 0
+
+
+def rank_entries(entries: list[tuple[str, str]], frequency) -> tuple[list[int], list[float]]:
+    """Entry indices by value per byte, best first; also returns the values."""
+    values = entry_values(entries, frequency)
+    costs = entry_costs(entries)
+    order = sorted(range(len(entries)), key=lambda n: (-values[n] / costs[n], n))
+    return order, values
+
+
+def select_within_budget(
+    entries: list[tuple[str, str]],
+    budget: int,
+    frequency,
+    share: bool = True,
+    verbose: bool = False,
+) -> list[tuple[str, str]]:
+    """
+    Keep the best value-per-byte entries whose packed trie fits in budget bytes.
+
+    Greedy by value per approximate byte, then a binary search over how many
+    of the ranked entries to keep, measured by actually packing them.
+    Any subset of a conflict-free dictionary is still conflict-free.
+    """
+    order, values = rank_entries(entries, frequency)
+
+    def prefix(k: int) -> list[tuple[str, str]]:
+        keep = sorted(order[:k])
+        return [entries[n] for n in keep]
+
+    lo, hi = 0, len(order)
+    while lo < hi:
+        mid = (lo + hi + 1) // 2
+        if packed_size(prefix(mid), share) <= budget:
+            lo = mid
+        else:
+            hi = mid - 1
+
+    if verbose:
+        print_budget_curve(entries, order, values, share)
+        total = sum(values) or 1.0
+        kept = sum(values[n] for n in order[:lo])
+        print(
+            f"# Budget {budget} bytes: kept {lo}/{len(entries)} entries, "
+            f"{packed_size(prefix(lo), share)} bytes, {100 * kept / total:.1f}% of expected corrections",
+            file=sys.stderr,
+        )
+    if lo == 0:
+        raise ValueError(f"no entry fits in a {budget}-byte budget")
+    return prefix(lo)
+
+
+def print_budget_curve(entries, order, values, share: bool, points: int = 10):
+    """Trie size against share of expected corrected keystrokes for growing prefixes."""
+    total = sum(values) or 1.0
+    print("# Budget curve (bytes -> entries, expected corrections covered):", file=sys.stderr)
+    for step in range(1, points + 1):
+        k = len(order) * step // points
+        keep = sorted(order[:k])
+        size = packed_size([entries[n] for n in keep], share)
+        covered = sum(values[n] for n in order[:k])
+        print(f"#   {size:6d} B  {k:5d} entries  {100 * covered / total:5.1f}%", file=sys.stderr)
+
+
+# region replay
+HERE = os.path.dirname(os.path.abspath(__file__))
+REPLAY_SOURCE = os.path.join(HERE, 'autocorrect_replay.c')
+TRIE_LIB = os.path.join(HERE, '..', '..', 'lib')
+WORD = re.compile(r"(?<![A-Za-z'])[a-z]+(?![A-Za-z'])")
+TOKEN = re.compile(r'\S+')
+
+
+def inject_typos(text: str, entries: list[tuple[str, str]], rate: float, seed: int) -> tuple[str, set[int]]:
+    """
+    Misspell a fraction of the words that have dictionary entries, using
+    those entries' typos. Returns the typed text and the indices (in TOKEN
+    order) of the tokens that were misspelled.
+    """
+    typos = {}
+    for typo, correction in entries:
+        typos.setdefault(correction, []).append(typo.strip(':'))
+    rng = random.Random(seed)
+    typed, length, pos, misspelled = [], 0, 0, []
+    for m in WORD.finditer(text):
+        typed.append(text[pos:m.start()])
+        length += m.start() - pos
+        word = m.group()
+        if word in typos and rng.random() < rate:
+            word = rng.choice(typos[word])
+            misspelled.append(length)
+        typed.append(word)
+        length += len(word)
+        pos = m.end()
+    typed.append(text[pos:])
+    typed = ''.join(typed)
+
+    token_starts = [m.start() for m in TOKEN.finditer(typed)]
+    injected = {bisect_right(token_starts, start) - 1 for start in misspelled}
+    return typed, injected
+
+
+# Firmware walk variants the harness is built as: (name, defines, macro the
+# header must define for the variant to be replayed).
+REPLAY_WALKS = [
+    ('root scan', [], None),
+    ('jump table', ['-DAUTOCORRECT_JUMP_TABLE'], 'AUTOCORRECT_JUMP_TABLE_SIZE'),
+    ('compact', ['-DAUTOCORRECT_COMPACT_TRIE'], 'AUTOCORRECT_COMPACT_SIZE'),
+]
+
+
+def build_replay(header: str, work_dir: str, defines: Optional[list[str]] = None) -> str:
+    """Compile the replay harness against header; returns the executable."""
+    data_path = os.path.join(work_dir, 'autocorrect_data.h')
+    with open(data_path, 'w', encoding='utf-8') as f:
+        f.write(header)
+    exe = os.path.join(work_dir, '_'.join(['autocorrect_replay'] + [d[2:].lower() for d in defines or []]))
+    cmd = [
+        os.environ.get('CC', 'cc'), '-O2', '-std=c11', '-Wall', '-Werror', *(defines or []),
+        '-I', TRIE_LIB, f'-DAUTOCORRECT_DATA="{data_path}"', REPLAY_SOURCE, '-o', exe,
+    ]
+    result = subprocess.run(cmd, capture_output=True, text=True, check=False)
+    if result.returncode:
+        raise SystemExit(f"error: could not build the replay harness:\n{result.stderr}")
+    return exe
+
+
+class ReplayCheck:
+    """
+    Replays text corpora through the firmware trie walk, compiled on the host.
+
+    Every word in the corpora is taken as correctly spelled, and a fraction
+    of them (typo_rate) is misspelled with the dictionary's own typos first:
+    - false trigger:   a correctly spelled word came out changed
+    - true correction: a misspelled word came out as the original
+    - wrong:           a misspelled word came out as something else
+    - missed:          a misspelled word came out unchanged
+    Fails when false triggers exceed max_false, so a bad dictionary never
+    reaches a keymap's autocorrect_data.h.
+    """
+
+    def __init__(self, corpora: list[str], typo_rate: float = 0.02, max_false: Optional[int] = None,
+                 repeats: int = 5, seed: int = 0):
+        self.corpora = corpora
+        self.typo_rate = typo_rate
+        self.max_false = max_false
+        self.repeats = repeats
+        self.seed = seed
+
+    def run(self, entries: list[tuple[str, str]], header: str) -> dict:
+        text = '\n'.join(open(p, 'r', encoding='utf-8', errors='replace').read() for p in self.corpora)
+        typed, injected = inject_typos(text, entries, self.typo_rate, self.seed)
+
+        walks, output = [], None
+        with tempfile.TemporaryDirectory(prefix='autocorrect-replay-') as work_dir:
+            typed_path = os.path.join(work_dir, 'typed.txt')
+            with open(typed_path, 'w', encoding='utf-8') as f:
+                f.write(typed)
+            for name, defines, needs in REPLAY_WALKS:
+                if needs and needs not in header:
+                    continue
+                timed, walk_output = self._run_harness(header, work_dir, defines, typed_path, self.repeats)
+                counted, _ = self._run_harness(header, work_dir, defines + ['-DREPLAY_COUNT_READS'], typed_path, 0)
+                if output is None:
+                    stats, output = timed, walk_output
+                elif walk_output != output:
+                    raise SystemExit(f"error: the {name} walk corrects differently from the {walks[0]['walk']} walk")
+                walks.append({
+                    'walk': name,
+                    'dictionary_bytes': timed['dictionary_bytes'],
+                    'ns_per_keystroke': timed['ns_per_keystroke'],
+                    'reads_per_keystroke': counted['reads_per_keystroke'],
+                })
+        del stats['ns_per_keystroke'], stats['dictionary_bytes']
+        stats['walks'] = walks
+
+        clean_tokens = TOKEN.findall(text)
+        typed_tokens = TOKEN.findall(typed)
+        output_tokens = TOKEN.findall(output)
+        if not len(clean_tokens) == len(typed_tokens) == len(output_tokens):
+            raise SystemExit("error: replay output no longer lines up with the corpus words")
+
+        stats.update(words=len(clean_tokens), misspelled=len(injected),
+                     false_triggers=0, true_corrections=0, wrong=0, missed=0)
+        false_examples = {}
+        for i, (clean, typed_token, out) in enumerate(zip(clean_tokens, typed_tokens, output_tokens)):
+            if i in injected:
+                key = 'true_corrections' if out == clean else 'missed' if out == typed_token else 'wrong'
+                stats[key] += 1
+            elif out != clean:
+                stats['false_triggers'] += 1
+                example = f"{clean} -> {out}"
+                false_examples[example] = false_examples.get(example, 0) + 1
+        stats['false_examples'] = sorted(false_examples.items(), key=lambda kv: -kv[1])
+        return stats
+
+    @staticmethod
+    def _run_harness(header: str, work_dir: str, defines: list[str], typed_path: str,
+                     repeats: int) -> tuple[dict, str]:
+        exe = build_replay(header, work_dir, defines)
+        output_path = os.path.join(work_dir, 'output.txt')
+        result = subprocess.run([exe, typed_path, output_path, str(repeats)],
+                                capture_output=True, text=True, check=False)
+        if result.returncode:
+            raise SystemExit(f"error: replay failed:\n{result.stderr}")
+        with open(output_path, 'r', encoding='utf-8') as f:
+            return json.loads(result.stdout), f.read()
+
+    def check(self, entries: list[tuple[str, str]], header: str) -> dict:
+        """Run, report to stderr and exit if false triggers exceed the limit."""
+        stats = self.run(entries, header)
+        print(f"# Replay: {stats['words']} words, {stats['keystrokes']} keystrokes", file=sys.stderr)
+        base = stats['walks'][0]
+        for walk in stats['walks']:
+            change = '' if walk is base else (
+                f" ({100 * (walk['reads_per_keystroke'] / base['reads_per_keystroke'] - 1):+.0f}% reads, "
+                f"{100 * (walk['ns_per_keystroke'] / base['ns_per_keystroke'] - 1):+.0f}% time)"
+            )
+            print(
+                f"#   {walk['walk']}: {walk['dictionary_bytes']} bytes, {walk['ns_per_keystroke']:.1f} ns, "
+                f"{walk['reads_per_keystroke']:.2f} trie reads per keystroke{change}",
+                file=sys.stderr,
+            )
+        print(
+            f"#   {stats['false_triggers']} false triggers "
+            f"({1000 * stats['false_triggers'] / max(stats['words'], 1):.2f} per 1000 words), "
+            f"{stats['true_corrections']}/{stats['misspelled']} misspellings corrected, "
+            f"{stats['wrong']} wrong, {stats['missed']} missed",
+            file=sys.stderr,
+        )
+        for example, count in stats['false_examples'][:10]:
+            print(f"#   false: {example} (x{count})", file=sys.stderr)
+        if self.max_false is not None and stats['false_triggers'] > self.max_false:
+            raise SystemExit(
+                f"error: {stats['false_triggers']} false triggers in the replay corpus "
+                f"(limit {self.max_false}); no header written"
+            )
+        return stats
+
+
+def add_replay_arguments(parser: argparse.ArgumentParser):
+    parser.add_argument('--replay', action='append', default=[], metavar='CORPUS',
+                        help='Before writing headers, replay this text through the firmware trie walk '
+                             '(host-compiled) and report false triggers, corrections and ns/keystroke '
+                             '(can be specified multiple times)')
+    parser.add_argument('--replay-typo-rate', type=float, default=0.02,
+                        help='Fraction of corpus words to misspell with dictionary typos (default: 0.02)')
+    parser.add_argument('--replay-max-false', type=int,
+                        help='Fail without writing headers if the replay has more false triggers than this')
+
+
+def replay_check(args) -> Optional[ReplayCheck]:
+    if not args.replay:
+        return None
+    return ReplayCheck(args.replay, args.replay_typo_rate, args.replay_max_false)
+
+
+# region header
+BANNER = r'''/*******************************************************************************
+  88888888888 888      d8b                .d888 d8b 888               d8b
+      888     888      Y8P               d88P"  Y8P 888               Y8P
+      888     888                        888        888
+      888     88888b.  888 .d8888b       888888 888 888  .d88b.       888 .d8888b
+      888     888 "88b 888 88K           888    888 888 d8P  Y8b      888 88K
+      888     888  888 888 "Y8888b.      888    888 888 88888888      888 "Y8888b.
+      888     888  888 888      X88      888    888 888 Y8b.          888      X88
+      888     888  888 888  88888P'      888    888 888  "Y8888       888  88888P'
+                                                        888                 888
+                                                        888                 888
+                                                        888                 888
+     .d88b.   .d88b.  88888b.   .d88b.  888d888 8888b.  888888 .d88b.   .d88888
+    d88P"88b d8P  Y8b 888 "88b d8P  Y8b 888P"      "88b 888   d8P  Y8b d88" 888
+    888  888 88888888 888  888 88888888 888    .d888888 888   88888888 888  888
+    Y88b 888 Y8b.     888  888 Y8b.     888    888  888 Y88b. Y8b.     Y88b 888
+     "Y88888  "Y8888  888  888  "Y8888  888    "Y888888  "Y888 "Y8888   "Y88888
+         888
+    Y8b d88P
+     "Y88P"
+*******************************************************************************/'''
+
+
+def byte_rows(data: bytes) -> list[str]:
+    rows = [data[i:i + 16] for i in range(0, len(data), 16)]
+    return ["    " + ", ".join(f"0x{b:02X}" for b in row) + ("," if n < len(rows) - 1 else "")
+            for n, row in enumerate(rows)]
+
+
+def render_header(entries: list[tuple[str, str]], data: bytes, jump_table: bool = True,
+                  compact: Optional[bytes] = None) -> str:
+    """
+    autocorrect_data.h in the layout `qmk generate-autocorrect-data` writes,
+    plus the root jump table for AUTOCORRECT_JUMP_TABLE builds and the
+    bit-packed trie for AUTOCORRECT_COMPACT_TRIE builds, which replaces it.
+    """
+    shortest, longest = length_bounds(entries)
+    lines = [
+        f"// Copyright {date.today().year} QMK",
+        "// SPDX-License-Identifier: GPL-2.0-or-later",
+        "",
+        BANNER,
+        "",
+        "#pragma once",
+        "",
+        f"// Autocorrection dictionary ({len(entries)} entries):",
+    ]
+    lines += [f"//   {typo:<{len(longest)}} -> {correction}" for typo, correction in entries]
+    lines += [
+        "",
+        f'#define AUTOCORRECT_MIN_LENGTH {len(shortest)} // "{shortest}"',
+        f'#define AUTOCORRECT_MAX_LENGTH {len(longest)} // "{longest}"',
+    ]
+    # QMK's own walk is switched off in the userspace builds and its copy of
+    # the dictionary only needs a symbol to link; the keymap's walk defines
+    # AUTOCORRECT_TRIE_WALK to get the packed trie when it reads it
+    placeholder = (["defined(AUTOCORRECT_COMPACT_TRIE)"] if compact else []) + (
+        ["(defined(AUTOCORRECT_JUMP_TABLE) && !defined(AUTOCORRECT_TRIE_WALK))"] if jump_table else [])
+    if placeholder:
+        lines += [
+            "",
+            f"#if {' || '.join(placeholder)}",
+            "// QMK's own walk is switched off in these builds and only needs a symbol to link",
+            "#define DICTIONARY_SIZE 1",
+            "static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM __attribute__((unused)) = {0};",
+            "#else",
+        ]
+    lines += [
+        f"#define DICTIONARY_SIZE {len(data)}",
+        "",
+        "static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {",
+    ]
+    lines += byte_rows(data)
+    lines += ["};", ""]
+    if placeholder:
+        lines += ["#endif", ""]
+    if jump_table:
+        slots = [chr(ord('a') + i) for i in range(26)] + ["'", ':']
+        lines += [
+            f"#define AUTOCORRECT_JUMP_TABLE_SIZE {len(JUMP_CODES)}",
+            "",
+            "#ifdef AUTOCORRECT_JUMP_TABLE",
+            "// State after the root for each newest key (a-z, ', boundary); 0 = no typo ends in it",
+            "static const uint16_t autocorrect_jump_table[AUTOCORRECT_JUMP_TABLE_SIZE] PROGMEM __attribute__((unused)) = {",
+        ]
+        table = root_jump_table(data)
+        lines += ["    " + ", ".join(f"0x{v:04X}" for v in table[i:i + 8]) + ","
+                  + "  // " + " ".join(slots[i:i + 8]) for i in range(0, len(table), 8)]
+        lines += ["};", "#endif", ""]
+    if compact:
+        max_correction = max(len(correction) for _, correction in entries)
+        lines += [
+            f"#define AUTOCORRECT_COMPACT_SIZE {len(compact)}",
+            "",
+            "#ifdef AUTOCORRECT_COMPACT_TRIE",
+            f"#define AUTOCORRECT_COMPACT_MAX_CORRECTION {max_correction}",
+            "",
+            "// Bit-packed trie, see autocorrdata.py for the format",
+            "static const uint8_t autocorrect_compact_data[AUTOCORRECT_COMPACT_SIZE] PROGMEM __attribute__((unused)) = {",
+        ]
+        lines += byte_rows(compact)
+        lines += ["};", "#endif", ""]
+    return "\n".join(lines)
+
+
+def emit_headers(
+    entries: list[tuple[str, str]],
+    outputs: list[str],
+    share: bool = True,
+    verbose: bool = False,
+    replay: Optional[ReplayCheck] = None,
+) -> bytes:
+    """Pack, verify, optionally replay, and write the header to every output path; returns the trie bytes."""
+    root = build_trie(entries)
+    data = pack_trie(root, share)
+    compact = pack_compact(root) if share else None
+    for name, packed, model in (('packed', data, Autocorrect), ('compact', compact, CompactAutocorrect)):
+        failures = verify(packed, entries, model) if packed else []
+        if failures:
+            for failure in failures[:20]:
+                print(f"#   {failure}", file=sys.stderr)
+            raise SystemExit(f"error: {len(failures)} entries do not round-trip through the {name} trie")
+
+    if verbose:
+        stock = len(pack_trie(root, share=False)) if share else len(data)
+        print(
+            f"# Packed {len(entries)} entries into {len(data)} bytes "
+            f"({len(data) / len(entries):.2f} bytes/entry"
+            + (f", {stock - len(data)} bytes saved by sharing" if share else "") + ")",
+            file=sys.stderr,
+        )
+        if compact:
+            print(
+                f"# Compact trie: {len(compact)} bytes ({len(compact) / len(entries):.2f} bytes/entry, "
+                f"{100 * (1 - len(compact) / stock):.0f}% smaller than stock)",
+                file=sys.stderr,
+            )
+
+    header = render_header(entries, data, jump_table=share, compact=compact)
+    if replay:
+        replay.check(entries, header)
+    for path in outputs:
+        with open(path, 'w', encoding='utf-8') as f:
+            f.write(header)
+        if verbose:
+            print(f"Wrote {path}", file=sys.stderr)
+    return data
+
+
+# region cli
+def main():
+    parser = argparse.ArgumentParser(
+        description='Pack an autocorrect dictionary into a QMK autocorrect_data.h',
+    )
+    parser.add_argument('dictionary', nargs='+',
+                        help='Dictionary files with one "typo -> correction" per line')
+    parser.add_argument('-o', '--output', action='append', default=[],
+                        help='Header to write (can be specified multiple times)')
+    parser.add_argument('--no-share', action='store_true',
+                        help='Write every subtree in full and no jump table or compact trie, '
+                             'exactly like qmk generate-autocorrect-data')
+    parser.add_argument('--budget-bytes', type=int,
+                        help='Keep only the most valuable entries that fit in this many trie bytes')
+    parser.add_argument('-v', '--verbose', action='store_true', help='Print size statistics')
+    add_replay_arguments(parser)
+    args = parser.parse_args()
+
+    try:
+        entries = load_dictionary(args.dictionary)
+        if args.budget_bytes:
+            from wordfreq import word_frequency  # pylint: disable=import-outside-toplevel
+            entries = select_within_budget(
+                entries, args.budget_bytes, lambda w: word_frequency(w, 'en'),
+                share=not args.no_share, verbose=True,
+            )
+        emit_headers(
+            entries, args.output, share=not args.no_share, verbose=args.verbose or not args.output,
+            replay=replay_check(args),
+        )
+    except ValueError as e:
+        raise SystemExit(f"error: {e}") from e
+
+
+if __name__ == "__main__":
+    main()
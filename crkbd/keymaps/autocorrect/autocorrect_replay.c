@@ -0,0 +1,189 @@
+// Host replay harness for a generated autocorrect_data.h.
+//
+// Types a text file through the firmware's trie walk (lib/autocorrect_trie.h)
+// one keystroke at a time, writes the text as the board would have left it,
+// then re-times the walk and prints one JSON line of statistics.
+//
+// Built and run by autocorrdata.py / autocorrgen.py --replay, once per walk
+// variant (-DAUTOCORRECT_JUMP_TABLE, -DAUTOCORRECT_COMPACT_TRIE) and once
+// more with -DREPLAY_COUNT_READS to count dictionary byte reads, which on the
+// RP2040 are flash (XIP) fetches and dominate the per-key cost:
+//   cc -O2 -I../../lib -DAUTOCORRECT_DATA='"autocorrect_data.h"' autocorrect_replay.c
+//   ./a.out TYPED OUTPUT [REPEATS]
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define PROGMEM
+#define AUTOCORRECT_TRIE_WALK // the packed trie, not QMK's placeholder
+#include AUTOCORRECT_DATA
+
+#ifdef REPLAY_COUNT_READS
+static unsigned long long trie_reads;
+#    define AUTOCORRECT_TRIE_READ(data, i) (++trie_reads, (data)[i])
+#    define AUTOCORRECT_TRIE_READ_WORD(table, i) (trie_reads += 2, (table)[i])
+#endif
+#include "autocorrect_trie.h"
+
+// ─── Keystrokes ──────────────────────────────────────────────────────────────
+// What process_autocorrect() does with the key that types each byte: letters
+// (shifted or not) and ' are buffered, Enter clears the buffer then acts as a
+// boundary, every other printable key (digits, punctuation, space, tab and
+// their shifted forms, including ") is a boundary, and anything else (non-ASCII
+// input, other control keys) clears the buffer.
+
+enum { KEY_IGNORE, KEY_RESET, KEY_CODE, KEY_ENTER };
+
+static int classify(unsigned char c, uint8_t *code) {
+    if (c >= 'a' && c <= 'z') {
+        *code = AUTOCORRECT_CODE_A + (c - 'a');
+        return KEY_CODE;
+    }
+    if (c >= 'A' && c <= 'Z') {
+        *code = AUTOCORRECT_CODE_A + (c - 'A');
+        return KEY_CODE;
+    }
+    if (c == '\'') {
+        *code = AUTOCORRECT_CODE_QUOTE;
+        return KEY_CODE;
+    }
+    *code = AUTOCORRECT_CODE_SPACE;
+    if (c == '\n') return KEY_ENTER;
+    if (c == '\r') return KEY_IGNORE;
+    if (c == '\t' || (c >= 0x20 && c < 0x7F)) return KEY_CODE;
+    return KEY_RESET;
+}
+
+// ─── Replay ──────────────────────────────────────────────────────────────────
+
+typedef struct {
+    unsigned char *text;
+    size_t         len;
+    size_t         cap;
+} output_t;
+
+static void output_put(output_t *out, unsigned char c) {
+    if (out->len == out->cap) {
+        out->cap  = out->cap ? out->cap * 2 : 4096;
+        out->text = realloc(out->text, out->cap);
+        if (!out->text) {
+            perror("realloc");
+            exit(1);
+        }
+    }
+    out->text[out->len++] = c;
+}
+
+// Type input; with out, apply corrections to it. Returns the trigger count.
+static size_t replay(const unsigned char *input, size_t len, output_t *out) {
+    autocorrect_trie_buffer_t b        = AUTOCORRECT_TRIE_BUFFER_INIT;
+    size_t                    triggers = 0;
+
+    for (size_t i = 0; i < len; ++i) {
+        uint8_t code;
+        switch (classify(input[i], &code)) {
+            case KEY_IGNORE:
+                if (out) output_put(out, input[i]);
+                continue;
+            case KEY_RESET:
+                b.size = 0;
+                if (out) output_put(out, input[i]);
+                continue;
+            case KEY_ENTER:
+                b.size = 0;
+                break;
+        }
+
+        autocorrect_trie_push(&b, code);
+        autocorrect_trie_leaf_t leaf = autocorrect_trie_match(AUTOCORRECT_TRIE_DATA, &b);
+        if (!leaf) {
+            if (out) output_put(out, input[i]);
+            continue;
+        }
+
+        ++triggers;
+        if (out) {
+            uint8_t backspaces = autocorrect_trie_backspaces(AUTOCORRECT_TRIE_DATA, leaf);
+            out->len           = out->len > backspaces ? out->len - backspaces : 0;
+            for (const char *s = autocorrect_trie_correction(AUTOCORRECT_TRIE_DATA, leaf); *s; ++s) {
+                output_put(out, (unsigned char)*s);
+            }
+        }
+        if (code == AUTOCORRECT_CODE_SPACE) {
+            // The boundary key still types after the correction
+            if (out) output_put(out, input[i]);
+            b.buffer[0] = AUTOCORRECT_CODE_SPACE;
+            b.size      = 1;
+        } else {
+            // The key is swallowed; the correction already ends with it
+            b.size = 0;
+        }
+    }
+    return triggers;
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s TYPED OUTPUT [REPEATS]\n", argv[0]);
+        return 2;
+    }
+    int repeats = argc > 3 ? atoi(argv[3]) : 5;
+    if (repeats < 1) repeats = 1;
+
+    FILE *f = fopen(argv[1], "rb");
+    if (!f) {
+        perror(argv[1]);
+        return 1;
+    }
+    fseek(f, 0, SEEK_END);
+    size_t len = (size_t)ftell(f);
+    fseek(f, 0, SEEK_SET);
+    unsigned char *input = malloc(len ? len : 1);
+    if (!input || fread(input, 1, len, f) != len) {
+        perror(argv[1]);
+        return 1;
+    }
+    fclose(f);
+
+    output_t out      = {0};
+    size_t   triggers = replay(input, len, &out);
+
+    f = fopen(argv[2], "wb");
+    if (!f || fwrite(out.text, 1, out.len, f) != out.len || fclose(f)) {
+        perror(argv[2]);
+        return 1;
+    }
+
+    // Time the walk alone: no output buffer, best of several passes
+    double best = 0;
+    for (int r = 0; r < repeats; ++r) {
+        double start = now_ns();
+        if (replay(input, len, NULL) != triggers) {
+            fprintf(stderr, "error: timing pass disagrees with the replay\n");
+            return 1;
+        }
+        double elapsed = now_ns() - start;
+        if (r == 0 || elapsed < best) best = elapsed;
+    }
+
+    printf("{\"keystrokes\": %zu, \"triggers\": %zu, \"dictionary_bytes\": %d, \"ns_per_keystroke\": %.2f",
+           len, triggers, (int)AUTOCORRECT_TRIE_BYTES, len ? best / len : 0.0);
+#ifdef REPLAY_COUNT_READS
+    // Every pass reads the same bytes: average over the replay and timing passes
+    printf(", \"reads_per_keystroke\": %.3f", len ? (double)trie_reads / (repeats + 1) / len : 0.0);
+#endif
+    printf("}\n");
+    free(input);
+    free(out.text);
+    return 0;
+}
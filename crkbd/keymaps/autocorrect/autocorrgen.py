@@ -4,13 +4,31 @@ Fat Finger Typo Generator for QMK Autocorrect
 Generates transposition, deletion, extra letter, and replacement typos from a word list.
 """
 
+import os
+import re
 import sys
+import mmap
+import struct
+import json
+import hashlib
 import argparse
-from collections import defaultdict
+import tempfile
+import time
+import random
+import platform
+import resource
+from array import array
+from bisect import bisect_left, bisect_right
+from collections import defaultdict, deque
+from contextlib import contextmanager
+from functools import lru_cache
+from statistics import median
+from importlib import metadata
 from multiprocessing import Pool, cpu_count
-from typing import Optional
+from typing import Callable, Optional
 from wordfreq import word_frequency, top_n_list
 from english_words import get_english_words_set
+from autocorrdata import add_replay_arguments, emit_headers, parse_dictionary, replay_check, select_within_budget
 
 
 # region config
@@ -25,6 +43,7 @@ class Config:
         self.verbose = args.verbose
         self.jobs = args.jobs
         self.output = args.output
+        self.cache_dir = None if args.no_cache else args.cache_dir
 
 
 # region validation helpers
@@ -109,43 +128,274 @@ def generate_all_typos(word: str, extra_letters_map: Optional[dict[str, str]] =
     return typos
 
 
+# region word index
+class StringTable:
+    """Read-only sorted byte strings in one blob, addressed by uint32 offsets."""
+
+    def __init__(self, offsets, blob):
+        self._offsets = offsets
+        self._blob = blob
+
+    @classmethod
+    def from_strings(cls, strings: list[bytes]) -> "StringTable":
+        offsets = array('I', [0])
+        for s in strings:
+            offsets.append(offsets[-1] + len(s))
+        return cls(memoryview(offsets), memoryview(b''.join(strings)))
+
+    @property
+    def blob_size(self) -> int:
+        return len(self._blob)
+
+    def write(self, f):
+        """Append offsets (native uint32) and blob to f, padded to 4 bytes."""
+        f.write(self._offsets.tobytes())
+        f.write(self._blob.tobytes())
+        f.write(b'\0' * (-f.tell() % 4))
+
+    @classmethod
+    def view(cls, buf: memoryview, pos: int, count: int, blob_size: int) -> tuple["StringTable", int]:
+        """Table written by write() at buf[pos:], and the position just past it."""
+        offsets = buf[pos:pos + 4 * (count + 1)].cast('I')
+        pos += 4 * (count + 1)
+        table = cls(offsets, buf[pos:pos + blob_size])
+        return table, pos + blob_size + (-(pos + blob_size) % 4)
+
+    def __len__(self) -> int:
+        return len(self._offsets) - 1
+
+    def __getitem__(self, i: int) -> bytes:
+        return bytes(self._blob[self._offsets[i]:self._offsets[i + 1]])
+
+
+class WordIndex:
+    """
+    Sorted lookup tables over a word set, built once and queried per typo.
+
+    Replaces linear scans of the validation dictionary: every query is a
+    binary search plus one comparison, so cost scales with log(dictionary)
+    and typo length rather than dictionary size.
+
+    - words:    sorted words            (membership, proper-prefix checks)
+    - reversed: sorted reversed words   (proper-suffix checks)
+    - suffixes: sorted distinct suffixes of every word (substring checks)
+
+    Strings are stored UTF-8 encoded (byte order matches code point order).
+    save() writes the tables to one flat file; load() memory-maps it, so pool
+    workers share the parent's pages instead of unpickling private copies.
+    """
+
+    MAGIC = b'ACWIDX1\n'
+    HEADER = struct.Struct('<8s6I')   # magic, (count, blob length) per table
+
+    def __init__(self, words: StringTable, reversed_words: StringTable, suffixes: StringTable):
+        self.words = words
+        self.reversed = reversed_words
+        self.suffixes = suffixes
+
+    @classmethod
+    def build(cls, words) -> "WordIndex":
+        unique = sorted({w.encode('utf-8') for w in words})
+        decoded = [w.decode('utf-8') for w in unique]
+        return cls(
+            StringTable.from_strings(unique),
+            StringTable.from_strings(sorted(w[::-1].encode('utf-8') for w in decoded)),
+            StringTable.from_strings(sorted({w[i:].encode('utf-8') for w in decoded for i in range(len(w))})),
+        )
+
+    def _tables(self) -> tuple[StringTable, StringTable, StringTable]:
+        return (self.words, self.reversed, self.suffixes)
+
+    def save(self, path: str):
+        """Write header, then per table: offsets (native uint32) and blob, 4-byte aligned."""
+        fields = []
+        for table in self._tables():
+            fields += [len(table), table.blob_size]
+        with open(path, 'wb') as f:
+            f.write(self.HEADER.pack(self.MAGIC, *fields))
+            for table in self._tables():
+                table.write(f)
+
+    @classmethod
+    def load(cls, path: str) -> "WordIndex":
+        """Memory-map an index written by save()."""
+        with open(path, 'rb') as f:
+            buf = memoryview(mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ))
+        magic, *fields = cls.HEADER.unpack_from(buf)
+        if magic != cls.MAGIC:
+            raise ValueError(f"{path}: not a word index")
+        pos = cls.HEADER.size
+        tables = []
+        for count, blob_size in zip(fields[0::2], fields[1::2]):
+            table, pos = StringTable.view(buf, pos, count, blob_size)
+            tables.append(table)
+        return cls(*tables)
+
+    def __len__(self) -> int:
+        return len(self.words)
+
+    def __contains__(self, word: str) -> bool:
+        key = word.encode('utf-8')
+        i = bisect_left(self.words, key)
+        return i < len(self.words) and self.words[i] == key
+
+    @staticmethod
+    def _has_longer(table: StringTable, key: bytes) -> bool:
+        """True if some entry in sorted table starts with key and is longer than it."""
+        i = bisect_right(table, key)
+        return i < len(table) and table[i].startswith(key)
+
+    def has_prefix(self, typo: str) -> bool:
+        """Some other word starts with typo."""
+        return self._has_longer(self.words, typo.encode('utf-8'))
+
+    def has_suffix(self, typo: str) -> bool:
+        """Some other word ends with typo."""
+        return self._has_longer(self.reversed, typo[::-1].encode('utf-8'))
+
+    def has_substring(self, typo: str) -> bool:
+        """Some other word contains typo."""
+        # A longer suffix starting with typo means typo sits inside a longer
+        # word; a suffix equal to typo only counts if it ends another word.
+        return self._has_longer(self.suffixes, typo.encode('utf-8')) or self.has_suffix(typo)
+
+
+# region frequency table
+
+ASCII_WORD = re.compile(r'[a-z]+')
+
+
+def wordfreq_version() -> str:
+    try:
+        return metadata.version('wordfreq')
+    except metadata.PackageNotFoundError:
+        return 'unknown'
+
+
+@lru_cache(maxsize=None)
+def fallback_frequency(word: str) -> float:
+    """word_frequency for words the table cannot answer, memoized per process."""
+    return word_frequency(word, 'en')
+
+
+class FrequencyTable:
+    """
+    word_frequency(word, 'en') for every QMK-typeable word wordfreq knows,
+    precomputed once into a flat file: a sorted StringTable of words and a
+    float64 array indexed by word ID.
+
+    Each word_frequency call tokenizes and normalizes its argument; the
+    generator asks about every typo and every colliding word, so lookups
+    here are a binary search and an array read instead.
+
+    Words outside the table:
+    - plain a-z words are exactly 0.0 (they tokenize to themselves, and
+      wordfreq returns 0 for tokens not in its list), so a validation
+      dictionary word wordfreq does not know costs no row at all;
+    - anything else (apostrophes, non-ASCII letters) may tokenize
+      differently, so it goes to word_frequency through fallback_frequency.
+    """
+
+    MAGIC = b'ACFREQ1\n'
+    HEADER = struct.Struct('<8s2I')   # magic, word count, blob length
+
+    def __init__(self, words: StringTable, freqs):
+        self.words = words
+        self.freqs = freqs
+
+    @classmethod
+    def build(cls) -> "FrequencyTable":
+        unique = sorted({w.encode('utf-8') for w in top_n_list('en', 10 ** 9) if is_valid_qmk_word(w)})
+        freqs = array('d', (word_frequency(w.decode('utf-8'), 'en') for w in unique))
+        return cls(StringTable.from_strings(unique), memoryview(freqs))
+
+    def save(self, path: str):
+        """Write header, the word table, then the float64 array 8-byte aligned."""
+        with open(path, 'wb') as f:
+            f.write(self.HEADER.pack(self.MAGIC, len(self.words), self.words.blob_size))
+            self.words.write(f)
+            f.write(b'\0' * (-f.tell() % 8))
+            f.write(self.freqs.tobytes())
+
+    @classmethod
+    def load(cls, path: str) -> "FrequencyTable":
+        """Memory-map a table written by save()."""
+        with open(path, 'rb') as f:
+            buf = memoryview(mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ))
+        magic, count, blob_size = cls.HEADER.unpack_from(buf)
+        if magic != cls.MAGIC:
+            raise ValueError(f"{path}: not a frequency table")
+        words, pos = StringTable.view(buf, cls.HEADER.size, count, blob_size)
+        pos += -pos % 8
+        return cls(words, buf[pos:pos + 8 * count].cast('d'))
+
+    def __len__(self) -> int:
+        return len(self.words)
+
+    def __call__(self, word: str) -> float:
+        key = word.encode('utf-8')
+        i = bisect_left(self.words, key)
+        if i < len(self.words) and self.words[i] == key:
+            return self.freqs[i]
+        if ASCII_WORD.fullmatch(word):
+            return 0.0
+        return fallback_frequency(word)
+
+
+def open_frequency_table(index_dir: str) -> str:
+    """Write (or reuse) the frequency table for the installed wordfreq; returns its path."""
+    namespace = hashlib.sha256(f"{FrequencyTable.MAGIC!r}\0{wordfreq_version()}".encode()).hexdigest()[:16]
+    path = os.path.join(index_dir, f"frequency-{namespace}.idx")
+    if not os.path.exists(path):
+        tmp = f"{path}.{os.getpid()}.tmp"
+        FrequencyTable.build().save(tmp)
+        os.replace(tmp, path)
+    return path
+
+
 # region val+filt
-def is_substring_of_any(typo: str, word_set: set[str]) -> bool:
-    """Check if typo is a substring of any word in word_set."""
-    for word in word_set:
-        if typo in word and typo != word:
-            return True
-    return False
+def is_substring_of_any(typo: str, word_index: WordIndex) -> bool:
+    """Check if typo is a substring of any word in word_index."""
+    return word_index.has_substring(typo)
 
 
-def would_trigger_at_start(typo: str, validation_set: set[str]) -> bool:
+def would_trigger_at_start(typo: str, validation_index: WordIndex) -> bool:
     """Check if :typo would falsely trigger (typo appears as prefix)."""
-    for word in validation_set:
-        if word.startswith(typo) and word != typo:
-            return True
-    return False
+    return validation_index.has_prefix(typo)
 
 
-def would_trigger_at_end(typo: str, validation_set: set[str]) -> bool:
+def would_trigger_at_end(typo: str, validation_index: WordIndex) -> bool:
     """Check if typo: would falsely trigger (typo appears as suffix)."""
-    for word in validation_set:
-        if word.endswith(typo) and word != typo:
-            return True
-    return False
+    return validation_index.has_suffix(typo)
 
 
-def would_trigger_as_substring(typo: str, validation_set: set[str]) -> bool:
+def would_trigger_as_substring(typo: str, validation_index: WordIndex) -> bool:
     """Check if typo appears as substring anywhere in validation words."""
-    for word in validation_set:
-        if typo in word and word != typo:
-            return True
-    return False
+    return validation_index.has_substring(typo)
+
+
+# Boundary flags from the validation dictionary (cacheable per word)
+TRIGGERS_INSIDE = 1
+TRIGGERS_AT_START = 2
+TRIGGERS_AT_END = 4
+
+
+def validation_flags(typo: str, validation_index: WordIndex) -> int:
+    """Where typo would falsely trigger inside validation words, as TRIGGERS_* bits."""
+    flags = 0
+    if would_trigger_as_substring(typo, validation_index):
+        flags |= TRIGGERS_INSIDE
+        if would_trigger_at_start(typo, validation_index):
+            flags |= TRIGGERS_AT_START
+        if would_trigger_at_end(typo, validation_index):
+            flags |= TRIGGERS_AT_END
+    return flags
 
 
 def determine_boundaries(
     typo: str,
-    validation_set: set[str],
-    source_words: set[str],
+    flags: int,
+    source_index: WordIndex,
 ) -> Optional[str]:
     """
     Determine what boundaries (if any) are needed for a typo.
@@ -155,16 +405,16 @@ def determine_boundaries(
         - typo with boundaries (:typo, typo:, :typo:) if needed
         - None if typo should be skipped
     """
-    is_substring_source = is_substring_of_any(typo, source_words)
-    is_substring_validation = would_trigger_as_substring(typo, validation_set)
+    is_substring_source = is_substring_of_any(typo, source_index)
+    is_substring_validation = bool(flags & TRIGGERS_INSIDE)
 
     if not is_substring_source and not is_substring_validation:
         # Safe without boundaries
         return typo
 
     # Need boundaries - determine which
-    appears_as_prefix = would_trigger_at_start(typo, validation_set)
-    appears_as_suffix = would_trigger_at_end(typo, validation_set)
+    appears_as_prefix = bool(flags & TRIGGERS_AT_START)
+    appears_as_suffix = bool(flags & TRIGGERS_AT_END)
 
     if not appears_as_prefix and not appears_as_suffix:
         return f":{typo}:"
@@ -175,19 +425,22 @@ def determine_boundaries(
     return f":{typo}:"
 
 
-def process_word(
+def screen_word(
     word: str,
-    validation_set: set[str],
-    source_words: set[str],
+    validation_index: WordIndex,
+    frequency: Callable[[str], float],
     typo_freq_threshold: float,
     extra_letters_map: Optional[dict[str, str]],
-) -> list[tuple[str, str]]:
+) -> list[tuple[str, int]]:
     """
-    Process a single word and generate all valid corrections.
+    Generate a word's typos and screen them against the validation dictionary.
 
-    Returns list of (typo, word) tuples.
+    Depends only on the word, its adjacency entries, the dictionary and the
+    frequency threshold, so the result is what the word cache stores.
+
+    Returns list of (typo, validation flags) tuples.
     """
-    corrections = []
+    screened = []
     typos = generate_all_typos(word, extra_letters_map)
 
     for typo in typos:
@@ -196,23 +449,98 @@ def process_word(
             continue
 
         # Skip if typo is a valid word
-        if typo in validation_set:
+        if typo in validation_index:
             continue
 
         # Skip if typo has significant frequency (likely a real word)
         if typo_freq_threshold > 0.0:
-            typo_freq = word_frequency(typo, 'en')
+            typo_freq = frequency(typo)
             if typo_freq >= typo_freq_threshold:
                 continue
 
+        screened.append((typo, validation_flags(typo, validation_index)))
+
+    return screened
+
+
+def process_word(
+    word: str,
+    screened: list[tuple[str, int]],
+    source_index: WordIndex,
+) -> list[tuple[str, str]]:
+    """
+    Turn a word's screened typos into corrections.
+
+    Returns list of (typo, word) tuples.
+    """
+    corrections = []
+    for typo, flags in screened:
         # Determine boundaries
-        typo_with_boundaries = determine_boundaries(typo, validation_set, source_words)
+        typo_with_boundaries = determine_boundaries(typo, flags, source_index)
         if typo_with_boundaries:
             corrections.append((typo_with_boundaries, word))
 
     return corrections
 
 
+# region word cache
+
+class WordCache:
+    """
+    On-disk cache of screen_word results, so editing the word lists only
+    reprocesses the words that changed.
+
+    Entries are keyed by word plus the adjacency entries it uses; everything
+    else they depend on (dictionary contents, frequency threshold, wordfreq
+    version, cache format) selects the cache file. The source-word substring
+    check is not cached: it depends on the whole word list and is cheap.
+    """
+
+    VERSION = 1
+
+    def __init__(self, cache_dir: str, dictionary_hash: str, typo_freq_threshold: float):
+        namespace = hashlib.sha256(
+            f"{self.VERSION}\0{dictionary_hash}\0{typo_freq_threshold!r}\0{wordfreq_version()}".encode()
+        ).hexdigest()[:16]
+        self.path = os.path.join(cache_dir, f"words-{namespace}.json")
+        self.entries: dict[str, list[list]] = {}
+        self.dirty = False
+        if os.path.exists(self.path):
+            with open(self.path, 'r', encoding='utf-8') as f:
+                self.entries = json.load(f)
+
+    @staticmethod
+    def key(word: str, extra_letters_map: Optional[dict[str, str]]) -> str:
+        adjacency = ','.join(
+            f"{c}={extra_letters_map[c]}" for c in sorted(set(word)) if extra_letters_map and c in extra_letters_map
+        )
+        return f"{word}\t{adjacency}"
+
+    def get(self, key: str) -> Optional[list[tuple[str, int]]]:
+        entry = self.entries.get(key)
+        return None if entry is None else [(typo, flags) for typo, flags in entry]
+
+    def put(self, key: str, screened: list[tuple[str, int]]):
+        self.entries[key] = [[typo, flags] for typo, flags in screened]
+        self.dirty = True
+
+    def save(self):
+        if not self.dirty:
+            return
+        tmp = f"{self.path}.{os.getpid()}.tmp"
+        with open(tmp, 'w', encoding='utf-8') as f:
+            json.dump(self.entries, f, separators=(',', ':'))
+        os.replace(tmp, self.path)
+
+
+def dictionary_hash(words) -> str:
+    """Content hash of a word set, independent of iteration order."""
+    digest = hashlib.sha256()
+    for word in sorted(w.encode('utf-8') for w in words):
+        digest.update(word + b'\n')
+    return digest.hexdigest()
+
+
 # region exclusions
 
 class ExclusionMatcher:
@@ -294,7 +622,7 @@ class ExclusionMatcher:
 
 def generalize_patterns(
     corrections: list[str],
-    validation_set: set[str],
+    validation_index: WordIndex,
     min_typo_length: int,
 ) -> list[str]:
     """
@@ -341,7 +669,7 @@ def generalize_patterns(
 
             # Validate pattern won't cause false triggers
             clean_pattern = pattern.strip(':')
-            if not would_trigger_at_end(clean_pattern, validation_set):
+            if not would_trigger_at_end(clean_pattern, validation_index):
                 patterns.append(pattern_correction)
 
     for pattern, words in prefix_patterns.items():
@@ -356,7 +684,7 @@ def generalize_patterns(
             pattern_correction = f"{pattern} -> {correction}"
 
             clean_pattern = pattern.strip(':')
-            if not would_trigger_at_start(clean_pattern, validation_set):
+            if not would_trigger_at_start(clean_pattern, validation_index):
                 patterns.append(pattern_correction)
 
     return patterns
@@ -370,6 +698,7 @@ def resolve_collisions(
     min_typo_length: int,
     user_included_words: set[str],
     exclusion_matcher: ExclusionMatcher,
+    frequency: Callable[[str], float],
 ) -> tuple[list[str], list, list]:
     """
     Resolve collisions where multiple words generate the same typo.
@@ -401,7 +730,7 @@ def resolve_collisions(
                     final_corrections.append(correction)
         else:
             # Collision - resolve by frequency
-            word_freqs = [(w, word_frequency(w, 'en')) for w in possible_words]
+            word_freqs = [(w, frequency(w)) for w in possible_words]
             word_freqs.sort(key=lambda x: x[1], reverse=True)
 
             most_common = word_freqs[0]
@@ -429,6 +758,58 @@ def resolve_collisions(
     return final_corrections, skipped_collisions, skipped_short_typos
 
 
+class AhoCorasick:
+    """Multi-pattern substring matcher: finds every pattern inside a text in one pass."""
+
+    def __init__(self, patterns: list[str]):
+        self.goto: list[dict[str, int]] = [{}]
+        self.fail: list[int] = [0]
+        self.out: list[Optional[int]] = [None]   # pattern id ending exactly here
+        self.link: list[int] = [0]               # nearest proper suffix state with an output
+
+        for pid, pattern in enumerate(patterns):
+            state = 0
+            for ch in pattern:
+                nxt = self.goto[state].get(ch)
+                if nxt is None:
+                    nxt = len(self.goto)
+                    self.goto[state][ch] = nxt
+                    self.goto.append({})
+                    self.fail.append(0)
+                    self.out.append(None)
+                    self.link.append(0)
+                state = nxt
+            self.out[state] = pid
+
+        queue = deque(self.goto[0].values())
+        while queue:
+            state = queue.popleft()
+            for ch, nxt in self.goto[state].items():
+                queue.append(nxt)
+                f = self.fail[state]
+                while f and ch not in self.goto[f]:
+                    f = self.fail[f]
+                self.fail[nxt] = self.goto[f].get(ch, 0) if state else 0
+                fs = self.fail[nxt]
+                self.link[nxt] = fs if self.out[fs] is not None else self.link[fs]
+
+    def matches(self, text: str) -> set[int]:
+        """Ids of every pattern occurring anywhere in text."""
+        found = set()
+        if self.out[0] is not None:
+            found.add(self.out[0])
+        state = 0
+        for ch in text:
+            while state and ch not in self.goto[state]:
+                state = self.fail[state]
+            state = self.goto[state].get(ch, 0)
+            s = state if self.out[state] is not None else self.link[state]
+            while s and self.out[s] is not None and self.out[s] not in found:
+                found.add(self.out[s])
+                s = self.link[s]
+        return found
+
+
 def remove_substring_conflicts(corrections: list[str], verbose: bool) -> list[str]:
     """Remove corrections where one typo is a substring of another."""
     typo_to_correction = {}
@@ -437,30 +818,116 @@ def remove_substring_conflicts(corrections: list[str], verbose: bool) -> list[st
             typo, _ = correction.split(' -> ', 1)
             typo_to_correction[typo] = correction
 
-    typos_to_remove = set()
     typo_list = list(typo_to_correction.keys())
+    clean = [t.strip(':') for t in typo_list]
+
+    # One Aho-Corasick sweep finds, for every typo, which others it contains
+    distinct = list(dict.fromkeys(clean))
+    by_clean = defaultdict(list)
+    for i, c in enumerate(clean):
+        by_clean[c].append(i)
+    matcher = AhoCorasick(distinct)
+
+    related = defaultdict(set)   # i -> every j where one clean typo contains the other
+    for outer in distinct:
+        for pid in matcher.matches(outer):
+            for i in by_clean[distinct[pid]]:
+                for j in by_clean[outer]:
+                    if i != j:
+                        related[i].add(j)
+                        related[j].add(i)
+
+    # Replay the original pairwise scan over only the related pairs, so the
+    # removal decisions (earlier typo wins, removed typos still evict later
+    # ones) are unchanged.
+    removed = [False] * len(typo_list)
+    for i in range(len(typo_list)):
+        if removed[i]:
+            continue
+        for j in sorted(related[i]):
+            if j <= i or removed[j]:
+                continue
+            if clean[i] in clean[j]:
+                removed[j] = True
+            elif clean[j] in clean[i]:
+                removed[i] = True
+
+    if any(removed) and verbose:
+        print(f"# Removed {sum(removed)} typos due to substring conflicts", file=sys.stderr)
+
+    return [typo_to_correction[t] for i, t in enumerate(typo_list) if not removed[i]]
+
+
+def remove_substring_conflicts_pairwise(corrections: list[str]) -> list[str]:
+    """Reference for remove_substring_conflicts: the original all-pairs scan."""
+    typo_to_correction = {}
+    for correction in corrections:
+        if ' -> ' in correction:
+            typo, _ = correction.split(' -> ', 1)
+            typo_to_correction[typo] = correction
 
+    typos_to_remove = set()
+    typo_list = list(typo_to_correction.keys())
     for i, typo1 in enumerate(typo_list):
         if typo1 in typos_to_remove:
             continue
         for typo2 in typo_list[i+1:]:
             if typo2 in typos_to_remove:
                 continue
-
             clean_typo1 = typo1.strip(':')
             clean_typo2 = typo2.strip(':')
-
             if clean_typo1 in clean_typo2:
                 typos_to_remove.add(typo2)
             elif clean_typo2 in clean_typo1:
                 typos_to_remove.add(typo1)
 
-    if typos_to_remove and verbose:
-        print(f"# Removed {len(typos_to_remove)} typos due to substring conflicts", file=sys.stderr)
+    return [typo_to_correction[t] for t in typo_list if t not in typos_to_remove]
 
-    return [
-        typo_to_correction[t] for t in typo_to_correction if t not in typos_to_remove  # pylint: disable=consider-using-dict-items
-    ]
+
+def check_substring_conflicts(path: str, verbose: bool, rounds: int = 3, overlaps: int = 800):
+    """Self-test: the Aho-Corasick sweep must remove exactly what the pairwise scan does.
+
+    Runs both over the dictionary as written, then over shuffled copies seeded
+    with entries that overlap existing typos (substrings, extensions and
+    boundary variants), since a generated dictionary has no conflicts left.
+    """
+    with open(path, 'r', encoding='utf-8') as f:
+        base = [line.strip() for line in f if ' -> ' in line]
+    typos = [line.split(' -> ', 1)[0] for line in base]
+
+    rng = random.Random(0)
+    cases = [('as written', base)]
+    for n in range(rounds):
+        extra = []
+        for _ in range(overlaps):
+            typo = rng.choice(typos)
+            clean = typo.strip(':')
+            length = rng.randint(min(4, len(clean)), len(clean))
+            start = rng.randint(0, len(clean) - length)
+            variant = rng.choice((
+                clean[start:start + length],                        # substring
+                clean + rng.choice('etaoinshr'),                    # extension
+                ':' + clean if rng.random() < 0.5 else clean + ':',  # boundary
+            ))
+            extra.append(f"{variant} -> {variant}")
+        lines = base + extra
+        rng.shuffle(lines)
+        cases.append((f'shuffled with {overlaps} overlaps #{n + 1}', lines))
+
+    for name, lines in cases:
+        start = time.perf_counter()
+        expected = remove_substring_conflicts_pairwise(lines)
+        pairwise = time.perf_counter() - start
+        start = time.perf_counter()
+        actual = remove_substring_conflicts(lines, verbose=False)
+        sweep = time.perf_counter() - start
+        if actual != expected:
+            raise SystemExit(f"error: substring conflicts differ from the pairwise scan ({name}): "
+                             f"{len(actual)} kept vs {len(expected)}")
+        if verbose:
+            print(f"# {name}: {len(lines)} in, {len(actual)} kept, "
+                  f"pairwise {pairwise:.2f}s, sweep {sweep:.2f}s", file=sys.stderr)
+    print(f"Substring conflicts match the pairwise scan on {path} ({len(cases)} cases)", file=sys.stderr)
 
 
 # region file io
@@ -609,103 +1076,322 @@ def load_source_words(args, verbose: bool) -> list[str]:
     return filtered_words
 
 
+# region layouts
+
+DEFAULT_GEOMETRY = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', '..', 'corne.json')
+LAYOUT_MACRO = 'LAYOUT_split_3x6_3'
+
+
+def load_key_positions(filepath: str) -> list[tuple[float, float]]:
+    """Key centres, in key units, in LAYOUT argument order."""
+    with open(filepath, 'r', encoding='utf-8') as f:
+        keys = json.load(f)['layouts'][LAYOUT_MACRO]['layout']
+    return [(k['x'] + k.get('w', 1) / 2, k['y'] + k.get('h', 1) / 2) for k in keys]
+
+
+def parse_layout_letters(filepath: str, layer: Optional[str] = None) -> list[Optional[str]]:
+    """
+    Letter tapped by each key of a keymap layer (None for non-letters).
+
+    Reads the `[layer] = LAYOUT_split_3x6_3(...)` block (the first one if no
+    layer is given), expands single-line #defines such as home row mods,
+    and takes the tap keycode of KC_x, MOD_T(KC_x), LT(layer, KC_x) or MT(mod, KC_x).
+    """
+    with open(filepath, 'r', encoding='utf-8') as f:
+        text = f.read()
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    text = re.sub(r'//[^\n]*', '', text)
+    defines = dict(re.findall(r'^[ \t]*#define[ \t]+(\w+)[ \t]+(.+?)[ \t]*$', text, flags=re.M))
+
+    head = rf'\[\s*{re.escape(layer)}\s*\]' if layer else r''
+    match = re.search(head + rf'\s*=\s*{LAYOUT_MACRO}\s*\(', text)
+    if not match:
+        raise SystemExit(f"error: no {LAYOUT_MACRO} block{f' for {layer}' if layer else ''} in {filepath}")
+
+    args, depth, current = [], 0, ''
+    for ch in text[match.end():]:
+        if ch == '(':
+            depth += 1
+        elif ch == ')':
+            if depth == 0:
+                break
+            depth -= 1
+        if ch == ',' and depth == 0:
+            args.append(current.strip())
+            current = ''
+        else:
+            current += ch
+    args.append(current.strip())
+
+    letters = []
+    for arg in args:
+        for _ in range(8):
+            if arg not in defines:
+                break
+            arg = defines[arg].strip()
+        tap = re.fullmatch(r'KC_([A-Z])|\w+_T\(\s*KC_([A-Z])\s*\)|(?:LT|MT)\([^,]+,\s*KC_([A-Z])\s*\)', arg)
+        letters.append(next((g.lower() for g in tap.groups() if g), None) if tap else None)
+    return letters
+
+
+def adjacency_from_layout(
+    letters: list[Optional[str]],
+    positions: list[tuple[float, float]],
+    max_distance: float,
+) -> dict[str, str]:
+    """Letters within max_distance key units of each letter, nearest first."""
+    adjacency = {}
+    for i, letter in enumerate(letters):
+        if not letter:
+            continue
+        xi, yi = positions[i]
+        near = []
+        for j, other in enumerate(letters):
+            if j == i or not other:
+                continue
+            distance = ((positions[j][0] - xi) ** 2 + (positions[j][1] - yi) ** 2) ** 0.5
+            if distance <= max_distance:
+                near.append((distance, other))
+        if near:
+            adjacency[letter] = ''.join(other for _, other in sorted(near))
+    return adjacency
+
+
+def load_layouts(specs: list[str], geometry: str, max_distance: float, verbose: bool) -> dict[str, dict[str, str]]:
+    """Parse NAME=KEYMAP_C[:LAYER] specs into per-layout adjacency maps."""
+    positions = load_key_positions(geometry)
+    layouts = {}
+    for spec in specs:
+        name, _, source = spec.partition('=')
+        path, _, layer = source.partition(':')
+        if not name or not path:
+            raise SystemExit(f"error: --layout expects NAME=KEYMAP_C[:LAYER], got {spec!r}")
+        letters = parse_layout_letters(path, layer or None)
+        if len(letters) != len(positions):
+            raise SystemExit(
+                f"error: {path} layout has {len(letters)} keys, {geometry} has {len(positions)}"
+            )
+        layouts[name] = adjacency_from_layout(letters, positions, max_distance)
+        if verbose:
+            print(
+                f"Layout {name}: {sum(1 for c in letters if c)} letters from {path}"
+                f"{f' ({layer})' if layer else ''}, {len(layouts[name])} with neighbours "
+                f"within {max_distance} keys",
+                file=sys.stderr,
+            )
+    return layouts
+
+
 # region multiprocessing
 
 # Global state for workers
-_VALIDATION_SET = None
-_SOURCE_WORDS_SET = None
+_VALIDATION_INDEX = None
+_FREQUENCY = None
 _TYPO_FREQ_THRESHOLD = 0.0
-_EXTRA_LETTERS_MAP = None
+_EXTRA_LETTERS_MAPS = None
 
 
-def _init_worker(validation_set, source_words_set, typo_freq_threshold, extra_letters_map):
-    """Initialize worker process."""
+def _init_worker(validation_path, frequency_path, typo_freq_threshold, extra_letters_maps):
+    """Initialize worker process (maps the parent's index files; nothing is copied)."""
     # pylint: disable=global-statement
-    global _VALIDATION_SET, _SOURCE_WORDS_SET, _TYPO_FREQ_THRESHOLD, _EXTRA_LETTERS_MAP
-    _VALIDATION_SET = validation_set
-    _SOURCE_WORDS_SET = source_words_set
+    global _VALIDATION_INDEX, _FREQUENCY, _TYPO_FREQ_THRESHOLD, _EXTRA_LETTERS_MAPS
+    _VALIDATION_INDEX = WordIndex.load(validation_path)
+    _FREQUENCY = FrequencyTable.load(frequency_path)
     _TYPO_FREQ_THRESHOLD = typo_freq_threshold
-    _EXTRA_LETTERS_MAP = extra_letters_map
+    _EXTRA_LETTERS_MAPS = extra_letters_maps
 
 
-def _process_word_worker(word):
-    """Worker function for multiprocessing."""
+def _screen_word_worker(task):
+    """Worker function for multiprocessing; task is (layout, word)."""
+    layout, word = task
     return (
-        word,
-        process_word(
-            word, _VALIDATION_SET, _SOURCE_WORDS_SET, _TYPO_FREQ_THRESHOLD, _EXTRA_LETTERS_MAP,
-        ),
+        task,
+        screen_word(word, _VALIDATION_INDEX, _FREQUENCY, _TYPO_FREQ_THRESHOLD, _EXTRA_LETTERS_MAPS[layout]),
     )
 
 
-# region main pipeline
+# region profiling
 
-def run_pipeline(args):
-    """Main processing pipeline."""
-    config = Config(args)
+def peak_rss_kib(who: int) -> int:
+    """High-water RSS in KiB (ru_maxrss is KiB on Linux, bytes on macOS)."""
+    peak = resource.getrusage(who).ru_maxrss
+    return peak // 1024 if sys.platform == 'darwin' else peak
 
-    # Load dictionaries and mappings
-    validation_set = load_validation_dictionary(args.exclude, config.verbose)
-    exclusions = load_exclusions(args.exclude_file, config.verbose)
-    exclusion_matcher = ExclusionMatcher(exclusions)
-    adjacent_letters_map = load_adjacent_letters(args.adjacent_letters, config.verbose)
 
-    # Load source words
-    user_included_words = load_word_list(args.include, config.verbose)
-    if config.verbose and user_included_words:
-        print(f"Loaded {len(user_included_words)} words from include file", file=sys.stderr)
+class StageProfiler:
+    """
+    Wall time, peak RSS and item counts per pipeline stage, for --profile.
 
-    user_included_words_set = set(user_included_words)
-    source_words = load_source_words(args, config.verbose)
-    source_words.extend(user_included_words)
+    Peak RSS is the high-water mark when the stage ends: for this process,
+    and for the largest pool worker that has exited so far.
+    """
 
-    if config.verbose and user_included_words:
-        print(
-            f"Included {len(user_included_words)} words from include file (bypassed filters)",
-            file=sys.stderr,
-        )
+    VERSION = 1
+
+    def __init__(self):
+        self.started = time.perf_counter()
+        self.stages: list[dict] = []
+
+    @contextmanager
+    def stage(self, name: str, layout: str = ''):
+        """Time the body; it fills the yielded dict with item counts."""
+        counts: dict[str, int] = {}
+        start = time.perf_counter()
+        yield counts
+        self.stages.append({
+            'stage': name,
+            'layout': layout,
+            'seconds': round(time.perf_counter() - start, 6),
+            'peak_rss_kib': peak_rss_kib(resource.RUSAGE_SELF),
+            'peak_rss_workers_kib': peak_rss_kib(resource.RUSAGE_CHILDREN),
+            'counts': counts,
+        })
+
+    def report(self, args) -> dict:
+        try:
+            english_words_version = metadata.version('english-words')
+        except metadata.PackageNotFoundError:
+            english_words_version = 'unknown'
+        return {
+            'version': self.VERSION,
+            'argv': sys.argv[1:],
+            'environment': {
+                'python': platform.python_version(),
+                'platform': platform.platform(),
+                'wordfreq': wordfreq_version(),
+                'english_words': english_words_version,
+                'jobs': args.jobs,
+            },
+            'total_seconds': round(time.perf_counter() - self.started, 6),
+            'stages': self.stages,
+        }
+
+    @staticmethod
+    def write(path: str, report: dict):
+        with open(path, 'w', encoding='utf-8') as f:
+            json.dump(report, f, indent=2)
+            f.write('\n')
 
-    if config.verbose:
-        print(f"\nProcessing {len(source_words)} words...\n", file=sys.stderr)
 
-    source_words_set = set(source_words)
+# region main pipeline
 
-    # Process words
-    typo_map = defaultdict(list)
+def open_validation_index(validation_set: set[str], index_dir: str) -> tuple[str, str]:
+    """
+    Write (or reuse) the validation index file in index_dir.
+
+    The file is named by the dictionary's content hash, so a persistent
+    cache directory skips the rebuild whenever the dictionary is unchanged.
+    Returns (path, dictionary hash).
+    """
+    digest = dictionary_hash(validation_set)
+    path = os.path.join(index_dir, f"validation-{digest[:16]}.idx")
+    if not os.path.exists(path):
+        tmp = f"{path}.{os.getpid()}.tmp"
+        WordIndex.build(validation_set).save(tmp)
+        os.replace(tmp, path)
+    return path, digest
+
+
+def screen_source_words(
+    source_words: list[str],
+    layouts: dict[str, dict[str, str]],
+    validation_path: str,
+    validation_index: WordIndex,
+    frequency_path: str,
+    frequency: FrequencyTable,
+    cache: Optional[WordCache],
+    config: Config,
+) -> dict[str, list[tuple[str, int]]]:
+    """
+    Screen every (layout, word) pair in one pool, keyed by WordCache.key.
+
+    Layouts that give a word the same adjacency entries share one result.
+    """
+    screened = {}
+    tasks = []
+    for layout, adjacency in layouts.items():
+        for word in source_words:
+            key = WordCache.key(word, adjacency)
+            if key in screened:
+                continue
+            screened[key] = cache.get(key) if cache else None
+            if screened[key] is None:
+                tasks.append((layout, word))
+
+    if config.verbose and cache:
+        print(
+            f"Word cache: {len(screened) - len(tasks)} hits, {len(tasks)} to process ({cache.path})",
+            file=sys.stderr,
+        )
 
-    if config.jobs > 1:
+    if config.jobs > 1 and len(tasks) > 1:
         if config.verbose:
             print(
-                f"Processing {len(source_words)} words using {config.jobs} workers...",
+                f"Processing {len(tasks)} words using {config.jobs} workers...",
                 file=sys.stderr,
             )
 
         with Pool(
             processes=config.jobs, initializer=_init_worker,
             initargs=(
-                validation_set,
-                source_words_set,
+                validation_path,
+                frequency_path,
                 config.typo_freq_threshold,
-                adjacent_letters_map,
+                layouts,
             ),
         ) as pool:
-            results = pool.map(_process_word_worker, source_words)
-
-        for word, corrections in results:
-            for typo, correction in corrections:
-                typo_map[typo].append(correction)
+            results = pool.map(_screen_word_worker, tasks)
     else:
+        results = [
+            ((layout, word), screen_word(
+                word, validation_index, frequency, config.typo_freq_threshold, layouts[layout],
+            ))
+            for layout, word in tasks
+        ]
+
+    for (layout, word), result in results:
+        key = WordCache.key(word, layouts[layout])
+        screened[key] = result
+        if cache:
+            cache.put(key, result)
+    if cache:
+        cache.save()
+
+    return screened
+
+
+def build_dictionary(
+    source_words: list[str],
+    adjacency: dict[str, str],
+    screened: dict[str, list[tuple[str, int]]],
+    source_index: WordIndex,
+    validation_index: WordIndex,
+    frequency: FrequencyTable,
+    user_included_words_set: set[str],
+    exclusion_matcher: ExclusionMatcher,
+    config: Config,
+    profiler: "StageProfiler",
+    layout: str = '',
+) -> list[str]:
+    """Turn screened typos for one layout into sorted dictionary lines."""
+    # Process words
+    with profiler.stage('boundaries', layout) as counts:
+        typo_map = defaultdict(list)
         for word in source_words:
-            corrections = process_word(word, validation_set, source_words_set,
-                                     config.typo_freq_threshold, adjacent_letters_map)
-            for typo, correction in corrections:
+            for typo, correction in process_word(word, screened[WordCache.key(word, adjacency)], source_index):
                 typo_map[typo].append(correction)
+        counts['words'] = len(source_words)
+        counts['typos'] = len(typo_map)
 
     # Resolve collisions
-    final_corrections, skipped_collisions, skipped_short = resolve_collisions(
-        typo_map, config.freq_ratio, config.min_typo_length,
-        user_included_words_set, exclusion_matcher
-    )
+    with profiler.stage('collisions', layout) as counts:
+        final_corrections, skipped_collisions, skipped_short = resolve_collisions(
+            typo_map, config.freq_ratio, config.min_typo_length,
+            user_included_words_set, exclusion_matcher, frequency,
+        )
+        counts['corrections'] = len(final_corrections)
+        counts['skipped_collisions'] = len(skipped_collisions)
+        counts['skipped_short'] = len(skipped_short)
 
     # Statistics
     if config.verbose:
@@ -724,14 +1410,19 @@ def run_pipeline(args):
                 print(f"#   {typo}: {words} (ratio: {ratio:.2f})", file=sys.stderr)
 
     # Generalize patterns
-    patterns = generalize_patterns(final_corrections, validation_set, config.min_typo_length)
-    final_corrections.extend(patterns)
+    with profiler.stage('patterns', layout) as counts:
+        patterns = generalize_patterns(final_corrections, validation_index, config.min_typo_length)
+        final_corrections.extend(patterns)
+        counts['patterns'] = len(patterns)
 
     if config.verbose:
         print(f"# After pattern generalization: {len(final_corrections)} entries", file=sys.stderr)
 
     # Remove substring conflicts
-    final_corrections = remove_substring_conflicts(final_corrections, config.verbose)
+    with profiler.stage('substring_conflicts', layout) as counts:
+        counts['corrections_in'] = len(final_corrections)
+        final_corrections = remove_substring_conflicts(final_corrections, config.verbose)
+        counts['corrections_out'] = len(final_corrections)
 
     # Sort output
     def sort_key(correction):
@@ -740,22 +1431,270 @@ def run_pipeline(args):
             return (word, typo)
         return (correction, '')
 
-    output_lines = sorted(final_corrections, key=sort_key)
+    return sorted(final_corrections, key=sort_key)
+
+
+def run_pipeline(args) -> "StageProfiler":
+    """Main processing pipeline; returns its per-stage profile."""
+    config = Config(args)
+    profiler = StageProfiler()
+
+    # Load dictionaries and mappings
+    with profiler.stage('load') as counts:
+        validation_set = load_validation_dictionary(args.exclude, config.verbose)
+        exclusions = load_exclusions(args.exclude_file, config.verbose)
+        exclusion_matcher = ExclusionMatcher(exclusions)
+        if args.layout:
+            layouts = load_layouts(args.layout, args.geometry, args.adjacency_distance, config.verbose)
+            for template in ([config.output] if config.output else []) + args.header:
+                if len(layouts) > 1 and '{layout}' not in template:
+                    raise SystemExit(f"error: {template!r} needs a {{layout}} placeholder for multiple layouts")
+            if len(layouts) > 1 and not config.output:
+                raise SystemExit("error: multiple layouts need -o with a {layout} placeholder")
+        else:
+            layouts = {'': load_adjacent_letters(args.adjacent_letters, config.verbose)}
+
+        # Load source words
+        user_included_words = load_word_list(args.include, config.verbose)
+        if config.verbose and user_included_words:
+            print(f"Loaded {len(user_included_words)} words from include file", file=sys.stderr)
+
+        user_included_words_set = set(user_included_words)
+        source_words = load_source_words(args, config.verbose)
+        source_words.extend(user_included_words)
+
+        counts['validation_words'] = len(validation_set)
+        counts['exclusions'] = len(exclusions)
+        counts['layouts'] = len(layouts)
+        counts['source_words'] = len(source_words)
+
+    if config.verbose and user_included_words:
+        print(
+            f"Included {len(user_included_words)} words from include file (bypassed filters)",
+            file=sys.stderr,
+        )
+
+    if config.verbose:
+        print(f"\nProcessing {len(source_words)} words...\n", file=sys.stderr)
+
+    # Index once into a flat file; every boundary check below is a binary
+    # search, and pool workers memory-map the same file
+    index_dir = tempfile.TemporaryDirectory(prefix='autocorrgen-', ignore_cleanup_errors=True)
+    with profiler.stage('index') as counts:
+        if config.cache_dir:
+            os.makedirs(config.cache_dir, exist_ok=True)
+        validation_path, validation_hash = open_validation_index(
+            validation_set, config.cache_dir or index_dir.name,
+        )
+        del validation_set
+        validation_index = WordIndex.load(validation_path)
+        source_index = WordIndex.build(source_words)
+        frequency_path = open_frequency_table(config.cache_dir or index_dir.name)
+        frequency = FrequencyTable.load(frequency_path)
+        counts['validation_words'] = len(validation_index)
+        counts['validation_suffixes'] = len(validation_index.suffixes)
+        counts['source_words'] = len(source_index)
+        counts['frequencies'] = len(frequency)
+    if config.verbose:
+        print(
+            f"Indexed {len(validation_index)} validation words "
+            f"({len(validation_index.suffixes)} distinct suffixes), "
+            f"{len(frequency)} word frequencies",
+            file=sys.stderr,
+        )
+
+    # Screen typos against the dictionary for every layout at once, reusing cached words
+    with profiler.stage('screen') as counts:
+        cache = WordCache(config.cache_dir, validation_hash, config.typo_freq_threshold) if config.cache_dir else None
+        screened = screen_source_words(
+            source_words, layouts, validation_path, validation_index, frequency_path, frequency, cache, config,
+        )
+        counts['words'] = len(source_words) * len(layouts)
+        counts['distinct'] = len(screened)
+        counts['typos'] = sum(len(typos) for typos in screened.values())
+
+    for layout, adjacency in layouts.items():
+        if config.verbose and layout:
+            print(f"\n# Layout {layout}", file=sys.stderr)
+
+        output_lines = build_dictionary(
+            source_words, adjacency, screened, source_index, validation_index, frequency,
+            user_included_words_set, exclusion_matcher, config, profiler, layout,
+        )
 
-    # Write output
-    if config.output:
-        with open(config.output, 'w', encoding='utf-8') as f:
-            for line in output_lines:
-                f.write(line + '\n')
+        # Trade flash for coverage: keep the entries worth the most per trie byte;
+        # the budget curve always goes to stderr, as with autocorrdata.py
+        if args.budget_bytes:
+            with profiler.stage('budget', layout) as counts:
+                try:
+                    budgeted = select_within_budget(
+                        parse_dictionary(output_lines), args.budget_bytes,
+                        frequency,
+                        share=not args.no_share, verbose=True,
+                    )
+                except ValueError as e:
+                    raise SystemExit(f"error: {e}") from e
+                counts['corrections_in'] = len(output_lines)
+                output_lines = [f"{typo} -> {correction}" for typo, correction in budgeted]
+                counts['corrections_out'] = len(output_lines)
+
+        with profiler.stage('output', layout) as counts:
+            # Write output
+            if config.output:
+                output = config.output.replace('{layout}', layout)
+                with open(output, 'w', encoding='utf-8') as f:
+                    for line in output_lines:
+                        f.write(line + '\n')
+                if config.verbose:
+                    print(f"\nWrote {len(output_lines)} corrections to {output}", file=sys.stderr)
+            else:
+                for line in output_lines:
+                    print(line)
+
+            # Emit the firmware trie directly, after replaying it if asked
+            if args.header or args.replay:
+                emit_headers(
+                    parse_dictionary(output_lines), [h.replace('{layout}', layout) for h in args.header],
+                    share=not args.no_share, verbose=config.verbose, replay=replay_check(args),
+                )
+            counts['corrections'] = len(output_lines)
+            counts['headers'] = len(args.header)
+
+    index_dir.cleanup()
+
+    if args.profile:
+        profiler.write(args.profile, profiler.report(args))
         if config.verbose:
-            print(f"\nWrote {len(output_lines)} corrections to {config.output}", file=sys.stderr)
-    else:
-        for line in output_lines:
-            print(line)
+            print(f"Wrote profile to {args.profile}", file=sys.stderr)
+
+    return profiler
+
+
+# region benchmark
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+BENCHMARK_WORDS = os.path.join(HERE, 'benchmark_words.txt')
+BENCHMARK_LAYOUTS = ('qwerty', 'gallium')
+BENCHMARK_TOLERANCE = 1.25      # slower than this factor of the baseline is a regression
+BENCHMARK_MIN_SECONDS = 0.05    # stages shorter than this are too noisy to judge
+
+
+def benchmark_argv(jobs: int, out_dir: str) -> list[str]:
+    """
+    The fixed benchmark run: the committed word snapshot against both base
+    layouts, uncached, with every optional stage but the budget enabled.
+    Everything it reads is in the repo or in the installed packages.
+    """
+    argv = [
+        '--include', BENCHMARK_WORDS,
+        '--exclude-file', os.path.join(HERE, 'exclude.txt'),
+        '--typo-freq-threshold', '1e-7',
+        '--no-cache',
+        '-j', str(jobs),
+        '-o', os.path.join(out_dir, 'autocorrect_{layout}.txt'),
+        '--header', os.path.join(out_dir, 'autocorrect_data_{layout}.h'),
+    ]
+    for name in BENCHMARK_LAYOUTS:
+        argv += ['--layout', f"{name}={os.path.join(HERE, '..', name, 'keymap.c')}"]
+    return argv
+
+
+def summarize_runs(runs: list[dict]) -> dict:
+    """Median seconds per (stage, layout) and in total across benchmark runs."""
+    seconds = defaultdict(list)
+    for run in runs:
+        for stage in run['stages']:
+            seconds[(stage['stage'], stage['layout'])].append(stage['seconds'])
+    words = runs[0]['stages'][0]['counts']['source_words'] * len(BENCHMARK_LAYOUTS)
+    total = median(run['total_seconds'] for run in runs)
+    return {
+        'total_seconds': total,
+        'words_per_second': round(words / total, 1),
+        'stages': [
+            {
+                'stage': stage['stage'],
+                'layout': stage['layout'],
+                'seconds': median(seconds[(stage['stage'], stage['layout'])]),
+                'counts': stage['counts'],
+            }
+            for stage in runs[0]['stages']
+        ],
+    }
+
+
+def compare_benchmarks(baseline: dict, current: dict) -> list[str]:
+    """Stages (and the total) that got slower than BENCHMARK_TOLERANCE allows."""
+    if baseline['environment'] != current['environment']:
+        print("warning: baseline was measured in a different environment:", file=sys.stderr)
+        for key, value in current['environment'].items():
+            if baseline['environment'].get(key) != value:
+                print(f"  {key}: {baseline['environment'].get(key)} -> {value}", file=sys.stderr)
+
+    before = {(s['stage'], s['layout']): s['seconds'] for s in baseline['median']['stages']}
+    before[('total', '')] = baseline['median']['total_seconds']
+    after = {(s['stage'], s['layout']): s['seconds'] for s in current['median']['stages']}
+    after[('total', '')] = current['median']['total_seconds']
+
+    regressions = []
+    for key, seconds in after.items():
+        if key not in before:
+            continue
+        old = before[key]
+        name = '/'.join(part for part in key if part)
+        print(f"  {name:<28} {old:9.3f}s -> {seconds:9.3f}s", file=sys.stderr)
+        if seconds > old * BENCHMARK_TOLERANCE and seconds - old > BENCHMARK_MIN_SECONDS:
+            regressions.append(f"{name}: {old:.3f}s -> {seconds:.3f}s")
+    return regressions
+
+
+def run_benchmark(parser: argparse.ArgumentParser, args):
+    """Run the fixed benchmark args.benchmark_runs times and report medians."""
+    runs = []
+    with tempfile.TemporaryDirectory(prefix='autocorrgen-bench-') as out_dir:
+        bench = parser.parse_args(benchmark_argv(args.jobs, out_dir))
+        for i in range(args.benchmark_runs):
+            runs.append(run_pipeline(bench).report(bench))
+            print(f"Run {i + 1}/{args.benchmark_runs}: {runs[-1]['total_seconds']:.3f}s", file=sys.stderr)
+
+    result = dict(runs[-1], argv=sys.argv[1:], runs=runs, median=summarize_runs(runs))
+    del result['stages']
+    del result['total_seconds']
+
+    print(f"\n{'stage':<28} {'median':>10}  counts", file=sys.stderr)
+    for stage in result['median']['stages']:
+        name = '/'.join(part for part in (stage['stage'], stage['layout']) if part)
+        counts = ' '.join(f"{k}={v}" for k, v in stage['counts'].items())
+        print(f"{name:<28} {stage['seconds']:9.3f}s  {counts}", file=sys.stderr)
+    print(
+        f"{'total':<28} {result['median']['total_seconds']:9.3f}s  "
+        f"{result['median']['words_per_second']} words/s",
+        file=sys.stderr,
+    )
+
+    if args.profile:
+        StageProfiler.write(args.profile, result)
+        print(f"Wrote benchmark to {args.profile}", file=sys.stderr)
+
+    if args.compare:
+        with open(args.compare, 'r', encoding='utf-8') as f:
+            baseline = json.load(f)
+        print(f"\nAgainst {args.compare}:", file=sys.stderr)
+        regressions = compare_benchmarks(baseline, result)
+        if regressions:
+            print(f"\n{len(regressions)} regression(s) beyond {BENCHMARK_TOLERANCE:g}x:", file=sys.stderr)
+            for line in regressions:
+                print(f"  {line}", file=sys.stderr)
+            sys.exit(1)
 
 
 # region cli
 
+def default_cache_dir() -> str:
+    """$XDG_CACHE_HOME/autocorrgen, falling back to ~/.cache/autocorrgen."""
+    base = os.environ.get('XDG_CACHE_HOME') or os.path.join(os.path.expanduser('~'), '.cache')
+    return os.path.join(base, 'autocorrgen')
+
+
 def main():
     """Main entry point."""
     parser = argparse.ArgumentParser(
@@ -774,12 +1713,41 @@ Examples:
 
   # With exclusions and custom settings
   %(prog)s --top-n 1000 --exclude-file exclusions.txt --max-length 8 -o autocorrect.txt
+
+  # Write the firmware header for a keymap as well
+  %(prog)s --top-n 1000 -o autocorrect.txt --header ../qwerty/autocorrect_data.h
+
+  # Only write it if replaying some prose through the trie stays under 20 false triggers
+  %(prog)s --top-n 1000 -o autocorrect.txt --header ../qwerty/autocorrect_data.h \\
+      --replay ~/corpus/novels.txt --replay-max-false 20
+
+  # One dictionary per layout, adjacency from each keymap's base layer
+  %(prog)s --top-n 1000 --layout qwerty=../qwerty/keymap.c --layout gallium=../gallium/keymap.c \\
+      -o autocorrect_{layout}.txt --header ../{layout}/autocorrect_data.h
+
+  # Where does a run spend its time?
+  %(prog)s --top-n 5000 -o autocorrect.txt --profile profile.json
+
+  # Record a throughput baseline, then check a change against it
+  %(prog)s --benchmark --profile bench-before.json
+  %(prog)s --benchmark --compare bench-before.json
+
+  # Check the substring conflict sweep against the pairwise scan
+  %(prog)s --check-conflicts -v
         """
     )
 
     # Output
     parser.add_argument('-o', '--output', type=str,
                        help='Output file for corrections. If not specified, writes to stdout')
+    parser.add_argument('--header', action='append', default=[],
+                       help='Also write a QMK autocorrect_data.h here (can be specified multiple times)')
+    parser.add_argument('--no-share', action='store_true',
+                       help='Pack the header without subtree sharing, jump table or compact trie '
+                            '(byte-identical to qmk generate-autocorrect-data)')
+    parser.add_argument('--budget-bytes', type=int,
+                       help='Keep only the corrections worth the most per byte that fit in this trie size')
+    add_replay_arguments(parser)
     parser.add_argument('--top-n', type=int,
                        help='Pull top N most common English words that meet criteria (from wordfreq)')
 
@@ -792,6 +1760,14 @@ Examples:
                        help='File with exclusions: typos, patterns, and wildcards to skip (one per line, # for comments)')
     parser.add_argument('--adjacent-letters', type=str,
                        help='File mapping keys to possible extra letters (e.g., "b -> nvgh")')
+    parser.add_argument('--layout', action='append', default=[],
+                       help='NAME=KEYMAP_C[:LAYER]: derive adjacency from this keymap layer and the key '
+                            'geometry instead of --adjacent-letters; one dictionary per layout, with '
+                            '{layout} in -o/--header replaced by NAME (can be specified multiple times)')
+    parser.add_argument('--geometry', type=str, default=DEFAULT_GEOMETRY,
+                       help='Physical key positions for --layout (default: corne.json at the repo root)')
+    parser.add_argument('--adjacency-distance', type=float, default=1.2,
+                       help='Max distance in key units between neighbouring keys for --layout (default: 1.2)')
 
     # Parameters
     parser.add_argument('--freq-ratio', type=float, default=10.0,
@@ -810,9 +1786,37 @@ Examples:
                        help='Verbose output (show stats and skipped collisions)')
     parser.add_argument('-j', '--jobs', type=int, default=cpu_count(),
                        help=f'Number of parallel workers (default: {cpu_count()})')
+    parser.add_argument('--cache-dir', type=str, default=default_cache_dir(),
+                       help='Directory for the word cache and dictionary index (default: %(default)s)')
+    parser.add_argument('--no-cache', action='store_true',
+                       help='Reprocess every word and do not read or write the cache')
+
+    # Profiling
+    parser.add_argument('--profile', type=str,
+                       help='Write wall time, peak RSS and item counts per pipeline stage to this JSON file')
+    parser.add_argument('--benchmark', action='store_true',
+                       help='Ignore the word options and time the fixed benchmark corpus (benchmark_words.txt)')
+    parser.add_argument('--benchmark-runs', type=int, default=3,
+                       help='Benchmark repetitions; stage times are medians (default: 3)')
+    parser.add_argument('--check-conflicts', nargs='?', const=os.path.join(HERE, 'autocorrect_dict.txt'),
+                       metavar='DICT',
+                       help='Ignore the word options and check the substring conflict sweep against the '
+                            'pairwise scan on this dictionary (default: autocorrect_dict.txt); exit 1 if they differ')
+    parser.add_argument('--compare', type=str,
+                       help=f'With --benchmark: compare against an earlier --profile of a benchmark and '
+                            f'exit 1 if anything got more than {BENCHMARK_TOLERANCE:g}x slower')
 
     args = parser.parse_args()
 
+    if args.compare and not args.benchmark:
+        parser.error('--compare needs --benchmark')
+    if args.check_conflicts:
+        check_substring_conflicts(args.check_conflicts, args.verbose)
+        return
+    if args.benchmark:
+        run_benchmark(parser, args)
+        return
+
     run_pipeline(args)
 
 
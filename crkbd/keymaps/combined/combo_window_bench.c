@@ -0,0 +1,192 @@
+// Host benchmark for the combo window in keymap.c.
+//
+// Loads the combo key arrays from combos.def and runs the loop QMK's
+// process_combo() does on every key event: for each of combo_count() entries,
+// fetch it with combo_get() and walk its keys up to COMBO_END looking for the
+// event's keycode. Compares all 108 entries (no window, as before) with the
+// 58-entry window for each layout, in key reads per event (flash fetches on
+// the RP2040) and host time per event. Also checks that each window finds
+// exactly the utility combos and that layout's chords the full walk finds,
+// and exits non-zero if not.
+//   cc -O2 -o combo_window_bench combo_window_bench.c
+//   ./combo_window_bench combos.def [EVENTS]
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define COMBO_END  0
+#define MAX_COMBOS 128
+#define MAX_KEYS   8
+#define MAX_CODES  128
+
+// ─── combos.def ──────────────────────────────────────────────────────────────
+// Keycode expressions ("KC_T", "HM_A", "LT(_NUMBERS,KC_G)") are interned to
+// small ids; the arrays keep file order, which is the combo_events order.
+
+static char     codes[MAX_CODES][32];
+static uint16_t code_count;
+
+static uint16_t key_arrays[MAX_COMBOS][MAX_KEYS + 1];
+static uint16_t combo_total;
+static uint16_t qwc_first, gwc_first; // first QWERTY and Gallium chord
+
+static uint16_t intern(const char *code) {
+    for (uint16_t i = 0; i < code_count; i++) {
+        if (!strcmp(codes[i], code)) return i + 1;
+    }
+    if (code_count == MAX_CODES) {
+        fprintf(stderr, "too many keycodes\n");
+        exit(2);
+    }
+    snprintf(codes[code_count], sizeof(codes[0]), "%s", code);
+    return ++code_count;
+}
+
+static void load(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        perror(path);
+        exit(2);
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        char name[32];
+        int  body = 0;
+        if (sscanf(line, "const uint16_t PROGMEM %31[a-z_][] = {%n", name, &body) != 1 || !body) continue;
+        if (combo_total == MAX_COMBOS) {
+            fprintf(stderr, "too many combos\n");
+            exit(2);
+        }
+        if (!strncmp(name, "qwc_", 4) && !qwc_first) qwc_first = combo_total;
+        if (!strncmp(name, "gwc_", 4) && !gwc_first) gwc_first = combo_total;
+
+        // Split on top-level commas, dropping spaces
+        uint16_t *keys  = key_arrays[combo_total++];
+        uint8_t   count = 0, depth = 0;
+        char      code[32];
+        size_t    len = 0;
+        for (const char *c = line + body; *c && *c != '}'; c++) {
+            if (*c == ' ') continue;
+            if (*c == '(') depth++;
+            if (*c == ')') depth--;
+            if (*c != ',' || depth) {
+                if (len < sizeof(code) - 1) code[len++] = *c;
+                continue;
+            }
+            code[len] = 0;
+            len       = 0;
+            if (count < MAX_KEYS) keys[count++] = intern(code);
+        }
+        keys[count] = COMBO_END; // the last field is COMBO_END itself
+    }
+    fclose(f);
+    if (!qwc_first || gwc_first <= qwc_first || combo_total - gwc_first != gwc_first - qwc_first) {
+        fprintf(stderr, "%s: expected utility combos, then equal QWERTY and Gallium blocks\n", path);
+        exit(2);
+    }
+}
+
+// ─── Matcher ─────────────────────────────────────────────────────────────────
+
+static uint16_t          window_count;  // combo_count()
+static uint16_t          window_offset; // combo_block_offset in keymap.c
+static unsigned long long key_reads;
+static volatile uint16_t  match_sink; // keeps the timed walk from being optimized out
+
+static const uint16_t *combo_get(uint16_t idx) {
+    if (idx >= qwc_first) idx += window_offset;
+    return key_arrays[idx];
+}
+
+// process_combo()'s walk for one event; marks the combos the key belongs to
+static uint16_t match(uint16_t keycode, bool *hits) {
+    uint16_t found = 0;
+    for (uint16_t idx = 0; idx < window_count; idx++) {
+        const uint16_t *keys = combo_get(idx);
+        for (;; keys++) {
+            uint16_t const k = *keys;
+            key_reads++;
+            if (k == COMBO_END) break;
+            if (k == keycode) {
+                if (hits) hits[idx + (idx >= qwc_first ? window_offset : 0)] = true;
+                found++;
+                break;
+            }
+        }
+    }
+    return found;
+}
+
+static void set_window(int window) {
+    if (window < 0) {
+        window_count  = combo_total;
+        window_offset = 0;
+    } else {
+        window_count  = gwc_first;
+        window_offset = window ? gwc_first - qwc_first : 0;
+    }
+}
+
+// The window must find what the full walk finds, minus the other layout
+static bool check(int window) {
+    for (uint16_t code = 1; code <= code_count + 1; code++) {
+        bool full[MAX_COMBOS] = {0}, windowed[MAX_COMBOS] = {0};
+        set_window(-1);
+        match(code, full);
+        set_window(window);
+        match(code, windowed);
+        uint16_t const skip_from = window ? qwc_first : gwc_first;
+        uint16_t const skip_to   = window ? gwc_first : combo_total;
+        for (uint16_t idx = skip_from; idx < skip_to; idx++) full[idx] = false;
+        if (memcmp(full, windowed, sizeof(full))) {
+            fprintf(stderr, "window %d: matches differ for %s\n", window,
+                    code <= code_count ? codes[code - 1] : "(no combo key)");
+            return false;
+        }
+    }
+    return true;
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s combos.def [EVENTS]\n", argv[0]);
+        return 2;
+    }
+    load(argv[1]);
+    unsigned long const events = argc > 2 ? strtoul(argv[2], NULL, 10) : 1000000;
+
+    // Keys from the combos plus one that is in none (id code_count + 1), in a
+    // fixed pseudo-random order
+    uint16_t stream[4096];
+    uint32_t seed = 1;
+    for (size_t i = 0; i < sizeof(stream) / sizeof(stream[0]); i++) {
+        seed      = seed * 1103515245u + 12345u;
+        stream[i] = 1 + (seed >> 16) % (code_count + 1);
+    }
+
+    static const char *const names[] = {"none", "qwerty", "gallium"};
+    bool                     ok      = check(0) && check(1);
+    printf("%-8s %7s %16s %9s\n", "window", "entries", "key reads/event", "ns/event");
+    for (int window = -1; window <= 1; window++) {
+        set_window(window);
+        key_reads          = 0;
+        double const start = now_ns();
+        for (unsigned long i = 0; i < events; i++) match_sink = match(stream[i & 4095], NULL);
+        double const elapsed = now_ns() - start;
+        printf("%-8s %7u %16.1f %9.1f\n", names[window + 1], window_count, (double)key_reads / events,
+               elapsed / events);
+    }
+    return ok ? 0 : 1;
+}
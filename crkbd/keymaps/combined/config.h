@@ -6,9 +6,12 @@
 #define DYNAMIC_KEYMAP_LAYER_COUNT 8
 #define TAPPING_TERM 180
 #define TAPPING_TERM_PER_KEY
+#define TAPPING_TERM_MOD_TAP 300  // get_tapping_term(): home row mod-taps wait longer
 #define QUICK_TAP_TERM 120        // Repeat key on fast double-tap instead of hold
 #define PERMISSIVE_HOLD           // Register hold earlier during fast rolls
 #define CHORDAL_HOLD              // Same-hand keys = tap, opposite-hand = hold
+#define FLOW_TAP_TERM 150         // Mid-word home row mod = instant tap (per key in keymap.c)
+#define FLOW_TAP_TERM_SHIFT 100   // Shorter streak window on the Shift pinkies
 
 #ifdef KEYBOARD_crkbd_rev1_legacy
 #    undef USE_I2C
@@ -20,8 +23,28 @@
 #define COMBO_TERM 80
 #define COMBO_STRICT_TIMER
 
-// Anti-mash guard: suppress accidental simultaneous keypresses within this window (ms)
+// Anti-mash guard: drop presses once this many neighbouring keys land with
+// under MASH_GUARD_TERM ms between each press and the next (lib/mash_guard.h).
+// Mod-tap and layer-tap keys never count towards a mash: the tapping code has
+// already resolved them, and dropping one would lose a held mod or layer.
 #define MASH_GUARD_TERM 8
+#define MASH_GUARD_MIN_KEYS 3
+
+// Autocorrect: walk the trie in userspace, starting from a 28-entry jump table
+// instead of scanning the root's children. Needs an autocorrect_data.h from
+// autocorrdata.py; QMK's own copy shrinks to a 1-byte placeholder, so this
+// costs only the 56-byte table.
+// #define AUTOCORRECT_JUMP_TABLE
+
+// Autocorrect: walk a bit-packed copy of the trie instead. Trades speed for
+// flash: about a third the size of QMK's stock format, but against the stock
+// walk +89% trie reads and +196% time per keystroke on the replay corpus.
+// QMK's own copy shrinks to a 1-byte placeholder. Alternative to
+// AUTOCORRECT_JUMP_TABLE.
+// #define AUTOCORRECT_COMPACT_TRIE
+
+// Word chord output: minimum gap between queued chord HID reports (ms)
+#define WORD_CHORD_REPORT_INTERVAL 1
 
 // Trackpad support
 #define AZOTEQ_IQS5XX_WIDTH_MM  43
@@ -40,12 +63,24 @@
 #define AZOTEQ_IQS5XX_TIMEOUT_MS 20
 #define AZOTEQ_IQS5XX_SCROLL_INITIAL_DISTANCE 18
 
-#define SPLIT_POINTING_ENABLE
+#ifdef SPLIT_POINTING_BATCH_ENABLE
+#    define SPLIT_POINTING_BATCH_INTERVAL 8  // Master pulls the trackpad's batch every 8 ms
+#    define POINTING_POLL_IDLE_MS 64          // Untouched trackpad: polling backs off to 64 ms
+// #    define AZOTEQ_IQS5XX_RDY_PIN GP__     // RDY wired: poll only while it is high
+#else
+#    define SPLIT_POINTING_ENABLE
+#endif
 #define POINTING_DEVICE_RIGHT
 
 #define MASTER_LEFT
 
 #define USE_SERIAL_PD2
+
+// User split transaction: SPLIT_POINTING_BATCH pulls the trackpad's batched
+// motion (lib/pointing_batch.h)
+#ifdef SPLIT_POINTING_BATCH_ENABLE
+#    define SPLIT_TRANSACTION_IDS_USER SPLIT_POINTING_BATCH
+#endif
 #ifdef RGBLIGHT_ENABLE
 #    undef RGBLIGHT_LED_COUNT
 #    define RGBLIGHT_ANIMATIONS
@@ -13,6 +13,7 @@
 
 #include QMK_KEYBOARD_H
 #include <stdio.h>
+#include "keyboards/crkbd/lib/latency_trace.h" // no-op unless LATENCY_TRACE_ENABLE
 
 // ─── Layer Names ────────────────────────────────────────────────────────────
 
@@ -146,22 +147,162 @@ enum combo_events {
 // Include combo key arrays
 #include "combos.def"
 
-// Gate combos by active base layout
-bool combo_should_trigger(uint16_t combo_index, combo_t *combo, uint16_t keycode, keyrecord_t *record) {
-    if (combo_index <= CMB_NUM_TG) return true;
+// ─── Combo Window ───────────────────────────────────────────────────────────
+// The combo engine walks combo_count() entries on every key event. Only the
+// utility combos and the active layout's word chords can fire, so expose just
+// that window: utility combos keep their indices, and QWC_* indices map onto
+// the QWERTY or Gallium block for the current base layer. Layout gating is a
+// single offset add instead of a per-combo check.
+//
+// The engine keeps each combo's progress in the combo_t that combo_get()
+// returns and finds fired combos again by window index, so the window must
+// not move while a combo is partly pressed or active. A base layer change
+// (CMB_CYCLE fires with its own keys still down) takes effect once every key
+// is up.
 
-    uint8_t base = get_highest_layer(default_layer_state);
+#define COMBO_WINDOW_SIZE GWC_THE
+#define COMBO_BLOCK_SIZE  (GWC_THE - QWC_THE)
 
-    if (combo_index >= QWC_THE && combo_index <= QWC_COME) {
-        return (base == _QWERTY || base == _QWERTY_WIN);
-    }
-    if (combo_index >= GWC_THE && combo_index <= GWC_COME) {
-        return (base == _GALLIUM || base == _GALLIUM_WIN);
+static uint8_t combo_block_offset = 0;  // 0 = QWERTY chords, COMBO_BLOCK_SIZE = Gallium
+static uint8_t combo_block_next   = 0;  // the base layer's block, once all keys are up
+
+uint16_t combo_count(void) {
+    return COMBO_WINDOW_SIZE;
+}
+
+combo_t *combo_get(uint16_t combo_idx) {
+    if (combo_idx >= QWC_THE) combo_idx += combo_block_offset;
+    return &key_combos[combo_idx];
+}
+
+layer_state_t default_layer_state_set_user(layer_state_t state) {
+    uint8_t base     = get_highest_layer(state);
+    combo_block_next = (base == _GALLIUM || base == _GALLIUM_WIN) ? COMBO_BLOCK_SIZE : 0;
+    return state;
+}
+
+// From housekeeping_task_user, after the scan's key events went through the
+// engine
+static void combo_window_task(void) {
+    if (combo_block_offset == combo_block_next) return;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        if (matrix_get_row(row)) return;
     }
+    combo_block_offset = combo_block_next;
+}
+
+// ─── Trackpad ────────────────────────────────────────────────────────────────
+// With SPLIT_POINTING_BATCH_ENABLE the IQS5xx on the right half is driven from
+// here instead of QMK's split pointing sync (lib/pointing_batch.h). With
+// POINTING_ACCEL_ENABLE its motion is smoothed and accelerated on the master
+// (lib/pointing_accel.h).
+
+#ifdef SPLIT_POINTING_BATCH_ENABLE
+#    include "keyboards/crkbd/lib/pointing_batch.h"
+
+bool pointing_device_driver_init(void) {
+    pointing_batch_init();
     return true;
 }
 
+report_mouse_t pointing_device_driver_get_report(report_mouse_t mouse_report) {
+    return is_keyboard_master() ? pointing_batch_pull(mouse_report) : mouse_report;
+}
+
+uint16_t pointing_device_driver_get_cpi(void) {
+    return POINTING_BATCH_THIS_SIDE ? azoteq_iqs5xx_get_cpi() : 0;
+}
+
+void pointing_device_driver_set_cpi(uint16_t cpi) {
+    if (POINTING_BATCH_THIS_SIDE) azoteq_iqs5xx_set_cpi(cpi);
+}
+#endif
+
+#ifdef POINTING_ACCEL_ENABLE
+#    include "keyboards/crkbd/lib/pointing_accel.h"
+
+report_mouse_t pointing_device_task_user(report_mouse_t mouse_report) {
+    return pointing_accel_apply(mouse_report);
+}
+#endif
+
+// ─── Word Chord Output Queue ────────────────────────────────────────────────
+// Chord text is typed from housekeeping_task_user one HID report at a time
+// instead of a blocking SEND_STRING, so matrix scanning keeps running while a
+// word is being emitted (lib/word_chord.h). The pool is indexed by QWC_*
+// offset.
+
+#define WC_COUNT   (QWC_COME - QWC_THE + 1)
+#define WC_MAX_LEN 7     // "which " + NUL
+
+static const char PROGMEM wc_strings[WC_COUNT][WC_MAX_LEN] = {
+    "the ",    "be ",     "to ",     "and ",    "of ",
+    "in ",     "have ",   "that ",   "for ",    "not ",
+    "with ",   "you ",    "this ",   "from ",   "but ",
+    "what ",   "it ",     "he ",     "on ",     "are ",
+    "do ",     "his ",    "by ",     "they ",   "her ",
+    "or ",     "at ",     "one ",    "had ",    "say ",
+    "she ",    "all ",    "which ",  "will ",   "would ",
+    "there ",  "their ",  "my ",     "out ",    "up ",
+    "about ",  "who ",    "get ",    "make ",   "go ",
+    "like ",   "just ",   "know ",   "take ",   "come ",
+};
+
+// A held mod-tap is queued as its mods on KC_NO (LSFT(KC_NO) and so on), so
+// it can't shift or Ctrl the text ahead of it. register_code16() would send
+// those as weak mods, which the next key press clears, so they go out as
+// real mods here.
+static uint8_t wc_mod_bits(uint16_t keycode) {
+    uint8_t const mods = QK_MODS_GET_MODS(keycode);
+    return (mods & 0x10) ? (mods & 0x0F) << 4 : mods;
+}
+
+static void wc_register(uint16_t keycode) {
+    if (QK_MODS_GET_BASIC_KEYCODE(keycode)) {
+        register_code16(keycode);
+    } else {
+        register_mods(wc_mod_bits(keycode));
+    }
+}
+
+static void wc_unregister(uint16_t keycode) {
+    if (QK_MODS_GET_BASIC_KEYCODE(keycode)) {
+        unregister_code16(keycode);
+    } else {
+        unregister_mods(wc_mod_bits(keycode));
+    }
+}
+
+#define WC_REGISTER(keycode)   wc_register(keycode)
+#define WC_UNREGISTER(keycode) wc_unregister(keycode)
+#include "keyboards/crkbd/lib/word_chord.h"
+
+static uint16_t wc_timer = 0;
+
+// The keycode a key sends on its own (a held mod-tap: its mods alone), or
+// KC_NO if it does more than that
+static uint16_t wc_output_keycode(uint16_t keycode, keyrecord_t *record) {
+    if (IS_QK_MOD_TAP(keycode)) {
+        return record->tap.count ? QK_MOD_TAP_GET_TAP_KEYCODE(keycode) : QK_MOD_TAP_GET_MODS(keycode) << 8;
+    }
+    if (IS_QK_LAYER_TAP(keycode)) {
+        return record->tap.count ? QK_LAYER_TAP_GET_TAP_KEYCODE(keycode) : KC_NO;
+    }
+    return (IS_QK_BASIC(keycode) || IS_QK_MODS(keycode)) ? keycode : KC_NO;
+}
+
+void housekeeping_task_user(void) {
+    latency_trace_task();
+    combo_window_task();
+#ifdef SPLIT_POINTING_BATCH_ENABLE
+    pointing_batch_task();
+#endif
+    if (TIMER_DIFF_16(timer_read(), wc_timer) < WORD_CHORD_REPORT_INTERVAL) return;
+    if (wc_step()) wc_timer = timer_read();
+}
+
 void process_combo_event(uint16_t combo_index, bool pressed) {
+    latency_trace_combo(combo_index, pressed);
     if (!pressed) return;
     switch (combo_index) {
         case CMB_CYCLE: {
@@ -189,57 +330,12 @@ void process_combo_event(uint16_t combo_index, bool pressed) {
             tap_code16(win ? LCTL(KC_RBRC) : LGUI(KC_RBRC));
             break;
         }
-        // Word chords (shared between QWERTY and Gallium variants)
-        case QWC_THE:   case GWC_THE:   SEND_STRING("the "); break;
-        case QWC_BE:    case GWC_BE:    SEND_STRING("be "); break;
-        case QWC_TO:    case GWC_TO:    SEND_STRING("to "); break;
-        case QWC_AND:   case GWC_AND:   SEND_STRING("and "); break;
-        case QWC_OF:    case GWC_OF:    SEND_STRING("of "); break;
-        case QWC_IN:    case GWC_IN:    SEND_STRING("in "); break;
-        case QWC_HAVE:  case GWC_HAVE:  SEND_STRING("have "); break;
-        case QWC_THAT:  case GWC_THAT:  SEND_STRING("that "); break;
-        case QWC_FOR:   case GWC_FOR:   SEND_STRING("for "); break;
-        case QWC_NOT:   case GWC_NOT:   SEND_STRING("not "); break;
-        case QWC_WITH:  case GWC_WITH:  SEND_STRING("with "); break;
-        case QWC_YOU:   case GWC_YOU:   SEND_STRING("you "); break;
-        case QWC_THIS:  case GWC_THIS:  SEND_STRING("this "); break;
-        case QWC_FROM:  case GWC_FROM:  SEND_STRING("from "); break;
-        case QWC_BUT:   case GWC_BUT:   SEND_STRING("but "); break;
-        case QWC_WHAT:  case GWC_WHAT:  SEND_STRING("what "); break;
-        case QWC_IT:    case GWC_IT:    SEND_STRING("it "); break;
-        case QWC_HE:    case GWC_HE:    SEND_STRING("he "); break;
-        case QWC_ON:    case GWC_ON:    SEND_STRING("on "); break;
-        case QWC_ARE:   case GWC_ARE:   SEND_STRING("are "); break;
-        case QWC_DO:    case GWC_DO:    SEND_STRING("do "); break;
-        case QWC_HIS:   case GWC_HIS:   SEND_STRING("his "); break;
-        case QWC_BY:    case GWC_BY:    SEND_STRING("by "); break;
-        case QWC_THEY:  case GWC_THEY:  SEND_STRING("they "); break;
-        case QWC_HER:   case GWC_HER:   SEND_STRING("her "); break;
-        case QWC_OR:    case GWC_OR:    SEND_STRING("or "); break;
-        case QWC_AT:    case GWC_AT:    SEND_STRING("at "); break;
-        case QWC_ONE:   case GWC_ONE:   SEND_STRING("one "); break;
-        case QWC_HAD:   case GWC_HAD:   SEND_STRING("had "); break;
-        case QWC_SAY:   case GWC_SAY:   SEND_STRING("say "); break;
-        case QWC_SHE:   case GWC_SHE:   SEND_STRING("she "); break;
-        case QWC_ALL:   case GWC_ALL:   SEND_STRING("all "); break;
-        case QWC_WHICH: case GWC_WHICH: SEND_STRING("which "); break;
-        case QWC_WILL:  case GWC_WILL:  SEND_STRING("will "); break;
-        case QWC_WOULD: case GWC_WOULD: SEND_STRING("would "); break;
-        case QWC_THERE: case GWC_THERE: SEND_STRING("there "); break;
-        case QWC_THEIR: case GWC_THEIR: SEND_STRING("their "); break;
-        case QWC_MY:    case GWC_MY:    SEND_STRING("my "); break;
-        case QWC_OUT:   case GWC_OUT:   SEND_STRING("out "); break;
-        case QWC_UP:    case GWC_UP:    SEND_STRING("up "); break;
-        case QWC_ABOUT: case GWC_ABOUT: SEND_STRING("about "); break;
-        case QWC_WHO:   case GWC_WHO:   SEND_STRING("who "); break;
-        case QWC_GET:   case GWC_GET:   SEND_STRING("get "); break;
-        case QWC_MAKE:  case GWC_MAKE:  SEND_STRING("make "); break;
-        case QWC_GO:    case GWC_GO:    SEND_STRING("go "); break;
-        case QWC_LIKE:  case GWC_LIKE:  SEND_STRING("like "); break;
-        case QWC_JUST:  case GWC_JUST:  SEND_STRING("just "); break;
-        case QWC_KNOW:  case GWC_KNOW:  SEND_STRING("know "); break;
-        case QWC_TAKE:  case GWC_TAKE:  SEND_STRING("take "); break;
-        case QWC_COME:  case GWC_COME:  SEND_STRING("come "); break;
+        default:
+            // Gallium chords arrive through the combo window as QWC_* indices
+            if (combo_index >= QWC_THE && combo_index <= QWC_COME) {
+                wc_enqueue(combo_index - QWC_THE);
+            }
+            break;
     }
 }
 
@@ -346,6 +442,41 @@ const char chordal_hold_layout[MATRIX_ROWS][MATRIX_COLS] PROGMEM =
                        '*', '*', '*',  '*', '*', '*'
     );
 
+// ─── Flow Tap (typing-streak fast path) ─────────────────────────────────────
+// Mid-word, a home row mod or inner-column layer-tap (G, and H or P) pressed
+// within its window of the previous letter, with no modifier held, is a tap
+// at once: it skips the tapping term and the permissive/chordal hold checks.
+// The Shift pinkies get a shorter window so camelCase capitals can still
+// hold. 0 = always resolve.
+// Replay a latency trace through this table with lib/flow_tap_replay.py.
+
+#define FT_HOME FLOW_TAP_TERM
+#define FT_SHFT FLOW_TAP_TERM_SHIFT
+
+const uint16_t flow_tap_terms[MATRIX_ROWS][MATRIX_COLS] PROGMEM =
+    LAYOUT_split_3x6_3(
+        0, 0,       0,       0,       0,       0,          0,       0,       0,       0,       0,       0,
+        0, FT_SHFT, FT_HOME, FT_HOME, FT_HOME, FT_HOME,    FT_HOME, FT_HOME, FT_HOME, FT_HOME, FT_SHFT, 0,
+        0, 0,       0,       0,       0,       0,          0,       0,       0,       0,       0,       0,
+                                      0,       0,       0,          0,       0,       0
+    );
+
+uint16_t get_flow_tap_term(uint16_t keycode, keyrecord_t *record, uint16_t prev_keycode) {
+    // Combos have no matrix position; a held mod means a shortcut is coming
+    if (!IS_KEYEVENT(record->event) || get_mods()) {
+        return 0;
+    }
+    if (IS_QK_MOD_TAP(prev_keycode)) {
+        prev_keycode = QK_MOD_TAP_GET_TAP_KEYCODE(prev_keycode);
+    } else if (IS_QK_LAYER_TAP(prev_keycode)) {
+        prev_keycode = QK_LAYER_TAP_GET_TAP_KEYCODE(prev_keycode);
+    }
+    if (prev_keycode < KC_A || prev_keycode > KC_Z) {
+        return 0;
+    }
+    return pgm_read_word(&flow_tap_terms[record->event.key.row][record->event.key.col]);
+}
+
 // ─── Tap Dance Definitions ──────────────────────────────────────────────────
 
 void td_sym_finished(tap_dance_state_t *state, void *user_data) {
@@ -425,53 +556,53 @@ static char keycode_to_char(uint16_t keycode, uint8_t mods) {
 }
 
 // ─── Per-Key Tapping Term ──────────────────────────────────────────────────
-// Home row mod-taps get a longer tapping term (300ms) to avoid false holds.
-// Everything else uses the default (180ms).
+// Home row mod-taps get a longer tapping term (TAPPING_TERM_MOD_TAP, 300ms) to
+// avoid false holds. Everything else uses the default (180ms).
 
 uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record) {
     if (IS_QK_MOD_TAP(keycode)) {
-        return 300;
+        return TAPPING_TERM_MOD_TAP;
     }
     return TAPPING_TERM;
 }
 
 // ─── Mash Guard + Custom Keycodes ──────────────────────────────────────────
 
-static uint16_t mash_last_event_time = 0;
-static uint16_t mash_last_keycode    = KC_NO;
+#include "keyboards/crkbd/lib/mash_guard.h"
+
+// ─── Autocorrect (userspace trie walk) ──────────────────────────────────────
+
+#if defined(AUTOCORRECT_JUMP_TABLE) || defined(AUTOCORRECT_COMPACT_TRIE)
+#    define AUTOCORRECT_TRIE_WALK // the packed trie, not QMK's placeholder
+#    include "autocorrect_data.h"
+#    include "keyboards/crkbd/lib/autocorrect_process.h"
+#endif
 
 bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    latency_trace_hold(keycode, record);
+
     if (record->event.pressed) {
-        // Mash guard: suppress accidental simultaneous keypresses
-        bool prev_is_special = (mash_last_keycode >= QK_MOD_TAP   && mash_last_keycode <= QK_MOD_TAP_MAX) ||
-                               (mash_last_keycode >= QK_LAYER_TAP && mash_last_keycode <= QK_LAYER_TAP_MAX);
-        bool curr_is_special = (keycode >= QK_MOD_TAP   && keycode <= QK_MOD_TAP_MAX) ||
-                               (keycode >= QK_LAYER_TAP && keycode <= QK_LAYER_TAP_MAX);
-
-        if (!prev_is_special && !curr_is_special &&
-            TIMER_DIFF_16(record->event.time, mash_last_event_time) < MASH_GUARD_TERM) {
+        // Mash guard: drop presses that end a mash across neighbouring keys
+        if (mash_guard(keycode, record)) {
             return false;
         }
 
-        mash_last_event_time = record->event.time;
-        mash_last_keycode    = keycode;
-
         // Platform-aware clipboard keycodes
         uint8_t base = get_highest_layer(default_layer_state);
         bool win_mode = (base == _QWERTY_WIN || base == _GALLIUM_WIN);
 
         switch (keycode) {
             case CK_UNDO:
-                tap_code16(win_mode ? C(KC_Z) : G(KC_Z));
+                wc_tap(win_mode ? C(KC_Z) : G(KC_Z));
                 return false;
             case CK_CUT:
-                tap_code16(win_mode ? C(KC_X) : G(KC_X));
+                wc_tap(win_mode ? C(KC_X) : G(KC_X));
                 return false;
             case CK_COPY:
-                tap_code16(win_mode ? C(KC_C) : G(KC_C));
+                wc_tap(win_mode ? C(KC_C) : G(KC_C));
                 return false;
             case CK_PASTE:
-                tap_code16(win_mode ? C(KC_V) : G(KC_V));
+                wc_tap(win_mode ? C(KC_V) : G(KC_V));
                 return false;
         }
 
@@ -479,7 +610,16 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
         char c = keycode_to_char(keycode, get_mods());
         if (c) last_key_char = c;
     }
+
+    // Keys typed while word chord text is still going out wait behind it
+    if (wc_defer(wc_output_keycode(keycode, record), record->event.pressed)) {
+        return false;
+    }
+#if defined(AUTOCORRECT_JUMP_TABLE) || defined(AUTOCORRECT_COMPACT_TRIE)
+    return process_autocorrect_trie(keycode, record);
+#else
     return true;
+#endif
 }
 
 // ─── OLED Display (graphical vertical layout, 32x128) ────────────────────────
@@ -490,7 +630,7 @@ oled_rotation_t oled_init_user(oled_rotation_t rotation) {
     return OLED_ROTATION_270;
 }
 
-extern const unsigned char font[] PROGMEM;
+#include "keyboards/crkbd/lib/glcdfont_scaled.h"
 
 // ─── Modifier Icon Bitmaps (14x14, row-major, 2 bytes/row in PROGMEM) ───────
 
@@ -543,40 +683,96 @@ static const uint8_t PROGMEM icon_cmd_small[] = {
     0x00,0x00, 0x00,0x00,
 };
 
+// ─── Frame Buffer Access ─────────────────────────────────────────────────────
+// Every widget draws through these two. Single-core they go straight to the
+// OLED driver's buffer; with OLED_CORE1_ENABLE core1 draws into a frame of
+// its own, which core0 then copies into the driver's buffer (Core1 Offload).
+
+// Logical row stride of the OLED buffer under OLED_ROTATION_270 (32 px wide)
+#define OLED_ROW_BYTES   OLED_DISPLAY_HEIGHT
+#define OLED_FRAME_BYTES (OLED_DISPLAY_WIDTH * OLED_DISPLAY_HEIGHT / 8)
+
+#ifdef OLED_CORE1_ENABLE
+static uint8_t oled_frame[OLED_FRAME_BYTES];
+
+static inline uint8_t frame_read(uint16_t index) {
+    return oled_frame[index];
+}
+static inline void frame_write(uint8_t data, uint16_t index) {
+    oled_frame[index] = data;
+}
+#else
+static inline uint8_t frame_read(uint16_t index) {
+    return *oled_read_raw(index).current_element;
+}
+static inline void frame_write(uint8_t data, uint16_t index) {
+    oled_write_raw_byte(data, index);
+}
+#endif
+
 // ─── Rendering Helpers ───────────────────────────────────────────────────────
 
+static void render_pixel(uint8_t x, uint8_t y, bool on) {
+    uint16_t index = (y >> 3) * OLED_ROW_BYTES + x;
+    uint8_t  bit   = 1 << (y & 7);
+    uint8_t  old   = frame_read(index);
+    frame_write(on ? (old | bit) : (old & ~bit), index);
+}
+
 static void render_icon_14x14(uint8_t x, uint8_t y, const uint8_t *icon) {
     for (uint8_t row = 0; row < 14; row++) {
         uint8_t b0 = pgm_read_byte(&icon[row * 2]);
         uint8_t b1 = pgm_read_byte(&icon[row * 2 + 1]);
         for (uint8_t col = 0; col < 8; col++)
-            oled_write_pixel(x + col, y + row, (b0 >> (7 - col)) & 1);
+            render_pixel(x + col, y + row, (b0 >> (7 - col)) & 1);
         for (uint8_t col = 0; col < 6; col++)
-            oled_write_pixel(x + 8 + col, y + row, (b1 >> (7 - col)) & 1);
+            render_pixel(x + 8 + col, y + row, (b1 >> (7 - col)) & 1);
     }
 }
 
-static void render_scaled_char(uint8_t x, uint8_t y, char c, uint8_t scale) {
-    const uint8_t *glyph = &font[(uint8_t)c * OLED_FONT_WIDTH];
-    for (uint8_t col = 0; col < 5; col++) {
-        uint8_t col_data = pgm_read_byte(&glyph[col]);
-        for (uint8_t row = 0; row < 8; row++) {
-            bool on = (col_data >> row) & 1;
-            for (uint8_t dx = 0; dx < scale; dx++)
-                for (uint8_t dy = 0; dy < scale; dy++)
-                    oled_write_pixel(x + col * scale + dx, y + row * scale + dy, on);
-        }
+// The driver's 6x8 font (glcdfont_custom.c)
+extern const unsigned char font[];
+
+// One text row (8 px) in the driver's font, cleared past the text like
+// oled_write_ln(); at most 5 characters fit the 32 px width.
+static void render_text_row(uint8_t row, const char *text) {
+    uint16_t base = row * OLED_ROW_BYTES;
+    uint8_t  x    = 0;
+    for (; *text && x + OLED_FONT_WIDTH <= OLED_ROW_BYTES; text++) {
+        const unsigned char *glyph = &font[(uint8_t)(*text - OLED_FONT_START) * OLED_FONT_WIDTH];
+        for (uint8_t col = 0; col < OLED_FONT_WIDTH; col++, x++)
+            frame_write(pgm_read_byte(&glyph[col]), base + x);
     }
+    for (; x < OLED_ROW_BYTES; x++)
+        frame_write(0, base + x);
 }
 
-static void clear_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h) {
-    for (uint8_t py = y; py < y + h; py++)
-        for (uint8_t px = x; px < x + w; px++)
-            oled_write_pixel(px, py, false);
+// Blits a pre-scaled glyph (glcdfont_scaled.h) one buffer byte at a time.
+// y need not be page-aligned: each column is shifted into place and merged
+// with the neighbouring pixels above and below it.
+static void render_scaled_char(uint8_t x, uint8_t y, char c, uint8_t scale) {
+    const uint8_t *glyph = scale == 3 ? font_3x_glyph(c) : font_2x_glyph(c);
+    uint8_t  width = scale == 3 ? FONT_3X_WIDTH : FONT_2X_WIDTH;
+    uint8_t  shift = y & 7;
+    uint8_t  span  = scale + (shift ? 1 : 0);
+    uint16_t base  = (y >> 3) * OLED_ROW_BYTES + x;
+    uint32_t mask  = (((uint32_t)1 << (scale * 8)) - 1) << shift;
+    for (uint8_t col = 0; col < width; col++) {
+        uint32_t bits = 0;
+        for (uint8_t page = 0; page < scale; page++)
+            bits |= (uint32_t)pgm_read_byte(&glyph[page * width + col]) << (page * 8);
+        bits <<= shift;
+        for (uint8_t page = 0; page < span; page++) {
+            uint16_t index = base + page * OLED_ROW_BYTES + col;
+            uint8_t  m     = mask >> (page * 8);
+            uint8_t  old   = frame_read(index);
+            frame_write((old & ~m) | ((bits >> (page * 8)) & m), index);
+        }
+    }
 }
 
-static const char *get_layer_name(void) {
-    switch (get_highest_layer(layer_state)) {
+static const char *get_layer_name(uint8_t layer) {
+    switch (layer) {
         case _QWERTY:
         case _GALLIUM:
         case _QWERTY_WIN:
@@ -589,8 +785,8 @@ static const char *get_layer_name(void) {
     }
 }
 
-static const char *get_layout_name(void) {
-    switch (get_highest_layer(default_layer_state)) {
+static const char *get_layout_name(uint8_t layout) {
+    switch (layout) {
         case _QWERTY:      return "QWRTY";
         case _GALLIUM:     return "GALLM";
         case _QWERTY_WIN:  return "QWWIN";
@@ -599,46 +795,217 @@ static const char *get_layout_name(void) {
     }
 }
 
-bool oled_task_user(void) {
-    if (!is_keyboard_master()) return false;
+// ─── Widget Cache ────────────────────────────────────────────────────────────
+// The widgets' inputs are read into one snapshot, and each widget remembers
+// what it last drew and repaints only when its input changes. The driver
+// marks a block dirty only when a buffer byte changes, so an idle frame
+// touches no pixels and flushes nothing over I2C.
+
+typedef struct {
+    uint8_t layout;
+    uint8_t layer;
+    uint8_t mods;  // bit 0-3 = shift, ctrl, alt, gui active
+    char    key;
+    bool    caps;
+    uint8_t wpm;
+} oled_status_t;
+
+static bool          oled_primed = false;
+static oled_status_t drawn;
+static char          drawn_digits[3] = {0};
+
+#ifdef OLED_CORE1_ENABLE
+#    include "keyboards/crkbd/lib/core1_mailbox.h"
+
+static core1_park_t oled_park;  // holds core1 off flash while EEPROM is written
+
+// Between widgets on core1: drop the frame as soon as core0 asks for flash,
+// so core1_park() waits for one widget at most. A cut-short frame is drawn
+// again in full, as the widgets before the cut no longer match drawn.
+#    define OLED_RENDER_YIELD()                 \
+        do {                                    \
+            if (core1_park_held(&oled_park)) {  \
+                oled_primed = false;            \
+                return false;                   \
+            }                                   \
+        } while (0)
+#else
+#    define OLED_RENDER_YIELD()
+#endif
+
+static uint8_t mod_groups(uint8_t mods) {
+    return ((mods & MOD_MASK_SHIFT) ? 1 : 0) | ((mods & MOD_MASK_CTRL) ? 2 : 0) |
+           ((mods & MOD_MASK_ALT)   ? 4 : 0) | ((mods & MOD_MASK_GUI)  ? 8 : 0);
+}
+
+static void oled_read_status(oled_status_t *status) {
+    status->layout = get_highest_layer(default_layer_state);
+    status->layer  = get_highest_layer(layer_state);
+    status->mods   = mod_groups(get_mods() | get_oneshot_mods());
+    status->key    = last_key_char;
+    status->caps   = is_caps_word_on();
+    status->wpm    = get_current_wpm();
+}
+
+// False if core1 gave up the frame part way (OLED_RENDER_YIELD)
+static bool oled_render(const oled_status_t *status) {
+    // WPM label (Y=112-119, text row 14) never changes
+    if (!oled_primed) {
+        render_text_row(14, " WPM");
+    }
+    OLED_RENDER_YIELD();
 
     // Layout name (Y=0-7, text row 0)
-    oled_set_cursor(0, 0);
-    oled_write_ln(get_layout_name(), false);
+    if (!oled_primed || status->layout != drawn.layout) {
+        render_text_row(0, get_layout_name(status->layout));
+    }
+    OLED_RENDER_YIELD();
 
     // Layer name (Y=8-15, text row 1)
-    oled_set_cursor(0, 1);
-    oled_write_ln(get_layer_name(), false);
+    if (!oled_primed || status->layer != drawn.layer) {
+        render_text_row(1, get_layer_name(status->layer));
+    }
+    OLED_RENDER_YIELD();
+
+    // Modifier icons: 2x2 grid (Y=18-47), only the icons whose mod flipped
+    uint8_t mods    = status->mods;
+    uint8_t changed = oled_primed ? (mods ^ drawn.mods) : 0x0F;
+    if (changed & 1) render_icon_14x14(1, 18,  (mods & 1) ? icon_shift_filled : icon_shift_small);
+    if (changed & 2) render_icon_14x14(17, 18, (mods & 2) ? icon_ctrl_filled  : icon_ctrl_small);
+    if (changed & 4) render_icon_14x14(1, 34,  (mods & 4) ? icon_opt_filled   : icon_opt_small);
+    if (changed & 8) render_icon_14x14(17, 34, (mods & 8) ? icon_cmd_filled   : icon_cmd_small);
+    OLED_RENDER_YIELD();
+
+    // Large last key character (Y=52-75, 3x scaled = 15x24 at x=8).
+    // The glyph covers its whole cell, so it needs no clear.
+    if (!oled_primed || status->key != drawn.key) {
+        render_scaled_char(8, 52, status->key, 3);
+    }
+    OLED_RENDER_YIELD();
+
+    // Caps Word indicator (Y=80-87, text row 10)
+    if (!oled_primed || status->caps != drawn.caps) {
+        render_text_row(10, status->caps ? "  CW" : "");
+    }
+    OLED_RENDER_YIELD();
+
+    // WPM digits (Y=96-109, 2x scaled = 10x14 per digit), only changed digits
+    if (!oled_primed || status->wpm != drawn.wpm) {
+        char wpm_str[4];
+        snprintf(wpm_str, sizeof(wpm_str), "%3d", status->wpm);
+        for (uint8_t i = 0; i < 3; i++) {
+            if (wpm_str[i] != drawn_digits[i]) {
+                render_scaled_char(1 + i * 10, 96, wpm_str[i], 2);
+                drawn_digits[i] = wpm_str[i];
+                OLED_RENDER_YIELD();
+            }
+        }
+    }
+
+    drawn       = *status;
+    oled_primed = true;
+    return true;
+}
+
+#ifdef OLED_CORE1_ENABLE
 
-    // Modifier icons: 2x2 grid (Y=18-47)
-    uint8_t mods = get_mods() | get_oneshot_mods();
-    render_icon_14x14(1, 18,  (mods & MOD_MASK_SHIFT) ? icon_shift_filled : icon_shift_small);
-    render_icon_14x14(17, 18, (mods & MOD_MASK_CTRL)  ? icon_ctrl_filled  : icon_ctrl_small);
-    render_icon_14x14(1, 34,  (mods & MOD_MASK_ALT)   ? icon_opt_filled   : icon_opt_small);
-    render_icon_14x14(17, 34, (mods & MOD_MASK_GUI)   ? icon_cmd_filled   : icon_cmd_small);
+// ─── Core1 Offload (RP2040) ──────────────────────────────────────────────────
+// Core0 reads the widget inputs and posts them to core1 when they change;
+// core1 renders the frame into oled_frame and posts a copy back; core0 copies
+// the newest finished frame into the driver's buffer, which marks only the
+// changed blocks dirty, and the driver flushes those over I2C as before.
+// Both directions go through lib/core1_mailbox.h, so neither core ever
+// waits for the other and the matrix scan never waits for a render.
+//
+// Flash stalls while QMK's EEPROM emulation writes to it, and core1 renders
+// from flash. The emulation unlocks its flash backing store around every
+// erase and write, whoever asked for it (keycodes, eeconfig updates from
+// layer, RGB or VIA code, dynamic macros), and rules.mk wraps the unlock and
+// lock calls at link time, so core1 sits in its RAM-resident wait loop for
+// exactly as long as flash is open.
+
+static core1_mailbox_t status_box;
+static oled_status_t   status_slots[2];
+static core1_mailbox_t frame_box;
+static uint8_t         frame_slots[2][OLED_FRAME_BYTES];
+
+// Core1 entry point, started by ChibiOS (RP_CORE1_START in mcuconf.h).
+// Placed in RAM, so core1 can sit in the wait loop while flash is busy.
+__attribute__((noreturn, section(".time_critical.c1_main"))) void c1_main(void) {
+    oled_status_t status, next;
+    bool          unfinished = false;  // the last render was cut short by a hold
+    for (;;) {
+        core1_park_idle(&oled_park);
+        while (core1_park_held(&oled_park) || !(unfinished || core1_mailbox_fresh(&status_box))) {
+            __WFE();
+        }
+        if (!core1_park_leave(&oled_park)) continue;
 
-    // Large last key character (Y=52-75, 3x scaled = 15x24 at x=8)
-    clear_rect(8, 52, 15, 24);
-    if (last_key_char) {
-        render_scaled_char(8, 52, last_key_char, 3);
+        // A failed take can leave a torn copy, so take into a spare
+        if (core1_mailbox_take(&status_box, status_slots, sizeof(oled_status_t), &next)) {
+            status     = next;
+            unfinished = true;
+        }
+        if (unfinished && oled_render(&status)) {
+            unfinished = false;
+            core1_mailbox_post(&frame_box, frame_slots, OLED_FRAME_BYTES, oled_frame);
+        }
     }
+}
 
-    // Caps Word indicator (Y=80-87, text row 10)
-    oled_set_cursor(0, 10);
-    oled_write_ln_P(is_caps_word_on() ? PSTR("  CW") : PSTR(""), false);
+// Linked in place of the wear-leveling driver's own calls (-Wl,--wrap in
+// rules.mk). The park waits for core1 to finish the widget it is drawing, not
+// the whole frame.
+bool __real_backing_store_unlock(void);
+bool __real_backing_store_lock(void);
 
-    // WPM digits (Y=96-109, 2x scaled = 10x14 per digit)
-    char wpm_str[4];
-    snprintf(wpm_str, sizeof(wpm_str), "%3d", get_current_wpm());
-    render_scaled_char(1, 96, wpm_str[0], 2);
-    render_scaled_char(11, 96, wpm_str[1], 2);
-    render_scaled_char(21, 96, wpm_str[2], 2);
+bool __wrap_backing_store_unlock(void) {
+    core1_park(&oled_park);
+    return __real_backing_store_unlock();
+}
 
-    // WPM label (Y=112-119, text row 14)
-    oled_set_cursor(0, 14);
-    oled_write_ln_P(PSTR(" WPM"), false);
+bool __wrap_backing_store_lock(void) {
+    bool const locked = __real_backing_store_lock();
+    core1_unpark(&oled_park);
+    __SEV();
+    return locked;
+}
 
+bool oled_task_user(void) {
+    if (!is_keyboard_master()) return false;
+
+    static oled_status_t posted;
+    static bool          posted_once = false;
+    static uint8_t       shown[OLED_FRAME_BYTES];
+
+    oled_status_t status;
+    oled_read_status(&status);
+    if (!posted_once || memcmp(&status, &posted, sizeof(oled_status_t)) != 0) {
+        core1_mailbox_post(&status_box, status_slots, sizeof(oled_status_t), &status);
+        posted      = status;
+        posted_once = true;
+    }
+    core1_unpark(&oled_park);  // in case a failed flash write never locked
+    __SEV();
+
+    if (core1_mailbox_take(&frame_box, frame_slots, OLED_FRAME_BYTES, shown)) {
+        oled_set_cursor(0, 0);  // oled_write_raw() copies from the cursor
+        oled_write_raw((const char *)shown, OLED_FRAME_BYTES);
+    }
+    return false;
+}
+
+#else
+
+bool oled_task_user(void) {
+    if (!is_keyboard_master()) return false;
+
+    oled_status_t status;
+    oled_read_status(&status);
+    oled_render(&status);
     return false;
 }
 
+#endif // OLED_CORE1_ENABLE
+
 #endif // OLED_ENABLE
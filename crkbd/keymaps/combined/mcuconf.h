@@ -0,0 +1,11 @@
+// Corne Choc 42-Key — Combined Profile: RP2040 overrides
+
+#pragma once
+
+#include_next <mcuconf.h>
+
+// OLED_CORE1_ENABLE: start core1 at c1_main() (keymap.c) to render the OLED
+#ifdef OLED_CORE1_ENABLE
+#    undef RP_CORE1_START
+#    define RP_CORE1_START TRUE
+#endif
@@ -22,3 +22,44 @@ REPEAT_KEY_ENABLE   = no
 TAP_DANCE_ENABLE    = yes
 POINTING_DEVICE_ENABLE = yes
 POINTING_DEVICE_DRIVER = azoteq_iqs5xx
+
+# Batch the trackpad's samples on the right half and send them to the master
+# in one transaction per SPLIT_POINTING_BATCH_INTERVAL, instead of QMK's split
+# pointing sync (lib/pointing_batch.h). Also turns on the adaptive and RDY-pin
+# trackpad polling (lib/pointing_poll.h), which needs this custom driver path.
+# Opt-in experiment, off by default: with it off, and in the other keymaps,
+# the pad is read by QMK's stock azoteq_iqs5xx polling.
+SPLIT_POINTING_BATCH_ENABLE = no
+# Trackpad acceleration curve and jitter smoothing (lib/pointing_accel.h)
+POINTING_ACCEL_ENABLE = no
+
+ifeq ($(strip $(SPLIT_POINTING_BATCH_ENABLE)), yes)
+    OPT_DEFS += -DSPLIT_POINTING_BATCH_ENABLE
+    POINTING_DEVICE_DRIVER = custom
+    SRC += drivers/sensors/azoteq_iqs5xx.c
+    I2C_DRIVER_REQUIRED = yes
+endif
+
+ifeq ($(strip $(POINTING_ACCEL_ENABLE)), yes)
+    OPT_DEFS += -DPOINTING_ACCEL_ENABLE
+endif
+
+# Keystroke latency tracer (lib/latency_trace.h): dumps per-stage key event
+# timestamps over the console for lib/latency_trace.py
+LATENCY_TRACE_ENABLE = no
+
+ifeq ($(strip $(LATENCY_TRACE_ENABLE)), yes)
+    OPT_DEFS += -DLATENCY_TRACE_ENABLE
+    CONSOLE_ENABLE = yes
+endif
+
+# Render the OLED on the RP2040's second core (rev4_x or CONVERT_TO=rp2040_ce
+# only): core0 posts the status, core1 draws the frame (lib/core1_mailbox.h).
+# The EEPROM backing store's unlock/lock are wrapped to park core1 while its
+# flash is written, whichever code writes it.
+OLED_CORE1_ENABLE = no
+
+ifeq ($(strip $(OLED_CORE1_ENABLE)), yes)
+    OPT_DEFS += -DOLED_CORE1_ENABLE
+    EXTRALDFLAGS += -Wl,--wrap=backing_store_unlock,--wrap=backing_store_lock
+endif
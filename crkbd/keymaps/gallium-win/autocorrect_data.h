@@ -5058,3795 +5058,3311 @@
 
 #define AUTOCORRECT_MIN_LENGTH 5 // "abiut"
 #define AUTOCORRECT_MAX_LENGTH 11 // "caklifornia"
-#define DICTIONARY_SIZE 60594
+
+#if defined(AUTOCORRECT_COMPACT_TRIE) || (defined(AUTOCORRECT_JUMP_TABLE) && !defined(AUTOCORRECT_TRIE_WALK))
+// QMK's own walk is switched off in these builds and only needs a symbol to link
+#define DICTIONARY_SIZE 1
+static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM __attribute__((unused)) = {0};
+#else
+#define DICTIONARY_SIZE 31974
 
 static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {
-    0x74, 0x52, 0x00, 0x2C, 0x77, 0x00, 0x04, 0x3D, 0x15, 0x05, 0x53, 0x1B, 0x06, 0xFD, 0x1B, 0x07,
-    0x8E, 0x1E, 0x08, 0xD5, 0x31, 0x09, 0x69, 0x5E, 0x0A, 0x18, 0x5F, 0x0B, 0xB7, 0x6A, 0x0C, 0x6F,
-    0x76, 0x0D, 0x78, 0x76, 0x0E, 0x4E, 0x77, 0x0F, 0xE0, 0x7E, 0x10, 0xD9, 0x91, 0x11, 0xAF, 0x93,
-    0x12, 0xB7, 0x9D, 0x13, 0x90, 0xA5, 0x14, 0x66, 0xA6, 0x15, 0x6D, 0xA6, 0x16, 0x9C, 0xB7, 0x17,
-    0x4D, 0xCA, 0x18, 0x5E, 0xE0, 0x19, 0x8D, 0xE0, 0x1A, 0xCD, 0xE0, 0x1B, 0x89, 0xE2, 0x1C, 0x70,
-    0xE3, 0x00, 0x56, 0x59, 0x00, 0x17, 0x62, 0x00, 0x00, 0x17, 0x04, 0x0B, 0x17, 0x00, 0x81, 0x27,
+    0x74, 0x52, 0x00, 0x2C, 0x75, 0x00, 0x04, 0xA7, 0x12, 0x05, 0xA4, 0x15, 0x06, 0x37, 0x16, 0x07,
+    0xA5, 0x17, 0x08, 0xD6, 0x20, 0x09, 0x4D, 0x37, 0x0A, 0xC0, 0x37, 0x0B, 0xBC, 0x3D, 0x0C, 0x4C,
+    0x43, 0x0D, 0x55, 0x43, 0x0E, 0xB4, 0x43, 0x0F, 0x39, 0x47, 0x10, 0xD3, 0x4F, 0x11, 0xBF, 0x50,
+    0x12, 0xB3, 0x55, 0x13, 0x61, 0x59, 0x14, 0xD8, 0x59, 0x15, 0xDF, 0x59, 0x16, 0x79, 0x62, 0x17,
+    0xE6, 0x6B, 0x18, 0x46, 0x76, 0x19, 0x66, 0x76, 0x1A, 0x84, 0x76, 0x1B, 0x7B, 0x77, 0x1C, 0xA8,
+    0x77, 0x00, 0x56, 0x59, 0x00, 0x17, 0x62, 0x00, 0x00, 0x17, 0x04, 0x0B, 0x17, 0x00, 0x81, 0x27,
     0x73, 0x00, 0x11, 0x00, 0x44, 0x6B, 0x00, 0x12, 0x71, 0x00, 0x00, 0x06, 0x00, 0x81, 0x27, 0x74,
-    0x00, 0x07, 0x00, 0x81, 0x27, 0x74, 0x00, 0x74, 0xC0, 0x00, 0x04, 0xC9, 0x00, 0x05, 0xF6, 0x00,
-    0x06, 0x33, 0x01, 0x07, 0x7F, 0x01, 0x08, 0x90, 0x02, 0x09, 0x12, 0x08, 0x0A, 0x9A, 0x08, 0x0B,
-    0x2F, 0x09, 0x0C, 0xD6, 0x09, 0x0D, 0x74, 0x0A, 0x0E, 0x87, 0x0A, 0x0F, 0xCB, 0x0A, 0x10, 0xE0,
-    0x0B, 0x11, 0x28, 0x0C, 0x12, 0x4F, 0x0D, 0x13, 0xFA, 0x0D, 0x15, 0x1F, 0x0E, 0x16, 0xDE, 0x10,
-    0x17, 0xC2, 0x11, 0x18, 0x29, 0x14, 0x19, 0x33, 0x14, 0x1A, 0x3B, 0x14, 0x1C, 0xDB, 0x14, 0x00,
-    0x17, 0x04, 0x0B, 0x17, 0x2C, 0x00, 0x80, 0x73, 0x00, 0x46, 0xD6, 0x00, 0x0A, 0xE1, 0x00, 0x18,
-    0xE9, 0x00, 0x1A, 0xF0, 0x00, 0x00, 0x0C, 0x11, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x80, 0x6C,
-    0x00, 0x11, 0x0C, 0x0B, 0x17, 0x00, 0x81, 0x73, 0x00, 0x17, 0x06, 0x04, 0x00, 0x80, 0x6C, 0x00,
-    0x12, 0x11, 0x0E, 0x00, 0x81, 0x00, 0x44, 0x06, 0x01, 0x0A, 0x0E, 0x01, 0x0B, 0x14, 0x01, 0x0C,
-    0x1A, 0x01, 0x11, 0x22, 0x01, 0x00, 0x05, 0x12, 0x15, 0x13, 0x00, 0x80, 0x6C, 0x00, 0x11, 0x12,
-    0x0F, 0x00, 0x81, 0x00, 0x0A, 0x0C, 0x0B, 0x00, 0x81, 0x00, 0x16, 0x16, 0x12, 0x13, 0x00, 0x80,
-    0x6C, 0x00, 0x48, 0x29, 0x01, 0x1A, 0x2E, 0x01, 0x00, 0x19, 0x08, 0x00, 0x81, 0x00, 0x12, 0x07,
-    0x00, 0x81, 0x00, 0x48, 0x40, 0x01, 0x0C, 0x48, 0x01, 0x12, 0x62, 0x01, 0x16, 0x77, 0x01, 0x00,
-    0x11, 0x0C, 0x16, 0x00, 0x82, 0x63, 0x65, 0x00, 0x16, 0x04, 0x00, 0x51, 0x52, 0x01, 0x19, 0x5B,
-    0x01, 0x00, 0x2C, 0x00, 0x85, 0x62, 0x61, 0x73, 0x69, 0x63, 0x00, 0x85, 0x62, 0x61, 0x73, 0x69,
-    0x63, 0x00, 0x4C, 0x69, 0x01, 0x16, 0x70, 0x01, 0x00, 0x16, 0x04, 0x05, 0x00, 0x82, 0x63, 0x00,
-    0x04, 0x05, 0x00, 0x82, 0x69, 0x63, 0x00, 0x0C, 0x16, 0x04, 0x05, 0x00, 0x82, 0x63, 0x00, 0x48,
-    0x95, 0x01, 0x0C, 0xE2, 0x01, 0x0E, 0xF8, 0x01, 0x0F, 0x00, 0x02, 0x11, 0x07, 0x02, 0x15, 0x67,
-    0x02, 0x16, 0x7B, 0x02, 0x00, 0x48, 0xA5, 0x01, 0x09, 0xBA, 0x01, 0x0E, 0xBF, 0x01, 0x10, 0xC4,
-    0x01, 0x15, 0xDC, 0x01, 0x00, 0x51, 0xAC, 0x01, 0x15, 0xB5, 0x01, 0x00, 0x0B, 0x2C, 0x00, 0x85,
-    0x6E, 0x65, 0x65, 0x64, 0x00, 0x0B, 0x17, 0x00, 0x81, 0x00, 0x0C, 0x0F, 0x00, 0x81, 0x00, 0x04,
-    0x17, 0x00, 0x81, 0x00, 0x12, 0x00, 0x46, 0xD0, 0x01, 0x0B, 0xD4, 0x01, 0x16, 0xD8, 0x01, 0x00,
-    0x2C, 0x00, 0x81, 0x00, 0x2C, 0x00, 0x81, 0x00, 0x2C, 0x00, 0x81, 0x00, 0x08, 0x0B, 0x2C, 0x00,
-    0x81, 0x00, 0x44, 0xE9, 0x01, 0x16, 0xF2, 0x01, 0x00, 0x16, 0x16, 0x2C, 0x00, 0x84, 0x61, 0x69,
-    0x64, 0x00, 0x04, 0x05, 0x00, 0x81, 0x63, 0x00, 0x15, 0x12, 0x1A, 0x00, 0x82, 0x6C, 0x64, 0x00,
-    0x12, 0x12, 0x0A, 0x00, 0x82, 0x64, 0x00, 0x4C, 0x11, 0x02, 0x12, 0x35, 0x02, 0x18, 0x3E, 0x02,
-    0x00, 0x4E, 0x18, 0x02, 0x12, 0x20, 0x02, 0x00, 0x09, 0x2C, 0x00, 0x84, 0x69, 0x6E, 0x64, 0x00,
-    0x49, 0x27, 0x02, 0x16, 0x2E, 0x02, 0x00, 0x2C, 0x00, 0x84, 0x69, 0x6E, 0x64, 0x00, 0x2C, 0x00,
-    0x83, 0x75, 0x6E, 0x64, 0x00, 0x15, 0x04, 0x2C, 0x00, 0x82, 0x75, 0x6E, 0x64, 0x00, 0x52, 0x45,
-    0x02, 0x15, 0x5F, 0x02, 0x00, 0x47, 0x4C, 0x02, 0x17, 0x55, 0x02, 0x00, 0x2C, 0x00, 0x85, 0x73,
-    0x6F, 0x75, 0x6E, 0x64, 0x00, 0x04, 0x2C, 0x00, 0x85, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x04,
-    0x00, 0x83, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x08, 0x00, 0x48, 0x70, 0x02, 0x16, 0x75, 0x02, 0x00,
-    0x11, 0x00, 0x82, 0x64, 0x00, 0x18, 0x2C, 0x00, 0x82, 0x64, 0x00, 0x48, 0x82, 0x02, 0x15, 0x89,
-    0x02, 0x00, 0x0B, 0x17, 0x2C, 0x00, 0x81, 0x65, 0x00, 0x04, 0x08, 0x1C, 0x2C, 0x00, 0x81, 0x00,
-    0x46, 0xC1, 0x02, 0x07, 0xCD, 0x02, 0x08, 0x69, 0x03, 0x09, 0xC0, 0x03, 0x0B, 0xEE, 0x03, 0x0E,
-    0xF6, 0x03, 0x0F, 0x42, 0x04, 0x10, 0xB0, 0x04, 0x11, 0x8C, 0x05, 0x15, 0x93, 0x05, 0x16, 0x0A,
-    0x07, 0x17, 0x25, 0x07, 0x19, 0x92, 0x07, 0x1A, 0xCF, 0x07, 0x1B, 0x01, 0x08, 0x1C, 0x0A, 0x08,
-    0x00, 0x11, 0x0C, 0x08, 0x2C, 0x00, 0x85, 0x73, 0x69, 0x6E, 0x63, 0x65, 0x00, 0x44, 0xEF, 0x02,
-    0x07, 0xF8, 0x02, 0x08, 0xFE, 0x02, 0x0C, 0x03, 0x03, 0x0F, 0x0B, 0x03, 0x10, 0x1C, 0x03, 0x11,
-    0x22, 0x03, 0x12, 0x3B, 0x03, 0x15, 0x40, 0x03, 0x16, 0x5B, 0x03, 0x1D, 0x62, 0x03, 0x00, 0x11,
-    0x10, 0x2C, 0x00, 0x84, 0x61, 0x64, 0x65, 0x00, 0x04, 0x10, 0x00, 0x82, 0x65, 0x00, 0x08, 0x11,
-    0x00, 0x81, 0x00, 0x16, 0x11, 0x12, 0x06, 0x00, 0x80, 0x72, 0x00, 0x55, 0x12, 0x03, 0x18, 0x17,
-    0x03, 0x00, 0x12, 0x1A, 0x00, 0x81, 0x00, 0x12, 0x1A, 0x00, 0x81, 0x00, 0x04, 0x0A, 0x00, 0x82,
-    0x65, 0x00, 0x4C, 0x29, 0x03, 0x18, 0x36, 0x03, 0x00, 0x49, 0x30, 0x03, 0x16, 0x32, 0x03, 0x00,
-    0x81, 0x00, 0x82, 0x63, 0x65, 0x00, 0x12, 0x16, 0x00, 0x81, 0x00, 0x12, 0x0A, 0x00, 0x81, 0x00,
-    0x48, 0x47, 0x03, 0x12, 0x56, 0x03, 0x00, 0x4B, 0x4E, 0x03, 0x1A, 0x51, 0x03, 0x00, 0x82, 0x65,
-    0x00, 0x2C, 0x00, 0x82, 0x65, 0x00, 0x10, 0x00, 0x82, 0x65, 0x00, 0x04, 0x10, 0x00, 0x83, 0x64,
-    0x65, 0x00, 0x04, 0x10, 0x00, 0x83, 0x64, 0x65, 0x00, 0x47, 0x76, 0x03, 0x0B, 0x7C, 0x03, 0x15,
-    0x83, 0x03, 0x1A, 0xB9, 0x03, 0x00, 0x11, 0x18, 0x00, 0x81, 0x72, 0x00, 0x17, 0x12, 0x2C, 0x00,
-    0x81, 0x72, 0x00, 0x45, 0x90, 0x03, 0x08, 0xA7, 0x03, 0x0A, 0xAC, 0x03, 0x12, 0xB5, 0x03, 0x00,
-    0x4B, 0x97, 0x03, 0x17, 0x9F, 0x03, 0x00, 0x17, 0x2C, 0x00, 0x84, 0x72, 0x65, 0x65, 0x00, 0x2C,
-    0x00, 0x84, 0x68, 0x72, 0x65, 0x65, 0x00, 0x0B, 0x2C, 0x00, 0x81, 0x00, 0x17, 0x2C, 0x00, 0x84,
-    0x68, 0x72, 0x65, 0x65, 0x00, 0x10, 0x00, 0x81, 0x00, 0x17, 0x08, 0x05, 0x00, 0x80, 0x6E, 0x00,
-    0x4C, 0xCA, 0x03, 0x12, 0xD3, 0x03, 0x15, 0xDB, 0x03, 0x00, 0x18, 0x0F, 0x2C, 0x00, 0x84, 0x69,
-    0x66, 0x65, 0x00, 0x0C, 0x0F, 0x2C, 0x00, 0x83, 0x66, 0x65, 0x00, 0x08, 0x00, 0x4B, 0xE4, 0x03,
-    0x1A, 0xE9, 0x03, 0x00, 0x2C, 0x00, 0x82, 0x65, 0x00, 0x2C, 0x00, 0x82, 0x65, 0x00, 0x17, 0x12,
-    0x11, 0x04, 0x00, 0x80, 0x72, 0x00, 0x44, 0x06, 0x04, 0x0C, 0x10, 0x04, 0x0F, 0x23, 0x04, 0x16,
-    0x2A, 0x04, 0x1A, 0x3B, 0x04, 0x00, 0x10, 0x0E, 0x2C, 0x00, 0x85, 0x6D, 0x61, 0x6B, 0x65, 0x00,
-    0x44, 0x17, 0x04, 0x0B, 0x1D, 0x04, 0x00, 0x10, 0x00, 0x83, 0x6B, 0x65, 0x00, 0x1A, 0x00, 0x82,
-    0x6C, 0x65, 0x00, 0x04, 0x17, 0x00, 0x83, 0x6B, 0x65, 0x00, 0x04, 0x00, 0x50, 0x33, 0x04, 0x17,
-    0x37, 0x04, 0x00, 0x83, 0x6B, 0x65, 0x00, 0x83, 0x6B, 0x65, 0x00, 0x04, 0x17, 0x00, 0x83, 0x6B,
-    0x65, 0x00, 0x4C, 0x55, 0x04, 0x12, 0x60, 0x04, 0x13, 0x7E, 0x04, 0x17, 0x97, 0x04, 0x18, 0xA0,
-    0x04, 0x1C, 0xA6, 0x04, 0x00, 0x0B, 0x04, 0x2C, 0x00, 0x85, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x00,
-    0x4B, 0x67, 0x04, 0x16, 0x74, 0x04, 0x00, 0x16, 0x16, 0x2C, 0x00, 0x86, 0x61, 0x73, 0x73, 0x68,
-    0x6F, 0x6C, 0x65, 0x00, 0x16, 0x04, 0x2C, 0x00, 0x83, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x12, 0x00,
-    0x53, 0x87, 0x04, 0x15, 0x8E, 0x04, 0x00, 0x84, 0x65, 0x6F, 0x70, 0x6C, 0x65, 0x00, 0x13, 0x00,
-    0x85, 0x65, 0x6F, 0x70, 0x6C, 0x65, 0x00, 0x0C, 0x0F, 0x2C, 0x00, 0x82, 0x74, 0x6C, 0x65, 0x00,
-    0x12, 0x06, 0x00, 0x81, 0x64, 0x00, 0x17, 0x0C, 0x0F, 0x2C, 0x00, 0x83, 0x74, 0x6C, 0x65, 0x00,
-    0x44, 0xC0, 0x04, 0x0C, 0xE1, 0x04, 0x0F, 0xE9, 0x04, 0x11, 0xF0, 0x04, 0x12, 0x05, 0x05, 0x00,
-    0x48, 0xCA, 0x04, 0x0B, 0xD1, 0x04, 0x16, 0xD9, 0x04, 0x00, 0x16, 0x00, 0x84, 0x61, 0x6D, 0x65,
-    0x00, 0x0A, 0x2C, 0x00, 0x84, 0x61, 0x6D, 0x65, 0x00, 0x16, 0x2C, 0x00, 0x84, 0x61, 0x6D, 0x65,
-    0x00, 0x15, 0x17, 0x00, 0x84, 0x69, 0x6D, 0x65, 0x00, 0x12, 0x0B, 0x00, 0x83, 0x6D, 0x65, 0x00,
-    0x12, 0x00, 0x4B, 0xF9, 0x04, 0x16, 0xFF, 0x04, 0x00, 0x2C, 0x00, 0x83, 0x6D, 0x65, 0x00, 0x2C,
-    0x00, 0x83, 0x6D, 0x65, 0x00, 0x46, 0x1E, 0x05, 0x08, 0x27, 0x05, 0x0A, 0x2F, 0x05, 0x0B, 0x37,
-    0x05, 0x0C, 0x40, 0x05, 0x0F, 0x68, 0x05, 0x11, 0x7D, 0x05, 0x1C, 0x85, 0x05, 0x00, 0x16, 0x2C,
-    0x00, 0x85, 0x63, 0x6F, 0x6D, 0x65, 0x00, 0x16, 0x2C, 0x00, 0x84, 0x6F, 0x6D, 0x65, 0x00, 0x0B,
-    0x2C, 0x00, 0x84, 0x6F, 0x6D, 0x65, 0x00, 0x0A, 0x2C, 0x00, 0x85, 0x68, 0x6F, 0x6D, 0x65, 0x00,
-    0x46, 0x4D, 0x05, 0x0B, 0x54, 0x05, 0x16, 0x5B, 0x05, 0x17, 0x62, 0x05, 0x00, 0x2C, 0x00, 0x84,
-    0x6F, 0x6D, 0x65, 0x00, 0x2C, 0x00, 0x84, 0x6F, 0x6D, 0x65, 0x00, 0x2C, 0x00, 0x84, 0x6F, 0x6D,
-    0x65, 0x00, 0x2C, 0x00, 0x83, 0x6D, 0x65, 0x00, 0x46, 0x6F, 0x05, 0x0B, 0x76, 0x05, 0x00, 0x2C,
-    0x00, 0x84, 0x6F, 0x6D, 0x65, 0x00, 0x2C, 0x00, 0x84, 0x6F, 0x6D, 0x65, 0x00, 0x0B, 0x2C, 0x00,
-    0x84, 0x6F, 0x6D, 0x65, 0x00, 0x0B, 0x00, 0x84, 0x6F, 0x6D, 0x65, 0x00, 0x10, 0x12, 0x06, 0x00,
-    0x82, 0x65, 0x00, 0x74, 0xB2, 0x05, 0x04, 0xBE, 0x05, 0x07, 0xDF, 0x05, 0x08, 0xF2, 0x05, 0x09,
-    0xBF, 0x06, 0x0B, 0xC7, 0x06, 0x12, 0xCF, 0x06, 0x13, 0xE9, 0x06, 0x15, 0xF1, 0x06, 0x17, 0x02,
-    0x07, 0x00, 0x18, 0x12, 0x2C, 0x00, 0x85, 0x79, 0x6F, 0x75, 0x27, 0x72, 0x65, 0x00, 0x50, 0xC5,
-    0x05, 0x1A, 0xD0, 0x05, 0x00, 0x15, 0x0C, 0x09, 0x2C, 0x00, 0x83, 0x77, 0x61, 0x72, 0x65, 0x00,
-    0x10, 0x15, 0x0C, 0x2C, 0x00, 0x87, 0x66, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x44,
-    0xE6, 0x05, 0x11, 0xEB, 0x05, 0x00, 0x10, 0x00, 0x82, 0x65, 0x00, 0x18, 0x2C, 0x00, 0x82, 0x65,
-    0x72, 0x00, 0x47, 0x0B, 0x06, 0x08, 0x1D, 0x06, 0x0B, 0x30, 0x06, 0x11, 0x76, 0x06, 0x17, 0x7F,
-    0x06, 0x19, 0x93, 0x06, 0x1A, 0xA1, 0x06, 0x1C, 0xB6, 0x06, 0x00, 0x51, 0x12, 0x06, 0x1A, 0x16,
-    0x06, 0x00, 0x18, 0x00, 0x81, 0x00, 0x2C, 0x00, 0x84, 0x65, 0x72, 0x65, 0x00, 0x4B, 0x24, 0x06,
-    0x1A, 0x2A, 0x06, 0x00, 0x2C, 0x00, 0x83, 0x72, 0x65, 0x00, 0x2C, 0x00, 0x83, 0x72, 0x65, 0x00,
-    0x44, 0x3D, 0x06, 0x15, 0x46, 0x06, 0x16, 0x4F, 0x06, 0x17, 0x56, 0x06, 0x00, 0x2C, 0x00, 0x85,
-    0x77, 0x68, 0x65, 0x72, 0x65, 0x00, 0x2C, 0x00, 0x85, 0x74, 0x68, 0x65, 0x72, 0x65, 0x00, 0x85,
-    0x77, 0x68, 0x65, 0x72, 0x65, 0x00, 0x52, 0x60, 0x06, 0x15, 0x64, 0x06, 0x1C, 0x6D, 0x06, 0x00,
-    0x2C, 0x00, 0x81, 0x00, 0x2C, 0x00, 0x86, 0x74, 0x68, 0x65, 0x72, 0x65, 0x00, 0x2C, 0x00, 0x86,
-    0x74, 0x68, 0x65, 0x72, 0x65, 0x00, 0x17, 0x2C, 0x00, 0x84, 0x68, 0x65, 0x72, 0x65, 0x00, 0x49,
-    0x86, 0x06, 0x0B, 0x8A, 0x06, 0x00, 0x04, 0x00, 0x81, 0x00, 0x2C, 0x00, 0x85, 0x74, 0x68, 0x65,
-    0x72, 0x65, 0x00, 0x48, 0x9A, 0x06, 0x12, 0x9F, 0x06, 0x00, 0x11, 0x2C, 0x00, 0x81, 0x00, 0x81,
-    0x00, 0x48, 0xA8, 0x06, 0x16, 0xAE, 0x06, 0x00, 0x85, 0x77, 0x65, 0x72, 0x65, 0x00, 0x2C, 0x00,
-    0x85, 0x77, 0x65, 0x72, 0x65, 0x00, 0x1A, 0x2C, 0x00, 0x84, 0x68, 0x65, 0x72, 0x65, 0x00, 0x08,
-    0x05, 0x00, 0x82, 0x6F, 0x72, 0x65, 0x00, 0x17, 0x12, 0x2C, 0x00, 0x82, 0x65, 0x72, 0x00, 0x46,
-    0xD6, 0x06, 0x09, 0xDF, 0x06, 0x00, 0x08, 0x05, 0x00, 0x84, 0x66, 0x6F, 0x72, 0x65, 0x00, 0x05,
-    0x2C, 0x00, 0x84, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x00, 0x12, 0x10, 0x2C, 0x00, 0x83, 0x72, 0x65,
-    0x00, 0x48, 0xF8, 0x06, 0x12, 0xFD, 0x06, 0x00, 0x0B, 0x00, 0x82, 0x65, 0x00, 0x10, 0x00, 0x82,
-    0x65, 0x00, 0x12, 0x10, 0x2C, 0x00, 0x83, 0x72, 0x65, 0x00, 0x4B, 0x11, 0x07, 0x18, 0x1A, 0x07,
-    0x00, 0x08, 0x17, 0x00, 0x84, 0x68, 0x65, 0x73, 0x65, 0x00, 0x04, 0x08, 0x05, 0x00, 0x84, 0x63,
-    0x61, 0x75, 0x73, 0x65, 0x00, 0x44, 0x32, 0x07, 0x15, 0x4C, 0x07, 0x16, 0x6A, 0x07, 0x17, 0x73,
-    0x07, 0x00, 0x55, 0x39, 0x07, 0x17, 0x42, 0x07, 0x00, 0x17, 0x16, 0x2C, 0x00, 0x84, 0x61, 0x74,
-    0x65, 0x00, 0x1B, 0x2C, 0x00, 0x85, 0x73, 0x74, 0x61, 0x74, 0x65, 0x00, 0x44, 0x56, 0x07, 0x08,
-    0x5E, 0x07, 0x12, 0x65, 0x07, 0x00, 0x17, 0x16, 0x2C, 0x00, 0x83, 0x74, 0x65, 0x00, 0x0B, 0x17,
-    0x2C, 0x00, 0x82, 0x65, 0x00, 0x10, 0x00, 0x82, 0x65, 0x00, 0x17, 0x16, 0x2C, 0x00, 0x83, 0x61,
-    0x74, 0x65, 0x00, 0x44, 0x7D, 0x07, 0x08, 0x86, 0x07, 0x0C, 0x8C, 0x07, 0x00, 0x16, 0x2C, 0x00,
-    0x84, 0x74, 0x61, 0x74, 0x65, 0x00, 0x05, 0x2C, 0x00, 0x80, 0x72, 0x00, 0x0F, 0x00, 0x81, 0x6C,
-    0x65, 0x00, 0x51, 0x99, 0x07, 0x12, 0xA1, 0x07, 0x00, 0x0C, 0x16, 0x2C, 0x00, 0x82, 0x63, 0x65,
-    0x00, 0x4E, 0xAB, 0x07, 0x0F, 0xB3, 0x07, 0x12, 0xC9, 0x07, 0x00, 0x0F, 0x2C, 0x00, 0x84, 0x6F,
-    0x76, 0x65, 0x00, 0x4E, 0xBA, 0x07, 0x0F, 0xC2, 0x07, 0x00, 0x2C, 0x00, 0x85, 0x6C, 0x6F, 0x76,
-    0x65, 0x00, 0x2C, 0x00, 0x84, 0x6F, 0x76, 0x65, 0x00, 0x0F, 0x00, 0x83, 0x76, 0x65, 0x00, 0x47,
-    0xDF, 0x07, 0x08, 0xE5, 0x07, 0x10, 0xEC, 0x07, 0x12, 0xF3, 0x07, 0x15, 0xFA, 0x07, 0x00, 0x04,
-    0x10, 0x00, 0x82, 0x65, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x73, 0x65, 0x00, 0x04, 0x16, 0x2C, 0x00,
-    0x82, 0x65, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x73, 0x65, 0x00, 0x08, 0x0B, 0x2C, 0x00, 0x82, 0x65,
-    0x00, 0x12, 0x0B, 0x17, 0x2C, 0x00, 0x82, 0x73, 0x65, 0x00, 0x04, 0x17, 0x16, 0x00, 0x82, 0x74,
-    0x65, 0x00, 0x47, 0x25, 0x08, 0x08, 0x52, 0x08, 0x0A, 0x59, 0x08, 0x0C, 0x5F, 0x08, 0x0F, 0x66,
-    0x08, 0x15, 0x6D, 0x08, 0x00, 0x48, 0x32, 0x08, 0x0F, 0x37, 0x08, 0x11, 0x3D, 0x08, 0x12, 0x4D,
-    0x08, 0x00, 0x08, 0x11, 0x00, 0x81, 0x00, 0x15, 0x12, 0x1A, 0x00, 0x81, 0x00, 0x4C, 0x44, 0x08,
-    0x18, 0x48, 0x08, 0x00, 0x09, 0x00, 0x81, 0x00, 0x12, 0x16, 0x00, 0x81, 0x00, 0x12, 0x0A, 0x00,
-    0x81, 0x00, 0x07, 0x11, 0x18, 0x00, 0x81, 0x72, 0x00, 0x11, 0x12, 0x0F, 0x00, 0x81, 0x00, 0x08,
-    0x0B, 0x17, 0x00, 0x81, 0x72, 0x00, 0x18, 0x12, 0x1A, 0x00, 0x81, 0x64, 0x00, 0x44, 0x74, 0x08,
-    0x08, 0x79, 0x08, 0x00, 0x08, 0x1C, 0x00, 0x81, 0x00, 0x47, 0x86, 0x08, 0x0B, 0x8B, 0x08, 0x17,
-    0x91, 0x08, 0x19, 0x96, 0x08, 0x00, 0x11, 0x18, 0x00, 0x81, 0x00, 0x17, 0x12, 0x2C, 0x00, 0x81,
-    0x00, 0x09, 0x04, 0x00, 0x81, 0x00, 0x12, 0x00, 0x81, 0x00, 0x4B, 0xAD, 0x08, 0x0C, 0xB3, 0x08,
-    0x11, 0xBC, 0x08, 0x12, 0x0C, 0x09, 0x17, 0x14, 0x09, 0x18, 0x1B, 0x09, 0x00, 0x0A, 0x0C, 0x0B,
-    0x00, 0x81, 0x00, 0x11, 0x08, 0x05, 0x00, 0x83, 0x69, 0x6E, 0x67, 0x00, 0x4C, 0xC3, 0x08, 0x12,
-    0x03, 0x09, 0x00, 0x47, 0xD0, 0x08, 0x0A, 0xD9, 0x08, 0x15, 0xE3, 0x08, 0x1A, 0xFB, 0x08, 0x00,
-    0x05, 0x2C, 0x00, 0x84, 0x65, 0x69, 0x6E, 0x67, 0x00, 0x12, 0x2C, 0x00, 0x85, 0x67, 0x6F, 0x69,
-    0x6E, 0x67, 0x00, 0x47, 0xEA, 0x08, 0x08, 0xF3, 0x08, 0x00, 0x2C, 0x00, 0x84, 0x75, 0x72, 0x69,
-    0x6E, 0x67, 0x00, 0x05, 0x2C, 0x00, 0x84, 0x69, 0x6E, 0x67, 0x00, 0x08, 0x05, 0x00, 0x84, 0x69,
-    0x6E, 0x67, 0x00, 0x0C, 0x0F, 0x2C, 0x00, 0x84, 0x6F, 0x6E, 0x67, 0x00, 0x0F, 0x12, 0x08, 0x0A,
-    0x00, 0x80, 0x79, 0x00, 0x04, 0x08, 0x15, 0x0A, 0x00, 0x81, 0x00, 0x12, 0x00, 0x45, 0x24, 0x09,
-    0x15, 0x29, 0x09, 0x00, 0x04, 0x00, 0x81, 0x74, 0x00, 0x0B, 0x17, 0x00, 0x80, 0x68, 0x00, 0x46,
-    0x42, 0x09, 0x0A, 0x68, 0x09, 0x0B, 0x7D, 0x09, 0x11, 0x83, 0x09, 0x17, 0x9F, 0x09, 0x1C, 0xCF,
-    0x09, 0x00, 0x56, 0x49, 0x09, 0x18, 0x50, 0x09, 0x00, 0x18, 0x10, 0x00, 0x83, 0x63, 0x68, 0x00,
-    0x48, 0x57, 0x09, 0x16, 0x5F, 0x09, 0x00, 0x16, 0x2C, 0x00, 0x84, 0x75, 0x63, 0x68, 0x00, 0x04,
-    0x2C, 0x00, 0x85, 0x73, 0x75, 0x63, 0x68, 0x00, 0x4C, 0x6F, 0x09, 0x11, 0x78, 0x09, 0x00, 0x11,
-    0x0B, 0x2C, 0x00, 0x84, 0x69, 0x67, 0x68, 0x00, 0x12, 0x0F, 0x00, 0x81, 0x00, 0x0A, 0x0C, 0x0B,
-    0x00, 0x81, 0x00, 0x48, 0x8A, 0x09, 0x1A, 0x9A, 0x09, 0x00, 0x4B, 0x91, 0x09, 0x19, 0x96, 0x09,
-    0x00, 0x17, 0x2C, 0x00, 0x81, 0x00, 0x08, 0x00, 0x81, 0x00, 0x12, 0x07, 0x00, 0x81, 0x00, 0x4C,
-    0xAC, 0x09, 0x0F, 0xB6, 0x09, 0x12, 0xBD, 0x09, 0x15, 0xC7, 0x09, 0x00, 0x1A, 0x04, 0x2C, 0x00,
-    0x85, 0x77, 0x69, 0x74, 0x68, 0x00, 0x12, 0x05, 0x00, 0x83, 0x74, 0x68, 0x00, 0x05, 0x11, 0x2C,
-    0x00, 0x85, 0x62, 0x6F, 0x74, 0x68, 0x00, 0x12, 0x05, 0x2C, 0x00, 0x83, 0x74, 0x68, 0x00, 0x15,
-    0x08, 0x19, 0x2C, 0x00, 0x81, 0x00, 0x46, 0xEF, 0x09, 0x0E, 0xF7, 0x09, 0x10, 0x31, 0x0A, 0x11,
-    0x38, 0x0A, 0x12, 0x43, 0x0A, 0x15, 0x56, 0x0A, 0x16, 0x5F, 0x0A, 0x17, 0x68, 0x0A, 0x00, 0x16,
-    0x04, 0x05, 0x00, 0x82, 0x69, 0x63, 0x00, 0x46, 0x04, 0x0A, 0x11, 0x21, 0x0A, 0x12, 0x27, 0x0A,
-    0x15, 0x2C, 0x0A, 0x00, 0x44, 0x11, 0x0A, 0x0C, 0x15, 0x0A, 0x12, 0x19, 0x0A, 0x18, 0x1D, 0x0A,
-    0x00, 0x05, 0x00, 0x81, 0x00, 0x07, 0x00, 0x81, 0x00, 0x06, 0x00, 0x81, 0x00, 0x09, 0x00, 0x81,
-    0x00, 0x0C, 0x0B, 0x17, 0x00, 0x81, 0x00, 0x12, 0x0F, 0x00, 0x81, 0x00, 0x12, 0x1A, 0x00, 0x81,
-    0x00, 0x10, 0x12, 0x06, 0x00, 0x80, 0x74, 0x00, 0x15, 0x12, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00,
-    0x80, 0x61, 0x00, 0x56, 0x4A, 0x0A, 0x17, 0x50, 0x0A, 0x00, 0x0F, 0x04, 0x2C, 0x00, 0x81, 0x00,
-    0x11, 0x0C, 0x2C, 0x00, 0x81, 0x00, 0x08, 0x0B, 0x17, 0x2C, 0x00, 0x82, 0x69, 0x72, 0x00, 0x1C,
-    0x0F, 0x04, 0x11, 0x04, 0x00, 0x80, 0x73, 0x00, 0x11, 0x08, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16,
-    0x00, 0x81, 0x6F, 0x00, 0x4B, 0x7B, 0x0A, 0x0E, 0x81, 0x0A, 0x00, 0x0A, 0x0C, 0x0B, 0x00, 0x81,
-    0x00, 0x06, 0x04, 0x05, 0x00, 0x81, 0x00, 0x46, 0x91, 0x0A, 0x0F, 0xBB, 0x0A, 0x12, 0xC1, 0x0A,
-    0x00, 0x52, 0x98, 0x0A, 0x18, 0xB1, 0x0A, 0x00, 0x06, 0x00, 0x56, 0xA1, 0x0A, 0x19, 0xA9, 0x0A,
-    0x00, 0x2C, 0x00, 0x85, 0x63, 0x6F, 0x63, 0x6B, 0x00, 0x2C, 0x00, 0x85, 0x63, 0x6F, 0x63, 0x6B,
-    0x00, 0x09, 0x15, 0x2C, 0x00, 0x85, 0x66, 0x75, 0x63, 0x6B, 0x00, 0x0F, 0x08, 0x1A, 0x00, 0x81,
-    0x00, 0x12, 0x0F, 0x0F, 0x2C, 0x00, 0x84, 0x6F, 0x6F, 0x6B, 0x00, 0x45, 0xEA, 0x0A, 0x07, 0x0A,
-    0x0B, 0x0C, 0x12, 0x0B, 0x0E, 0x1C, 0x0B, 0x0F, 0x40, 0x0B, 0x11, 0x81, 0x0B, 0x12, 0x88, 0x0B,
-    0x13, 0xB0, 0x0B, 0x17, 0xB7, 0x0B, 0x18, 0xCB, 0x0B, 0x00, 0x44, 0xF1, 0x0A, 0x0C, 0xFC, 0x0A,
-    0x00, 0x19, 0x12, 0x15, 0x13, 0x00, 0x84, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x16, 0x16, 0x12, 0x2C,
-    0x00, 0x86, 0x70, 0x6F, 0x73, 0x73, 0x69, 0x62, 0x6C, 0x00, 0x15, 0x12, 0x1A, 0x00, 0x82, 0x6C,
-    0x64, 0x00, 0x0F, 0x17, 0x16, 0x2C, 0x00, 0x83, 0x69, 0x6C, 0x6C, 0x00, 0x46, 0x26, 0x0B, 0x11,
-    0x35, 0x0B, 0x15, 0x3B, 0x0B, 0x00, 0x44, 0x2D, 0x0B, 0x12, 0x31, 0x0B, 0x00, 0x05, 0x00, 0x81,
-    0x00, 0x06, 0x00, 0x81, 0x00, 0x0C, 0x0B, 0x17, 0x00, 0x81, 0x00, 0x12, 0x1A, 0x00, 0x81, 0x00,
-    0x44, 0x4D, 0x0B, 0x08, 0x54, 0x0B, 0x0C, 0x5D, 0x0B, 0x12, 0x79, 0x0B, 0x00, 0x08, 0x15, 0x2C,
+    0x00, 0x47, 0x6D, 0x00, 0x00, 0x74, 0xBE, 0x00, 0x04, 0xC7, 0x00, 0x05, 0xF4, 0x00, 0x06, 0x31,
+    0x01, 0x07, 0x76, 0x01, 0x08, 0x7B, 0x02, 0x09, 0x33, 0x07, 0x0A, 0xA6, 0x07, 0x0B, 0x33, 0x08,
+    0x0C, 0xCE, 0x08, 0x0D, 0x5D, 0x09, 0x0E, 0x6A, 0x09, 0x0F, 0xA6, 0x09, 0x10, 0x97, 0x0A, 0x11,
+    0xCD, 0x0A, 0x12, 0xDF, 0x0B, 0x13, 0x78, 0x0C, 0x15, 0x9D, 0x0C, 0x16, 0xFC, 0x0E, 0x17, 0xC1,
+    0x0F, 0x18, 0xC8, 0x11, 0x19, 0xD2, 0x11, 0x1A, 0xDA, 0x11, 0x1C, 0x52, 0x12, 0x00, 0x17, 0x04,
+    0x0B, 0x17, 0x2C, 0x00, 0x80, 0x73, 0x00, 0x46, 0xD4, 0x00, 0x0A, 0xDF, 0x00, 0x18, 0xE7, 0x00,
+    0x1A, 0xEE, 0x00, 0x00, 0x0C, 0x11, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x80, 0x6C, 0x00, 0x11,
+    0x0C, 0x0B, 0x17, 0x00, 0x81, 0x73, 0x00, 0x17, 0x06, 0x04, 0x00, 0x80, 0x6C, 0x00, 0x12, 0x11,
+    0x0E, 0x00, 0x81, 0x00, 0x44, 0x04, 0x01, 0x0A, 0x0C, 0x01, 0x0B, 0x12, 0x01, 0x0C, 0x18, 0x01,
+    0x11, 0x20, 0x01, 0x00, 0x05, 0x12, 0x15, 0x13, 0x00, 0x80, 0x6C, 0x00, 0x11, 0x12, 0x0F, 0x00,
+    0x81, 0x00, 0x0A, 0x0C, 0x0B, 0x00, 0x81, 0x00, 0x16, 0x16, 0x12, 0x13, 0x00, 0x80, 0x6C, 0x00,
+    0x48, 0x27, 0x01, 0x1A, 0x2C, 0x01, 0x00, 0x19, 0x08, 0x00, 0x81, 0x00, 0x12, 0x07, 0x00, 0x81,
+    0x00, 0x48, 0x3E, 0x01, 0x0C, 0x46, 0x01, 0x12, 0x59, 0x01, 0x16, 0x6E, 0x01, 0x00, 0x11, 0x0C,
+    0x16, 0x00, 0x82, 0x63, 0x65, 0x00, 0x16, 0x04, 0x00, 0x51, 0x50, 0x01, 0x19, 0x52, 0x01, 0x00,
+    0x2C, 0x00, 0x85, 0x62, 0x61, 0x73, 0x69, 0x63, 0x00, 0x4C, 0x60, 0x01, 0x16, 0x67, 0x01, 0x00,
+    0x16, 0x04, 0x05, 0x00, 0x82, 0x63, 0x00, 0x04, 0x05, 0x00, 0x82, 0x69, 0x63, 0x00, 0x0C, 0x16,
+    0x04, 0x05, 0x00, 0x82, 0x63, 0x00, 0x48, 0x8C, 0x01, 0x0C, 0xD1, 0x01, 0x0E, 0xE7, 0x01, 0x0F,
+    0xEF, 0x01, 0x11, 0xF6, 0x01, 0x15, 0x53, 0x02, 0x16, 0x66, 0x02, 0x00, 0x48, 0x9C, 0x01, 0x09,
+    0xB1, 0x01, 0x0E, 0xB6, 0x01, 0x10, 0xBB, 0x01, 0x15, 0xCB, 0x01, 0x00, 0x51, 0xA3, 0x01, 0x15,
+    0xAC, 0x01, 0x00, 0x0B, 0x2C, 0x00, 0x85, 0x6E, 0x65, 0x65, 0x64, 0x00, 0x0B, 0x17, 0x00, 0x81,
+    0x00, 0x0C, 0x0F, 0x00, 0x81, 0x00, 0x04, 0x17, 0x00, 0x81, 0x00, 0x12, 0x00, 0x46, 0xC7, 0x01,
+    0x0B, 0xC7, 0x01, 0x16, 0xC7, 0x01, 0x00, 0x2C, 0x00, 0x81, 0x00, 0x08, 0x0B, 0x2C, 0x00, 0x81,
+    0x00, 0x44, 0xD8, 0x01, 0x16, 0xE1, 0x01, 0x00, 0x16, 0x16, 0x2C, 0x00, 0x84, 0x61, 0x69, 0x64,
+    0x00, 0x04, 0x05, 0x00, 0x81, 0x63, 0x00, 0x15, 0x12, 0x1A, 0x00, 0x82, 0x6C, 0x64, 0x00, 0x12,
+    0x12, 0x0A, 0x00, 0x82, 0x64, 0x00, 0x4C, 0x00, 0x02, 0x12, 0x21, 0x02, 0x18, 0x2A, 0x02, 0x00,
+    0x4E, 0x07, 0x02, 0x12, 0x0F, 0x02, 0x00, 0x09, 0x2C, 0x00, 0x84, 0x69, 0x6E, 0x64, 0x00, 0x49,
+    0x16, 0x02, 0x16, 0x1A, 0x02, 0x00, 0x6C, 0x0A, 0x02, 0x00, 0x2C, 0x00, 0x83, 0x75, 0x6E, 0x64,
+    0x00, 0x15, 0x04, 0x2C, 0x00, 0x82, 0x75, 0x6E, 0x64, 0x00, 0x52, 0x31, 0x02, 0x15, 0x4B, 0x02,
+    0x00, 0x47, 0x38, 0x02, 0x17, 0x41, 0x02, 0x00, 0x2C, 0x00, 0x85, 0x73, 0x6F, 0x75, 0x6E, 0x64,
+    0x00, 0x04, 0x2C, 0x00, 0x85, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x04, 0x00, 0x83, 0x6F, 0x75,
+    0x6E, 0x64, 0x00, 0x08, 0x00, 0x48, 0x5C, 0x02, 0x16, 0x60, 0x02, 0x00, 0x51, 0xF3, 0x01, 0x00,
+    0x18, 0x2C, 0x00, 0x82, 0x64, 0x00, 0x48, 0x6D, 0x02, 0x15, 0x74, 0x02, 0x00, 0x0B, 0x17, 0x2C,
+    0x00, 0x81, 0x65, 0x00, 0x04, 0x08, 0x1C, 0x2C, 0x00, 0x81, 0x00, 0x46, 0xAC, 0x02, 0x07, 0xB8,
+    0x02, 0x08, 0x3D, 0x03, 0x09, 0x91, 0x03, 0x0B, 0xB5, 0x03, 0x0E, 0xBD, 0x03, 0x0F, 0xF9, 0x03,
+    0x10, 0x67, 0x04, 0x11, 0x05, 0x05, 0x15, 0x0C, 0x05, 0x16, 0x42, 0x06, 0x17, 0x5D, 0x06, 0x19,
+    0xC5, 0x06, 0x1A, 0xFE, 0x06, 0x1B, 0x23, 0x07, 0x1C, 0x2B, 0x07, 0x00, 0x11, 0x0C, 0x08, 0x2C,
+    0x00, 0x85, 0x73, 0x69, 0x6E, 0x63, 0x65, 0x00, 0x44, 0xDA, 0x02, 0x07, 0xE3, 0x02, 0x08, 0xE9,
+    0x02, 0x0C, 0xEE, 0x02, 0x0F, 0xF6, 0x02, 0x10, 0x02, 0x03, 0x11, 0x08, 0x03, 0x12, 0x1B, 0x03,
+    0x15, 0x20, 0x03, 0x16, 0x36, 0x03, 0x1D, 0x36, 0x03, 0x00, 0x11, 0x10, 0x2C, 0x00, 0x84, 0x61,
+    0x64, 0x65, 0x00, 0x04, 0x10, 0x00, 0x82, 0x65, 0x00, 0x08, 0x11, 0x00, 0x81, 0x00, 0x16, 0x11,
+    0x12, 0x06, 0x00, 0x80, 0x72, 0x00, 0x55, 0xFD, 0x02, 0x18, 0xFD, 0x02, 0x00, 0x12, 0x1A, 0x00,
+    0x81, 0x00, 0x04, 0x0A, 0x00, 0x82, 0x65, 0x00, 0x4C, 0x0F, 0x03, 0x18, 0x16, 0x03, 0x00, 0x49,
+    0xF2, 0x00, 0x16, 0x42, 0x01, 0x00, 0x12, 0x16, 0x00, 0x81, 0x00, 0x12, 0x0A, 0x00, 0x81, 0x00,
+    0x48, 0x27, 0x03, 0x12, 0x32, 0x03, 0x00, 0x4B, 0xE6, 0x02, 0x1A, 0x2E, 0x03, 0x00, 0x6C, 0xE6,
+    0x02, 0x00, 0x50, 0xE6, 0x02, 0x00, 0x04, 0x10, 0x00, 0x83, 0x64, 0x65, 0x00, 0x47, 0x4A, 0x03,
+    0x0B, 0x50, 0x03, 0x15, 0x57, 0x03, 0x1A, 0x8A, 0x03, 0x00, 0x11, 0x18, 0x00, 0x81, 0x72, 0x00,
+    0x17, 0x12, 0x2C, 0x00, 0x81, 0x72, 0x00, 0x45, 0x64, 0x03, 0x08, 0x7B, 0x03, 0x0A, 0x80, 0x03,
+    0x12, 0x86, 0x03, 0x00, 0x4B, 0x6B, 0x03, 0x17, 0x73, 0x03, 0x00, 0x17, 0x2C, 0x00, 0x84, 0x72,
+    0x65, 0x65, 0x00, 0x2C, 0x00, 0x84, 0x68, 0x72, 0x65, 0x65, 0x00, 0x0B, 0x2C, 0x00, 0x81, 0x00,
+    0x17, 0x00, 0x6C, 0x75, 0x03, 0x00, 0x10, 0x00, 0x81, 0x00, 0x17, 0x08, 0x05, 0x00, 0x80, 0x6E,
+    0x00, 0x4C, 0x9B, 0x03, 0x12, 0xA4, 0x03, 0x15, 0xAC, 0x03, 0x00, 0x18, 0x0F, 0x2C, 0x00, 0x84,
+    0x69, 0x66, 0x65, 0x00, 0x0C, 0x0F, 0x2C, 0x00, 0x83, 0x66, 0x65, 0x00, 0x08, 0x00, 0x4B, 0x2E,
+    0x03, 0x1A, 0x2E, 0x03, 0x00, 0x17, 0x12, 0x11, 0x04, 0x00, 0x80, 0x72, 0x00, 0x44, 0xCD, 0x03,
+    0x0C, 0xD7, 0x03, 0x0F, 0xEA, 0x03, 0x16, 0xF0, 0x03, 0x1A, 0xEA, 0x03, 0x00, 0x10, 0x0E, 0x2C,
+    0x00, 0x85, 0x6D, 0x61, 0x6B, 0x65, 0x00, 0x44, 0xDE, 0x03, 0x0B, 0xE4, 0x03, 0x00, 0x10, 0x00,
+    0x83, 0x6B, 0x65, 0x00, 0x1A, 0x00, 0x82, 0x6C, 0x65, 0x00, 0x04, 0x00, 0x57, 0xE0, 0x03, 0x00,
+    0x04, 0x00, 0x50, 0xE0, 0x03, 0x17, 0xE0, 0x03, 0x00, 0x4C, 0x0C, 0x04, 0x12, 0x17, 0x04, 0x13,
+    0x35, 0x04, 0x17, 0x4E, 0x04, 0x18, 0x57, 0x04, 0x1C, 0x5D, 0x04, 0x00, 0x0B, 0x04, 0x2C, 0x00,
+    0x85, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x00, 0x4B, 0x1E, 0x04, 0x16, 0x2B, 0x04, 0x00, 0x16, 0x16,
+    0x2C, 0x00, 0x86, 0x61, 0x73, 0x73, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x16, 0x04, 0x2C, 0x00, 0x83,
+    0x68, 0x6F, 0x6C, 0x65, 0x00, 0x12, 0x00, 0x53, 0x3E, 0x04, 0x15, 0x45, 0x04, 0x00, 0x84, 0x65,
+    0x6F, 0x70, 0x6C, 0x65, 0x00, 0x13, 0x00, 0x85, 0x65, 0x6F, 0x70, 0x6C, 0x65, 0x00, 0x0C, 0x0F,
+    0x2C, 0x00, 0x82, 0x74, 0x6C, 0x65, 0x00, 0x12, 0x06, 0x00, 0x81, 0x64, 0x00, 0x17, 0x0C, 0x0F,
+    0x2C, 0x00, 0x83, 0x74, 0x6C, 0x65, 0x00, 0x44, 0x77, 0x04, 0x0C, 0x94, 0x04, 0x0F, 0x9C, 0x04,
+    0x11, 0xA3, 0x04, 0x12, 0xB0, 0x04, 0x00, 0x48, 0x81, 0x04, 0x0B, 0x88, 0x04, 0x16, 0x8E, 0x04,
+    0x00, 0x16, 0x00, 0x84, 0x61, 0x6D, 0x65, 0x00, 0x0A, 0x00, 0x6C, 0x83, 0x04, 0x00, 0x16, 0x00,
+    0x6C, 0x83, 0x04, 0x00, 0x15, 0x17, 0x00, 0x84, 0x69, 0x6D, 0x65, 0x00, 0x12, 0x0B, 0x00, 0x83,
+    0x6D, 0x65, 0x00, 0x12, 0x00, 0x4B, 0xAC, 0x04, 0x16, 0xAC, 0x04, 0x00, 0x6C, 0x9F, 0x04, 0x00,
+    0x46, 0xC9, 0x04, 0x08, 0xD2, 0x04, 0x0A, 0xDA, 0x04, 0x0B, 0xE0, 0x04, 0x0C, 0xE9, 0x04, 0x0F,
+    0xFA, 0x04, 0x11, 0xDA, 0x04, 0x1C, 0x01, 0x05, 0x00, 0x16, 0x2C, 0x00, 0x85, 0x63, 0x6F, 0x6D,
+    0x65, 0x00, 0x16, 0x2C, 0x00, 0x84, 0x6F, 0x6D, 0x65, 0x00, 0x0B, 0x00, 0x6C, 0xD5, 0x04, 0x00,
+    0x0A, 0x2C, 0x00, 0x85, 0x68, 0x6F, 0x6D, 0x65, 0x00, 0x46, 0xF6, 0x04, 0x0B, 0xF6, 0x04, 0x16,
+    0xF6, 0x04, 0x17, 0xAC, 0x04, 0x00, 0x6C, 0xD5, 0x04, 0x00, 0x46, 0xF6, 0x04, 0x0B, 0xF6, 0x04,
+    0x00, 0x4B, 0xD5, 0x04, 0x00, 0x10, 0x12, 0x06, 0x00, 0x82, 0x65, 0x00, 0x74, 0x2B, 0x05, 0x04,
+    0x37, 0x05, 0x07, 0x58, 0x05, 0x08, 0x66, 0x05, 0x09, 0x07, 0x06, 0x0B, 0x0F, 0x06, 0x12, 0x16,
+    0x06, 0x13, 0x30, 0x06, 0x15, 0x37, 0x06, 0x17, 0x30, 0x06, 0x00, 0x18, 0x12, 0x2C, 0x00, 0x85,
+    0x79, 0x6F, 0x75, 0x27, 0x72, 0x65, 0x00, 0x50, 0x3E, 0x05, 0x1A, 0x49, 0x05, 0x00, 0x15, 0x0C,
+    0x09, 0x2C, 0x00, 0x83, 0x77, 0x61, 0x72, 0x65, 0x00, 0x10, 0x15, 0x0C, 0x2C, 0x00, 0x87, 0x66,
+    0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x44, 0x32, 0x03, 0x11, 0x5F, 0x05, 0x00, 0x18,
+    0x2C, 0x00, 0x82, 0x65, 0x72, 0x00, 0x47, 0x7F, 0x05, 0x08, 0x91, 0x05, 0x0B, 0x9E, 0x05, 0x11,
+    0xD0, 0x05, 0x17, 0xD9, 0x05, 0x19, 0xE4, 0x05, 0x1A, 0xF0, 0x05, 0x1C, 0x01, 0x06, 0x00, 0x51,
+    0x86, 0x05, 0x1A, 0x8A, 0x05, 0x00, 0x18, 0x00, 0x81, 0x00, 0x2C, 0x00, 0x84, 0x65, 0x72, 0x65,
+    0x00, 0x4B, 0x98, 0x05, 0x1A, 0x98, 0x05, 0x00, 0x2C, 0x00, 0x83, 0x72, 0x65, 0x00, 0x44, 0xAB,
+    0x05, 0x15, 0xB4, 0x05, 0x16, 0xAD, 0x05, 0x17, 0xBD, 0x05, 0x00, 0x2C, 0x00, 0x85, 0x77, 0x68,
+    0x65, 0x72, 0x65, 0x00, 0x2C, 0x00, 0x85, 0x74, 0x68, 0x65, 0x72, 0x65, 0x00, 0x52, 0xC7, 0x01,
+    0x15, 0xC7, 0x05, 0x1C, 0xC7, 0x05, 0x00, 0x2C, 0x00, 0x86, 0x74, 0x68, 0x65, 0x72, 0x65, 0x00,
+    0x17, 0x2C, 0x00, 0x84, 0x68, 0x65, 0x72, 0x65, 0x00, 0x49, 0xE0, 0x05, 0x0B, 0xB4, 0x05, 0x00,
+    0x04, 0x00, 0x81, 0x00, 0x48, 0xEB, 0x05, 0x12, 0xF2, 0x00, 0x00, 0x11, 0x2C, 0x00, 0x81, 0x00,
+    0x48, 0xF7, 0x05, 0x16, 0xFD, 0x05, 0x00, 0x85, 0x77, 0x65, 0x72, 0x65, 0x00, 0x6C, 0xF7, 0x05,
+    0x00, 0x1A, 0x00, 0x6C, 0xD3, 0x05, 0x00, 0x08, 0x05, 0x00, 0x82, 0x6F, 0x72, 0x65, 0x00, 0x17,
+    0x12, 0x00, 0x6C, 0x62, 0x05, 0x00, 0x46, 0x1D, 0x06, 0x09, 0x26, 0x06, 0x00, 0x08, 0x05, 0x00,
+    0x84, 0x66, 0x6F, 0x72, 0x65, 0x00, 0x05, 0x2C, 0x00, 0x84, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x00,
+    0x12, 0x10, 0x00, 0x6C, 0x9A, 0x05, 0x00, 0x48, 0x3E, 0x06, 0x12, 0x32, 0x03, 0x00, 0x4B, 0xE6,
+    0x02, 0x00, 0x4B, 0x49, 0x06, 0x18, 0x52, 0x06, 0x00, 0x08, 0x17, 0x00, 0x84, 0x68, 0x65, 0x73,
+    0x65, 0x00, 0x04, 0x08, 0x05, 0x00, 0x84, 0x63, 0x61, 0x75, 0x73, 0x65, 0x00, 0x44, 0x6A, 0x06,
+    0x15, 0x84, 0x06, 0x16, 0x9D, 0x06, 0x17, 0xA6, 0x06, 0x00, 0x55, 0x71, 0x06, 0x17, 0x7A, 0x06,
+    0x00, 0x17, 0x16, 0x2C, 0x00, 0x84, 0x61, 0x74, 0x65, 0x00, 0x1B, 0x2C, 0x00, 0x85, 0x73, 0x74,
+    0x61, 0x74, 0x65, 0x00, 0x44, 0x8E, 0x06, 0x08, 0x96, 0x06, 0x12, 0x32, 0x03, 0x00, 0x17, 0x16,
+    0x2C, 0x00, 0x83, 0x74, 0x65, 0x00, 0x0B, 0x17, 0x2C, 0x00, 0x82, 0x65, 0x00, 0x17, 0x16, 0x2C,
+    0x00, 0x83, 0x61, 0x74, 0x65, 0x00, 0x44, 0xB0, 0x06, 0x08, 0xB9, 0x06, 0x0C, 0xBF, 0x06, 0x00,
+    0x16, 0x2C, 0x00, 0x84, 0x74, 0x61, 0x74, 0x65, 0x00, 0x05, 0x2C, 0x00, 0x80, 0x72, 0x00, 0x0F,
+    0x00, 0x81, 0x6C, 0x65, 0x00, 0x51, 0xCC, 0x06, 0x12, 0xD3, 0x06, 0x00, 0x0C, 0x16, 0x00, 0x6C,
+    0x42, 0x01, 0x00, 0x4E, 0xDD, 0x06, 0x0F, 0xE5, 0x06, 0x12, 0xF8, 0x06, 0x00, 0x0F, 0x2C, 0x00,
+    0x84, 0x6F, 0x76, 0x65, 0x00, 0x4E, 0xEC, 0x06, 0x0F, 0xF4, 0x06, 0x00, 0x2C, 0x00, 0x85, 0x6C,
+    0x6F, 0x76, 0x65, 0x00, 0x6C, 0xE0, 0x06, 0x00, 0x0F, 0x00, 0x83, 0x76, 0x65, 0x00, 0x47, 0xE3,
+    0x02, 0x08, 0x0E, 0x07, 0x10, 0x15, 0x07, 0x12, 0x0E, 0x07, 0x15, 0x1C, 0x07, 0x00, 0x0B, 0x17,
+    0x00, 0x82, 0x73, 0x65, 0x00, 0x04, 0x16, 0x2C, 0x00, 0x82, 0x65, 0x00, 0x08, 0x0B, 0x2C, 0x00,
+    0x82, 0x65, 0x00, 0x12, 0x0B, 0x17, 0x00, 0x6C, 0x11, 0x07, 0x00, 0x04, 0x17, 0x16, 0x00, 0x82,
+    0x74, 0x65, 0x00, 0x47, 0x46, 0x07, 0x08, 0x64, 0x07, 0x0A, 0x0C, 0x01, 0x0C, 0x6B, 0x07, 0x0F,
+    0x72, 0x07, 0x15, 0x79, 0x07, 0x00, 0x48, 0xE9, 0x02, 0x0F, 0x53, 0x07, 0x11, 0x59, 0x07, 0x12,
+    0x1B, 0x03, 0x00, 0x15, 0x12, 0x1A, 0x00, 0x81, 0x00, 0x4C, 0x60, 0x07, 0x18, 0x16, 0x03, 0x00,
+    0x09, 0x00, 0x81, 0x00, 0x07, 0x11, 0x18, 0x00, 0x81, 0x72, 0x00, 0x08, 0x0B, 0x17, 0x00, 0x81,
+    0x72, 0x00, 0x18, 0x12, 0x1A, 0x00, 0x81, 0x64, 0x00, 0x44, 0x80, 0x07, 0x08, 0x85, 0x07, 0x00,
+    0x08, 0x1C, 0x00, 0x81, 0x00, 0x47, 0x92, 0x07, 0x0B, 0x97, 0x07, 0x17, 0x9D, 0x07, 0x19, 0xA2,
+    0x07, 0x00, 0x11, 0x18, 0x00, 0x81, 0x00, 0x17, 0x12, 0x2C, 0x00, 0x81, 0x00, 0x09, 0x04, 0x00,
+    0x81, 0x00, 0x12, 0x00, 0x81, 0x00, 0x4B, 0x12, 0x01, 0x0C, 0xB9, 0x07, 0x11, 0xC2, 0x07, 0x12,
+    0x10, 0x08, 0x17, 0x18, 0x08, 0x18, 0x1F, 0x08, 0x00, 0x11, 0x08, 0x05, 0x00, 0x83, 0x69, 0x6E,
+    0x67, 0x00, 0x4C, 0xC9, 0x07, 0x12, 0x07, 0x08, 0x00, 0x47, 0xD6, 0x07, 0x0A, 0xDF, 0x07, 0x15,
+    0xE9, 0x07, 0x1A, 0x01, 0x08, 0x00, 0x05, 0x2C, 0x00, 0x84, 0x65, 0x69, 0x6E, 0x67, 0x00, 0x12,
+    0x2C, 0x00, 0x85, 0x67, 0x6F, 0x69, 0x6E, 0x67, 0x00, 0x47, 0xF0, 0x07, 0x08, 0xF9, 0x07, 0x00,
+    0x2C, 0x00, 0x84, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x05, 0x2C, 0x00, 0x84, 0x69, 0x6E, 0x67,
+    0x00, 0x08, 0x00, 0x45, 0xFC, 0x07, 0x00, 0x0C, 0x0F, 0x2C, 0x00, 0x84, 0x6F, 0x6E, 0x67, 0x00,
+    0x0F, 0x12, 0x08, 0x0A, 0x00, 0x80, 0x79, 0x00, 0x04, 0x08, 0x15, 0x0A, 0x00, 0x81, 0x00, 0x12,
+    0x00, 0x45, 0x28, 0x08, 0x15, 0x2D, 0x08, 0x00, 0x04, 0x00, 0x81, 0x74, 0x00, 0x0B, 0x17, 0x00,
+    0x80, 0x68, 0x00, 0x46, 0x46, 0x08, 0x0A, 0x6C, 0x08, 0x0B, 0x12, 0x01, 0x11, 0x81, 0x08, 0x17,
+    0x98, 0x08, 0x1C, 0xC7, 0x08, 0x00, 0x56, 0x4D, 0x08, 0x18, 0x54, 0x08, 0x00, 0x18, 0x10, 0x00,
+    0x83, 0x63, 0x68, 0x00, 0x48, 0x5B, 0x08, 0x16, 0x63, 0x08, 0x00, 0x16, 0x2C, 0x00, 0x84, 0x75,
+    0x63, 0x68, 0x00, 0x04, 0x2C, 0x00, 0x85, 0x73, 0x75, 0x63, 0x68, 0x00, 0x4C, 0x73, 0x08, 0x11,
+    0x7C, 0x08, 0x00, 0x11, 0x0B, 0x2C, 0x00, 0x84, 0x69, 0x67, 0x68, 0x00, 0x12, 0x0F, 0x00, 0x81,
+    0x00, 0x48, 0x88, 0x08, 0x1A, 0x2C, 0x01, 0x00, 0x4B, 0x8F, 0x08, 0x19, 0x94, 0x08, 0x00, 0x17,
+    0x2C, 0x00, 0x81, 0x00, 0x08, 0x00, 0x81, 0x00, 0x4C, 0xA5, 0x08, 0x0F, 0xAF, 0x08, 0x12, 0xB6,
+    0x08, 0x15, 0xC0, 0x08, 0x00, 0x1A, 0x04, 0x2C, 0x00, 0x85, 0x77, 0x69, 0x74, 0x68, 0x00, 0x12,
+    0x05, 0x00, 0x83, 0x74, 0x68, 0x00, 0x05, 0x11, 0x2C, 0x00, 0x85, 0x62, 0x6F, 0x74, 0x68, 0x00,
+    0x12, 0x05, 0x00, 0x6C, 0xB2, 0x08, 0x00, 0x15, 0x08, 0x19, 0x2C, 0x00, 0x81, 0x00, 0x46, 0xE7,
+    0x08, 0x0E, 0xEE, 0x08, 0x10, 0x1A, 0x09, 0x11, 0x21, 0x09, 0x12, 0x2C, 0x09, 0x15, 0x3F, 0x09,
+    0x16, 0x48, 0x09, 0x17, 0x51, 0x09, 0x00, 0x16, 0x04, 0x00, 0x45, 0x6A, 0x01, 0x00, 0x46, 0xFB,
+    0x08, 0x11, 0x14, 0x09, 0x12, 0x7C, 0x08, 0x15, 0xFD, 0x02, 0x00, 0x44, 0x08, 0x09, 0x0C, 0x0C,
+    0x09, 0x12, 0x10, 0x09, 0x18, 0x60, 0x07, 0x00, 0x05, 0x00, 0x81, 0x00, 0x07, 0x00, 0x81, 0x00,
+    0x06, 0x00, 0x81, 0x00, 0x0C, 0x0B, 0x17, 0x00, 0x81, 0x00, 0x10, 0x12, 0x06, 0x00, 0x80, 0x74,
+    0x00, 0x15, 0x12, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x80, 0x61, 0x00, 0x56, 0x33, 0x09, 0x17,
+    0x39, 0x09, 0x00, 0x0F, 0x04, 0x2C, 0x00, 0x81, 0x00, 0x11, 0x0C, 0x2C, 0x00, 0x81, 0x00, 0x08,
+    0x0B, 0x17, 0x2C, 0x00, 0x82, 0x69, 0x72, 0x00, 0x1C, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x80, 0x73,
+    0x00, 0x11, 0x08, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x81, 0x6F, 0x00, 0x4B, 0x12, 0x01,
+    0x0E, 0x64, 0x09, 0x00, 0x06, 0x04, 0x05, 0x00, 0x81, 0x00, 0x46, 0x74, 0x09, 0x0F, 0x96, 0x09,
+    0x12, 0x9C, 0x09, 0x00, 0x52, 0x7B, 0x09, 0x18, 0x8C, 0x09, 0x00, 0x06, 0x00, 0x56, 0x84, 0x09,
+    0x19, 0x84, 0x09, 0x00, 0x2C, 0x00, 0x85, 0x63, 0x6F, 0x63, 0x6B, 0x00, 0x09, 0x15, 0x2C, 0x00,
+    0x85, 0x66, 0x75, 0x63, 0x6B, 0x00, 0x0F, 0x08, 0x1A, 0x00, 0x81, 0x00, 0x12, 0x0F, 0x0F, 0x2C,
+    0x00, 0x84, 0x6F, 0x6F, 0x6B, 0x00, 0x45, 0xC5, 0x09, 0x07, 0xE7, 0x01, 0x0C, 0xE5, 0x09, 0x0E,
+    0xEF, 0x09, 0x0F, 0x00, 0x0A, 0x11, 0x3F, 0x0A, 0x12, 0x46, 0x0A, 0x13, 0x68, 0x0A, 0x17, 0x6F,
+    0x0A, 0x18, 0x83, 0x0A, 0x00, 0x44, 0xCC, 0x09, 0x0C, 0xD7, 0x09, 0x00, 0x19, 0x12, 0x15, 0x13,
+    0x00, 0x84, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x16, 0x16, 0x12, 0x2C, 0x00, 0x86, 0x70, 0x6F, 0x73,
+    0x73, 0x69, 0x62, 0x6C, 0x00, 0x0F, 0x17, 0x16, 0x2C, 0x00, 0x83, 0x69, 0x6C, 0x6C, 0x00, 0x46,
+    0xF9, 0x09, 0x11, 0x14, 0x09, 0x15, 0xFD, 0x02, 0x00, 0x44, 0x08, 0x09, 0x12, 0x10, 0x09, 0x00,
+    0x44, 0x0D, 0x0A, 0x08, 0x14, 0x0A, 0x0C, 0x1D, 0x0A, 0x12, 0x39, 0x0A, 0x00, 0x08, 0x15, 0x2C,
     0x00, 0x80, 0x79, 0x00, 0x1A, 0x04, 0x00, 0x85, 0x77, 0x65, 0x6C, 0x6C, 0x00, 0x17, 0x00, 0x44,
-    0x66, 0x0B, 0x16, 0x6F, 0x0B, 0x00, 0x2C, 0x00, 0x85, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x00, 0x04,
-    0x2C, 0x00, 0x86, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x00, 0x17, 0x16, 0x00, 0x83, 0x69, 0x6C, 0x6C,
-    0x00, 0x0C, 0x0B, 0x17, 0x00, 0x81, 0x6B, 0x00, 0x4B, 0x95, 0x0B, 0x0C, 0x9D, 0x0B, 0x16, 0xA5,
-    0x0B, 0x17, 0xAB, 0x0B, 0x00, 0x16, 0x16, 0x04, 0x2C, 0x00, 0x80, 0x65, 0x00, 0x17, 0x16, 0x2C,
-    0x00, 0x82, 0x6C, 0x6C, 0x00, 0x0F, 0x04, 0x2C, 0x00, 0x81, 0x00, 0x11, 0x0C, 0x00, 0x81, 0x00,
-    0x12, 0x08, 0x13, 0x00, 0x80, 0x65, 0x00, 0x51, 0xBE, 0x0B, 0x17, 0xC5, 0x0B, 0x00, 0x0C, 0x19,
-    0x00, 0x82, 0x79, 0x6C, 0x00, 0x0C, 0x0F, 0x00, 0x80, 0x65, 0x00, 0x51, 0xD2, 0x0B, 0x12, 0xDA,
-    0x0B, 0x00, 0x0C, 0x19, 0x2C, 0x00, 0x82, 0x79, 0x6C, 0x00, 0x0B, 0x16, 0x00, 0x80, 0x64, 0x00,
-    0x48, 0xEA, 0x0B, 0x11, 0x0D, 0x0C, 0x12, 0x1E, 0x0C, 0x00, 0x4B, 0xF4, 0x0B, 0x15, 0xFE, 0x0B,
-    0x1C, 0x05, 0x0C, 0x00, 0x17, 0x15, 0x2C, 0x00, 0x85, 0x74, 0x68, 0x65, 0x6D, 0x00, 0x0B, 0x17,
-    0x00, 0x83, 0x65, 0x6D, 0x00, 0x0B, 0x17, 0x2C, 0x00, 0x83, 0x65, 0x6D, 0x00, 0x48, 0x14, 0x0C,
-    0x1A, 0x19, 0x0C, 0x00, 0x19, 0x08, 0x00, 0x81, 0x00, 0x12, 0x07, 0x00, 0x81, 0x00, 0x15, 0x08,
-    0x09, 0x2C, 0x00, 0x84, 0x72, 0x6F, 0x6D, 0x00, 0x44, 0x47, 0x0C, 0x07, 0x7C, 0x0C, 0x08, 0x91,
-    0x0C, 0x0B, 0xCF, 0x0C, 0x0C, 0xFA, 0x0C, 0x10, 0x1B, 0x0D, 0x12, 0x2E, 0x0D, 0x15, 0x3A, 0x0D,
-    0x18, 0x41, 0x0D, 0x1A, 0x48, 0x0D, 0x00, 0x45, 0x4E, 0x0C, 0x0B, 0x56, 0x0C, 0x00, 0x0B, 0x17,
-    0x2C, 0x00, 0x83, 0x61, 0x6E, 0x00, 0x57, 0x5D, 0x0C, 0x1C, 0x74, 0x0C, 0x00, 0x55, 0x64, 0x0C,
-    0x1C, 0x6C, 0x0C, 0x00, 0x2C, 0x00, 0x85, 0x74, 0x68, 0x61, 0x6E, 0x00, 0x2C, 0x00, 0x85, 0x74,
-    0x68, 0x61, 0x6E, 0x00, 0x17, 0x2C, 0x00, 0x84, 0x68, 0x61, 0x6E, 0x00, 0x08, 0x00, 0x4B, 0x85,
-    0x0C, 0x19, 0x8B, 0x0C, 0x00, 0x17, 0x2C, 0x00, 0x82, 0x6E, 0x00, 0x08, 0x2C, 0x00, 0x82, 0x6E,
-    0x00, 0x55, 0x98, 0x0C, 0x19, 0xAC, 0x0C, 0x00, 0x48, 0x9F, 0x0C, 0x0B, 0xA5, 0x0C, 0x00, 0x05,
-    0x00, 0x83, 0x65, 0x6E, 0x00, 0x17, 0x2C, 0x00, 0x83, 0x65, 0x6E, 0x00, 0x48, 0xB3, 0x0C, 0x15,
-    0xC8, 0x0C, 0x00, 0x47, 0xBA, 0x0C, 0x15, 0xC0, 0x0C, 0x00, 0x85, 0x65, 0x76, 0x65, 0x6E, 0x00,
-    0x2C, 0x00, 0x85, 0x65, 0x76, 0x65, 0x6E, 0x00, 0x08, 0x00, 0x84, 0x76, 0x65, 0x6E, 0x00, 0x46,
-    0xD9, 0x0C, 0x0A, 0xE6, 0x0C, 0x17, 0xEB, 0x0C, 0x00, 0x18, 0x00, 0x50, 0xE2, 0x0C, 0x16, 0xE4,
-    0x0C, 0x00, 0x81, 0x00, 0x81, 0x00, 0x0C, 0x0B, 0x00, 0x81, 0x00, 0x4C, 0xF2, 0x0C, 0x12, 0xF6,
-    0x0C, 0x00, 0x1A, 0x00, 0x81, 0x00, 0x05, 0x00, 0x81, 0x00, 0x4B, 0x04, 0x0D, 0x0F, 0x0D, 0x0D,
-    0x15, 0x15, 0x0D, 0x00, 0x17, 0x08, 0x10, 0x12, 0x16, 0x00, 0x80, 0x67, 0x00, 0x08, 0x16, 0x04,
-    0x05, 0x00, 0x80, 0x65, 0x00, 0x18, 0x07, 0x00, 0x80, 0x67, 0x00, 0x44, 0x22, 0x0D, 0x12, 0x28,
-    0x0D, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x6E, 0x00, 0x15, 0x09, 0x2C, 0x00, 0x81, 0x00, 0x0B, 0x17,
+    0x26, 0x0A, 0x16, 0x2F, 0x0A, 0x00, 0x2C, 0x00, 0x85, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x00, 0x04,
+    0x2C, 0x00, 0x86, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x00, 0x17, 0x00, 0x56, 0xEA, 0x09, 0x00, 0x0C,
+    0x0B, 0x17, 0x00, 0x81, 0x6B, 0x00, 0x4B, 0x53, 0x0A, 0x0C, 0x5B, 0x0A, 0x16, 0x33, 0x09, 0x17,
+    0x63, 0x0A, 0x00, 0x16, 0x16, 0x04, 0x2C, 0x00, 0x80, 0x65, 0x00, 0x17, 0x16, 0x2C, 0x00, 0x82,
+    0x6C, 0x6C, 0x00, 0x11, 0x0C, 0x00, 0x81, 0x00, 0x12, 0x08, 0x13, 0x00, 0x80, 0x65, 0x00, 0x51,
+    0x76, 0x0A, 0x17, 0x7D, 0x0A, 0x00, 0x0C, 0x19, 0x00, 0x82, 0x79, 0x6C, 0x00, 0x0C, 0x0F, 0x00,
+    0x80, 0x65, 0x00, 0x51, 0x8A, 0x0A, 0x12, 0x91, 0x0A, 0x00, 0x0C, 0x19, 0x00, 0x6C, 0x79, 0x0A,
+    0x00, 0x0B, 0x16, 0x00, 0x80, 0x64, 0x00, 0x48, 0xA1, 0x0A, 0x11, 0x20, 0x01, 0x12, 0xC3, 0x0A,
+    0x00, 0x4B, 0xAB, 0x0A, 0x15, 0xB5, 0x0A, 0x1C, 0xBC, 0x0A, 0x00, 0x17, 0x15, 0x2C, 0x00, 0x85,
+    0x74, 0x68, 0x65, 0x6D, 0x00, 0x0B, 0x17, 0x00, 0x83, 0x65, 0x6D, 0x00, 0x0B, 0x17, 0x00, 0x6C,
+    0xB8, 0x0A, 0x00, 0x15, 0x08, 0x09, 0x2C, 0x00, 0x84, 0x72, 0x6F, 0x6D, 0x00, 0x44, 0xEC, 0x0A,
+    0x07, 0x19, 0x0B, 0x08, 0x2E, 0x0B, 0x0B, 0x67, 0x0B, 0x0C, 0x8A, 0x0B, 0x10, 0xAB, 0x0B, 0x12,
+    0xBE, 0x0B, 0x15, 0xCA, 0x0B, 0x18, 0xD1, 0x0B, 0x1A, 0xD8, 0x0B, 0x00, 0x45, 0xF3, 0x0A, 0x0B,
+    0xFB, 0x0A, 0x00, 0x0B, 0x17, 0x2C, 0x00, 0x83, 0x61, 0x6E, 0x00, 0x57, 0x02, 0x0B, 0x1C, 0x11,
+    0x0B, 0x00, 0x55, 0x09, 0x0B, 0x1C, 0x09, 0x0B, 0x00, 0x2C, 0x00, 0x85, 0x74, 0x68, 0x61, 0x6E,
+    0x00, 0x17, 0x2C, 0x00, 0x84, 0x68, 0x61, 0x6E, 0x00, 0x08, 0x00, 0x4B, 0x22, 0x0B, 0x19, 0x28,
+    0x0B, 0x00, 0x17, 0x2C, 0x00, 0x82, 0x6E, 0x00, 0x08, 0x2C, 0x00, 0x82, 0x6E, 0x00, 0x55, 0x35,
+    0x0B, 0x19, 0x48, 0x0B, 0x00, 0x48, 0x3C, 0x0B, 0x0B, 0x42, 0x0B, 0x00, 0x05, 0x00, 0x83, 0x65,
+    0x6E, 0x00, 0x17, 0x00, 0x6C, 0x3E, 0x0B, 0x00, 0x48, 0x4F, 0x0B, 0x15, 0x60, 0x0B, 0x00, 0x47,
+    0x56, 0x0B, 0x15, 0x5C, 0x0B, 0x00, 0x85, 0x65, 0x76, 0x65, 0x6E, 0x00, 0x6C, 0x56, 0x0B, 0x00,
+    0x08, 0x00, 0x84, 0x76, 0x65, 0x6E, 0x00, 0x46, 0x71, 0x0B, 0x0A, 0x7A, 0x0B, 0x17, 0x7F, 0x0B,
+    0x00, 0x18, 0x00, 0x50, 0xF2, 0x00, 0x16, 0xF2, 0x00, 0x00, 0x0C, 0x0B, 0x00, 0x81, 0x00, 0x4C,
+    0x86, 0x0B, 0x12, 0x08, 0x09, 0x00, 0x1A, 0x00, 0x81, 0x00, 0x4B, 0x94, 0x0B, 0x0F, 0x9D, 0x0B,
+    0x15, 0xA5, 0x0B, 0x00, 0x17, 0x08, 0x10, 0x12, 0x16, 0x00, 0x80, 0x67, 0x00, 0x08, 0x16, 0x04,
+    0x05, 0x00, 0x80, 0x65, 0x00, 0x18, 0x07, 0x00, 0x80, 0x67, 0x00, 0x44, 0xB2, 0x0B, 0x12, 0xB8,
+    0x0B, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x6E, 0x00, 0x15, 0x09, 0x2C, 0x00, 0x81, 0x00, 0x0B, 0x17,
     0x0B, 0x13, 0x00, 0x85, 0x79, 0x74, 0x68, 0x6F, 0x6E, 0x00, 0x08, 0x19, 0x08, 0x00, 0x82, 0x6E,
     0x00, 0x12, 0x15, 0x04, 0x00, 0x80, 0x64, 0x00, 0x08, 0x0B, 0x17, 0x00, 0x82, 0x6E, 0x00, 0x4B,
-    0x5F, 0x0D, 0x0F, 0x66, 0x0D, 0x13, 0x8D, 0x0D, 0x16, 0x95, 0x0D, 0x17, 0xC6, 0x0D, 0x00, 0x17,
-    0x1C, 0x13, 0x00, 0x80, 0x6E, 0x00, 0x4C, 0x70, 0x0D, 0x0F, 0x76, 0x0D, 0x17, 0x86, 0x0D, 0x00,
-    0x17, 0x16, 0x00, 0x81, 0x6C, 0x00, 0x0C, 0x00, 0x57, 0x7F, 0x0D, 0x1A, 0x84, 0x0D, 0x00, 0x16,
-    0x2C, 0x00, 0x81, 0x00, 0x81, 0x00, 0x11, 0x0C, 0x2C, 0x00, 0x82, 0x6F, 0x00, 0x17, 0x11, 0x0C,
-    0x2C, 0x00, 0x82, 0x6F, 0x00, 0x48, 0x9F, 0x0D, 0x0F, 0xA7, 0x0D, 0x12, 0xBE, 0x0D, 0x00, 0x0F,
-    0x04, 0x2C, 0x00, 0x83, 0x73, 0x6F, 0x00, 0x44, 0xAE, 0x0D, 0x1A, 0xB6, 0x0D, 0x00, 0x16, 0x00,
-    0x85, 0x61, 0x6C, 0x73, 0x6F, 0x00, 0x04, 0x2C, 0x00, 0x84, 0x6C, 0x73, 0x6F, 0x00, 0x0F, 0x04,
-    0x2C, 0x00, 0x83, 0x73, 0x6F, 0x00, 0x4A, 0xCD, 0x0D, 0x11, 0xD5, 0x0D, 0x00, 0x11, 0x0C, 0x2C,
-    0x00, 0x83, 0x74, 0x6F, 0x00, 0x4C, 0xDC, 0x0D, 0x12, 0xF3, 0x0D, 0x00, 0x4E, 0xE3, 0x0D, 0x12,
-    0xEB, 0x0D, 0x00, 0x2C, 0x00, 0x85, 0x69, 0x6E, 0x74, 0x6F, 0x00, 0x2C, 0x00, 0x85, 0x69, 0x6E,
-    0x74, 0x6F, 0x00, 0x0C, 0x00, 0x84, 0x6E, 0x74, 0x6F, 0x00, 0x4F, 0x01, 0x0E, 0x12, 0x0C, 0x0E,
-    0x00, 0x08, 0x0B, 0x11, 0x2C, 0x00, 0x85, 0x68, 0x65, 0x6C, 0x70, 0x00, 0x4F, 0x13, 0x0E, 0x16,
-    0x1A, 0x0E, 0x00, 0x08, 0x0B, 0x2C, 0x00, 0x82, 0x70, 0x00, 0x0F, 0x04, 0x00, 0x81, 0x00, 0x74,
-    0x3B, 0x0E, 0x04, 0x43, 0x0E, 0x06, 0x74, 0x0E, 0x07, 0x7C, 0x0E, 0x08, 0x92, 0x0E, 0x12, 0x15,
-    0x10, 0x15, 0x29, 0x10, 0x17, 0x55, 0x10, 0x18, 0xAD, 0x10, 0x00, 0x18, 0x12, 0x1C, 0x2C, 0x00,
-    0x80, 0x65, 0x00, 0x48, 0x4D, 0x0E, 0x12, 0x56, 0x0E, 0x1A, 0x5E, 0x0E, 0x00, 0x0B, 0x1C, 0x2C,
-    0x00, 0x84, 0x65, 0x61, 0x72, 0x00, 0x05, 0x1C, 0x08, 0x0E, 0x00, 0x80, 0x64, 0x00, 0x48, 0x65,
-    0x0E, 0x10, 0x6C, 0x0E, 0x00, 0x1C, 0x2C, 0x00, 0x83, 0x61, 0x72, 0x00, 0x15, 0x0C, 0x09, 0x2C,
-    0x00, 0x80, 0x65, 0x00, 0x11, 0x0C, 0x16, 0x2C, 0x00, 0x81, 0x65, 0x00, 0x48, 0x83, 0x0E, 0x0B,
-    0x8A, 0x0E, 0x00, 0x19, 0x12, 0x2C, 0x00, 0x82, 0x72, 0x00, 0x17, 0x12, 0x2C, 0x00, 0x82, 0x65,
-    0x72, 0x00, 0x45, 0xBA, 0x0E, 0x06, 0xC3, 0x0E, 0x07, 0xD7, 0x0E, 0x08, 0x01, 0x0F, 0x09, 0x0B,
-    0x0F, 0x0B, 0x13, 0x0F, 0x0C, 0x5B, 0x0F, 0x0F, 0x64, 0x0F, 0x10, 0x6A, 0x0F, 0x15, 0x7A, 0x0F,
-    0x16, 0x80, 0x0F, 0x17, 0x88, 0x0F, 0x19, 0xC8, 0x0F, 0x00, 0x17, 0x12, 0x2C, 0x00, 0x83, 0x68,
-    0x65, 0x72, 0x00, 0x11, 0x00, 0x4C, 0xCC, 0x0E, 0x18, 0xD0, 0x0E, 0x00, 0x16, 0x00, 0x81, 0x00,
-    0x2C, 0x00, 0x83, 0x64, 0x65, 0x72, 0x00, 0x45, 0xE1, 0x0E, 0x0C, 0xEA, 0x0E, 0x11, 0xF7, 0x0E,
-    0x00, 0x18, 0x2C, 0x00, 0x84, 0x6E, 0x64, 0x65, 0x72, 0x00, 0x16, 0x12, 0x06, 0x2C, 0x00, 0x85,
-    0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x0C, 0x2C, 0x00, 0x85, 0x75, 0x6E, 0x64, 0x65, 0x72,
-    0x00, 0x19, 0x11, 0x2C, 0x00, 0x84, 0x65, 0x76, 0x65, 0x72, 0x00, 0x11, 0x18, 0x00, 0x83, 0x64,
-    0x65, 0x72, 0x00, 0x52, 0x1A, 0x0F, 0x17, 0x24, 0x0F, 0x00, 0x11, 0x04, 0x2C, 0x00, 0x83, 0x74,
-    0x68, 0x65, 0x72, 0x00, 0x4F, 0x2E, 0x0F, 0x12, 0x37, 0x0F, 0x15, 0x52, 0x0F, 0x00, 0x2C, 0x00,
-    0x85, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x00, 0x4C, 0x3E, 0x0F, 0x10, 0x47, 0x0F, 0x00, 0x2C, 0x00,
-    0x86, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x00, 0x04, 0x2C, 0x00, 0x86, 0x6E, 0x6F, 0x74, 0x68, 0x65,
-    0x72, 0x00, 0x12, 0x2C, 0x00, 0x85, 0x74, 0x68, 0x65, 0x72, 0x00, 0x0B, 0x17, 0x2C, 0x00, 0x83,
-    0x65, 0x69, 0x72, 0x00, 0x0C, 0x0B, 0x1A, 0x00, 0x81, 0x00, 0x44, 0x71, 0x0F, 0x12, 0x75, 0x0F,
-    0x00, 0x0A, 0x00, 0x81, 0x00, 0x16, 0x2C, 0x00, 0x81, 0x00, 0x08, 0x0B, 0x2C, 0x00, 0x81, 0x00,
-    0x11, 0x18, 0x00, 0x83, 0x64, 0x65, 0x72, 0x00, 0x47, 0x95, 0x0F, 0x12, 0x9D, 0x0F, 0x15, 0xA5,
-    0x0F, 0x17, 0xBD, 0x0F, 0x00, 0x04, 0x00, 0x84, 0x66, 0x74, 0x65, 0x72, 0x00, 0x11, 0x04, 0x00,
-    0x82, 0x68, 0x65, 0x72, 0x00, 0x44, 0xAC, 0x0F, 0x08, 0xB4, 0x0F, 0x00, 0x2C, 0x00, 0x84, 0x66,
-    0x74, 0x65, 0x72, 0x00, 0x05, 0x2C, 0x00, 0x84, 0x74, 0x74, 0x65, 0x72, 0x00, 0x08, 0x2C, 0x00,
-    0x85, 0x62, 0x65, 0x74, 0x74, 0x65, 0x72, 0x00, 0x45, 0xD5, 0x0F, 0x08, 0xDC, 0x0F, 0x11, 0xF5,
-    0x0F, 0x12, 0xFE, 0x0F, 0x00, 0x12, 0x00, 0x84, 0x76, 0x65, 0x72, 0x00, 0x45, 0xE3, 0x0F, 0x15,
-    0xEC, 0x0F, 0x00, 0x11, 0x2C, 0x00, 0x85, 0x65, 0x76, 0x65, 0x72, 0x00, 0x11, 0x2C, 0x00, 0x85,
-    0x65, 0x76, 0x65, 0x72, 0x00, 0x08, 0x00, 0x85, 0x6E, 0x65, 0x76, 0x65, 0x72, 0x00, 0x4C, 0x05,
-    0x10, 0x13, 0x0D, 0x10, 0x00, 0x2C, 0x00, 0x85, 0x6F, 0x76, 0x65, 0x72, 0x00, 0x2C, 0x00, 0x85,
-    0x6F, 0x76, 0x65, 0x72, 0x00, 0x48, 0x1C, 0x10, 0x09, 0x23, 0x10, 0x00, 0x0B, 0x17, 0x00, 0x82,
-    0x69, 0x72, 0x00, 0x08, 0x05, 0x00, 0x80, 0x65, 0x00, 0x08, 0x00, 0x47, 0x38, 0x10, 0x0B, 0x3D,
-    0x10, 0x17, 0x4C, 0x10, 0x19, 0x51, 0x10, 0x00, 0x11, 0x18, 0x00, 0x81, 0x00, 0x57, 0x44, 0x10,
-    0x1A, 0x49, 0x10, 0x00, 0x2C, 0x00, 0x81, 0x65, 0x00, 0x81, 0x65, 0x00, 0x09, 0x04, 0x00, 0x81,
-    0x00, 0x12, 0x00, 0x81, 0x00, 0x44, 0x68, 0x10, 0x06, 0x79, 0x10, 0x0B, 0x7F, 0x10, 0x11, 0x85,
-    0x10, 0x15, 0x8A, 0x10, 0x16, 0x8F, 0x10, 0x00, 0x4B, 0x6F, 0x10, 0x17, 0x73, 0x10, 0x00, 0x1A,
-    0x00, 0x81, 0x00, 0x16, 0x2C, 0x00, 0x81, 0x65, 0x00, 0x04, 0x1B, 0x08, 0x00, 0x81, 0x00, 0x0A,
-    0x0C, 0x15, 0x00, 0x81, 0x00, 0x04, 0x1A, 0x00, 0x81, 0x00, 0x04, 0x13, 0x00, 0x81, 0x00, 0x44,
-    0x9C, 0x10, 0x08, 0xA0, 0x10, 0x12, 0xA4, 0x10, 0x15, 0xA8, 0x10, 0x00, 0x0F, 0x00, 0x81, 0x00,
-    0x05, 0x00, 0x81, 0x00, 0x10, 0x00, 0x81, 0x00, 0x0C, 0x09, 0x00, 0x81, 0x00, 0x48, 0xB7, 0x10,
-    0x12, 0xBE, 0x10, 0x16, 0xD7, 0x10, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x69, 0x72, 0x00, 0x1C, 0x00,
-    0x4B, 0xC7, 0x10, 0x17, 0xCF, 0x10, 0x00, 0x2C, 0x00, 0x85, 0x79, 0x6F, 0x75, 0x72, 0x00, 0x2C,
-    0x00, 0x85, 0x79, 0x6F, 0x75, 0x72, 0x00, 0x04, 0x08, 0x10, 0x00, 0x80, 0x65, 0x00, 0x74, 0xFD,
-    0x10, 0x04, 0x0A, 0x11, 0x07, 0x12, 0x11, 0x08, 0x19, 0x11, 0x0C, 0x70, 0x11, 0x11, 0x79, 0x11,
-    0x12, 0x8D, 0x11, 0x15, 0x95, 0x11, 0x18, 0xAF, 0x11, 0x1C, 0xB7, 0x11, 0x00, 0x17, 0x04, 0x0B,
-    0x2C, 0x00, 0x85, 0x74, 0x68, 0x61, 0x74, 0x27, 0x73, 0x00, 0x0C, 0x0B, 0x17, 0x2C, 0x00, 0x82,
-    0x73, 0x00, 0x0F, 0x18, 0x12, 0x1A, 0x00, 0x81, 0x00, 0x47, 0x2F, 0x11, 0x0C, 0x37, 0x11, 0x0F,
-    0x3E, 0x11, 0x11, 0x46, 0x11, 0x12, 0x5A, 0x11, 0x13, 0x62, 0x11, 0x15, 0x69, 0x11, 0x00, 0x12,
-    0x07, 0x2C, 0x00, 0x83, 0x65, 0x73, 0x00, 0x0B, 0x17, 0x2C, 0x00, 0x82, 0x73, 0x00, 0x12, 0x07,
-    0x2C, 0x00, 0x83, 0x65, 0x73, 0x00, 0x12, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x2C, 0x00, 0x89, 0x68,
-    0x65, 0x61, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x0C, 0x07, 0x00, 0x84, 0x6F, 0x65,
-    0x73, 0x00, 0x12, 0x07, 0x00, 0x83, 0x65, 0x73, 0x00, 0x12, 0x07, 0x00, 0x83, 0x65, 0x73, 0x00,
-    0x1C, 0x0B, 0x17, 0x2C, 0x00, 0x83, 0x69, 0x73, 0x00, 0x4C, 0x80, 0x11, 0x18, 0x87, 0x11, 0x00,
-    0x0B, 0x17, 0x00, 0x81, 0x67, 0x73, 0x00, 0x12, 0x16, 0x00, 0x81, 0x64, 0x00, 0x0C, 0x0B, 0x17,
-    0x2C, 0x00, 0x82, 0x73, 0x00, 0x04, 0x08, 0x00, 0x4B, 0x9F, 0x11, 0x17, 0xA8, 0x11, 0x00, 0x2C,
-    0x00, 0x85, 0x79, 0x65, 0x61, 0x72, 0x73, 0x00, 0x85, 0x79, 0x65, 0x61, 0x72, 0x73, 0x00, 0x04,
-    0x06, 0x08, 0x05, 0x00, 0x80, 0x65, 0x00, 0x04, 0x0F, 0x04, 0x2C, 0x00, 0x83, 0x77, 0x61, 0x79,
-    0x73, 0x00, 0x44, 0xE7, 0x11, 0x06, 0x49, 0x12, 0x08, 0x56, 0x12, 0x0A, 0x7F, 0x12, 0x0C, 0x91,
-    0x12, 0x11, 0xC2, 0x12, 0x12, 0xDA, 0x12, 0x15, 0xE4, 0x12, 0x16, 0x1D, 0x13, 0x17, 0xEA, 0x13,
-    0x18, 0xF0, 0x13, 0x1C, 0x22, 0x14, 0x00, 0x46, 0xFA, 0x11, 0x08, 0x02, 0x12, 0x0B, 0x19, 0x12,
-    0x15, 0x32, 0x12, 0x16, 0x3B, 0x12, 0x1A, 0x41, 0x12, 0x00, 0x1B, 0x08, 0x00, 0x83, 0x61, 0x63,
-    0x74, 0x00, 0x15, 0x00, 0x45, 0x0B, 0x12, 0x09, 0x12, 0x12, 0x00, 0x85, 0x67, 0x72, 0x65, 0x61,
-    0x74, 0x00, 0x85, 0x67, 0x72, 0x65, 0x61, 0x74, 0x00, 0x17, 0x00, 0x4A, 0x22, 0x12, 0x1C, 0x2A,
-    0x12, 0x00, 0x2C, 0x00, 0x85, 0x74, 0x68, 0x61, 0x74, 0x00, 0x2C, 0x00, 0x85, 0x74, 0x68, 0x61,
+    0xEF, 0x0B, 0x0F, 0xF6, 0x0B, 0x13, 0x1B, 0x0C, 0x16, 0x23, 0x0C, 0x17, 0x4C, 0x0C, 0x00, 0x17,
+    0x1C, 0x13, 0x00, 0x80, 0x6E, 0x00, 0x4C, 0x00, 0x0C, 0x0F, 0x06, 0x0C, 0x17, 0x14, 0x0C, 0x00,
+    0x17, 0x16, 0x00, 0x81, 0x6C, 0x00, 0x0C, 0x00, 0x57, 0x0F, 0x0C, 0x1A, 0xF2, 0x00, 0x00, 0x16,
+    0x2C, 0x00, 0x81, 0x00, 0x11, 0x0C, 0x2C, 0x00, 0x82, 0x6F, 0x00, 0x17, 0x11, 0x0C, 0x2C, 0x00,
+    0x82, 0x6F, 0x00, 0x48, 0x2D, 0x0C, 0x0F, 0x35, 0x0C, 0x12, 0x2D, 0x0C, 0x00, 0x0F, 0x04, 0x2C,
+    0x00, 0x83, 0x73, 0x6F, 0x00, 0x44, 0x3C, 0x0C, 0x1A, 0x44, 0x0C, 0x00, 0x16, 0x00, 0x85, 0x61,
+    0x6C, 0x73, 0x6F, 0x00, 0x04, 0x2C, 0x00, 0x84, 0x6C, 0x73, 0x6F, 0x00, 0x4A, 0x53, 0x0C, 0x11,
+    0x5B, 0x0C, 0x00, 0x11, 0x0C, 0x2C, 0x00, 0x83, 0x74, 0x6F, 0x00, 0x4C, 0x62, 0x0C, 0x12, 0x71,
+    0x0C, 0x00, 0x4E, 0x69, 0x0C, 0x12, 0x69, 0x0C, 0x00, 0x2C, 0x00, 0x85, 0x69, 0x6E, 0x74, 0x6F,
+    0x00, 0x0C, 0x00, 0x84, 0x6E, 0x74, 0x6F, 0x00, 0x4F, 0x7F, 0x0C, 0x12, 0x8A, 0x0C, 0x00, 0x08,
+    0x0B, 0x11, 0x2C, 0x00, 0x85, 0x68, 0x65, 0x6C, 0x70, 0x00, 0x4F, 0x91, 0x0C, 0x16, 0x98, 0x0C,
+    0x00, 0x08, 0x0B, 0x2C, 0x00, 0x82, 0x70, 0x00, 0x0F, 0x04, 0x00, 0x81, 0x00, 0x74, 0xB9, 0x0C,
+    0x04, 0xC1, 0x0C, 0x06, 0xF2, 0x0C, 0x07, 0xFA, 0x0C, 0x08, 0x08, 0x0D, 0x12, 0x61, 0x0E, 0x15,
+    0x74, 0x0E, 0x17, 0x8E, 0x0E, 0x18, 0xDA, 0x0E, 0x00, 0x18, 0x12, 0x1C, 0x2C, 0x00, 0x80, 0x65,
+    0x00, 0x48, 0xCB, 0x0C, 0x12, 0xD4, 0x0C, 0x1A, 0xDC, 0x0C, 0x00, 0x0B, 0x1C, 0x2C, 0x00, 0x84,
+    0x65, 0x61, 0x72, 0x00, 0x05, 0x1C, 0x08, 0x0E, 0x00, 0x80, 0x64, 0x00, 0x48, 0xE3, 0x0C, 0x10,
+    0xEA, 0x0C, 0x00, 0x1C, 0x2C, 0x00, 0x83, 0x61, 0x72, 0x00, 0x15, 0x0C, 0x09, 0x2C, 0x00, 0x80,
+    0x65, 0x00, 0x11, 0x0C, 0x16, 0x2C, 0x00, 0x81, 0x65, 0x00, 0x48, 0x01, 0x0D, 0x0B, 0x0F, 0x06,
+    0x00, 0x19, 0x12, 0x2C, 0x00, 0x82, 0x72, 0x00, 0x45, 0x30, 0x0D, 0x06, 0x39, 0x0D, 0x07, 0x4D,
+    0x0D, 0x08, 0x77, 0x0D, 0x09, 0x81, 0x0D, 0x0B, 0x87, 0x0D, 0x0C, 0xCF, 0x0D, 0x0F, 0xD8, 0x0D,
+    0x10, 0xDE, 0x0D, 0x15, 0xCB, 0x01, 0x16, 0x81, 0x0D, 0x17, 0xE9, 0x0D, 0x19, 0x25, 0x0E, 0x00,
+    0x17, 0x12, 0x2C, 0x00, 0x83, 0x68, 0x65, 0x72, 0x00, 0x11, 0x00, 0x4C, 0x42, 0x0D, 0x18, 0x46,
+    0x0D, 0x00, 0x16, 0x00, 0x81, 0x00, 0x2C, 0x00, 0x83, 0x64, 0x65, 0x72, 0x00, 0x45, 0x57, 0x0D,
+    0x0C, 0x60, 0x0D, 0x11, 0x6D, 0x0D, 0x00, 0x18, 0x2C, 0x00, 0x84, 0x6E, 0x64, 0x65, 0x72, 0x00,
+    0x16, 0x12, 0x06, 0x2C, 0x00, 0x85, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x0C, 0x2C, 0x00,
+    0x85, 0x75, 0x6E, 0x64, 0x65, 0x72, 0x00, 0x19, 0x11, 0x2C, 0x00, 0x84, 0x65, 0x76, 0x65, 0x72,
+    0x00, 0x11, 0x00, 0x58, 0x48, 0x0D, 0x00, 0x52, 0x8E, 0x0D, 0x17, 0x98, 0x0D, 0x00, 0x11, 0x04,
+    0x2C, 0x00, 0x83, 0x74, 0x68, 0x65, 0x72, 0x00, 0x4F, 0xA2, 0x0D, 0x12, 0xAB, 0x0D, 0x15, 0xC6,
+    0x0D, 0x00, 0x2C, 0x00, 0x85, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x00, 0x4C, 0xB2, 0x0D, 0x10, 0xBB,
+    0x0D, 0x00, 0x2C, 0x00, 0x86, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x00, 0x04, 0x2C, 0x00, 0x86, 0x6E,
+    0x6F, 0x74, 0x68, 0x65, 0x72, 0x00, 0x12, 0x2C, 0x00, 0x85, 0x74, 0x68, 0x65, 0x72, 0x00, 0x0B,
+    0x17, 0x2C, 0x00, 0x83, 0x65, 0x69, 0x72, 0x00, 0x0C, 0x0B, 0x1A, 0x00, 0x81, 0x00, 0x44, 0xE5,
+    0x0D, 0x12, 0x0F, 0x0C, 0x00, 0x0A, 0x00, 0x81, 0x00, 0x47, 0xF6, 0x0D, 0x12, 0xFE, 0x0D, 0x15,
+    0x06, 0x0E, 0x17, 0x1A, 0x0E, 0x00, 0x04, 0x00, 0x84, 0x66, 0x74, 0x65, 0x72, 0x00, 0x11, 0x04,
+    0x00, 0x82, 0x68, 0x65, 0x72, 0x00, 0x44, 0x0D, 0x0E, 0x08, 0x11, 0x0E, 0x00, 0x6C, 0xF8, 0x0D,
+    0x00, 0x05, 0x2C, 0x00, 0x84, 0x74, 0x74, 0x65, 0x72, 0x00, 0x08, 0x2C, 0x00, 0x85, 0x62, 0x65,
+    0x74, 0x74, 0x65, 0x72, 0x00, 0x45, 0x32, 0x0E, 0x08, 0x39, 0x0E, 0x11, 0x49, 0x0E, 0x12, 0x52,
+    0x0E, 0x00, 0x12, 0x00, 0x84, 0x76, 0x65, 0x72, 0x00, 0x45, 0x40, 0x0E, 0x15, 0x40, 0x0E, 0x00,
+    0x11, 0x2C, 0x00, 0x85, 0x65, 0x76, 0x65, 0x72, 0x00, 0x08, 0x00, 0x85, 0x6E, 0x65, 0x76, 0x65,
+    0x72, 0x00, 0x4C, 0x59, 0x0E, 0x13, 0x59, 0x0E, 0x00, 0x2C, 0x00, 0x85, 0x6F, 0x76, 0x65, 0x72,
+    0x00, 0x48, 0x68, 0x0E, 0x09, 0x6E, 0x0E, 0x00, 0x0B, 0x00, 0x57, 0x44, 0x09, 0x00, 0x08, 0x05,
+    0x00, 0x80, 0x65, 0x00, 0x08, 0x00, 0x47, 0x92, 0x07, 0x0B, 0x83, 0x0E, 0x17, 0x9D, 0x07, 0x19,
+    0xA2, 0x07, 0x00, 0x57, 0x8A, 0x0E, 0x1A, 0x71, 0x02, 0x00, 0x6C, 0x71, 0x02, 0x00, 0x44, 0xA1,
+    0x0E, 0x06, 0xAE, 0x0E, 0x0B, 0xB4, 0x0E, 0x11, 0xBA, 0x0E, 0x15, 0xBF, 0x0E, 0x16, 0xC4, 0x0E,
+    0x00, 0x4B, 0x86, 0x0B, 0x17, 0xA8, 0x0E, 0x00, 0x16, 0x2C, 0x00, 0x81, 0x65, 0x00, 0x04, 0x1B,
+    0x08, 0x00, 0x81, 0x00, 0x0A, 0x0C, 0x15, 0x00, 0x81, 0x00, 0x04, 0x1A, 0x00, 0x81, 0x00, 0x04,
+    0x13, 0x00, 0x81, 0x00, 0x44, 0xD1, 0x0E, 0x08, 0x08, 0x09, 0x12, 0x86, 0x03, 0x15, 0xD5, 0x0E,
+    0x00, 0x0F, 0x00, 0x81, 0x00, 0x0C, 0x09, 0x00, 0x81, 0x00, 0x48, 0x68, 0x0E, 0x12, 0xE4, 0x0E,
+    0x16, 0xF5, 0x0E, 0x00, 0x1C, 0x00, 0x4B, 0xED, 0x0E, 0x17, 0xED, 0x0E, 0x00, 0x2C, 0x00, 0x85,
+    0x79, 0x6F, 0x75, 0x72, 0x00, 0x04, 0x08, 0x10, 0x00, 0x80, 0x65, 0x00, 0x74, 0x1B, 0x0F, 0x04,
+    0x28, 0x0F, 0x07, 0x30, 0x0F, 0x08, 0x37, 0x0F, 0x0C, 0x7E, 0x0F, 0x11, 0x87, 0x0F, 0x12, 0x28,
+    0x0F, 0x15, 0x9B, 0x0F, 0x18, 0xAE, 0x0F, 0x1C, 0xB6, 0x0F, 0x00, 0x17, 0x04, 0x0B, 0x2C, 0x00,
+    0x85, 0x74, 0x68, 0x61, 0x74, 0x27, 0x73, 0x00, 0x0C, 0x0B, 0x17, 0x2C, 0x00, 0x82, 0x73, 0x00,
+    0x0F, 0x18, 0x12, 0x1A, 0x00, 0x81, 0x00, 0x47, 0x4D, 0x0F, 0x0C, 0x55, 0x0F, 0x0F, 0x4D, 0x0F,
+    0x11, 0x5C, 0x0F, 0x12, 0x70, 0x0F, 0x13, 0x78, 0x0F, 0x15, 0x78, 0x0F, 0x00, 0x12, 0x07, 0x2C,
+    0x00, 0x83, 0x65, 0x73, 0x00, 0x0B, 0x17, 0x2C, 0x00, 0x82, 0x73, 0x00, 0x12, 0x0B, 0x13, 0x07,
+    0x04, 0x08, 0x2C, 0x00, 0x89, 0x68, 0x65, 0x61, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00,
+    0x0C, 0x07, 0x00, 0x84, 0x6F, 0x65, 0x73, 0x00, 0x12, 0x00, 0x47, 0x51, 0x0F, 0x00, 0x1C, 0x0B,
+    0x17, 0x2C, 0x00, 0x83, 0x69, 0x73, 0x00, 0x4C, 0x8E, 0x0F, 0x18, 0x95, 0x0F, 0x00, 0x0B, 0x17,
+    0x00, 0x81, 0x67, 0x73, 0x00, 0x12, 0x16, 0x00, 0x81, 0x64, 0x00, 0x04, 0x08, 0x00, 0x4B, 0xA5,
+    0x0F, 0x17, 0xA7, 0x0F, 0x00, 0x2C, 0x00, 0x85, 0x79, 0x65, 0x61, 0x72, 0x73, 0x00, 0x04, 0x06,
+    0x08, 0x05, 0x00, 0x80, 0x65, 0x00, 0x04, 0x0F, 0x04, 0x2C, 0x00, 0x83, 0x77, 0x61, 0x79, 0x73,
+    0x00, 0x44, 0xE6, 0x0F, 0x06, 0x39, 0x10, 0x08, 0x46, 0x10, 0x0A, 0x68, 0x10, 0x0C, 0x75, 0x10,
+    0x11, 0xA6, 0x10, 0x12, 0xB8, 0x10, 0x15, 0xC2, 0x10, 0x16, 0xEC, 0x10, 0x17, 0x96, 0x11, 0x18,
+    0x9C, 0x11, 0x1C, 0xC7, 0x08, 0x00, 0x46, 0xF9, 0x0F, 0x08, 0x01, 0x10, 0x0B, 0x11, 0x10, 0x15,
+    0x22, 0x10, 0x16, 0x2B, 0x10, 0x1A, 0x31, 0x10, 0x00, 0x1B, 0x08, 0x00, 0x83, 0x61, 0x63, 0x74,
+    0x00, 0x15, 0x00, 0x45, 0x0A, 0x10, 0x09, 0x0A, 0x10, 0x00, 0x85, 0x67, 0x72, 0x65, 0x61, 0x74,
+    0x00, 0x17, 0x00, 0x4A, 0x1A, 0x10, 0x1C, 0x1A, 0x10, 0x00, 0x2C, 0x00, 0x85, 0x74, 0x68, 0x61,
     0x74, 0x00, 0x08, 0x0A, 0x00, 0x84, 0x72, 0x65, 0x61, 0x74, 0x00, 0x12, 0x10, 0x00, 0x82, 0x74,
     0x00, 0x0B, 0x17, 0x2C, 0x00, 0x83, 0x61, 0x74, 0x00, 0x04, 0x1B, 0x08, 0x15, 0x2C, 0x00, 0x86,
-    0x65, 0x78, 0x61, 0x63, 0x74, 0x00, 0x47, 0x60, 0x12, 0x15, 0x66, 0x12, 0x16, 0x78, 0x12, 0x00,
-    0x11, 0x18, 0x00, 0x81, 0x72, 0x00, 0x44, 0x6D, 0x12, 0x0C, 0x72, 0x12, 0x00, 0x13, 0x00, 0x82,
-    0x74, 0x00, 0x09, 0x00, 0x82, 0x73, 0x74, 0x00, 0x12, 0x10, 0x2C, 0x00, 0x82, 0x74, 0x00, 0x11,
-    0x00, 0x44, 0x88, 0x12, 0x12, 0x8D, 0x12, 0x00, 0x1A, 0x00, 0x82, 0x74, 0x00, 0x0F, 0x00, 0x81,
-    0x00, 0x48, 0x9B, 0x12, 0x0B, 0xA2, 0x12, 0x10, 0xBA, 0x12, 0x00, 0x0B, 0x17, 0x2C, 0x00, 0x81,
-    0x72, 0x00, 0x56, 0xA9, 0x12, 0x1A, 0xB2, 0x12, 0x00, 0x04, 0x2C, 0x00, 0x85, 0x73, 0x68, 0x69,
-    0x74, 0x00, 0x16, 0x2C, 0x00, 0x84, 0x68, 0x69, 0x74, 0x00, 0x12, 0x06, 0x00, 0x82, 0x6D, 0x69,
-    0x74, 0x00, 0x04, 0x1A, 0x00, 0x44, 0xCC, 0x12, 0x16, 0xD4, 0x12, 0x00, 0x2C, 0x00, 0x85, 0x77,
-    0x61, 0x6E, 0x74, 0x00, 0x85, 0x77, 0x61, 0x6E, 0x74, 0x00, 0x18, 0x05, 0x04, 0x2C, 0x00, 0x83,
-    0x6F, 0x75, 0x74, 0x00, 0x44, 0xEB, 0x12, 0x08, 0xFC, 0x12, 0x00, 0x48, 0xF2, 0x12, 0x0B, 0xF6,
-    0x12, 0x00, 0x1C, 0x00, 0x81, 0x00, 0x17, 0x2C, 0x00, 0x82, 0x74, 0x00, 0x47, 0x09, 0x13, 0x0B,
-    0x0E, 0x13, 0x17, 0x13, 0x13, 0x19, 0x18, 0x13, 0x00, 0x11, 0x18, 0x00, 0x81, 0x00, 0x17, 0x12,
-    0x00, 0x81, 0x00, 0x09, 0x04, 0x00, 0x81, 0x00, 0x08, 0x11, 0x00, 0x81, 0x00, 0x44, 0x36, 0x13,
-    0x07, 0x4A, 0x13, 0x08, 0x5E, 0x13, 0x12, 0xA9, 0x13, 0x13, 0xC0, 0x13, 0x15, 0xC7, 0x13, 0x16,
-    0xDC, 0x13, 0x1A, 0xE3, 0x13, 0x00, 0x4B, 0x3D, 0x13, 0x1B, 0x43, 0x13, 0x00, 0x17, 0x2C, 0x00,
-    0x82, 0x74, 0x00, 0x08, 0x2C, 0x00, 0x82, 0x63, 0x74, 0x00, 0x44, 0x51, 0x13, 0x08, 0x58, 0x13,
-    0x00, 0x0F, 0x2C, 0x00, 0x83, 0x73, 0x74, 0x00, 0x05, 0x00, 0x83, 0x73, 0x74, 0x00, 0x44, 0x71,
-    0x13, 0x05, 0x77, 0x13, 0x0C, 0x80, 0x13, 0x12, 0x87, 0x13, 0x15, 0x8E, 0x13, 0x19, 0xA1, 0x13,
-    0x00, 0x0F, 0x00, 0x83, 0x73, 0x74, 0x00, 0x11, 0x2C, 0x00, 0x85, 0x62, 0x65, 0x73, 0x74, 0x00,
-    0x09, 0x00, 0x83, 0x72, 0x73, 0x74, 0x00, 0x10, 0x2C, 0x00, 0x83, 0x73, 0x74, 0x00, 0x4A, 0x95,
-    0x13, 0x0C, 0x9B, 0x13, 0x00, 0x2C, 0x00, 0x82, 0x61, 0x74, 0x00, 0x09, 0x00, 0x83, 0x73, 0x74,
-    0x00, 0x05, 0x2C, 0x00, 0x84, 0x65, 0x73, 0x74, 0x00, 0x4C, 0xB0, 0x13, 0x11, 0xB8, 0x13, 0x00,
-    0x10, 0x2C, 0x00, 0x84, 0x6F, 0x73, 0x74, 0x00, 0x10, 0x2C, 0x00, 0x84, 0x6F, 0x73, 0x74, 0x00,
-    0x12, 0x10, 0x00, 0x83, 0x73, 0x74, 0x00, 0x48, 0xCE, 0x13, 0x18, 0xD4, 0x13, 0x00, 0x05, 0x00,
-    0x83, 0x73, 0x74, 0x00, 0x09, 0x00, 0x84, 0x69, 0x72, 0x73, 0x74, 0x00, 0x04, 0x0F, 0x2C, 0x00,
-    0x82, 0x74, 0x00, 0x12, 0x10, 0x00, 0x83, 0x73, 0x74, 0x00, 0x15, 0x04, 0x13, 0x00, 0x81, 0x00,
-    0x4F, 0xFA, 0x13, 0x10, 0x02, 0x14, 0x12, 0x0A, 0x14, 0x00, 0x05, 0x04, 0x00, 0x83, 0x6F, 0x75,
-    0x74, 0x00, 0x10, 0x12, 0x06, 0x00, 0x82, 0x69, 0x74, 0x00, 0x4A, 0x11, 0x14, 0x19, 0x1A, 0x14,
-    0x00, 0x04, 0x2C, 0x00, 0x84, 0x62, 0x6F, 0x75, 0x74, 0x00, 0x04, 0x00, 0x84, 0x62, 0x6F, 0x75,
-    0x74, 0x00, 0x15, 0x08, 0x19, 0x2C, 0x00, 0x81, 0x00, 0x17, 0x12, 0x05, 0x04, 0x2C, 0x00, 0x82,
-    0x75, 0x74, 0x00, 0x0C, 0x16, 0x04, 0x05, 0x00, 0x81, 0x63, 0x00, 0x48, 0x4B, 0x14, 0x12, 0xBB,
-    0x14, 0x13, 0xC6, 0x14, 0x15, 0xCD, 0x14, 0x16, 0xD5, 0x14, 0x00, 0x48, 0x61, 0x14, 0x09, 0x67,
-    0x14, 0x0E, 0x6C, 0x14, 0x10, 0x7B, 0x14, 0x15, 0x98, 0x14, 0x17, 0xA5, 0x14, 0x19, 0xAB, 0x14,
-    0x00, 0x15, 0x0B, 0x17, 0x00, 0x81, 0x00, 0x0C, 0x0F, 0x00, 0x81, 0x00, 0x44, 0x73, 0x14, 0x0C,
-    0x77, 0x14, 0x00, 0x10, 0x00, 0x81, 0x00, 0x0F, 0x00, 0x81, 0x00, 0x44, 0x85, 0x14, 0x0C, 0x89,
-    0x14, 0x12, 0x8D, 0x14, 0x00, 0x0A, 0x00, 0x81, 0x00, 0x17, 0x00, 0x81, 0x00, 0x4B, 0x94, 0x14,
-    0x16, 0x96, 0x14, 0x00, 0x81, 0x00, 0x81, 0x00, 0x08, 0x00, 0x4B, 0xA1, 0x14, 0x1A, 0xA3, 0x14,
-    0x00, 0x81, 0x00, 0x81, 0x00, 0x04, 0x17, 0x16, 0x00, 0x81, 0x00, 0x44, 0xB2, 0x14, 0x12, 0xB7,
-    0x14, 0x00, 0x0B, 0x2C, 0x00, 0x81, 0x00, 0x0F, 0x00, 0x81, 0x00, 0x11, 0x0E, 0x0F, 0x2C, 0x00,
-    0x85, 0x6B, 0x6E, 0x6F, 0x77, 0x00, 0x12, 0x11, 0x0E, 0x00, 0x82, 0x77, 0x00, 0x08, 0x0B, 0x17,
-    0x2C, 0x00, 0x81, 0x65, 0x00, 0x0C, 0x0B, 0x17, 0x00, 0x81, 0x00, 0x46, 0xEE, 0x14, 0x08, 0xF6,
-    0x14, 0x0B, 0xFE, 0x14, 0x0F, 0x06, 0x15, 0x15, 0x1F, 0x15, 0x17, 0x2A, 0x15, 0x00, 0x04, 0x1B,
-    0x08, 0x2C, 0x00, 0x81, 0x74, 0x00, 0x15, 0x08, 0x19, 0x2C, 0x00, 0x82, 0x79, 0x00, 0x15, 0x08,
-    0x19, 0x2C, 0x00, 0x82, 0x79, 0x00, 0x4F, 0x0D, 0x15, 0x12, 0x17, 0x15, 0x00, 0x08, 0x15, 0x2C,
-    0x00, 0x83, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x11, 0x12, 0x2C, 0x00, 0x83, 0x6C, 0x79, 0x00, 0x08,
-    0x05, 0x08, 0x2C, 0x00, 0x84, 0x76, 0x65, 0x72, 0x79, 0x00, 0x16, 0x00, 0x52, 0x33, 0x15, 0x15,
-    0x38, 0x15, 0x00, 0x10, 0x2C, 0x00, 0x81, 0x00, 0x0C, 0x09, 0x00, 0x81, 0x00, 0x48, 0x56, 0x15,
-    0x0C, 0x62, 0x15, 0x0E, 0xE3, 0x1A, 0x11, 0xF0, 0x1A, 0x12, 0x0F, 0x1B, 0x16, 0x1C, 0x1B, 0x18,
-    0x3E, 0x1B, 0x1C, 0x4B, 0x1B, 0x00, 0x11, 0x12, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x80,
-    0x73, 0x00, 0x45, 0x7E, 0x15, 0x0B, 0x9D, 0x15, 0x0D, 0xBC, 0x15, 0x0E, 0xDB, 0x15, 0x10, 0xE8,
-    0x15, 0x11, 0x07, 0x16, 0x12, 0xAA, 0x1A, 0x15, 0xB7, 0x1A, 0x18, 0xD6, 0x1A, 0x00, 0x51, 0x85,
-    0x15, 0x15, 0x91, 0x15, 0x00, 0x15, 0x12, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x82, 0x69, 0x61,
-    0x00, 0x12, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x82, 0x6E, 0x69, 0x61, 0x00, 0x51, 0xA4, 0x15,
-    0x15, 0xB0, 0x15, 0x00, 0x15, 0x12, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x82, 0x69, 0x61, 0x00,
-    0x12, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x82, 0x6E, 0x69, 0x61, 0x00, 0x51, 0xC3, 0x15, 0x15,
-    0xCF, 0x15, 0x00, 0x15, 0x12, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x82, 0x69, 0x61, 0x00, 0x12,
-    0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x82, 0x6E, 0x69, 0x61, 0x00, 0x11, 0x15, 0x12, 0x09, 0x0C,
-    0x0F, 0x04, 0x06, 0x00, 0x82, 0x69, 0x61, 0x00, 0x51, 0xEF, 0x15, 0x15, 0xFB, 0x15, 0x00, 0x15,
+    0x65, 0x78, 0x61, 0x63, 0x74, 0x00, 0x47, 0x4A, 0x03, 0x15, 0x50, 0x10, 0x16, 0x61, 0x10, 0x00,
+    0x44, 0x57, 0x10, 0x0C, 0x5B, 0x10, 0x00, 0x53, 0x2E, 0x10, 0x00, 0x09, 0x00, 0x82, 0x73, 0x74,
+    0x00, 0x12, 0x10, 0x2C, 0x00, 0x82, 0x74, 0x00, 0x11, 0x00, 0x44, 0x71, 0x10, 0x12, 0xD1, 0x0E,
+    0x00, 0x5A, 0x2E, 0x10, 0x00, 0x48, 0x7F, 0x10, 0x0B, 0x86, 0x10, 0x10, 0x9E, 0x10, 0x00, 0x0B,
+    0x17, 0x2C, 0x00, 0x81, 0x72, 0x00, 0x56, 0x8D, 0x10, 0x1A, 0x96, 0x10, 0x00, 0x04, 0x2C, 0x00,
+    0x85, 0x73, 0x68, 0x69, 0x74, 0x00, 0x16, 0x2C, 0x00, 0x84, 0x68, 0x69, 0x74, 0x00, 0x12, 0x06,
+    0x00, 0x82, 0x6D, 0x69, 0x74, 0x00, 0x04, 0x1A, 0x00, 0x44, 0xB0, 0x10, 0x16, 0xB2, 0x10, 0x00,
+    0x2C, 0x00, 0x85, 0x77, 0x61, 0x6E, 0x74, 0x00, 0x18, 0x05, 0x04, 0x2C, 0x00, 0x83, 0x6F, 0x75,
+    0x74, 0x00, 0x44, 0xC9, 0x10, 0x08, 0xDA, 0x10, 0x00, 0x48, 0xD0, 0x10, 0x0B, 0xD4, 0x10, 0x00,
+    0x1C, 0x00, 0x81, 0x00, 0x17, 0x2C, 0x00, 0x82, 0x74, 0x00, 0x47, 0x92, 0x07, 0x0B, 0xE7, 0x10,
+    0x17, 0x9D, 0x07, 0x19, 0xE9, 0x02, 0x00, 0x17, 0x12, 0x00, 0x81, 0x00, 0x44, 0x05, 0x11, 0x07,
+    0x13, 0x11, 0x08, 0x25, 0x11, 0x12, 0x6B, 0x11, 0x13, 0x7A, 0x11, 0x15, 0x80, 0x11, 0x16, 0x8F,
+    0x11, 0x1A, 0x7A, 0x11, 0x00, 0x4B, 0xD4, 0x10, 0x1B, 0x0C, 0x11, 0x00, 0x08, 0x2C, 0x00, 0x82,
+    0x63, 0x74, 0x00, 0x44, 0x1A, 0x11, 0x08, 0x21, 0x11, 0x00, 0x0F, 0x2C, 0x00, 0x83, 0x73, 0x74,
+    0x00, 0x45, 0x1D, 0x11, 0x00, 0x44, 0x38, 0x11, 0x05, 0x3C, 0x11, 0x0C, 0x45, 0x11, 0x12, 0x4C,
+    0x11, 0x15, 0x52, 0x11, 0x19, 0x63, 0x11, 0x00, 0x4F, 0x1D, 0x11, 0x00, 0x11, 0x2C, 0x00, 0x85,
+    0x62, 0x65, 0x73, 0x74, 0x00, 0x09, 0x00, 0x83, 0x72, 0x73, 0x74, 0x00, 0x10, 0x00, 0x6C, 0x1D,
+    0x11, 0x00, 0x4A, 0x59, 0x11, 0x0C, 0x5F, 0x11, 0x00, 0x2C, 0x00, 0x82, 0x61, 0x74, 0x00, 0x49,
+    0x1D, 0x11, 0x00, 0x05, 0x2C, 0x00, 0x84, 0x65, 0x73, 0x74, 0x00, 0x4C, 0x72, 0x11, 0x11, 0x72,
+    0x11, 0x00, 0x10, 0x2C, 0x00, 0x84, 0x6F, 0x73, 0x74, 0x00, 0x12, 0x00, 0x50, 0x1D, 0x11, 0x00,
+    0x48, 0x21, 0x11, 0x18, 0x87, 0x11, 0x00, 0x09, 0x00, 0x84, 0x69, 0x72, 0x73, 0x74, 0x00, 0x04,
+    0x0F, 0x2C, 0x00, 0x82, 0x74, 0x00, 0x15, 0x04, 0x13, 0x00, 0x81, 0x00, 0x4F, 0xA6, 0x11, 0x10,
+    0xAC, 0x11, 0x12, 0xB4, 0x11, 0x00, 0x05, 0x00, 0x44, 0xBD, 0x10, 0x00, 0x10, 0x12, 0x06, 0x00,
+    0x82, 0x69, 0x74, 0x00, 0x4A, 0xBB, 0x11, 0x19, 0xC4, 0x11, 0x00, 0x04, 0x2C, 0x00, 0x84, 0x62,
+    0x6F, 0x75, 0x74, 0x00, 0x44, 0xBE, 0x11, 0x00, 0x17, 0x12, 0x05, 0x04, 0x2C, 0x00, 0x82, 0x75,
+    0x74, 0x00, 0x0C, 0x16, 0x04, 0x05, 0x00, 0x81, 0x63, 0x00, 0x48, 0xEA, 0x11, 0x12, 0x38, 0x12,
+    0x13, 0x43, 0x12, 0x15, 0x4A, 0x12, 0x16, 0x14, 0x09, 0x00, 0x48, 0x00, 0x12, 0x09, 0xB1, 0x01,
+    0x0E, 0x06, 0x12, 0x10, 0x0D, 0x12, 0x15, 0x22, 0x12, 0x17, 0x2B, 0x12, 0x19, 0x31, 0x12, 0x00,
+    0x15, 0x0B, 0x17, 0x00, 0x81, 0x00, 0x44, 0x86, 0x03, 0x0C, 0xD1, 0x0E, 0x00, 0x44, 0xE5, 0x0D,
+    0x0C, 0x17, 0x12, 0x12, 0x1B, 0x12, 0x00, 0x17, 0x00, 0x81, 0x00, 0x4B, 0xF2, 0x00, 0x16, 0xF2,
+    0x00, 0x00, 0x08, 0x00, 0x4B, 0xF2, 0x00, 0x1A, 0xF2, 0x00, 0x00, 0x04, 0x17, 0x16, 0x00, 0x81,
+    0x00, 0x44, 0x7B, 0x03, 0x12, 0xD1, 0x0E, 0x00, 0x11, 0x0E, 0x0F, 0x2C, 0x00, 0x85, 0x6B, 0x6E,
+    0x6F, 0x77, 0x00, 0x12, 0x11, 0x0E, 0x00, 0x82, 0x77, 0x00, 0x08, 0x0B, 0x17, 0x2C, 0x00, 0x81,
+    0x65, 0x00, 0x46, 0x65, 0x12, 0x08, 0x6D, 0x12, 0x0B, 0x6D, 0x12, 0x0F, 0x75, 0x12, 0x15, 0x8E,
+    0x12, 0x17, 0x99, 0x12, 0x00, 0x04, 0x1B, 0x08, 0x2C, 0x00, 0x81, 0x74, 0x00, 0x15, 0x08, 0x19,
+    0x2C, 0x00, 0x82, 0x79, 0x00, 0x4F, 0x7C, 0x12, 0x12, 0x86, 0x12, 0x00, 0x08, 0x15, 0x2C, 0x00,
+    0x83, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x11, 0x12, 0x2C, 0x00, 0x83, 0x6C, 0x79, 0x00, 0x08, 0x05,
+    0x08, 0x2C, 0x00, 0x84, 0x76, 0x65, 0x72, 0x79, 0x00, 0x16, 0x00, 0x52, 0xA2, 0x12, 0x15, 0xD5,
+    0x0E, 0x00, 0x10, 0x2C, 0x00, 0x81, 0x00, 0x48, 0xC0, 0x12, 0x0C, 0xCC, 0x12, 0x0E, 0x50, 0x15,
+    0x11, 0x5D, 0x15, 0x12, 0x50, 0x15, 0x16, 0x7A, 0x15, 0x18, 0x50, 0x15, 0x1C, 0x9C, 0x15, 0x00,
+    0x11, 0x12, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x80, 0x73, 0x00, 0x45, 0xE8, 0x12, 0x0B,
+    0xE8, 0x12, 0x0D, 0xE8, 0x12, 0x0E, 0x07, 0x13, 0x10, 0xE8, 0x12, 0x11, 0x13, 0x13, 0x12, 0x07,
+    0x13, 0x15, 0x34, 0x15, 0x18, 0x07, 0x13, 0x00, 0x51, 0xEF, 0x12, 0x15, 0xFB, 0x12, 0x00, 0x15,
     0x12, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x82, 0x69, 0x61, 0x00, 0x12, 0x09, 0x0C, 0x0F, 0x04,
-    0x06, 0x00, 0x82, 0x6E, 0x69, 0x61, 0x00, 0x45, 0x23, 0x16, 0x08, 0x30, 0x16, 0x09, 0x4F, 0x16,
-    0x0B, 0x6E, 0x16, 0x0D, 0x7B, 0x16, 0x10, 0x88, 0x16, 0x12, 0x95, 0x16, 0x15, 0xB4, 0x16, 0x17,
-    0x8B, 0x1A, 0x00, 0x15, 0x12, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x83, 0x6E, 0x69, 0x61, 0x00,
-    0x52, 0x37, 0x16, 0x15, 0x43, 0x16, 0x00, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x83, 0x72, 0x6E,
-    0x69, 0x61, 0x00, 0x12, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x83, 0x6E, 0x69, 0x61, 0x00, 0x52,
-    0x56, 0x16, 0x15, 0x62, 0x16, 0x00, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x83, 0x72, 0x6E, 0x69,
-    0x61, 0x00, 0x12, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x83, 0x6E, 0x69, 0x61, 0x00, 0x15, 0x12,
-    0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x83, 0x6E, 0x69, 0x61, 0x00, 0x15, 0x12, 0x09, 0x0C, 0x0F,
-    0x04, 0x06, 0x00, 0x83, 0x6E, 0x69, 0x61, 0x00, 0x15, 0x12, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00,
-    0x83, 0x6E, 0x69, 0x61, 0x00, 0x49, 0x9C, 0x16, 0x15, 0xA7, 0x16, 0x00, 0x0C, 0x0F, 0x04, 0x06,
-    0x00, 0x82, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x84, 0x6F, 0x72,
-    0x6E, 0x69, 0x61, 0x00, 0x48, 0xCA, 0x16, 0x09, 0xD7, 0x16, 0x0C, 0x07, 0x17, 0x0F, 0x26, 0x17,
-    0x12, 0x45, 0x17, 0x13, 0x5F, 0x1A, 0x17, 0x7E, 0x1A, 0x00, 0x12, 0x09, 0x0C, 0x0F, 0x04, 0x06,
-    0x00, 0x84, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x4C, 0xDE, 0x16, 0x12, 0xE9, 0x16, 0x00, 0x0F, 0x04,
-    0x06, 0x00, 0x83, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x49, 0xF0, 0x16, 0x0C, 0xFB, 0x16, 0x00,
-    0x0C, 0x0F, 0x04, 0x06, 0x00, 0x84, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x0F, 0x04, 0x06, 0x00, 0x85,
-    0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x49, 0x0E, 0x17, 0x12, 0x1A, 0x17, 0x00, 0x0C, 0x0F,
-    0x04, 0x06, 0x00, 0x84, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00,
-    0x84, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x49, 0x2D, 0x17, 0x12, 0x39, 0x17, 0x00, 0x0C, 0x0F, 0x04,
-    0x06, 0x00, 0x84, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x84,
-    0x72, 0x6E, 0x69, 0x61, 0x00, 0x46, 0x61, 0x17, 0x07, 0x80, 0x17, 0x09, 0x9F, 0x17, 0x0A, 0xB8,
-    0x19, 0x0C, 0xD7, 0x19, 0x0F, 0x07, 0x1A, 0x13, 0x14, 0x1A, 0x15, 0x21, 0x1A, 0x19, 0x40, 0x1A,
-    0x00, 0x49, 0x68, 0x17, 0x0C, 0x74, 0x17, 0x00, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x85, 0x6F, 0x72,
-    0x6E, 0x69, 0x61, 0x00, 0x0F, 0x04, 0x06, 0x00, 0x85, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00,
-    0x49, 0x87, 0x17, 0x0C, 0x93, 0x17, 0x00, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x85, 0x6F, 0x72, 0x6E,
-    0x69, 0x61, 0x00, 0x0F, 0x04, 0x06, 0x00, 0x85, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x46,
-    0xBE, 0x17, 0x07, 0xCB, 0x17, 0x0A, 0xD8, 0x17, 0x0C, 0xE5, 0x17, 0x0E, 0x22, 0x19, 0x0F, 0x41,
-    0x19, 0x12, 0x60, 0x19, 0x15, 0x7F, 0x19, 0x18, 0x8C, 0x19, 0x19, 0xAB, 0x19, 0x00, 0x0C, 0x0F,
-    0x04, 0x06, 0x00, 0x86, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x0C, 0x0F, 0x04, 0x06, 0x00,
-    0x86, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x86, 0x66, 0x6F,
-    0x72, 0x6E, 0x69, 0x61, 0x00, 0x44, 0xF5, 0x17, 0x0E, 0x13, 0x18, 0x0F, 0x32, 0x18, 0x12, 0xF6,
-    0x18, 0x18, 0x15, 0x19, 0x00, 0x46, 0xFC, 0x17, 0x0F, 0x06, 0x18, 0x00, 0x86, 0x6C, 0x69, 0x66,
-    0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x06, 0x00, 0x88, 0x61, 0x6C, 0x69, 0x66, 0x6F, 0x72, 0x6E,
-    0x69, 0x61, 0x00, 0x44, 0x1A, 0x18, 0x0F, 0x26, 0x18, 0x00, 0x06, 0x00, 0x87, 0x6C, 0x69, 0x66,
-    0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x04, 0x06, 0x00, 0x87, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69,
-    0x61, 0x00, 0x44, 0x4B, 0x18, 0x06, 0x59, 0x18, 0x0E, 0x64, 0x18, 0x12, 0x71, 0x18, 0x14, 0x7E,
-    0x18, 0x16, 0x9C, 0x18, 0x1A, 0xBA, 0x18, 0x1D, 0xD8, 0x18, 0x00, 0x2C, 0x00, 0x88, 0x63, 0x61,
-    0x6C, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x87, 0x61, 0x6C, 0x69, 0x66, 0x6F, 0x72,
-    0x6E, 0x69, 0x61, 0x00, 0x04, 0x06, 0x00, 0x88, 0x6C, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61,
-    0x00, 0x04, 0x06, 0x00, 0x88, 0x6C, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x44, 0x85,
-    0x18, 0x06, 0x91, 0x18, 0x00, 0x06, 0x00, 0x88, 0x6C, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61,
-    0x00, 0x88, 0x61, 0x6C, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x44, 0xA3, 0x18, 0x06,
-    0xAF, 0x18, 0x00, 0x06, 0x00, 0x88, 0x6C, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x88,
-    0x61, 0x6C, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x44, 0xC1, 0x18, 0x06, 0xCD, 0x18,
-    0x00, 0x06, 0x00, 0x88, 0x6C, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x88, 0x61, 0x6C,
-    0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x44, 0xDF, 0x18, 0x06, 0xEB, 0x18, 0x00, 0x06,
-    0x00, 0x88, 0x6C, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x88, 0x61, 0x6C, 0x69, 0x66,
-    0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x44, 0xFD, 0x18, 0x0F, 0x09, 0x19, 0x00, 0x06, 0x00, 0x87,
-    0x6C, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x04, 0x06, 0x00, 0x87, 0x69, 0x66, 0x6F,
-    0x72, 0x6E, 0x69, 0x61, 0x00, 0x0F, 0x04, 0x06, 0x00, 0x87, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69,
-    0x61, 0x00, 0x4C, 0x29, 0x19, 0x0F, 0x35, 0x19, 0x00, 0x0F, 0x04, 0x06, 0x00, 0x86, 0x66, 0x6F,
-    0x72, 0x6E, 0x69, 0x61, 0x00, 0x04, 0x06, 0x00, 0x86, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61,
-    0x00, 0x44, 0x48, 0x19, 0x0C, 0x53, 0x19, 0x00, 0x06, 0x00, 0x85, 0x69, 0x66, 0x6F, 0x72, 0x6E,
-    0x69, 0x61, 0x00, 0x04, 0x06, 0x00, 0x87, 0x6C, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00,
-    0x4C, 0x67, 0x19, 0x0F, 0x73, 0x19, 0x00, 0x0F, 0x04, 0x06, 0x00, 0x86, 0x66, 0x6F, 0x72, 0x6E,
-    0x69, 0x61, 0x00, 0x04, 0x06, 0x00, 0x86, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x0C,
-    0x0F, 0x04, 0x06, 0x00, 0x86, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x4C, 0x93, 0x19, 0x0F,
-    0x9F, 0x19, 0x00, 0x0F, 0x04, 0x06, 0x00, 0x86, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x04,
-    0x06, 0x00, 0x86, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x0C, 0x0F, 0x04, 0x06, 0x00,
-    0x86, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x49, 0xBF, 0x19, 0x0C, 0xCB, 0x19, 0x00, 0x0C,
-    0x0F, 0x04, 0x06, 0x00, 0x85, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x0F, 0x04, 0x06, 0x00, 0x85,
-    0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x49, 0xDE, 0x19, 0x0F, 0xFC, 0x19, 0x00, 0x4C, 0xE5,
-    0x19, 0x0F, 0xF0, 0x19, 0x00, 0x0F, 0x04, 0x06, 0x00, 0x85, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00,
-    0x04, 0x06, 0x00, 0x86, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x04, 0x06, 0x00, 0x84,
-    0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x85, 0x6F, 0x72,
-    0x6E, 0x69, 0x61, 0x00, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x85, 0x6F, 0x72, 0x6E, 0x69, 0x61,
-    0x00, 0x49, 0x28, 0x1A, 0x0C, 0x34, 0x1A, 0x00, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x85, 0x6F, 0x72,
-    0x6E, 0x69, 0x61, 0x00, 0x0F, 0x04, 0x06, 0x00, 0x85, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00,
-    0x49, 0x47, 0x1A, 0x0C, 0x53, 0x1A, 0x00, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x85, 0x6F, 0x72, 0x6E,
-    0x69, 0x61, 0x00, 0x0F, 0x04, 0x06, 0x00, 0x85, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x49,
-    0x66, 0x1A, 0x12, 0x72, 0x1A, 0x00, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x84, 0x6F, 0x72, 0x6E, 0x69,
-    0x61, 0x00, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x84, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x12, 0x09,
-    0x0C, 0x0F, 0x04, 0x06, 0x00, 0x84, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x52, 0x92, 0x1A, 0x15, 0x9E,
-    0x1A, 0x00, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x83, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x12, 0x09,
-    0x0C, 0x0F, 0x04, 0x06, 0x00, 0x83, 0x6E, 0x69, 0x61, 0x00, 0x11, 0x15, 0x12, 0x09, 0x0C, 0x0F,
-    0x04, 0x06, 0x00, 0x82, 0x69, 0x61, 0x00, 0x51, 0xBE, 0x1A, 0x12, 0xCB, 0x1A, 0x00, 0x12, 0x09,
-    0x0C, 0x0F, 0x04, 0x06, 0x00, 0x83, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x09, 0x0C, 0x0F, 0x04, 0x06,
-    0x00, 0x81, 0x6E, 0x69, 0x61, 0x00, 0x11, 0x15, 0x12, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x82,
-    0x69, 0x61, 0x00, 0x11, 0x15, 0x12, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x81, 0x69, 0x61, 0x00,
-    0x4C, 0xF7, 0x1A, 0x15, 0x04, 0x1B, 0x00, 0x15, 0x12, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x82,
-    0x6E, 0x69, 0x61, 0x00, 0x12, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x80, 0x69, 0x61, 0x00, 0x11,
-    0x15, 0x12, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x81, 0x69, 0x61, 0x00, 0x74, 0x29, 0x1B, 0x08,
-    0x2E, 0x1B, 0x0C, 0x33, 0x1B, 0x15, 0x38, 0x1B, 0x00, 0x17, 0x0C, 0x00, 0x80, 0x00, 0x12, 0x07,
-    0x00, 0x80, 0x00, 0x0B, 0x17, 0x00, 0x80, 0x00, 0x04, 0x08, 0x1C, 0x00, 0x80, 0x00, 0x11, 0x15,
-    0x12, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x81, 0x69, 0x61, 0x00, 0x04, 0x1A, 0x0F, 0x04, 0x00,
-    0x80, 0x73, 0x00, 0x46, 0x63, 0x1B, 0x0A, 0x76, 0x1B, 0x0B, 0x88, 0x1B, 0x0F, 0xBD, 0x1B, 0x11,
-    0xC7, 0x1B, 0x00, 0x4C, 0x6A, 0x1B, 0x17, 0x70, 0x1B, 0x00, 0x0B, 0x1A, 0x00, 0x80, 0x68, 0x00,
-    0x0C, 0x05, 0x00, 0x80, 0x68, 0x00, 0x11, 0x0C, 0x00, 0x48, 0x80, 0x1B, 0x12, 0x84, 0x1B, 0x00,
-    0x05, 0x00, 0x80, 0x00, 0x0A, 0x00, 0x80, 0x00, 0x46, 0x8F, 0x1B, 0x17, 0xAE, 0x1B, 0x00, 0x4C,
-    0x99, 0x1B, 0x17, 0x9E, 0x1B, 0x18, 0xA3, 0x1B, 0x00, 0x0B, 0x1A, 0x00, 0x80, 0x00, 0x0C, 0x05,
-    0x00, 0x80, 0x00, 0x50, 0xAA, 0x1B, 0x16, 0xAC, 0x1B, 0x00, 0x80, 0x00, 0x80, 0x00, 0x4C, 0xB5,
-    0x1B, 0x12, 0xB9, 0x1B, 0x00, 0x1A, 0x00, 0x80, 0x00, 0x05, 0x00, 0x80, 0x00, 0x04, 0x05, 0x12,
-    0x15, 0x13, 0x00, 0x81, 0x62, 0x6C, 0x00, 0x44, 0xD1, 0x1B, 0x08, 0xD6, 0x1B, 0x0C, 0xEC, 0x1B,
-    0x00, 0x0B, 0x17, 0x00, 0x80, 0x00, 0x48, 0xDD, 0x1B, 0x0B, 0xE1, 0x1B, 0x00, 0x05, 0x00, 0x80,
-    0x00, 0x57, 0xE8, 0x1B, 0x1A, 0xEA, 0x1B, 0x00, 0x80, 0x00, 0x80, 0x00, 0x48, 0xF3, 0x1B, 0x12,
-    0xF8, 0x1B, 0x00, 0x05, 0x00, 0x80, 0x67, 0x00, 0x0A, 0x00, 0x80, 0x67, 0x00, 0x47, 0x19, 0x1C,
-    0x0B, 0x6B, 0x1C, 0x0C, 0x80, 0x1C, 0x0E, 0x30, 0x1E, 0x0F, 0x45, 0x1E, 0x11, 0x61, 0x1E, 0x16,
-    0x68, 0x1E, 0x17, 0x71, 0x1E, 0x18, 0x79, 0x1E, 0x00, 0x48, 0x29, 0x1C, 0x0C, 0x38, 0x1C, 0x0F,
-    0x3D, 0x1C, 0x11, 0x56, 0x1C, 0x12, 0x66, 0x1C, 0x00, 0x48, 0x30, 0x1C, 0x16, 0x34, 0x1C, 0x00,
-    0x11, 0x00, 0x80, 0x00, 0x18, 0x00, 0x80, 0x00, 0x04, 0x16, 0x00, 0x80, 0x00, 0x55, 0x44, 0x1C,
-    0x18, 0x49, 0x1C, 0x00, 0x12, 0x1A, 0x00, 0x80, 0x00, 0x12, 0x00, 0x46, 0x52, 0x1C, 0x1A, 0x54,
-    0x1C, 0x00, 0x80, 0x00, 0x80, 0x00, 0x4C, 0x5D, 0x1C, 0x18, 0x61, 0x1C, 0x00, 0x09, 0x00, 0x80,
-    0x00, 0x12, 0x16, 0x00, 0x80, 0x00, 0x12, 0x0A, 0x00, 0x80, 0x00, 0x4C, 0x72, 0x1C, 0x17, 0x79,
-    0x1C, 0x00, 0x0B, 0x1A, 0x00, 0x81, 0x63, 0x68, 0x00, 0x0C, 0x05, 0x00, 0x81, 0x63, 0x68, 0x00,
-    0x44, 0x9C, 0x1C, 0x07, 0xBD, 0x1C, 0x08, 0xD2, 0x1C, 0x0E, 0xE7, 0x1C, 0x12, 0xEF, 0x1C, 0x16,
-    0xF7, 0x1C, 0x18, 0xFE, 0x1D, 0x1A, 0x06, 0x1E, 0x1B, 0x1B, 0x1E, 0x00, 0x44, 0xA3, 0x1C, 0x16,
-    0xAA, 0x1C, 0x00, 0x05, 0x00, 0x82, 0x73, 0x69, 0x63, 0x00, 0x44, 0xB1, 0x1C, 0x05, 0xB7, 0x1C,
-    0x00, 0x05, 0x00, 0x82, 0x69, 0x63, 0x00, 0x83, 0x61, 0x73, 0x69, 0x63, 0x00, 0x44, 0xC4, 0x1C,
-    0x16, 0xCB, 0x1C, 0x00, 0x05, 0x00, 0x82, 0x73, 0x69, 0x63, 0x00, 0x04, 0x05, 0x00, 0x82, 0x69,
-    0x63, 0x00, 0x44, 0xD9, 0x1C, 0x16, 0xE0, 0x1C, 0x00, 0x05, 0x00, 0x82, 0x73, 0x69, 0x63, 0x00,
-    0x04, 0x05, 0x00, 0x82, 0x69, 0x63, 0x00, 0x16, 0x04, 0x05, 0x00, 0x82, 0x69, 0x63, 0x00, 0x16,
-    0x04, 0x05, 0x00, 0x82, 0x69, 0x63, 0x00, 0x44, 0x13, 0x1D, 0x05, 0x8E, 0x1D, 0x07, 0x97, 0x1D,
-    0x08, 0x9F, 0x1D, 0x14, 0xA7, 0x1D, 0x16, 0xBB, 0x1D, 0x1A, 0xCE, 0x1D, 0x1B, 0xE2, 0x1D, 0x1D,
-    0xEA, 0x1D, 0x00, 0x44, 0x2C, 0x1D, 0x05, 0x33, 0x1D, 0x0A, 0x5E, 0x1D, 0x0B, 0x65, 0x1D, 0x14,
-    0x6E, 0x1D, 0x16, 0x76, 0x1D, 0x1A, 0x7E, 0x1D, 0x1D, 0x86, 0x1D, 0x00, 0x05, 0x00, 0x83, 0x73,
-    0x69, 0x63, 0x00, 0x4A, 0x40, 0x1D, 0x0B, 0x47, 0x1D, 0x11, 0x4E, 0x1D, 0x19, 0x57, 0x1D, 0x00,
-    0x85, 0x62, 0x61, 0x73, 0x69, 0x63, 0x00, 0x85, 0x62, 0x61, 0x73, 0x69, 0x63, 0x00, 0x2C, 0x00,
-    0x85, 0x62, 0x61, 0x73, 0x69, 0x63, 0x00, 0x85, 0x62, 0x61, 0x73, 0x69, 0x63, 0x00, 0x84, 0x62,
-    0x61, 0x73, 0x69, 0x63, 0x00, 0x2C, 0x00, 0x84, 0x62, 0x61, 0x73, 0x69, 0x63, 0x00, 0x05, 0x00,
-    0x84, 0x61, 0x73, 0x69, 0x63, 0x00, 0x05, 0x00, 0x84, 0x61, 0x73, 0x69, 0x63, 0x00, 0x05, 0x00,
-    0x84, 0x61, 0x73, 0x69, 0x63, 0x00, 0x05, 0x00, 0x84, 0x61, 0x73, 0x69, 0x63, 0x00, 0x04, 0x00,
-    0x84, 0x62, 0x61, 0x73, 0x69, 0x63, 0x00, 0x04, 0x05, 0x00, 0x83, 0x73, 0x69, 0x63, 0x00, 0x04,
-    0x05, 0x00, 0x83, 0x73, 0x69, 0x63, 0x00, 0x44, 0xAE, 0x1D, 0x05, 0xB5, 0x1D, 0x00, 0x05, 0x00,
-    0x83, 0x73, 0x69, 0x63, 0x00, 0x83, 0x61, 0x73, 0x69, 0x63, 0x00, 0x44, 0xC2, 0x1D, 0x05, 0xC8,
-    0x1D, 0x00, 0x05, 0x00, 0x82, 0x69, 0x63, 0x00, 0x83, 0x61, 0x73, 0x69, 0x63, 0x00, 0x44, 0xD5,
-    0x1D, 0x05, 0xDC, 0x1D, 0x00, 0x05, 0x00, 0x83, 0x73, 0x69, 0x63, 0x00, 0x83, 0x61, 0x73, 0x69,
-    0x63, 0x00, 0x04, 0x05, 0x00, 0x83, 0x73, 0x69, 0x63, 0x00, 0x44, 0xF1, 0x1D, 0x05, 0xF8, 0x1D,
-    0x00, 0x05, 0x00, 0x83, 0x73, 0x69, 0x63, 0x00, 0x83, 0x61, 0x73, 0x69, 0x63, 0x00, 0x16, 0x04,
-    0x05, 0x00, 0x82, 0x69, 0x63, 0x00, 0x44, 0x0D, 0x1E, 0x16, 0x14, 0x1E, 0x00, 0x05, 0x00, 0x82,
-    0x73, 0x69, 0x63, 0x00, 0x04, 0x05, 0x00, 0x82, 0x69, 0x63, 0x00, 0x44, 0x22, 0x1E, 0x16, 0x29,
-    0x1E, 0x00, 0x05, 0x00, 0x82, 0x73, 0x69, 0x63, 0x00, 0x04, 0x05, 0x00, 0x82, 0x69, 0x63, 0x00,
-    0x4C, 0x37, 0x1E, 0x16, 0x3E, 0x1E, 0x00, 0x16, 0x04, 0x05, 0x00, 0x81, 0x63, 0x00, 0x04, 0x05,
-    0x00, 0x81, 0x69, 0x63, 0x00, 0x55, 0x4C, 0x1E, 0x18, 0x52, 0x1E, 0x00, 0x12, 0x1A, 0x00, 0x80,
-    0x64, 0x00, 0x12, 0x00, 0x46, 0x5B, 0x1E, 0x1A, 0x5E, 0x1E, 0x00, 0x80, 0x64, 0x00, 0x80, 0x64,
-    0x00, 0x18, 0x12, 0x16, 0x00, 0x80, 0x64, 0x00, 0x0C, 0x04, 0x05, 0x00, 0x82, 0x73, 0x69, 0x63,
-    0x00, 0x04, 0x1B, 0x08, 0x00, 0x81, 0x63, 0x74, 0x00, 0x4C, 0x80, 0x1E, 0x16, 0x87, 0x1E, 0x00,
-    0x16, 0x04, 0x05, 0x00, 0x81, 0x63, 0x00, 0x04, 0x05, 0x00, 0x81, 0x69, 0x63, 0x00, 0x44, 0xD4,
-    0x1E, 0x05, 0xEF, 0x1E, 0x06, 0x1B, 0x1F, 0x07, 0x5F, 0x1F, 0x08, 0x70, 0x1F, 0x09, 0x5B, 0x21,
-    0x0A, 0x98, 0x21, 0x0B, 0xA0, 0x21, 0x0C, 0xCC, 0x21, 0x0D, 0x9B, 0x22, 0x0E, 0xC7, 0x22, 0x0F,
-    0x01, 0x23, 0x10, 0x59, 0x28, 0x11, 0x85, 0x28, 0x12, 0x28, 0x2C, 0x13, 0x1E, 0x2D, 0x15, 0x25,
-    0x2D, 0x16, 0xC7, 0x30, 0x17, 0x1B, 0x31, 0x18, 0x32, 0x31, 0x1A, 0x8A, 0x31, 0x1B, 0x9D, 0x31,
-    0x1C, 0xCD, 0x31, 0x00, 0x52, 0xDB, 0x1E, 0x15, 0xE4, 0x1E, 0x00, 0x05, 0x1C, 0x08, 0x0E, 0x00,
-    0x80, 0x72, 0x64, 0x00, 0x12, 0x05, 0x1C, 0x08, 0x0E, 0x00, 0x82, 0x61, 0x72, 0x64, 0x00, 0x51,
-    0xF6, 0x1E, 0x18, 0x08, 0x1F, 0x00, 0x4C, 0xFD, 0x1E, 0x18, 0x02, 0x1F, 0x00, 0x09, 0x00, 0x81,
-    0x64, 0x00, 0x12, 0x16, 0x00, 0x81, 0x64, 0x00, 0x12, 0x00, 0x55, 0x11, 0x1F, 0x16, 0x17, 0x1F,
-    0x00, 0x04, 0x00, 0x81, 0x6E, 0x64, 0x00, 0x81, 0x6E, 0x64, 0x00, 0x48, 0x28, 0x1F, 0x0C, 0x39,
-    0x1F, 0x11, 0x4A, 0x1F, 0x12, 0x59, 0x1F, 0x00, 0x48, 0x2F, 0x1F, 0x16, 0x34, 0x1F, 0x00, 0x11,
-    0x00, 0x81, 0x64, 0x00, 0x18, 0x00, 0x81, 0x64, 0x00, 0x44, 0x40, 0x1F, 0x16, 0x45, 0x1F, 0x00,
-    0x16, 0x00, 0x81, 0x64, 0x00, 0x04, 0x05, 0x00, 0x80, 0x00, 0x0C, 0x00, 0x49, 0x53, 0x1F, 0x16,
-    0x56, 0x1F, 0x00, 0x81, 0x64, 0x00, 0x80, 0x65, 0x00, 0x12, 0x0A, 0x00, 0x81, 0x64, 0x00, 0x08,
-    0x00, 0x48, 0x68, 0x1F, 0x16, 0x6C, 0x1F, 0x00, 0x11, 0x00, 0x80, 0x00, 0x18, 0x00, 0x80, 0x00,
-    0x44, 0x9E, 0x1F, 0x06, 0xB4, 0x1F, 0x07, 0xBA, 0x1F, 0x08, 0xD4, 0x1F, 0x0C, 0x4D, 0x20, 0x0E,
-    0x53, 0x20, 0x0F, 0x59, 0x20, 0x10, 0x5F, 0x20, 0x11, 0x6C, 0x20, 0x12, 0x83, 0x20, 0x15, 0x89,
-    0x20, 0x16, 0xB8, 0x20, 0x19, 0x3A, 0x21, 0x1A, 0x40, 0x21, 0x1B, 0x54, 0x21, 0x00, 0x52, 0xA5,
-    0x1F, 0x16, 0xAE, 0x1F, 0x00, 0x05, 0x1C, 0x08, 0x0E, 0x00, 0x81, 0x72, 0x64, 0x00, 0x18, 0x00,
-    0x82, 0x65, 0x64, 0x00, 0x11, 0x0C, 0x16, 0x00, 0x80, 0x00, 0x44, 0xC4, 0x1F, 0x08, 0xC8, 0x1F,
-    0x16, 0xCE, 0x1F, 0x00, 0x10, 0x00, 0x80, 0x00, 0x11, 0x00, 0x82, 0x65, 0x64, 0x00, 0x18, 0x00,
-    0x82, 0x65, 0x64, 0x00, 0x45, 0xF3, 0x1F, 0x07, 0xFA, 0x1F, 0x08, 0x02, 0x20, 0x0B, 0x07, 0x20,
-    0x0D, 0x0F, 0x20, 0x10, 0x16, 0x20, 0x11, 0x1D, 0x20, 0x15, 0x39, 0x20, 0x16, 0x40, 0x20, 0x1A,
-    0x45, 0x20, 0x00, 0x11, 0x00, 0x83, 0x65, 0x65, 0x64, 0x00, 0x11, 0x2C, 0x00, 0x83, 0x65, 0x65,
-    0x64, 0x00, 0x11, 0x00, 0x81, 0x64, 0x00, 0x11, 0x2C, 0x00, 0x83, 0x65, 0x65, 0x64, 0x00, 0x11,
-    0x00, 0x83, 0x65, 0x65, 0x64, 0x00, 0x11, 0x00, 0x83, 0x65, 0x65, 0x64, 0x00, 0x45, 0x27, 0x20,
-    0x0D, 0x2D, 0x20, 0x10, 0x33, 0x20, 0x00, 0x84, 0x6E, 0x65, 0x65, 0x64, 0x00, 0x84, 0x6E, 0x65,
-    0x65, 0x64, 0x00, 0x84, 0x6E, 0x65, 0x65, 0x64, 0x00, 0x11, 0x00, 0x83, 0x65, 0x65, 0x64, 0x00,
-    0x18, 0x00, 0x81, 0x64, 0x00, 0x11, 0x2C, 0x00, 0x83, 0x65, 0x65, 0x64, 0x00, 0x04, 0x16, 0x00,
-    0x81, 0x64, 0x00, 0x0C, 0x0F, 0x2C, 0x00, 0x80, 0x00, 0x0C, 0x0B, 0x1A, 0x00, 0x80, 0x00, 0x04,
-    0x00, 0x4A, 0x68, 0x20, 0x16, 0x6A, 0x20, 0x00, 0x80, 0x00, 0x80, 0x00, 0x52, 0x73, 0x20, 0x18,
-    0x7D, 0x20, 0x00, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x80, 0x73, 0x00, 0x12, 0x16, 0x00,
-    0x81, 0x64, 0x00, 0x12, 0x0A, 0x00, 0x81, 0x64, 0x00, 0x48, 0x96, 0x20, 0x0B, 0xA7, 0x20, 0x12,
-    0xAD, 0x20, 0x16, 0xB2, 0x20, 0x00, 0x51, 0x9D, 0x20, 0x1A, 0xA3, 0x20, 0x00, 0x2C, 0x00, 0x82,
-    0x65, 0x64, 0x00, 0x2C, 0x00, 0x80, 0x00, 0x17, 0x2C, 0x00, 0x80, 0x65, 0x00, 0x10, 0x2C, 0x00,
-    0x80, 0x00, 0x18, 0x00, 0x82, 0x65, 0x64, 0x00, 0x44, 0xD7, 0x20, 0x07, 0xDE, 0x20, 0x08, 0xE5,
-    0x20, 0x0C, 0xF5, 0x20, 0x0D, 0xFD, 0x20, 0x12, 0x04, 0x21, 0x18, 0x09, 0x21, 0x1A, 0x25, 0x21,
-    0x1B, 0x2C, 0x21, 0x1C, 0x33, 0x21, 0x00, 0x18, 0x00, 0x83, 0x73, 0x65, 0x64, 0x00, 0x18, 0x00,
-    0x83, 0x73, 0x65, 0x64, 0x00, 0x4B, 0xEC, 0x20, 0x18, 0xF0, 0x20, 0x00, 0x17, 0x00, 0x80, 0x00,
-    0x83, 0x73, 0x65, 0x64, 0x00, 0x18, 0x2C, 0x00, 0x83, 0x73, 0x65, 0x64, 0x00, 0x18, 0x00, 0x83,
-    0x73, 0x65, 0x64, 0x00, 0x0B, 0x17, 0x00, 0x80, 0x00, 0x4C, 0x13, 0x21, 0x0D, 0x19, 0x21, 0x1C,
-    0x1F, 0x21, 0x00, 0x84, 0x75, 0x73, 0x65, 0x64, 0x00, 0x84, 0x75, 0x73, 0x65, 0x64, 0x00, 0x84,
-    0x75, 0x73, 0x65, 0x64, 0x00, 0x18, 0x00, 0x83, 0x73, 0x65, 0x64, 0x00, 0x18, 0x00, 0x83, 0x73,
-    0x65, 0x64, 0x00, 0x18, 0x00, 0x83, 0x73, 0x65, 0x64, 0x00, 0x04, 0x0B, 0x2C, 0x00, 0x80, 0x00,
-    0x48, 0x47, 0x21, 0x16, 0x4E, 0x21, 0x00, 0x11, 0x2C, 0x00, 0x82, 0x65, 0x64, 0x00, 0x18, 0x00,
-    0x82, 0x65, 0x64, 0x00, 0x16, 0x18, 0x00, 0x82, 0x65, 0x64, 0x00, 0x44, 0x6B, 0x21, 0x08, 0x75,
-    0x21, 0x0C, 0x86, 0x21, 0x11, 0x8C, 0x21, 0x12, 0x92, 0x21, 0x00, 0x12, 0x05, 0x1C, 0x08, 0x0E,
-    0x00, 0x81, 0x72, 0x64, 0x00, 0x48, 0x7C, 0x21, 0x16, 0x81, 0x21, 0x00, 0x11, 0x00, 0x81, 0x64,
-    0x00, 0x18, 0x00, 0x81, 0x64, 0x00, 0x04, 0x16, 0x00, 0x81, 0x64, 0x00, 0x0C, 0x09, 0x00, 0x81,
-    0x64, 0x00, 0x12, 0x0A, 0x00, 0x81, 0x64, 0x00, 0x11, 0x0C, 0x0B, 0x17, 0x00, 0x80, 0x73, 0x00,
-    0x51, 0xA7, 0x21, 0x18, 0xB9, 0x21, 0x00, 0x4C, 0xAE, 0x21, 0x18, 0xB3, 0x21, 0x00, 0x09, 0x00,
-    0x81, 0x64, 0x00, 0x12, 0x16, 0x00, 0x81, 0x64, 0x00, 0x12, 0x00, 0x55, 0xC2, 0x21, 0x16, 0xC8,
-    0x21, 0x00, 0x04, 0x00, 0x81, 0x6E, 0x64, 0x00, 0x81, 0x6E, 0x64, 0x00, 0x44, 0xE5, 0x21, 0x0E,
-    0x5E, 0x22, 0x12, 0x66, 0x22, 0x14, 0x78, 0x22, 0x16, 0x7F, 0x22, 0x18, 0x86, 0x22, 0x1A, 0x8D,
-    0x22, 0x1D, 0x94, 0x22, 0x00, 0x44, 0xFE, 0x21, 0x07, 0x04, 0x22, 0x08, 0x0B, 0x22, 0x14, 0x12,
-    0x22, 0x16, 0x19, 0x22, 0x1A, 0x49, 0x22, 0x1B, 0x50, 0x22, 0x1D, 0x57, 0x22, 0x00, 0x16, 0x00,
-    0x82, 0x69, 0x64, 0x00, 0x16, 0x00, 0x83, 0x61, 0x69, 0x64, 0x00, 0x16, 0x00, 0x83, 0x61, 0x69,
-    0x64, 0x00, 0x16, 0x00, 0x83, 0x61, 0x69, 0x64, 0x00, 0x44, 0x29, 0x22, 0x07, 0x2F, 0x22, 0x08,
-    0x35, 0x22, 0x1A, 0x3D, 0x22, 0x1B, 0x43, 0x22, 0x00, 0x84, 0x73, 0x61, 0x69, 0x64, 0x00, 0x84,
-    0x73, 0x61, 0x69, 0x64, 0x00, 0x2C, 0x00, 0x84, 0x73, 0x61, 0x69, 0x64, 0x00, 0x84, 0x73, 0x61,
-    0x69, 0x64, 0x00, 0x84, 0x73, 0x61, 0x69, 0x64, 0x00, 0x16, 0x00, 0x83, 0x61, 0x69, 0x64, 0x00,
-    0x16, 0x00, 0x83, 0x61, 0x69, 0x64, 0x00, 0x16, 0x00, 0x83, 0x61, 0x69, 0x64, 0x00, 0x04, 0x16,
-    0x2C, 0x00, 0x82, 0x69, 0x64, 0x00, 0x44, 0x6D, 0x22, 0x12, 0x73, 0x22, 0x00, 0x16, 0x00, 0x82,
-    0x69, 0x64, 0x00, 0x0A, 0x00, 0x81, 0x64, 0x00, 0x04, 0x16, 0x00, 0x82, 0x69, 0x64, 0x00, 0x04,
-    0x16, 0x00, 0x82, 0x69, 0x64, 0x00, 0x04, 0x16, 0x00, 0x82, 0x69, 0x64, 0x00, 0x04, 0x16, 0x00,
-    0x82, 0x69, 0x64, 0x00, 0x04, 0x16, 0x00, 0x82, 0x69, 0x64, 0x00, 0x51, 0xA2, 0x22, 0x18, 0xB4,
-    0x22, 0x00, 0x4C, 0xA9, 0x22, 0x18, 0xAE, 0x22, 0x00, 0x09, 0x00, 0x81, 0x64, 0x00, 0x12, 0x16,
-    0x00, 0x81, 0x64, 0x00, 0x12, 0x00, 0x55, 0xBD, 0x22, 0x16, 0xC3, 0x22, 0x00, 0x04, 0x00, 0x81,
-    0x6E, 0x64, 0x00, 0x81, 0x6E, 0x64, 0x00, 0x4C, 0xD1, 0x22, 0x0F, 0xD7, 0x22, 0x18, 0xE7, 0x22,
-    0x00, 0x04, 0x16, 0x00, 0x81, 0x64, 0x00, 0x18, 0x12, 0x00, 0x46, 0xE1, 0x22, 0x1A, 0xE4, 0x22,
-    0x00, 0x81, 0x64, 0x00, 0x81, 0x64, 0x00, 0x12, 0x00, 0x46, 0xF3, 0x22, 0x0B, 0xF7, 0x22, 0x1A,
-    0xFD, 0x22, 0x00, 0x81, 0x6C, 0x64, 0x00, 0x16, 0x00, 0x81, 0x6C, 0x64, 0x00, 0x81, 0x6C, 0x64,
-    0x00, 0x48, 0x20, 0x23, 0x09, 0x35, 0x23, 0x0C, 0x4A, 0x23, 0x0D, 0x8E, 0x23, 0x0E, 0xCA, 0x23,
-    0x12, 0xE5, 0x23, 0x15, 0x43, 0x24, 0x17, 0x33, 0x25, 0x18, 0x48, 0x25, 0x1C, 0x1D, 0x28, 0x00,
-    0x52, 0x27, 0x23, 0x15, 0x2E, 0x23, 0x00, 0x1A, 0x00, 0x82, 0x72, 0x6C, 0x64, 0x00, 0x12, 0x1A,
-    0x00, 0x82, 0x6C, 0x64, 0x00, 0x52, 0x3C, 0x23, 0x15, 0x43, 0x23, 0x00, 0x1A, 0x00, 0x82, 0x72,
-    0x6C, 0x64, 0x00, 0x12, 0x1A, 0x00, 0x82, 0x6C, 0x64, 0x00, 0x4B, 0x54, 0x23, 0x12, 0x59, 0x23,
-    0x18, 0x74, 0x23, 0x00, 0x1A, 0x00, 0x80, 0x65, 0x00, 0x46, 0x63, 0x23, 0x0B, 0x68, 0x23, 0x1A,
-    0x6F, 0x23, 0x00, 0x82, 0x75, 0x6C, 0x64, 0x00, 0x16, 0x00, 0x82, 0x75, 0x6C, 0x64, 0x00, 0x82,
-    0x75, 0x6C, 0x64, 0x00, 0x12, 0x00, 0x46, 0x80, 0x23, 0x0B, 0x84, 0x23, 0x1A, 0x8A, 0x23, 0x00,
-    0x82, 0x6C, 0x64, 0x00, 0x16, 0x00, 0x82, 0x6C, 0x64, 0x00, 0x82, 0x6C, 0x64, 0x00, 0x52, 0x95,
-    0x23, 0x18, 0xB0, 0x23, 0x00, 0x46, 0x9F, 0x23, 0x0B, 0xA4, 0x23, 0x1A, 0xAB, 0x23, 0x00, 0x82,
-    0x75, 0x6C, 0x64, 0x00, 0x16, 0x00, 0x82, 0x75, 0x6C, 0x64, 0x00, 0x82, 0x75, 0x6C, 0x64, 0x00,
-    0x12, 0x00, 0x46, 0xBC, 0x23, 0x0B, 0xC0, 0x23, 0x1A, 0xC6, 0x23, 0x00, 0x82, 0x6C, 0x64, 0x00,
-    0x16, 0x00, 0x82, 0x6C, 0x64, 0x00, 0x82, 0x6C, 0x64, 0x00, 0x18, 0x12, 0x00, 0x46, 0xD7, 0x23,
-    0x0B, 0xDB, 0x23, 0x1A, 0xE1, 0x23, 0x00, 0x82, 0x6C, 0x64, 0x00, 0x16, 0x00, 0x82, 0x6C, 0x64,
-    0x00, 0x82, 0x6C, 0x64, 0x00, 0x4B, 0xEF, 0x23, 0x15, 0xF7, 0x23, 0x18, 0x0A, 0x24, 0x00, 0x16,
-    0x2C, 0x00, 0x81, 0x75, 0x6C, 0x64, 0x00, 0x52, 0xFE, 0x23, 0x1A, 0x04, 0x24, 0x00, 0x1A, 0x00,
-    0x82, 0x6C, 0x64, 0x00, 0x83, 0x6F, 0x72, 0x6C, 0x64, 0x00, 0x46, 0x17, 0x24, 0x0B, 0x1D, 0x24,
-    0x12, 0x25, 0x24, 0x1A, 0x3D, 0x24, 0x00, 0x83, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x16, 0x00, 0x83,
-    0x6F, 0x75, 0x6C, 0x64, 0x00, 0x46, 0x2F, 0x24, 0x0B, 0x33, 0x24, 0x1A, 0x39, 0x24, 0x00, 0x82,
-    0x6C, 0x64, 0x00, 0x16, 0x00, 0x82, 0x6C, 0x64, 0x00, 0x82, 0x6C, 0x64, 0x00, 0x83, 0x6F, 0x75,
-    0x6C, 0x64, 0x00, 0x48, 0x5C, 0x24, 0x09, 0x64, 0x24, 0x0C, 0x6C, 0x24, 0x0F, 0x80, 0x24, 0x12,
-    0x94, 0x24, 0x13, 0x0E, 0x25, 0x17, 0x22, 0x25, 0x1A, 0x2A, 0x25, 0x00, 0x12, 0x1A, 0x00, 0x83,
-    0x72, 0x6C, 0x64, 0x00, 0x12, 0x1A, 0x00, 0x83, 0x72, 0x6C, 0x64, 0x00, 0x52, 0x73, 0x24, 0x1A,
-    0x7A, 0x24, 0x00, 0x1A, 0x00, 0x83, 0x72, 0x6C, 0x64, 0x00, 0x83, 0x6F, 0x72, 0x6C, 0x64, 0x00,
-    0x52, 0x87, 0x24, 0x1A, 0x8E, 0x24, 0x00, 0x1A, 0x00, 0x83, 0x72, 0x6C, 0x64, 0x00, 0x83, 0x6F,
-    0x72, 0x6C, 0x64, 0x00, 0x44, 0xAD, 0x24, 0x08, 0xB4, 0x24, 0x0C, 0xBB, 0x24, 0x0F, 0xC3, 0x24,
-    0x13, 0xCB, 0x24, 0x14, 0xD3, 0x24, 0x16, 0xDA, 0x24, 0x1A, 0xE1, 0x24, 0x00, 0x84, 0x77, 0x6F,
-    0x72, 0x6C, 0x64, 0x00, 0x84, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x00, 0x1A, 0x00, 0x84, 0x6F, 0x72,
-    0x6C, 0x64, 0x00, 0x1A, 0x00, 0x84, 0x6F, 0x72, 0x6C, 0x64, 0x00, 0x1A, 0x00, 0x84, 0x6F, 0x72,
-    0x6C, 0x64, 0x00, 0x84, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x00, 0x84, 0x77, 0x6F, 0x72, 0x6C, 0x64,
-    0x00, 0x44, 0xEE, 0x24, 0x08, 0xF7, 0x24, 0x14, 0x00, 0x25, 0x16, 0x07, 0x25, 0x00, 0x2C, 0x00,
-    0x85, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x00, 0x2C, 0x00, 0x85, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x00,
-    0x85, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x00, 0x85, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x00, 0x52, 0x15,
-    0x25, 0x1A, 0x1C, 0x25, 0x00, 0x1A, 0x00, 0x83, 0x72, 0x6C, 0x64, 0x00, 0x83, 0x6F, 0x72, 0x6C,
-    0x64, 0x00, 0x12, 0x1A, 0x00, 0x83, 0x72, 0x6C, 0x64, 0x00, 0x12, 0x00, 0x84, 0x77, 0x6F, 0x72,
-    0x6C, 0x64, 0x00, 0x52, 0x3A, 0x25, 0x15, 0x41, 0x25, 0x00, 0x1A, 0x00, 0x82, 0x72, 0x6C, 0x64,
-    0x00, 0x12, 0x1A, 0x00, 0x82, 0x6C, 0x64, 0x00, 0x46, 0x64, 0x25, 0x0B, 0x6D, 0x25, 0x0C, 0x83,
-    0x25, 0x0D, 0xBF, 0x25, 0x0F, 0xDC, 0x25, 0x12, 0x18, 0x26, 0x13, 0xBB, 0x27, 0x1A, 0xF7, 0x27,
-    0x1C, 0x00, 0x28, 0x00, 0x12, 0x00, 0x84, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x52, 0x74, 0x25,
-    0x16, 0x7D, 0x25, 0x00, 0x16, 0x00, 0x84, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x82, 0x6F, 0x75,
-    0x6C, 0x64, 0x00, 0x46, 0x90, 0x25, 0x0B, 0x96, 0x25, 0x12, 0x9E, 0x25, 0x1A, 0xB9, 0x25, 0x00,
-    0x83, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x16, 0x00, 0x83, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x46, 0xA8,
-    0x25, 0x0B, 0xAD, 0x25, 0x1A, 0xB4, 0x25, 0x00, 0x83, 0x75, 0x6C, 0x64, 0x00, 0x16, 0x00, 0x83,
-    0x75, 0x6C, 0x64, 0x00, 0x83, 0x75, 0x6C, 0x64, 0x00, 0x83, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x12,
-    0x00, 0x46, 0xCB, 0x25, 0x0B, 0xD0, 0x25, 0x1A, 0xD7, 0x25, 0x00, 0x83, 0x75, 0x6C, 0x64, 0x00,
-    0x16, 0x00, 0x83, 0x75, 0x6C, 0x64, 0x00, 0x83, 0x75, 0x6C, 0x64, 0x00, 0x46, 0xE9, 0x25, 0x0B,
-    0xEF, 0x25, 0x12, 0xF7, 0x25, 0x1A, 0x12, 0x26, 0x00, 0x83, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x16,
-    0x00, 0x83, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x46, 0x01, 0x26, 0x0B, 0x06, 0x26, 0x1A, 0x0D, 0x26,
-    0x00, 0x83, 0x75, 0x6C, 0x64, 0x00, 0x16, 0x00, 0x83, 0x75, 0x6C, 0x64, 0x00, 0x83, 0x75, 0x6C,
-    0x64, 0x00, 0x83, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x44, 0x4F, 0x26, 0x05, 0x56, 0x26, 0x06, 0x6C,
-    0x26, 0x07, 0x95, 0x26, 0x08, 0x9C, 0x26, 0x0A, 0xA3, 0x26, 0x0B, 0xB9, 0x26, 0x0C, 0xC3, 0x26,
-    0x0D, 0xE1, 0x26, 0x0F, 0xF7, 0x26, 0x11, 0x15, 0x27, 0x13, 0x2B, 0x27, 0x14, 0x49, 0x27, 0x16,
-    0x50, 0x27, 0x19, 0x6E, 0x27, 0x1A, 0x75, 0x27, 0x1B, 0x9E, 0x27, 0x1C, 0xA5, 0x27, 0x00, 0x84,
-    0x77, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x4B, 0x5D, 0x26, 0x16, 0x65, 0x26, 0x00, 0x16, 0x00, 0x84,
-    0x6F, 0x75, 0x6C, 0x64, 0x00, 0x84, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x47, 0x79, 0x26, 0x16,
-    0x80, 0x26, 0x19, 0x87, 0x26, 0x1B, 0x8E, 0x26, 0x00, 0x85, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x00,
-    0x85, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x85, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x85, 0x63,
-    0x6F, 0x75, 0x6C, 0x64, 0x00, 0x84, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x84, 0x77, 0x6F, 0x75,
-    0x6C, 0x64, 0x00, 0x4B, 0xAA, 0x26, 0x16, 0xB2, 0x26, 0x00, 0x16, 0x00, 0x84, 0x6F, 0x75, 0x6C,
-    0x64, 0x00, 0x84, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x2C, 0x00, 0x84, 0x73, 0x68, 0x6F, 0x75,
-    0x6C, 0x64, 0x00, 0x46, 0xCD, 0x26, 0x0B, 0xD3, 0x26, 0x1A, 0xDB, 0x26, 0x00, 0x84, 0x6F, 0x75,
-    0x6C, 0x64, 0x00, 0x16, 0x00, 0x84, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x84, 0x6F, 0x75, 0x6C, 0x64,
-    0x00, 0x4B, 0xE8, 0x26, 0x16, 0xF0, 0x26, 0x00, 0x16, 0x00, 0x84, 0x6F, 0x75, 0x6C, 0x64, 0x00,
-    0x84, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x46, 0x01, 0x27, 0x0B, 0x07, 0x27, 0x1A, 0x0F, 0x27,
-    0x00, 0x84, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x16, 0x00, 0x84, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x84,
-    0x6F, 0x75, 0x6C, 0x64, 0x00, 0x4B, 0x1C, 0x27, 0x16, 0x24, 0x27, 0x00, 0x16, 0x00, 0x84, 0x6F,
-    0x75, 0x6C, 0x64, 0x00, 0x84, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x46, 0x35, 0x27, 0x0B, 0x3B,
-    0x27, 0x1A, 0x43, 0x27, 0x00, 0x84, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x16, 0x00, 0x84, 0x6F, 0x75,
-    0x6C, 0x64, 0x00, 0x84, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x84, 0x77, 0x6F, 0x75, 0x6C, 0x64, 0x00,
-    0x46, 0x5A, 0x27, 0x0B, 0x60, 0x27, 0x1A, 0x68, 0x27, 0x00, 0x84, 0x6F, 0x75, 0x6C, 0x64, 0x00,
-    0x85, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x84, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x84, 0x63,
-    0x6F, 0x75, 0x6C, 0x64, 0x00, 0x44, 0x82, 0x27, 0x08, 0x89, 0x27, 0x14, 0x90, 0x27, 0x16, 0x97,
-    0x27, 0x00, 0x85, 0x77, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x85, 0x77, 0x6F, 0x75, 0x6C, 0x64, 0x00,
-    0x85, 0x77, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x85, 0x77, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x84, 0x63,
-    0x6F, 0x75, 0x6C, 0x64, 0x00, 0x4B, 0xAC, 0x27, 0x16, 0xB4, 0x27, 0x00, 0x16, 0x00, 0x84, 0x6F,
-    0x75, 0x6C, 0x64, 0x00, 0x84, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x46, 0xC8, 0x27, 0x0B, 0xCE,
-    0x27, 0x12, 0xD6, 0x27, 0x1A, 0xF1, 0x27, 0x00, 0x83, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x16, 0x00,
-    0x83, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x46, 0xE0, 0x27, 0x0B, 0xE5, 0x27, 0x1A, 0xEC, 0x27, 0x00,
-    0x83, 0x75, 0x6C, 0x64, 0x00, 0x16, 0x00, 0x83, 0x75, 0x6C, 0x64, 0x00, 0x83, 0x75, 0x6C, 0x64,
-    0x00, 0x83, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x12, 0x00, 0x84, 0x77, 0x6F, 0x75, 0x6C, 0x64, 0x00,
-    0x12, 0x00, 0x46, 0x0C, 0x28, 0x0B, 0x11, 0x28, 0x1A, 0x18, 0x28, 0x00, 0x83, 0x75, 0x6C, 0x64,
-    0x00, 0x16, 0x00, 0x83, 0x75, 0x6C, 0x64, 0x00, 0x83, 0x75, 0x6C, 0x64, 0x00, 0x52, 0x24, 0x28,
-    0x18, 0x3F, 0x28, 0x00, 0x46, 0x2E, 0x28, 0x0B, 0x33, 0x28, 0x1A, 0x3A, 0x28, 0x00, 0x82, 0x75,
-    0x6C, 0x64, 0x00, 0x16, 0x00, 0x82, 0x75, 0x6C, 0x64, 0x00, 0x82, 0x75, 0x6C, 0x64, 0x00, 0x12,
-    0x00, 0x46, 0x4B, 0x28, 0x0B, 0x4F, 0x28, 0x1A, 0x55, 0x28, 0x00, 0x82, 0x6C, 0x64, 0x00, 0x16,
-    0x00, 0x82, 0x6C, 0x64, 0x00, 0x82, 0x6C, 0x64, 0x00, 0x51, 0x60, 0x28, 0x18, 0x72, 0x28, 0x00,
-    0x4C, 0x67, 0x28, 0x18, 0x6C, 0x28, 0x00, 0x09, 0x00, 0x81, 0x64, 0x00, 0x12, 0x16, 0x00, 0x81,
-    0x64, 0x00, 0x12, 0x00, 0x55, 0x7B, 0x28, 0x16, 0x81, 0x28, 0x00, 0x04, 0x00, 0x81, 0x6E, 0x64,
-    0x00, 0x81, 0x6E, 0x64, 0x00, 0x45, 0xA1, 0x28, 0x0B, 0xC1, 0x28, 0x0C, 0xE1, 0x28, 0x0D, 0x72,
-    0x29, 0x0E, 0xA8, 0x29, 0x10, 0xAF, 0x29, 0x12, 0xCF, 0x29, 0x18, 0xF1, 0x29, 0x1C, 0xFB, 0x2B,
-    0x00, 0x4C, 0xA8, 0x28, 0x18, 0xAE, 0x28, 0x00, 0x09, 0x00, 0x82, 0x6E, 0x64, 0x00, 0x12, 0x00,
-    0x55, 0xB7, 0x28, 0x16, 0xBD, 0x28, 0x00, 0x04, 0x00, 0x82, 0x6E, 0x64, 0x00, 0x82, 0x6E, 0x64,
-    0x00, 0x4C, 0xC8, 0x28, 0x18, 0xCE, 0x28, 0x00, 0x09, 0x00, 0x82, 0x6E, 0x64, 0x00, 0x12, 0x00,
-    0x55, 0xD7, 0x28, 0x16, 0xDD, 0x28, 0x00, 0x04, 0x00, 0x82, 0x6E, 0x64, 0x00, 0x82, 0x6E, 0x64,
-    0x00, 0x46, 0xFA, 0x28, 0x07, 0x01, 0x29, 0x09, 0x08, 0x29, 0x0A, 0x38, 0x29, 0x12, 0x3F, 0x29,
-    0x15, 0x47, 0x29, 0x18, 0x4E, 0x29, 0x19, 0x6B, 0x29, 0x00, 0x09, 0x00, 0x83, 0x69, 0x6E, 0x64,
-    0x00, 0x09, 0x00, 0x83, 0x69, 0x6E, 0x64, 0x00, 0x46, 0x18, 0x29, 0x07, 0x1E, 0x29, 0x0A, 0x24,
-    0x29, 0x15, 0x2A, 0x29, 0x19, 0x32, 0x29, 0x00, 0x84, 0x66, 0x69, 0x6E, 0x64, 0x00, 0x84, 0x66,
-    0x69, 0x6E, 0x64, 0x00, 0x84, 0x66, 0x69, 0x6E, 0x64, 0x00, 0x2C, 0x00, 0x84, 0x66, 0x69, 0x6E,
-    0x64, 0x00, 0x84, 0x66, 0x69, 0x6E, 0x64, 0x00, 0x09, 0x00, 0x83, 0x69, 0x6E, 0x64, 0x00, 0x15,
-    0x04, 0x00, 0x82, 0x75, 0x6E, 0x64, 0x00, 0x09, 0x00, 0x83, 0x69, 0x6E, 0x64, 0x00, 0x49, 0x55,
-    0x29, 0x12, 0x5A, 0x29, 0x00, 0x83, 0x69, 0x6E, 0x64, 0x00, 0x55, 0x61, 0x29, 0x16, 0x67, 0x29,
-    0x00, 0x04, 0x00, 0x82, 0x6E, 0x64, 0x00, 0x82, 0x6E, 0x64, 0x00, 0x09, 0x00, 0x83, 0x69, 0x6E,
-    0x64, 0x00, 0x4C, 0x7C, 0x29, 0x12, 0x82, 0x29, 0x18, 0x95, 0x29, 0x00, 0x09, 0x00, 0x82, 0x6E,
-    0x64, 0x00, 0x55, 0x89, 0x29, 0x16, 0x90, 0x29, 0x00, 0x04, 0x00, 0x82, 0x75, 0x6E, 0x64, 0x00,
-    0x82, 0x75, 0x6E, 0x64, 0x00, 0x12, 0x00, 0x55, 0x9E, 0x29, 0x16, 0xA4, 0x29, 0x00, 0x04, 0x00,
-    0x82, 0x6E, 0x64, 0x00, 0x82, 0x6E, 0x64, 0x00, 0x0C, 0x09, 0x00, 0x82, 0x6E, 0x64, 0x00, 0x4C,
-    0xB6, 0x29, 0x18, 0xBC, 0x29, 0x00, 0x09, 0x00, 0x82, 0x6E, 0x64, 0x00, 0x12, 0x00, 0x55, 0xC5,
-    0x29, 0x16, 0xCB, 0x29, 0x00, 0x04, 0x00, 0x82, 0x6E, 0x64, 0x00, 0x82, 0x6E, 0x64, 0x00, 0x4C,
-    0xD6, 0x29, 0x18, 0xDC, 0x29, 0x00, 0x09, 0x00, 0x82, 0x6E, 0x64, 0x00, 0x55, 0xE3, 0x29, 0x16,
-    0xEB, 0x29, 0x00, 0x04, 0x00, 0x83, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x83, 0x6F, 0x75, 0x6E, 0x64,
-    0x00, 0x4C, 0x0A, 0x2A, 0x0D, 0x3C, 0x2A, 0x0F, 0x51, 0x2A, 0x12, 0x7C, 0x2A, 0x13, 0xA6, 0x2B,
-    0x15, 0xD3, 0x2B, 0x16, 0xDD, 0x2B, 0x1C, 0xE6, 0x2B, 0x00, 0x49, 0x17, 0x2A, 0x12, 0x1B, 0x2A,
-    0x15, 0x2E, 0x2A, 0x16, 0x36, 0x2A, 0x00, 0x82, 0x6E, 0x64, 0x00, 0x55, 0x22, 0x2A, 0x16, 0x29,
-    0x2A, 0x00, 0x04, 0x00, 0x83, 0x75, 0x6E, 0x64, 0x00, 0x83, 0x75, 0x6E, 0x64, 0x00, 0x04, 0x00,
-    0x83, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x83, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x12, 0x00, 0x55, 0x45,
-    0x2A, 0x16, 0x4C, 0x2A, 0x00, 0x04, 0x00, 0x83, 0x75, 0x6E, 0x64, 0x00, 0x83, 0x75, 0x6E, 0x64,
-    0x00, 0x52, 0x5B, 0x2A, 0x15, 0x6E, 0x2A, 0x16, 0x76, 0x2A, 0x00, 0x55, 0x62, 0x2A, 0x16, 0x69,
-    0x2A, 0x00, 0x04, 0x00, 0x83, 0x75, 0x6E, 0x64, 0x00, 0x83, 0x75, 0x6E, 0x64, 0x00, 0x04, 0x00,
-    0x83, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x83, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x44, 0x9B, 0x2A, 0x08,
-    0xB0, 0x2A, 0x09, 0xB7, 0x2A, 0x0C, 0xCD, 0x2A, 0x0F, 0xE2, 0x2A, 0x13, 0xF7, 0x2A, 0x15, 0x0E,
-    0x2B, 0x16, 0x61, 0x2B, 0x17, 0x96, 0x2B, 0x1B, 0x9F, 0x2B, 0x00, 0x55, 0xA2, 0x2A, 0x16, 0xAA,
-    0x2A, 0x00, 0x85, 0x61, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x84, 0x6F, 0x75, 0x6E, 0x64, 0x00,
-    0x84, 0x73, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x44, 0xBE, 0x2A, 0x15, 0xC5, 0x2A, 0x00, 0x84, 0x72,
-    0x6F, 0x75, 0x6E, 0x64, 0x00, 0x04, 0x00, 0x84, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x55, 0xD4, 0x2A,
-    0x16, 0xDC, 0x2A, 0x00, 0x04, 0x00, 0x84, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x84, 0x6F, 0x75, 0x6E,
-    0x64, 0x00, 0x55, 0xE9, 0x2A, 0x16, 0xF1, 0x2A, 0x00, 0x04, 0x00, 0x84, 0x6F, 0x75, 0x6E, 0x64,
-    0x00, 0x84, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x55, 0xFE, 0x2A, 0x16, 0x06, 0x2B, 0x00, 0x04, 0x00,
-    0x84, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x2C, 0x00, 0x84, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x48, 0x24,
-    0x2B, 0x09, 0x2D, 0x2B, 0x14, 0x36, 0x2B, 0x16, 0x3E, 0x2B, 0x17, 0x46, 0x2B, 0x1A, 0x4F, 0x2B,
-    0x1D, 0x59, 0x2B, 0x00, 0x04, 0x00, 0x85, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x04, 0x00, 0x85,
-    0x72, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x85, 0x61, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x85, 0x61,
-    0x72, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x04, 0x00, 0x85, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x2C,
-    0x00, 0x85, 0x61, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x85, 0x61, 0x72, 0x6F, 0x75, 0x6E, 0x64,
-    0x00, 0x44, 0x71, 0x2B, 0x07, 0x78, 0x2B, 0x08, 0x7F, 0x2B, 0x1A, 0x88, 0x2B, 0x1B, 0x8F, 0x2B,
-    0x00, 0x85, 0x73, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x85, 0x73, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x2C,
-    0x00, 0x85, 0x73, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x85, 0x73, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x85,
-    0x73, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x15, 0x04, 0x00, 0x84, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x84,
-    0x73, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x52, 0xB0, 0x2B, 0x15, 0xC3, 0x2B, 0x16, 0xCB, 0x2B, 0x00,
-    0x55, 0xB7, 0x2B, 0x16, 0xBE, 0x2B, 0x00, 0x04, 0x00, 0x83, 0x75, 0x6E, 0x64, 0x00, 0x83, 0x75,
-    0x6E, 0x64, 0x00, 0x04, 0x00, 0x83, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x2C, 0x00, 0x83, 0x6F, 0x75,
-    0x6E, 0x64, 0x00, 0x12, 0x04, 0x00, 0x84, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x12, 0x00, 0x84,
-    0x73, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x12, 0x00, 0x55, 0xEF, 0x2B, 0x16, 0xF6, 0x2B, 0x00, 0x04,
-    0x00, 0x83, 0x75, 0x6E, 0x64, 0x00, 0x83, 0x75, 0x6E, 0x64, 0x00, 0x52, 0x02, 0x2C, 0x18, 0x15,
-    0x2C, 0x00, 0x55, 0x09, 0x2C, 0x16, 0x10, 0x2C, 0x00, 0x04, 0x00, 0x82, 0x75, 0x6E, 0x64, 0x00,
-    0x82, 0x75, 0x6E, 0x64, 0x00, 0x12, 0x00, 0x55, 0x1E, 0x2C, 0x16, 0x24, 0x2C, 0x00, 0x04, 0x00,
-    0x82, 0x6E, 0x64, 0x00, 0x82, 0x6E, 0x64, 0x00, 0x4C, 0x3B, 0x2C, 0x0F, 0x4D, 0x2C, 0x12, 0x72,
-    0x2C, 0x13, 0xF5, 0x2C, 0x15, 0xFD, 0x2C, 0x18, 0x04, 0x2D, 0x00, 0x44, 0x42, 0x2C, 0x12, 0x47,
-    0x2C, 0x00, 0x16, 0x00, 0x81, 0x64, 0x00, 0x0A, 0x00, 0x82, 0x6F, 0x64, 0x00, 0x52, 0x57, 0x2C,
-    0x15, 0x5D, 0x2C, 0x18, 0x63, 0x2C, 0x00, 0x0A, 0x00, 0x82, 0x6F, 0x64, 0x00, 0x12, 0x1A, 0x00,
-    0x81, 0x64, 0x00, 0x12, 0x00, 0x46, 0x6C, 0x2C, 0x1A, 0x6F, 0x2C, 0x00, 0x81, 0x64, 0x00, 0x81,
-    0x64, 0x00, 0x45, 0x8E, 0x2C, 0x09, 0x95, 0x2C, 0x0A, 0x9C, 0x2C, 0x0B, 0xCA, 0x2C, 0x0C, 0xD2,
-    0x2C, 0x0F, 0xD9, 0x2C, 0x13, 0xE0, 0x2C, 0x17, 0xE7, 0x2C, 0x19, 0xEE, 0x2C, 0x00, 0x0A, 0x00,
-    0x83, 0x6F, 0x6F, 0x64, 0x00, 0x0A, 0x00, 0x83, 0x6F, 0x6F, 0x64, 0x00, 0x45, 0xAC, 0x2C, 0x09,
-    0xB2, 0x2C, 0x0B, 0xB8, 0x2C, 0x17, 0xBE, 0x2C, 0x19, 0xC4, 0x2C, 0x00, 0x84, 0x67, 0x6F, 0x6F,
-    0x64, 0x00, 0x84, 0x67, 0x6F, 0x6F, 0x64, 0x00, 0x84, 0x67, 0x6F, 0x6F, 0x64, 0x00, 0x84, 0x67,
-    0x6F, 0x6F, 0x64, 0x00, 0x84, 0x67, 0x6F, 0x6F, 0x64, 0x00, 0x0A, 0x2C, 0x00, 0x83, 0x6F, 0x6F,
-    0x64, 0x00, 0x0A, 0x00, 0x83, 0x6F, 0x6F, 0x64, 0x00, 0x0A, 0x00, 0x83, 0x6F, 0x6F, 0x64, 0x00,
-    0x0A, 0x00, 0x83, 0x6F, 0x6F, 0x64, 0x00, 0x0A, 0x00, 0x83, 0x6F, 0x6F, 0x64, 0x00, 0x0A, 0x00,
-    0x83, 0x6F, 0x6F, 0x64, 0x00, 0x12, 0x0A, 0x2C, 0x00, 0x82, 0x6F, 0x64, 0x00, 0x12, 0x1A, 0x00,
-    0x81, 0x6C, 0x64, 0x00, 0x12, 0x00, 0x46, 0x10, 0x2D, 0x0B, 0x14, 0x2D, 0x1A, 0x1A, 0x2D, 0x00,
-    0x81, 0x6C, 0x64, 0x00, 0x16, 0x00, 0x81, 0x6C, 0x64, 0x00, 0x81, 0x6C, 0x64, 0x00, 0x12, 0x12,
-    0x0A, 0x00, 0x81, 0x64, 0x00, 0x44, 0x44, 0x2D, 0x08, 0x00, 0x30, 0x09, 0x22, 0x30, 0x0F, 0x2D,
-    0x30, 0x12, 0x35, 0x30, 0x14, 0x50, 0x30, 0x16, 0x6B, 0x30, 0x17, 0x86, 0x30, 0x1A, 0x91, 0x30,
-    0x1D, 0xAC, 0x30, 0x00, 0x45, 0x60, 0x2D, 0x0C, 0x7B, 0x2D, 0x0F, 0x96, 0x2D, 0x12, 0xB1, 0x2D,
-    0x13, 0xB9, 0x2F, 0x14, 0xD4, 0x2F, 0x16, 0xDF, 0x2F, 0x1A, 0xEA, 0x2F, 0x1D, 0xF5, 0x2F, 0x00,
-    0x52, 0x67, 0x2D, 0x1C, 0x72, 0x2D, 0x00, 0x1C, 0x08, 0x0E, 0x00, 0x84, 0x62, 0x6F, 0x61, 0x72,
-    0x64, 0x00, 0x08, 0x0E, 0x00, 0x82, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x45, 0x82, 0x2D, 0x12, 0x8C,
-    0x2D, 0x00, 0x1C, 0x08, 0x0E, 0x00, 0x83, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x05, 0x1C, 0x08, 0x0E,
-    0x00, 0x83, 0x61, 0x72, 0x64, 0x00, 0x45, 0x9D, 0x2D, 0x12, 0xA7, 0x2D, 0x00, 0x1C, 0x08, 0x0E,
-    0x00, 0x83, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x05, 0x1C, 0x08, 0x0E, 0x00, 0x83, 0x61, 0x72, 0x64,
-    0x00, 0x45, 0xCD, 0x2D, 0x0A, 0x11, 0x2F, 0x0B, 0x2C, 0x2F, 0x0C, 0x47, 0x2F, 0x0F, 0x52, 0x2F,
-    0x11, 0x5D, 0x2F, 0x13, 0x78, 0x2F, 0x19, 0x83, 0x2F, 0x1C, 0x9E, 0x2F, 0x00, 0x48, 0xE6, 0x2D,
-    0x0A, 0x02, 0x2E, 0x0B, 0x0D, 0x2E, 0x11, 0x28, 0x2E, 0x17, 0x33, 0x2E, 0x18, 0x4E, 0x2E, 0x19,
-    0x69, 0x2E, 0x1C, 0x74, 0x2E, 0x00, 0x4E, 0xED, 0x2D, 0x1C, 0xF7, 0x2D, 0x00, 0x2C, 0x00, 0x84,
-    0x79, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x0E, 0x00, 0x86, 0x65, 0x79, 0x62, 0x6F, 0x61, 0x72,
-    0x64, 0x00, 0x1C, 0x08, 0x0E, 0x00, 0x85, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x48, 0x14, 0x2E,
-    0x1C, 0x1E, 0x2E, 0x00, 0x0E, 0x00, 0x85, 0x79, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x08, 0x0E,
-    0x00, 0x85, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x1C, 0x08, 0x0E, 0x00, 0x85, 0x62, 0x6F, 0x61,
-    0x72, 0x64, 0x00, 0x48, 0x3A, 0x2E, 0x1C, 0x44, 0x2E, 0x00, 0x0E, 0x00, 0x85, 0x79, 0x62, 0x6F,
-    0x61, 0x72, 0x64, 0x00, 0x08, 0x0E, 0x00, 0x85, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x48, 0x55,
-    0x2E, 0x1C, 0x5F, 0x2E, 0x00, 0x0E, 0x00, 0x85, 0x79, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x08,
-    0x0E, 0x00, 0x85, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x1C, 0x08, 0x0E, 0x00, 0x85, 0x62, 0x6F,
-    0x61, 0x72, 0x64, 0x00, 0x47, 0x8D, 0x2E, 0x08, 0xA7, 0x2E, 0x0B, 0xB3, 0x2E, 0x0E, 0xBE, 0x2E,
-    0x15, 0xC7, 0x2E, 0x17, 0xE1, 0x2E, 0x18, 0xEC, 0x2E, 0x1A, 0xF7, 0x2E, 0x00, 0x48, 0x94, 0x2E,
-    0x0E, 0x9E, 0x2E, 0x00, 0x0E, 0x00, 0x86, 0x79, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x86, 0x65,
-    0x79, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x2C, 0x00, 0x86, 0x6B, 0x65, 0x79, 0x62, 0x6F, 0x61,
-    0x72, 0x64, 0x00, 0x08, 0x0E, 0x00, 0x86, 0x79, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x85, 0x65,
-    0x79, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x48, 0xCE, 0x2E, 0x0E, 0xD8, 0x2E, 0x00, 0x0E, 0x00,
-    0x86, 0x79, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x86, 0x65, 0x79, 0x62, 0x6F, 0x61, 0x72, 0x64,
-    0x00, 0x08, 0x0E, 0x00, 0x86, 0x79, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x08, 0x0E, 0x00, 0x86,
-    0x79, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x48, 0xFE, 0x2E, 0x0E, 0x08, 0x2F, 0x00, 0x0E, 0x00,
-    0x86, 0x79, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x86, 0x65, 0x79, 0x62, 0x6F, 0x61, 0x72, 0x64,
-    0x00, 0x45, 0x18, 0x2F, 0x1C, 0x22, 0x2F, 0x00, 0x1C, 0x08, 0x0E, 0x00, 0x84, 0x6F, 0x61, 0x72,
-    0x64, 0x00, 0x08, 0x0E, 0x00, 0x84, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x45, 0x33, 0x2F, 0x1C,
-    0x3D, 0x2F, 0x00, 0x1C, 0x08, 0x0E, 0x00, 0x84, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x08, 0x0E, 0x00,
-    0x84, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x05, 0x1C, 0x08, 0x0E, 0x00, 0x84, 0x6F, 0x61, 0x72,
-    0x64, 0x00, 0x05, 0x1C, 0x08, 0x0E, 0x00, 0x84, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x45, 0x64, 0x2F,
-    0x1C, 0x6E, 0x2F, 0x00, 0x1C, 0x08, 0x0E, 0x00, 0x84, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x08, 0x0E,
-    0x00, 0x84, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x05, 0x1C, 0x08, 0x0E, 0x00, 0x84, 0x6F, 0x61,
-    0x72, 0x64, 0x00, 0x45, 0x8A, 0x2F, 0x1C, 0x94, 0x2F, 0x00, 0x1C, 0x08, 0x0E, 0x00, 0x84, 0x6F,
-    0x61, 0x72, 0x64, 0x00, 0x08, 0x0E, 0x00, 0x84, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x45, 0xA5,
-    0x2F, 0x08, 0xB0, 0x2F, 0x00, 0x08, 0x0E, 0x00, 0x85, 0x79, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00,
-    0x0E, 0x00, 0x83, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x45, 0xC0, 0x2F, 0x12, 0xCA, 0x2F, 0x00,
-    0x1C, 0x08, 0x0E, 0x00, 0x83, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x05, 0x1C, 0x08, 0x0E, 0x00, 0x83,
-    0x61, 0x72, 0x64, 0x00, 0x12, 0x05, 0x1C, 0x08, 0x0E, 0x00, 0x83, 0x61, 0x72, 0x64, 0x00, 0x12,
-    0x05, 0x1C, 0x08, 0x0E, 0x00, 0x83, 0x61, 0x72, 0x64, 0x00, 0x12, 0x05, 0x1C, 0x08, 0x0E, 0x00,
-    0x83, 0x61, 0x72, 0x64, 0x00, 0x12, 0x05, 0x1C, 0x08, 0x0E, 0x00, 0x83, 0x61, 0x72, 0x64, 0x00,
-    0x44, 0x07, 0x30, 0x0B, 0x11, 0x30, 0x00, 0x12, 0x05, 0x1C, 0x08, 0x0E, 0x00, 0x82, 0x72, 0x64,
-    0x00, 0x57, 0x18, 0x30, 0x1A, 0x1D, 0x30, 0x00, 0x2C, 0x00, 0x80, 0x65, 0x00, 0x2C, 0x00, 0x80,
-    0x65, 0x00, 0x04, 0x12, 0x05, 0x1C, 0x08, 0x0E, 0x00, 0x82, 0x72, 0x64, 0x00, 0x12, 0x1A, 0x00,
-    0x82, 0x72, 0x6C, 0x64, 0x00, 0x44, 0x3C, 0x30, 0x05, 0x47, 0x30, 0x00, 0x05, 0x1C, 0x08, 0x0E,
-    0x00, 0x83, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x1C, 0x08, 0x0E, 0x00, 0x81, 0x61, 0x72, 0x64, 0x00,
-    0x44, 0x57, 0x30, 0x12, 0x61, 0x30, 0x00, 0x12, 0x05, 0x1C, 0x08, 0x0E, 0x00, 0x82, 0x72, 0x64,
-    0x00, 0x05, 0x1C, 0x08, 0x0E, 0x00, 0x82, 0x61, 0x72, 0x64, 0x00, 0x44, 0x72, 0x30, 0x12, 0x7C,
-    0x30, 0x00, 0x12, 0x05, 0x1C, 0x08, 0x0E, 0x00, 0x82, 0x72, 0x64, 0x00, 0x05, 0x1C, 0x08, 0x0E,
-    0x00, 0x82, 0x61, 0x72, 0x64, 0x00, 0x04, 0x12, 0x05, 0x1C, 0x08, 0x0E, 0x00, 0x82, 0x72, 0x64,
-    0x00, 0x44, 0x98, 0x30, 0x12, 0xA2, 0x30, 0x00, 0x12, 0x05, 0x1C, 0x08, 0x0E, 0x00, 0x82, 0x72,
-    0x64, 0x00, 0x05, 0x1C, 0x08, 0x0E, 0x00, 0x82, 0x61, 0x72, 0x64, 0x00, 0x44, 0xB3, 0x30, 0x12,
-    0xBD, 0x30, 0x00, 0x12, 0x05, 0x1C, 0x08, 0x0E, 0x00, 0x82, 0x72, 0x64, 0x00, 0x05, 0x1C, 0x08,
-    0x0E, 0x00, 0x82, 0x61, 0x72, 0x64, 0x00, 0x74, 0xD7, 0x30, 0x08, 0xDC, 0x30, 0x0C, 0xF4, 0x30,
-    0x11, 0x04, 0x31, 0x12, 0x0A, 0x31, 0x00, 0x17, 0x0C, 0x00, 0x80, 0x00, 0x48, 0xE6, 0x30, 0x12,
-    0xEB, 0x30, 0x16, 0xEF, 0x30, 0x00, 0x11, 0x00, 0x81, 0x64, 0x00, 0x07, 0x00, 0x80, 0x00, 0x18,
-    0x00, 0x81, 0x64, 0x00, 0x44, 0xFB, 0x30, 0x0B, 0x00, 0x31, 0x00, 0x16, 0x00, 0x81, 0x64, 0x00,
-    0x17, 0x00, 0x80, 0x00, 0x0C, 0x09, 0x00, 0x81, 0x64, 0x00, 0x4B, 0x11, 0x31, 0x12, 0x16, 0x31,
-    0x00, 0x17, 0x00, 0x80, 0x65, 0x00, 0x0A, 0x00, 0x81, 0x64, 0x00, 0x04, 0x00, 0x52, 0x24, 0x31,
-    0x17, 0x2D, 0x31, 0x00, 0x05, 0x1C, 0x08, 0x0E, 0x00, 0x81, 0x72, 0x64, 0x00, 0x16, 0x00, 0x80,
-    0x65, 0x00, 0x4C, 0x3F, 0x31, 0x0F, 0x45, 0x31, 0x11, 0x62, 0x31, 0x12, 0x77, 0x31, 0x00, 0x04,
-    0x16, 0x00, 0x81, 0x64, 0x00, 0x12, 0x00, 0x46, 0x51, 0x31, 0x0B, 0x56, 0x31, 0x1A, 0x5D, 0x31,
-    0x00, 0x82, 0x75, 0x6C, 0x64, 0x00, 0x16, 0x00, 0x82, 0x75, 0x6C, 0x64, 0x00, 0x82, 0x75, 0x6C,
-    0x64, 0x00, 0x12, 0x00, 0x55, 0x6B, 0x31, 0x16, 0x72, 0x31, 0x00, 0x04, 0x00, 0x82, 0x75, 0x6E,
-    0x64, 0x00, 0x82, 0x75, 0x6E, 0x64, 0x00, 0x4B, 0x7E, 0x31, 0x15, 0x84, 0x31, 0x00, 0x16, 0x00,
-    0x80, 0x6C, 0x64, 0x00, 0x04, 0x00, 0x80, 0x6E, 0x64, 0x00, 0x08, 0x00, 0x48, 0x93, 0x31, 0x16,
-    0x98, 0x31, 0x00, 0x11, 0x00, 0x81, 0x64, 0x00, 0x18, 0x00, 0x81, 0x64, 0x00, 0x48, 0xAA, 0x31,
-    0x0C, 0xBB, 0x31, 0x11, 0xC1, 0x31, 0x12, 0xC7, 0x31, 0x00, 0x48, 0xB1, 0x31, 0x16, 0xB6, 0x31,
-    0x00, 0x11, 0x00, 0x81, 0x64, 0x00, 0x18, 0x00, 0x81, 0x64, 0x00, 0x04, 0x16, 0x00, 0x81, 0x64,
-    0x00, 0x0C, 0x09, 0x00, 0x81, 0x64, 0x00, 0x12, 0x0A, 0x00, 0x81, 0x64, 0x00, 0x04, 0x1A, 0x0F,
-    0x04, 0x00, 0x80, 0x73, 0x00, 0x74, 0x21, 0x32, 0x04, 0x38, 0x32, 0x05, 0x94, 0x32, 0x06, 0xB6,
-    0x32, 0x07, 0x7B, 0x34, 0x08, 0xC3, 0x35, 0x09, 0x4F, 0x37, 0x0A, 0x34, 0x38, 0x0B, 0x67, 0x38,
-    0x0C, 0x72, 0x38, 0x0D, 0xBF, 0x38, 0x0E, 0x1B, 0x39, 0x0F, 0x1A, 0x3B, 0x10, 0x75, 0x41, 0x11,
-    0x23, 0x45, 0x12, 0x7B, 0x48, 0x13, 0xED, 0x48, 0x15, 0x04, 0x49, 0x16, 0x8D, 0x54, 0x17, 0x2D,
-    0x5A, 0x18, 0xE2, 0x5B, 0x19, 0x15, 0x5C, 0x1A, 0x7B, 0x5D, 0x1B, 0x0A, 0x5E, 0x1C, 0x54, 0x5E,
-    0x00, 0x55, 0x28, 0x32, 0x18, 0x31, 0x32, 0x00, 0x18, 0x12, 0x1C, 0x00, 0x82, 0x27, 0x72, 0x65,
-    0x00, 0x12, 0x1C, 0x00, 0x80, 0x72, 0x65, 0x00, 0x48, 0x4E, 0x32, 0x12, 0x55, 0x32, 0x15, 0x5C,
-    0x32, 0x16, 0x67, 0x32, 0x17, 0x7A, 0x32, 0x18, 0x82, 0x32, 0x1A, 0x8B, 0x32, 0x00, 0x0B, 0x17,
-    0x00, 0x81, 0x73, 0x65, 0x00, 0x0B, 0x17, 0x00, 0x81, 0x73, 0x65, 0x00, 0x1A, 0x10, 0x15, 0x0C,
-    0x09, 0x00, 0x82, 0x61, 0x72, 0x65, 0x00, 0x48, 0x6E, 0x32, 0x12, 0x74, 0x32, 0x00, 0x0B, 0x17,
-    0x00, 0x81, 0x65, 0x00, 0x0B, 0x17, 0x00, 0x81, 0x65, 0x00, 0x17, 0x16, 0x00, 0x82, 0x61, 0x74,
-    0x65, 0x00, 0x04, 0x06, 0x08, 0x05, 0x00, 0x81, 0x73, 0x65, 0x00, 0x10, 0x15, 0x0C, 0x09, 0x00,
-    0x80, 0x72, 0x65, 0x00, 0x4C, 0x9B, 0x32, 0x19, 0xA5, 0x32, 0x00, 0x0F, 0x08, 0x16, 0x04, 0x05,
-    0x00, 0x81, 0x6E, 0x65, 0x00, 0x44, 0xAC, 0x32, 0x12, 0xB1, 0x32, 0x00, 0x0B, 0x00, 0x81, 0x65,
-    0x00, 0x0F, 0x00, 0x81, 0x65, 0x00, 0x45, 0xD8, 0x32, 0x07, 0xED, 0x32, 0x09, 0x00, 0x33, 0x0B,
-    0x06, 0x33, 0x0C, 0x1B, 0x33, 0x0D, 0x24, 0x33, 0x10, 0x39, 0x33, 0x11, 0x4E, 0x33, 0x16, 0x50,
-    0x34, 0x19, 0x58, 0x34, 0x1B, 0x73, 0x34, 0x00, 0x4C, 0xDF, 0x32, 0x11, 0xE6, 0x32, 0x00, 0x16,
-    0x00, 0x82, 0x6E, 0x63, 0x65, 0x00, 0x0C, 0x16, 0x00, 0x82, 0x63, 0x65, 0x00, 0x44, 0xF4, 0x32,
-    0x11, 0xF9, 0x32, 0x00, 0x10, 0x00, 0x81, 0x65, 0x00, 0x0C, 0x16, 0x00, 0x82, 0x63, 0x65, 0x00,
-    0x0C, 0x0F, 0x00, 0x81, 0x65, 0x00, 0x4C, 0x0D, 0x33, 0x11, 0x14, 0x33, 0x00, 0x16, 0x00, 0x82,
-    0x6E, 0x63, 0x65, 0x00, 0x0C, 0x16, 0x00, 0x82, 0x63, 0x65, 0x00, 0x11, 0x16, 0x00, 0x83, 0x69,
-    0x6E, 0x63, 0x65, 0x00, 0x4C, 0x2B, 0x33, 0x11, 0x32, 0x33, 0x00, 0x16, 0x00, 0x82, 0x6E, 0x63,
-    0x65, 0x00, 0x0C, 0x16, 0x00, 0x82, 0x63, 0x65, 0x00, 0x4C, 0x40, 0x33, 0x11, 0x47, 0x33, 0x00,
-    0x16, 0x00, 0x82, 0x6E, 0x63, 0x65, 0x00, 0x0C, 0x16, 0x00, 0x82, 0x63, 0x65, 0x00, 0x45, 0x6A,
-    0x33, 0x0B, 0x72, 0x33, 0x0C, 0x7A, 0x33, 0x0D, 0xFB, 0x33, 0x0E, 0x03, 0x34, 0x10, 0x17, 0x34,
-    0x12, 0x1F, 0x34, 0x16, 0x33, 0x34, 0x18, 0x3C, 0x34, 0x00, 0x0C, 0x16, 0x00, 0x83, 0x6E, 0x63,
-    0x65, 0x00, 0x0C, 0x16, 0x00, 0x83, 0x6E, 0x63, 0x65, 0x00, 0x44, 0x93, 0x33, 0x07, 0x9A, 0x33,
-    0x0E, 0xA1, 0x33, 0x12, 0xA9, 0x33, 0x16, 0xB1, 0x33, 0x18, 0xE4, 0x33, 0x1A, 0xEC, 0x33, 0x1B,
-    0xF4, 0x33, 0x00, 0x84, 0x73, 0x69, 0x6E, 0x63, 0x65, 0x00, 0x84, 0x73, 0x69, 0x6E, 0x63, 0x65,
-    0x00, 0x16, 0x00, 0x84, 0x69, 0x6E, 0x63, 0x65, 0x00, 0x16, 0x00, 0x84, 0x69, 0x6E, 0x63, 0x65,
-    0x00, 0x44, 0xC1, 0x33, 0x07, 0xC8, 0x33, 0x08, 0xCF, 0x33, 0x1A, 0xD6, 0x33, 0x1B, 0xDD, 0x33,
-    0x00, 0x85, 0x73, 0x69, 0x6E, 0x63, 0x65, 0x00, 0x85, 0x73, 0x69, 0x6E, 0x63, 0x65, 0x00, 0x85,
-    0x73, 0x69, 0x6E, 0x63, 0x65, 0x00, 0x85, 0x73, 0x69, 0x6E, 0x63, 0x65, 0x00, 0x85, 0x73, 0x69,
-    0x6E, 0x63, 0x65, 0x00, 0x16, 0x00, 0x84, 0x69, 0x6E, 0x63, 0x65, 0x00, 0x16, 0x00, 0x84, 0x69,
-    0x6E, 0x63, 0x65, 0x00, 0x84, 0x73, 0x69, 0x6E, 0x63, 0x65, 0x00, 0x0C, 0x16, 0x00, 0x83, 0x6E,
-    0x63, 0x65, 0x00, 0x4C, 0x0A, 0x34, 0x16, 0x11, 0x34, 0x00, 0x16, 0x00, 0x83, 0x6E, 0x63, 0x65,
-    0x00, 0x83, 0x69, 0x6E, 0x63, 0x65, 0x00, 0x0C, 0x16, 0x00, 0x83, 0x6E, 0x63, 0x65, 0x00, 0x4C,
-    0x26, 0x34, 0x16, 0x2D, 0x34, 0x00, 0x16, 0x00, 0x83, 0x6E, 0x63, 0x65, 0x00, 0x83, 0x69, 0x6E,
-    0x63, 0x65, 0x00, 0x0C, 0x00, 0x84, 0x73, 0x69, 0x6E, 0x63, 0x65, 0x00, 0x4C, 0x43, 0x34, 0x16,
-    0x4A, 0x34, 0x00, 0x16, 0x00, 0x83, 0x6E, 0x63, 0x65, 0x00, 0x83, 0x69, 0x6E, 0x63, 0x65, 0x00,
-    0x11, 0x0C, 0x16, 0x00, 0x82, 0x63, 0x65, 0x00, 0x44, 0x62, 0x34, 0x11, 0x67, 0x34, 0x12, 0x6E,
-    0x34, 0x00, 0x0B, 0x00, 0x81, 0x65, 0x00, 0x0C, 0x16, 0x00, 0x82, 0x63, 0x65, 0x00, 0x0F, 0x00,
-    0x81, 0x65, 0x00, 0x11, 0x0C, 0x16, 0x00, 0x82, 0x63, 0x65, 0x00, 0x44, 0xA9, 0x34, 0x06, 0x07,
-    0x35, 0x08, 0x0E, 0x35, 0x09, 0x28, 0x35, 0x0C, 0x3A, 0x35, 0x0E, 0x3F, 0x35, 0x0F, 0x58, 0x35,
-    0x10, 0x5E, 0x35, 0x12, 0x85, 0x35, 0x14, 0x8D, 0x35, 0x15, 0x94, 0x35, 0x18, 0x9B, 0x35, 0x19,
-    0xA4, 0x35, 0x1A, 0xB5, 0x35, 0x1B, 0xBC, 0x35, 0x00, 0x4D, 0xBF, 0x34, 0x0E, 0xC6, 0x34, 0x10,
-    0xCD, 0x34, 0x14, 0xEB, 0x34, 0x16, 0xF2, 0x34, 0x1A, 0xF9, 0x34, 0x1D, 0x00, 0x35, 0x00, 0x10,
-    0x00, 0x83, 0x61, 0x64, 0x65, 0x00, 0x10, 0x00, 0x83, 0x61, 0x64, 0x65, 0x00, 0x4D, 0xD7, 0x34,
-    0x0E, 0xDD, 0x34, 0x11, 0xE3, 0x34, 0x00, 0x84, 0x6D, 0x61, 0x64, 0x65, 0x00, 0x84, 0x6D, 0x61,
-    0x64, 0x65, 0x00, 0x2C, 0x00, 0x84, 0x6D, 0x61, 0x64, 0x65, 0x00, 0x10, 0x00, 0x83, 0x61, 0x64,
-    0x65, 0x00, 0x10, 0x00, 0x83, 0x61, 0x64, 0x65, 0x00, 0x10, 0x00, 0x83, 0x61, 0x64, 0x65, 0x00,
-    0x10, 0x00, 0x83, 0x61, 0x64, 0x65, 0x00, 0x04, 0x10, 0x00, 0x82, 0x64, 0x65, 0x00, 0x44, 0x18,
-    0x35, 0x0B, 0x1E, 0x35, 0x16, 0x24, 0x35, 0x00, 0x10, 0x00, 0x82, 0x64, 0x65, 0x00, 0x17, 0x00,
-    0x81, 0x73, 0x65, 0x00, 0x18, 0x00, 0x80, 0x00, 0x44, 0x2F, 0x35, 0x0C, 0x35, 0x35, 0x00, 0x10,
-    0x00, 0x82, 0x64, 0x65, 0x00, 0x0F, 0x00, 0x81, 0x65, 0x00, 0x04, 0x16, 0x00, 0x80, 0x00, 0x44,
-    0x46, 0x35, 0x0C, 0x53, 0x35, 0x00, 0x50, 0x4D, 0x35, 0x17, 0x50, 0x35, 0x00, 0x81, 0x65, 0x00,
-    0x81, 0x65, 0x00, 0x0F, 0x00, 0x81, 0x65, 0x00, 0x18, 0x12, 0x06, 0x00, 0x80, 0x00, 0x44, 0x68,
-    0x35, 0x0C, 0x6D, 0x35, 0x12, 0x72, 0x35, 0x00, 0x16, 0x00, 0x81, 0x65, 0x00, 0x17, 0x00, 0x81,
-    0x65, 0x00, 0x46, 0x7C, 0x35, 0x0B, 0x7F, 0x35, 0x16, 0x82, 0x35, 0x00, 0x81, 0x65, 0x00, 0x81,
-    0x65, 0x00, 0x81, 0x65, 0x00, 0x0B, 0x17, 0x2C, 0x00, 0x81, 0x73, 0x65, 0x00, 0x04, 0x10, 0x00,
-    0x82, 0x64, 0x65, 0x00, 0x0B, 0x17, 0x00, 0x81, 0x65, 0x65, 0x00, 0x04, 0x06, 0x08, 0x05, 0x00,
-    0x81, 0x73, 0x65, 0x00, 0x44, 0xAB, 0x35, 0x12, 0xB0, 0x35, 0x00, 0x0B, 0x00, 0x81, 0x65, 0x00,
-    0x0F, 0x00, 0x81, 0x65, 0x00, 0x04, 0x10, 0x00, 0x82, 0x64, 0x65, 0x00, 0x04, 0x10, 0x00, 0x82,
-    0x64, 0x65, 0x00, 0x47, 0xE2, 0x35, 0x08, 0xE7, 0x35, 0x09, 0xF9, 0x35, 0x0B, 0x0E, 0x36, 0x11,
-    0x17, 0x36, 0x12, 0x22, 0x36, 0x15, 0x29, 0x36, 0x16, 0x10, 0x37, 0x17, 0x2B, 0x37, 0x19, 0x49,
-    0x37, 0x00, 0x04, 0x10, 0x00, 0x80, 0x00, 0x4B, 0xEE, 0x35, 0x15, 0xF4, 0x35, 0x00, 0x1A, 0x00,
-    0x81, 0x72, 0x65, 0x00, 0x0B, 0x17, 0x00, 0x80, 0x00, 0x4B, 0x00, 0x36, 0x15, 0x07, 0x36, 0x00,
+    0x06, 0x00, 0x82, 0x6E, 0x69, 0x61, 0x00, 0x11, 0x15, 0x12, 0x09, 0x0C, 0x0F, 0x04, 0x00, 0x46,
+    0xF7, 0x12, 0x00, 0x45, 0x2F, 0x13, 0x08, 0x3C, 0x13, 0x09, 0x3C, 0x13, 0x0B, 0x2F, 0x13, 0x0D,
+    0x2F, 0x13, 0x10, 0x2F, 0x13, 0x12, 0x59, 0x13, 0x15, 0x78, 0x13, 0x17, 0x3C, 0x13, 0x00, 0x15,
+    0x12, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x83, 0x6E, 0x69, 0x61, 0x00, 0x52, 0x43, 0x13, 0x15,
+    0x4F, 0x13, 0x00, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x83, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x12,
+    0x09, 0x0C, 0x0F, 0x04, 0x00, 0x46, 0x37, 0x13, 0x00, 0x49, 0x60, 0x13, 0x15, 0x6B, 0x13, 0x00,
+    0x0C, 0x0F, 0x04, 0x06, 0x00, 0x82, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x09, 0x0C, 0x0F, 0x04, 0x06,
+    0x00, 0x84, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x48, 0x8E, 0x13, 0x09, 0x9B, 0x13, 0x0C, 0xC8,
+    0x13, 0x0F, 0xC8, 0x13, 0x12, 0xE0, 0x13, 0x13, 0xC8, 0x13, 0x17, 0x8E, 0x13, 0x00, 0x12, 0x09,
+    0x0C, 0x0F, 0x04, 0x06, 0x00, 0x84, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x4C, 0xA2, 0x13, 0x12, 0xAD,
+    0x13, 0x00, 0x0F, 0x04, 0x06, 0x00, 0x83, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x49, 0xB4, 0x13,
+    0x0C, 0xBC, 0x13, 0x00, 0x0C, 0x0F, 0x04, 0x00, 0x46, 0x95, 0x13, 0x00, 0x0F, 0x04, 0x06, 0x00,
+    0x85, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x49, 0xCF, 0x13, 0x12, 0xD7, 0x13, 0x00, 0x0C,
+    0x0F, 0x04, 0x00, 0x46, 0x71, 0x13, 0x00, 0x09, 0x0C, 0x0F, 0x04, 0x00, 0x46, 0x95, 0x13, 0x00,
+    0x46, 0xFC, 0x13, 0x07, 0xFC, 0x13, 0x09, 0x0F, 0x14, 0x0A, 0xFC, 0x13, 0x0C, 0x0B, 0x15, 0x0F,
+    0x2B, 0x15, 0x13, 0x2B, 0x15, 0x15, 0xFC, 0x13, 0x19, 0xFC, 0x13, 0x00, 0x49, 0x03, 0x14, 0x0C,
+    0xBC, 0x13, 0x00, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x85, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x46,
+    0x2E, 0x14, 0x07, 0x2E, 0x14, 0x0A, 0x2E, 0x14, 0x0C, 0x3B, 0x14, 0x0E, 0xD9, 0x14, 0x0F, 0xF3,
+    0x14, 0x12, 0xD9, 0x14, 0x15, 0x2E, 0x14, 0x18, 0xD9, 0x14, 0x19, 0x2E, 0x14, 0x00, 0x0C, 0x0F,
+    0x04, 0x06, 0x00, 0x86, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x44, 0x4B, 0x14, 0x0E, 0x69,
+    0x14, 0x0F, 0x88, 0x14, 0x12, 0x69, 0x14, 0x18, 0xD2, 0x14, 0x00, 0x46, 0x52, 0x14, 0x0F, 0x5C,
+    0x14, 0x00, 0x86, 0x6C, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x06, 0x00, 0x88, 0x61,
+    0x6C, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x44, 0x70, 0x14, 0x0F, 0x7C, 0x14, 0x00,
+    0x06, 0x00, 0x87, 0x6C, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x04, 0x06, 0x00, 0x87,
+    0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x44, 0xA1, 0x14, 0x06, 0xAF, 0x14, 0x0E, 0xBA,
+    0x14, 0x12, 0xBA, 0x14, 0x14, 0xC7, 0x14, 0x16, 0xC7, 0x14, 0x1A, 0xC7, 0x14, 0x1D, 0xC7, 0x14,
+    0x00, 0x2C, 0x00, 0x88, 0x63, 0x61, 0x6C, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x87,
+    0x61, 0x6C, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x04, 0x06, 0x00, 0x88, 0x6C, 0x69,
+    0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x44, 0xCE, 0x14, 0x06, 0x5E, 0x14, 0x00, 0x46, 0xBD,
+    0x14, 0x00, 0x0F, 0x04, 0x00, 0x46, 0x7F, 0x14, 0x00, 0x4C, 0xE0, 0x14, 0x0F, 0xE7, 0x14, 0x00,
+    0x0F, 0x04, 0x00, 0x46, 0x33, 0x14, 0x00, 0x04, 0x06, 0x00, 0x86, 0x69, 0x66, 0x6F, 0x72, 0x6E,
+    0x69, 0x61, 0x00, 0x44, 0xFA, 0x14, 0x0C, 0x05, 0x15, 0x00, 0x06, 0x00, 0x85, 0x69, 0x66, 0x6F,
+    0x72, 0x6E, 0x69, 0x61, 0x00, 0x04, 0x00, 0x46, 0x72, 0x14, 0x00, 0x49, 0x12, 0x15, 0x0F, 0x20,
+    0x15, 0x00, 0x4C, 0x19, 0x15, 0x0F, 0xE7, 0x14, 0x00, 0x0F, 0x04, 0x00, 0x46, 0x08, 0x14, 0x00,
+    0x04, 0x06, 0x00, 0x84, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x00, 0x09, 0x0C, 0x0F, 0x04, 0x00,
+    0x46, 0x08, 0x14, 0x00, 0x51, 0x3B, 0x15, 0x12, 0x45, 0x15, 0x00, 0x12, 0x09, 0x0C, 0x0F, 0x04,
+    0x00, 0x46, 0x49, 0x13, 0x00, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x81, 0x6E, 0x69, 0x61, 0x00,
+    0x11, 0x15, 0x12, 0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x81, 0x69, 0x61, 0x00, 0x4C, 0x64, 0x15,
+    0x15, 0x6F, 0x15, 0x00, 0x15, 0x12, 0x09, 0x0C, 0x0F, 0x04, 0x00, 0x46, 0x02, 0x13, 0x00, 0x12,
+    0x09, 0x0C, 0x0F, 0x04, 0x06, 0x00, 0x80, 0x69, 0x61, 0x00, 0x74, 0x87, 0x15, 0x08, 0x8C, 0x15,
+    0x0C, 0x91, 0x15, 0x15, 0x96, 0x15, 0x00, 0x17, 0x0C, 0x00, 0x80, 0x00, 0x12, 0x07, 0x00, 0x80,
+    0x00, 0x0B, 0x17, 0x00, 0x80, 0x00, 0x04, 0x08, 0x1C, 0x00, 0x80, 0x00, 0x04, 0x1A, 0x0F, 0x04,
+    0x00, 0x80, 0x73, 0x00, 0x46, 0xB4, 0x15, 0x0A, 0xC7, 0x15, 0x0B, 0xD9, 0x15, 0x0F, 0x06, 0x16,
+    0x11, 0x10, 0x16, 0x00, 0x4C, 0xBB, 0x15, 0x17, 0xC1, 0x15, 0x00, 0x0B, 0x1A, 0x00, 0x80, 0x68,
+    0x00, 0x0C, 0x05, 0x00, 0x80, 0x68, 0x00, 0x11, 0x0C, 0x00, 0x48, 0xD1, 0x15, 0x12, 0xD5, 0x15,
+    0x00, 0x05, 0x00, 0x80, 0x00, 0x0A, 0x00, 0x80, 0x00, 0x46, 0xE0, 0x15, 0x17, 0xFB, 0x15, 0x00,
+    0x4C, 0xEA, 0x15, 0x17, 0xEF, 0x15, 0x18, 0xF4, 0x15, 0x00, 0x0B, 0x1A, 0x00, 0x80, 0x00, 0x0C,
+    0x05, 0x00, 0x80, 0x00, 0x50, 0x8A, 0x15, 0x16, 0x8A, 0x15, 0x00, 0x4C, 0x02, 0x16, 0x12, 0xD1,
+    0x15, 0x00, 0x1A, 0x00, 0x80, 0x00, 0x04, 0x05, 0x12, 0x15, 0x13, 0x00, 0x81, 0x62, 0x6C, 0x00,
+    0x44, 0x91, 0x15, 0x08, 0x1A, 0x16, 0x0C, 0x28, 0x16, 0x00, 0x48, 0xD1, 0x15, 0x0B, 0x21, 0x16,
+    0x00, 0x57, 0x8A, 0x15, 0x1A, 0x8A, 0x15, 0x00, 0x48, 0x2F, 0x16, 0x12, 0x33, 0x16, 0x00, 0x45,
+    0x9A, 0x0B, 0x00, 0x4A, 0x9A, 0x0B, 0x00, 0x47, 0x53, 0x16, 0x0B, 0xA1, 0x16, 0x0C, 0xB5, 0x16,
+    0x0E, 0x64, 0x17, 0x0F, 0x79, 0x17, 0x11, 0x8F, 0x17, 0x16, 0x96, 0x17, 0x17, 0x9D, 0x17, 0x18,
+    0x64, 0x17, 0x00, 0x48, 0x63, 0x16, 0x0C, 0x72, 0x16, 0x0F, 0x77, 0x16, 0x11, 0x8C, 0x16, 0x12,
+    0x9C, 0x16, 0x00, 0x48, 0x6A, 0x16, 0x16, 0x6E, 0x16, 0x00, 0x11, 0x00, 0x80, 0x00, 0x18, 0x00,
+    0x80, 0x00, 0x04, 0x16, 0x00, 0x80, 0x00, 0x55, 0x7E, 0x16, 0x18, 0x83, 0x16, 0x00, 0x12, 0x1A,
+    0x00, 0x80, 0x00, 0x12, 0x00, 0x46, 0x8A, 0x15, 0x1A, 0x8A, 0x15, 0x00, 0x4C, 0x93, 0x16, 0x18,
+    0x97, 0x16, 0x00, 0x09, 0x00, 0x80, 0x00, 0x12, 0x16, 0x00, 0x80, 0x00, 0x12, 0x0A, 0x00, 0x80,
+    0x00, 0x4C, 0xA8, 0x16, 0x17, 0xAF, 0x16, 0x00, 0x0B, 0x1A, 0x00, 0x81, 0x63, 0x68, 0x00, 0x0C,
+    0x00, 0x45, 0xAB, 0x16, 0x00, 0x44, 0xD1, 0x16, 0x07, 0xF0, 0x16, 0x08, 0xF0, 0x16, 0x0E, 0xE7,
+    0x08, 0x12, 0xE7, 0x08, 0x16, 0xF7, 0x16, 0x18, 0xE7, 0x08, 0x1A, 0xF0, 0x16, 0x1B, 0xF0, 0x16,
+    0x00, 0x44, 0xD8, 0x16, 0x16, 0xDF, 0x16, 0x00, 0x05, 0x00, 0x82, 0x73, 0x69, 0x63, 0x00, 0x44,
+    0xE6, 0x16, 0x05, 0xEA, 0x16, 0x00, 0x45, 0x6A, 0x01, 0x00, 0x83, 0x61, 0x73, 0x69, 0x63, 0x00,
+    0x44, 0xD8, 0x16, 0x16, 0x67, 0x01, 0x00, 0x44, 0x13, 0x17, 0x05, 0x53, 0x17, 0x07, 0x57, 0x17,
+    0x08, 0x57, 0x17, 0x14, 0x5D, 0x17, 0x16, 0xDF, 0x16, 0x1A, 0x5D, 0x17, 0x1B, 0x57, 0x17, 0x1D,
+    0x5D, 0x17, 0x00, 0x44, 0x2C, 0x17, 0x05, 0x33, 0x17, 0x0A, 0x40, 0x17, 0x0B, 0x47, 0x17, 0x14,
+    0x4B, 0x17, 0x16, 0x4B, 0x17, 0x1A, 0x4B, 0x17, 0x1D, 0x4B, 0x17, 0x00, 0x05, 0x00, 0x83, 0x73,
+    0x69, 0x63, 0x00, 0x4A, 0x52, 0x01, 0x0B, 0x52, 0x01, 0x11, 0x50, 0x01, 0x19, 0x52, 0x01, 0x00,
+    0x84, 0x62, 0x61, 0x73, 0x69, 0x63, 0x00, 0x6C, 0x40, 0x17, 0x00, 0x05, 0x00, 0x84, 0x61, 0x73,
+    0x69, 0x63, 0x00, 0x44, 0x40, 0x17, 0x00, 0x04, 0x00, 0x45, 0x2E, 0x17, 0x00, 0x44, 0x2C, 0x17,
+    0x05, 0xEA, 0x16, 0x00, 0x4C, 0x6B, 0x17, 0x16, 0x72, 0x17, 0x00, 0x16, 0x04, 0x05, 0x00, 0x81,
+    0x63, 0x00, 0x04, 0x05, 0x00, 0x81, 0x69, 0x63, 0x00, 0x55, 0x80, 0x17, 0x18, 0x86, 0x17, 0x00,
+    0x12, 0x1A, 0x00, 0x80, 0x64, 0x00, 0x12, 0x00, 0x46, 0x94, 0x0A, 0x1A, 0x94, 0x0A, 0x00, 0x18,
+    0x12, 0x16, 0x00, 0x80, 0x64, 0x00, 0x0C, 0x04, 0x00, 0x45, 0xDA, 0x16, 0x00, 0x04, 0x1B, 0x08,
+    0x00, 0x81, 0x63, 0x74, 0x00, 0x44, 0xEB, 0x17, 0x05, 0x06, 0x18, 0x06, 0x27, 0x18, 0x07, 0x62,
+    0x18, 0x08, 0x66, 0x18, 0x09, 0xB1, 0x19, 0x0A, 0xD0, 0x19, 0x0B, 0x06, 0x18, 0x0C, 0xD8, 0x19,
+    0x0D, 0x06, 0x18, 0x0E, 0x49, 0x1A, 0x0F, 0x71, 0x1A, 0x10, 0x06, 0x18, 0x11, 0x88, 0x1C, 0x12,
+    0x1F, 0x1E, 0x13, 0x9F, 0x1E, 0x15, 0xA6, 0x1E, 0x16, 0x60, 0x20, 0x17, 0x90, 0x20, 0x18, 0x9D,
+    0x20, 0x1A, 0xC5, 0x20, 0x1B, 0xC9, 0x20, 0x1C, 0x9C, 0x15, 0x00, 0x52, 0xF2, 0x17, 0x15, 0xFB,
+    0x17, 0x00, 0x05, 0x1C, 0x08, 0x0E, 0x00, 0x80, 0x72, 0x64, 0x00, 0x12, 0x05, 0x1C, 0x08, 0x0E,
+    0x00, 0x82, 0x61, 0x72, 0x64, 0x00, 0x51, 0x0D, 0x18, 0x18, 0x18, 0x18, 0x00, 0x4C, 0x14, 0x18,
+    0x18, 0x95, 0x0F, 0x00, 0x49, 0x5A, 0x04, 0x00, 0x12, 0x00, 0x55, 0x21, 0x18, 0x16, 0x23, 0x18,
+    0x00, 0x04, 0x00, 0x81, 0x6E, 0x64, 0x00, 0x48, 0x34, 0x18, 0x0C, 0x43, 0x18, 0x11, 0x53, 0x18,
+    0x12, 0x5C, 0x18, 0x00, 0x48, 0x3B, 0x18, 0x16, 0x3F, 0x18, 0x00, 0x51, 0x5A, 0x04, 0x00, 0x58,
+    0x5A, 0x04, 0x00, 0x44, 0x4A, 0x18, 0x16, 0x4E, 0x18, 0x00, 0x56, 0x5A, 0x04, 0x00, 0x04, 0x05,
+    0x00, 0x80, 0x00, 0x0C, 0x00, 0x49, 0x5A, 0x04, 0x16, 0x58, 0x0A, 0x00, 0x12, 0x0A, 0x00, 0x81,
+    0x64, 0x00, 0x48, 0x63, 0x16, 0x00, 0x44, 0x94, 0x18, 0x06, 0xAA, 0x18, 0x07, 0xB0, 0x18, 0x08,
+    0xC2, 0x18, 0x0C, 0xFE, 0x18, 0x0E, 0x04, 0x19, 0x0F, 0x0A, 0x19, 0x10, 0x10, 0x19, 0x11, 0x19,
+    0x19, 0x12, 0x5C, 0x18, 0x15, 0x2A, 0x19, 0x16, 0x51, 0x19, 0x19, 0x98, 0x19, 0x1A, 0x9E, 0x19,
+    0x1B, 0xAB, 0x19, 0x00, 0x52, 0x9B, 0x18, 0x16, 0xA4, 0x18, 0x00, 0x05, 0x1C, 0x08, 0x0E, 0x00,
+    0x81, 0x72, 0x64, 0x00, 0x18, 0x00, 0x82, 0x65, 0x64, 0x00, 0x11, 0x0C, 0x16, 0x00, 0x80, 0x00,
+    0x44, 0xBA, 0x18, 0x08, 0xBE, 0x18, 0x16, 0xA4, 0x18, 0x00, 0x10, 0x00, 0x80, 0x00, 0x51, 0xA6,
+    0x18, 0x00, 0x45, 0xE1, 0x18, 0x07, 0xE8, 0x18, 0x08, 0x3B, 0x18, 0x0B, 0xE8, 0x18, 0x0D, 0xE1,
+    0x18, 0x10, 0xE1, 0x18, 0x11, 0xEE, 0x18, 0x15, 0xE1, 0x18, 0x16, 0x3F, 0x18, 0x1A, 0xE8, 0x18,
+    0x00, 0x11, 0x00, 0x83, 0x65, 0x65, 0x64, 0x00, 0x11, 0x00, 0x6C, 0xE3, 0x18, 0x00, 0x45, 0xF8,
+    0x18, 0x0D, 0xF8, 0x18, 0x10, 0xF8, 0x18, 0x00, 0x84, 0x6E, 0x65, 0x65, 0x64, 0x00, 0x04, 0x16,
+    0x00, 0x81, 0x64, 0x00, 0x0C, 0x0F, 0x2C, 0x00, 0x80, 0x00, 0x0C, 0x0B, 0x1A, 0x00, 0x80, 0x00,
+    0x04, 0x00, 0x4A, 0x8A, 0x15, 0x16, 0x8A, 0x15, 0x00, 0x52, 0x20, 0x19, 0x18, 0x95, 0x0F, 0x00,
+    0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x80, 0x73, 0x00, 0x48, 0x37, 0x19, 0x0B, 0x46, 0x19,
+    0x12, 0x4C, 0x19, 0x16, 0xA4, 0x18, 0x00, 0x51, 0x3E, 0x19, 0x1A, 0x42, 0x19, 0x00, 0x6C, 0xA6,
+    0x18, 0x00, 0x2C, 0x00, 0x80, 0x00, 0x17, 0x2C, 0x00, 0x80, 0x65, 0x00, 0x10, 0x2C, 0x00, 0x80,
+    0x00, 0x44, 0x70, 0x19, 0x07, 0x70, 0x19, 0x08, 0x77, 0x19, 0x0C, 0x82, 0x19, 0x0D, 0x70, 0x19,
+    0x12, 0x91, 0x15, 0x18, 0x88, 0x19, 0x1A, 0x70, 0x19, 0x1B, 0x70, 0x19, 0x1C, 0x70, 0x19, 0x00,
+    0x18, 0x00, 0x83, 0x73, 0x65, 0x64, 0x00, 0x4B, 0x7E, 0x19, 0x18, 0x72, 0x19, 0x00, 0x17, 0x00,
+    0x80, 0x00, 0x18, 0x00, 0x6C, 0x72, 0x19, 0x00, 0x4C, 0x92, 0x19, 0x0D, 0x92, 0x19, 0x1C, 0x92,
+    0x19, 0x00, 0x84, 0x75, 0x73, 0x65, 0x64, 0x00, 0x04, 0x0B, 0x2C, 0x00, 0x80, 0x00, 0x48, 0xA5,
+    0x19, 0x16, 0xA4, 0x18, 0x00, 0x11, 0x00, 0x6C, 0xA6, 0x18, 0x00, 0x16, 0x00, 0x58, 0xA6, 0x18,
+    0x00, 0x44, 0xC1, 0x19, 0x08, 0x34, 0x18, 0x0C, 0xFE, 0x18, 0x11, 0xCA, 0x19, 0x12, 0x5C, 0x18,
+    0x00, 0x12, 0x05, 0x1C, 0x08, 0x00, 0x4E, 0xA0, 0x18, 0x00, 0x0C, 0x09, 0x00, 0x81, 0x64, 0x00,
+    0x11, 0x0C, 0x0B, 0x17, 0x00, 0x80, 0x73, 0x00, 0x44, 0xF1, 0x19, 0x0E, 0x31, 0x1A, 0x12, 0x38,
+    0x1A, 0x14, 0x43, 0x1A, 0x16, 0x43, 0x1A, 0x18, 0x43, 0x1A, 0x1A, 0x43, 0x1A, 0x1D, 0x43, 0x1A,
+    0x00, 0x44, 0x0A, 0x1A, 0x07, 0x10, 0x1A, 0x08, 0x10, 0x1A, 0x14, 0x10, 0x1A, 0x16, 0x17, 0x1A,
+    0x1A, 0x10, 0x1A, 0x1B, 0x10, 0x1A, 0x1D, 0x10, 0x1A, 0x00, 0x16, 0x00, 0x82, 0x69, 0x64, 0x00,
+    0x16, 0x00, 0x83, 0x61, 0x69, 0x64, 0x00, 0x44, 0x27, 0x1A, 0x07, 0x27, 0x1A, 0x08, 0x2D, 0x1A,
+    0x1A, 0x27, 0x1A, 0x1B, 0x27, 0x1A, 0x00, 0x84, 0x73, 0x61, 0x69, 0x64, 0x00, 0x6C, 0x27, 0x1A,
+    0x00, 0x04, 0x16, 0x00, 0x6C, 0x0C, 0x1A, 0x00, 0x44, 0x0A, 0x1A, 0x12, 0x3F, 0x1A, 0x00, 0x4A,
+    0x5A, 0x04, 0x00, 0x04, 0x00, 0x56, 0x0C, 0x1A, 0x00, 0x4C, 0xFE, 0x18, 0x0F, 0x53, 0x1A, 0x18,
+    0x5D, 0x1A, 0x00, 0x18, 0x12, 0x00, 0x46, 0x5A, 0x04, 0x1A, 0x5A, 0x04, 0x00, 0x12, 0x00, 0x46,
+    0x69, 0x1A, 0x0B, 0x6D, 0x1A, 0x1A, 0x69, 0x1A, 0x00, 0x81, 0x6C, 0x64, 0x00, 0x56, 0x69, 0x1A,
+    0x00, 0x48, 0x90, 0x1A, 0x09, 0x90, 0x1A, 0x0C, 0xA4, 0x1A, 0x0D, 0xD5, 0x1A, 0x0E, 0xDC, 0x1A,
+    0x12, 0xE2, 0x1A, 0x15, 0x1C, 0x1B, 0x17, 0x90, 0x1A, 0x18, 0x8A, 0x1B, 0x1C, 0xD5, 0x1A, 0x00,
+    0x52, 0x97, 0x1A, 0x15, 0x9E, 0x1A, 0x00, 0x1A, 0x00, 0x82, 0x72, 0x6C, 0x64, 0x00, 0x12, 0x00,
+    0x5A, 0xEB, 0x01, 0x00, 0x4B, 0xAE, 0x1A, 0x12, 0xB2, 0x1A, 0x18, 0xC5, 0x1A, 0x00, 0x5A, 0x58,
+    0x0A, 0x00, 0x46, 0xBC, 0x1A, 0x0B, 0xC1, 0x1A, 0x1A, 0xBC, 0x1A, 0x00, 0x82, 0x75, 0x6C, 0x64,
+    0x00, 0x56, 0xBC, 0x1A, 0x00, 0x12, 0x00, 0x46, 0xEB, 0x01, 0x0B, 0xD1, 0x1A, 0x1A, 0xEB, 0x01,
+    0x00, 0x56, 0xEB, 0x01, 0x00, 0x52, 0xB2, 0x1A, 0x18, 0xC5, 0x1A, 0x00, 0x18, 0x00, 0x52, 0xC7,
+    0x1A, 0x00, 0x4B, 0xEC, 0x1A, 0x15, 0xF4, 0x1A, 0x18, 0x05, 0x1B, 0x00, 0x16, 0x2C, 0x00, 0x81,
+    0x75, 0x6C, 0x64, 0x00, 0x52, 0xFB, 0x1A, 0x1A, 0xFF, 0x1A, 0x00, 0x5A, 0xEB, 0x01, 0x00, 0x83,
+    0x6F, 0x72, 0x6C, 0x64, 0x00, 0x46, 0x12, 0x1B, 0x0B, 0x18, 0x1B, 0x12, 0xC7, 0x1A, 0x1A, 0x12,
+    0x1B, 0x00, 0x83, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x56, 0x12, 0x1B, 0x00, 0x48, 0x35, 0x1B, 0x09,
+    0x35, 0x1B, 0x0C, 0x3D, 0x1B, 0x0F, 0x3D, 0x1B, 0x12, 0x48, 0x1B, 0x13, 0x3D, 0x1B, 0x17, 0x35,
+    0x1B, 0x1A, 0x86, 0x1B, 0x00, 0x12, 0x1A, 0x00, 0x83, 0x72, 0x6C, 0x64, 0x00, 0x52, 0x44, 0x1B,
+    0x1A, 0xFF, 0x1A, 0x00, 0x5A, 0x38, 0x1B, 0x00, 0x44, 0x61, 0x1B, 0x08, 0x61, 0x1B, 0x0C, 0x68,
+    0x1B, 0x0F, 0x68, 0x1B, 0x13, 0x68, 0x1B, 0x14, 0x61, 0x1B, 0x16, 0x61, 0x1B, 0x1A, 0x70, 0x1B,
+    0x00, 0x84, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x00, 0x1A, 0x00, 0x84, 0x6F, 0x72, 0x6C, 0x64, 0x00,
+    0x44, 0x7D, 0x1B, 0x08, 0x7D, 0x1B, 0x14, 0x7F, 0x1B, 0x16, 0x7F, 0x1B, 0x00, 0x2C, 0x00, 0x85,
+    0x77, 0x6F, 0x72, 0x6C, 0x64, 0x00, 0x52, 0x61, 0x1B, 0x00, 0x46, 0xA6, 0x1B, 0x0B, 0xAF, 0x1B,
+    0x0C, 0xC5, 0x1B, 0x0D, 0xE5, 0x1B, 0x0F, 0xC5, 0x1B, 0x12, 0xE9, 0x1B, 0x13, 0xC5, 0x1B, 0x1A,
+    0x84, 0x1C, 0x1C, 0xE5, 0x1B, 0x00, 0x12, 0x00, 0x84, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x52,
+    0xB6, 0x1B, 0x16, 0xBF, 0x1B, 0x00, 0x16, 0x00, 0x84, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x82,
+    0x6F, 0x75, 0x6C, 0x64, 0x00, 0x46, 0x12, 0x1B, 0x0B, 0x18, 0x1B, 0x12, 0xD2, 0x1B, 0x1A, 0x12,
+    0x1B, 0x00, 0x46, 0xDC, 0x1B, 0x0B, 0xE1, 0x1B, 0x1A, 0xDC, 0x1B, 0x00, 0x83, 0x75, 0x6C, 0x64,
+    0x00, 0x56, 0xDC, 0x1B, 0x00, 0x52, 0xD2, 0x1B, 0x00, 0x44, 0x20, 0x1C, 0x05, 0x27, 0x1C, 0x06,
+    0x36, 0x1C, 0x07, 0xA8, 0x1B, 0x08, 0x20, 0x1C, 0x0A, 0x27, 0x1C, 0x0B, 0x4A, 0x1C, 0x0C, 0x54,
+    0x1C, 0x0D, 0x27, 0x1C, 0x0F, 0x54, 0x1C, 0x11, 0x27, 0x1C, 0x13, 0x54, 0x1C, 0x14, 0x20, 0x1C,
+    0x16, 0x5E, 0x1C, 0x19, 0xA8, 0x1B, 0x1A, 0x70, 0x1C, 0x1B, 0xA8, 0x1B, 0x1C, 0x27, 0x1C, 0x00,
+    0x84, 0x77, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x4B, 0x2E, 0x1C, 0x16, 0xB8, 0x1B, 0x00, 0x16, 0x00,
+    0x84, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x47, 0x43, 0x1C, 0x16, 0x43, 0x1C, 0x19, 0x43, 0x1C, 0x1B,
+    0x43, 0x1C, 0x00, 0x85, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x2C, 0x00, 0x84, 0x73, 0x68, 0x6F,
+    0x75, 0x6C, 0x64, 0x00, 0x46, 0x30, 0x1C, 0x0B, 0x2E, 0x1C, 0x1A, 0x30, 0x1C, 0x00, 0x46, 0x30,
+    0x1C, 0x0B, 0x68, 0x1C, 0x1A, 0x30, 0x1C, 0x00, 0x85, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x00,
+    0x44, 0x7D, 0x1C, 0x08, 0x7D, 0x1C, 0x14, 0x7D, 0x1C, 0x16, 0x7D, 0x1C, 0x00, 0x85, 0x77, 0x6F,
+    0x75, 0x6C, 0x64, 0x00, 0x52, 0x20, 0x1C, 0x00, 0x45, 0xA4, 0x1C, 0x0B, 0xA4, 0x1C, 0x0C, 0xBE,
+    0x1C, 0x0D, 0x05, 0x1D, 0x0E, 0x1A, 0x1D, 0x10, 0xA4, 0x1C, 0x12, 0x20, 0x1D, 0x18, 0x2E, 0x1D,
+    0x1C, 0x18, 0x1E, 0x00, 0x4C, 0xAB, 0x1C, 0x18, 0xB1, 0x1C, 0x00, 0x09, 0x00, 0x82, 0x6E, 0x64,
+    0x00, 0x12, 0x00, 0x55, 0xBA, 0x1C, 0x16, 0xAD, 0x1C, 0x00, 0x44, 0xAD, 0x1C, 0x00, 0x46, 0xD7,
+    0x1C, 0x07, 0xD7, 0x1C, 0x09, 0xDE, 0x1C, 0x0A, 0xD7, 0x1C, 0x12, 0xF8, 0x1C, 0x15, 0xD7, 0x1C,
+    0x18, 0xFE, 0x1C, 0x19, 0xD7, 0x1C, 0x00, 0x09, 0x00, 0x83, 0x69, 0x6E, 0x64, 0x00, 0x46, 0xEE,
+    0x1C, 0x07, 0xEE, 0x1C, 0x0A, 0xEE, 0x1C, 0x15, 0xF4, 0x1C, 0x19, 0xEE, 0x1C, 0x00, 0x84, 0x66,
+    0x69, 0x6E, 0x64, 0x00, 0x6C, 0xEE, 0x1C, 0x00, 0x15, 0x00, 0x44, 0x25, 0x02, 0x00, 0x49, 0xD9,
+    0x1C, 0x12, 0xB3, 0x1C, 0x00, 0x4C, 0xAB, 0x1C, 0x12, 0x0F, 0x1D, 0x18, 0xB1, 0x1C, 0x00, 0x55,
+    0x16, 0x1D, 0x16, 0x25, 0x02, 0x00, 0x44, 0x25, 0x02, 0x00, 0x0C, 0x00, 0x49, 0xAD, 0x1C, 0x00,
+    0x4C, 0xAB, 0x1C, 0x18, 0x27, 0x1D, 0x00, 0x55, 0x4B, 0x02, 0x16, 0x4D, 0x02, 0x00, 0x4C, 0x47,
+    0x1D, 0x0D, 0x5F, 0x1D, 0x0F, 0x63, 0x1D, 0x12, 0x6D, 0x1D, 0x13, 0x00, 0x1E, 0x15, 0x0E, 0x1E,
+    0x16, 0x14, 0x1E, 0x1C, 0x5F, 0x1D, 0x00, 0x49, 0xAD, 0x1C, 0x12, 0x54, 0x1D, 0x15, 0x4B, 0x02,
+    0x16, 0x4D, 0x02, 0x00, 0x55, 0x5B, 0x1D, 0x16, 0x1C, 0x02, 0x00, 0x44, 0x1C, 0x02, 0x00, 0x52,
+    0x54, 0x1D, 0x00, 0x52, 0x54, 0x1D, 0x15, 0x4B, 0x02, 0x16, 0x4D, 0x02, 0x00, 0x44, 0x8C, 0x1D,
+    0x08, 0xA1, 0x1D, 0x09, 0xA8, 0x1D, 0x0C, 0xBA, 0x1D, 0x0F, 0xBA, 0x1D, 0x13, 0xC1, 0x1D, 0x15,
+    0xCC, 0x1D, 0x16, 0xEA, 0x1D, 0x17, 0xFA, 0x1D, 0x1B, 0xA1, 0x1D, 0x00, 0x55, 0x93, 0x1D, 0x16,
+    0x9B, 0x1D, 0x00, 0x85, 0x61, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x84, 0x6F, 0x75, 0x6E, 0x64,
+    0x00, 0x84, 0x73, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x44, 0xAF, 0x1D, 0x15, 0xB6, 0x1D, 0x00, 0x84,
+    0x72, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x44, 0x9B, 0x1D, 0x00, 0x55, 0xB6, 0x1D, 0x16, 0x9B, 0x1D,
+    0x00, 0x55, 0xB6, 0x1D, 0x16, 0xC8, 0x1D, 0x00, 0x6C, 0x9B, 0x1D, 0x00, 0x48, 0xE2, 0x1D, 0x09,
+    0xE2, 0x1D, 0x14, 0x93, 0x1D, 0x16, 0x93, 0x1D, 0x17, 0xE2, 0x1D, 0x1A, 0xE6, 0x1D, 0x1D, 0x93,
+    0x1D, 0x00, 0x44, 0x44, 0x02, 0x00, 0x6C, 0x93, 0x1D, 0x00, 0x44, 0x3A, 0x02, 0x07, 0x3A, 0x02,
+    0x08, 0x38, 0x02, 0x1A, 0x3A, 0x02, 0x1B, 0x3A, 0x02, 0x00, 0x15, 0x00, 0x44, 0x9B, 0x1D, 0x00,
+    0x52, 0x54, 0x1D, 0x15, 0x4B, 0x02, 0x16, 0x0A, 0x1E, 0x00, 0x6C, 0x4D, 0x02, 0x00, 0x12, 0x00,
+    0x44, 0xAF, 0x1D, 0x00, 0x52, 0xA1, 0x1D, 0x00, 0x52, 0x0F, 0x1D, 0x18, 0xB1, 0x1C, 0x00, 0x4C,
+    0x32, 0x1E, 0x0F, 0x3F, 0x1E, 0x12, 0x53, 0x1E, 0x13, 0x92, 0x1E, 0x15, 0x99, 0x1E, 0x18, 0x5D,
+    0x1A, 0x00, 0x44, 0x4A, 0x18, 0x12, 0x39, 0x1E, 0x00, 0x0A, 0x00, 0x82, 0x6F, 0x64, 0x00, 0x52,
+    0x39, 0x1E, 0x15, 0x49, 0x1E, 0x18, 0x4F, 0x1E, 0x00, 0x12, 0x1A, 0x00, 0x81, 0x64, 0x00, 0x52,
+    0x56, 0x1A, 0x00, 0x45, 0x6F, 0x1E, 0x09, 0x6F, 0x1E, 0x0A, 0x76, 0x1E, 0x0B, 0x8C, 0x1E, 0x0C,
+    0x6F, 0x1E, 0x0F, 0x6F, 0x1E, 0x13, 0x6F, 0x1E, 0x17, 0x6F, 0x1E, 0x19, 0x6F, 0x1E, 0x00, 0x0A,
+    0x00, 0x83, 0x6F, 0x6F, 0x64, 0x00, 0x45, 0x86, 0x1E, 0x09, 0x86, 0x1E, 0x0B, 0x86, 0x1E, 0x17,
+    0x86, 0x1E, 0x19, 0x86, 0x1E, 0x00, 0x84, 0x67, 0x6F, 0x6F, 0x64, 0x00, 0x0A, 0x00, 0x6C, 0x71,
+    0x1E, 0x00, 0x12, 0x0A, 0x00, 0x6C, 0x3B, 0x1E, 0x00, 0x12, 0x00, 0x5A, 0x69, 0x1A, 0x00, 0x12,
+    0x12, 0x0A, 0x00, 0x81, 0x64, 0x00, 0x44, 0xC5, 0x1E, 0x08, 0x0D, 0x20, 0x09, 0x29, 0x20, 0x0F,
+    0x33, 0x20, 0x12, 0x39, 0x20, 0x14, 0x51, 0x20, 0x16, 0x51, 0x20, 0x17, 0x29, 0x20, 0x1A, 0x51,
+    0x20, 0x1D, 0x51, 0x20, 0x00, 0x45, 0xE1, 0x1E, 0x0C, 0xFC, 0x1E, 0x0F, 0xFC, 0x1E, 0x12, 0x17,
+    0x1F, 0x13, 0xFC, 0x1E, 0x14, 0x04, 0x20, 0x16, 0x04, 0x20, 0x1A, 0x04, 0x20, 0x1D, 0x04, 0x20,
+    0x00, 0x52, 0xE8, 0x1E, 0x1C, 0xF3, 0x1E, 0x00, 0x1C, 0x08, 0x0E, 0x00, 0x84, 0x62, 0x6F, 0x61,
+    0x72, 0x64, 0x00, 0x08, 0x0E, 0x00, 0x82, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x45, 0x03, 0x1F, 0x12,
+    0x0D, 0x1F, 0x00, 0x1C, 0x08, 0x0E, 0x00, 0x83, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x05, 0x1C, 0x08,
+    0x0E, 0x00, 0x83, 0x61, 0x72, 0x64, 0x00, 0x45, 0x33, 0x1F, 0x0A, 0xCF, 0x1F, 0x0B, 0xCF, 0x1F,
+    0x0C, 0xE6, 0x1F, 0x0F, 0xE6, 0x1F, 0x11, 0xCF, 0x1F, 0x13, 0xE6, 0x1F, 0x19, 0xCF, 0x1F, 0x1C,
+    0xEE, 0x1F, 0x00, 0x48, 0x4C, 0x1F, 0x0A, 0x68, 0x1F, 0x0B, 0x73, 0x1F, 0x11, 0x68, 0x1F, 0x17,
+    0x73, 0x1F, 0x18, 0x73, 0x1F, 0x19, 0x68, 0x1F, 0x1C, 0x8A, 0x1F, 0x00, 0x4E, 0x53, 0x1F, 0x1C,
+    0x5D, 0x1F, 0x00, 0x2C, 0x00, 0x84, 0x79, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x0E, 0x00, 0x86,
+    0x65, 0x79, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x1C, 0x08, 0x0E, 0x00, 0x85, 0x62, 0x6F, 0x61,
+    0x72, 0x64, 0x00, 0x48, 0x7A, 0x1F, 0x1C, 0x84, 0x1F, 0x00, 0x0E, 0x00, 0x85, 0x79, 0x62, 0x6F,
+    0x61, 0x72, 0x64, 0x00, 0x08, 0x00, 0x4E, 0x6C, 0x1F, 0x00, 0x47, 0xA3, 0x1F, 0x08, 0xB4, 0x1F,
+    0x0B, 0xC0, 0x1F, 0x0E, 0xC6, 0x1F, 0x15, 0xA3, 0x1F, 0x17, 0xC0, 0x1F, 0x18, 0xC0, 0x1F, 0x1A,
+    0xA3, 0x1F, 0x00, 0x48, 0xAA, 0x1F, 0x0E, 0x5F, 0x1F, 0x00, 0x0E, 0x00, 0x86, 0x79, 0x62, 0x6F,
+    0x61, 0x72, 0x64, 0x00, 0x2C, 0x00, 0x86, 0x6B, 0x65, 0x79, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00,
+    0x08, 0x00, 0x4E, 0xAC, 0x1F, 0x00, 0x85, 0x65, 0x79, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x45,
+    0xD6, 0x1F, 0x1C, 0xE0, 0x1F, 0x00, 0x1C, 0x08, 0x0E, 0x00, 0x84, 0x6F, 0x61, 0x72, 0x64, 0x00,
+    0x08, 0x00, 0x4E, 0xEC, 0x1E, 0x00, 0x05, 0x1C, 0x08, 0x00, 0x4E, 0xDA, 0x1F, 0x00, 0x45, 0xF5,
+    0x1F, 0x08, 0xFB, 0x1F, 0x00, 0x08, 0x00, 0x4E, 0x7C, 0x1F, 0x00, 0x0E, 0x00, 0x83, 0x62, 0x6F,
+    0x61, 0x72, 0x64, 0x00, 0x12, 0x05, 0x1C, 0x08, 0x00, 0x4E, 0x12, 0x1F, 0x00, 0x44, 0x14, 0x20,
+    0x0B, 0x1E, 0x20, 0x00, 0x12, 0x05, 0x1C, 0x08, 0x0E, 0x00, 0x82, 0x72, 0x64, 0x00, 0x57, 0x25,
+    0x20, 0x1A, 0x25, 0x20, 0x00, 0x6C, 0x58, 0x0A, 0x00, 0x04, 0x12, 0x05, 0x1C, 0x08, 0x00, 0x4E,
+    0x1A, 0x20, 0x00, 0x12, 0x00, 0x5A, 0x99, 0x1A, 0x00, 0x44, 0x40, 0x20, 0x05, 0x48, 0x20, 0x00,
+    0x05, 0x1C, 0x08, 0x00, 0x4E, 0x07, 0x1F, 0x00, 0x1C, 0x08, 0x0E, 0x00, 0x81, 0x61, 0x72, 0x64,
+    0x00, 0x44, 0x14, 0x20, 0x12, 0x58, 0x20, 0x00, 0x05, 0x1C, 0x08, 0x00, 0x4E, 0x01, 0x18, 0x00,
+    0x74, 0x87, 0x15, 0x08, 0x70, 0x20, 0x0C, 0x7E, 0x20, 0x11, 0xCA, 0x19, 0x12, 0x85, 0x20, 0x00,
+    0x48, 0x3B, 0x18, 0x12, 0x7A, 0x20, 0x16, 0x3F, 0x18, 0x00, 0x07, 0x00, 0x80, 0x00, 0x44, 0x4A,
+    0x18, 0x0B, 0x7E, 0x19, 0x00, 0x4B, 0x8C, 0x20, 0x12, 0x3F, 0x1A, 0x00, 0x57, 0x58, 0x0A, 0x00,
+    0x04, 0x00, 0x52, 0x9B, 0x18, 0x17, 0x99, 0x20, 0x00, 0x56, 0x58, 0x0A, 0x00, 0x4C, 0xFE, 0x18,
+    0x0F, 0xAA, 0x20, 0x11, 0xAE, 0x20, 0x12, 0xB2, 0x20, 0x00, 0x52, 0xB2, 0x1A, 0x00, 0x52, 0x0F,
+    0x1D, 0x00, 0x4B, 0xB9, 0x20, 0x15, 0xBF, 0x20, 0x00, 0x16, 0x00, 0x80, 0x6C, 0x64, 0x00, 0x04,
+    0x00, 0x80, 0x6E, 0x64, 0x00, 0x48, 0x34, 0x18, 0x00, 0x48, 0x34, 0x18, 0x0C, 0xFE, 0x18, 0x11,
+    0xCA, 0x19, 0x12, 0x5C, 0x18, 0x00, 0x74, 0x22, 0x21, 0x04, 0x39, 0x21, 0x05, 0x86, 0x21, 0x06,
+    0xA6, 0x21, 0x07, 0x6B, 0x22, 0x08, 0x28, 0x23, 0x09, 0x18, 0x24, 0x0A, 0xB0, 0x24, 0x0B, 0xCC,
+    0x24, 0x0C, 0xD6, 0x24, 0x0D, 0x0A, 0x25, 0x0E, 0x25, 0x25, 0x0F, 0x3D, 0x26, 0x10, 0x63, 0x29,
+    0x11, 0x23, 0x2B, 0x12, 0xDA, 0x2C, 0x13, 0x2E, 0x2D, 0x15, 0x42, 0x2D, 0x16, 0x86, 0x32, 0x17,
+    0x19, 0x35, 0x18, 0x04, 0x36, 0x19, 0x31, 0x36, 0x1A, 0xF0, 0x36, 0x1B, 0x26, 0x37, 0x1C, 0x3F,
+    0x37, 0x00, 0x55, 0x29, 0x21, 0x18, 0x32, 0x21, 0x00, 0x18, 0x12, 0x1C, 0x00, 0x82, 0x27, 0x72,
+    0x65, 0x00, 0x12, 0x1C, 0x00, 0x80, 0x72, 0x65, 0x00, 0x48, 0x4F, 0x21, 0x12, 0x4F, 0x21, 0x15,
+    0x56, 0x21, 0x16, 0x61, 0x21, 0x17, 0x6E, 0x21, 0x18, 0x76, 0x21, 0x1A, 0x7E, 0x21, 0x00, 0x0B,
+    0x17, 0x00, 0x81, 0x73, 0x65, 0x00, 0x1A, 0x10, 0x15, 0x0C, 0x09, 0x00, 0x82, 0x61, 0x72, 0x65,
+    0x00, 0x48, 0x68, 0x21, 0x12, 0x68, 0x21, 0x00, 0x0B, 0x17, 0x00, 0x81, 0x65, 0x00, 0x17, 0x16,
+    0x00, 0x82, 0x61, 0x74, 0x65, 0x00, 0x04, 0x06, 0x08, 0x00, 0x45, 0x52, 0x21, 0x00, 0x10, 0x15,
+    0x0C, 0x00, 0x49, 0x35, 0x21, 0x00, 0x4C, 0x8D, 0x21, 0x19, 0x97, 0x21, 0x00, 0x0F, 0x08, 0x16,
+    0x04, 0x05, 0x00, 0x81, 0x6E, 0x65, 0x00, 0x44, 0x9E, 0x21, 0x12, 0xA2, 0x21, 0x00, 0x4B, 0x71,
+    0x02, 0x00, 0x4F, 0x71, 0x02, 0x00, 0x45, 0xC8, 0x21, 0x07, 0xDC, 0x21, 0x09, 0xE7, 0x21, 0x0B,
+    0xC8, 0x21, 0x0C, 0xED, 0x21, 0x0D, 0xC8, 0x21, 0x10, 0xC8, 0x21, 0x11, 0xF6, 0x21, 0x16, 0x3E,
+    0x01, 0x19, 0x61, 0x22, 0x1B, 0x3E, 0x01, 0x00, 0x4C, 0xCF, 0x21, 0x11, 0xD6, 0x21, 0x00, 0x16,
+    0x00, 0x82, 0x6E, 0x63, 0x65, 0x00, 0x0C, 0x00, 0x56, 0x42, 0x01, 0x00, 0x44, 0xE3, 0x21, 0x11,
+    0xD6, 0x21, 0x00, 0x50, 0x71, 0x02, 0x00, 0x0C, 0x0F, 0x00, 0x81, 0x65, 0x00, 0x11, 0x16, 0x00,
+    0x83, 0x69, 0x6E, 0x63, 0x65, 0x00, 0x45, 0x12, 0x22, 0x0B, 0x12, 0x22, 0x0C, 0x1A, 0x22, 0x0D,
+    0x12, 0x22, 0x0E, 0x52, 0x22, 0x10, 0x12, 0x22, 0x12, 0x52, 0x22, 0x16, 0x5D, 0x22, 0x18, 0x52,
+    0x22, 0x00, 0x0C, 0x16, 0x00, 0x83, 0x6E, 0x63, 0x65, 0x00, 0x44, 0x33, 0x22, 0x07, 0x33, 0x22,
+    0x0E, 0x3A, 0x22, 0x12, 0x3A, 0x22, 0x16, 0x42, 0x22, 0x18, 0x3A, 0x22, 0x1A, 0x3A, 0x22, 0x1B,
+    0x33, 0x22, 0x00, 0x84, 0x73, 0x69, 0x6E, 0x63, 0x65, 0x00, 0x16, 0x00, 0x84, 0x69, 0x6E, 0x63,
+    0x65, 0x00, 0x44, 0xB1, 0x02, 0x07, 0xB1, 0x02, 0x08, 0xB1, 0x02, 0x1A, 0xB1, 0x02, 0x1B, 0xB1,
+    0x02, 0x00, 0x4C, 0x59, 0x22, 0x16, 0xF0, 0x21, 0x00, 0x56, 0x15, 0x22, 0x00, 0x4C, 0x33, 0x22,
+    0x00, 0x44, 0x9E, 0x21, 0x11, 0xD6, 0x21, 0x12, 0xA2, 0x21, 0x00, 0x44, 0x99, 0x22, 0x06, 0xCA,
+    0x22, 0x08, 0xD1, 0x22, 0x09, 0xE3, 0x22, 0x0C, 0x72, 0x16, 0x0E, 0xEA, 0x22, 0x0F, 0xF8, 0x22,
+    0x10, 0xFE, 0x22, 0x12, 0x1A, 0x23, 0x14, 0xCA, 0x22, 0x15, 0x21, 0x23, 0x18, 0x76, 0x21, 0x19,
+    0x97, 0x21, 0x1A, 0xCA, 0x22, 0x1B, 0xCA, 0x22, 0x00, 0x4D, 0xAF, 0x22, 0x0E, 0xAF, 0x22, 0x10,
+    0xB6, 0x22, 0x14, 0xAF, 0x22, 0x16, 0xAF, 0x22, 0x1A, 0xAF, 0x22, 0x1D, 0xAF, 0x22, 0x00, 0x10,
+    0x00, 0x83, 0x61, 0x64, 0x65, 0x00, 0x4D, 0xC0, 0x22, 0x0E, 0xC0, 0x22, 0x11, 0xC6, 0x22, 0x00,
+    0x84, 0x6D, 0x61, 0x64, 0x65, 0x00, 0x6C, 0xC0, 0x22, 0x00, 0x04, 0x10, 0x00, 0x82, 0x64, 0x65,
+    0x00, 0x44, 0xDB, 0x22, 0x0B, 0xDF, 0x22, 0x16, 0x6E, 0x16, 0x00, 0x50, 0xCD, 0x22, 0x00, 0x57,
+    0x52, 0x21, 0x00, 0x44, 0xDB, 0x22, 0x0C, 0xA2, 0x21, 0x00, 0x44, 0xF1, 0x22, 0x0C, 0xA2, 0x21,
+    0x00, 0x50, 0x71, 0x02, 0x17, 0x71, 0x02, 0x00, 0x18, 0x12, 0x06, 0x00, 0x80, 0x00, 0x44, 0x08,
+    0x23, 0x0C, 0x0C, 0x23, 0x12, 0x10, 0x23, 0x00, 0x56, 0x71, 0x02, 0x00, 0x57, 0x71, 0x02, 0x00,
+    0x46, 0x71, 0x02, 0x0B, 0x71, 0x02, 0x16, 0x71, 0x02, 0x00, 0x0B, 0x17, 0x00, 0x6C, 0x52, 0x21,
+    0x00, 0x0B, 0x17, 0x00, 0x81, 0x65, 0x65, 0x00, 0x47, 0x47, 0x23, 0x08, 0x4C, 0x23, 0x09, 0x59,
+    0x23, 0x0B, 0x6E, 0x23, 0x11, 0x77, 0x23, 0x12, 0x4F, 0x21, 0x15, 0x82, 0x23, 0x16, 0xF1, 0x23,
+    0x17, 0x02, 0x24, 0x19, 0x12, 0x24, 0x00, 0x04, 0x10, 0x00, 0x80, 0x00, 0x4B, 0x53, 0x23, 0x15,
+    0x91, 0x15, 0x00, 0x1A, 0x00, 0x81, 0x72, 0x65, 0x00, 0x4B, 0x60, 0x23, 0x15, 0x67, 0x23, 0x00,
     0x17, 0x00, 0x82, 0x72, 0x65, 0x65, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x65, 0x65, 0x00, 0x15, 0x17,
     0x00, 0x83, 0x68, 0x72, 0x65, 0x65, 0x00, 0x12, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x80,
-    0x73, 0x00, 0x0B, 0x17, 0x00, 0x81, 0x73, 0x65, 0x00, 0x48, 0x45, 0x36, 0x09, 0x49, 0x36, 0x0A,
-    0x51, 0x36, 0x0B, 0x59, 0x36, 0x0D, 0xC3, 0x36, 0x11, 0xD7, 0x36, 0x15, 0xEB, 0x36, 0x17, 0xF2,
-    0x36, 0x1C, 0xFC, 0x36, 0x00, 0x1A, 0x00, 0x80, 0x00, 0x0B, 0x17, 0x00, 0x83, 0x72, 0x65, 0x65,
-    0x00, 0x0B, 0x17, 0x00, 0x83, 0x72, 0x65, 0x65, 0x00, 0x45, 0x72, 0x36, 0x0A, 0x7A, 0x36, 0x0D,
-    0x81, 0x36, 0x11, 0x89, 0x36, 0x15, 0x91, 0x36, 0x17, 0x98, 0x36, 0x1A, 0xB7, 0x36, 0x1C, 0xBC,
-    0x36, 0x00, 0x17, 0x00, 0x84, 0x68, 0x72, 0x65, 0x65, 0x00, 0x84, 0x74, 0x68, 0x72, 0x65, 0x65,
-    0x00, 0x17, 0x00, 0x84, 0x68, 0x72, 0x65, 0x65, 0x00, 0x17, 0x00, 0x84, 0x68, 0x72, 0x65, 0x65,
-    0x00, 0x84, 0x74, 0x68, 0x72, 0x65, 0x65, 0x00, 0x4A, 0xA2, 0x36, 0x15, 0xA9, 0x36, 0x1C, 0xB0,
-    0x36, 0x00, 0x85, 0x74, 0x68, 0x72, 0x65, 0x65, 0x00, 0x85, 0x74, 0x68, 0x72, 0x65, 0x65, 0x00,
-    0x85, 0x74, 0x68, 0x72, 0x65, 0x65, 0x00, 0x82, 0x65, 0x72, 0x65, 0x00, 0x84, 0x74, 0x68, 0x72,
-    0x65, 0x65, 0x00, 0x4B, 0xCA, 0x36, 0x17, 0xD1, 0x36, 0x00, 0x17, 0x00, 0x83, 0x72, 0x65, 0x65,
-    0x00, 0x83, 0x68, 0x72, 0x65, 0x65, 0x00, 0x4B, 0xDE, 0x36, 0x17, 0xE5, 0x36, 0x00, 0x17, 0x00,
-    0x83, 0x72, 0x65, 0x65, 0x00, 0x83, 0x68, 0x72, 0x65, 0x65, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x65,
-    0x65, 0x00, 0x0B, 0x2C, 0x00, 0x84, 0x74, 0x68, 0x72, 0x65, 0x65, 0x00, 0x4B, 0x03, 0x37, 0x17,
-    0x0A, 0x37, 0x00, 0x17, 0x00, 0x83, 0x72, 0x65, 0x65, 0x00, 0x83, 0x68, 0x72, 0x65, 0x65, 0x00,
-    0x48, 0x1A, 0x37, 0x0B, 0x1F, 0x37, 0x12, 0x26, 0x37, 0x00, 0x0B, 0x17, 0x00, 0x80, 0x00, 0x17,
-    0x00, 0x82, 0x65, 0x73, 0x65, 0x00, 0x0B, 0x17, 0x00, 0x80, 0x00, 0x49, 0x35, 0x37, 0x0B, 0x3B,
-    0x37, 0x15, 0x42, 0x37, 0x00, 0x04, 0x2C, 0x00, 0x80, 0x72, 0x00, 0x17, 0x00, 0x82, 0x72, 0x65,
-    0x65, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x65, 0x65, 0x00, 0x08, 0x11, 0x00, 0x80, 0x72, 0x00, 0x74,
-    0x74, 0x37, 0x04, 0x7C, 0x37, 0x06, 0x86, 0x37, 0x07, 0x8D, 0x37, 0x08, 0x9F, 0x37, 0x0A, 0xB0,
-    0x37, 0x0C, 0xB7, 0x37, 0x0E, 0xE4, 0x37, 0x12, 0xEB, 0x37, 0x15, 0xF3, 0x37, 0x18, 0x05, 0x38,
-    0x19, 0x1A, 0x38, 0x00, 0x18, 0x12, 0x1C, 0x00, 0x81, 0x72, 0x65, 0x00, 0x1A, 0x10, 0x15, 0x0C,
-    0x09, 0x00, 0x81, 0x72, 0x65, 0x00, 0x0C, 0x0F, 0x00, 0x82, 0x66, 0x65, 0x00, 0x44, 0x94, 0x37,
-    0x0C, 0x99, 0x37, 0x00, 0x10, 0x00, 0x81, 0x65, 0x00, 0x0F, 0x00, 0x82, 0x66, 0x65, 0x00, 0x0B,
-    0x00, 0x57, 0xA8, 0x37, 0x1A, 0xAC, 0x37, 0x00, 0x81, 0x72, 0x65, 0x00, 0x81, 0x72, 0x65, 0x00,
-    0x0C, 0x0F, 0x00, 0x82, 0x66, 0x65, 0x00, 0x4E, 0xC1, 0x37, 0x0F, 0xC8, 0x37, 0x12, 0xDD, 0x37,
-    0x00, 0x0F, 0x00, 0x83, 0x69, 0x66, 0x65, 0x00, 0x4E, 0xCF, 0x37, 0x12, 0xD5, 0x37, 0x00, 0x84,
-    0x6C, 0x69, 0x66, 0x65, 0x00, 0x2C, 0x00, 0x84, 0x6C, 0x69, 0x66, 0x65, 0x00, 0x0F, 0x00, 0x83,
-    0x69, 0x66, 0x65, 0x00, 0x0C, 0x0F, 0x00, 0x82, 0x66, 0x65, 0x00, 0x09, 0x08, 0x05, 0x00, 0x81,
-    0x72, 0x65, 0x00, 0x4C, 0xFA, 0x37, 0x12, 0x00, 0x38, 0x00, 0x0F, 0x00, 0x82, 0x66, 0x65, 0x00,
-    0x10, 0x00, 0x81, 0x65, 0x00, 0x4C, 0x0C, 0x38, 0x16, 0x12, 0x38, 0x00, 0x0F, 0x00, 0x82, 0x66,
-    0x65, 0x00, 0x04, 0x08, 0x10, 0x00, 0x81, 0x72, 0x65, 0x00, 0x44, 0x24, 0x38, 0x0C, 0x29, 0x38,
-    0x12, 0x2F, 0x38, 0x00, 0x0B, 0x00, 0x81, 0x65, 0x00, 0x0F, 0x00, 0x82, 0x66, 0x65, 0x00, 0x0F,
-    0x00, 0x81, 0x65, 0x00, 0x49, 0x41, 0x38, 0x11, 0x47, 0x38, 0x17, 0x4F, 0x38, 0x19, 0x56, 0x38,
-    0x00, 0x0C, 0x0F, 0x00, 0x81, 0x65, 0x00, 0x0C, 0x0B, 0x17, 0x2C, 0x00, 0x80, 0x73, 0x00, 0x04,
-    0x17, 0x16, 0x00, 0x81, 0x65, 0x00, 0x44, 0x5D, 0x38, 0x12, 0x62, 0x38, 0x00, 0x0B, 0x00, 0x81,
-    0x65, 0x00, 0x0F, 0x00, 0x81, 0x65, 0x00, 0x0C, 0x0F, 0x08, 0x16, 0x04, 0x05, 0x00, 0x81, 0x6E,
-    0x65, 0x00, 0x48, 0x7F, 0x38, 0x0E, 0x85, 0x38, 0x0F, 0x9E, 0x38, 0x11, 0xB4, 0x38, 0x00, 0x0B,
-    0x17, 0x00, 0x80, 0x72, 0x00, 0x44, 0x8C, 0x38, 0x0C, 0x99, 0x38, 0x00, 0x50, 0x93, 0x38, 0x17,
-    0x96, 0x38, 0x00, 0x81, 0x65, 0x00, 0x81, 0x65, 0x00, 0x0F, 0x00, 0x81, 0x65, 0x00, 0x48, 0xA5,
-    0x38, 0x0B, 0xAD, 0x38, 0x00, 0x16, 0x04, 0x05, 0x00, 0x80, 0x6E, 0x65, 0x00, 0x1A, 0x00, 0x82,
-    0x69, 0x6C, 0x65, 0x00, 0x0F, 0x08, 0x16, 0x04, 0x05, 0x00, 0x82, 0x69, 0x6E, 0x65, 0x00, 0x4C,
-    0xC9, 0x38, 0x0E, 0xD3, 0x38, 0x10, 0xEC, 0x38, 0x00, 0x0F, 0x08, 0x16, 0x04, 0x05, 0x00, 0x81,
-    0x6E, 0x65, 0x00, 0x44, 0xDA, 0x38, 0x0C, 0xE7, 0x38, 0x00, 0x50, 0xE1, 0x38, 0x17, 0xE4, 0x38,
-    0x00, 0x81, 0x65, 0x00, 0x81, 0x65, 0x00, 0x0F, 0x00, 0x81, 0x65, 0x00, 0x44, 0xF6, 0x38, 0x0C,
-    0x03, 0x39, 0x12, 0x08, 0x39, 0x00, 0x4A, 0xFD, 0x38, 0x16, 0x00, 0x39, 0x00, 0x81, 0x65, 0x00,
-    0x81, 0x65, 0x00, 0x17, 0x00, 0x81, 0x65, 0x00, 0x46, 0x12, 0x39, 0x0B, 0x15, 0x39, 0x16, 0x18,
-    0x39, 0x00, 0x81, 0x65, 0x00, 0x81, 0x65, 0x00, 0x81, 0x65, 0x00, 0x44, 0x43, 0x39, 0x0C, 0x0C,
-    0x3A, 0x0D, 0x57, 0x3A, 0x0E, 0x73, 0x3A, 0x0F, 0x79, 0x3A, 0x10, 0x96, 0x3A, 0x12, 0xC5, 0x3A,
-    0x13, 0xDA, 0x3A, 0x14, 0xE2, 0x3A, 0x17, 0xF3, 0x3A, 0x18, 0xFB, 0x3A, 0x1A, 0x02, 0x3B, 0x1D,
-    0x09, 0x3B, 0x00, 0x4A, 0x68, 0x39, 0x0D, 0x6F, 0x39, 0x0E, 0x76, 0x39, 0x10, 0x7D, 0x39, 0x11,
-    0x92, 0x39, 0x14, 0x99, 0x39, 0x15, 0xAA, 0x39, 0x16, 0xB2, 0x39, 0x17, 0xC3, 0x39, 0x1A, 0xE1,
-    0x39, 0x1C, 0xF4, 0x39, 0x1D, 0xFB, 0x39, 0x00, 0x17, 0x00, 0x83, 0x61, 0x6B, 0x65, 0x00, 0x10,
-    0x00, 0x83, 0x61, 0x6B, 0x65, 0x00, 0x10, 0x00, 0x83, 0x61, 0x6B, 0x65, 0x00, 0x4D, 0x84, 0x39,
-    0x11, 0x8A, 0x39, 0x00, 0x84, 0x6D, 0x61, 0x6B, 0x65, 0x00, 0x2C, 0x00, 0x84, 0x6D, 0x61, 0x6B,
-    0x65, 0x00, 0x10, 0x00, 0x83, 0x61, 0x6B, 0x65, 0x00, 0x50, 0xA0, 0x39, 0x17, 0xA5, 0x39, 0x00,
-    0x83, 0x61, 0x6B, 0x65, 0x00, 0x83, 0x61, 0x6B, 0x65, 0x00, 0x17, 0x2C, 0x00, 0x83, 0x61, 0x6B,
-    0x65, 0x00, 0x50, 0xB9, 0x39, 0x17, 0xBE, 0x39, 0x00, 0x83, 0x61, 0x6B, 0x65, 0x00, 0x83, 0x61,
-    0x6B, 0x65, 0x00, 0x4A, 0xCD, 0x39, 0x15, 0xD3, 0x39, 0x1C, 0xDB, 0x39, 0x00, 0x84, 0x74, 0x61,
-    0x6B, 0x65, 0x00, 0x2C, 0x00, 0x84, 0x74, 0x61, 0x6B, 0x65, 0x00, 0x84, 0x74, 0x61, 0x6B, 0x65,
-    0x00, 0x50, 0xE8, 0x39, 0x17, 0xED, 0x39, 0x00, 0x83, 0x61, 0x6B, 0x65, 0x00, 0x2C, 0x00, 0x83,
-    0x61, 0x6B, 0x65, 0x00, 0x17, 0x00, 0x83, 0x61, 0x6B, 0x65, 0x00, 0x50, 0x02, 0x3A, 0x17, 0x07,
-    0x3A, 0x00, 0x83, 0x61, 0x6B, 0x65, 0x00, 0x83, 0x61, 0x6B, 0x65, 0x00, 0x44, 0x1F, 0x3A, 0x0C,
-    0x25, 0x3A, 0x0E, 0x2B, 0x3A, 0x0F, 0x32, 0x3A, 0x12, 0x49, 0x3A, 0x18, 0x50, 0x3A, 0x00, 0x17,
-    0x00, 0x82, 0x6B, 0x65, 0x00, 0x0F, 0x00, 0x82, 0x6B, 0x65, 0x00, 0x0F, 0x00, 0x83, 0x69, 0x6B,
-    0x65, 0x00, 0x4E, 0x39, 0x3A, 0x12, 0x41, 0x3A, 0x00, 0x2C, 0x00, 0x84, 0x6C, 0x69, 0x6B, 0x65,
-    0x00, 0x2C, 0x00, 0x84, 0x6C, 0x69, 0x6B, 0x65, 0x00, 0x0F, 0x00, 0x83, 0x69, 0x6B, 0x65, 0x00,
-    0x0F, 0x00, 0x83, 0x69, 0x6B, 0x65, 0x00, 0x44, 0x5E, 0x3A, 0x0C, 0x6D, 0x3A, 0x00, 0x50, 0x65,
-    0x3A, 0x17, 0x69, 0x3A, 0x00, 0x82, 0x6B, 0x65, 0x00, 0x82, 0x6B, 0x65, 0x00, 0x0F, 0x00, 0x82,
-    0x6B, 0x65, 0x00, 0x0C, 0x0F, 0x00, 0x81, 0x65, 0x00, 0x44, 0x80, 0x3A, 0x0C, 0x86, 0x3A, 0x00,
-    0x10, 0x00, 0x82, 0x6B, 0x65, 0x00, 0x4B, 0x8D, 0x3A, 0x0F, 0x92, 0x3A, 0x00, 0x1A, 0x00, 0x81,
-    0x65, 0x00, 0x82, 0x6B, 0x65, 0x00, 0x44, 0xA0, 0x3A, 0x0C, 0xAD, 0x3A, 0x12, 0xB2, 0x3A, 0x00,
-    0x4A, 0xA7, 0x3A, 0x16, 0xAA, 0x3A, 0x00, 0x81, 0x65, 0x00, 0x81, 0x65, 0x00, 0x17, 0x00, 0x81,
-    0x65, 0x00, 0x46, 0xBC, 0x3A, 0x0B, 0xBF, 0x3A, 0x16, 0xC2, 0x3A, 0x00, 0x81, 0x65, 0x00, 0x81,
-    0x65, 0x00, 0x81, 0x65, 0x00, 0x4B, 0xCC, 0x3A, 0x0C, 0xD4, 0x3A, 0x00, 0x16, 0x16, 0x04, 0x00,
-    0x81, 0x6C, 0x65, 0x00, 0x0F, 0x00, 0x82, 0x6B, 0x65, 0x00, 0x12, 0x08, 0x13, 0x00, 0x81, 0x6C,
-    0x65, 0x00, 0x04, 0x00, 0x50, 0xEB, 0x3A, 0x17, 0xEF, 0x3A, 0x00, 0x82, 0x6B, 0x65, 0x00, 0x82,
-    0x6B, 0x65, 0x00, 0x17, 0x0C, 0x0F, 0x00, 0x81, 0x6C, 0x65, 0x00, 0x0C, 0x0F, 0x00, 0x82, 0x6B,
-    0x65, 0x00, 0x04, 0x10, 0x00, 0x82, 0x6B, 0x65, 0x00, 0x04, 0x00, 0x50, 0x12, 0x3B, 0x17, 0x16,
-    0x3B, 0x00, 0x82, 0x6B, 0x65, 0x00, 0x82, 0x6B, 0x65, 0x00, 0x4A, 0x3C, 0x3B, 0x0B, 0x53, 0x3B,
-    0x0C, 0x77, 0x3B, 0x0E, 0xA2, 0x3C, 0x0F, 0xF2, 0x3C, 0x12, 0xFC, 0x3C, 0x13, 0x58, 0x3F, 0x15,
-    0x48, 0x40, 0x17, 0x69, 0x40, 0x18, 0x4F, 0x41, 0x1C, 0x6C, 0x41, 0x00, 0x17, 0x00, 0x4C, 0x45,
-    0x3B, 0x17, 0x4C, 0x3B, 0x00, 0x0F, 0x00, 0x82, 0x74, 0x6C, 0x65, 0x00, 0x0C, 0x0F, 0x00, 0x82,
-    0x6C, 0x65, 0x00, 0x4C, 0x5D, 0x3B, 0x12, 0x65, 0x3B, 0x16, 0x6F, 0x3B, 0x00, 0x1A, 0x00, 0x83,
-    0x68, 0x69, 0x6C, 0x65, 0x00, 0x16, 0x16, 0x04, 0x00, 0x83, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x16,
-    0x04, 0x00, 0x81, 0x6F, 0x6C, 0x65, 0x00, 0x45, 0x96, 0x3B, 0x0A, 0xAA, 0x3B, 0x0B, 0xBE, 0x3B,
-    0x0D, 0x38, 0x3C, 0x0E, 0x4C, 0x3C, 0x11, 0x54, 0x3C, 0x12, 0x68, 0x3C, 0x18, 0x7D, 0x3C, 0x1A,
-    0x85, 0x3C, 0x1C, 0x8E, 0x3C, 0x00, 0x4B, 0x9D, 0x3B, 0x1A, 0xA4, 0x3B, 0x00, 0x1A, 0x00, 0x83,
-    0x69, 0x6C, 0x65, 0x00, 0x83, 0x68, 0x69, 0x6C, 0x65, 0x00, 0x4B, 0xB1, 0x3B, 0x1A, 0xB8, 0x3B,
-    0x00, 0x1A, 0x00, 0x83, 0x69, 0x6C, 0x65, 0x00, 0x83, 0x68, 0x69, 0x6C, 0x65, 0x00, 0x45, 0xDA,
-    0x3B, 0x08, 0xE2, 0x3B, 0x0A, 0xE9, 0x3B, 0x0D, 0xF1, 0x3B, 0x11, 0xF9, 0x3B, 0x14, 0x01, 0x3C,
-    0x16, 0x08, 0x3C, 0x1A, 0x0F, 0x3C, 0x1C, 0x30, 0x3C, 0x00, 0x1A, 0x00, 0x84, 0x68, 0x69, 0x6C,
-    0x65, 0x00, 0x84, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x00, 0x1A, 0x00, 0x84, 0x68, 0x69, 0x6C, 0x65,
-    0x00, 0x1A, 0x00, 0x84, 0x68, 0x69, 0x6C, 0x65, 0x00, 0x1A, 0x00, 0x84, 0x68, 0x69, 0x6C, 0x65,
-    0x00, 0x84, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x00, 0x84, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x00, 0x48,
-    0x19, 0x3C, 0x14, 0x22, 0x3C, 0x16, 0x29, 0x3C, 0x00, 0x2C, 0x00, 0x85, 0x77, 0x68, 0x69, 0x6C,
-    0x65, 0x00, 0x85, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x00, 0x85, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x00,
-    0x1A, 0x00, 0x84, 0x68, 0x69, 0x6C, 0x65, 0x00, 0x4B, 0x3F, 0x3C, 0x1A, 0x46, 0x3C, 0x00, 0x1A,
-    0x00, 0x83, 0x69, 0x6C, 0x65, 0x00, 0x83, 0x68, 0x69, 0x6C, 0x65, 0x00, 0x0B, 0x1A, 0x00, 0x83,
-    0x69, 0x6C, 0x65, 0x00, 0x4B, 0x5B, 0x3C, 0x1A, 0x62, 0x3C, 0x00, 0x1A, 0x00, 0x83, 0x69, 0x6C,
-    0x65, 0x00, 0x83, 0x68, 0x69, 0x6C, 0x65, 0x00, 0x0B, 0x00, 0x56, 0x71, 0x3C, 0x1A, 0x78, 0x3C,
-    0x00, 0x16, 0x04, 0x00, 0x82, 0x6C, 0x65, 0x00, 0x83, 0x69, 0x6C, 0x65, 0x00, 0x0B, 0x1A, 0x00,
-    0x83, 0x69, 0x6C, 0x65, 0x00, 0x0B, 0x00, 0x84, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x00, 0x4B, 0x95,
-    0x3C, 0x1A, 0x9C, 0x3C, 0x00, 0x1A, 0x00, 0x83, 0x69, 0x6C, 0x65, 0x00, 0x83, 0x68, 0x69, 0x6C,
-    0x65, 0x00, 0x44, 0xB5, 0x3C, 0x0B, 0xC2, 0x3C, 0x0C, 0xC9, 0x3C, 0x12, 0xD9, 0x3C, 0x13, 0xE2,
-    0x3C, 0x17, 0xEA, 0x3C, 0x00, 0x50, 0xBC, 0x3C, 0x17, 0xBF, 0x3C, 0x00, 0x81, 0x65, 0x00, 0x81,
-    0x65, 0x00, 0x1A, 0x00, 0x82, 0x69, 0x6C, 0x65, 0x00, 0x4B, 0xD0, 0x3C, 0x0F, 0xD6, 0x3C, 0x00,
-    0x1A, 0x00, 0x82, 0x6C, 0x65, 0x00, 0x81, 0x65, 0x00, 0x0B, 0x16, 0x16, 0x04, 0x00, 0x82, 0x6C,
-    0x65, 0x00, 0x12, 0x08, 0x13, 0x00, 0x82, 0x6C, 0x65, 0x00, 0x17, 0x0C, 0x0F, 0x00, 0x82, 0x6C,
-    0x65, 0x00, 0x0B, 0x16, 0x16, 0x04, 0x00, 0x82, 0x6F, 0x6C, 0x65, 0x00, 0x45, 0x24, 0x3D, 0x08,
-    0x3D, 0x3D, 0x0A, 0x45, 0x3D, 0x0B, 0x5E, 0x3D, 0x0C, 0xA3, 0x3E, 0x0D, 0xB8, 0x3E, 0x0F, 0xD1,
-    0x3E, 0x11, 0xDB, 0x3E, 0x12, 0xF4, 0x3E, 0x13, 0x0A, 0x3F, 0x16, 0x2C, 0x3F, 0x17, 0x37, 0x3F,
-    0x1C, 0x3F, 0x3F, 0x00, 0x4B, 0x2B, 0x3D, 0x16, 0x34, 0x3D, 0x00, 0x16, 0x16, 0x04, 0x00, 0x83,
-    0x6F, 0x6C, 0x65, 0x00, 0x16, 0x04, 0x00, 0x83, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x13, 0x2C, 0x00,
-    0x81, 0x70, 0x6C, 0x65, 0x00, 0x4B, 0x4C, 0x3D, 0x16, 0x55, 0x3D, 0x00, 0x16, 0x16, 0x04, 0x00,
-    0x83, 0x6F, 0x6C, 0x65, 0x00, 0x16, 0x04, 0x00, 0x83, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x44, 0x80,
-    0x3D, 0x05, 0x98, 0x3D, 0x07, 0xA2, 0x3D, 0x08, 0xBA, 0x3D, 0x0A, 0xD4, 0x3D, 0x0D, 0xDE, 0x3D,
-    0x11, 0xE8, 0x3D, 0x16, 0xF2, 0x3D, 0x1A, 0x69, 0x3E, 0x1B, 0x81, 0x3E, 0x1C, 0x99, 0x3E, 0x00,
-    0x16, 0x00, 0x44, 0x89, 0x3D, 0x16, 0x90, 0x3D, 0x00, 0x84, 0x73, 0x68, 0x6F, 0x6C, 0x65, 0x00,
-    0x04, 0x00, 0x84, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x16, 0x16, 0x04, 0x00, 0x84, 0x68, 0x6F, 0x6C,
-    0x65, 0x00, 0x16, 0x00, 0x44, 0xAB, 0x3D, 0x16, 0xB2, 0x3D, 0x00, 0x84, 0x73, 0x68, 0x6F, 0x6C,
-    0x65, 0x00, 0x04, 0x00, 0x84, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x16, 0x00, 0x44, 0xC3, 0x3D, 0x16,
-    0xCC, 0x3D, 0x00, 0x2C, 0x00, 0x84, 0x73, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x04, 0x00, 0x84, 0x68,
-    0x6F, 0x6C, 0x65, 0x00, 0x16, 0x16, 0x04, 0x00, 0x84, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x16, 0x16,
-    0x04, 0x00, 0x84, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x16, 0x16, 0x04, 0x00, 0x84, 0x68, 0x6F, 0x6C,
-    0x65, 0x00, 0x44, 0x02, 0x3E, 0x07, 0x09, 0x3E, 0x08, 0x21, 0x3E, 0x1A, 0x39, 0x3E, 0x1B, 0x51,
-    0x3E, 0x00, 0x83, 0x73, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x44, 0x10, 0x3E, 0x16, 0x18, 0x3E, 0x00,
-    0x85, 0x73, 0x73, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x04, 0x00, 0x85, 0x73, 0x68, 0x6F, 0x6C, 0x65,
-    0x00, 0x44, 0x28, 0x3E, 0x16, 0x30, 0x3E, 0x00, 0x85, 0x73, 0x73, 0x68, 0x6F, 0x6C, 0x65, 0x00,
-    0x04, 0x00, 0x85, 0x73, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x44, 0x40, 0x3E, 0x16, 0x48, 0x3E, 0x00,
-    0x85, 0x73, 0x73, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x04, 0x00, 0x85, 0x73, 0x68, 0x6F, 0x6C, 0x65,
-    0x00, 0x44, 0x58, 0x3E, 0x16, 0x60, 0x3E, 0x00, 0x85, 0x73, 0x73, 0x68, 0x6F, 0x6C, 0x65, 0x00,
-    0x04, 0x00, 0x85, 0x73, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x16, 0x00, 0x44, 0x72, 0x3E, 0x16, 0x79,
-    0x3E, 0x00, 0x84, 0x73, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x04, 0x00, 0x84, 0x68, 0x6F, 0x6C, 0x65,
-    0x00, 0x16, 0x00, 0x44, 0x8A, 0x3E, 0x16, 0x91, 0x3E, 0x00, 0x84, 0x73, 0x68, 0x6F, 0x6C, 0x65,
-    0x00, 0x04, 0x00, 0x84, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x16, 0x16, 0x04, 0x00, 0x84, 0x68, 0x6F,
-    0x6C, 0x65, 0x00, 0x0B, 0x00, 0x56, 0xAC, 0x3E, 0x1A, 0xB4, 0x3E, 0x00, 0x16, 0x04, 0x00, 0x83,
-    0x6F, 0x6C, 0x65, 0x00, 0x82, 0x6C, 0x65, 0x00, 0x4B, 0xBF, 0x3E, 0x16, 0xC8, 0x3E, 0x00, 0x16,
-    0x16, 0x04, 0x00, 0x83, 0x6F, 0x6C, 0x65, 0x00, 0x16, 0x04, 0x00, 0x83, 0x68, 0x6F, 0x6C, 0x65,
-    0x00, 0x0B, 0x16, 0x16, 0x04, 0x00, 0x83, 0x6F, 0x6C, 0x65, 0x00, 0x4B, 0xE2, 0x3E, 0x16, 0xEB,
-    0x3E, 0x00, 0x16, 0x16, 0x04, 0x00, 0x83, 0x6F, 0x6C, 0x65, 0x00, 0x16, 0x04, 0x00, 0x83, 0x68,
-    0x6F, 0x6C, 0x65, 0x00, 0x48, 0xFB, 0x3E, 0x0B, 0x02, 0x3F, 0x00, 0x13, 0x00, 0x82, 0x70, 0x6C,
-    0x65, 0x00, 0x16, 0x16, 0x04, 0x00, 0x82, 0x6C, 0x65, 0x00, 0x48, 0x14, 0x3F, 0x0B, 0x1C, 0x3F,
-    0x12, 0x25, 0x3F, 0x00, 0x13, 0x00, 0x83, 0x6F, 0x70, 0x6C, 0x65, 0x00, 0x16, 0x16, 0x04, 0x00,
-    0x83, 0x6F, 0x6C, 0x65, 0x00, 0x08, 0x13, 0x00, 0x82, 0x6C, 0x65, 0x00, 0x0B, 0x16, 0x04, 0x00,
-    0x84, 0x73, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x17, 0x0C, 0x0F, 0x00, 0x82, 0x6C, 0x65, 0x00, 0x4B,
-    0x46, 0x3F, 0x16, 0x4F, 0x3F, 0x00, 0x16, 0x16, 0x04, 0x00, 0x83, 0x6F, 0x6C, 0x65, 0x00, 0x16,
-    0x04, 0x00, 0x83, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x48, 0x6B, 0x3F, 0x0B, 0x81, 0x3F, 0x0C, 0x8A,
-    0x3F, 0x0F, 0xA1, 0x3F, 0x12, 0xB8, 0x3F, 0x13, 0x32, 0x40, 0x00, 0x52, 0x72, 0x3F, 0x13, 0x7B,
-    0x3F, 0x00, 0x13, 0x00, 0x84, 0x65, 0x6F, 0x70, 0x6C, 0x65, 0x00, 0x82, 0x6F, 0x70, 0x6C, 0x65,
-    0x00, 0x16, 0x16, 0x04, 0x00, 0x82, 0x6F, 0x6C, 0x65, 0x00, 0x48, 0x91, 0x3F, 0x12, 0x99, 0x3F,
-    0x00, 0x13, 0x00, 0x83, 0x6F, 0x70, 0x6C, 0x65, 0x00, 0x08, 0x13, 0x00, 0x83, 0x70, 0x6C, 0x65,
-    0x00, 0x48, 0xA8, 0x3F, 0x12, 0xB0, 0x3F, 0x00, 0x13, 0x00, 0x83, 0x6F, 0x70, 0x6C, 0x65, 0x00,
-    0x08, 0x13, 0x00, 0x83, 0x70, 0x6C, 0x65, 0x00, 0x47, 0xD1, 0x3F, 0x08, 0xE7, 0x3F, 0x0B, 0xF1,
-    0x3F, 0x0C, 0xF9, 0x3F, 0x0F, 0x02, 0x40, 0x12, 0x0B, 0x40, 0x15, 0x13, 0x40, 0x1A, 0x1C, 0x40,
-    0x00, 0x48, 0xD8, 0x3F, 0x13, 0xE0, 0x3F, 0x00, 0x13, 0x00, 0x84, 0x6F, 0x70, 0x6C, 0x65, 0x00,
-    0x84, 0x65, 0x6F, 0x70, 0x6C, 0x65, 0x00, 0x2C, 0x00, 0x84, 0x70, 0x65, 0x6F, 0x70, 0x6C, 0x65,
-    0x00, 0x16, 0x16, 0x04, 0x00, 0x82, 0x6C, 0x65, 0x00, 0x08, 0x13, 0x00, 0x84, 0x6F, 0x70, 0x6C,
-    0x65, 0x00, 0x08, 0x13, 0x00, 0x84, 0x6F, 0x70, 0x6C, 0x65, 0x00, 0x08, 0x13, 0x00, 0x83, 0x70,
-    0x6C, 0x65, 0x00, 0x08, 0x13, 0x00, 0x84, 0x6F, 0x70, 0x6C, 0x65, 0x00, 0x48, 0x23, 0x40, 0x13,
-    0x2B, 0x40, 0x00, 0x13, 0x00, 0x84, 0x6F, 0x70, 0x6C, 0x65, 0x00, 0x84, 0x65, 0x6F, 0x70, 0x6C,
-    0x65, 0x00, 0x48, 0x39, 0x40, 0x12, 0x41, 0x40, 0x00, 0x13, 0x00, 0x83, 0x6F, 0x70, 0x6C, 0x65,
-    0x00, 0x08, 0x13, 0x00, 0x82, 0x6C, 0x65, 0x00, 0x52, 0x4F, 0x40, 0x17, 0x54, 0x40, 0x00, 0x1A,
-    0x00, 0x80, 0x64, 0x00, 0x4C, 0x5B, 0x40, 0x17, 0x62, 0x40, 0x00, 0x0F, 0x00, 0x82, 0x74, 0x6C,
-    0x65, 0x00, 0x0C, 0x0F, 0x00, 0x82, 0x6C, 0x65, 0x00, 0x4A, 0x79, 0x40, 0x0C, 0x90, 0x40, 0x15,
-    0x9A, 0x40, 0x17, 0xB1, 0x40, 0x1C, 0x38, 0x41, 0x00, 0x4C, 0x80, 0x40, 0x17, 0x88, 0x40, 0x00,
-    0x0F, 0x00, 0x83, 0x74, 0x74, 0x6C, 0x65, 0x00, 0x0C, 0x0F, 0x00, 0x83, 0x74, 0x6C, 0x65, 0x00,
-    0x17, 0x0F, 0x00, 0x84, 0x69, 0x74, 0x74, 0x6C, 0x65, 0x00, 0x4C, 0xA1, 0x40, 0x17, 0xA9, 0x40,
-    0x00, 0x0F, 0x00, 0x83, 0x74, 0x74, 0x6C, 0x65, 0x00, 0x0C, 0x0F, 0x00, 0x83, 0x74, 0x6C, 0x65,
-    0x00, 0x4A, 0xCA, 0x40, 0x0C, 0xD3, 0x40, 0x0E, 0xDD, 0x40, 0x0F, 0xF3, 0x40, 0x12, 0xFA, 0x40,
-    0x15, 0x10, 0x41, 0x18, 0x19, 0x41, 0x1C, 0x2F, 0x41, 0x00, 0x0C, 0x0F, 0x00, 0x84, 0x74, 0x74,
-    0x6C, 0x65, 0x00, 0x2C, 0x00, 0x84, 0x6C, 0x69, 0x74, 0x74, 0x6C, 0x65, 0x00, 0x4C, 0xE4, 0x40,
-    0x0F, 0xEC, 0x40, 0x00, 0x0F, 0x00, 0x84, 0x74, 0x74, 0x6C, 0x65, 0x00, 0x84, 0x69, 0x74, 0x74,
-    0x6C, 0x65, 0x00, 0x83, 0x69, 0x74, 0x74, 0x6C, 0x65, 0x00, 0x4C, 0x01, 0x41, 0x0F, 0x09, 0x41,
-    0x00, 0x0F, 0x00, 0x84, 0x74, 0x74, 0x6C, 0x65, 0x00, 0x84, 0x69, 0x74, 0x74, 0x6C, 0x65, 0x00,
-    0x0C, 0x0F, 0x00, 0x84, 0x74, 0x74, 0x6C, 0x65, 0x00, 0x4C, 0x20, 0x41, 0x0F, 0x28, 0x41, 0x00,
-    0x0F, 0x00, 0x84, 0x74, 0x74, 0x6C, 0x65, 0x00, 0x84, 0x69, 0x74, 0x74, 0x6C, 0x65, 0x00, 0x0C,
-    0x0F, 0x00, 0x84, 0x74, 0x74, 0x6C, 0x65, 0x00, 0x4C, 0x3F, 0x41, 0x17, 0x47, 0x41, 0x00, 0x0F,
-    0x00, 0x83, 0x74, 0x74, 0x6C, 0x65, 0x00, 0x0C, 0x0F, 0x00, 0x83, 0x74, 0x6C, 0x65, 0x00, 0x4B,
-    0x59, 0x41, 0x0C, 0x60, 0x41, 0x12, 0x67, 0x41, 0x00, 0x1A, 0x00, 0x82, 0x69, 0x6C, 0x65, 0x00,
-    0x0B, 0x1A, 0x00, 0x82, 0x6C, 0x65, 0x00, 0x1A, 0x00, 0x80, 0x64, 0x00, 0x17, 0x17, 0x0C, 0x0F,
-    0x00, 0x82, 0x6C, 0x65, 0x00, 0x44, 0x9D, 0x41, 0x0C, 0x90, 0x42, 0x0D, 0x0B, 0x43, 0x0E, 0x40,
-    0x43, 0x0F, 0x75, 0x43, 0x11, 0x88, 0x43, 0x12, 0xAD, 0x43, 0x13, 0xC0, 0x44, 0x14, 0xD8, 0x44,
-    0x16, 0xE9, 0x44, 0x18, 0xFA, 0x44, 0x1A, 0x01, 0x45, 0x1D, 0x12, 0x45, 0x00, 0x44, 0xC2, 0x41,
-    0x05, 0xC8, 0x41, 0x07, 0xCF, 0x41, 0x09, 0xD7, 0x41, 0x0A, 0xDE, 0x41, 0x14, 0x10, 0x42, 0x16,
-    0x21, 0x42, 0x17, 0x59, 0x42, 0x19, 0x60, 0x42, 0x1A, 0x67, 0x42, 0x1B, 0x78, 0x42, 0x1D, 0x7F,
-    0x42, 0x00, 0x16, 0x00, 0x82, 0x6D, 0x65, 0x00, 0x0A, 0x00, 0x83, 0x61, 0x6D, 0x65, 0x00, 0x16,
-    0x2C, 0x00, 0x83, 0x61, 0x6D, 0x65, 0x00, 0x0A, 0x00, 0x83, 0x61, 0x6D, 0x65, 0x00, 0x45, 0xEE,
-    0x41, 0x09, 0xF4, 0x41, 0x0B, 0xFA, 0x41, 0x17, 0x02, 0x42, 0x19, 0x0A, 0x42, 0x00, 0x84, 0x67,
-    0x61, 0x6D, 0x65, 0x00, 0x84, 0x67, 0x61, 0x6D, 0x65, 0x00, 0x2C, 0x00, 0x84, 0x67, 0x61, 0x6D,
-    0x65, 0x00, 0x2C, 0x00, 0x84, 0x67, 0x61, 0x6D, 0x65, 0x00, 0x84, 0x67, 0x61, 0x6D, 0x65, 0x00,
-    0x4A, 0x17, 0x42, 0x16, 0x1C, 0x42, 0x00, 0x83, 0x61, 0x6D, 0x65, 0x00, 0x83, 0x61, 0x6D, 0x65,
-    0x00, 0x44, 0x34, 0x42, 0x07, 0x3A, 0x42, 0x08, 0x40, 0x42, 0x0A, 0x48, 0x42, 0x1A, 0x4D, 0x42,
-    0x1B, 0x53, 0x42, 0x00, 0x84, 0x73, 0x61, 0x6D, 0x65, 0x00, 0x84, 0x73, 0x61, 0x6D, 0x65, 0x00,
-    0x2C, 0x00, 0x84, 0x73, 0x61, 0x6D, 0x65, 0x00, 0x83, 0x61, 0x6D, 0x65, 0x00, 0x84, 0x73, 0x61,
-    0x6D, 0x65, 0x00, 0x84, 0x73, 0x61, 0x6D, 0x65, 0x00, 0x0A, 0x00, 0x83, 0x61, 0x6D, 0x65, 0x00,
-    0x0A, 0x00, 0x83, 0x61, 0x6D, 0x65, 0x00, 0x4A, 0x6E, 0x42, 0x16, 0x73, 0x42, 0x00, 0x83, 0x61,
-    0x6D, 0x65, 0x00, 0x83, 0x61, 0x6D, 0x65, 0x00, 0x16, 0x00, 0x83, 0x61, 0x6D, 0x65, 0x00, 0x4A,
-    0x86, 0x42, 0x16, 0x8B, 0x42, 0x00, 0x83, 0x61, 0x6D, 0x65, 0x00, 0x83, 0x61, 0x6D, 0x65, 0x00,
-    0x4A, 0xA6, 0x42, 0x0E, 0xAD, 0x42, 0x0F, 0xB4, 0x42, 0x12, 0xBD, 0x42, 0x17, 0xDB, 0x42, 0x18,
-    0xFD, 0x42, 0x1C, 0x04, 0x43, 0x00, 0x17, 0x00, 0x83, 0x69, 0x6D, 0x65, 0x00, 0x17, 0x00, 0x83,
-    0x69, 0x6D, 0x65, 0x00, 0x08, 0x16, 0x04, 0x05, 0x00, 0x81, 0x6E, 0x65, 0x00, 0x46, 0xCA, 0x42,
-    0x0B, 0xCE, 0x42, 0x16, 0xD2, 0x42, 0x17, 0xD6, 0x42, 0x00, 0x82, 0x6D, 0x65, 0x00, 0x82, 0x6D,
-    0x65, 0x00, 0x82, 0x6D, 0x65, 0x00, 0x83, 0x69, 0x6D, 0x65, 0x00, 0x4A, 0xE5, 0x42, 0x15, 0xED,
-    0x42, 0x1C, 0xF5, 0x42, 0x00, 0x2C, 0x00, 0x84, 0x74, 0x69, 0x6D, 0x65, 0x00, 0x2C, 0x00, 0x84,
-    0x74, 0x69, 0x6D, 0x65, 0x00, 0x2C, 0x00, 0x84, 0x74, 0x69, 0x6D, 0x65, 0x00, 0x17, 0x00, 0x83,
-    0x69, 0x6D, 0x65, 0x00, 0x17, 0x00, 0x83, 0x69, 0x6D, 0x65, 0x00, 0x44, 0x15, 0x43, 0x0C, 0x24,
-    0x43, 0x12, 0x2A, 0x43, 0x00, 0x4A, 0x1C, 0x43, 0x16, 0x20, 0x43, 0x00, 0x82, 0x6D, 0x65, 0x00,
-    0x82, 0x6D, 0x65, 0x00, 0x17, 0x00, 0x82, 0x6D, 0x65, 0x00, 0x46, 0x34, 0x43, 0x0B, 0x38, 0x43,
-    0x16, 0x3C, 0x43, 0x00, 0x82, 0x6D, 0x65, 0x00, 0x82, 0x6D, 0x65, 0x00, 0x82, 0x6D, 0x65, 0x00,
-    0x44, 0x4A, 0x43, 0x0C, 0x59, 0x43, 0x12, 0x5F, 0x43, 0x00, 0x4A, 0x51, 0x43, 0x16, 0x55, 0x43,
-    0x00, 0x82, 0x6D, 0x65, 0x00, 0x82, 0x6D, 0x65, 0x00, 0x17, 0x00, 0x82, 0x6D, 0x65, 0x00, 0x46,
-    0x69, 0x43, 0x0B, 0x6D, 0x43, 0x16, 0x71, 0x43, 0x00, 0x82, 0x6D, 0x65, 0x00, 0x82, 0x6D, 0x65,
-    0x00, 0x82, 0x6D, 0x65, 0x00, 0x12, 0x00, 0x46, 0x7E, 0x43, 0x16, 0x84, 0x43, 0x00, 0x2C, 0x00,
-    0x82, 0x6D, 0x65, 0x00, 0x82, 0x6D, 0x65, 0x00, 0x44, 0x92, 0x43, 0x0C, 0xA1, 0x43, 0x12, 0xA7,
-    0x43, 0x00, 0x4A, 0x99, 0x43, 0x16, 0x9D, 0x43, 0x00, 0x82, 0x6D, 0x65, 0x00, 0x82, 0x6D, 0x65,
-    0x00, 0x17, 0x00, 0x82, 0x6D, 0x65, 0x00, 0x06, 0x00, 0x82, 0x6D, 0x65, 0x00, 0x44, 0xD2, 0x43,
-    0x05, 0xD9, 0x43, 0x06, 0xE0, 0x43, 0x07, 0xFC, 0x43, 0x0B, 0x0F, 0x44, 0x0D, 0x36, 0x44, 0x0F,
-    0x3D, 0x44, 0x13, 0x44, 0x44, 0x16, 0x5F, 0x44, 0x19, 0xA1, 0x44, 0x1A, 0xA8, 0x44, 0x1B, 0xAF,
-    0x44, 0x00, 0x16, 0x00, 0x83, 0x6F, 0x6D, 0x65, 0x00, 0x0B, 0x00, 0x83, 0x6F, 0x6D, 0x65, 0x00,
-    0x47, 0xEA, 0x43, 0x19, 0xF0, 0x43, 0x1B, 0xF6, 0x43, 0x00, 0x84, 0x63, 0x6F, 0x6D, 0x65, 0x00,
-    0x84, 0x63, 0x6F, 0x6D, 0x65, 0x00, 0x84, 0x63, 0x6F, 0x6D, 0x65, 0x00, 0x46, 0x03, 0x44, 0x16,
-    0x0A, 0x44, 0x00, 0x2C, 0x00, 0x83, 0x6F, 0x6D, 0x65, 0x00, 0x83, 0x6F, 0x6D, 0x65, 0x00, 0x45,
-    0x1C, 0x44, 0x0D, 0x22, 0x44, 0x11, 0x28, 0x44, 0x1C, 0x30, 0x44, 0x00, 0x84, 0x68, 0x6F, 0x6D,
-    0x65, 0x00, 0x84, 0x68, 0x6F, 0x6D, 0x65, 0x00, 0x2C, 0x00, 0x84, 0x68, 0x6F, 0x6D, 0x65, 0x00,
-    0x84, 0x68, 0x6F, 0x6D, 0x65, 0x00, 0x0B, 0x00, 0x83, 0x6F, 0x6D, 0x65, 0x00, 0x16, 0x00, 0x83,
-    0x6F, 0x6D, 0x65, 0x00, 0x46, 0x4E, 0x44, 0x0B, 0x53, 0x44, 0x16, 0x58, 0x44, 0x00, 0x83, 0x6F,
-    0x6D, 0x65, 0x00, 0x83, 0x6F, 0x6D, 0x65, 0x00, 0x2C, 0x00, 0x83, 0x6F, 0x6D, 0x65, 0x00, 0x44,
-    0x72, 0x44, 0x06, 0x7A, 0x44, 0x07, 0x81, 0x44, 0x08, 0x89, 0x44, 0x1A, 0x91, 0x44, 0x1B, 0x99,
-    0x44, 0x00, 0x2C, 0x00, 0x84, 0x73, 0x6F, 0x6D, 0x65, 0x00, 0x2C, 0x00, 0x83, 0x6F, 0x6D, 0x65,
-    0x00, 0x2C, 0x00, 0x84, 0x73, 0x6F, 0x6D, 0x65, 0x00, 0x2C, 0x00, 0x84, 0x73, 0x6F, 0x6D, 0x65,
-    0x00, 0x2C, 0x00, 0x84, 0x73, 0x6F, 0x6D, 0x65, 0x00, 0x2C, 0x00, 0x84, 0x73, 0x6F, 0x6D, 0x65,
-    0x00, 0x06, 0x00, 0x83, 0x6F, 0x6D, 0x65, 0x00, 0x16, 0x00, 0x83, 0x6F, 0x6D, 0x65, 0x00, 0x46,
-    0xB6, 0x44, 0x16, 0xBB, 0x44, 0x00, 0x83, 0x6F, 0x6D, 0x65, 0x00, 0x83, 0x6F, 0x6D, 0x65, 0x00,
-    0x12, 0x00, 0x46, 0xCC, 0x44, 0x0B, 0xD0, 0x44, 0x16, 0xD4, 0x44, 0x00, 0x82, 0x6D, 0x65, 0x00,
-    0x82, 0x6D, 0x65, 0x00, 0x82, 0x6D, 0x65, 0x00, 0x04, 0x00, 0x4A, 0xE1, 0x44, 0x16, 0xE5, 0x44,
-    0x00, 0x82, 0x6D, 0x65, 0x00, 0x82, 0x6D, 0x65, 0x00, 0x04, 0x00, 0x4A, 0xF2, 0x44, 0x16, 0xF6,
-    0x44, 0x00, 0x82, 0x6D, 0x65, 0x00, 0x82, 0x6D, 0x65, 0x00, 0x0C, 0x17, 0x00, 0x82, 0x6D, 0x65,
-    0x00, 0x04, 0x00, 0x4A, 0x0A, 0x45, 0x16, 0x0E, 0x45, 0x00, 0x82, 0x6D, 0x65, 0x00, 0x82, 0x6D,
-    0x65, 0x00, 0x04, 0x00, 0x4A, 0x1B, 0x45, 0x16, 0x1F, 0x45, 0x00, 0x82, 0x6D, 0x65, 0x00, 0x82,
-    0x6D, 0x65, 0x00, 0x45, 0x42, 0x45, 0x06, 0x4D, 0x45, 0x0B, 0x55, 0x45, 0x0C, 0x60, 0x45, 0x0D,
-    0xDE, 0x47, 0x0E, 0xE9, 0x47, 0x0F, 0x04, 0x48, 0x10, 0x1F, 0x48, 0x12, 0x45, 0x48, 0x18, 0x60,
-    0x48, 0x00, 0x0C, 0x0F, 0x08, 0x16, 0x04, 0x05, 0x00, 0x82, 0x6E, 0x65, 0x00, 0x0C, 0x16, 0x00,
-    0x82, 0x6E, 0x63, 0x65, 0x00, 0x0C, 0x0F, 0x08, 0x16, 0x04, 0x05, 0x00, 0x82, 0x6E, 0x65, 0x00,
-    0x48, 0x70, 0x45, 0x0E, 0x8B, 0x45, 0x0F, 0xA6, 0x45, 0x12, 0xB8, 0x47, 0x18, 0xD3, 0x47, 0x00,
-    0x4F, 0x77, 0x45, 0x16, 0x82, 0x45, 0x00, 0x16, 0x04, 0x05, 0x00, 0x84, 0x65, 0x6C, 0x69, 0x6E,
-    0x65, 0x00, 0x04, 0x05, 0x00, 0x82, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x48, 0x92, 0x45, 0x0F, 0x9C,
-    0x45, 0x00, 0x16, 0x04, 0x05, 0x00, 0x83, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x08, 0x16, 0x04, 0x05,
-    0x00, 0x83, 0x69, 0x6E, 0x65, 0x00, 0x47, 0xBC, 0x45, 0x08, 0xD7, 0x45, 0x0E, 0x51, 0x47, 0x12,
-    0x5C, 0x47, 0x15, 0x67, 0x47, 0x16, 0x82, 0x47, 0x1A, 0x9D, 0x47, 0x00, 0x48, 0xC3, 0x45, 0x16,
-    0xCD, 0x45, 0x00, 0x16, 0x04, 0x05, 0x00, 0x84, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x04, 0x05, 0x00,
-    0x84, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x44, 0xED, 0x45, 0x07, 0x22, 0x46, 0x08, 0x3D, 0x46,
-    0x15, 0x57, 0x46, 0x16, 0x62, 0x46, 0x1A, 0x1B, 0x47, 0x1B, 0x36, 0x47, 0x00, 0x44, 0xF7, 0x45,
-    0x05, 0x01, 0x46, 0x16, 0x09, 0x46, 0x00, 0x05, 0x00, 0x85, 0x73, 0x65, 0x6C, 0x69, 0x6E, 0x65,
-    0x00, 0x84, 0x73, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x44, 0x10, 0x46, 0x05, 0x19, 0x46, 0x00,
-    0x05, 0x00, 0x85, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x86, 0x61, 0x73, 0x65, 0x6C, 0x69, 0x6E,
-    0x65, 0x00, 0x44, 0x29, 0x46, 0x16, 0x33, 0x46, 0x00, 0x05, 0x00, 0x85, 0x73, 0x65, 0x6C, 0x69,
-    0x6E, 0x65, 0x00, 0x04, 0x05, 0x00, 0x85, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x44, 0x44, 0x46,
-    0x16, 0x4E, 0x46, 0x00, 0x05, 0x00, 0x85, 0x73, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x04, 0x05,
-    0x00, 0x84, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x16, 0x04, 0x05, 0x00, 0x85, 0x65, 0x6C, 0x69, 0x6E,
-    0x65, 0x00, 0x44, 0x7E, 0x46, 0x05, 0x8A, 0x46, 0x07, 0x93, 0x46, 0x08, 0x9E, 0x46, 0x14, 0xA9,
-    0x46, 0x16, 0xC3, 0x46, 0x1A, 0xDC, 0x46, 0x1B, 0xF6, 0x46, 0x1D, 0x01, 0x47, 0x00, 0x2C, 0x00,
+    0x73, 0x00, 0x48, 0x02, 0x16, 0x09, 0x9E, 0x23, 0x0A, 0x9E, 0x23, 0x0B, 0xA6, 0x23, 0x0D, 0xE0,
+    0x23, 0x11, 0xE0, 0x23, 0x15, 0x67, 0x23, 0x17, 0xEB, 0x23, 0x1C, 0xE0, 0x23, 0x00, 0x0B, 0x17,
+    0x00, 0x83, 0x72, 0x65, 0x65, 0x00, 0x45, 0xBF, 0x23, 0x0A, 0xC3, 0x23, 0x0D, 0xBF, 0x23, 0x11,
+    0xBF, 0x23, 0x15, 0xC3, 0x23, 0x17, 0xCA, 0x23, 0x1A, 0xDB, 0x23, 0x1C, 0xC3, 0x23, 0x00, 0x57,
+    0x75, 0x03, 0x00, 0x84, 0x74, 0x68, 0x72, 0x65, 0x65, 0x00, 0x4A, 0xD4, 0x23, 0x15, 0xD4, 0x23,
+    0x1C, 0xD4, 0x23, 0x00, 0x85, 0x74, 0x68, 0x72, 0x65, 0x65, 0x00, 0x82, 0x65, 0x72, 0x65, 0x00,
+    0x4B, 0xE7, 0x23, 0x17, 0x71, 0x23, 0x00, 0x57, 0xA1, 0x23, 0x00, 0x0B, 0x00, 0x6C, 0xC3, 0x23,
+    0x00, 0x48, 0x91, 0x15, 0x0B, 0xFB, 0x23, 0x12, 0x91, 0x15, 0x00, 0x17, 0x00, 0x82, 0x65, 0x73,
+    0x65, 0x00, 0x49, 0x0C, 0x24, 0x0B, 0x60, 0x23, 0x15, 0x67, 0x23, 0x00, 0x04, 0x2C, 0x00, 0x80,
+    0x72, 0x00, 0x08, 0x11, 0x00, 0x80, 0x72, 0x00, 0x74, 0x3D, 0x24, 0x04, 0x44, 0x24, 0x06, 0x4D,
+    0x24, 0x07, 0x54, 0x24, 0x08, 0x5F, 0x24, 0x0A, 0x4D, 0x24, 0x0C, 0x68, 0x24, 0x0E, 0x4D, 0x24,
+    0x12, 0x8A, 0x24, 0x15, 0x91, 0x24, 0x18, 0x98, 0x24, 0x19, 0xA6, 0x24, 0x00, 0x18, 0x12, 0x00,
+    0x5C, 0x55, 0x23, 0x00, 0x1A, 0x10, 0x15, 0x0C, 0x00, 0x49, 0x55, 0x23, 0x00, 0x0C, 0x0F, 0x00,
+    0x82, 0x66, 0x65, 0x00, 0x44, 0xE3, 0x21, 0x0C, 0x5B, 0x24, 0x00, 0x4F, 0x50, 0x24, 0x00, 0x0B,
+    0x00, 0x57, 0x55, 0x23, 0x1A, 0x55, 0x23, 0x00, 0x4E, 0x72, 0x24, 0x0F, 0x79, 0x24, 0x12, 0x72,
+    0x24, 0x00, 0x0F, 0x00, 0x83, 0x69, 0x66, 0x65, 0x00, 0x4E, 0x80, 0x24, 0x12, 0x86, 0x24, 0x00,
+    0x84, 0x6C, 0x69, 0x66, 0x65, 0x00, 0x6C, 0x80, 0x24, 0x00, 0x09, 0x08, 0x00, 0x45, 0x55, 0x23,
+    0x00, 0x4C, 0x5B, 0x24, 0x12, 0xE3, 0x21, 0x00, 0x4C, 0x5B, 0x24, 0x16, 0x9F, 0x24, 0x00, 0x04,
+    0x08, 0x00, 0x50, 0x55, 0x23, 0x00, 0x44, 0x9E, 0x21, 0x0C, 0x5B, 0x24, 0x12, 0xA2, 0x21, 0x00,
+    0x49, 0xE7, 0x21, 0x11, 0xBD, 0x24, 0x17, 0xC5, 0x24, 0x19, 0x97, 0x21, 0x00, 0x0C, 0x0B, 0x17,
+    0x2C, 0x00, 0x80, 0x73, 0x00, 0x04, 0x17, 0x16, 0x00, 0x81, 0x65, 0x00, 0x0C, 0x0F, 0x08, 0x16,
+    0x04, 0x00, 0x45, 0x93, 0x21, 0x00, 0x48, 0xE3, 0x24, 0x0E, 0xEA, 0x22, 0x0F, 0xE9, 0x24, 0x11,
+    0xFF, 0x24, 0x00, 0x0B, 0x17, 0x00, 0x80, 0x72, 0x00, 0x48, 0xF0, 0x24, 0x0B, 0xF8, 0x24, 0x00,
+    0x16, 0x04, 0x05, 0x00, 0x80, 0x6E, 0x65, 0x00, 0x1A, 0x00, 0x82, 0x69, 0x6C, 0x65, 0x00, 0x0F,
+    0x08, 0x16, 0x04, 0x05, 0x00, 0x82, 0x69, 0x6E, 0x65, 0x00, 0x4C, 0x8D, 0x21, 0x0E, 0xEA, 0x22,
+    0x10, 0x14, 0x25, 0x00, 0x44, 0x1E, 0x25, 0x0C, 0x0C, 0x23, 0x12, 0x10, 0x23, 0x00, 0x4A, 0x71,
+    0x02, 0x16, 0x71, 0x02, 0x00, 0x44, 0x4D, 0x25, 0x0C, 0xBA, 0x25, 0x0D, 0xED, 0x25, 0x0E, 0xE7,
+    0x21, 0x0F, 0xFB, 0x25, 0x10, 0x14, 0x25, 0x12, 0x11, 0x26, 0x13, 0x1F, 0x26, 0x14, 0x26, 0x26,
+    0x17, 0x2A, 0x26, 0x18, 0x31, 0x26, 0x1A, 0x37, 0x26, 0x1D, 0x26, 0x26, 0x00, 0x4A, 0x72, 0x25,
+    0x0D, 0x79, 0x25, 0x0E, 0x79, 0x25, 0x10, 0x7D, 0x25, 0x11, 0x79, 0x25, 0x14, 0x8E, 0x25, 0x15,
+    0x95, 0x25, 0x16, 0x8E, 0x25, 0x17, 0x9B, 0x25, 0x1A, 0xAF, 0x25, 0x1C, 0x72, 0x25, 0x1D, 0x8E,
+    0x25, 0x00, 0x17, 0x00, 0x83, 0x61, 0x6B, 0x65, 0x00, 0x50, 0x74, 0x25, 0x00, 0x4D, 0x84, 0x25,
+    0x11, 0x8A, 0x25, 0x00, 0x84, 0x6D, 0x61, 0x6B, 0x65, 0x00, 0x6C, 0x84, 0x25, 0x00, 0x50, 0x74,
+    0x25, 0x17, 0x74, 0x25, 0x00, 0x17, 0x00, 0x6C, 0x74, 0x25, 0x00, 0x4A, 0xA5, 0x25, 0x15, 0xAB,
+    0x25, 0x1C, 0xA5, 0x25, 0x00, 0x84, 0x74, 0x61, 0x6B, 0x65, 0x00, 0x6C, 0xA5, 0x25, 0x00, 0x50,
+    0x74, 0x25, 0x17, 0xB6, 0x25, 0x00, 0x6C, 0x74, 0x25, 0x00, 0x44, 0xCD, 0x25, 0x0C, 0xD3, 0x25,
+    0x0E, 0xD7, 0x25, 0x0F, 0xDE, 0x25, 0x12, 0xD7, 0x25, 0x18, 0xD7, 0x25, 0x00, 0x17, 0x00, 0x82,
+    0x6B, 0x65, 0x00, 0x4F, 0xCF, 0x25, 0x00, 0x0F, 0x00, 0x83, 0x69, 0x6B, 0x65, 0x00, 0x4E, 0xE5,
+    0x25, 0x12, 0xE5, 0x25, 0x00, 0x2C, 0x00, 0x84, 0x6C, 0x69, 0x6B, 0x65, 0x00, 0x44, 0xF4, 0x25,
+    0x0C, 0xD3, 0x25, 0x00, 0x50, 0xCF, 0x25, 0x17, 0xCF, 0x25, 0x00, 0x44, 0x02, 0x26, 0x0C, 0x06,
+    0x26, 0x00, 0x50, 0xCF, 0x25, 0x00, 0x4B, 0x0D, 0x26, 0x0F, 0xCF, 0x25, 0x00, 0x5A, 0x71, 0x02,
+    0x00, 0x4B, 0x18, 0x26, 0x0C, 0xD3, 0x25, 0x00, 0x16, 0x16, 0x00, 0x44, 0xC1, 0x06, 0x00, 0x12,
+    0x08, 0x00, 0x53, 0xC1, 0x06, 0x00, 0x44, 0xF4, 0x25, 0x00, 0x17, 0x0C, 0x00, 0x4F, 0xC1, 0x06,
+    0x00, 0x0C, 0x00, 0x4F, 0xCF, 0x25, 0x00, 0x04, 0x00, 0x50, 0xCF, 0x25, 0x00, 0x4A, 0x5F, 0x26,
+    0x0B, 0x72, 0x26, 0x0C, 0x93, 0x26, 0x0E, 0x12, 0x27, 0x0F, 0x42, 0x27, 0x12, 0x4C, 0x27, 0x13,
+    0x5A, 0x28, 0x15, 0xD3, 0x28, 0x17, 0xDE, 0x28, 0x18, 0x4B, 0x29, 0x1C, 0x5B, 0x29, 0x00, 0x17,
+    0x00, 0x4C, 0x68, 0x26, 0x17, 0x6C, 0x26, 0x00, 0x4F, 0x52, 0x04, 0x00, 0x0C, 0x00, 0x4F, 0xE6,
+    0x03, 0x00, 0x4C, 0x7C, 0x26, 0x12, 0x84, 0x26, 0x16, 0x8B, 0x26, 0x00, 0x1A, 0x00, 0x83, 0x68,
+    0x69, 0x6C, 0x65, 0x00, 0x16, 0x16, 0x00, 0x44, 0x2F, 0x04, 0x00, 0x16, 0x04, 0x00, 0x81, 0x6F,
+    0x6C, 0x65, 0x00, 0x45, 0xB2, 0x26, 0x0A, 0xB2, 0x26, 0x0B, 0xC0, 0x26, 0x0D, 0xB2, 0x26, 0x0E,
+    0xF9, 0x26, 0x11, 0xB2, 0x26, 0x12, 0xFF, 0x26, 0x18, 0xF9, 0x26, 0x1A, 0x0E, 0x27, 0x1C, 0xB2,
+    0x26, 0x00, 0x4B, 0xB9, 0x26, 0x1A, 0x7E, 0x26, 0x00, 0x1A, 0x00, 0x83, 0x69, 0x6C, 0x65, 0x00,
+    0x45, 0xDC, 0x26, 0x08, 0xE4, 0x26, 0x0A, 0xDC, 0x26, 0x0D, 0xDC, 0x26, 0x11, 0xDC, 0x26, 0x14,
+    0xE4, 0x26, 0x16, 0xE4, 0x26, 0x1A, 0xEB, 0x26, 0x1C, 0xDC, 0x26, 0x00, 0x1A, 0x00, 0x84, 0x68,
+    0x69, 0x6C, 0x65, 0x00, 0x84, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x00, 0x48, 0xF5, 0x26, 0x14, 0x10,
+    0x04, 0x16, 0x10, 0x04, 0x00, 0x6C, 0x10, 0x04, 0x00, 0x0B, 0x00, 0x5A, 0xBB, 0x26, 0x00, 0x0B,
+    0x00, 0x56, 0x08, 0x27, 0x1A, 0xBB, 0x26, 0x00, 0x16, 0x00, 0x44, 0xE6, 0x03, 0x00, 0x4B, 0xE4,
+    0x26, 0x00, 0x44, 0xF1, 0x22, 0x0B, 0xF8, 0x24, 0x0C, 0x25, 0x27, 0x12, 0x2C, 0x27, 0x13, 0x34,
+    0x27, 0x17, 0x3B, 0x27, 0x00, 0x4B, 0xE4, 0x03, 0x0F, 0x71, 0x02, 0x00, 0x0B, 0x16, 0x16, 0x00,
+    0x44, 0xE6, 0x03, 0x00, 0x12, 0x08, 0x00, 0x53, 0xE6, 0x03, 0x00, 0x17, 0x0C, 0x00, 0x4F, 0xE6,
+    0x03, 0x00, 0x0B, 0x16, 0x16, 0x04, 0x00, 0x82, 0x6F, 0x6C, 0x65, 0x00, 0x45, 0x74, 0x27, 0x08,
+    0x8A, 0x27, 0x0A, 0x74, 0x27, 0x0B, 0x92, 0x27, 0x0C, 0x0F, 0x28, 0x0D, 0x74, 0x27, 0x0F, 0x1E,
+    0x28, 0x11, 0x74, 0x27, 0x12, 0x26, 0x28, 0x13, 0x3B, 0x28, 0x16, 0x53, 0x28, 0x17, 0x3B, 0x27,
+    0x1C, 0x74, 0x27, 0x00, 0x4B, 0x7B, 0x27, 0x16, 0x84, 0x27, 0x00, 0x16, 0x16, 0x04, 0x00, 0x83,
+    0x6F, 0x6C, 0x65, 0x00, 0x16, 0x00, 0x44, 0x2F, 0x04, 0x00, 0x13, 0x2C, 0x00, 0x81, 0x70, 0x6C,
+    0x65, 0x00, 0x44, 0xB4, 0x27, 0x05, 0xCC, 0x27, 0x07, 0xB4, 0x27, 0x08, 0xD3, 0x27, 0x0A, 0xCC,
+    0x27, 0x0D, 0xCC, 0x27, 0x11, 0xCC, 0x27, 0x16, 0xE0, 0x27, 0x1A, 0xB4, 0x27, 0x1B, 0xB4, 0x27,
+    0x1C, 0xCC, 0x27, 0x00, 0x16, 0x00, 0x44, 0xBD, 0x27, 0x16, 0xC4, 0x27, 0x00, 0x84, 0x73, 0x68,
+    0x6F, 0x6C, 0x65, 0x00, 0x04, 0x00, 0x84, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x16, 0x16, 0x00, 0x44,
+    0xC6, 0x27, 0x00, 0x16, 0x00, 0x44, 0xDC, 0x27, 0x16, 0xC4, 0x27, 0x00, 0x6C, 0xBD, 0x27, 0x00,
+    0x44, 0xF0, 0x27, 0x07, 0xF7, 0x27, 0x08, 0xF7, 0x27, 0x1A, 0xF7, 0x27, 0x1B, 0xF7, 0x27, 0x00,
+    0x83, 0x73, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x44, 0xFE, 0x27, 0x16, 0x06, 0x28, 0x00, 0x85, 0x73,
+    0x73, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x04, 0x00, 0x85, 0x73, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x0B,
+    0x00, 0x56, 0x18, 0x28, 0x1A, 0xE6, 0x03, 0x00, 0x16, 0x00, 0x44, 0x7F, 0x27, 0x00, 0x0B, 0x16,
+    0x16, 0x00, 0x44, 0x7F, 0x27, 0x00, 0x48, 0x2D, 0x28, 0x0B, 0x34, 0x28, 0x00, 0x13, 0x00, 0x82,
+    0x70, 0x6C, 0x65, 0x00, 0x16, 0x16, 0x00, 0x44, 0xE6, 0x03, 0x00, 0x48, 0x45, 0x28, 0x0B, 0x7B,
+    0x27, 0x12, 0x4D, 0x28, 0x00, 0x13, 0x00, 0x83, 0x6F, 0x70, 0x6C, 0x65, 0x00, 0x08, 0x00, 0x53,
+    0xE6, 0x03, 0x00, 0x0B, 0x16, 0x00, 0x44, 0xBD, 0x27, 0x00, 0x48, 0x6D, 0x28, 0x0B, 0x7E, 0x28,
+    0x0C, 0x85, 0x28, 0x0F, 0x85, 0x28, 0x12, 0x94, 0x28, 0x13, 0xCC, 0x28, 0x00, 0x52, 0x74, 0x28,
+    0x13, 0x78, 0x28, 0x00, 0x53, 0x3E, 0x04, 0x00, 0x82, 0x6F, 0x70, 0x6C, 0x65, 0x00, 0x16, 0x16,
+    0x00, 0x44, 0x47, 0x27, 0x00, 0x48, 0x45, 0x28, 0x12, 0x8C, 0x28, 0x00, 0x08, 0x13, 0x00, 0x83,
+    0x70, 0x6C, 0x65, 0x00, 0x47, 0xAD, 0x28, 0x08, 0xBC, 0x28, 0x0B, 0x34, 0x28, 0x0C, 0xC6, 0x28,
+    0x0F, 0xC6, 0x28, 0x12, 0x8C, 0x28, 0x15, 0xC6, 0x28, 0x1A, 0xAD, 0x28, 0x00, 0x48, 0xB4, 0x28,
+    0x13, 0x3E, 0x04, 0x00, 0x13, 0x00, 0x84, 0x6F, 0x70, 0x6C, 0x65, 0x00, 0x2C, 0x00, 0x84, 0x70,
+    0x65, 0x6F, 0x70, 0x6C, 0x65, 0x00, 0x08, 0x00, 0x53, 0xB6, 0x28, 0x00, 0x48, 0x45, 0x28, 0x12,
+    0x4D, 0x28, 0x00, 0x52, 0xDA, 0x28, 0x17, 0x61, 0x26, 0x00, 0x5A, 0x94, 0x0A, 0x00, 0x4A, 0xEE,
+    0x28, 0x0C, 0x03, 0x29, 0x15, 0xEE, 0x28, 0x17, 0x0D, 0x29, 0x1C, 0xEE, 0x28, 0x00, 0x4C, 0xF5,
+    0x28, 0x17, 0xFD, 0x28, 0x00, 0x0F, 0x00, 0x83, 0x74, 0x74, 0x6C, 0x65, 0x00, 0x0C, 0x00, 0x4F,
+    0x62, 0x04, 0x00, 0x17, 0x0F, 0x00, 0x84, 0x69, 0x74, 0x74, 0x6C, 0x65, 0x00, 0x4A, 0x26, 0x29,
+    0x0C, 0x2F, 0x29, 0x0E, 0x39, 0x29, 0x0F, 0x44, 0x29, 0x12, 0x39, 0x29, 0x15, 0x26, 0x29, 0x18,
+    0x39, 0x29, 0x1C, 0x26, 0x29, 0x00, 0x0C, 0x0F, 0x00, 0x84, 0x74, 0x74, 0x6C, 0x65, 0x00, 0x2C,
+    0x00, 0x84, 0x6C, 0x69, 0x74, 0x74, 0x6C, 0x65, 0x00, 0x4C, 0x40, 0x29, 0x0F, 0x06, 0x29, 0x00,
+    0x4F, 0x29, 0x29, 0x00, 0x83, 0x69, 0x74, 0x74, 0x6C, 0x65, 0x00, 0x4B, 0xF8, 0x24, 0x0C, 0x55,
+    0x29, 0x12, 0xDA, 0x28, 0x00, 0x0B, 0x00, 0x5A, 0xE6, 0x03, 0x00, 0x17, 0x17, 0x0C, 0x00, 0x4F,
+    0xE6, 0x03, 0x00, 0x44, 0x8B, 0x29, 0x0C, 0x05, 0x2A, 0x0D, 0x49, 0x2A, 0x0E, 0x49, 0x2A, 0x0F,
+    0x68, 0x2A, 0x11, 0x75, 0x2A, 0x12, 0x83, 0x2A, 0x13, 0x15, 0x2B, 0x14, 0x19, 0x2B, 0x16, 0x19,
+    0x2B, 0x18, 0x1D, 0x2B, 0x1A, 0x19, 0x2B, 0x1D, 0x19, 0x2B, 0x00, 0x44, 0xB0, 0x29, 0x05, 0xB6,
+    0x29, 0x07, 0xBD, 0x29, 0x09, 0xB6, 0x29, 0x0A, 0xC3, 0x29, 0x14, 0xDD, 0x29, 0x16, 0xE4, 0x29,
+    0x17, 0xB6, 0x29, 0x19, 0xB6, 0x29, 0x1A, 0xDD, 0x29, 0x1B, 0x01, 0x2A, 0x1D, 0xDD, 0x29, 0x00,
+    0x16, 0x00, 0x82, 0x6D, 0x65, 0x00, 0x0A, 0x00, 0x83, 0x61, 0x6D, 0x65, 0x00, 0x16, 0x00, 0x6C,
+    0xB8, 0x29, 0x00, 0x45, 0xD3, 0x29, 0x09, 0xD3, 0x29, 0x0B, 0xD9, 0x29, 0x17, 0xD9, 0x29, 0x19,
+    0xD3, 0x29, 0x00, 0x84, 0x67, 0x61, 0x6D, 0x65, 0x00, 0x6C, 0xD3, 0x29, 0x00, 0x4A, 0xB8, 0x29,
+    0x16, 0xB8, 0x29, 0x00, 0x44, 0xF7, 0x29, 0x07, 0xF7, 0x29, 0x08, 0xFD, 0x29, 0x0A, 0xB8, 0x29,
+    0x1A, 0xF7, 0x29, 0x1B, 0xF7, 0x29, 0x00, 0x84, 0x73, 0x61, 0x6D, 0x65, 0x00, 0x6C, 0xF7, 0x29,
+    0x00, 0x56, 0xB8, 0x29, 0x00, 0x4A, 0x1B, 0x2A, 0x0E, 0x1B, 0x2A, 0x0F, 0x22, 0x2A, 0x12, 0x2A,
+    0x2A, 0x17, 0x37, 0x2A, 0x18, 0x1B, 0x2A, 0x1C, 0x1B, 0x2A, 0x00, 0x17, 0x00, 0x83, 0x69, 0x6D,
+    0x65, 0x00, 0x08, 0x16, 0x04, 0x00, 0x45, 0x93, 0x21, 0x00, 0x46, 0xB2, 0x29, 0x0B, 0xB2, 0x29,
+    0x16, 0xB2, 0x29, 0x17, 0x1D, 0x2A, 0x00, 0x4A, 0x41, 0x2A, 0x15, 0x41, 0x2A, 0x1C, 0x41, 0x2A,
+    0x00, 0x2C, 0x00, 0x84, 0x74, 0x69, 0x6D, 0x65, 0x00, 0x44, 0x53, 0x2A, 0x0C, 0x5A, 0x2A, 0x12,
+    0x5E, 0x2A, 0x00, 0x4A, 0xB2, 0x29, 0x16, 0xB2, 0x29, 0x00, 0x57, 0xB2, 0x29, 0x00, 0x46, 0xB2,
+    0x29, 0x0B, 0xB2, 0x29, 0x16, 0xB2, 0x29, 0x00, 0x12, 0x00, 0x46, 0x71, 0x2A, 0x16, 0xB2, 0x29,
+    0x00, 0x6C, 0xB2, 0x29, 0x00, 0x44, 0x53, 0x2A, 0x0C, 0x5A, 0x2A, 0x12, 0x7F, 0x2A, 0x00, 0x46,
+    0xB2, 0x29, 0x00, 0x44, 0xA8, 0x2A, 0x05, 0xAF, 0x2A, 0x06, 0xB3, 0x2A, 0x07, 0xC3, 0x2A, 0x0B,
+    0xCE, 0x2A, 0x0D, 0xAF, 0x2A, 0x0F, 0xA8, 0x2A, 0x13, 0xE5, 0x2A, 0x16, 0xEF, 0x2A, 0x19, 0x0A,
+    0x2B, 0x1A, 0xA8, 0x2A, 0x1B, 0x0E, 0x2B, 0x00, 0x16, 0x00, 0x83, 0x6F, 0x6D, 0x65, 0x00, 0x4B,
+    0xAA, 0x2A, 0x00, 0x47, 0xBD, 0x2A, 0x19, 0xBD, 0x2A, 0x1B, 0xBD, 0x2A, 0x00, 0x84, 0x63, 0x6F,
+    0x6D, 0x65, 0x00, 0x46, 0xCA, 0x2A, 0x16, 0xAA, 0x2A, 0x00, 0x6C, 0xAA, 0x2A, 0x00, 0x45, 0xDB,
+    0x2A, 0x0D, 0xDB, 0x2A, 0x11, 0xE1, 0x2A, 0x1C, 0xDB, 0x2A, 0x00, 0x84, 0x68, 0x6F, 0x6D, 0x65,
+    0x00, 0x6C, 0xDB, 0x2A, 0x00, 0x46, 0xAA, 0x2A, 0x0B, 0xAA, 0x2A, 0x16, 0xCA, 0x2A, 0x00, 0x44,
+    0x02, 0x2B, 0x06, 0xCA, 0x2A, 0x07, 0x02, 0x2B, 0x08, 0x02, 0x2B, 0x1A, 0x02, 0x2B, 0x1B, 0x02,
+    0x2B, 0x00, 0x2C, 0x00, 0x84, 0x73, 0x6F, 0x6D, 0x65, 0x00, 0x46, 0xAA, 0x2A, 0x00, 0x46, 0xAA,
+    0x2A, 0x16, 0xAA, 0x2A, 0x00, 0x52, 0x5E, 0x2A, 0x00, 0x44, 0x53, 0x2A, 0x00, 0x0C, 0x00, 0x57,
+    0xB2, 0x29, 0x00, 0x45, 0x42, 0x2B, 0x06, 0x4D, 0x2B, 0x0B, 0x42, 0x2B, 0x0C, 0x53, 0x2B, 0x0D,
+    0x42, 0x2B, 0x0E, 0xA0, 0x2C, 0x0F, 0xB8, 0x2C, 0x10, 0xD0, 0x2C, 0x12, 0xA0, 0x2C, 0x18, 0xA0,
+    0x2C, 0x00, 0x0C, 0x0F, 0x08, 0x16, 0x04, 0x05, 0x00, 0x82, 0x6E, 0x65, 0x00, 0x0C, 0x00, 0x56,
+    0xD1, 0x21, 0x00, 0x48, 0x63, 0x2B, 0x0E, 0x7E, 0x2B, 0x0F, 0x99, 0x2B, 0x12, 0x7E, 0x2B, 0x18,
+    0x97, 0x2C, 0x00, 0x4F, 0x6A, 0x2B, 0x16, 0x75, 0x2B, 0x00, 0x16, 0x04, 0x05, 0x00, 0x84, 0x65,
+    0x6C, 0x69, 0x6E, 0x65, 0x00, 0x04, 0x05, 0x00, 0x82, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x48, 0x85,
+    0x2B, 0x0F, 0x8F, 0x2B, 0x00, 0x16, 0x04, 0x05, 0x00, 0x83, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x08,
+    0x16, 0x04, 0x05, 0x00, 0x83, 0x69, 0x6E, 0x65, 0x00, 0x47, 0xAF, 0x2B, 0x08, 0xC6, 0x2B, 0x0E,
+    0x79, 0x2C, 0x12, 0x79, 0x2C, 0x15, 0xAF, 0x2B, 0x16, 0x81, 0x2C, 0x1A, 0xAF, 0x2B, 0x00, 0x48,
+    0xB6, 0x2B, 0x16, 0xC0, 0x2B, 0x00, 0x16, 0x04, 0x05, 0x00, 0x84, 0x6C, 0x69, 0x6E, 0x65, 0x00,
+    0x04, 0x00, 0x45, 0x6E, 0x2B, 0x00, 0x44, 0xDC, 0x2B, 0x07, 0x11, 0x2C, 0x08, 0x1E, 0x2C, 0x15,
+    0x2B, 0x2C, 0x16, 0x32, 0x2C, 0x1A, 0x11, 0x2C, 0x1B, 0x11, 0x2C, 0x00, 0x44, 0xE6, 0x2B, 0x05,
+    0xF0, 0x2B, 0x16, 0xF8, 0x2B, 0x00, 0x05, 0x00, 0x85, 0x73, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x00,
+    0x84, 0x73, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x44, 0xFF, 0x2B, 0x05, 0x08, 0x2C, 0x00, 0x05,
+    0x00, 0x85, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x86, 0x61, 0x73, 0x65, 0x6C, 0x69, 0x6E, 0x65,
+    0x00, 0x44, 0xE6, 0x2B, 0x16, 0x18, 0x2C, 0x00, 0x04, 0x00, 0x45, 0x01, 0x2C, 0x00, 0x44, 0xE6,
+    0x2B, 0x16, 0x25, 0x2C, 0x00, 0x04, 0x00, 0x45, 0xBA, 0x2B, 0x00, 0x16, 0x04, 0x00, 0x45, 0x01,
+    0x2C, 0x00, 0x44, 0x4E, 0x2C, 0x05, 0x5A, 0x2C, 0x07, 0x63, 0x2C, 0x08, 0x63, 0x2C, 0x14, 0x6E,
+    0x2C, 0x16, 0xF8, 0x2B, 0x1A, 0x6E, 0x2C, 0x1B, 0x63, 0x2C, 0x1D, 0x6E, 0x2C, 0x00, 0x2C, 0x00,
     0x86, 0x62, 0x61, 0x73, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x85, 0x61, 0x73, 0x65, 0x6C, 0x69,
-    0x6E, 0x65, 0x00, 0x04, 0x05, 0x00, 0x86, 0x73, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x04, 0x05,
-    0x00, 0x86, 0x73, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x44, 0xB0, 0x46, 0x05, 0xBA, 0x46, 0x00,
-    0x05, 0x00, 0x86, 0x73, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x86, 0x61, 0x73, 0x65, 0x6C, 0x69,
-    0x6E, 0x65, 0x00, 0x44, 0xCA, 0x46, 0x05, 0xD3, 0x46, 0x00, 0x05, 0x00, 0x85, 0x65, 0x6C, 0x69,
-    0x6E, 0x65, 0x00, 0x86, 0x61, 0x73, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x44, 0xE3, 0x46, 0x05,
-    0xED, 0x46, 0x00, 0x05, 0x00, 0x86, 0x73, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x86, 0x61, 0x73,
-    0x65, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x04, 0x05, 0x00, 0x86, 0x73, 0x65, 0x6C, 0x69, 0x6E, 0x65,
-    0x00, 0x44, 0x08, 0x47, 0x05, 0x12, 0x47, 0x00, 0x05, 0x00, 0x86, 0x73, 0x65, 0x6C, 0x69, 0x6E,
-    0x65, 0x00, 0x86, 0x61, 0x73, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x44, 0x22, 0x47, 0x16, 0x2C,
-    0x47, 0x00, 0x05, 0x00, 0x85, 0x73, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x04, 0x05, 0x00, 0x85,
-    0x65, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x44, 0x3D, 0x47, 0x16, 0x47, 0x47, 0x00, 0x05, 0x00, 0x85,
-    0x73, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x04, 0x05, 0x00, 0x85, 0x65, 0x6C, 0x69, 0x6E, 0x65,
-    0x00, 0x08, 0x16, 0x04, 0x05, 0x00, 0x84, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x08, 0x16, 0x04, 0x05,
-    0x00, 0x84, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x48, 0x6E, 0x47, 0x16, 0x78, 0x47, 0x00, 0x16, 0x04,
-    0x05, 0x00, 0x84, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x04, 0x05, 0x00, 0x84, 0x65, 0x6C, 0x69, 0x6E,
-    0x65, 0x00, 0x44, 0x89, 0x47, 0x08, 0x92, 0x47, 0x00, 0x05, 0x00, 0x83, 0x65, 0x6C, 0x69, 0x6E,
-    0x65, 0x00, 0x04, 0x05, 0x00, 0x85, 0x73, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x48, 0xA4, 0x47,
-    0x16, 0xAE, 0x47, 0x00, 0x16, 0x04, 0x05, 0x00, 0x84, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x04, 0x05,
-    0x00, 0x84, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x48, 0xBF, 0x47, 0x0F, 0xC9, 0x47, 0x00, 0x16,
-    0x04, 0x05, 0x00, 0x83, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x08, 0x16, 0x04, 0x05, 0x00, 0x83, 0x69,
-    0x6E, 0x65, 0x00, 0x0F, 0x08, 0x16, 0x04, 0x05, 0x00, 0x83, 0x69, 0x6E, 0x65, 0x00, 0x0C, 0x0F,
-    0x08, 0x16, 0x04, 0x05, 0x00, 0x82, 0x6E, 0x65, 0x00, 0x4C, 0xF0, 0x47, 0x0F, 0xFA, 0x47, 0x00,
-    0x0F, 0x08, 0x16, 0x04, 0x05, 0x00, 0x82, 0x6E, 0x65, 0x00, 0x08, 0x16, 0x04, 0x05, 0x00, 0x82,
-    0x69, 0x6E, 0x65, 0x00, 0x48, 0x0B, 0x48, 0x0C, 0x14, 0x48, 0x00, 0x16, 0x04, 0x05, 0x00, 0x81,
-    0x69, 0x6E, 0x65, 0x00, 0x08, 0x16, 0x04, 0x05, 0x00, 0x83, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x44,
-    0x29, 0x48, 0x0C, 0x36, 0x48, 0x12, 0x40, 0x48, 0x00, 0x4A, 0x30, 0x48, 0x16, 0x33, 0x48, 0x00,
-    0x81, 0x65, 0x00, 0x81, 0x65, 0x00, 0x0F, 0x08, 0x16, 0x04, 0x05, 0x00, 0x82, 0x6E, 0x65, 0x00,
-    0x0B, 0x00, 0x81, 0x65, 0x00, 0x4C, 0x4C, 0x48, 0x0F, 0x56, 0x48, 0x00, 0x0F, 0x08, 0x16, 0x04,
-    0x05, 0x00, 0x82, 0x6E, 0x65, 0x00, 0x08, 0x16, 0x04, 0x05, 0x00, 0x82, 0x69, 0x6E, 0x65, 0x00,
-    0x4C, 0x67, 0x48, 0x0F, 0x71, 0x48, 0x00, 0x0F, 0x08, 0x16, 0x04, 0x05, 0x00, 0x82, 0x6E, 0x65,
-    0x00, 0x08, 0x16, 0x04, 0x05, 0x00, 0x82, 0x69, 0x6E, 0x65, 0x00, 0x49, 0x97, 0x48, 0x0B, 0x9E,
-    0x48, 0x0C, 0xA6, 0x48, 0x0F, 0xAD, 0x48, 0x12, 0xC3, 0x48, 0x13, 0xCC, 0x48, 0x15, 0xD4, 0x48,
-    0x16, 0xDD, 0x48, 0x17, 0xE5, 0x48, 0x00, 0x08, 0x05, 0x00, 0x80, 0x72, 0x65, 0x00, 0x16, 0x16,
-    0x04, 0x00, 0x80, 0x6C, 0x65, 0x00, 0x0B, 0x1A, 0x00, 0x81, 0x6C, 0x65, 0x00, 0x4B, 0xB4, 0x48,
-    0x0C, 0xBD, 0x48, 0x00, 0x16, 0x16, 0x04, 0x00, 0x82, 0x6F, 0x6C, 0x65, 0x00, 0x0B, 0x1A, 0x00,
-    0x81, 0x65, 0x00, 0x0B, 0x16, 0x16, 0x04, 0x00, 0x81, 0x6C, 0x65, 0x00, 0x12, 0x08, 0x13, 0x00,
-    0x81, 0x6C, 0x65, 0x00, 0x09, 0x08, 0x05, 0x00, 0x82, 0x6F, 0x72, 0x65, 0x00, 0x0B, 0x17, 0x00,
-    0x82, 0x6F, 0x73, 0x65, 0x00, 0x17, 0x0C, 0x0F, 0x00, 0x81, 0x6C, 0x65, 0x00, 0x4F, 0xF4, 0x48,
-    0x12, 0xFD, 0x48, 0x00, 0x12, 0x08, 0x13, 0x00, 0x82, 0x70, 0x6C, 0x65, 0x00, 0x08, 0x13, 0x00,
-    0x80, 0x6C, 0x65, 0x00, 0x74, 0x47, 0x49, 0x04, 0x14, 0x4A, 0x07, 0x92, 0x4C, 0x08, 0xB9, 0x4C,
-    0x09, 0x50, 0x4E, 0x0B, 0xAF, 0x4E, 0x0C, 0xC4, 0x4E, 0x0D, 0xF0, 0x4E, 0x0E, 0x09, 0x4F, 0x0F,
-    0x22, 0x4F, 0x10, 0x43, 0x4F, 0x12, 0x72, 0x4F, 0x13, 0xF8, 0x50, 0x14, 0x0F, 0x51, 0x15, 0x2A,
-    0x51, 0x16, 0x32, 0x51, 0x17, 0x67, 0x51, 0x18, 0xB2, 0x51, 0x19, 0xE2, 0x53, 0x1A, 0xFC, 0x53,
-    0x1C, 0x59, 0x54, 0x1D, 0x72, 0x54, 0x00, 0x4C, 0x57, 0x49, 0x0D, 0x6E, 0x49, 0x12, 0x85, 0x49,
-    0x18, 0x9B, 0x49, 0x1C, 0xFD, 0x49, 0x00, 0x52, 0x5E, 0x49, 0x18, 0x66, 0x49, 0x00, 0x1C, 0x00,
-    0x83, 0x75, 0x27, 0x72, 0x65, 0x00, 0x12, 0x1C, 0x00, 0x83, 0x27, 0x72, 0x65, 0x00, 0x52, 0x75,
-    0x49, 0x18, 0x7D, 0x49, 0x00, 0x1C, 0x00, 0x83, 0x75, 0x27, 0x72, 0x65, 0x00, 0x12, 0x1C, 0x00,
-    0x83, 0x27, 0x72, 0x65, 0x00, 0x58, 0x8C, 0x49, 0x1C, 0x95, 0x49, 0x00, 0x1C, 0x00, 0x84, 0x6F,
-    0x75, 0x27, 0x72, 0x65, 0x00, 0x82, 0x75, 0x27, 0x72, 0x65, 0x00, 0x4C, 0xAB, 0x49, 0x0D, 0xC1,
-    0x49, 0x0F, 0xCA, 0x49, 0x13, 0xE0, 0x49, 0x1C, 0xF6, 0x49, 0x00, 0x52, 0xB2, 0x49, 0x1C, 0xBA,
-    0x49, 0x00, 0x1C, 0x00, 0x84, 0x75, 0x27, 0x72, 0x65, 0x00, 0x84, 0x6F, 0x75, 0x27, 0x72, 0x65,
-    0x00, 0x12, 0x1C, 0x00, 0x84, 0x75, 0x27, 0x72, 0x65, 0x00, 0x52, 0xD1, 0x49, 0x1C, 0xD9, 0x49,
-    0x00, 0x1C, 0x00, 0x84, 0x75, 0x27, 0x72, 0x65, 0x00, 0x84, 0x6F, 0x75, 0x27, 0x72, 0x65, 0x00,
-    0x52, 0xE7, 0x49, 0x1C, 0xEF, 0x49, 0x00, 0x1C, 0x00, 0x84, 0x75, 0x27, 0x72, 0x65, 0x00, 0x84,
-    0x6F, 0x75, 0x27, 0x72, 0x65, 0x00, 0x83, 0x6F, 0x75, 0x27, 0x72, 0x65, 0x00, 0x52, 0x04, 0x4A,
-    0x18, 0x0C, 0x4A, 0x00, 0x1C, 0x00, 0x83, 0x75, 0x27, 0x72, 0x65, 0x00, 0x12, 0x1C, 0x00, 0x83,
-    0x27, 0x72, 0x65, 0x00, 0x44, 0x2A, 0x4A, 0x08, 0x44, 0x4A, 0x10, 0x5F, 0x4A, 0x14, 0x6B, 0x4A,
-    0x16, 0x86, 0x4A, 0x1A, 0xA1, 0x4A, 0x1D, 0x87, 0x4C, 0x00, 0x50, 0x31, 0x4A, 0x1A, 0x3B, 0x4A,
-    0x00, 0x15, 0x0C, 0x09, 0x00, 0x83, 0x77, 0x61, 0x72, 0x65, 0x00, 0x10, 0x15, 0x0C, 0x09, 0x00,
-    0x82, 0x72, 0x65, 0x00, 0x50, 0x4B, 0x4A, 0x1A, 0x55, 0x4A, 0x00, 0x15, 0x0C, 0x09, 0x00, 0x83,
-    0x77, 0x61, 0x72, 0x65, 0x00, 0x10, 0x15, 0x0C, 0x09, 0x00, 0x83, 0x61, 0x72, 0x65, 0x00, 0x1A,
-    0x15, 0x0C, 0x09, 0x00, 0x84, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x50, 0x72, 0x4A, 0x1A, 0x7C,
-    0x4A, 0x00, 0x15, 0x0C, 0x09, 0x00, 0x83, 0x77, 0x61, 0x72, 0x65, 0x00, 0x10, 0x15, 0x0C, 0x09,
-    0x00, 0x83, 0x61, 0x72, 0x65, 0x00, 0x50, 0x8D, 0x4A, 0x1A, 0x97, 0x4A, 0x00, 0x15, 0x0C, 0x09,
-    0x00, 0x83, 0x77, 0x61, 0x72, 0x65, 0x00, 0x10, 0x15, 0x0C, 0x09, 0x00, 0x83, 0x61, 0x72, 0x65,
-    0x00, 0x44, 0xC0, 0x4A, 0x08, 0xCB, 0x4A, 0x0D, 0xD6, 0x4A, 0x0E, 0xF1, 0x4A, 0x10, 0x0C, 0x4B,
-    0x11, 0x31, 0x4C, 0x14, 0x4C, 0x4C, 0x15, 0x57, 0x4C, 0x16, 0x72, 0x4C, 0x1A, 0x7D, 0x4C, 0x00,
-    0x10, 0x15, 0x0C, 0x09, 0x00, 0x84, 0x77, 0x61, 0x72, 0x65, 0x00, 0x10, 0x15, 0x0C, 0x09, 0x00,
-    0x84, 0x77, 0x61, 0x72, 0x65, 0x00, 0x50, 0xDD, 0x4A, 0x15, 0xE7, 0x4A, 0x00, 0x15, 0x0C, 0x09,
-    0x00, 0x84, 0x77, 0x61, 0x72, 0x65, 0x00, 0x0C, 0x09, 0x00, 0x84, 0x6D, 0x77, 0x61, 0x72, 0x65,
-    0x00, 0x50, 0xF8, 0x4A, 0x15, 0x02, 0x4B, 0x00, 0x15, 0x0C, 0x09, 0x00, 0x84, 0x77, 0x61, 0x72,
-    0x65, 0x00, 0x0C, 0x09, 0x00, 0x84, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x48, 0x25, 0x4B, 0x09,
-    0x40, 0x4B, 0x0C, 0x5B, 0x4B, 0x0D, 0x75, 0x4B, 0x0E, 0x80, 0x4B, 0x11, 0x8B, 0x4B, 0x15, 0x96,
-    0x4B, 0x17, 0x16, 0x4C, 0x00, 0x4C, 0x2C, 0x4B, 0x15, 0x36, 0x4B, 0x00, 0x09, 0x00, 0x85, 0x72,
-    0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x0C, 0x09, 0x00, 0x85, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00,
-    0x4C, 0x47, 0x4B, 0x15, 0x51, 0x4B, 0x00, 0x09, 0x00, 0x85, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65,
-    0x00, 0x0C, 0x09, 0x00, 0x85, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x49, 0x62, 0x4B, 0x15, 0x6A,
-    0x4B, 0x00, 0x84, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x09, 0x00, 0x86, 0x69, 0x72, 0x6D,
-    0x77, 0x61, 0x72, 0x65, 0x00, 0x15, 0x0C, 0x09, 0x00, 0x85, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00,
-    0x15, 0x0C, 0x09, 0x00, 0x85, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x15, 0x0C, 0x09, 0x00, 0x85,
-    0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x48, 0xA9, 0x4B, 0x09, 0xB4, 0x4B, 0x0E, 0xBD, 0x4B, 0x12,
-    0xD7, 0x4B, 0x17, 0xF1, 0x4B, 0x18, 0xFC, 0x4B, 0x00, 0x0C, 0x09, 0x00, 0x86, 0x72, 0x6D, 0x77,
-    0x61, 0x72, 0x65, 0x00, 0x85, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x49, 0xC4, 0x4B,
-    0x0C, 0xCD, 0x4B, 0x00, 0x86, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x09, 0x00, 0x86,
-    0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x49, 0xDE, 0x4B, 0x0C, 0xE7, 0x4B, 0x00, 0x86, 0x69,
-    0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x09, 0x00, 0x86, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65,
-    0x00, 0x0C, 0x09, 0x00, 0x86, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x49, 0x03, 0x4C, 0x0C,
-    0x0C, 0x4C, 0x00, 0x86, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x09, 0x00, 0x86, 0x72,
-    0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x4C, 0x1D, 0x4C, 0x15, 0x27, 0x4C, 0x00, 0x09, 0x00, 0x85,
-    0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x0C, 0x09, 0x00, 0x85, 0x6D, 0x77, 0x61, 0x72, 0x65,
-    0x00, 0x50, 0x38, 0x4C, 0x15, 0x42, 0x4C, 0x00, 0x15, 0x0C, 0x09, 0x00, 0x84, 0x77, 0x61, 0x72,
-    0x65, 0x00, 0x0C, 0x09, 0x00, 0x84, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x10, 0x15, 0x0C, 0x09,
-    0x00, 0x84, 0x77, 0x61, 0x72, 0x65, 0x00, 0x4C, 0x5E, 0x4C, 0x10, 0x67, 0x4C, 0x00, 0x09, 0x00,
-    0x83, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x0C, 0x09, 0x00, 0x85, 0x72, 0x6D, 0x77, 0x61, 0x72,
-    0x65, 0x00, 0x10, 0x15, 0x0C, 0x09, 0x00, 0x84, 0x77, 0x61, 0x72, 0x65, 0x00, 0x10, 0x15, 0x0C,
-    0x09, 0x00, 0x83, 0x61, 0x72, 0x65, 0x00, 0x1A, 0x10, 0x15, 0x0C, 0x09, 0x00, 0x83, 0x61, 0x72,
-    0x65, 0x00, 0x48, 0x99, 0x4C, 0x0B, 0xA8, 0x4C, 0x00, 0x4B, 0xA0, 0x4C, 0x1A, 0xA4, 0x4C, 0x00,
-    0x82, 0x72, 0x65, 0x00, 0x82, 0x72, 0x65, 0x00, 0x57, 0xAF, 0x4C, 0x1A, 0xB4, 0x4C, 0x00, 0x82,
-    0x65, 0x72, 0x65, 0x00, 0x82, 0x65, 0x72, 0x65, 0x00, 0x44, 0xE1, 0x4C, 0x05, 0xE8, 0x4C, 0x07,
-    0x03, 0x4D, 0x0A, 0x0A, 0x4D, 0x0B, 0x25, 0x4D, 0x0D, 0xBD, 0x4D, 0x11, 0xD8, 0x4D, 0x12, 0xEA,
-    0x4D, 0x14, 0xF0, 0x4D, 0x15, 0xF7, 0x4D, 0x16, 0x08, 0x4E, 0x1A, 0x0F, 0x4E, 0x1C, 0x3E, 0x4E,
-    0x00, 0x1A, 0x00, 0x83, 0x65, 0x72, 0x65, 0x00, 0x4B, 0xF2, 0x4C, 0x17, 0xF7, 0x4C, 0x1A, 0xFD,
-    0x4C, 0x00, 0x83, 0x65, 0x72, 0x65, 0x00, 0x83, 0x68, 0x65, 0x72, 0x65, 0x00, 0x83, 0x68, 0x65,
-    0x72, 0x65, 0x00, 0x0B, 0x00, 0x83, 0x65, 0x72, 0x65, 0x00, 0x4B, 0x14, 0x4D, 0x17, 0x19, 0x4D,
-    0x1A, 0x1F, 0x4D, 0x00, 0x83, 0x65, 0x72, 0x65, 0x00, 0x83, 0x68, 0x65, 0x72, 0x65, 0x00, 0x83,
-    0x68, 0x65, 0x72, 0x65, 0x00, 0x45, 0x41, 0x4D, 0x08, 0x47, 0x4D, 0x0A, 0x4E, 0x4D, 0x0D, 0x61,
-    0x4D, 0x11, 0x67, 0x4D, 0x14, 0x6F, 0x4D, 0x17, 0x76, 0x4D, 0x1A, 0x7F, 0x4D, 0x1C, 0xAA, 0x4D,
-    0x00, 0x84, 0x68, 0x65, 0x72, 0x65, 0x00, 0x84, 0x77, 0x68, 0x65, 0x72, 0x65, 0x00, 0x57, 0x55,
-    0x4D, 0x1A, 0x5B, 0x4D, 0x00, 0x84, 0x68, 0x65, 0x72, 0x65, 0x00, 0x84, 0x68, 0x65, 0x72, 0x65,
-    0x00, 0x84, 0x68, 0x65, 0x72, 0x65, 0x00, 0x2C, 0x00, 0x84, 0x68, 0x65, 0x72, 0x65, 0x00, 0x84,
-    0x77, 0x68, 0x65, 0x72, 0x65, 0x00, 0x0A, 0x00, 0x85, 0x74, 0x68, 0x65, 0x72, 0x65, 0x00, 0x44,
-    0x8C, 0x4D, 0x08, 0x93, 0x4D, 0x14, 0x9C, 0x4D, 0x16, 0xA3, 0x4D, 0x00, 0x85, 0x77, 0x68, 0x65,
-    0x72, 0x65, 0x00, 0x2C, 0x00, 0x85, 0x77, 0x68, 0x65, 0x72, 0x65, 0x00, 0x85, 0x77, 0x68, 0x65,
-    0x72, 0x65, 0x00, 0x85, 0x77, 0x68, 0x65, 0x72, 0x65, 0x00, 0x57, 0xB1, 0x4D, 0x1A, 0xB7, 0x4D,
-    0x00, 0x84, 0x68, 0x65, 0x72, 0x65, 0x00, 0x84, 0x68, 0x65, 0x72, 0x65, 0x00, 0x4B, 0xC7, 0x4D,
-    0x17, 0xCC, 0x4D, 0x1A, 0xD2, 0x4D, 0x00, 0x83, 0x65, 0x72, 0x65, 0x00, 0x83, 0x68, 0x65, 0x72,
-    0x65, 0x00, 0x83, 0x68, 0x65, 0x72, 0x65, 0x00, 0x4B, 0xDF, 0x4D, 0x1A, 0xE4, 0x4D, 0x00, 0x83,
-    0x65, 0x72, 0x65, 0x00, 0x83, 0x68, 0x65, 0x72, 0x65, 0x00, 0x10, 0x00, 0x82, 0x72, 0x65, 0x00,
-    0x1A, 0x00, 0x83, 0x65, 0x72, 0x65, 0x00, 0x4B, 0xFE, 0x4D, 0x1A, 0x03, 0x4E, 0x00, 0x83, 0x65,
-    0x72, 0x65, 0x00, 0x83, 0x65, 0x72, 0x65, 0x00, 0x1A, 0x00, 0x83, 0x65, 0x72, 0x65, 0x00, 0x44,
-    0x1C, 0x4E, 0x0B, 0x22, 0x4E, 0x14, 0x33, 0x4E, 0x1A, 0x39, 0x4E, 0x00, 0x84, 0x77, 0x65, 0x72,
-    0x65, 0x00, 0x57, 0x29, 0x4E, 0x1A, 0x2E, 0x4E, 0x00, 0x83, 0x65, 0x72, 0x65, 0x00, 0x83, 0x65,
-    0x72, 0x65, 0x00, 0x84, 0x77, 0x65, 0x72, 0x65, 0x00, 0x83, 0x65, 0x72, 0x65, 0x00, 0x4B, 0x45,
-    0x4E, 0x17, 0x4A, 0x4E, 0x00, 0x83, 0x65, 0x72, 0x65, 0x00, 0x83, 0x68, 0x65, 0x72, 0x65, 0x00,
-    0x74, 0x63, 0x4E, 0x04, 0x6B, 0x4E, 0x08, 0x75, 0x4E, 0x0C, 0x84, 0x4E, 0x12, 0x89, 0x4E, 0x18,
-    0xA6, 0x4E, 0x00, 0x18, 0x12, 0x1C, 0x00, 0x82, 0x72, 0x65, 0x00, 0x1A, 0x10, 0x15, 0x0C, 0x09,
-    0x00, 0x82, 0x72, 0x65, 0x00, 0x4B, 0x7C, 0x4E, 0x1A, 0x80, 0x4E, 0x00, 0x82, 0x72, 0x65, 0x00,
-    0x82, 0x72, 0x65, 0x00, 0x0F, 0x00, 0x81, 0x65, 0x00, 0x48, 0x93, 0x4E, 0x09, 0x9B, 0x4E, 0x10,
-    0xA2, 0x4E, 0x00, 0x05, 0x00, 0x83, 0x66, 0x6F, 0x72, 0x65, 0x00, 0x08, 0x05, 0x00, 0x82, 0x72,
-    0x65, 0x00, 0x82, 0x72, 0x65, 0x00, 0x16, 0x04, 0x08, 0x10, 0x00, 0x82, 0x72, 0x65, 0x00, 0x08,
-    0x00, 0x57, 0xB8, 0x4E, 0x1A, 0xBE, 0x4E, 0x00, 0x83, 0x68, 0x65, 0x72, 0x65, 0x00, 0x83, 0x68,
-    0x65, 0x72, 0x65, 0x00, 0x48, 0xD1, 0x4E, 0x12, 0xD6, 0x4E, 0x16, 0xDE, 0x4E, 0x18, 0xE7, 0x4E,
-    0x00, 0x0B, 0x17, 0x00, 0x80, 0x00, 0x09, 0x08, 0x05, 0x00, 0x82, 0x72, 0x65, 0x00, 0x04, 0x08,
-    0x10, 0x00, 0x82, 0x75, 0x72, 0x65, 0x00, 0x16, 0x04, 0x08, 0x10, 0x00, 0x82, 0x72, 0x65, 0x00,
-    0x56, 0xF7, 0x4E, 0x18, 0x00, 0x4F, 0x00, 0x04, 0x08, 0x10, 0x00, 0x82, 0x75, 0x72, 0x65, 0x00,
-    0x16, 0x04, 0x08, 0x10, 0x00, 0x82, 0x72, 0x65, 0x00, 0x44, 0x10, 0x4F, 0x0C, 0x1D, 0x4F, 0x00,
-    0x50, 0x17, 0x4F, 0x17, 0x1A, 0x4F, 0x00, 0x81, 0x65, 0x00, 0x81, 0x65, 0x00, 0x0F, 0x00, 0x81,
-    0x65, 0x00, 0x49, 0x29, 0x4F, 0x12, 0x31, 0x4F, 0x00, 0x08, 0x05, 0x00, 0x82, 0x6F, 0x72, 0x65,
-    0x00, 0x49, 0x38, 0x4F, 0x10, 0x3F, 0x4F, 0x00, 0x08, 0x05, 0x00, 0x82, 0x72, 0x65, 0x00, 0x82,
-    0x72, 0x65, 0x00, 0x44, 0x4D, 0x4F, 0x0C, 0x5A, 0x4F, 0x12, 0x5F, 0x4F, 0x00, 0x4A, 0x54, 0x4F,
-    0x16, 0x57, 0x4F, 0x00, 0x81, 0x65, 0x00, 0x81, 0x65, 0x00, 0x17, 0x00, 0x81, 0x65, 0x00, 0x46,
-    0x69, 0x4F, 0x0B, 0x6C, 0x4F, 0x16, 0x6F, 0x4F, 0x00, 0x81, 0x65, 0x00, 0x81, 0x65, 0x00, 0x81,
-    0x65, 0x00, 0x46, 0x9D, 0x4F, 0x07, 0xA6, 0x4F, 0x08, 0xBD, 0x4F, 0x09, 0xD3, 0x4F, 0x0A, 0x50,
-    0x50, 0x0C, 0x59, 0x50, 0x0D, 0x6D, 0x50, 0x0E, 0x74, 0x50, 0x0F, 0x7B, 0x50, 0x10, 0x91, 0x50,
-    0x11, 0xAD, 0x50, 0x13, 0xB4, 0x50, 0x15, 0xCA, 0x50, 0x19, 0xE1, 0x50, 0x00, 0x09, 0x08, 0x05,
-    0x00, 0x83, 0x6F, 0x72, 0x65, 0x00, 0x48, 0xAD, 0x4F, 0x09, 0xB5, 0x4F, 0x00, 0x05, 0x00, 0x83,
-    0x66, 0x6F, 0x72, 0x65, 0x00, 0x08, 0x05, 0x00, 0x83, 0x6F, 0x72, 0x65, 0x00, 0x45, 0xC4, 0x4F,
-    0x09, 0xCA, 0x4F, 0x00, 0x82, 0x66, 0x6F, 0x72, 0x65, 0x00, 0x05, 0x00, 0x84, 0x65, 0x66, 0x6F,
-    0x72, 0x65, 0x00, 0x46, 0xE9, 0x4F, 0x07, 0xF2, 0x4F, 0x08, 0x08, 0x50, 0x0A, 0x12, 0x50, 0x15,
-    0x1B, 0x50, 0x19, 0x31, 0x50, 0x1A, 0x3A, 0x50, 0x00, 0x08, 0x05, 0x00, 0x84, 0x66, 0x6F, 0x72,
-    0x65, 0x00, 0x45, 0xF9, 0x4F, 0x08, 0x00, 0x50, 0x00, 0x84, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x00,
-    0x05, 0x00, 0x84, 0x66, 0x6F, 0x72, 0x65, 0x00, 0x2C, 0x00, 0x84, 0x62, 0x65, 0x66, 0x6F, 0x72,
-    0x65, 0x00, 0x08, 0x05, 0x00, 0x84, 0x66, 0x6F, 0x72, 0x65, 0x00, 0x45, 0x22, 0x50, 0x08, 0x29,
-    0x50, 0x00, 0x84, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x00, 0x05, 0x00, 0x84, 0x66, 0x6F, 0x72, 0x65,
-    0x00, 0x08, 0x05, 0x00, 0x84, 0x66, 0x6F, 0x72, 0x65, 0x00, 0x45, 0x41, 0x50, 0x08, 0x48, 0x50,
-    0x00, 0x84, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x00, 0x05, 0x00, 0x84, 0x66, 0x6F, 0x72, 0x65, 0x00,
-    0x09, 0x08, 0x05, 0x00, 0x83, 0x6F, 0x72, 0x65, 0x00, 0x49, 0x60, 0x50, 0x10, 0x68, 0x50, 0x00,
-    0x08, 0x05, 0x00, 0x83, 0x6F, 0x72, 0x65, 0x00, 0x83, 0x6F, 0x72, 0x65, 0x00, 0x10, 0x00, 0x83,
-    0x6F, 0x72, 0x65, 0x00, 0x10, 0x00, 0x83, 0x6F, 0x72, 0x65, 0x00, 0x49, 0x82, 0x50, 0x10, 0x8A,
-    0x50, 0x00, 0x08, 0x05, 0x00, 0x83, 0x6F, 0x72, 0x65, 0x00, 0x2C, 0x00, 0x83, 0x6F, 0x72, 0x65,
-    0x00, 0x4D, 0x9B, 0x50, 0x0E, 0xA1, 0x50, 0x11, 0xA7, 0x50, 0x00, 0x84, 0x6D, 0x6F, 0x72, 0x65,
-    0x00, 0x84, 0x6D, 0x6F, 0x72, 0x65, 0x00, 0x84, 0x6D, 0x6F, 0x72, 0x65, 0x00, 0x10, 0x00, 0x83,
-    0x6F, 0x72, 0x65, 0x00, 0x49, 0xBB, 0x50, 0x10, 0xC3, 0x50, 0x00, 0x08, 0x05, 0x00, 0x83, 0x6F,
-    0x72, 0x65, 0x00, 0x2C, 0x00, 0x83, 0x6F, 0x72, 0x65, 0x00, 0x48, 0xD1, 0x50, 0x09, 0xD9, 0x50,
-    0x00, 0x05, 0x00, 0x83, 0x66, 0x6F, 0x72, 0x65, 0x00, 0x08, 0x05, 0x00, 0x83, 0x6F, 0x72, 0x65,
-    0x00, 0x48, 0xE8, 0x50, 0x09, 0xF0, 0x50, 0x00, 0x05, 0x00, 0x83, 0x66, 0x6F, 0x72, 0x65, 0x00,
-    0x08, 0x05, 0x00, 0x83, 0x6F, 0x72, 0x65, 0x00, 0x49, 0xFF, 0x50, 0x12, 0x07, 0x51, 0x00, 0x08,
-    0x05, 0x00, 0x82, 0x6F, 0x72, 0x65, 0x00, 0x09, 0x08, 0x05, 0x00, 0x82, 0x72, 0x65, 0x00, 0x44,
-    0x16, 0x51, 0x1A, 0x20, 0x51, 0x00, 0x1A, 0x10, 0x15, 0x0C, 0x09, 0x00, 0x82, 0x72, 0x65, 0x00,
-    0x10, 0x15, 0x0C, 0x09, 0x00, 0x82, 0x61, 0x72, 0x65, 0x00, 0x0B, 0x1A, 0x00, 0x82, 0x65, 0x72,
-    0x65, 0x00, 0x44, 0x3C, 0x51, 0x18, 0x53, 0x51, 0x1A, 0x5D, 0x51, 0x00, 0x48, 0x43, 0x51, 0x1A,
-    0x4A, 0x51, 0x00, 0x10, 0x00, 0x81, 0x75, 0x72, 0x65, 0x00, 0x10, 0x15, 0x0C, 0x09, 0x00, 0x82,
-    0x72, 0x65, 0x00, 0x04, 0x08, 0x10, 0x00, 0x83, 0x73, 0x75, 0x72, 0x65, 0x00, 0x10, 0x15, 0x0C,
-    0x09, 0x00, 0x82, 0x61, 0x72, 0x65, 0x00, 0x74, 0x7A, 0x51, 0x04, 0x82, 0x51, 0x08, 0x8C, 0x51,
-    0x09, 0x9B, 0x51, 0x12, 0xA1, 0x51, 0x18, 0xA9, 0x51, 0x00, 0x18, 0x12, 0x1C, 0x00, 0x82, 0x72,
-    0x65, 0x00, 0x1A, 0x10, 0x15, 0x0C, 0x09, 0x00, 0x82, 0x72, 0x65, 0x00, 0x4B, 0x93, 0x51, 0x1A,
-    0x97, 0x51, 0x00, 0x82, 0x72, 0x65, 0x00, 0x82, 0x72, 0x65, 0x00, 0x04, 0x00, 0x81, 0x65, 0x72,
-    0x00, 0x09, 0x08, 0x05, 0x00, 0x82, 0x72, 0x65, 0x00, 0x16, 0x04, 0x08, 0x10, 0x00, 0x82, 0x72,
-    0x65, 0x00, 0x74, 0xD1, 0x51, 0x04, 0xDA, 0x51, 0x07, 0x0D, 0x52, 0x08, 0x26, 0x52, 0x0C, 0x3F,
-    0x52, 0x0D, 0x49, 0x52, 0x16, 0x53, 0x52, 0x1A, 0xA6, 0x53, 0x1B, 0xBF, 0x53, 0x1C, 0xD8, 0x53,
-    0x00, 0x12, 0x1C, 0x00, 0x83, 0x75, 0x27, 0x72, 0x65, 0x00, 0x44, 0xE4, 0x51, 0x08, 0xED, 0x51,
-    0x16, 0xF5, 0x51, 0x00, 0x08, 0x10, 0x00, 0x83, 0x73, 0x75, 0x72, 0x65, 0x00, 0x10, 0x00, 0x82,
-    0x73, 0x75, 0x72, 0x65, 0x00, 0x44, 0xFC, 0x51, 0x08, 0x04, 0x52, 0x00, 0x08, 0x10, 0x00, 0x83,
-    0x75, 0x72, 0x65, 0x00, 0x10, 0x00, 0x84, 0x61, 0x73, 0x75, 0x72, 0x65, 0x00, 0x44, 0x14, 0x52,
-    0x16, 0x1D, 0x52, 0x00, 0x08, 0x10, 0x00, 0x83, 0x73, 0x75, 0x72, 0x65, 0x00, 0x04, 0x08, 0x10,
-    0x00, 0x83, 0x75, 0x72, 0x65, 0x00, 0x44, 0x2D, 0x52, 0x16, 0x36, 0x52, 0x00, 0x08, 0x10, 0x00,
-    0x83, 0x73, 0x75, 0x72, 0x65, 0x00, 0x04, 0x08, 0x10, 0x00, 0x83, 0x75, 0x72, 0x65, 0x00, 0x16,
-    0x04, 0x08, 0x10, 0x00, 0x83, 0x75, 0x72, 0x65, 0x00, 0x16, 0x04, 0x08, 0x10, 0x00, 0x83, 0x75,
-    0x72, 0x65, 0x00, 0x44, 0x6C, 0x52, 0x07, 0x0A, 0x53, 0x08, 0x14, 0x53, 0x14, 0x39, 0x53, 0x16,
-    0x52, 0x53, 0x1A, 0x6A, 0x53, 0x1B, 0x83, 0x53, 0x1D, 0x8D, 0x53, 0x00, 0x44, 0x88, 0x52, 0x07,
-    0x91, 0x52, 0x08, 0xA9, 0x52, 0x10, 0xB4, 0x52, 0x14, 0xBC, 0x52, 0x15, 0xC6, 0x52, 0x16, 0xDE,
-    0x52, 0x1A, 0xE8, 0x52, 0x1D, 0x00, 0x53, 0x00, 0x08, 0x10, 0x00, 0x84, 0x73, 0x75, 0x72, 0x65,
-    0x00, 0x48, 0x98, 0x52, 0x10, 0xA1, 0x52, 0x00, 0x10, 0x00, 0x85, 0x61, 0x73, 0x75, 0x72, 0x65,
-    0x00, 0x85, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x00, 0x2C, 0x00, 0x85, 0x6D, 0x65, 0x61, 0x73,
-    0x75, 0x72, 0x65, 0x00, 0x84, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x00, 0x08, 0x10, 0x00, 0x85,
-    0x61, 0x73, 0x75, 0x72, 0x65, 0x00, 0x48, 0xCD, 0x52, 0x10, 0xD6, 0x52, 0x00, 0x10, 0x00, 0x85,
-    0x61, 0x73, 0x75, 0x72, 0x65, 0x00, 0x85, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x00, 0x08, 0x10,
-    0x00, 0x85, 0x61, 0x73, 0x75, 0x72, 0x65, 0x00, 0x48, 0xEF, 0x52, 0x10, 0xF8, 0x52, 0x00, 0x10,
-    0x00, 0x85, 0x61, 0x73, 0x75, 0x72, 0x65, 0x00, 0x85, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x00,
-    0x08, 0x10, 0x00, 0x85, 0x61, 0x73, 0x75, 0x72, 0x65, 0x00, 0x04, 0x08, 0x10, 0x00, 0x84, 0x73,
-    0x75, 0x72, 0x65, 0x00, 0x44, 0x1B, 0x53, 0x10, 0x32, 0x53, 0x00, 0x48, 0x22, 0x53, 0x10, 0x2A,
-    0x53, 0x00, 0x10, 0x00, 0x84, 0x73, 0x75, 0x72, 0x65, 0x00, 0x85, 0x65, 0x61, 0x73, 0x75, 0x72,
-    0x65, 0x00, 0x83, 0x61, 0x73, 0x75, 0x72, 0x65, 0x00, 0x44, 0x40, 0x53, 0x08, 0x49, 0x53, 0x00,
-    0x08, 0x10, 0x00, 0x84, 0x73, 0x75, 0x72, 0x65, 0x00, 0x10, 0x00, 0x84, 0x61, 0x73, 0x75, 0x72,
-    0x65, 0x00, 0x44, 0x59, 0x53, 0x08, 0x61, 0x53, 0x00, 0x08, 0x10, 0x00, 0x83, 0x75, 0x72, 0x65,
-    0x00, 0x10, 0x00, 0x84, 0x61, 0x73, 0x75, 0x72, 0x65, 0x00, 0x44, 0x71, 0x53, 0x08, 0x7A, 0x53,
-    0x00, 0x08, 0x10, 0x00, 0x84, 0x73, 0x75, 0x72, 0x65, 0x00, 0x10, 0x00, 0x84, 0x61, 0x73, 0x75,
-    0x72, 0x65, 0x00, 0x04, 0x08, 0x10, 0x00, 0x84, 0x73, 0x75, 0x72, 0x65, 0x00, 0x44, 0x94, 0x53,
-    0x08, 0x9D, 0x53, 0x00, 0x08, 0x10, 0x00, 0x84, 0x73, 0x75, 0x72, 0x65, 0x00, 0x10, 0x00, 0x84,
-    0x61, 0x73, 0x75, 0x72, 0x65, 0x00, 0x44, 0xAD, 0x53, 0x16, 0xB6, 0x53, 0x00, 0x08, 0x10, 0x00,
-    0x83, 0x73, 0x75, 0x72, 0x65, 0x00, 0x04, 0x08, 0x10, 0x00, 0x83, 0x75, 0x72, 0x65, 0x00, 0x44,
-    0xC6, 0x53, 0x16, 0xCF, 0x53, 0x00, 0x08, 0x10, 0x00, 0x83, 0x73, 0x75, 0x72, 0x65, 0x00, 0x04,
-    0x08, 0x10, 0x00, 0x83, 0x75, 0x72, 0x65, 0x00, 0x16, 0x04, 0x08, 0x10, 0x00, 0x83, 0x75, 0x72,
-    0x65, 0x00, 0x44, 0xEC, 0x53, 0x08, 0xF1, 0x53, 0x12, 0xF7, 0x53, 0x00, 0x0B, 0x00, 0x81, 0x65,
-    0x00, 0x11, 0x00, 0x81, 0x65, 0x72, 0x00, 0x0F, 0x00, 0x81, 0x65, 0x00, 0x44, 0x0C, 0x54, 0x08,
-    0x26, 0x54, 0x0B, 0x35, 0x54, 0x10, 0x46, 0x54, 0x1A, 0x4F, 0x54, 0x00, 0x50, 0x13, 0x54, 0x1A,
-    0x1D, 0x54, 0x00, 0x15, 0x0C, 0x09, 0x00, 0x83, 0x77, 0x61, 0x72, 0x65, 0x00, 0x10, 0x15, 0x0C,
-    0x09, 0x00, 0x82, 0x72, 0x65, 0x00, 0x4B, 0x2D, 0x54, 0x1A, 0x31, 0x54, 0x00, 0x82, 0x72, 0x65,
-    0x00, 0x82, 0x72, 0x65, 0x00, 0x57, 0x3C, 0x54, 0x1A, 0x41, 0x54, 0x00, 0x82, 0x65, 0x72, 0x65,
-    0x00, 0x82, 0x65, 0x72, 0x65, 0x00, 0x15, 0x0C, 0x09, 0x00, 0x81, 0x61, 0x72, 0x65, 0x00, 0x10,
-    0x15, 0x0C, 0x09, 0x00, 0x82, 0x61, 0x72, 0x65, 0x00, 0x56, 0x60, 0x54, 0x18, 0x69, 0x54, 0x00,
-    0x04, 0x08, 0x10, 0x00, 0x82, 0x75, 0x72, 0x65, 0x00, 0x16, 0x04, 0x08, 0x10, 0x00, 0x82, 0x72,
-    0x65, 0x00, 0x44, 0x79, 0x54, 0x1A, 0x83, 0x54, 0x00, 0x1A, 0x10, 0x15, 0x0C, 0x09, 0x00, 0x82,
-    0x72, 0x65, 0x00, 0x10, 0x15, 0x0C, 0x09, 0x00, 0x82, 0x61, 0x72, 0x65, 0x00, 0x74, 0xC1, 0x54,
-    0x04, 0xC6, 0x54, 0x06, 0x01, 0x55, 0x07, 0x08, 0x55, 0x08, 0x3B, 0x55, 0x0B, 0x4A, 0x56, 0x0C,
-    0x53, 0x56, 0x0D, 0x6C, 0x56, 0x0F, 0x85, 0x56, 0x11, 0x9A, 0x56, 0x12, 0xA1, 0x56, 0x13, 0xA2,
-    0x57, 0x15, 0xB7, 0x57, 0x18, 0xD4, 0x57, 0x1A, 0xC8, 0x59, 0x1B, 0xF3, 0x59, 0x1C, 0x14, 0x5A,
-    0x00, 0x17, 0x0C, 0x00, 0x80, 0x00, 0x46, 0xD3, 0x54, 0x08, 0xDB, 0x54, 0x12, 0xE2, 0x54, 0x18,
-    0xE9, 0x54, 0x00, 0x08, 0x05, 0x00, 0x81, 0x75, 0x73, 0x65, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x73,
-    0x65, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x73, 0x65, 0x00, 0x44, 0xF0, 0x54, 0x06, 0xF8, 0x54, 0x00,
-    0x06, 0x08, 0x05, 0x00, 0x82, 0x73, 0x65, 0x00, 0x08, 0x05, 0x00, 0x83, 0x61, 0x75, 0x73, 0x65,
-    0x00, 0x11, 0x0C, 0x16, 0x00, 0x81, 0x65, 0x00, 0x44, 0x18, 0x55, 0x08, 0x1D, 0x55, 0x0B, 0x24,
-    0x55, 0x12, 0x2B, 0x55, 0x18, 0x32, 0x55, 0x00, 0x10, 0x00, 0x81, 0x65, 0x00, 0x0B, 0x17, 0x00,
-    0x82, 0x73, 0x65, 0x00, 0x17, 0x00, 0x82, 0x65, 0x73, 0x65, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x73,
-    0x65, 0x00, 0x04, 0x06, 0x08, 0x05, 0x00, 0x82, 0x73, 0x65, 0x00, 0x45, 0x5D, 0x55, 0x07, 0x71,
-    0x55, 0x0A, 0x79, 0x55, 0x0B, 0x8D, 0x55, 0x0D, 0xF1, 0x55, 0x11, 0x05, 0x56, 0x12, 0x19, 0x56,
-    0x15, 0x1D, 0x56, 0x17, 0x25, 0x56, 0x1A, 0x2E, 0x56, 0x1C, 0x36, 0x56, 0x00, 0x4B, 0x64, 0x55,
-    0x17, 0x6B, 0x55, 0x00, 0x17, 0x00, 0x83, 0x65, 0x73, 0x65, 0x00, 0x83, 0x68, 0x65, 0x73, 0x65,
-    0x00, 0x0B, 0x17, 0x00, 0x83, 0x65, 0x73, 0x65, 0x00, 0x4B, 0x80, 0x55, 0x17, 0x87, 0x55, 0x00,
-    0x17, 0x00, 0x83, 0x65, 0x73, 0x65, 0x00, 0x83, 0x68, 0x65, 0x73, 0x65, 0x00, 0x45, 0xA3, 0x55,
-    0x0A, 0xAB, 0x55, 0x0D, 0xB4, 0x55, 0x11, 0xBC, 0x55, 0x15, 0xC4, 0x55, 0x17, 0xCB, 0x55, 0x1C,
-    0xEA, 0x55, 0x00, 0x17, 0x00, 0x84, 0x68, 0x65, 0x73, 0x65, 0x00, 0x2C, 0x00, 0x84, 0x74, 0x68,
-    0x65, 0x73, 0x65, 0x00, 0x17, 0x00, 0x84, 0x68, 0x65, 0x73, 0x65, 0x00, 0x17, 0x00, 0x84, 0x68,
-    0x65, 0x73, 0x65, 0x00, 0x84, 0x74, 0x68, 0x65, 0x73, 0x65, 0x00, 0x4A, 0xD5, 0x55, 0x15, 0xDC,
-    0x55, 0x1C, 0xE3, 0x55, 0x00, 0x85, 0x74, 0x68, 0x65, 0x73, 0x65, 0x00, 0x85, 0x74, 0x68, 0x65,
-    0x73, 0x65, 0x00, 0x85, 0x74, 0x68, 0x65, 0x73, 0x65, 0x00, 0x84, 0x74, 0x68, 0x65, 0x73, 0x65,
-    0x00, 0x4B, 0xF8, 0x55, 0x17, 0xFF, 0x55, 0x00, 0x17, 0x00, 0x83, 0x65, 0x73, 0x65, 0x00, 0x83,
-    0x68, 0x65, 0x73, 0x65, 0x00, 0x4B, 0x0C, 0x56, 0x17, 0x13, 0x56, 0x00, 0x17, 0x00, 0x83, 0x65,
-    0x73, 0x65, 0x00, 0x83, 0x68, 0x65, 0x73, 0x65, 0x00, 0x07, 0x00, 0x80, 0x00, 0x0B, 0x17, 0x00,
-    0x83, 0x65, 0x73, 0x65, 0x00, 0x0B, 0x00, 0x84, 0x74, 0x68, 0x65, 0x73, 0x65, 0x00, 0x0B, 0x17,
-    0x00, 0x83, 0x65, 0x73, 0x65, 0x00, 0x4B, 0x3D, 0x56, 0x17, 0x44, 0x56, 0x00, 0x17, 0x00, 0x83,
-    0x65, 0x73, 0x65, 0x00, 0x83, 0x68, 0x65, 0x73, 0x65, 0x00, 0x12, 0x17, 0x00, 0x83, 0x68, 0x6F,
-    0x73, 0x65, 0x00, 0x44, 0x5A, 0x56, 0x18, 0x63, 0x56, 0x00, 0x06, 0x08, 0x05, 0x00, 0x82, 0x75,
-    0x73, 0x65, 0x00, 0x04, 0x06, 0x08, 0x05, 0x00, 0x82, 0x73, 0x65, 0x00, 0x44, 0x73, 0x56, 0x18,
-    0x7C, 0x56, 0x00, 0x06, 0x08, 0x05, 0x00, 0x82, 0x75, 0x73, 0x65, 0x00, 0x04, 0x06, 0x08, 0x05,
-    0x00, 0x82, 0x73, 0x65, 0x00, 0x4B, 0x8C, 0x56, 0x12, 0x93, 0x56, 0x00, 0x17, 0x00, 0x82, 0x6F,
-    0x73, 0x65, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x73, 0x65, 0x00, 0x0C, 0x16, 0x00, 0x81, 0x63, 0x65,
-    0x00, 0x45, 0xBD, 0x56, 0x0A, 0xD1, 0x56, 0x0B, 0xE5, 0x56, 0x0D, 0x4B, 0x57, 0x0F, 0x5F, 0x57,
-    0x11, 0x67, 0x57, 0x13, 0x7D, 0x57, 0x17, 0x85, 0x57, 0x1C, 0x8E, 0x57, 0x00, 0x4B, 0xC4, 0x56,
-    0x17, 0xCB, 0x56, 0x00, 0x17, 0x00, 0x83, 0x6F, 0x73, 0x65, 0x00, 0x83, 0x68, 0x6F, 0x73, 0x65,
-    0x00, 0x4B, 0xD8, 0x56, 0x17, 0xDF, 0x56, 0x00, 0x17, 0x00, 0x83, 0x6F, 0x73, 0x65, 0x00, 0x83,
-    0x68, 0x6F, 0x73, 0x65, 0x00, 0x45, 0xFB, 0x56, 0x0A, 0x03, 0x57, 0x0D, 0x0A, 0x57, 0x11, 0x12,
-    0x57, 0x15, 0x1A, 0x57, 0x17, 0x23, 0x57, 0x1C, 0x44, 0x57, 0x00, 0x17, 0x00, 0x84, 0x68, 0x6F,
-    0x73, 0x65, 0x00, 0x84, 0x74, 0x68, 0x6F, 0x73, 0x65, 0x00, 0x17, 0x00, 0x84, 0x68, 0x6F, 0x73,
-    0x65, 0x00, 0x17, 0x00, 0x84, 0x68, 0x6F, 0x73, 0x65, 0x00, 0x2C, 0x00, 0x84, 0x74, 0x68, 0x6F,
-    0x73, 0x65, 0x00, 0x4A, 0x2D, 0x57, 0x15, 0x34, 0x57, 0x1C, 0x3D, 0x57, 0x00, 0x85, 0x74, 0x68,
-    0x6F, 0x73, 0x65, 0x00, 0x2C, 0x00, 0x85, 0x74, 0x68, 0x6F, 0x73, 0x65, 0x00, 0x85, 0x74, 0x68,
-    0x6F, 0x73, 0x65, 0x00, 0x84, 0x74, 0x68, 0x6F, 0x73, 0x65, 0x00, 0x4B, 0x52, 0x57, 0x17, 0x59,
-    0x57, 0x00, 0x17, 0x00, 0x83, 0x6F, 0x73, 0x65, 0x00, 0x83, 0x68, 0x6F, 0x73, 0x65, 0x00, 0x0B,
-    0x17, 0x00, 0x83, 0x6F, 0x73, 0x65, 0x00, 0x4B, 0x6E, 0x57, 0x17, 0x75, 0x57, 0x00, 0x17, 0x00,
-    0x83, 0x6F, 0x73, 0x65, 0x00, 0x2C, 0x00, 0x83, 0x68, 0x6F, 0x73, 0x65, 0x00, 0x0B, 0x17, 0x00,
-    0x83, 0x6F, 0x73, 0x65, 0x00, 0x0B, 0x00, 0x84, 0x74, 0x68, 0x6F, 0x73, 0x65, 0x00, 0x4B, 0x95,
-    0x57, 0x17, 0x9C, 0x57, 0x00, 0x17, 0x00, 0x83, 0x6F, 0x73, 0x65, 0x00, 0x83, 0x68, 0x6F, 0x73,
-    0x65, 0x00, 0x4B, 0xA9, 0x57, 0x12, 0xB0, 0x57, 0x00, 0x17, 0x00, 0x82, 0x6F, 0x73, 0x65, 0x00,
-    0x0B, 0x17, 0x00, 0x82, 0x73, 0x65, 0x00, 0x44, 0xC1, 0x57, 0x08, 0xC6, 0x57, 0x0B, 0xCD, 0x57,
-    0x00, 0x08, 0x1C, 0x00, 0x80, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x73, 0x65, 0x00, 0x17, 0x00, 0x82,
-    0x65, 0x73, 0x65, 0x00, 0x44, 0xF0, 0x57, 0x06, 0x2D, 0x59, 0x0C, 0x46, 0x59, 0x0D, 0x50, 0x59,
-    0x14, 0x5A, 0x59, 0x16, 0x73, 0x59, 0x1A, 0x8C, 0x59, 0x1C, 0xA5, 0x59, 0x1D, 0xAF, 0x59, 0x00,
-    0x46, 0x0C, 0x58, 0x07, 0xA0, 0x58, 0x08, 0xB9, 0x58, 0x14, 0xC4, 0x58, 0x16, 0xCE, 0x58, 0x19,
-    0xE7, 0x58, 0x1A, 0x00, 0x59, 0x1B, 0x0A, 0x59, 0x1D, 0x23, 0x59, 0x00, 0x45, 0x25, 0x58, 0x07,
-    0x2F, 0x58, 0x08, 0x47, 0x58, 0x15, 0x52, 0x58, 0x16, 0x6A, 0x58, 0x19, 0x74, 0x58, 0x1A, 0x7E,
-    0x58, 0x1B, 0x96, 0x58, 0x00, 0x2C, 0x00, 0x84, 0x65, 0x63, 0x61, 0x75, 0x73, 0x65, 0x00, 0x45,
-    0x36, 0x58, 0x08, 0x3E, 0x58, 0x00, 0x85, 0x65, 0x63, 0x61, 0x75, 0x73, 0x65, 0x00, 0x05, 0x00,
-    0x85, 0x63, 0x61, 0x75, 0x73, 0x65, 0x00, 0x2C, 0x00, 0x85, 0x62, 0x65, 0x63, 0x61, 0x75, 0x73,
-    0x65, 0x00, 0x45, 0x59, 0x58, 0x08, 0x61, 0x58, 0x00, 0x85, 0x65, 0x63, 0x61, 0x75, 0x73, 0x65,
-    0x00, 0x05, 0x00, 0x85, 0x63, 0x61, 0x75, 0x73, 0x65, 0x00, 0x08, 0x05, 0x00, 0x85, 0x63, 0x61,
-    0x75, 0x73, 0x65, 0x00, 0x08, 0x05, 0x00, 0x85, 0x63, 0x61, 0x75, 0x73, 0x65, 0x00, 0x45, 0x85,
-    0x58, 0x08, 0x8D, 0x58, 0x00, 0x85, 0x65, 0x63, 0x61, 0x75, 0x73, 0x65, 0x00, 0x05, 0x00, 0x85,
-    0x63, 0x61, 0x75, 0x73, 0x65, 0x00, 0x08, 0x05, 0x00, 0x85, 0x63, 0x61, 0x75, 0x73, 0x65, 0x00,
-    0x46, 0xA7, 0x58, 0x08, 0xB0, 0x58, 0x00, 0x08, 0x05, 0x00, 0x84, 0x61, 0x75, 0x73, 0x65, 0x00,
-    0x05, 0x00, 0x84, 0x63, 0x61, 0x75, 0x73, 0x65, 0x00, 0x06, 0x05, 0x00, 0x85, 0x65, 0x63, 0x61,
-    0x75, 0x73, 0x65, 0x00, 0x06, 0x08, 0x05, 0x00, 0x84, 0x61, 0x75, 0x73, 0x65, 0x00, 0x46, 0xD5,
-    0x58, 0x08, 0xDE, 0x58, 0x00, 0x08, 0x05, 0x00, 0x84, 0x61, 0x75, 0x73, 0x65, 0x00, 0x05, 0x00,
-    0x84, 0x63, 0x61, 0x75, 0x73, 0x65, 0x00, 0x46, 0xEE, 0x58, 0x08, 0xF7, 0x58, 0x00, 0x08, 0x05,
-    0x00, 0x84, 0x61, 0x75, 0x73, 0x65, 0x00, 0x05, 0x00, 0x84, 0x63, 0x61, 0x75, 0x73, 0x65, 0x00,
-    0x06, 0x08, 0x05, 0x00, 0x84, 0x61, 0x75, 0x73, 0x65, 0x00, 0x46, 0x11, 0x59, 0x08, 0x1A, 0x59,
-    0x00, 0x08, 0x05, 0x00, 0x84, 0x61, 0x75, 0x73, 0x65, 0x00, 0x05, 0x00, 0x84, 0x63, 0x61, 0x75,
-    0x73, 0x65, 0x00, 0x06, 0x08, 0x05, 0x00, 0x84, 0x61, 0x75, 0x73, 0x65, 0x00, 0x44, 0x34, 0x59,
-    0x08, 0x3E, 0x59, 0x00, 0x08, 0x05, 0x00, 0x84, 0x63, 0x61, 0x75, 0x73, 0x65, 0x00, 0x05, 0x00,
-    0x82, 0x61, 0x75, 0x73, 0x65, 0x00, 0x04, 0x06, 0x08, 0x05, 0x00, 0x83, 0x75, 0x73, 0x65, 0x00,
-    0x04, 0x06, 0x08, 0x05, 0x00, 0x83, 0x75, 0x73, 0x65, 0x00, 0x44, 0x61, 0x59, 0x06, 0x6A, 0x59,
-    0x00, 0x06, 0x08, 0x05, 0x00, 0x83, 0x75, 0x73, 0x65, 0x00, 0x08, 0x05, 0x00, 0x83, 0x61, 0x75,
-    0x73, 0x65, 0x00, 0x44, 0x7A, 0x59, 0x06, 0x83, 0x59, 0x00, 0x06, 0x08, 0x05, 0x00, 0x83, 0x75,
-    0x73, 0x65, 0x00, 0x08, 0x05, 0x00, 0x83, 0x61, 0x75, 0x73, 0x65, 0x00, 0x44, 0x93, 0x59, 0x06,
-    0x9C, 0x59, 0x00, 0x06, 0x08, 0x05, 0x00, 0x83, 0x75, 0x73, 0x65, 0x00, 0x08, 0x05, 0x00, 0x83,
-    0x61, 0x75, 0x73, 0x65, 0x00, 0x04, 0x06, 0x08, 0x05, 0x00, 0x83, 0x75, 0x73, 0x65, 0x00, 0x44,
-    0xB6, 0x59, 0x06, 0xBF, 0x59, 0x00, 0x06, 0x08, 0x05, 0x00, 0x83, 0x75, 0x73, 0x65, 0x00, 0x08,
-    0x05, 0x00, 0x83, 0x61, 0x75, 0x73, 0x65, 0x00, 0x48, 0xD5, 0x59, 0x0B, 0xDC, 0x59, 0x12, 0xE3,
-    0x59, 0x18, 0xEA, 0x59, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x73, 0x65, 0x00, 0x17, 0x00, 0x82, 0x65,
-    0x73, 0x65, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x73, 0x65, 0x00, 0x04, 0x06, 0x08, 0x05, 0x00, 0x82,
-    0x73, 0x65, 0x00, 0x48, 0xFD, 0x59, 0x12, 0x04, 0x5A, 0x18, 0x0B, 0x5A, 0x00, 0x0B, 0x17, 0x00,
-    0x82, 0x73, 0x65, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x73, 0x65, 0x00, 0x04, 0x06, 0x08, 0x05, 0x00,
-    0x82, 0x73, 0x65, 0x00, 0x44, 0x1B, 0x5A, 0x18, 0x24, 0x5A, 0x00, 0x06, 0x08, 0x05, 0x00, 0x82,
-    0x75, 0x73, 0x65, 0x00, 0x04, 0x06, 0x08, 0x05, 0x00, 0x82, 0x73, 0x65, 0x00, 0x74, 0x55, 0x5A,
-    0x04, 0x5D, 0x5A, 0x08, 0x4C, 0x5B, 0x0A, 0x5F, 0x5B, 0x0F, 0x67, 0x5B, 0x12, 0x70, 0x5B, 0x14,
-    0x78, 0x5B, 0x15, 0x8D, 0x5B, 0x16, 0x9E, 0x5B, 0x18, 0xA7, 0x5B, 0x1A, 0xB0, 0x5B, 0x1C, 0xC5,
-    0x5B, 0x1D, 0xCD, 0x5B, 0x00, 0x18, 0x12, 0x1C, 0x00, 0x81, 0x72, 0x65, 0x00, 0x4A, 0x76, 0x5A,
-    0x14, 0x8C, 0x5A, 0x15, 0x94, 0x5A, 0x16, 0x9D, 0x5A, 0x17, 0xA6, 0x5A, 0x1A, 0x1A, 0x5B, 0x1C,
-    0x30, 0x5B, 0x1D, 0x44, 0x5B, 0x00, 0x56, 0x7D, 0x5A, 0x17, 0x85, 0x5A, 0x00, 0x2C, 0x00, 0x83,
-    0x74, 0x61, 0x74, 0x65, 0x00, 0x16, 0x00, 0x83, 0x61, 0x74, 0x65, 0x00, 0x17, 0x16, 0x00, 0x83,
-    0x61, 0x74, 0x65, 0x00, 0x16, 0x2C, 0x00, 0x83, 0x74, 0x61, 0x74, 0x65, 0x00, 0x17, 0x00, 0x84,
-    0x73, 0x74, 0x61, 0x74, 0x65, 0x00, 0x44, 0xBF, 0x5A, 0x07, 0xC8, 0x5A, 0x08, 0xCF, 0x5A, 0x0A,
-    0xD8, 0x5A, 0x15, 0xE0, 0x5A, 0x16, 0xE8, 0x5A, 0x1A, 0x0B, 0x5B, 0x1C, 0x12, 0x5B, 0x00, 0x2C,
-    0x00, 0x84, 0x73, 0x74, 0x61, 0x74, 0x65, 0x00, 0x84, 0x73, 0x74, 0x61, 0x74, 0x65, 0x00, 0x2C,
-    0x00, 0x84, 0x73, 0x74, 0x61, 0x74, 0x65, 0x00, 0x16, 0x00, 0x84, 0x74, 0x61, 0x74, 0x65, 0x00,
-    0x16, 0x00, 0x84, 0x74, 0x61, 0x74, 0x65, 0x00, 0x47, 0xF2, 0x5A, 0x1A, 0xFB, 0x5A, 0x1B, 0x02,
-    0x5B, 0x00, 0x2C, 0x00, 0x85, 0x73, 0x74, 0x61, 0x74, 0x65, 0x00, 0x85, 0x73, 0x74, 0x61, 0x74,
-    0x65, 0x00, 0x2C, 0x00, 0x85, 0x73, 0x74, 0x61, 0x74, 0x65, 0x00, 0x84, 0x73, 0x74, 0x61, 0x74,
-    0x65, 0x00, 0x16, 0x00, 0x84, 0x74, 0x61, 0x74, 0x65, 0x00, 0x50, 0x21, 0x5B, 0x17, 0x29, 0x5B,
-    0x00, 0x15, 0x0C, 0x09, 0x00, 0x81, 0x72, 0x65, 0x00, 0x16, 0x00, 0x83, 0x61, 0x74, 0x65, 0x00,
-    0x56, 0x37, 0x5B, 0x17, 0x3D, 0x5B, 0x00, 0x83, 0x74, 0x61, 0x74, 0x65, 0x00, 0x16, 0x00, 0x83,
-    0x61, 0x74, 0x65, 0x00, 0x17, 0x16, 0x00, 0x83, 0x61, 0x74, 0x65, 0x00, 0x0B, 0x00, 0x57, 0x55,
-    0x5B, 0x1A, 0x5B, 0x5B, 0x00, 0x2C, 0x00, 0x81, 0x72, 0x65, 0x00, 0x81, 0x72, 0x65, 0x00, 0x04,
-    0x17, 0x16, 0x00, 0x82, 0x74, 0x65, 0x00, 0x17, 0x0C, 0x0F, 0x00, 0x82, 0x74, 0x6C, 0x65, 0x00,
-    0x09, 0x08, 0x05, 0x00, 0x81, 0x72, 0x65, 0x00, 0x44, 0x7F, 0x5B, 0x17, 0x86, 0x5B, 0x00, 0x17,
-    0x16, 0x00, 0x82, 0x74, 0x65, 0x00, 0x16, 0x00, 0x82, 0x61, 0x74, 0x65, 0x00, 0x08, 0x00, 0x4B,
-    0x96, 0x5B, 0x1A, 0x9B, 0x5B, 0x00, 0x1A, 0x00, 0x81, 0x65, 0x00, 0x81, 0x65, 0x00, 0x04, 0x17,
-    0x16, 0x2C, 0x00, 0x82, 0x74, 0x65, 0x00, 0x16, 0x04, 0x08, 0x10, 0x00, 0x81, 0x72, 0x65, 0x00,
-    0x44, 0xB7, 0x5B, 0x17, 0xBE, 0x5B, 0x00, 0x17, 0x16, 0x00, 0x82, 0x74, 0x65, 0x00, 0x16, 0x00,
-    0x82, 0x61, 0x74, 0x65, 0x00, 0x04, 0x17, 0x16, 0x00, 0x82, 0x74, 0x65, 0x00, 0x44, 0xD4, 0x5B,
-    0x17, 0xDB, 0x5B, 0x00, 0x17, 0x16, 0x00, 0x82, 0x74, 0x65, 0x00, 0x16, 0x00, 0x82, 0x61, 0x74,
-    0x65, 0x00, 0x44, 0xEC, 0x5B, 0x15, 0xF4, 0x5B, 0x16, 0xFE, 0x5B, 0x00, 0x06, 0x08, 0x05, 0x00,
-    0x80, 0x73, 0x65, 0x00, 0x16, 0x04, 0x08, 0x10, 0x00, 0x82, 0x75, 0x72, 0x65, 0x00, 0x04, 0x00,
-    0x46, 0x07, 0x5C, 0x08, 0x0F, 0x5C, 0x00, 0x08, 0x05, 0x00, 0x82, 0x75, 0x73, 0x65, 0x00, 0x10,
-    0x00, 0x80, 0x72, 0x65, 0x00, 0x44, 0x3D, 0x5C, 0x05, 0xCC, 0x5C, 0x06, 0xDF, 0x5C, 0x09, 0xFB,
-    0x5C, 0x0A, 0x16, 0x5D, 0x0C, 0x29, 0x5D, 0x0F, 0x30, 0x5D, 0x12, 0x37, 0x5D, 0x13, 0x58, 0x5D,
-    0x14, 0x5F, 0x5D, 0x16, 0x66, 0x5D, 0x1A, 0x6D, 0x5D, 0x1D, 0x74, 0x5D, 0x00, 0x45, 0x5C, 0x5C,
-    0x0A, 0x63, 0x5C, 0x0B, 0x6A, 0x5C, 0x0D, 0x9A, 0x5C, 0x11, 0xA1, 0x5C, 0x14, 0xA8, 0x5C, 0x16,
-    0xAF, 0x5C, 0x1A, 0xB7, 0x5C, 0x1C, 0xBE, 0x5C, 0x1D, 0xC5, 0x5C, 0x00, 0x0B, 0x00, 0x83, 0x61,
-    0x76, 0x65, 0x00, 0x0B, 0x00, 0x83, 0x61, 0x76, 0x65, 0x00, 0x45, 0x7A, 0x5C, 0x0A, 0x80, 0x5C,
-    0x0D, 0x86, 0x5C, 0x11, 0x8C, 0x5C, 0x1C, 0x94, 0x5C, 0x00, 0x84, 0x68, 0x61, 0x76, 0x65, 0x00,
-    0x84, 0x68, 0x61, 0x76, 0x65, 0x00, 0x84, 0x68, 0x61, 0x76, 0x65, 0x00, 0x2C, 0x00, 0x84, 0x68,
-    0x61, 0x76, 0x65, 0x00, 0x84, 0x68, 0x61, 0x76, 0x65, 0x00, 0x0B, 0x00, 0x83, 0x61, 0x76, 0x65,
-    0x00, 0x0B, 0x00, 0x83, 0x61, 0x76, 0x65, 0x00, 0x0B, 0x00, 0x83, 0x61, 0x76, 0x65, 0x00, 0x0B,
-    0x2C, 0x00, 0x83, 0x61, 0x76, 0x65, 0x00, 0x0B, 0x00, 0x83, 0x61, 0x76, 0x65, 0x00, 0x0B, 0x00,
-    0x83, 0x61, 0x76, 0x65, 0x00, 0x0B, 0x00, 0x83, 0x61, 0x76, 0x65, 0x00, 0x44, 0xD3, 0x5C, 0x12,
-    0xD9, 0x5C, 0x00, 0x0B, 0x00, 0x82, 0x76, 0x65, 0x00, 0x0F, 0x00, 0x82, 0x76, 0x65, 0x00, 0x44,
-    0xE9, 0x5C, 0x11, 0xEF, 0x5C, 0x12, 0xF5, 0x5C, 0x00, 0x0B, 0x00, 0x82, 0x76, 0x65, 0x00, 0x0C,
-    0x16, 0x00, 0x81, 0x65, 0x00, 0x0F, 0x00, 0x82, 0x76, 0x65, 0x00, 0x44, 0x05, 0x5D, 0x0C, 0x0B,
-    0x5D, 0x12, 0x10, 0x5D, 0x00, 0x0B, 0x00, 0x82, 0x76, 0x65, 0x00, 0x0F, 0x00, 0x81, 0x65, 0x00,
-    0x0F, 0x00, 0x82, 0x76, 0x65, 0x00, 0x44, 0x1D, 0x5D, 0x12, 0x23, 0x5D, 0x00, 0x0B, 0x00, 0x82,
-    0x76, 0x65, 0x00, 0x0F, 0x00, 0x82, 0x76, 0x65, 0x00, 0x12, 0x0F, 0x00, 0x82, 0x76, 0x65, 0x00,
-    0x12, 0x0F, 0x00, 0x82, 0x76, 0x65, 0x00, 0x4C, 0x41, 0x5D, 0x0F, 0x48, 0x5D, 0x13, 0x51, 0x5D,
-    0x00, 0x0F, 0x00, 0x83, 0x6F, 0x76, 0x65, 0x00, 0x12, 0x2C, 0x00, 0x84, 0x6C, 0x6F, 0x76, 0x65,
-    0x00, 0x0F, 0x00, 0x83, 0x6F, 0x76, 0x65, 0x00, 0x12, 0x0F, 0x00, 0x82, 0x76, 0x65, 0x00, 0x04,
-    0x0B, 0x00, 0x82, 0x76, 0x65, 0x00, 0x04, 0x0B, 0x00, 0x82, 0x76, 0x65, 0x00, 0x04, 0x0B, 0x00,
-    0x82, 0x76, 0x65, 0x00, 0x04, 0x0B, 0x00, 0x82, 0x76, 0x65, 0x00, 0x48, 0x91, 0x5D, 0x09, 0x98,
-    0x5D, 0x0E, 0x9E, 0x5D, 0x10, 0xB7, 0x5D, 0x15, 0xDE, 0x5D, 0x18, 0xF0, 0x5D, 0x19, 0xF9, 0x5D,
-    0x00, 0x15, 0x0B, 0x17, 0x00, 0x81, 0x65, 0x00, 0x0C, 0x0F, 0x00, 0x81, 0x65, 0x00, 0x44, 0xA5,
-    0x5D, 0x0C, 0xB2, 0x5D, 0x00, 0x50, 0xAC, 0x5D, 0x17, 0xAF, 0x5D, 0x00, 0x81, 0x65, 0x00, 0x81,
-    0x65, 0x00, 0x0F, 0x00, 0x81, 0x65, 0x00, 0x44, 0xC1, 0x5D, 0x0C, 0xC6, 0x5D, 0x12, 0xCB, 0x5D,
-    0x00, 0x0A, 0x00, 0x81, 0x65, 0x00, 0x17, 0x00, 0x81, 0x65, 0x00, 0x46, 0xD5, 0x5D, 0x0B, 0xD8,
-    0x5D, 0x16, 0xDB, 0x5D, 0x00, 0x81, 0x65, 0x00, 0x81, 0x65, 0x00, 0x81, 0x65, 0x00, 0x48, 0xE5,
-    0x5D, 0x0B, 0xEA, 0x5D, 0x00, 0x1A, 0x00, 0x81, 0x65, 0x00, 0x17, 0x00, 0x81, 0x65, 0x65, 0x00,
-    0x04, 0x06, 0x08, 0x05, 0x00, 0x81, 0x73, 0x65, 0x00, 0x44, 0x00, 0x5E, 0x12, 0x05, 0x5E, 0x00,
-    0x0B, 0x00, 0x81, 0x65, 0x00, 0x0F, 0x00, 0x81, 0x65, 0x00, 0x46, 0x1D, 0x5E, 0x07, 0x24, 0x5E,
-    0x08, 0x2A, 0x5E, 0x11, 0x31, 0x5E, 0x16, 0x38, 0x5E, 0x18, 0x4B, 0x5E, 0x00, 0x11, 0x0C, 0x16,
-    0x00, 0x81, 0x65, 0x00, 0x04, 0x10, 0x00, 0x81, 0x65, 0x00, 0x0B, 0x17, 0x00, 0x81, 0x73, 0x65,
-    0x00, 0x0C, 0x16, 0x00, 0x81, 0x63, 0x65, 0x00, 0x48, 0x3F, 0x5E, 0x12, 0x45, 0x5E, 0x00, 0x0B,
-    0x17, 0x00, 0x81, 0x65, 0x00, 0x0B, 0x17, 0x00, 0x81, 0x65, 0x00, 0x04, 0x06, 0x08, 0x05, 0x00,
-    0x81, 0x73, 0x65, 0x00, 0x44, 0x5B, 0x5E, 0x17, 0x62, 0x5E, 0x00, 0x1A, 0x0F, 0x04, 0x00, 0x80,
-    0x73, 0x00, 0x04, 0x17, 0x16, 0x00, 0x81, 0x65, 0x00, 0x47, 0x7C, 0x5E, 0x08, 0x9E, 0x5E, 0x0A,
-    0xBA, 0x5E, 0x0F, 0xCC, 0x5E, 0x11, 0xDF, 0x5E, 0x15, 0xFD, 0x5E, 0x00, 0x48, 0x86, 0x5E, 0x0C,
-    0x8B, 0x5E, 0x0F, 0x90, 0x5E, 0x00, 0x16, 0x18, 0x00, 0x80, 0x00, 0x04, 0x16, 0x00, 0x80, 0x00,
-    0x18, 0x12, 0x00, 0x46, 0x9A, 0x5E, 0x1A, 0x9C, 0x5E, 0x00, 0x80, 0x00, 0x80, 0x00, 0x4B, 0xA8,
-    0x5E, 0x17, 0xAE, 0x5E, 0x19, 0xB4, 0x5E, 0x00, 0x17, 0x12, 0x00, 0x80, 0x72, 0x00, 0x09, 0x04,
-    0x00, 0x80, 0x72, 0x00, 0x08, 0x11, 0x00, 0x80, 0x72, 0x00, 0x11, 0x0C, 0x00, 0x48, 0xC4, 0x5E,
-    0x12, 0xC8, 0x5E, 0x00, 0x05, 0x00, 0x80, 0x00, 0x0A, 0x00, 0x80, 0x00, 0x55, 0xD3, 0x5E, 0x18,
-    0xD9, 0x5E, 0x00, 0x12, 0x1A, 0x00, 0x80, 0x64, 0x00, 0x12, 0x06, 0x00, 0x80, 0x64, 0x00, 0x4C,
-    0xE6, 0x5E, 0x18, 0xF7, 0x5E, 0x00, 0x48, 0xED, 0x5E, 0x12, 0xF2, 0x5E, 0x00, 0x05, 0x00, 0x80,
-    0x67, 0x00, 0x0A, 0x00, 0x80, 0x67, 0x00, 0x12, 0x16, 0x00, 0x80, 0x64, 0x00, 0x48, 0x07, 0x5F,
-    0x0C, 0x0D, 0x5F, 0x18, 0x13, 0x5F, 0x00, 0x19, 0x08, 0x11, 0x00, 0x80, 0x00, 0x08, 0x0B, 0x17,
-    0x00, 0x80, 0x00, 0x12, 0x1C, 0x00, 0x80, 0x00, 0x74, 0x40, 0x5F, 0x04, 0x53, 0x5F, 0x05, 0x5A,
-    0x5F, 0x06, 0x91, 0x5F, 0x09, 0xAD, 0x5F, 0x0B, 0xB4, 0x5F, 0x0C, 0x28, 0x60, 0x0D, 0x73, 0x60,
-    0x10, 0xC1, 0x60, 0x11, 0x0F, 0x61, 0x16, 0x17, 0x6A, 0x17, 0x1E, 0x6A, 0x19, 0xB0, 0x6A, 0x00,
-    0x11, 0x00, 0x44, 0x49, 0x5F, 0x12, 0x4E, 0x5F, 0x00, 0x06, 0x00, 0x80, 0x74, 0x00, 0x07, 0x00,
-    0x80, 0x74, 0x00, 0x08, 0x15, 0x0A, 0x00, 0x80, 0x74, 0x00, 0x4C, 0x61, 0x5F, 0x11, 0x8B, 0x5F,
-    0x00, 0x48, 0x6E, 0x5F, 0x0B, 0x74, 0x5F, 0x12, 0x7E, 0x5F, 0x15, 0x84, 0x5F, 0x00, 0x05, 0x00,
-    0x81, 0x6E, 0x67, 0x00, 0x17, 0x08, 0x10, 0x12, 0x16, 0x00, 0x81, 0x6E, 0x67, 0x00, 0x0A, 0x00,
-    0x81, 0x6E, 0x67, 0x00, 0x18, 0x07, 0x00, 0x81, 0x6E, 0x67, 0x00, 0x12, 0x0F, 0x00, 0x81, 0x67,
-    0x00, 0x44, 0x9B, 0x5F, 0x0C, 0xA1, 0x5F, 0x17, 0xA7, 0x5F, 0x00, 0x1B, 0x08, 0x00, 0x80, 0x74,
-    0x00, 0x0B, 0x1A, 0x00, 0x80, 0x68, 0x00, 0x0C, 0x05, 0x00, 0x80, 0x68, 0x00, 0x11, 0x12, 0x0F,
-    0x00, 0x81, 0x67, 0x00, 0x46, 0xC4, 0x5F, 0x0A, 0xE3, 0x5F, 0x0C, 0xE9, 0x5F, 0x11, 0x13, 0x60,
-    0x17, 0x19, 0x60, 0x00, 0x4C, 0xCE, 0x5F, 0x17, 0xD3, 0x5F, 0x18, 0xD8, 0x5F, 0x00, 0x0B, 0x1A,
-    0x00, 0x80, 0x00, 0x0C, 0x05, 0x00, 0x80, 0x00, 0x50, 0xDF, 0x5F, 0x16, 0xE1, 0x5F, 0x00, 0x80,
-    0x00, 0x80, 0x00, 0x0C, 0x15, 0x00, 0x80, 0x74, 0x00, 0x48, 0xF6, 0x5F, 0x0B, 0xFC, 0x5F, 0x12,
-    0x06, 0x60, 0x15, 0x0C, 0x60, 0x00, 0x05, 0x00, 0x81, 0x6E, 0x67, 0x00, 0x17, 0x08, 0x10, 0x12,
-    0x16, 0x00, 0x81, 0x6E, 0x67, 0x00, 0x0A, 0x00, 0x81, 0x6E, 0x67, 0x00, 0x18, 0x07, 0x00, 0x81,
-    0x6E, 0x67, 0x00, 0x12, 0x0F, 0x00, 0x81, 0x67, 0x00, 0x4C, 0x20, 0x60, 0x12, 0x24, 0x60, 0x00,
-    0x1A, 0x00, 0x80, 0x00, 0x05, 0x00, 0x80, 0x00, 0x4B, 0x32, 0x60, 0x11, 0x3C, 0x60, 0x15, 0x6C,
-    0x60, 0x00, 0x17, 0x08, 0x10, 0x12, 0x16, 0x00, 0x80, 0x6E, 0x67, 0x00, 0x4B, 0x49, 0x60, 0x0E,
-    0x54, 0x60, 0x12, 0x5D, 0x60, 0x15, 0x64, 0x60, 0x00, 0x17, 0x08, 0x10, 0x12, 0x16, 0x00, 0x82,
-    0x69, 0x6E, 0x67, 0x00, 0x06, 0x18, 0x09, 0x00, 0x82, 0x69, 0x6E, 0x67, 0x00, 0x0A, 0x00, 0x82,
-    0x69, 0x6E, 0x67, 0x00, 0x18, 0x07, 0x00, 0x82, 0x69, 0x6E, 0x67, 0x00, 0x18, 0x07, 0x00, 0x80,
-    0x6E, 0x67, 0x00, 0x4C, 0x7A, 0x60, 0x11, 0xA4, 0x60, 0x00, 0x48, 0x87, 0x60, 0x0B, 0x8D, 0x60,
-    0x12, 0x97, 0x60, 0x15, 0x9D, 0x60, 0x00, 0x05, 0x00, 0x81, 0x6E, 0x67, 0x00, 0x17, 0x08, 0x10,
-    0x12, 0x16, 0x00, 0x81, 0x6E, 0x67, 0x00, 0x0A, 0x00, 0x81, 0x6E, 0x67, 0x00, 0x18, 0x07, 0x00,
-    0x81, 0x6E, 0x67, 0x00, 0x4C, 0xAB, 0x60, 0x12, 0xBC, 0x60, 0x00, 0x48, 0xB2, 0x60, 0x12, 0xB7,
-    0x60, 0x00, 0x05, 0x00, 0x81, 0x67, 0x00, 0x0A, 0x00, 0x81, 0x67, 0x00, 0x0F, 0x00, 0x81, 0x67,
-    0x00, 0x4C, 0xC8, 0x60, 0x11, 0xF2, 0x60, 0x00, 0x48, 0xD5, 0x60, 0x0B, 0xDB, 0x60, 0x12, 0xE5,
-    0x60, 0x15, 0xEB, 0x60, 0x00, 0x05, 0x00, 0x81, 0x6E, 0x67, 0x00, 0x17, 0x08, 0x10, 0x12, 0x16,
-    0x00, 0x81, 0x6E, 0x67, 0x00, 0x0A, 0x00, 0x81, 0x6E, 0x67, 0x00, 0x18, 0x07, 0x00, 0x81, 0x6E,
-    0x67, 0x00, 0x4C, 0xF9, 0x60, 0x12, 0x0A, 0x61, 0x00, 0x48, 0x00, 0x61, 0x12, 0x05, 0x61, 0x00,
-    0x05, 0x00, 0x81, 0x67, 0x00, 0x0A, 0x00, 0x81, 0x67, 0x00, 0x0F, 0x00, 0x81, 0x67, 0x00, 0x45,
-    0x34, 0x61, 0x08, 0x6B, 0x61, 0x0B, 0x74, 0x61, 0x0C, 0xC6, 0x61, 0x0D, 0x06, 0x68, 0x0E, 0x3D,
-    0x68, 0x0F, 0xA2, 0x68, 0x10, 0xA9, 0x68, 0x12, 0xE0, 0x68, 0x13, 0x92, 0x69, 0x15, 0x99, 0x69,
-    0x18, 0xB0, 0x69, 0x00, 0x4C, 0x3B, 0x61, 0x12, 0x65, 0x61, 0x00, 0x48, 0x48, 0x61, 0x0B, 0x4E,
-    0x61, 0x12, 0x58, 0x61, 0x15, 0x5E, 0x61, 0x00, 0x05, 0x00, 0x82, 0x6E, 0x67, 0x00, 0x17, 0x08,
-    0x10, 0x12, 0x16, 0x00, 0x82, 0x6E, 0x67, 0x00, 0x0A, 0x00, 0x82, 0x6E, 0x67, 0x00, 0x18, 0x07,
-    0x00, 0x82, 0x6E, 0x67, 0x00, 0x0F, 0x00, 0x82, 0x6E, 0x67, 0x00, 0x0C, 0x05, 0x00, 0x83, 0x65,
-    0x69, 0x6E, 0x67, 0x00, 0x4C, 0x7E, 0x61, 0x12, 0xB6, 0x61, 0x17, 0xBC, 0x61, 0x00, 0x48, 0x8E,
-    0x61, 0x0B, 0x94, 0x61, 0x12, 0x9E, 0x61, 0x15, 0xA4, 0x61, 0x17, 0xAB, 0x61, 0x00, 0x05, 0x00,
-    0x82, 0x6E, 0x67, 0x00, 0x17, 0x08, 0x10, 0x12, 0x16, 0x00, 0x82, 0x6E, 0x67, 0x00, 0x0A, 0x00,
-    0x82, 0x6E, 0x67, 0x00, 0x18, 0x07, 0x00, 0x82, 0x6E, 0x67, 0x00, 0x08, 0x10, 0x12, 0x16, 0x00,
-    0x83, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x0F, 0x00, 0x82, 0x6E, 0x67, 0x00, 0x08, 0x10, 0x12, 0x16,
-    0x00, 0x81, 0x69, 0x6E, 0x67, 0x00, 0x45, 0x00, 0x62, 0x06, 0x27, 0x62, 0x07, 0x40, 0x62, 0x08,
-    0x48, 0x62, 0x09, 0xD9, 0x62, 0x0A, 0xF0, 0x62, 0x0B, 0x0D, 0x63, 0x0C, 0xC8, 0x64, 0x0D, 0xE7,
-    0x64, 0x0E, 0x10, 0x65, 0x0F, 0xD3, 0x65, 0x11, 0xF5, 0x65, 0x12, 0x12, 0x66, 0x13, 0xCB, 0x66,
-    0x15, 0xDF, 0x66, 0x17, 0x5C, 0x67, 0x18, 0x8F, 0x67, 0x1A, 0xE1, 0x67, 0x1C, 0xE9, 0x67, 0x00,
-    0x48, 0x0A, 0x62, 0x0B, 0x11, 0x62, 0x17, 0x1C, 0x62, 0x00, 0x84, 0x62, 0x65, 0x69, 0x6E, 0x67,
-    0x00, 0x17, 0x08, 0x10, 0x12, 0x16, 0x00, 0x83, 0x69, 0x6E, 0x67, 0x00, 0x08, 0x10, 0x12, 0x16,
-    0x00, 0x83, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x4E, 0x2E, 0x62, 0x18, 0x38, 0x62, 0x00, 0x18, 0x09,
-    0x00, 0x84, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x00, 0x09, 0x00, 0x82, 0x6B, 0x69, 0x6E, 0x67, 0x00,
-    0x08, 0x05, 0x00, 0x83, 0x69, 0x6E, 0x67, 0x00, 0x45, 0x64, 0x62, 0x07, 0x8F, 0x62, 0x0A, 0x97,
-    0x62, 0x0B, 0xA0, 0x62, 0x11, 0xA7, 0x62, 0x15, 0xAE, 0x62, 0x18, 0xC2, 0x62, 0x19, 0xCA, 0x62,
-    0x1A, 0xD1, 0x62, 0x00, 0x4A, 0x71, 0x62, 0x0B, 0x78, 0x62, 0x11, 0x7F, 0x62, 0x19, 0x88, 0x62,
-    0x00, 0x85, 0x62, 0x65, 0x69, 0x6E, 0x67, 0x00, 0x85, 0x62, 0x65, 0x69, 0x6E, 0x67, 0x00, 0x2C,
-    0x00, 0x85, 0x62, 0x65, 0x69, 0x6E, 0x67, 0x00, 0x85, 0x62, 0x65, 0x69, 0x6E, 0x67, 0x00, 0x05,
-    0x00, 0x84, 0x65, 0x69, 0x6E, 0x67, 0x00, 0x2C, 0x00, 0x84, 0x62, 0x65, 0x69, 0x6E, 0x67, 0x00,
-    0x84, 0x62, 0x65, 0x69, 0x6E, 0x67, 0x00, 0x84, 0x62, 0x65, 0x69, 0x6E, 0x67, 0x00, 0x45, 0xB5,
-    0x62, 0x18, 0xBB, 0x62, 0x00, 0x84, 0x65, 0x69, 0x6E, 0x67, 0x00, 0x07, 0x00, 0x83, 0x69, 0x6E,
-    0x67, 0x00, 0x07, 0x00, 0x83, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x84, 0x62, 0x65, 0x69, 0x6E, 0x67,
-    0x00, 0x05, 0x00, 0x84, 0x65, 0x69, 0x6E, 0x67, 0x00, 0x55, 0xE0, 0x62, 0x18, 0xE8, 0x62, 0x00,
-    0x18, 0x07, 0x00, 0x83, 0x69, 0x6E, 0x67, 0x00, 0x07, 0x00, 0x83, 0x72, 0x69, 0x6E, 0x67, 0x00,
-    0x4B, 0xF7, 0x62, 0x17, 0x02, 0x63, 0x00, 0x17, 0x08, 0x10, 0x12, 0x16, 0x00, 0x83, 0x69, 0x6E,
-    0x67, 0x00, 0x08, 0x10, 0x12, 0x16, 0x00, 0x83, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x45, 0x26, 0x63,
-    0x08, 0x32, 0x63, 0x0A, 0x4F, 0x63, 0x0D, 0x6C, 0x63, 0x11, 0x78, 0x63, 0x15, 0x84, 0x63, 0x17,
-    0x90, 0x63, 0x1C, 0xAB, 0x64, 0x00, 0x17, 0x08, 0x10, 0x12, 0x16, 0x00, 0x84, 0x68, 0x69, 0x6E,
-    0x67, 0x00, 0x50, 0x39, 0x63, 0x17, 0x43, 0x63, 0x00, 0x12, 0x16, 0x00, 0x83, 0x74, 0x68, 0x69,
-    0x6E, 0x67, 0x00, 0x10, 0x12, 0x16, 0x00, 0x85, 0x65, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x48,
-    0x56, 0x63, 0x17, 0x61, 0x63, 0x00, 0x10, 0x12, 0x16, 0x00, 0x84, 0x74, 0x68, 0x69, 0x6E, 0x67,
-    0x00, 0x08, 0x10, 0x12, 0x16, 0x00, 0x84, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x17, 0x08, 0x10, 0x12,
-    0x16, 0x00, 0x84, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x17, 0x08, 0x10, 0x12, 0x16, 0x00, 0x84, 0x68,
-    0x69, 0x6E, 0x67, 0x00, 0x17, 0x08, 0x10, 0x12, 0x16, 0x00, 0x84, 0x68, 0x69, 0x6E, 0x67, 0x00,
-    0x47, 0xA6, 0x63, 0x08, 0xB2, 0x63, 0x0A, 0x5E, 0x64, 0x10, 0x6A, 0x64, 0x15, 0x87, 0x64, 0x1A,
-    0x93, 0x64, 0x1C, 0x9F, 0x64, 0x00, 0x10, 0x12, 0x16, 0x00, 0x85, 0x65, 0x74, 0x68, 0x69, 0x6E,
-    0x67, 0x00, 0x4D, 0xC2, 0x63, 0x0E, 0xCE, 0x63, 0x10, 0xDA, 0x63, 0x11, 0x25, 0x64, 0x12, 0x42,
-    0x64, 0x00, 0x12, 0x16, 0x00, 0x86, 0x6D, 0x65, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x12, 0x16,
-    0x00, 0x86, 0x6D, 0x65, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x4C, 0xEA, 0x63, 0x0F, 0xF6, 0x63,
-    0x12, 0x02, 0x64, 0x13, 0x0F, 0x64, 0x16, 0x1B, 0x64, 0x00, 0x16, 0x00, 0x87, 0x6F, 0x6D, 0x65,
-    0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x16, 0x00, 0x87, 0x6F, 0x6D, 0x65, 0x74, 0x68, 0x69, 0x6E,
-    0x67, 0x00, 0x2C, 0x00, 0x87, 0x73, 0x6F, 0x6D, 0x65, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x16,
-    0x00, 0x87, 0x6F, 0x6D, 0x65, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x86, 0x6F, 0x6D, 0x65, 0x74,
-    0x68, 0x69, 0x6E, 0x67, 0x00, 0x50, 0x2C, 0x64, 0x12, 0x37, 0x64, 0x00, 0x12, 0x16, 0x00, 0x86,
-    0x65, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x16, 0x00, 0x86, 0x6D, 0x65, 0x74, 0x68, 0x69, 0x6E,
-    0x67, 0x00, 0x50, 0x49, 0x64, 0x16, 0x55, 0x64, 0x00, 0x16, 0x00, 0x87, 0x6F, 0x6D, 0x65, 0x74,
-    0x68, 0x69, 0x6E, 0x67, 0x00, 0x85, 0x6D, 0x65, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x08, 0x10,
-    0x12, 0x16, 0x00, 0x85, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x48, 0x71, 0x64, 0x12, 0x7D, 0x64,
-    0x00, 0x12, 0x16, 0x00, 0x86, 0x6D, 0x65, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x16, 0x00, 0x84,
-    0x65, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x10, 0x12, 0x16, 0x00, 0x85, 0x65, 0x74, 0x68, 0x69,
-    0x6E, 0x67, 0x00, 0x10, 0x12, 0x16, 0x00, 0x85, 0x65, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x08,
-    0x10, 0x12, 0x16, 0x00, 0x85, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x48, 0xB2, 0x64, 0x17, 0xBD,
-    0x64, 0x00, 0x10, 0x12, 0x16, 0x00, 0x84, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x08, 0x10, 0x12,
-    0x16, 0x00, 0x84, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x46, 0xD2, 0x64, 0x0A, 0xDB, 0x64, 0x12, 0xE1,
-    0x64, 0x00, 0x18, 0x09, 0x00, 0x83, 0x6B, 0x69, 0x6E, 0x67, 0x00, 0x83, 0x6F, 0x69, 0x6E, 0x67,
-    0x00, 0x0A, 0x00, 0x82, 0x6E, 0x67, 0x00, 0x46, 0xF1, 0x64, 0x0B, 0xFA, 0x64, 0x17, 0x05, 0x65,
-    0x00, 0x18, 0x09, 0x00, 0x83, 0x6B, 0x69, 0x6E, 0x67, 0x00, 0x17, 0x08, 0x10, 0x12, 0x16, 0x00,
-    0x83, 0x69, 0x6E, 0x67, 0x00, 0x08, 0x10, 0x12, 0x16, 0x00, 0x83, 0x68, 0x69, 0x6E, 0x67, 0x00,
-    0x46, 0x2F, 0x65, 0x07, 0x70, 0x65, 0x0B, 0x7A, 0x65, 0x0E, 0x85, 0x65, 0x12, 0x8E, 0x65, 0x15,
-    0x95, 0x65, 0x16, 0x9D, 0x65, 0x18, 0xA7, 0x65, 0x19, 0xBF, 0x65, 0x1B, 0xC9, 0x65, 0x00, 0x49,
-    0x3F, 0x65, 0x0C, 0x47, 0x65, 0x0D, 0x51, 0x65, 0x18, 0x5B, 0x65, 0x1C, 0x66, 0x65, 0x00, 0x84,
-    0x75, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x00, 0x09, 0x00, 0x85, 0x75, 0x63, 0x6B, 0x69, 0x6E, 0x67,
-    0x00, 0x09, 0x00, 0x85, 0x75, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x00, 0x2C, 0x00, 0x85, 0x66, 0x75,
+    0x6E, 0x65, 0x00, 0x04, 0x05, 0x00, 0x86, 0x73, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x44, 0x75,
+    0x2C, 0x05, 0x08, 0x2C, 0x00, 0x45, 0x66, 0x2C, 0x00, 0x08, 0x16, 0x04, 0x00, 0x45, 0xBA, 0x2B,
+    0x00, 0x44, 0x88, 0x2C, 0x08, 0x91, 0x2C, 0x00, 0x05, 0x00, 0x83, 0x65, 0x6C, 0x69, 0x6E, 0x65,
+    0x00, 0x04, 0x00, 0x45, 0xE8, 0x2B, 0x00, 0x0F, 0x08, 0x16, 0x04, 0x00, 0x45, 0x94, 0x2B, 0x00,
+    0x4C, 0xA7, 0x2C, 0x0F, 0xB0, 0x2C, 0x00, 0x0F, 0x08, 0x16, 0x04, 0x00, 0x45, 0x49, 0x2B, 0x00,
+    0x08, 0x16, 0x04, 0x00, 0x45, 0x05, 0x25, 0x00, 0x48, 0xBF, 0x2C, 0x0C, 0xC8, 0x2C, 0x00, 0x16,
+    0x04, 0x05, 0x00, 0x81, 0x69, 0x6E, 0x65, 0x00, 0x08, 0x16, 0x04, 0x00, 0x45, 0x89, 0x2B, 0x00,
+    0x44, 0x1E, 0x25, 0x0C, 0xA7, 0x2C, 0x12, 0x9E, 0x21, 0x00, 0x49, 0xF6, 0x2C, 0x0B, 0xFC, 0x2C,
+    0x0C, 0x04, 0x2D, 0x0F, 0x0A, 0x2D, 0x12, 0x17, 0x2D, 0x13, 0x1F, 0x26, 0x15, 0x1F, 0x2D, 0x16,
+    0x26, 0x2D, 0x17, 0x2A, 0x26, 0x00, 0x08, 0x00, 0x45, 0x35, 0x21, 0x00, 0x16, 0x16, 0x04, 0x00,
+    0x80, 0x6C, 0x65, 0x00, 0x0B, 0x00, 0x5A, 0xC1, 0x06, 0x00, 0x4B, 0x7E, 0x28, 0x0C, 0x11, 0x2D,
+    0x00, 0x0B, 0x1A, 0x00, 0x81, 0x65, 0x00, 0x0B, 0x16, 0x16, 0x00, 0x44, 0xC1, 0x06, 0x00, 0x09,
+    0x08, 0x00, 0x45, 0x0A, 0x06, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x6F, 0x73, 0x65, 0x00, 0x4F, 0x35,
+    0x2D, 0x12, 0x3C, 0x2D, 0x00, 0x12, 0x08, 0x00, 0x53, 0x2F, 0x28, 0x00, 0x08, 0x00, 0x53, 0x00,
+    0x2D, 0x00, 0x74, 0x85, 0x2D, 0x04, 0xEE, 0x2D, 0x07, 0x1C, 0x2F, 0x08, 0x31, 0x2F, 0x09, 0xE6,
+    0x2F, 0x0B, 0x29, 0x30, 0x0C, 0x32, 0x30, 0x0D, 0x4F, 0x30, 0x0E, 0xEA, 0x22, 0x0F, 0x56, 0x30,
+    0x10, 0x14, 0x25, 0x12, 0x64, 0x30, 0x13, 0x07, 0x31, 0x14, 0x0E, 0x31, 0x15, 0x1D, 0x31, 0x16,
+    0x23, 0x31, 0x17, 0x45, 0x31, 0x18, 0x5E, 0x31, 0x19, 0x5F, 0x32, 0x1A, 0x6D, 0x32, 0x1C, 0x4F,
+    0x30, 0x1D, 0x0E, 0x31, 0x00, 0x4C, 0x95, 0x2D, 0x0D, 0x95, 0x2D, 0x12, 0xAC, 0x2D, 0x18, 0xC2,
+    0x2D, 0x1C, 0x95, 0x2D, 0x00, 0x52, 0x9C, 0x2D, 0x18, 0xA4, 0x2D, 0x00, 0x1C, 0x00, 0x83, 0x75,
+    0x27, 0x72, 0x65, 0x00, 0x12, 0x1C, 0x00, 0x83, 0x27, 0x72, 0x65, 0x00, 0x58, 0xB3, 0x2D, 0x1C,
+    0xBC, 0x2D, 0x00, 0x1C, 0x00, 0x84, 0x6F, 0x75, 0x27, 0x72, 0x65, 0x00, 0x82, 0x75, 0x27, 0x72,
+    0x65, 0x00, 0x4C, 0xD2, 0x2D, 0x0D, 0xE1, 0x2D, 0x0F, 0xD2, 0x2D, 0x13, 0xD2, 0x2D, 0x1C, 0xE7,
+    0x2D, 0x00, 0x52, 0xD9, 0x2D, 0x1C, 0xB5, 0x2D, 0x00, 0x1C, 0x00, 0x84, 0x75, 0x27, 0x72, 0x65,
+    0x00, 0x12, 0x00, 0x5C, 0xDB, 0x2D, 0x00, 0x83, 0x6F, 0x75, 0x27, 0x72, 0x65, 0x00, 0x44, 0x04,
+    0x2E, 0x08, 0x1B, 0x2E, 0x10, 0x2C, 0x2E, 0x14, 0x1B, 0x2E, 0x16, 0x1B, 0x2E, 0x1A, 0x38, 0x2E,
+    0x1D, 0x13, 0x2F, 0x00, 0x50, 0x0B, 0x2E, 0x1A, 0x12, 0x2E, 0x00, 0x15, 0x0C, 0x00, 0x49, 0x43,
+    0x05, 0x00, 0x10, 0x15, 0x0C, 0x09, 0x00, 0x82, 0x72, 0x65, 0x00, 0x50, 0x0B, 0x2E, 0x1A, 0x22,
+    0x2E, 0x00, 0x10, 0x15, 0x0C, 0x09, 0x00, 0x83, 0x61, 0x72, 0x65, 0x00, 0x1A, 0x15, 0x0C, 0x09,
+    0x00, 0x84, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x44, 0x57, 0x2E, 0x08, 0x57, 0x2E, 0x0D, 0x62,
+    0x2E, 0x0E, 0x62, 0x2E, 0x10, 0x76, 0x2E, 0x11, 0x62, 0x2E, 0x14, 0x57, 0x2E, 0x15, 0xFD, 0x2E,
+    0x16, 0x57, 0x2E, 0x1A, 0x22, 0x2E, 0x00, 0x10, 0x15, 0x0C, 0x09, 0x00, 0x84, 0x77, 0x61, 0x72,
+    0x65, 0x00, 0x50, 0x69, 0x2E, 0x15, 0x70, 0x2E, 0x00, 0x15, 0x0C, 0x00, 0x49, 0x5C, 0x2E, 0x00,
+    0x0C, 0x00, 0x49, 0x31, 0x2E, 0x00, 0x48, 0x8F, 0x2E, 0x09, 0x8F, 0x2E, 0x0C, 0xAA, 0x2E, 0x0D,
+    0xC4, 0x2E, 0x0E, 0xC4, 0x2E, 0x11, 0xC4, 0x2E, 0x15, 0xCB, 0x2E, 0x17, 0x8F, 0x2E, 0x00, 0x4C,
+    0x96, 0x2E, 0x15, 0xA0, 0x2E, 0x00, 0x09, 0x00, 0x85, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00,
+    0x0C, 0x09, 0x00, 0x85, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x49, 0xB1, 0x2E, 0x15, 0xB9, 0x2E,
+    0x00, 0x84, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x09, 0x00, 0x86, 0x69, 0x72, 0x6D, 0x77,
+    0x61, 0x72, 0x65, 0x00, 0x15, 0x0C, 0x00, 0x49, 0xA3, 0x2E, 0x00, 0x48, 0xDE, 0x2E, 0x09, 0xE9,
+    0x2E, 0x0E, 0xF2, 0x2E, 0x12, 0xF2, 0x2E, 0x17, 0xDE, 0x2E, 0x18, 0xF2, 0x2E, 0x00, 0x0C, 0x09,
+    0x00, 0x86, 0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x85, 0x69, 0x72, 0x6D, 0x77, 0x61, 0x72,
+    0x65, 0x00, 0x49, 0xBB, 0x2E, 0x0C, 0xF9, 0x2E, 0x00, 0x49, 0xE1, 0x2E, 0x00, 0x4C, 0x04, 0x2F,
+    0x10, 0x0D, 0x2F, 0x00, 0x09, 0x00, 0x83, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x00, 0x0C, 0x00, 0x49,
+    0x98, 0x2E, 0x00, 0x1A, 0x10, 0x15, 0x0C, 0x00, 0x49, 0x27, 0x2E, 0x00, 0x48, 0x23, 0x2F, 0x0B,
+    0x2A, 0x2F, 0x00, 0x4B, 0x17, 0x2E, 0x1A, 0x17, 0x2E, 0x00, 0x57, 0xDB, 0x23, 0x1A, 0xDB, 0x23,
+    0x00, 0x44, 0x59, 0x2F, 0x05, 0x60, 0x2F, 0x07, 0x70, 0x2F, 0x0A, 0x60, 0x2F, 0x0B, 0x74, 0x2F,
+    0x0D, 0x60, 0x2F, 0x11, 0xB3, 0x2F, 0x12, 0xBA, 0x2F, 0x14, 0x59, 0x2F, 0x15, 0xBE, 0x2F, 0x16,
+    0x59, 0x2F, 0x1A, 0xC5, 0x2F, 0x1C, 0xDF, 0x2F, 0x00, 0x1A, 0x00, 0x83, 0x65, 0x72, 0x65, 0x00,
+    0x4B, 0x5B, 0x2F, 0x17, 0x6A, 0x2F, 0x1A, 0x6A, 0x2F, 0x00, 0x83, 0x68, 0x65, 0x72, 0x65, 0x00,
+    0x4B, 0x5B, 0x2F, 0x00, 0x45, 0xD3, 0x05, 0x08, 0x90, 0x2F, 0x0A, 0x97, 0x2F, 0x0D, 0xD3, 0x05,
+    0x11, 0x9E, 0x2F, 0x14, 0x90, 0x2F, 0x17, 0xA2, 0x2F, 0x1A, 0xA6, 0x2F, 0x1C, 0x97, 0x2F, 0x00,
+    0x84, 0x77, 0x68, 0x65, 0x72, 0x65, 0x00, 0x57, 0xD3, 0x05, 0x1A, 0xD3, 0x05, 0x00, 0x6C, 0xD3,
+    0x05, 0x00, 0x4A, 0xB6, 0x05, 0x00, 0x44, 0xAD, 0x05, 0x08, 0xAB, 0x05, 0x14, 0xAD, 0x05, 0x16,
+    0xAD, 0x05, 0x00, 0x4B, 0x5B, 0x2F, 0x1A, 0x6A, 0x2F, 0x00, 0x50, 0x17, 0x2E, 0x00, 0x4B, 0x5B,
+    0x2F, 0x1A, 0x5B, 0x2F, 0x00, 0x44, 0xD2, 0x2F, 0x0B, 0xD8, 0x2F, 0x14, 0xD2, 0x2F, 0x1A, 0x5B,
+    0x2F, 0x00, 0x84, 0x77, 0x65, 0x72, 0x65, 0x00, 0x57, 0x5B, 0x2F, 0x1A, 0x5B, 0x2F, 0x00, 0x4B,
+    0x5B, 0x2F, 0x17, 0x6A, 0x2F, 0x00, 0x74, 0xF9, 0x2F, 0x04, 0x00, 0x30, 0x08, 0x23, 0x2F, 0x0C,
+    0xA2, 0x21, 0x12, 0x09, 0x30, 0x18, 0x21, 0x30, 0x00, 0x18, 0x12, 0x00, 0x5C, 0x17, 0x2E, 0x00,
+    0x1A, 0x10, 0x15, 0x0C, 0x00, 0x49, 0x17, 0x2E, 0x00, 0x48, 0x13, 0x30, 0x09, 0x1B, 0x30, 0x10,
+    0x17, 0x2E, 0x00, 0x05, 0x00, 0x83, 0x66, 0x6F, 0x72, 0x65, 0x00, 0x08, 0x00, 0x45, 0x17, 0x2E,
+    0x00, 0x16, 0x04, 0x08, 0x00, 0x50, 0x17, 0x2E, 0x00, 0x08, 0x00, 0x57, 0x6A, 0x2F, 0x1A, 0x6A,
+    0x2F, 0x00, 0x48, 0x91, 0x15, 0x12, 0x3F, 0x30, 0x16, 0x46, 0x30, 0x18, 0x21, 0x30, 0x00, 0x09,
+    0x08, 0x00, 0x45, 0x17, 0x2E, 0x00, 0x04, 0x08, 0x10, 0x00, 0x82, 0x75, 0x72, 0x65, 0x00, 0x56,
+    0x46, 0x30, 0x18, 0x21, 0x30, 0x00, 0x49, 0x07, 0x06, 0x12, 0x5D, 0x30, 0x00, 0x49, 0x1B, 0x30,
+    0x10, 0x17, 0x2E, 0x00, 0x46, 0x8F, 0x30, 0x07, 0x98, 0x30, 0x08, 0xA5, 0x30, 0x09, 0xB6, 0x30,
+    0x0A, 0x8F, 0x30, 0x0C, 0xE1, 0x30, 0x0D, 0xE8, 0x30, 0x0E, 0xE8, 0x30, 0x0F, 0xEC, 0x30, 0x10,
+    0xF7, 0x30, 0x11, 0xE8, 0x30, 0x13, 0xEC, 0x30, 0x15, 0x98, 0x30, 0x19, 0x98, 0x30, 0x00, 0x09,
+    0x08, 0x05, 0x00, 0x83, 0x6F, 0x72, 0x65, 0x00, 0x48, 0x13, 0x30, 0x09, 0x9F, 0x30, 0x00, 0x08,
+    0x00, 0x45, 0x93, 0x30, 0x00, 0x45, 0xAC, 0x30, 0x09, 0xB2, 0x30, 0x00, 0x82, 0x66, 0x6F, 0x72,
+    0x65, 0x00, 0x45, 0x29, 0x06, 0x00, 0x46, 0x1D, 0x06, 0x07, 0xCC, 0x30, 0x08, 0xD7, 0x30, 0x0A,
+    0x1D, 0x06, 0x15, 0xCC, 0x30, 0x19, 0x1D, 0x06, 0x1A, 0xCC, 0x30, 0x00, 0x45, 0x29, 0x06, 0x08,
+    0xD3, 0x30, 0x00, 0x45, 0x20, 0x06, 0x00, 0x2C, 0x00, 0x84, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65,
+    0x00, 0x49, 0x9F, 0x30, 0x10, 0x93, 0x30, 0x00, 0x50, 0x93, 0x30, 0x00, 0x49, 0x9F, 0x30, 0x10,
+    0xF3, 0x30, 0x00, 0x6C, 0x93, 0x30, 0x00, 0x4D, 0x01, 0x31, 0x0E, 0x01, 0x31, 0x11, 0x01, 0x31,
+    0x00, 0x84, 0x6D, 0x6F, 0x72, 0x65, 0x00, 0x49, 0x07, 0x06, 0x12, 0x3F, 0x30, 0x00, 0x44, 0x00,
+    0x30, 0x1A, 0x15, 0x31, 0x00, 0x10, 0x15, 0x0C, 0x00, 0x49, 0x5C, 0x21, 0x00, 0x0B, 0x00, 0x5A,
+    0xDB, 0x23, 0x00, 0x44, 0x2D, 0x31, 0x18, 0x3B, 0x31, 0x1A, 0x15, 0x31, 0x00, 0x48, 0x34, 0x31,
+    0x1A, 0x12, 0x2E, 0x00, 0x10, 0x00, 0x81, 0x75, 0x72, 0x65, 0x00, 0x04, 0x08, 0x10, 0x00, 0x83,
+    0x73, 0x75, 0x72, 0x65, 0x00, 0x74, 0xF9, 0x2F, 0x04, 0x00, 0x30, 0x08, 0x23, 0x2F, 0x09, 0x58,
+    0x31, 0x12, 0x3F, 0x30, 0x18, 0x21, 0x30, 0x00, 0x04, 0x00, 0x81, 0x65, 0x72, 0x00, 0x74, 0x7D,
+    0x31, 0x04, 0x83, 0x31, 0x07, 0xB3, 0x31, 0x08, 0xB3, 0x31, 0x0C, 0xC1, 0x31, 0x0D, 0xC1, 0x31,
+    0x16, 0xC9, 0x31, 0x1A, 0xB3, 0x31, 0x1B, 0xB3, 0x31, 0x1C, 0xC1, 0x31, 0x00, 0x12, 0x00, 0x5C,
+    0x9E, 0x2D, 0x00, 0x44, 0x8D, 0x31, 0x08, 0x93, 0x31, 0x16, 0x9B, 0x31, 0x00, 0x08, 0x00, 0x50,
+    0x3F, 0x31, 0x00, 0x10, 0x00, 0x82, 0x73, 0x75, 0x72, 0x65, 0x00, 0x44, 0xA2, 0x31, 0x08, 0xAA,
+    0x31, 0x00, 0x08, 0x10, 0x00, 0x83, 0x75, 0x72, 0x65, 0x00, 0x10, 0x00, 0x84, 0x61, 0x73, 0x75,
+    0x72, 0x65, 0x00, 0x44, 0x8D, 0x31, 0x16, 0xBA, 0x31, 0x00, 0x04, 0x08, 0x00, 0x50, 0xA5, 0x31,
+    0x00, 0x16, 0x04, 0x08, 0x00, 0x50, 0xA5, 0x31, 0x00, 0x44, 0xE2, 0x31, 0x07, 0x38, 0x32, 0x08,
+    0x3F, 0x32, 0x14, 0x58, 0x32, 0x16, 0x9B, 0x31, 0x1A, 0x58, 0x32, 0x1B, 0x38, 0x32, 0x1D, 0x58,
+    0x32, 0x00, 0x44, 0xFE, 0x31, 0x07, 0x07, 0x32, 0x08, 0x1F, 0x32, 0x10, 0x2A, 0x32, 0x14, 0x32,
+    0x32, 0x15, 0x07, 0x32, 0x16, 0x32, 0x32, 0x1A, 0x07, 0x32, 0x1D, 0x32, 0x32, 0x00, 0x08, 0x10,
+    0x00, 0x84, 0x73, 0x75, 0x72, 0x65, 0x00, 0x48, 0x0E, 0x32, 0x10, 0x17, 0x32, 0x00, 0x10, 0x00,
+    0x85, 0x61, 0x73, 0x75, 0x72, 0x65, 0x00, 0x85, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x00, 0x2C,
+    0x00, 0x85, 0x6D, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x00, 0x84, 0x65, 0x61, 0x73, 0x75, 0x72,
+    0x65, 0x00, 0x08, 0x00, 0x50, 0x10, 0x32, 0x00, 0x04, 0x08, 0x00, 0x50, 0x01, 0x32, 0x00, 0x44,
+    0x46, 0x32, 0x10, 0x51, 0x32, 0x00, 0x48, 0x4D, 0x32, 0x10, 0x17, 0x32, 0x00, 0x50, 0x01, 0x32,
+    0x00, 0x83, 0x61, 0x73, 0x75, 0x72, 0x65, 0x00, 0x44, 0xFE, 0x31, 0x08, 0xAA, 0x31, 0x00, 0x44,
+    0x9E, 0x21, 0x08, 0x69, 0x32, 0x12, 0xA2, 0x21, 0x00, 0x51, 0x5A, 0x31, 0x00, 0x44, 0x04, 0x2E,
+    0x08, 0x23, 0x2F, 0x0B, 0x2A, 0x2F, 0x10, 0x7D, 0x32, 0x1A, 0x15, 0x31, 0x00, 0x15, 0x0C, 0x09,
+    0x00, 0x81, 0x61, 0x72, 0x65, 0x00, 0x74, 0x87, 0x15, 0x04, 0xBA, 0x32, 0x06, 0xE6, 0x32, 0x07,
+    0xED, 0x32, 0x08, 0x05, 0x33, 0x0B, 0x79, 0x33, 0x0C, 0x82, 0x33, 0x0D, 0x82, 0x33, 0x0F, 0x92,
+    0x33, 0x11, 0x9D, 0x33, 0x12, 0xA4, 0x33, 0x13, 0x92, 0x33, 0x15, 0x21, 0x34, 0x18, 0x30, 0x34,
+    0x1A, 0x02, 0x35, 0x1B, 0x0F, 0x35, 0x1C, 0x82, 0x33, 0x00, 0x46, 0xC7, 0x32, 0x08, 0x0E, 0x07,
+    0x12, 0x0E, 0x07, 0x18, 0xCF, 0x32, 0x00, 0x08, 0x05, 0x00, 0x81, 0x75, 0x73, 0x65, 0x00, 0x44,
+    0xD6, 0x32, 0x06, 0xDD, 0x32, 0x00, 0x06, 0x08, 0x00, 0x45, 0x11, 0x07, 0x00, 0x08, 0x05, 0x00,
+    0x83, 0x61, 0x75, 0x73, 0x65, 0x00, 0x11, 0x0C, 0x16, 0x00, 0x81, 0x65, 0x00, 0x44, 0xE3, 0x21,
+    0x08, 0x0E, 0x07, 0x0B, 0xFB, 0x23, 0x12, 0x0E, 0x07, 0x18, 0xFD, 0x32, 0x00, 0x04, 0x06, 0x08,
+    0x00, 0x45, 0x11, 0x07, 0x00, 0x45, 0x27, 0x33, 0x07, 0x3B, 0x33, 0x0A, 0x27, 0x33, 0x0B, 0x41,
+    0x33, 0x0D, 0x27, 0x33, 0x11, 0x27, 0x33, 0x12, 0x7A, 0x20, 0x15, 0x3B, 0x33, 0x17, 0x75, 0x33,
+    0x1A, 0x3B, 0x33, 0x1C, 0x27, 0x33, 0x00, 0x4B, 0x2E, 0x33, 0x17, 0x35, 0x33, 0x00, 0x17, 0x00,
+    0x83, 0x65, 0x73, 0x65, 0x00, 0x83, 0x68, 0x65, 0x73, 0x65, 0x00, 0x0B, 0x00, 0x57, 0x30, 0x33,
+    0x00, 0x45, 0x57, 0x33, 0x0A, 0x5B, 0x33, 0x0D, 0x57, 0x33, 0x11, 0x57, 0x33, 0x15, 0x5D, 0x33,
+    0x17, 0x64, 0x33, 0x1C, 0x5D, 0x33, 0x00, 0x57, 0x4C, 0x06, 0x00, 0x2C, 0x00, 0x84, 0x74, 0x68,
+    0x65, 0x73, 0x65, 0x00, 0x4A, 0x6E, 0x33, 0x15, 0x6E, 0x33, 0x1C, 0x6E, 0x33, 0x00, 0x85, 0x74,
+    0x68, 0x65, 0x73, 0x65, 0x00, 0x4B, 0x5D, 0x33, 0x00, 0x12, 0x17, 0x00, 0x83, 0x68, 0x6F, 0x73,
+    0x65, 0x00, 0x44, 0x89, 0x33, 0x18, 0xFD, 0x32, 0x00, 0x06, 0x08, 0x05, 0x00, 0x82, 0x75, 0x73,
+    0x65, 0x00, 0x4B, 0x99, 0x33, 0x12, 0x0E, 0x07, 0x00, 0x57, 0x29, 0x2D, 0x00, 0x0C, 0x16, 0x00,
+    0x81, 0x63, 0x65, 0x00, 0x45, 0xC0, 0x33, 0x0A, 0xC0, 0x33, 0x0B, 0xCE, 0x33, 0x0D, 0xC0, 0x33,
+    0x0F, 0x0C, 0x34, 0x11, 0x12, 0x34, 0x13, 0x0C, 0x34, 0x17, 0x1D, 0x34, 0x1C, 0xC0, 0x33, 0x00,
+    0x4B, 0xC7, 0x33, 0x17, 0x7C, 0x33, 0x00, 0x17, 0x00, 0x83, 0x6F, 0x73, 0x65, 0x00, 0x45, 0xE4,
+    0x33, 0x0A, 0xEC, 0x33, 0x0D, 0xE4, 0x33, 0x11, 0xE4, 0x33, 0x15, 0xF3, 0x33, 0x17, 0xF7, 0x33,
+    0x1C, 0xEC, 0x33, 0x00, 0x17, 0x00, 0x84, 0x68, 0x6F, 0x73, 0x65, 0x00, 0x84, 0x74, 0x68, 0x6F,
+    0x73, 0x65, 0x00, 0x6C, 0xEC, 0x33, 0x00, 0x4A, 0x01, 0x34, 0x15, 0x08, 0x34, 0x1C, 0x01, 0x34,
+    0x00, 0x85, 0x74, 0x68, 0x6F, 0x73, 0x65, 0x00, 0x6C, 0x01, 0x34, 0x00, 0x0B, 0x00, 0x57, 0xC9,
+    0x33, 0x00, 0x4B, 0xC7, 0x33, 0x17, 0x19, 0x34, 0x00, 0x6C, 0x7C, 0x33, 0x00, 0x4B, 0xEC, 0x33,
+    0x00, 0x44, 0x2B, 0x34, 0x08, 0x0E, 0x07, 0x0B, 0xFB, 0x23, 0x00, 0x08, 0x1C, 0x00, 0x80, 0x00,
+    0x44, 0x4C, 0x34, 0x06, 0xD5, 0x34, 0x0C, 0xEA, 0x34, 0x0D, 0xEA, 0x34, 0x14, 0xF4, 0x34, 0x16,
+    0xF4, 0x34, 0x1A, 0xF4, 0x34, 0x1C, 0xEA, 0x34, 0x1D, 0xF4, 0x34, 0x00, 0x46, 0x68, 0x34, 0x07,
+    0xB4, 0x34, 0x08, 0xC8, 0x34, 0x14, 0xCE, 0x34, 0x16, 0xB4, 0x34, 0x19, 0xB4, 0x34, 0x1A, 0xCE,
+    0x34, 0x1B, 0xB4, 0x34, 0x1D, 0xCE, 0x34, 0x00, 0x45, 0x81, 0x34, 0x07, 0x8B, 0x34, 0x08, 0xA3,
+    0x34, 0x15, 0x8B, 0x34, 0x16, 0xAE, 0x34, 0x19, 0xAE, 0x34, 0x1A, 0x8B, 0x34, 0x1B, 0xAE, 0x34,
+    0x00, 0x2C, 0x00, 0x84, 0x65, 0x63, 0x61, 0x75, 0x73, 0x65, 0x00, 0x45, 0x92, 0x34, 0x08, 0x9A,
+    0x34, 0x00, 0x85, 0x65, 0x63, 0x61, 0x75, 0x73, 0x65, 0x00, 0x05, 0x00, 0x85, 0x63, 0x61, 0x75,
+    0x73, 0x65, 0x00, 0x2C, 0x00, 0x85, 0x62, 0x65, 0x63, 0x61, 0x75, 0x73, 0x65, 0x00, 0x08, 0x00,
+    0x45, 0x9C, 0x34, 0x00, 0x46, 0xBB, 0x34, 0x08, 0xC4, 0x34, 0x00, 0x08, 0x05, 0x00, 0x84, 0x61,
+    0x75, 0x73, 0x65, 0x00, 0x45, 0x56, 0x06, 0x00, 0x06, 0x00, 0x45, 0x92, 0x34, 0x00, 0x06, 0x08,
+    0x00, 0x45, 0xBE, 0x34, 0x00, 0x44, 0xDC, 0x34, 0x08, 0xE2, 0x34, 0x00, 0x08, 0x00, 0x45, 0x56,
+    0x06, 0x00, 0x05, 0x00, 0x82, 0x61, 0x75, 0x73, 0x65, 0x00, 0x04, 0x06, 0x08, 0x05, 0x00, 0x83,
+    0x75, 0x73, 0x65, 0x00, 0x44, 0xFB, 0x34, 0x06, 0xDD, 0x32, 0x00, 0x06, 0x08, 0x00, 0x45, 0xEF,
+    0x34, 0x00, 0x48, 0x0E, 0x07, 0x0B, 0xFB, 0x23, 0x12, 0x0E, 0x07, 0x18, 0xFD, 0x32, 0x00, 0x48,
+    0x0E, 0x07, 0x12, 0x0E, 0x07, 0x18, 0xFD, 0x32, 0x00, 0x74, 0x3D, 0x24, 0x04, 0x41, 0x35, 0x08,
+    0xC6, 0x35, 0x0A, 0x2B, 0x07, 0x0F, 0xD3, 0x35, 0x12, 0x8A, 0x24, 0x14, 0xDA, 0x35, 0x15, 0xEB,
+    0x35, 0x16, 0xF4, 0x35, 0x18, 0xFC, 0x35, 0x1A, 0xDA, 0x35, 0x1C, 0x2B, 0x07, 0x1D, 0xDA, 0x35,
+    0x00, 0x4A, 0x5A, 0x35, 0x14, 0x6D, 0x35, 0x15, 0x73, 0x35, 0x16, 0x79, 0x35, 0x17, 0x82, 0x35,
+    0x1A, 0xB1, 0x35, 0x1C, 0xBF, 0x35, 0x1D, 0x6D, 0x35, 0x00, 0x56, 0x61, 0x35, 0x17, 0x69, 0x35,
+    0x00, 0x2C, 0x00, 0x83, 0x74, 0x61, 0x74, 0x65, 0x00, 0x56, 0xA1, 0x06, 0x00, 0x17, 0x00, 0x56,
+    0xA1, 0x06, 0x00, 0x16, 0x00, 0x6C, 0x63, 0x35, 0x00, 0x17, 0x00, 0x84, 0x73, 0x74, 0x61, 0x74,
+    0x65, 0x00, 0x44, 0x9B, 0x35, 0x07, 0x7B, 0x35, 0x08, 0x9B, 0x35, 0x0A, 0x9F, 0x35, 0x15, 0x9F,
+    0x35, 0x16, 0xA3, 0x35, 0x1A, 0x7B, 0x35, 0x1C, 0x9F, 0x35, 0x00, 0x6C, 0x7B, 0x35, 0x00, 0x56,
+    0xB3, 0x06, 0x00, 0x47, 0xAD, 0x35, 0x1A, 0x7D, 0x06, 0x1B, 0xAD, 0x35, 0x00, 0x6C, 0x7D, 0x06,
+    0x00, 0x50, 0xB8, 0x35, 0x17, 0x69, 0x35, 0x00, 0x15, 0x0C, 0x00, 0x49, 0x55, 0x23, 0x00, 0x56,
+    0x63, 0x35, 0x17, 0x69, 0x35, 0x00, 0x0B, 0x00, 0x57, 0xCF, 0x35, 0x1A, 0x55, 0x23, 0x00, 0x6C,
+    0x55, 0x23, 0x00, 0x17, 0x0C, 0x00, 0x4F, 0x52, 0x04, 0x00, 0x44, 0xE1, 0x35, 0x17, 0xE7, 0x35,
+    0x00, 0x17, 0x00, 0x56, 0x2F, 0x07, 0x00, 0x56, 0x71, 0x21, 0x00, 0x08, 0x00, 0x4B, 0x0D, 0x26,
+    0x1A, 0x71, 0x02, 0x00, 0x04, 0x17, 0x16, 0x00, 0x6C, 0x2F, 0x07, 0x00, 0x16, 0x04, 0x08, 0x00,
+    0x50, 0x55, 0x23, 0x00, 0x44, 0x0E, 0x36, 0x15, 0x16, 0x36, 0x16, 0x1E, 0x36, 0x00, 0x06, 0x08,
+    0x05, 0x00, 0x80, 0x73, 0x65, 0x00, 0x16, 0x04, 0x08, 0x00, 0x50, 0x4A, 0x30, 0x00, 0x04, 0x00,
+    0x46, 0x27, 0x36, 0x08, 0x2D, 0x36, 0x00, 0x08, 0x00, 0x45, 0x8D, 0x33, 0x00, 0x50, 0x35, 0x21,
+    0x00, 0x44, 0x59, 0x36, 0x05, 0x9F, 0x36, 0x06, 0xB0, 0x36, 0x09, 0xC0, 0x36, 0x0A, 0x9F, 0x36,
+    0x0C, 0xCA, 0x36, 0x0F, 0xCA, 0x36, 0x12, 0xD0, 0x36, 0x13, 0xCA, 0x36, 0x14, 0xEA, 0x36, 0x16,
+    0xEA, 0x36, 0x1A, 0xEA, 0x36, 0x1D, 0xEA, 0x36, 0x00, 0x45, 0x78, 0x36, 0x0A, 0x78, 0x36, 0x0B,
+    0x7F, 0x36, 0x0D, 0x78, 0x36, 0x11, 0x78, 0x36, 0x14, 0x78, 0x36, 0x16, 0x99, 0x36, 0x1A, 0x78,
+    0x36, 0x1C, 0x78, 0x36, 0x1D, 0x78, 0x36, 0x00, 0x0B, 0x00, 0x83, 0x61, 0x76, 0x65, 0x00, 0x45,
+    0x8F, 0x36, 0x0A, 0x8F, 0x36, 0x0D, 0x8F, 0x36, 0x11, 0x95, 0x36, 0x1C, 0x8F, 0x36, 0x00, 0x84,
+    0x68, 0x61, 0x76, 0x65, 0x00, 0x6C, 0x8F, 0x36, 0x00, 0x0B, 0x00, 0x6C, 0x7A, 0x36, 0x00, 0x44,
+    0xA6, 0x36, 0x12, 0xAC, 0x36, 0x00, 0x0B, 0x00, 0x82, 0x76, 0x65, 0x00, 0x4F, 0xA8, 0x36, 0x00,
+    0x44, 0xA6, 0x36, 0x11, 0xBA, 0x36, 0x12, 0xAC, 0x36, 0x00, 0x0C, 0x16, 0x00, 0x81, 0x65, 0x00,
+    0x44, 0xA6, 0x36, 0x0C, 0xA2, 0x21, 0x12, 0xAC, 0x36, 0x00, 0x12, 0x00, 0x4F, 0xA8, 0x36, 0x00,
+    0x4C, 0xDA, 0x36, 0x0F, 0xE1, 0x36, 0x13, 0xDA, 0x36, 0x00, 0x0F, 0x00, 0x83, 0x6F, 0x76, 0x65,
+    0x00, 0x12, 0x2C, 0x00, 0x84, 0x6C, 0x6F, 0x76, 0x65, 0x00, 0x04, 0x00, 0x4B, 0xA8, 0x36, 0x00,
+    0x48, 0x06, 0x37, 0x09, 0xE7, 0x21, 0x0E, 0xEA, 0x22, 0x10, 0x0D, 0x37, 0x15, 0x1B, 0x37, 0x18,
+    0x76, 0x21, 0x19, 0x97, 0x21, 0x00, 0x15, 0x0B, 0x17, 0x00, 0x81, 0x65, 0x00, 0x44, 0x17, 0x37,
+    0x0C, 0x0C, 0x23, 0x12, 0x10, 0x23, 0x00, 0x4A, 0x71, 0x02, 0x00, 0x48, 0x0D, 0x26, 0x0B, 0x22,
+    0x37, 0x00, 0x57, 0x24, 0x23, 0x00, 0x46, 0xE6, 0x32, 0x07, 0x39, 0x37, 0x08, 0x4F, 0x21, 0x11,
+    0x9D, 0x33, 0x16, 0x61, 0x21, 0x18, 0x76, 0x21, 0x00, 0x04, 0x10, 0x00, 0x81, 0x65, 0x00, 0x44,
+    0x46, 0x37, 0x17, 0xC5, 0x24, 0x00, 0x1A, 0x0F, 0x04, 0x00, 0x80, 0x73, 0x00, 0x47, 0x60, 0x37,
+    0x08, 0x75, 0x37, 0x0A, 0xC7, 0x15, 0x0F, 0x8B, 0x37, 0x11, 0x98, 0x37, 0x15, 0xA5, 0x37, 0x00,
+    0x48, 0x6A, 0x37, 0x0C, 0x72, 0x16, 0x0F, 0x6F, 0x37, 0x00, 0x16, 0x18, 0x00, 0x80, 0x00, 0x18,
+    0x00, 0x52, 0x85, 0x16, 0x00, 0x4B, 0x7F, 0x37, 0x17, 0x85, 0x37, 0x19, 0x12, 0x24, 0x00, 0x17,
+    0x12, 0x00, 0x80, 0x72, 0x00, 0x09, 0x04, 0x00, 0x80, 0x72, 0x00, 0x55, 0x80, 0x17, 0x18, 0x92,
+    0x37, 0x00, 0x12, 0x06, 0x00, 0x80, 0x64, 0x00, 0x4C, 0x28, 0x16, 0x18, 0x9F, 0x37, 0x00, 0x12,
+    0x16, 0x00, 0x80, 0x64, 0x00, 0x48, 0xAF, 0x37, 0x0C, 0xB5, 0x37, 0x18, 0xBB, 0x37, 0x00, 0x19,
+    0x08, 0x11, 0x00, 0x80, 0x00, 0x08, 0x0B, 0x17, 0x00, 0x80, 0x00, 0x12, 0x1C, 0x00, 0x80, 0x00,
+    0x74, 0xE8, 0x37, 0x04, 0xF9, 0x37, 0x05, 0x00, 0x38, 0x06, 0x33, 0x38, 0x09, 0x43, 0x38, 0x0B,
+    0x4A, 0x38, 0x0C, 0x60, 0x38, 0x0D, 0xA3, 0x38, 0x10, 0xA3, 0x38, 0x11, 0xC4, 0x38, 0x16, 0x45,
+    0x3D, 0x17, 0x4C, 0x3D, 0x19, 0x43, 0x38, 0x00, 0x11, 0x00, 0x44, 0xF1, 0x37, 0x12, 0xF5, 0x37,
+    0x00, 0x46, 0x1E, 0x09, 0x00, 0x47, 0x1E, 0x09, 0x00, 0x08, 0x15, 0x0A, 0x00, 0x80, 0x74, 0x00,
+    0x4C, 0x07, 0x38, 0x11, 0x2D, 0x38, 0x00, 0x48, 0x14, 0x38, 0x0B, 0x1A, 0x38, 0x12, 0x23, 0x38,
+    0x15, 0x27, 0x38, 0x00, 0x05, 0x00, 0x81, 0x6E, 0x67, 0x00, 0x17, 0x08, 0x10, 0x12, 0x00, 0x56,
+    0x16, 0x38, 0x00, 0x4A, 0x16, 0x38, 0x00, 0x18, 0x00, 0x47, 0x16, 0x38, 0x00, 0x12, 0x0F, 0x00,
+    0x81, 0x67, 0x00, 0x44, 0x3D, 0x38, 0x0C, 0xBB, 0x15, 0x17, 0xC1, 0x15, 0x00, 0x1B, 0x08, 0x00,
+    0x80, 0x74, 0x00, 0x11, 0x12, 0x0F, 0x00, 0x81, 0x67, 0x00, 0x46, 0xE0, 0x15, 0x0A, 0x5A, 0x38,
+    0x0C, 0x07, 0x38, 0x11, 0x2D, 0x38, 0x17, 0xFB, 0x15, 0x00, 0x0C, 0x15, 0x00, 0x80, 0x74, 0x00,
+    0x4B, 0x6A, 0x38, 0x11, 0x74, 0x38, 0x15, 0x9D, 0x38, 0x00, 0x17, 0x08, 0x10, 0x12, 0x16, 0x00,
+    0x80, 0x6E, 0x67, 0x00, 0x4B, 0x81, 0x38, 0x0E, 0x8C, 0x38, 0x12, 0x93, 0x38, 0x15, 0x97, 0x38,
+    0x00, 0x17, 0x08, 0x10, 0x12, 0x16, 0x00, 0x82, 0x69, 0x6E, 0x67, 0x00, 0x06, 0x18, 0x00, 0x49,
+    0x87, 0x38, 0x00, 0x4A, 0x87, 0x38, 0x00, 0x18, 0x00, 0x47, 0x87, 0x38, 0x00, 0x18, 0x00, 0x47,
+    0x70, 0x38, 0x00, 0x4C, 0x07, 0x38, 0x11, 0xAA, 0x38, 0x00, 0x4C, 0xB1, 0x38, 0x12, 0xC0, 0x38,
+    0x00, 0x48, 0xB8, 0x38, 0x12, 0xBC, 0x38, 0x00, 0x45, 0x30, 0x38, 0x00, 0x4A, 0x30, 0x38, 0x00,
+    0x4F, 0x30, 0x38, 0x00, 0x45, 0xE9, 0x38, 0x08, 0x1A, 0x39, 0x0B, 0x23, 0x39, 0x0C, 0x52, 0x39,
+    0x0D, 0xE9, 0x38, 0x0E, 0x95, 0x3C, 0x0F, 0xBF, 0x3C, 0x10, 0xE9, 0x38, 0x12, 0xC5, 0x3C, 0x13,
+    0xBF, 0x3C, 0x15, 0x21, 0x3D, 0x18, 0x32, 0x3D, 0x00, 0x4C, 0xF0, 0x38, 0x12, 0x16, 0x39, 0x00,
+    0x48, 0xFD, 0x38, 0x0B, 0x03, 0x39, 0x12, 0x0C, 0x39, 0x15, 0x10, 0x39, 0x00, 0x05, 0x00, 0x82,
+    0x6E, 0x67, 0x00, 0x17, 0x08, 0x10, 0x12, 0x00, 0x56, 0xFF, 0x38, 0x00, 0x4A, 0xFF, 0x38, 0x00,
+    0x18, 0x00, 0x47, 0xFF, 0x38, 0x00, 0x4F, 0xFF, 0x38, 0x00, 0x0C, 0x05, 0x00, 0x83, 0x65, 0x69,
+    0x6E, 0x67, 0x00, 0x4C, 0x2D, 0x39, 0x12, 0x16, 0x39, 0x17, 0x48, 0x39, 0x00, 0x48, 0xFD, 0x38,
+    0x0B, 0x03, 0x39, 0x12, 0x0C, 0x39, 0x15, 0x10, 0x39, 0x17, 0x3D, 0x39, 0x00, 0x08, 0x10, 0x12,
+    0x16, 0x00, 0x83, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x08, 0x10, 0x12, 0x16, 0x00, 0x81, 0x69, 0x6E,
+    0x67, 0x00, 0x45, 0x8C, 0x39, 0x06, 0xA6, 0x39, 0x07, 0xBF, 0x39, 0x08, 0xC5, 0x39, 0x09, 0x14,
+    0x3A, 0x0A, 0x21, 0x3A, 0x0B, 0x28, 0x3A, 0x0C, 0x2C, 0x3B, 0x0D, 0x45, 0x3B, 0x0E, 0x4F, 0x3B,
+    0x0F, 0xB4, 0x3B, 0x11, 0x21, 0x3A, 0x12, 0xC2, 0x3B, 0x13, 0x15, 0x3C, 0x15, 0x1C, 0x3C, 0x17,
+    0x50, 0x3C, 0x18, 0x6F, 0x3C, 0x1A, 0x91, 0x3C, 0x1C, 0x21, 0x3A, 0x00, 0x48, 0x96, 0x39, 0x0B,
+    0x9D, 0x39, 0x17, 0x3D, 0x39, 0x00, 0x84, 0x62, 0x65, 0x69, 0x6E, 0x67, 0x00, 0x17, 0x08, 0x10,
+    0x12, 0x00, 0x56, 0xBD, 0x07, 0x00, 0x4E, 0xAD, 0x39, 0x18, 0xB7, 0x39, 0x00, 0x18, 0x09, 0x00,
+    0x84, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x00, 0x09, 0x00, 0x82, 0x6B, 0x69, 0x6E, 0x67, 0x00, 0x08,
+    0x00, 0x45, 0xBD, 0x07, 0x00, 0x45, 0xE1, 0x39, 0x07, 0xF9, 0x39, 0x0A, 0xFD, 0x39, 0x0B, 0x96,
+    0x39, 0x11, 0x96, 0x39, 0x15, 0x01, 0x3A, 0x18, 0x0C, 0x3A, 0x19, 0x96, 0x39, 0x1A, 0xF9, 0x39,
+    0x00, 0x4A, 0xEE, 0x39, 0x0B, 0xEE, 0x39, 0x11, 0xF5, 0x39, 0x19, 0xEE, 0x39, 0x00, 0x85, 0x62,
+    0x65, 0x69, 0x6E, 0x67, 0x00, 0x6C, 0xEE, 0x39, 0x00, 0x45, 0xD9, 0x07, 0x00, 0x6C, 0x96, 0x39,
+    0x00, 0x45, 0xD9, 0x07, 0x18, 0x08, 0x3A, 0x00, 0x47, 0xBD, 0x07, 0x00, 0x07, 0x00, 0x83, 0x72,
+    0x69, 0x6E, 0x67, 0x00, 0x55, 0x1B, 0x3A, 0x18, 0x0C, 0x3A, 0x00, 0x18, 0x00, 0x47, 0xBD, 0x07,
+    0x00, 0x4B, 0x9D, 0x39, 0x17, 0x3D, 0x39, 0x00, 0x45, 0x41, 0x3A, 0x08, 0x4D, 0x3A, 0x0A, 0x6A,
+    0x3A, 0x0D, 0x41, 0x3A, 0x11, 0x41, 0x3A, 0x15, 0x41, 0x3A, 0x17, 0x84, 0x3A, 0x1C, 0x6A, 0x3A,
+    0x00, 0x17, 0x08, 0x10, 0x12, 0x16, 0x00, 0x84, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x50, 0x54, 0x3A,
+    0x17, 0x5E, 0x3A, 0x00, 0x12, 0x16, 0x00, 0x83, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x10, 0x12,
+    0x16, 0x00, 0x85, 0x65, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x48, 0x71, 0x3A, 0x17, 0x7C, 0x3A,
+    0x00, 0x10, 0x12, 0x16, 0x00, 0x84, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x08, 0x10, 0x12, 0x00,
+    0x56, 0x47, 0x3A, 0x00, 0x47, 0x5E, 0x3A, 0x08, 0x9A, 0x3A, 0x0A, 0x0F, 0x3B, 0x10, 0x1B, 0x3B,
+    0x15, 0x5E, 0x3A, 0x1A, 0x5E, 0x3A, 0x1C, 0x0F, 0x3B, 0x00, 0x4D, 0xAA, 0x3A, 0x0E, 0xAA, 0x3A,
+    0x10, 0xB6, 0x3A, 0x11, 0xE9, 0x3A, 0x12, 0xFF, 0x3A, 0x00, 0x12, 0x16, 0x00, 0x86, 0x6D, 0x65,
+    0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x4C, 0xC6, 0x3A, 0x0F, 0xC6, 0x3A, 0x12, 0xD2, 0x3A, 0x13,
+    0xC6, 0x3A, 0x16, 0xDF, 0x3A, 0x00, 0x16, 0x00, 0x87, 0x6F, 0x6D, 0x65, 0x74, 0x68, 0x69, 0x6E,
+    0x67, 0x00, 0x2C, 0x00, 0x87, 0x73, 0x6F, 0x6D, 0x65, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x86,
+    0x6F, 0x6D, 0x65, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x50, 0xF0, 0x3A, 0x12, 0xFB, 0x3A, 0x00,
+    0x12, 0x16, 0x00, 0x86, 0x65, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x56, 0xAD, 0x3A, 0x00, 0x50,
+    0xC6, 0x3A, 0x16, 0x06, 0x3B, 0x00, 0x85, 0x6D, 0x65, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x08,
+    0x10, 0x12, 0x16, 0x00, 0x85, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x48, 0xAA, 0x3A, 0x12, 0x22,
+    0x3B, 0x00, 0x16, 0x00, 0x84, 0x65, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x46, 0x36, 0x3B, 0x0A,
+    0x3F, 0x3B, 0x12, 0x0C, 0x39, 0x00, 0x18, 0x09, 0x00, 0x83, 0x6B, 0x69, 0x6E, 0x67, 0x00, 0x83,
+    0x6F, 0x69, 0x6E, 0x67, 0x00, 0x46, 0x36, 0x3B, 0x0B, 0x9D, 0x39, 0x17, 0x3D, 0x39, 0x00, 0x46,
+    0x6E, 0x3B, 0x07, 0xAD, 0x39, 0x0B, 0x9D, 0x39, 0x0E, 0x9B, 0x3B, 0x12, 0xA2, 0x3B, 0x15, 0x1B,
+    0x3A, 0x16, 0xAD, 0x39, 0x18, 0xA6, 0x3B, 0x19, 0xAD, 0x39, 0x1B, 0xAD, 0x39, 0x00, 0x49, 0x7E,
+    0x3B, 0x0C, 0x86, 0x3B, 0x0D, 0x86, 0x3B, 0x18, 0x90, 0x3B, 0x1C, 0x86, 0x3B, 0x00, 0x84, 0x75,
     0x63, 0x6B, 0x69, 0x6E, 0x67, 0x00, 0x09, 0x00, 0x85, 0x75, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x00,
-    0x18, 0x09, 0x00, 0x84, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x00, 0x17, 0x08, 0x10, 0x12, 0x16, 0x00,
-    0x83, 0x69, 0x6E, 0x67, 0x00, 0x06, 0x18, 0x09, 0x00, 0x83, 0x69, 0x6E, 0x67, 0x00, 0x0A, 0x00,
-    0x83, 0x69, 0x6E, 0x67, 0x00, 0x18, 0x07, 0x00, 0x83, 0x69, 0x6E, 0x67, 0x00, 0x18, 0x09, 0x00,
-    0x84, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x00, 0x46, 0xAE, 0x65, 0x09, 0xB8, 0x65, 0x00, 0x09, 0x00,
-    0x85, 0x75, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x00, 0x83, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x00, 0x18,
-    0x09, 0x00, 0x84, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x00, 0x18, 0x09, 0x00, 0x84, 0x63, 0x6B, 0x69,
-    0x6E, 0x67, 0x00, 0x46, 0xDD, 0x65, 0x0A, 0xE6, 0x65, 0x12, 0xEE, 0x65, 0x00, 0x18, 0x09, 0x00,
-    0x83, 0x6B, 0x69, 0x6E, 0x67, 0x00, 0x2C, 0x00, 0x83, 0x6F, 0x69, 0x6E, 0x67, 0x00, 0x0A, 0x00,
-    0x83, 0x69, 0x6E, 0x67, 0x00, 0x4B, 0xFC, 0x65, 0x17, 0x07, 0x66, 0x00, 0x17, 0x08, 0x10, 0x12,
-    0x16, 0x00, 0x83, 0x69, 0x6E, 0x67, 0x00, 0x08, 0x10, 0x12, 0x16, 0x00, 0x83, 0x68, 0x69, 0x6E,
-    0x67, 0x00, 0x45, 0x3A, 0x66, 0x08, 0x41, 0x66, 0x09, 0x48, 0x66, 0x0A, 0x4F, 0x66, 0x0B, 0x88,
-    0x66, 0x0C, 0x91, 0x66, 0x0E, 0x99, 0x66, 0x0F, 0xA2, 0x66, 0x12, 0xA6, 0x66, 0x13, 0xAD, 0x66,
-    0x15, 0xB5, 0x66, 0x17, 0xBD, 0x66, 0x19, 0xC4, 0x66, 0x00, 0x84, 0x67, 0x6F, 0x69, 0x6E, 0x67,
-    0x00, 0x05, 0x00, 0x83, 0x69, 0x6E, 0x67, 0x00, 0x84, 0x67, 0x6F, 0x69, 0x6E, 0x67, 0x00, 0x45,
-    0x5F, 0x66, 0x09, 0x66, 0x66, 0x0B, 0x6F, 0x66, 0x17, 0x78, 0x66, 0x19, 0x81, 0x66, 0x00, 0x85,
-    0x67, 0x6F, 0x69, 0x6E, 0x67, 0x00, 0x2C, 0x00, 0x85, 0x67, 0x6F, 0x69, 0x6E, 0x67, 0x00, 0x2C,
-    0x00, 0x85, 0x67, 0x6F, 0x69, 0x6E, 0x67, 0x00, 0x2C, 0x00, 0x85, 0x67, 0x6F, 0x69, 0x6E, 0x67,
-    0x00, 0x85, 0x67, 0x6F, 0x69, 0x6E, 0x67, 0x00, 0x2C, 0x00, 0x84, 0x67, 0x6F, 0x69, 0x6E, 0x67,
-    0x00, 0x0A, 0x00, 0x84, 0x6F, 0x69, 0x6E, 0x67, 0x00, 0x06, 0x18, 0x09, 0x00, 0x83, 0x69, 0x6E,
-    0x67, 0x00, 0x82, 0x6E, 0x67, 0x00, 0x0A, 0x00, 0x83, 0x69, 0x6E, 0x67, 0x00, 0x0A, 0x00, 0x84,
-    0x6F, 0x69, 0x6E, 0x67, 0x00, 0x18, 0x07, 0x00, 0x83, 0x69, 0x6E, 0x67, 0x00, 0x84, 0x67, 0x6F,
-    0x69, 0x6E, 0x67, 0x00, 0x84, 0x67, 0x6F, 0x69, 0x6E, 0x67, 0x00, 0x4A, 0xD2, 0x66, 0x12, 0xD8,
-    0x66, 0x00, 0x83, 0x6F, 0x69, 0x6E, 0x67, 0x00, 0x0A, 0x00, 0x83, 0x69, 0x6E, 0x67, 0x00, 0x48,
-    0xF5, 0x66, 0x09, 0xFE, 0x66, 0x0C, 0x07, 0x67, 0x0D, 0x1D, 0x67, 0x17, 0x33, 0x67, 0x18, 0x3C,
-    0x67, 0x1C, 0x46, 0x67, 0x00, 0x18, 0x07, 0x00, 0x84, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x18, 0x07,
-    0x00, 0x84, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x47, 0x0E, 0x67, 0x18, 0x15, 0x67, 0x00, 0x84, 0x75,
-    0x72, 0x69, 0x6E, 0x67, 0x00, 0x07, 0x00, 0x84, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x47, 0x24, 0x67,
-    0x18, 0x2B, 0x67, 0x00, 0x84, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x07, 0x00, 0x84, 0x72, 0x69,
-    0x6E, 0x67, 0x00, 0x18, 0x07, 0x00, 0x84, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x2C, 0x00, 0x84, 0x64,
-    0x75, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x47, 0x4D, 0x67, 0x18, 0x54, 0x67, 0x00, 0x84, 0x75, 0x72,
-    0x69, 0x6E, 0x67, 0x00, 0x07, 0x00, 0x84, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x48, 0x69, 0x67, 0x0B,
-    0x73, 0x67, 0x15, 0x7F, 0x67, 0x18, 0x87, 0x67, 0x00, 0x10, 0x12, 0x16, 0x00, 0x82, 0x68, 0x69,
-    0x6E, 0x67, 0x00, 0x08, 0x10, 0x12, 0x16, 0x00, 0x84, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x18,
-    0x07, 0x00, 0x83, 0x69, 0x6E, 0x67, 0x00, 0x07, 0x00, 0x83, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x47,
-    0xA2, 0x67, 0x08, 0xAA, 0x67, 0x0B, 0xB1, 0x67, 0x0E, 0xBC, 0x67, 0x12, 0xC5, 0x67, 0x15, 0xCC,
-    0x67, 0x00, 0x2C, 0x00, 0x82, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x05, 0x00, 0x83, 0x69, 0x6E, 0x67,
-    0x00, 0x17, 0x08, 0x10, 0x12, 0x16, 0x00, 0x83, 0x69, 0x6E, 0x67, 0x00, 0x06, 0x18, 0x09, 0x00,
-    0x83, 0x69, 0x6E, 0x67, 0x00, 0x0A, 0x00, 0x83, 0x69, 0x6E, 0x67, 0x00, 0x47, 0xD3, 0x67, 0x18,
-    0xDA, 0x67, 0x00, 0x84, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x07, 0x00, 0x83, 0x69, 0x6E, 0x67,
-    0x00, 0x05, 0x00, 0x83, 0x65, 0x69, 0x6E, 0x67, 0x00, 0x4B, 0xF0, 0x67, 0x17, 0xFB, 0x67, 0x00,
-    0x17, 0x08, 0x10, 0x12, 0x16, 0x00, 0x83, 0x69, 0x6E, 0x67, 0x00, 0x08, 0x10, 0x12, 0x16, 0x00,
-    0x83, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x4C, 0x0D, 0x68, 0x12, 0x37, 0x68, 0x00, 0x48, 0x1A, 0x68,
-    0x0B, 0x20, 0x68, 0x12, 0x2A, 0x68, 0x15, 0x30, 0x68, 0x00, 0x05, 0x00, 0x82, 0x6E, 0x67, 0x00,
-    0x17, 0x08, 0x10, 0x12, 0x16, 0x00, 0x82, 0x6E, 0x67, 0x00, 0x0A, 0x00, 0x82, 0x6E, 0x67, 0x00,
-    0x18, 0x07, 0x00, 0x82, 0x6E, 0x67, 0x00, 0x0F, 0x00, 0x82, 0x6E, 0x67, 0x00, 0x46, 0x53, 0x68,
-    0x08, 0x5B, 0x68, 0x0B, 0x62, 0x68, 0x0C, 0x6D, 0x68, 0x0E, 0x8A, 0x68, 0x12, 0x93, 0x68, 0x15,
-    0x9A, 0x68, 0x00, 0x18, 0x09, 0x00, 0x81, 0x69, 0x6E, 0x67, 0x00, 0x05, 0x00, 0x82, 0x69, 0x6E,
-    0x67, 0x00, 0x17, 0x08, 0x10, 0x12, 0x16, 0x00, 0x82, 0x69, 0x6E, 0x67, 0x00, 0x48, 0x77, 0x68,
-    0x12, 0x7D, 0x68, 0x15, 0x83, 0x68, 0x00, 0x05, 0x00, 0x82, 0x6E, 0x67, 0x00, 0x0A, 0x00, 0x82,
-    0x6E, 0x67, 0x00, 0x18, 0x07, 0x00, 0x82, 0x6E, 0x67, 0x00, 0x06, 0x18, 0x09, 0x00, 0x82, 0x69,
-    0x6E, 0x67, 0x00, 0x0A, 0x00, 0x82, 0x69, 0x6E, 0x67, 0x00, 0x18, 0x07, 0x00, 0x82, 0x69, 0x6E,
-    0x67, 0x00, 0x12, 0x0F, 0x00, 0x82, 0x6E, 0x67, 0x00, 0x4C, 0xB0, 0x68, 0x12, 0xDA, 0x68, 0x00,
-    0x48, 0xBD, 0x68, 0x0B, 0xC3, 0x68, 0x12, 0xCD, 0x68, 0x15, 0xD3, 0x68, 0x00, 0x05, 0x00, 0x82,
-    0x6E, 0x67, 0x00, 0x17, 0x08, 0x10, 0x12, 0x16, 0x00, 0x82, 0x6E, 0x67, 0x00, 0x0A, 0x00, 0x82,
-    0x6E, 0x67, 0x00, 0x18, 0x07, 0x00, 0x82, 0x6E, 0x67, 0x00, 0x0F, 0x00, 0x82, 0x6E, 0x67, 0x00,
-    0x48, 0xF9, 0x68, 0x0B, 0x00, 0x69, 0x0C, 0x0B, 0x69, 0x0E, 0x3E, 0x69, 0x0F, 0x52, 0x69, 0x12,
-    0x73, 0x69, 0x13, 0x83, 0x69, 0x15, 0x8A, 0x69, 0x00, 0x05, 0x00, 0x82, 0x69, 0x6E, 0x67, 0x00,
-    0x17, 0x08, 0x10, 0x12, 0x16, 0x00, 0x82, 0x69, 0x6E, 0x67, 0x00, 0x48, 0x1B, 0x69, 0x0A, 0x21,
-    0x69, 0x0B, 0x27, 0x69, 0x12, 0x31, 0x69, 0x15, 0x37, 0x69, 0x00, 0x05, 0x00, 0x82, 0x6E, 0x67,
-    0x00, 0x83, 0x6F, 0x69, 0x6E, 0x67, 0x00, 0x17, 0x08, 0x10, 0x12, 0x16, 0x00, 0x82, 0x6E, 0x67,
-    0x00, 0x0A, 0x00, 0x82, 0x6E, 0x67, 0x00, 0x18, 0x07, 0x00, 0x82, 0x6E, 0x67, 0x00, 0x46, 0x45,
-    0x69, 0x0F, 0x4D, 0x69, 0x00, 0x18, 0x09, 0x00, 0x82, 0x69, 0x6E, 0x67, 0x00, 0x83, 0x6F, 0x6E,
-    0x67, 0x00, 0x4E, 0x5C, 0x69, 0x0F, 0x64, 0x69, 0x12, 0x6B, 0x69, 0x00, 0x2C, 0x00, 0x84, 0x6C,
-    0x6F, 0x6E, 0x67, 0x00, 0x2C, 0x00, 0x83, 0x6F, 0x6E, 0x67, 0x00, 0x2C, 0x00, 0x84, 0x6C, 0x6F,
-    0x6E, 0x67, 0x00, 0x4A, 0x7A, 0x69, 0x0F, 0x7F, 0x69, 0x00, 0x82, 0x69, 0x6E, 0x67, 0x00, 0x82,
-    0x6E, 0x67, 0x00, 0x0F, 0x00, 0x83, 0x6F, 0x6E, 0x67, 0x00, 0x18, 0x07, 0x00, 0x82, 0x69, 0x6E,
-    0x67, 0x00, 0x12, 0x0F, 0x00, 0x82, 0x6E, 0x67, 0x00, 0x4C, 0xA0, 0x69, 0x18, 0xA9, 0x69, 0x00,
-    0x18, 0x07, 0x00, 0x83, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x07, 0x00, 0x81, 0x69, 0x6E, 0x67, 0x00,
-    0x48, 0xC3, 0x69, 0x0B, 0xCA, 0x69, 0x0C, 0xD5, 0x69, 0x0E, 0xFF, 0x69, 0x12, 0x08, 0x6A, 0x15,
-    0x0F, 0x6A, 0x00, 0x05, 0x00, 0x82, 0x69, 0x6E, 0x67, 0x00, 0x17, 0x08, 0x10, 0x12, 0x16, 0x00,
-    0x82, 0x69, 0x6E, 0x67, 0x00, 0x48, 0xE2, 0x69, 0x0B, 0xE8, 0x69, 0x12, 0xF2, 0x69, 0x15, 0xF8,
-    0x69, 0x00, 0x05, 0x00, 0x82, 0x6E, 0x67, 0x00, 0x17, 0x08, 0x10, 0x12, 0x16, 0x00, 0x82, 0x6E,
-    0x67, 0x00, 0x0A, 0x00, 0x82, 0x6E, 0x67, 0x00, 0x18, 0x07, 0x00, 0x82, 0x6E, 0x67, 0x00, 0x06,
-    0x18, 0x09, 0x00, 0x82, 0x69, 0x6E, 0x67, 0x00, 0x0A, 0x00, 0x82, 0x69, 0x6E, 0x67, 0x00, 0x18,
-    0x07, 0x00, 0x82, 0x69, 0x6E, 0x67, 0x00, 0x15, 0x0C, 0x09, 0x00, 0x80, 0x74, 0x00, 0x74, 0x3A,
-    0x6A, 0x04, 0x4B, 0x6A, 0x06, 0x58, 0x6A, 0x0B, 0x5E, 0x6A, 0x0C, 0x64, 0x6A, 0x11, 0x69, 0x6A,
-    0x15, 0x80, 0x6A, 0x16, 0x85, 0x6A, 0x18, 0xAA, 0x6A, 0x00, 0x11, 0x00, 0x44, 0x43, 0x6A, 0x12,
-    0x47, 0x6A, 0x00, 0x06, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x0B, 0x00, 0x57, 0x54, 0x6A,
-    0x1A, 0x56, 0x6A, 0x00, 0x80, 0x00, 0x80, 0x00, 0x04, 0x1B, 0x08, 0x00, 0x80, 0x00, 0x0A, 0x0C,
-    0x15, 0x00, 0x80, 0x00, 0x0B, 0x16, 0x00, 0x80, 0x00, 0x44, 0x73, 0x6A, 0x12, 0x77, 0x6A, 0x18,
-    0x7C, 0x6A, 0x00, 0x1A, 0x00, 0x80, 0x00, 0x0F, 0x00, 0x81, 0x67, 0x00, 0x06, 0x00, 0x80, 0x00,
-    0x04, 0x13, 0x00, 0x80, 0x00, 0x44, 0x95, 0x6A, 0x08, 0x99, 0x6A, 0x12, 0x9D, 0x6A, 0x15, 0xA1,
-    0x6A, 0x18, 0xA6, 0x6A, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x05, 0x00, 0x80, 0x00, 0x10, 0x00, 0x80,
-    0x00, 0x0C, 0x09, 0x00, 0x80, 0x00, 0x0D, 0x00, 0x80, 0x00, 0x12, 0x05, 0x04, 0x00, 0x80, 0x00,
-    0x11, 0x12, 0x0F, 0x00, 0x81, 0x67, 0x00, 0x45, 0xE5, 0x6A, 0x06, 0x21, 0x6B, 0x07, 0x60, 0x6F,
-    0x09, 0x9B, 0x6F, 0x0A, 0xB1, 0x6F, 0x0C, 0x43, 0x73, 0x0D, 0x4C, 0x73, 0x11, 0x7C, 0x73, 0x15,
-    0xDA, 0x73, 0x16, 0xF8, 0x73, 0x17, 0x29, 0x74, 0x18, 0x83, 0x75, 0x19, 0x9C, 0x75, 0x1B, 0xEC,
-    0x75, 0x1C, 0x27, 0x76, 0x00, 0x46, 0xF2, 0x6A, 0x0A, 0x01, 0x6B, 0x17, 0x07, 0x6B, 0x18, 0x18,
-    0x6B, 0x00, 0x18, 0x00, 0x50, 0xFB, 0x6A, 0x16, 0xFE, 0x6A, 0x00, 0x81, 0x68, 0x00, 0x81, 0x68,
-    0x00, 0x0C, 0x0B, 0x00, 0x81, 0x68, 0x00, 0x4C, 0x0E, 0x6B, 0x12, 0x13, 0x6B, 0x00, 0x1A, 0x00,
-    0x81, 0x68, 0x00, 0x05, 0x00, 0x81, 0x68, 0x00, 0x12, 0x15, 0x0B, 0x17, 0x00, 0x81, 0x67, 0x68,
-    0x00, 0x47, 0x4C, 0x6B, 0x0A, 0x73, 0x6B, 0x0B, 0x88, 0x6B, 0x0C, 0x91, 0x6B, 0x0D, 0xDD, 0x6C,
-    0x0E, 0xEE, 0x6C, 0x12, 0x03, 0x6D, 0x15, 0x18, 0x6D, 0x16, 0x20, 0x6D, 0x17, 0x3E, 0x6D, 0x18,
-    0x16, 0x6E, 0x19, 0xEB, 0x6E, 0x1B, 0x12, 0x6F, 0x1C, 0x39, 0x6F, 0x00, 0x4C, 0x56, 0x6B, 0x17,
-    0x5D, 0x6B, 0x18, 0x64, 0x6B, 0x00, 0x0B, 0x1A, 0x00, 0x82, 0x63, 0x68, 0x00, 0x0C, 0x05, 0x00,
-    0x82, 0x63, 0x68, 0x00, 0x50, 0x6B, 0x6B, 0x16, 0x6F, 0x6B, 0x00, 0x82, 0x63, 0x68, 0x00, 0x82,
-    0x63, 0x68, 0x00, 0x4C, 0x7A, 0x6B, 0x17, 0x81, 0x6B, 0x00, 0x05, 0x00, 0x82, 0x74, 0x63, 0x68,
-    0x00, 0x0C, 0x05, 0x00, 0x82, 0x63, 0x68, 0x00, 0x0C, 0x1A, 0x00, 0x83, 0x68, 0x69, 0x63, 0x68,
-    0x00, 0x45, 0xB3, 0x6B, 0x0A, 0xC7, 0x6B, 0x0B, 0xDB, 0x6B, 0x0D, 0x67, 0x6C, 0x0E, 0x7B, 0x6C,
-    0x11, 0x83, 0x6C, 0x12, 0x97, 0x6C, 0x17, 0x9F, 0x6C, 0x18, 0xA7, 0x6C, 0x1A, 0xC0, 0x6C, 0x1C,
-    0xC9, 0x6C, 0x00, 0x4B, 0xBA, 0x6B, 0x1A, 0xC1, 0x6B, 0x00, 0x1A, 0x00, 0x83, 0x69, 0x63, 0x68,
-    0x00, 0x83, 0x68, 0x69, 0x63, 0x68, 0x00, 0x4B, 0xCE, 0x6B, 0x1A, 0xD5, 0x6B, 0x00, 0x1A, 0x00,
-    0x83, 0x69, 0x63, 0x68, 0x00, 0x83, 0x68, 0x69, 0x63, 0x68, 0x00, 0x44, 0xFA, 0x6B, 0x05, 0x01,
-    0x6C, 0x08, 0x09, 0x6C, 0x0A, 0x10, 0x6C, 0x0D, 0x18, 0x6C, 0x11, 0x20, 0x6C, 0x14, 0x28, 0x6C,
-    0x16, 0x2F, 0x6C, 0x1A, 0x36, 0x6C, 0x1C, 0x5F, 0x6C, 0x00, 0x84, 0x77, 0x68, 0x69, 0x63, 0x68,
-    0x00, 0x1A, 0x00, 0x84, 0x68, 0x69, 0x63, 0x68, 0x00, 0x84, 0x77, 0x68, 0x69, 0x63, 0x68, 0x00,
-    0x1A, 0x00, 0x84, 0x68, 0x69, 0x63, 0x68, 0x00, 0x1A, 0x00, 0x84, 0x68, 0x69, 0x63, 0x68, 0x00,
-    0x1A, 0x00, 0x84, 0x68, 0x69, 0x63, 0x68, 0x00, 0x84, 0x77, 0x68, 0x69, 0x63, 0x68, 0x00, 0x84,
-    0x77, 0x68, 0x69, 0x63, 0x68, 0x00, 0x44, 0x43, 0x6C, 0x08, 0x4A, 0x6C, 0x14, 0x51, 0x6C, 0x16,
-    0x58, 0x6C, 0x00, 0x85, 0x77, 0x68, 0x69, 0x63, 0x68, 0x00, 0x85, 0x77, 0x68, 0x69, 0x63, 0x68,
-    0x00, 0x85, 0x77, 0x68, 0x69, 0x63, 0x68, 0x00, 0x85, 0x77, 0x68, 0x69, 0x63, 0x68, 0x00, 0x1A,
-    0x00, 0x84, 0x68, 0x69, 0x63, 0x68, 0x00, 0x4B, 0x6E, 0x6C, 0x1A, 0x75, 0x6C, 0x00, 0x1A, 0x00,
-    0x83, 0x69, 0x63, 0x68, 0x00, 0x83, 0x68, 0x69, 0x63, 0x68, 0x00, 0x0B, 0x1A, 0x00, 0x83, 0x69,
-    0x63, 0x68, 0x00, 0x4B, 0x8A, 0x6C, 0x1A, 0x91, 0x6C, 0x00, 0x1A, 0x00, 0x83, 0x69, 0x63, 0x68,
-    0x00, 0x83, 0x68, 0x69, 0x63, 0x68, 0x00, 0x0B, 0x1A, 0x00, 0x83, 0x69, 0x63, 0x68, 0x00, 0x05,
-    0x00, 0x83, 0x69, 0x74, 0x63, 0x68, 0x00, 0x4B, 0xB1, 0x6C, 0x10, 0xB8, 0x6C, 0x16, 0xBC, 0x6C,
-    0x00, 0x1A, 0x00, 0x83, 0x69, 0x63, 0x68, 0x00, 0x82, 0x63, 0x68, 0x00, 0x82, 0x63, 0x68, 0x00,
-    0x0B, 0x00, 0x84, 0x77, 0x68, 0x69, 0x63, 0x68, 0x00, 0x4B, 0xD0, 0x6C, 0x1A, 0xD7, 0x6C, 0x00,
-    0x1A, 0x00, 0x83, 0x69, 0x63, 0x68, 0x00, 0x83, 0x68, 0x69, 0x63, 0x68, 0x00, 0x18, 0x00, 0x50,
-    0xE6, 0x6C, 0x16, 0xEA, 0x6C, 0x00, 0x82, 0x63, 0x68, 0x00, 0x82, 0x63, 0x68, 0x00, 0x4B, 0xF5,
-    0x6C, 0x0C, 0xFC, 0x6C, 0x00, 0x1A, 0x00, 0x82, 0x69, 0x63, 0x68, 0x00, 0x0B, 0x1A, 0x00, 0x82,
-    0x63, 0x68, 0x00, 0x4B, 0x0A, 0x6D, 0x0C, 0x11, 0x6D, 0x00, 0x1A, 0x00, 0x82, 0x69, 0x63, 0x68,
-    0x00, 0x0B, 0x1A, 0x00, 0x82, 0x63, 0x68, 0x00, 0x17, 0x0C, 0x05, 0x00, 0x82, 0x63, 0x68, 0x00,
-    0x4C, 0x2A, 0x6D, 0x17, 0x31, 0x6D, 0x18, 0x38, 0x6D, 0x00, 0x0B, 0x1A, 0x00, 0x82, 0x63, 0x68,
-    0x00, 0x0C, 0x05, 0x00, 0x82, 0x63, 0x68, 0x00, 0x16, 0x00, 0x82, 0x63, 0x68, 0x00, 0x45, 0x57,
-    0x6D, 0x0A, 0x60, 0x6D, 0x0C, 0x68, 0x6D, 0x0E, 0xE2, 0x6D, 0x12, 0xF6, 0x6D, 0x15, 0xFE, 0x6D,
-    0x18, 0x06, 0x6E, 0x1C, 0x0E, 0x6E, 0x00, 0x0C, 0x00, 0x84, 0x62, 0x69, 0x74, 0x63, 0x68, 0x00,
-    0x0C, 0x05, 0x00, 0x83, 0x74, 0x63, 0x68, 0x00, 0x45, 0x81, 0x6D, 0x0A, 0xAA, 0x6D, 0x0B, 0xB1,
-    0x6D, 0x0E, 0xB9, 0x6D, 0x11, 0xC1, 0x6D, 0x12, 0xC9, 0x6D, 0x18, 0xD1, 0x6D, 0x19, 0xD9, 0x6D,
-    0x00, 0x4A, 0x8E, 0x6D, 0x0B, 0x95, 0x6D, 0x11, 0x9C, 0x6D, 0x19, 0xA3, 0x6D, 0x00, 0x85, 0x62,
-    0x69, 0x74, 0x63, 0x68, 0x00, 0x85, 0x62, 0x69, 0x74, 0x63, 0x68, 0x00, 0x85, 0x62, 0x69, 0x74,
-    0x63, 0x68, 0x00, 0x85, 0x62, 0x69, 0x74, 0x63, 0x68, 0x00, 0x84, 0x62, 0x69, 0x74, 0x63, 0x68,
-    0x00, 0x05, 0x00, 0x84, 0x69, 0x74, 0x63, 0x68, 0x00, 0x05, 0x00, 0x84, 0x69, 0x74, 0x63, 0x68,
-    0x00, 0x05, 0x00, 0x84, 0x69, 0x74, 0x63, 0x68, 0x00, 0x05, 0x00, 0x84, 0x69, 0x74, 0x63, 0x68,
-    0x00, 0x05, 0x00, 0x84, 0x69, 0x74, 0x63, 0x68, 0x00, 0x2C, 0x00, 0x84, 0x62, 0x69, 0x74, 0x63,
-    0x68, 0x00, 0x45, 0xE9, 0x6D, 0x0C, 0xEF, 0x6D, 0x00, 0x83, 0x69, 0x74, 0x63, 0x68, 0x00, 0x05,
-    0x00, 0x83, 0x74, 0x63, 0x68, 0x00, 0x0C, 0x05, 0x00, 0x83, 0x74, 0x63, 0x68, 0x00, 0x0C, 0x05,
-    0x00, 0x83, 0x74, 0x63, 0x68, 0x00, 0x0C, 0x05, 0x00, 0x83, 0x74, 0x63, 0x68, 0x00, 0x0C, 0x05,
-    0x00, 0x83, 0x74, 0x63, 0x68, 0x00, 0x44, 0x3B, 0x6E, 0x07, 0x42, 0x6E, 0x0B, 0x49, 0x6E, 0x0C,
-    0x50, 0x6E, 0x0D, 0x6A, 0x6E, 0x0E, 0x7B, 0x6E, 0x10, 0x82, 0x6E, 0x11, 0x9E, 0x6E, 0x16, 0xA5,
-    0x6E, 0x1A, 0xCC, 0x6E, 0x1B, 0xD3, 0x6E, 0x1C, 0xDA, 0x6E, 0x00, 0x16, 0x00, 0x83, 0x75, 0x63,
-    0x68, 0x00, 0x16, 0x00, 0x83, 0x75, 0x63, 0x68, 0x00, 0x1A, 0x00, 0x82, 0x69, 0x63, 0x68, 0x00,
-    0x4B, 0x5A, 0x6E, 0x10, 0x60, 0x6E, 0x16, 0x65, 0x6E, 0x00, 0x1A, 0x00, 0x82, 0x63, 0x68, 0x00,
-    0x83, 0x75, 0x63, 0x68, 0x00, 0x83, 0x75, 0x63, 0x68, 0x00, 0x50, 0x71, 0x6E, 0x16, 0x76, 0x6E,
-    0x00, 0x83, 0x75, 0x63, 0x68, 0x00, 0x83, 0x75, 0x63, 0x68, 0x00, 0x10, 0x00, 0x83, 0x75, 0x63,
-    0x68, 0x00, 0x4D, 0x8C, 0x6E, 0x0E, 0x92, 0x6E, 0x11, 0x98, 0x6E, 0x00, 0x84, 0x6D, 0x75, 0x63,
-    0x68, 0x00, 0x84, 0x6D, 0x75, 0x63, 0x68, 0x00, 0x84, 0x6D, 0x75, 0x63, 0x68, 0x00, 0x10, 0x00,
-    0x83, 0x75, 0x63, 0x68, 0x00, 0x47, 0xB2, 0x6E, 0x08, 0xB8, 0x6E, 0x1A, 0xC0, 0x6E, 0x1B, 0xC6,
-    0x6E, 0x00, 0x84, 0x73, 0x75, 0x63, 0x68, 0x00, 0x2C, 0x00, 0x84, 0x73, 0x75, 0x63, 0x68, 0x00,
-    0x84, 0x73, 0x75, 0x63, 0x68, 0x00, 0x84, 0x73, 0x75, 0x63, 0x68, 0x00, 0x16, 0x00, 0x83, 0x75,
-    0x63, 0x68, 0x00, 0x16, 0x00, 0x83, 0x75, 0x63, 0x68, 0x00, 0x50, 0xE1, 0x6E, 0x16, 0xE6, 0x6E,
-    0x00, 0x83, 0x75, 0x63, 0x68, 0x00, 0x83, 0x75, 0x63, 0x68, 0x00, 0x4C, 0xF5, 0x6E, 0x17, 0xFC,
-    0x6E, 0x18, 0x03, 0x6F, 0x00, 0x0B, 0x1A, 0x00, 0x82, 0x63, 0x68, 0x00, 0x0C, 0x05, 0x00, 0x82,
-    0x63, 0x68, 0x00, 0x50, 0x0A, 0x6F, 0x16, 0x0E, 0x6F, 0x00, 0x82, 0x63, 0x68, 0x00, 0x82, 0x63,
-    0x68, 0x00, 0x4C, 0x1C, 0x6F, 0x17, 0x23, 0x6F, 0x18, 0x2A, 0x6F, 0x00, 0x0B, 0x1A, 0x00, 0x82,
-    0x63, 0x68, 0x00, 0x0C, 0x05, 0x00, 0x82, 0x63, 0x68, 0x00, 0x50, 0x31, 0x6F, 0x16, 0x35, 0x6F,
-    0x00, 0x82, 0x63, 0x68, 0x00, 0x82, 0x63, 0x68, 0x00, 0x4C, 0x43, 0x6F, 0x17, 0x4A, 0x6F, 0x18,
-    0x51, 0x6F, 0x00, 0x05, 0x00, 0x82, 0x74, 0x63, 0x68, 0x00, 0x0C, 0x05, 0x00, 0x82, 0x63, 0x68,
-    0x00, 0x50, 0x58, 0x6F, 0x16, 0x5C, 0x6F, 0x00, 0x82, 0x63, 0x68, 0x00, 0x82, 0x63, 0x68, 0x00,
-    0x46, 0x6A, 0x6F, 0x0C, 0x8D, 0x6F, 0x17, 0x94, 0x6F, 0x00, 0x4C, 0x74, 0x6F, 0x17, 0x7A, 0x6F,
-    0x18, 0x80, 0x6F, 0x00, 0x0B, 0x1A, 0x00, 0x81, 0x68, 0x00, 0x0C, 0x05, 0x00, 0x81, 0x68, 0x00,
-    0x50, 0x87, 0x6F, 0x16, 0x8A, 0x6F, 0x00, 0x81, 0x68, 0x00, 0x81, 0x68, 0x00, 0x0B, 0x1A, 0x00,
-    0x81, 0x63, 0x68, 0x00, 0x0C, 0x05, 0x00, 0x81, 0x63, 0x68, 0x00, 0x4A, 0xA2, 0x6F, 0x18, 0xA8,
-    0x6F, 0x00, 0x0C, 0x0B, 0x00, 0x81, 0x68, 0x00, 0x12, 0x15, 0x0B, 0x17, 0x00, 0x81, 0x67, 0x68,
-    0x00, 0x45, 0xDC, 0x6F, 0x06, 0xF2, 0x6F, 0x09, 0x01, 0x70, 0x0A, 0x17, 0x70, 0x0B, 0x1D, 0x70,
-    0x0C, 0x24, 0x70, 0x0D, 0xBA, 0x70, 0x0E, 0xD3, 0x70, 0x11, 0xDA, 0x70, 0x12, 0xEB, 0x70, 0x17,
-    0x0D, 0x71, 0x18, 0x33, 0x71, 0x19, 0x14, 0x73, 0x1C, 0x2A, 0x73, 0x00, 0x4C, 0xE3, 0x6F, 0x18,
-    0xE9, 0x6F, 0x00, 0x0B, 0x00, 0x82, 0x67, 0x68, 0x00, 0x12, 0x15, 0x0B, 0x17, 0x00, 0x82, 0x67,
-    0x68, 0x00, 0x18, 0x00, 0x50, 0xFB, 0x6F, 0x16, 0xFE, 0x6F, 0x00, 0x81, 0x68, 0x00, 0x81, 0x68,
-    0x00, 0x4C, 0x08, 0x70, 0x18, 0x0E, 0x70, 0x00, 0x0B, 0x00, 0x82, 0x67, 0x68, 0x00, 0x12, 0x15,
-    0x0B, 0x17, 0x00, 0x82, 0x67, 0x68, 0x00, 0x0C, 0x0B, 0x00, 0x81, 0x68, 0x00, 0x0C, 0x0B, 0x00,
-    0x82, 0x67, 0x68, 0x00, 0x45, 0x3D, 0x70, 0x0A, 0x44, 0x70, 0x0B, 0x4B, 0x70, 0x0D, 0x7D, 0x70,
-    0x0E, 0x84, 0x70, 0x12, 0x8B, 0x70, 0x18, 0x9F, 0x70, 0x1C, 0xB3, 0x70, 0x00, 0x0B, 0x00, 0x83,
-    0x69, 0x67, 0x68, 0x00, 0x0B, 0x00, 0x83, 0x69, 0x67, 0x68, 0x00, 0x45, 0x5B, 0x70, 0x0A, 0x61,
-    0x70, 0x0D, 0x67, 0x70, 0x11, 0x6D, 0x70, 0x1C, 0x75, 0x70, 0x00, 0x84, 0x68, 0x69, 0x67, 0x68,
-    0x00, 0x84, 0x68, 0x69, 0x67, 0x68, 0x00, 0x84, 0x68, 0x69, 0x67, 0x68, 0x00, 0x2C, 0x00, 0x84,
-    0x68, 0x69, 0x67, 0x68, 0x00, 0x2C, 0x00, 0x84, 0x68, 0x69, 0x67, 0x68, 0x00, 0x0B, 0x00, 0x83,
-    0x69, 0x67, 0x68, 0x00, 0x0B, 0x00, 0x83, 0x69, 0x67, 0x68, 0x00, 0x4B, 0x92, 0x70, 0x15, 0x97,
-    0x70, 0x00, 0x83, 0x69, 0x67, 0x68, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x75, 0x67, 0x68, 0x00, 0x4B,
-    0xA6, 0x70, 0x12, 0xAB, 0x70, 0x00, 0x83, 0x69, 0x67, 0x68, 0x00, 0x15, 0x0B, 0x17, 0x00, 0x82,
-    0x67, 0x68, 0x00, 0x0B, 0x00, 0x83, 0x69, 0x67, 0x68, 0x00, 0x52, 0xC1, 0x70, 0x18, 0xCA, 0x70,
-    0x00, 0x15, 0x0B, 0x17, 0x00, 0x82, 0x75, 0x67, 0x68, 0x00, 0x12, 0x15, 0x0B, 0x17, 0x00, 0x82,
-    0x67, 0x68, 0x00, 0x0C, 0x0B, 0x00, 0x82, 0x67, 0x68, 0x00, 0x0C, 0x00, 0x48, 0xE3, 0x70, 0x12,
-    0xE7, 0x70, 0x00, 0x05, 0x00, 0x80, 0x00, 0x0A, 0x00, 0x80, 0x00, 0x4C, 0xF5, 0x70, 0x15, 0xFB,
-    0x70, 0x18, 0x03, 0x71, 0x00, 0x0B, 0x00, 0x82, 0x67, 0x68, 0x00, 0x0B, 0x17, 0x00, 0x81, 0x75,
-    0x67, 0x68, 0x00, 0x15, 0x0B, 0x17, 0x00, 0x83, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x4C, 0x17, 0x71,
-    0x12, 0x25, 0x71, 0x18, 0x2A, 0x71, 0x00, 0x4B, 0x1E, 0x71, 0x1A, 0x22, 0x71, 0x00, 0x82, 0x67,
-    0x68, 0x00, 0x81, 0x68, 0x00, 0x05, 0x00, 0x81, 0x68, 0x00, 0x12, 0x15, 0x0B, 0x17, 0x00, 0x82,
-    0x67, 0x68, 0x00, 0x4C, 0x49, 0x71, 0x0D, 0x69, 0x71, 0x0F, 0x73, 0x71, 0x12, 0x8C, 0x71, 0x13,
-    0xD8, 0x72, 0x15, 0xF1, 0x72, 0x1C, 0x0A, 0x73, 0x00, 0x4B, 0x53, 0x71, 0x12, 0x57, 0x71, 0x15,
-    0x60, 0x71, 0x00, 0x82, 0x67, 0x68, 0x00, 0x15, 0x0B, 0x17, 0x00, 0x83, 0x75, 0x67, 0x68, 0x00,
-    0x0B, 0x17, 0x00, 0x83, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x12, 0x15, 0x0B, 0x17, 0x00, 0x83, 0x75,
-    0x67, 0x68, 0x00, 0x52, 0x7A, 0x71, 0x15, 0x83, 0x71, 0x00, 0x15, 0x0B, 0x17, 0x00, 0x83, 0x75,
-    0x67, 0x68, 0x00, 0x0B, 0x17, 0x00, 0x83, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x48, 0xA5, 0x71, 0x09,
-    0xBE, 0x71, 0x0B, 0xD7, 0x71, 0x0C, 0xE2, 0x71, 0x0F, 0xEC, 0x71, 0x13, 0xF6, 0x71, 0x15, 0x00,
-    0x72, 0x17, 0xBF, 0x72, 0x00, 0x4B, 0xAC, 0x71, 0x15, 0xB5, 0x71, 0x00, 0x17, 0x00, 0x84, 0x72,
-    0x6F, 0x75, 0x67, 0x68, 0x00, 0x0B, 0x17, 0x00, 0x84, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x4B, 0xC5,
-    0x71, 0x15, 0xCE, 0x71, 0x00, 0x17, 0x00, 0x84, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x0B, 0x17,
-    0x00, 0x84, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x15, 0x17, 0x00, 0x85, 0x68, 0x72, 0x6F, 0x75, 0x67,
-    0x68, 0x00, 0x15, 0x0B, 0x17, 0x00, 0x84, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x15, 0x0B, 0x17, 0x00,
-    0x84, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x15, 0x0B, 0x17, 0x00, 0x84, 0x6F, 0x75, 0x67, 0x68, 0x00,
-    0x45, 0x1C, 0x72, 0x08, 0x34, 0x72, 0x09, 0x3E, 0x72, 0x0A, 0x48, 0x72, 0x0B, 0x60, 0x72, 0x0D,
-    0x6B, 0x72, 0x11, 0x83, 0x72, 0x17, 0x9B, 0x72, 0x1C, 0xA7, 0x72, 0x00, 0x4B, 0x23, 0x72, 0x17,
-    0x2C, 0x72, 0x00, 0x17, 0x00, 0x85, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x85, 0x68, 0x72, 0x6F,
-    0x75, 0x67, 0x68, 0x00, 0x0B, 0x17, 0x00, 0x85, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x0B, 0x17,
-    0x00, 0x85, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x4B, 0x4F, 0x72, 0x17, 0x58, 0x72, 0x00, 0x17,
-    0x00, 0x85, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x85, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x00,
-    0x2C, 0x00, 0x85, 0x74, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x4B, 0x72, 0x72, 0x17, 0x7B,
-    0x72, 0x00, 0x17, 0x00, 0x85, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x85, 0x68, 0x72, 0x6F, 0x75,
-    0x67, 0x68, 0x00, 0x4B, 0x8A, 0x72, 0x17, 0x93, 0x72, 0x00, 0x17, 0x00, 0x85, 0x72, 0x6F, 0x75,
-    0x67, 0x68, 0x00, 0x85, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x0B, 0x2C, 0x00, 0x86, 0x74,
-    0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x4B, 0xAE, 0x72, 0x17, 0xB7, 0x72, 0x00, 0x17, 0x00,
-    0x85, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x85, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x4B,
-    0xC6, 0x72, 0x15, 0xCF, 0x72, 0x00, 0x17, 0x00, 0x84, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x0B,
-    0x17, 0x00, 0x84, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x52, 0xDF, 0x72, 0x15, 0xE8, 0x72, 0x00, 0x15,
-    0x0B, 0x17, 0x00, 0x83, 0x75, 0x67, 0x68, 0x00, 0x0B, 0x17, 0x00, 0x83, 0x6F, 0x75, 0x67, 0x68,
-    0x00, 0x4B, 0xF8, 0x72, 0x12, 0x00, 0x73, 0x00, 0x17, 0x00, 0x82, 0x6F, 0x75, 0x67, 0x68, 0x00,
-    0x0B, 0x17, 0x00, 0x84, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x12, 0x15, 0x0B, 0x17, 0x00, 0x83,
-    0x75, 0x67, 0x68, 0x00, 0x4C, 0x1B, 0x73, 0x18, 0x21, 0x73, 0x00, 0x0B, 0x00, 0x82, 0x67, 0x68,
-    0x00, 0x12, 0x15, 0x0B, 0x17, 0x00, 0x82, 0x67, 0x68, 0x00, 0x52, 0x31, 0x73, 0x18, 0x3A, 0x73,
-    0x00, 0x15, 0x0B, 0x17, 0x00, 0x82, 0x75, 0x67, 0x68, 0x00, 0x12, 0x15, 0x0B, 0x17, 0x00, 0x82,
-    0x67, 0x68, 0x00, 0x06, 0x0B, 0x1A, 0x00, 0x82, 0x69, 0x63, 0x68, 0x00, 0x46, 0x56, 0x73, 0x0A,
-    0x65, 0x73, 0x17, 0x6B, 0x73, 0x00, 0x18, 0x00, 0x50, 0x5F, 0x73, 0x16, 0x62, 0x73, 0x00, 0x81,
-    0x68, 0x00, 0x81, 0x68, 0x00, 0x0C, 0x0B, 0x00, 0x81, 0x68, 0x00, 0x4C, 0x72, 0x73, 0x12, 0x77,
-    0x73, 0x00, 0x1A, 0x00, 0x81, 0x68, 0x00, 0x05, 0x00, 0x81, 0x68, 0x00, 0x44, 0x8F, 0x73, 0x06,
-    0x94, 0x73, 0x08, 0xA3, 0x73, 0x0A, 0xB2, 0x73, 0x0C, 0xB8, 0x73, 0x17, 0xC9, 0x73, 0x00, 0x0B,
-    0x17, 0x00, 0x80, 0x00, 0x18, 0x00, 0x50, 0x9D, 0x73, 0x16, 0xA0, 0x73, 0x00, 0x81, 0x68, 0x00,
-    0x81, 0x68, 0x00, 0x48, 0xAA, 0x73, 0x0B, 0xAE, 0x73, 0x00, 0x05, 0x00, 0x80, 0x00, 0x1A, 0x00,
-    0x80, 0x00, 0x0C, 0x0B, 0x00, 0x81, 0x68, 0x00, 0x48, 0xBF, 0x73, 0x12, 0xC4, 0x73, 0x00, 0x05,
-    0x00, 0x80, 0x67, 0x00, 0x0A, 0x00, 0x80, 0x67, 0x00, 0x4C, 0xD0, 0x73, 0x12, 0xD5, 0x73, 0x00,
-    0x1A, 0x00, 0x81, 0x68, 0x00, 0x05, 0x00, 0x81, 0x68, 0x00, 0x48, 0xE1, 0x73, 0x17, 0xE7, 0x73,
-    0x00, 0x19, 0x08, 0x00, 0x80, 0x79, 0x00, 0x4C, 0xEE, 0x73, 0x12, 0xF3, 0x73, 0x00, 0x1A, 0x00,
-    0x81, 0x68, 0x00, 0x05, 0x00, 0x81, 0x68, 0x00, 0x46, 0xFF, 0x73, 0x17, 0x22, 0x74, 0x00, 0x4C,
-    0x09, 0x74, 0x17, 0x0F, 0x74, 0x18, 0x15, 0x74, 0x00, 0x0B, 0x1A, 0x00, 0x81, 0x68, 0x00, 0x0C,
-    0x05, 0x00, 0x81, 0x68, 0x00, 0x50, 0x1C, 0x74, 0x16, 0x1F, 0x74, 0x00, 0x81, 0x68, 0x00, 0x81,
-    0x68, 0x00, 0x0C, 0x05, 0x00, 0x81, 0x63, 0x68, 0x00, 0x46, 0x45, 0x74, 0x0A, 0x4D, 0x74, 0x0C,
-    0x6F, 0x74, 0x0E, 0xD7, 0x74, 0x12, 0xDE, 0x74, 0x13, 0x4D, 0x75, 0x15, 0x54, 0x75, 0x18, 0x5B,
-    0x75, 0x1C, 0x70, 0x75, 0x00, 0x0C, 0x05, 0x00, 0x82, 0x74, 0x63, 0x68, 0x00, 0x4C, 0x54, 0x74,
-    0x12, 0x69, 0x74, 0x00, 0x4B, 0x5E, 0x74, 0x15, 0x61, 0x74, 0x1A, 0x65, 0x74, 0x00, 0x81, 0x68,
-    0x00, 0x81, 0x68, 0x74, 0x00, 0x82, 0x74, 0x68, 0x00, 0x05, 0x00, 0x82, 0x74, 0x68, 0x00, 0x44,
-    0x88, 0x74, 0x08, 0x8F, 0x74, 0x0E, 0x96, 0x74, 0x12, 0x9D, 0x74, 0x14, 0xAD, 0x74, 0x16, 0xB4,
-    0x74, 0x18, 0xBB, 0x74, 0x1A, 0xC2, 0x74, 0x00, 0x1A, 0x00, 0x83, 0x69, 0x74, 0x68, 0x00, 0x1A,
-    0x00, 0x83, 0x69, 0x74, 0x68, 0x00, 0x1A, 0x00, 0x83, 0x69, 0x74, 0x68, 0x00, 0x45, 0xA4, 0x74,
-    0x1A, 0xA8, 0x74, 0x00, 0x82, 0x74, 0x68, 0x00, 0x83, 0x69, 0x74, 0x68, 0x00, 0x1A, 0x00, 0x83,
-    0x69, 0x74, 0x68, 0x00, 0x1A, 0x00, 0x83, 0x69, 0x74, 0x68, 0x00, 0x1A, 0x00, 0x83, 0x69, 0x74,
-    0x68, 0x00, 0x48, 0xC9, 0x74, 0x14, 0xD1, 0x74, 0x00, 0x2C, 0x00, 0x84, 0x77, 0x69, 0x74, 0x68,
-    0x00, 0x84, 0x77, 0x69, 0x74, 0x68, 0x00, 0x0C, 0x1A, 0x00, 0x82, 0x74, 0x68, 0x00, 0x45, 0xF7,
-    0x74, 0x0A, 0x13, 0x75, 0x0B, 0x1A, 0x75, 0x0C, 0x21, 0x75, 0x0F, 0x31, 0x75, 0x11, 0x38, 0x75,
-    0x13, 0x3F, 0x75, 0x19, 0x46, 0x75, 0x00, 0x4A, 0x01, 0x75, 0x0B, 0x07, 0x75, 0x19, 0x0D, 0x75,
-    0x00, 0x84, 0x62, 0x6F, 0x74, 0x68, 0x00, 0x84, 0x62, 0x6F, 0x74, 0x68, 0x00, 0x84, 0x62, 0x6F,
-    0x74, 0x68, 0x00, 0x05, 0x00, 0x83, 0x6F, 0x74, 0x68, 0x00, 0x05, 0x00, 0x83, 0x6F, 0x74, 0x68,
-    0x00, 0x45, 0x28, 0x75, 0x1A, 0x2D, 0x75, 0x00, 0x83, 0x6F, 0x74, 0x68, 0x00, 0x82, 0x74, 0x68,
-    0x00, 0x05, 0x00, 0x83, 0x6F, 0x74, 0x68, 0x00, 0x05, 0x00, 0x83, 0x6F, 0x74, 0x68, 0x00, 0x05,
-    0x00, 0x83, 0x6F, 0x74, 0x68, 0x00, 0x05, 0x00, 0x83, 0x6F, 0x74, 0x68, 0x00, 0x12, 0x05, 0x00,
-    0x82, 0x74, 0x68, 0x00, 0x0C, 0x1A, 0x00, 0x82, 0x74, 0x68, 0x00, 0x4C, 0x62, 0x75, 0x12, 0x68,
-    0x75, 0x00, 0x1A, 0x00, 0x82, 0x74, 0x68, 0x00, 0x15, 0x0B, 0x17, 0x00, 0x81, 0x67, 0x68, 0x00,
-    0x4C, 0x77, 0x75, 0x12, 0x7D, 0x75, 0x00, 0x1A, 0x00, 0x82, 0x74, 0x68, 0x00, 0x05, 0x00, 0x82,
-    0x74, 0x68, 0x00, 0x4A, 0x8A, 0x75, 0x12, 0x94, 0x75, 0x00, 0x12, 0x15, 0x0B, 0x17, 0x00, 0x82,
-    0x75, 0x67, 0x68, 0x00, 0x15, 0x0B, 0x17, 0x00, 0x80, 0x67, 0x68, 0x00, 0x46, 0xAC, 0x75, 0x0A,
-    0xCF, 0x75, 0x0C, 0xD5, 0x75, 0x17, 0xDC, 0x75, 0x18, 0xE3, 0x75, 0x00, 0x4C, 0xB6, 0x75, 0x17,
-    0xBC, 0x75, 0x18, 0xC2, 0x75, 0x00, 0x0B, 0x1A, 0x00, 0x81, 0x68, 0x00, 0x0C, 0x05, 0x00, 0x81,
-    0x68, 0x00, 0x50, 0xC9, 0x75, 0x16, 0xCC, 0x75, 0x00, 0x81, 0x68, 0x00, 0x81, 0x68, 0x00, 0x0C,
-    0x0B, 0x00, 0x81, 0x68, 0x00, 0x0B, 0x1A, 0x00, 0x81, 0x63, 0x68, 0x00, 0x0C, 0x05, 0x00, 0x81,
-    0x63, 0x68, 0x00, 0x12, 0x15, 0x0B, 0x17, 0x00, 0x81, 0x67, 0x68, 0x00, 0x46, 0xF6, 0x75, 0x0C,
-    0x19, 0x76, 0x17, 0x20, 0x76, 0x00, 0x4C, 0x00, 0x76, 0x17, 0x06, 0x76, 0x18, 0x0C, 0x76, 0x00,
-    0x0B, 0x1A, 0x00, 0x81, 0x68, 0x00, 0x0C, 0x05, 0x00, 0x81, 0x68, 0x00, 0x50, 0x13, 0x76, 0x16,
-    0x16, 0x76, 0x00, 0x81, 0x68, 0x00, 0x81, 0x68, 0x00, 0x0B, 0x1A, 0x00, 0x81, 0x63, 0x68, 0x00,
-    0x0C, 0x05, 0x00, 0x81, 0x63, 0x68, 0x00, 0x46, 0x3A, 0x76, 0x08, 0x49, 0x76, 0x0A, 0x4E, 0x76,
-    0x0F, 0x54, 0x76, 0x11, 0x59, 0x76, 0x17, 0x5E, 0x76, 0x00, 0x18, 0x00, 0x50, 0x43, 0x76, 0x16,
-    0x46, 0x76, 0x00, 0x81, 0x68, 0x00, 0x81, 0x68, 0x00, 0x0B, 0x17, 0x00, 0x80, 0x00, 0x0C, 0x0B,
-    0x00, 0x81, 0x68, 0x00, 0x11, 0x12, 0x00, 0x80, 0x00, 0x04, 0x10, 0x00, 0x80, 0x00, 0x4C, 0x65,
-    0x76, 0x12, 0x6A, 0x76, 0x00, 0x1A, 0x00, 0x81, 0x68, 0x00, 0x05, 0x00, 0x81, 0x68, 0x00, 0x11,
-    0x0C, 0x0B, 0x17, 0x2C, 0x00, 0x80, 0x6B, 0x00, 0x46, 0x88, 0x76, 0x0B, 0x9B, 0x76, 0x0E, 0xD0,
-    0x76, 0x10, 0x03, 0x77, 0x11, 0x14, 0x77, 0x00, 0x4C, 0x8F, 0x76, 0x17, 0x95, 0x76, 0x00, 0x0B,
-    0x1A, 0x00, 0x80, 0x68, 0x00, 0x0C, 0x05, 0x00, 0x80, 0x68, 0x00, 0x46, 0xA2, 0x76, 0x17, 0xC1,
-    0x76, 0x00, 0x4C, 0xAC, 0x76, 0x17, 0xB1, 0x76, 0x18, 0xB6, 0x76, 0x00, 0x0B, 0x1A, 0x00, 0x80,
-    0x00, 0x0C, 0x05, 0x00, 0x80, 0x00, 0x50, 0xBD, 0x76, 0x16, 0xBF, 0x76, 0x00, 0x80, 0x00, 0x80,
-    0x00, 0x4C, 0xC8, 0x76, 0x12, 0xCC, 0x76, 0x00, 0x1A, 0x00, 0x80, 0x00, 0x05, 0x00, 0x80, 0x00,
-    0x46, 0xDD, 0x76, 0x11, 0xF3, 0x76, 0x12, 0xF9, 0x76, 0x15, 0xFE, 0x76, 0x00, 0x4C, 0xE7, 0x76,
-    0x12, 0xEB, 0x76, 0x18, 0xEF, 0x76, 0x00, 0x07, 0x00, 0x80, 0x00, 0x06, 0x00, 0x80, 0x00, 0x09,
-    0x00, 0x80, 0x00, 0x0C, 0x0B, 0x17, 0x00, 0x80, 0x00, 0x12, 0x0F, 0x00, 0x80, 0x00, 0x12, 0x1A,
-    0x00, 0x80, 0x00, 0x48, 0x0A, 0x77, 0x12, 0x0F, 0x77, 0x00, 0x0B, 0x17, 0x00, 0x80, 0x00, 0x15,
-    0x09, 0x00, 0x80, 0x00, 0x44, 0x21, 0x77, 0x08, 0x26, 0x77, 0x0C, 0x43, 0x77, 0x1A, 0x49, 0x77,
-    0x00, 0x0B, 0x17, 0x00, 0x80, 0x00, 0x48, 0x30, 0x77, 0x0B, 0x34, 0x77, 0x19, 0x3F, 0x77, 0x00,
-    0x05, 0x00, 0x80, 0x00, 0x57, 0x3B, 0x77, 0x1A, 0x3D, 0x77, 0x00, 0x80, 0x00, 0x80, 0x00, 0x08,
-    0x00, 0x80, 0x00, 0x0B, 0x17, 0x00, 0x80, 0x6B, 0x00, 0x12, 0x07, 0x00, 0x80, 0x00, 0x45, 0x88,
-    0x77, 0x06, 0x9D, 0x77, 0x07, 0x90, 0x7A, 0x08, 0xB3, 0x7A, 0x09, 0xBA, 0x7A, 0x0B, 0xC1, 0x7A,
-    0x0C, 0xD6, 0x7A, 0x0D, 0x18, 0x7B, 0x0F, 0x59, 0x7B, 0x10, 0xB4, 0x7B, 0x11, 0xD9, 0x7B, 0x12,
-    0x59, 0x7D, 0x13, 0xB8, 0x7D, 0x15, 0xBF, 0x7D, 0x16, 0x69, 0x7E, 0x17, 0x8C, 0x7E, 0x19, 0x93,
-    0x7E, 0x1B, 0xB6, 0x7E, 0x1C, 0xD9, 0x7E, 0x00, 0x4C, 0x8F, 0x77, 0x11, 0x96, 0x77, 0x00, 0x0B,
-    0x17, 0x00, 0x81, 0x6E, 0x6B, 0x00, 0x0C, 0x0B, 0x17, 0x00, 0x81, 0x6B, 0x00, 0x44, 0xCE, 0x77,
-    0x07, 0x4D, 0x78, 0x0C, 0x72, 0x78, 0x0D, 0x09, 0x79, 0x0E, 0x10, 0x79, 0x0F, 0x17, 0x79, 0x12,
-    0x1E, 0x79, 0x13, 0x7C, 0x79, 0x14, 0x83, 0x79, 0x16, 0x8A, 0x79, 0x18, 0xAF, 0x79, 0x19, 0x31,
-    0x7A, 0x1A, 0x56, 0x7A, 0x1B, 0x5D, 0x7A, 0x1C, 0x82, 0x7A, 0x1D, 0x89, 0x7A, 0x00, 0x45, 0xEA,
-    0x77, 0x0A, 0x15, 0x78, 0x0B, 0x1C, 0x78, 0x11, 0x23, 0x78, 0x14, 0x2A, 0x78, 0x16, 0x31, 0x78,
-    0x19, 0x38, 0x78, 0x1A, 0x3F, 0x78, 0x1D, 0x46, 0x78, 0x00, 0x4A, 0xF7, 0x77, 0x0B, 0xFF, 0x77,
-    0x11, 0x07, 0x78, 0x19, 0x0F, 0x78, 0x00, 0x2C, 0x00, 0x84, 0x62, 0x61, 0x63, 0x6B, 0x00, 0x2C,
-    0x00, 0x84, 0x62, 0x61, 0x63, 0x6B, 0x00, 0x2C, 0x00, 0x84, 0x62, 0x61, 0x63, 0x6B, 0x00, 0x84,
-    0x62, 0x61, 0x63, 0x6B, 0x00, 0x05, 0x00, 0x83, 0x61, 0x63, 0x6B, 0x00, 0x05, 0x00, 0x83, 0x61,
-    0x63, 0x6B, 0x00, 0x05, 0x00, 0x83, 0x61, 0x63, 0x6B, 0x00, 0x05, 0x00, 0x83, 0x61, 0x63, 0x6B,
-    0x00, 0x05, 0x00, 0x83, 0x61, 0x63, 0x6B, 0x00, 0x05, 0x00, 0x83, 0x61, 0x63, 0x6B, 0x00, 0x05,
-    0x00, 0x83, 0x61, 0x63, 0x6B, 0x00, 0x05, 0x00, 0x83, 0x61, 0x63, 0x6B, 0x00, 0x44, 0x5A, 0x78,
-    0x0C, 0x60, 0x78, 0x12, 0x66, 0x78, 0x18, 0x6C, 0x78, 0x00, 0x05, 0x00, 0x82, 0x63, 0x6B, 0x00,
-    0x07, 0x00, 0x82, 0x63, 0x6B, 0x00, 0x06, 0x00, 0x82, 0x63, 0x6B, 0x00, 0x09, 0x00, 0x82, 0x63,
-    0x6B, 0x00, 0x46, 0x8E, 0x78, 0x07, 0x95, 0x78, 0x08, 0xC5, 0x78, 0x09, 0xCC, 0x78, 0x0E, 0xD3,
-    0x78, 0x12, 0xDA, 0x78, 0x16, 0xEA, 0x78, 0x18, 0xF2, 0x78, 0x1B, 0x02, 0x79, 0x00, 0x07, 0x00,
-    0x83, 0x69, 0x63, 0x6B, 0x00, 0x46, 0xA5, 0x78, 0x08, 0xAB, 0x78, 0x09, 0xB3, 0x78, 0x16, 0xB9,
-    0x78, 0x1B, 0xBF, 0x78, 0x00, 0x84, 0x64, 0x69, 0x63, 0x6B, 0x00, 0x2C, 0x00, 0x84, 0x64, 0x69,
-    0x63, 0x6B, 0x00, 0x84, 0x64, 0x69, 0x63, 0x6B, 0x00, 0x84, 0x64, 0x69, 0x63, 0x6B, 0x00, 0x84,
-    0x64, 0x69, 0x63, 0x6B, 0x00, 0x07, 0x00, 0x83, 0x69, 0x63, 0x6B, 0x00, 0x07, 0x00, 0x83, 0x69,
-    0x63, 0x6B, 0x00, 0x07, 0x00, 0x83, 0x69, 0x63, 0x6B, 0x00, 0x46, 0xE1, 0x78, 0x07, 0xE5, 0x78,
-    0x00, 0x82, 0x63, 0x6B, 0x00, 0x83, 0x69, 0x63, 0x6B, 0x00, 0x07, 0x2C, 0x00, 0x83, 0x69, 0x63,
-    0x6B, 0x00, 0x47, 0xF9, 0x78, 0x09, 0xFE, 0x78, 0x00, 0x83, 0x69, 0x63, 0x6B, 0x00, 0x82, 0x63,
-    0x6B, 0x00, 0x07, 0x00, 0x83, 0x69, 0x63, 0x6B, 0x00, 0x18, 0x09, 0x00, 0x82, 0x63, 0x6B, 0x00,
-    0x0C, 0x07, 0x00, 0x82, 0x63, 0x6B, 0x00, 0x12, 0x06, 0x00, 0x82, 0x63, 0x6B, 0x00, 0x46, 0x34,
-    0x79, 0x07, 0x49, 0x79, 0x0C, 0x50, 0x79, 0x13, 0x60, 0x79, 0x16, 0x67, 0x79, 0x19, 0x6E, 0x79,
-    0x1B, 0x75, 0x79, 0x00, 0x47, 0x3B, 0x79, 0x1B, 0x43, 0x79, 0x00, 0x2C, 0x00, 0x84, 0x63, 0x6F,
-    0x63, 0x6B, 0x00, 0x84, 0x63, 0x6F, 0x63, 0x6B, 0x00, 0x06, 0x00, 0x83, 0x6F, 0x63, 0x6B, 0x00,
-    0x46, 0x57, 0x79, 0x07, 0x5C, 0x79, 0x00, 0x83, 0x6F, 0x63, 0x6B, 0x00, 0x82, 0x63, 0x6B, 0x00,
-    0x06, 0x00, 0x83, 0x6F, 0x63, 0x6B, 0x00, 0x06, 0x00, 0x83, 0x6F, 0x63, 0x6B, 0x00, 0x06, 0x00,
-    0x83, 0x6F, 0x63, 0x6B, 0x00, 0x06, 0x00, 0x83, 0x6F, 0x63, 0x6B, 0x00, 0x12, 0x06, 0x00, 0x82,
-    0x63, 0x6B, 0x00, 0x04, 0x05, 0x00, 0x82, 0x63, 0x6B, 0x00, 0x44, 0x97, 0x79, 0x0C, 0x9D, 0x79,
-    0x12, 0xA3, 0x79, 0x18, 0xA9, 0x79, 0x00, 0x05, 0x00, 0x82, 0x63, 0x6B, 0x00, 0x07, 0x00, 0x82,
-    0x63, 0x6B, 0x00, 0x06, 0x00, 0x82, 0x63, 0x6B, 0x00, 0x09, 0x00, 0x82, 0x63, 0x6B, 0x00, 0x46,
-    0xCB, 0x79, 0x07, 0xD2, 0x79, 0x09, 0xD9, 0x79, 0x0A, 0xFE, 0x79, 0x0C, 0x05, 0x7A, 0x0D, 0x15,
-    0x7A, 0x15, 0x1C, 0x7A, 0x19, 0x23, 0x7A, 0x1C, 0x2A, 0x7A, 0x00, 0x09, 0x00, 0x83, 0x75, 0x63,
-    0x6B, 0x00, 0x09, 0x00, 0x83, 0x75, 0x63, 0x6B, 0x00, 0x46, 0xE6, 0x79, 0x07, 0xEC, 0x79, 0x0A,
-    0xF2, 0x79, 0x19, 0xF8, 0x79, 0x00, 0x84, 0x66, 0x75, 0x63, 0x6B, 0x00, 0x84, 0x66, 0x75, 0x63,
-    0x6B, 0x00, 0x84, 0x66, 0x75, 0x63, 0x6B, 0x00, 0x84, 0x66, 0x75, 0x63, 0x6B, 0x00, 0x09, 0x00,
-    0x83, 0x75, 0x63, 0x6B, 0x00, 0x47, 0x0C, 0x7A, 0x09, 0x10, 0x7A, 0x00, 0x82, 0x63, 0x6B, 0x00,
-    0x83, 0x75, 0x63, 0x6B, 0x00, 0x09, 0x00, 0x83, 0x75, 0x63, 0x6B, 0x00, 0x09, 0x00, 0x83, 0x75,
-    0x63, 0x6B, 0x00, 0x09, 0x00, 0x83, 0x75, 0x63, 0x6B, 0x00, 0x09, 0x00, 0x83, 0x75, 0x63, 0x6B,
-    0x00, 0x44, 0x3E, 0x7A, 0x0C, 0x44, 0x7A, 0x12, 0x4A, 0x7A, 0x18, 0x50, 0x7A, 0x00, 0x05, 0x00,
-    0x82, 0x63, 0x6B, 0x00, 0x07, 0x00, 0x82, 0x63, 0x6B, 0x00, 0x06, 0x00, 0x82, 0x63, 0x6B, 0x00,
-    0x09, 0x00, 0x82, 0x63, 0x6B, 0x00, 0x04, 0x05, 0x00, 0x82, 0x63, 0x6B, 0x00, 0x44, 0x6A, 0x7A,
-    0x0C, 0x70, 0x7A, 0x12, 0x76, 0x7A, 0x18, 0x7C, 0x7A, 0x00, 0x05, 0x00, 0x82, 0x63, 0x6B, 0x00,
-    0x07, 0x00, 0x82, 0x63, 0x6B, 0x00, 0x06, 0x00, 0x82, 0x63, 0x6B, 0x00, 0x09, 0x00, 0x82, 0x63,
-    0x6B, 0x00, 0x18, 0x09, 0x00, 0x82, 0x63, 0x6B, 0x00, 0x04, 0x05, 0x00, 0x82, 0x63, 0x6B, 0x00,
-    0x06, 0x00, 0x44, 0x9F, 0x7A, 0x0C, 0xA4, 0x7A, 0x12, 0xA9, 0x7A, 0x18, 0xAE, 0x7A, 0x00, 0x05,
-    0x00, 0x81, 0x6B, 0x00, 0x07, 0x00, 0x81, 0x6B, 0x00, 0x06, 0x00, 0x81, 0x6B, 0x00, 0x09, 0x00,
-    0x81, 0x6B, 0x00, 0x15, 0x12, 0x1A, 0x00, 0x81, 0x6B, 0x00, 0x15, 0x12, 0x1A, 0x00, 0x81, 0x6B,
-    0x00, 0x4C, 0xC8, 0x7A, 0x11, 0xCF, 0x7A, 0x00, 0x0B, 0x17, 0x00, 0x81, 0x6E, 0x6B, 0x00, 0x0C,
-    0x0B, 0x17, 0x00, 0x81, 0x6B, 0x00, 0x46, 0xE3, 0x7A, 0x11, 0x04, 0x7B, 0x12, 0x0C, 0x7B, 0x15,
-    0x12, 0x7B, 0x00, 0x44, 0xF0, 0x7A, 0x0C, 0xF5, 0x7A, 0x12, 0xFA, 0x7A, 0x18, 0xFF, 0x7A, 0x00,
-    0x05, 0x00, 0x81, 0x6B, 0x00, 0x07, 0x00, 0x81, 0x6B, 0x00, 0x06, 0x00, 0x81, 0x6B, 0x00, 0x09,
-    0x00, 0x81, 0x6B, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x69, 0x6E, 0x6B, 0x00, 0x12, 0x0F, 0x00, 0x81,
-    0x6B, 0x00, 0x12, 0x1A, 0x00, 0x81, 0x6B, 0x00, 0x46, 0x25, 0x7B, 0x0C, 0x46, 0x7B, 0x12, 0x4D,
-    0x7B, 0x15, 0x53, 0x7B, 0x00, 0x44, 0x32, 0x7B, 0x0C, 0x37, 0x7B, 0x12, 0x3C, 0x7B, 0x18, 0x41,
-    0x7B, 0x00, 0x05, 0x00, 0x81, 0x6B, 0x00, 0x07, 0x00, 0x81, 0x6B, 0x00, 0x06, 0x00, 0x81, 0x6B,
-    0x00, 0x09, 0x00, 0x81, 0x6B, 0x00, 0x0B, 0x17, 0x00, 0x81, 0x6E, 0x6B, 0x00, 0x12, 0x0F, 0x00,
-    0x81, 0x6B, 0x00, 0x12, 0x1A, 0x00, 0x81, 0x6B, 0x00, 0x46, 0x6C, 0x7B, 0x0C, 0x8D, 0x7B, 0x0F,
-    0x93, 0x7B, 0x12, 0xA2, 0x7B, 0x15, 0xA8, 0x7B, 0x1C, 0xAE, 0x7B, 0x00, 0x44, 0x79, 0x7B, 0x0C,
-    0x7E, 0x7B, 0x12, 0x83, 0x7B, 0x18, 0x88, 0x7B, 0x00, 0x05, 0x00, 0x81, 0x6B, 0x00, 0x07, 0x00,
-    0x81, 0x6B, 0x00, 0x06, 0x00, 0x81, 0x6B, 0x00, 0x09, 0x00, 0x81, 0x6B, 0x00, 0x17, 0x16, 0x00,
-    0x80, 0x6C, 0x00, 0x0C, 0x00, 0x57, 0x9C, 0x7B, 0x1A, 0xA0, 0x7B, 0x00, 0x16, 0x00, 0x80, 0x00,
-    0x80, 0x00, 0x12, 0x0F, 0x00, 0x81, 0x6B, 0x00, 0x12, 0x1A, 0x00, 0x81, 0x6B, 0x00, 0x11, 0x0C,
-    0x19, 0x00, 0x80, 0x00, 0x48, 0xC1, 0x7B, 0x0C, 0xC6, 0x7B, 0x11, 0xCD, 0x7B, 0x12, 0xD4, 0x7B,
-    0x00, 0x0B, 0x17, 0x00, 0x80, 0x00, 0x0B, 0x17, 0x00, 0x81, 0x6E, 0x6B, 0x00, 0x0C, 0x0B, 0x17,
-    0x00, 0x81, 0x6B, 0x00, 0x15, 0x09, 0x00, 0x80, 0x00, 0x45, 0xF2, 0x7B, 0x0B, 0xFA, 0x7B, 0x0C,
-    0x0F, 0x7C, 0x0D, 0x17, 0x7D, 0x0E, 0x1F, 0x7D, 0x10, 0x27, 0x7D, 0x12, 0x2F, 0x7D, 0x18, 0x44,
-    0x7D, 0x00, 0x0C, 0x0B, 0x17, 0x00, 0x82, 0x6E, 0x6B, 0x00, 0x0C, 0x00, 0x4B, 0x03, 0x7C, 0x17,
-    0x09, 0x7C, 0x00, 0x17, 0x00, 0x82, 0x6E, 0x6B, 0x00, 0x83, 0x68, 0x69, 0x6E, 0x6B, 0x00, 0x45,
-    0x2E, 0x7C, 0x0A, 0x42, 0x7C, 0x0B, 0x56, 0x7C, 0x0D, 0xBA, 0x7C, 0x0E, 0xCE, 0x7C, 0x11, 0xD6,
-    0x7C, 0x12, 0xEA, 0x7C, 0x17, 0xF2, 0x7C, 0x18, 0xFB, 0x7C, 0x1C, 0x03, 0x7D, 0x00, 0x4B, 0x35,
-    0x7C, 0x17, 0x3C, 0x7C, 0x00, 0x17, 0x00, 0x83, 0x69, 0x6E, 0x6B, 0x00, 0x83, 0x68, 0x69, 0x6E,
-    0x6B, 0x00, 0x4B, 0x49, 0x7C, 0x17, 0x50, 0x7C, 0x00, 0x17, 0x00, 0x83, 0x69, 0x6E, 0x6B, 0x00,
-    0x83, 0x68, 0x69, 0x6E, 0x6B, 0x00, 0x45, 0x6C, 0x7C, 0x0A, 0x74, 0x7C, 0x0D, 0x7B, 0x7C, 0x11,
-    0x83, 0x7C, 0x15, 0x8B, 0x7C, 0x17, 0x92, 0x7C, 0x1C, 0xB3, 0x7C, 0x00, 0x17, 0x00, 0x84, 0x68,
-    0x69, 0x6E, 0x6B, 0x00, 0x84, 0x74, 0x68, 0x69, 0x6E, 0x6B, 0x00, 0x17, 0x00, 0x84, 0x68, 0x69,
-    0x6E, 0x6B, 0x00, 0x17, 0x00, 0x84, 0x68, 0x69, 0x6E, 0x6B, 0x00, 0x84, 0x74, 0x68, 0x69, 0x6E,
-    0x6B, 0x00, 0x4A, 0x9C, 0x7C, 0x15, 0xA3, 0x7C, 0x1C, 0xAC, 0x7C, 0x00, 0x85, 0x74, 0x68, 0x69,
-    0x6E, 0x6B, 0x00, 0x2C, 0x00, 0x85, 0x74, 0x68, 0x69, 0x6E, 0x6B, 0x00, 0x85, 0x74, 0x68, 0x69,
-    0x6E, 0x6B, 0x00, 0x84, 0x74, 0x68, 0x69, 0x6E, 0x6B, 0x00, 0x4B, 0xC1, 0x7C, 0x17, 0xC8, 0x7C,
-    0x00, 0x17, 0x00, 0x83, 0x69, 0x6E, 0x6B, 0x00, 0x83, 0x68, 0x69, 0x6E, 0x6B, 0x00, 0x0B, 0x17,
-    0x00, 0x83, 0x69, 0x6E, 0x6B, 0x00, 0x4B, 0xDD, 0x7C, 0x17, 0xE4, 0x7C, 0x00, 0x17, 0x00, 0x83,
-    0x69, 0x6E, 0x6B, 0x00, 0x83, 0x68, 0x69, 0x6E, 0x6B, 0x00, 0x0B, 0x17, 0x00, 0x83, 0x69, 0x6E,
-    0x6B, 0x00, 0x0B, 0x00, 0x84, 0x74, 0x68, 0x69, 0x6E, 0x6B, 0x00, 0x0B, 0x17, 0x00, 0x83, 0x69,
-    0x6E, 0x6B, 0x00, 0x4B, 0x0A, 0x7D, 0x17, 0x11, 0x7D, 0x00, 0x17, 0x00, 0x83, 0x69, 0x6E, 0x6B,
-    0x00, 0x83, 0x68, 0x69, 0x6E, 0x6B, 0x00, 0x0C, 0x0B, 0x17, 0x00, 0x82, 0x6E, 0x6B, 0x00, 0x0B,
-    0x17, 0x00, 0x82, 0x69, 0x6E, 0x6B, 0x00, 0x0C, 0x0B, 0x17, 0x00, 0x82, 0x6E, 0x6B, 0x00, 0x4B,
-    0x36, 0x7D, 0x0C, 0x3D, 0x7D, 0x00, 0x17, 0x00, 0x82, 0x69, 0x6E, 0x6B, 0x00, 0x0B, 0x17, 0x00,
-    0x82, 0x6E, 0x6B, 0x00, 0x4B, 0x4B, 0x7D, 0x0C, 0x52, 0x7D, 0x00, 0x17, 0x00, 0x82, 0x69, 0x6E,
-    0x6B, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x6E, 0x6B, 0x00, 0x4C, 0x66, 0x7D, 0x0F, 0x6D, 0x7D, 0x12,
-    0x74, 0x7D, 0x13, 0xB1, 0x7D, 0x00, 0x12, 0x0F, 0x00, 0x82, 0x6F, 0x6B, 0x00, 0x12, 0x0F, 0x00,
-    0x82, 0x6F, 0x6B, 0x00, 0x4C, 0x84, 0x7D, 0x0E, 0x8B, 0x7D, 0x0F, 0x92, 0x7D, 0x12, 0xA5, 0x7D,
-    0x13, 0xAA, 0x7D, 0x00, 0x0F, 0x00, 0x83, 0x6F, 0x6F, 0x6B, 0x00, 0x0F, 0x00, 0x83, 0x6F, 0x6F,
-    0x6B, 0x00, 0x4E, 0x99, 0x7D, 0x12, 0x9F, 0x7D, 0x00, 0x84, 0x6C, 0x6F, 0x6F, 0x6B, 0x00, 0x84,
-    0x6C, 0x6F, 0x6F, 0x6B, 0x00, 0x0F, 0x00, 0x81, 0x6B, 0x00, 0x0F, 0x00, 0x83, 0x6F, 0x6F, 0x6B,
-    0x00, 0x12, 0x0F, 0x00, 0x82, 0x6F, 0x6B, 0x00, 0x12, 0x12, 0x0F, 0x00, 0x81, 0x6B, 0x00, 0x48,
-    0xD5, 0x7D, 0x09, 0xDC, 0x7D, 0x0C, 0xE3, 0x7D, 0x0F, 0xEA, 0x7D, 0x12, 0xF1, 0x7D, 0x13, 0x5B,
-    0x7E, 0x17, 0x62, 0x7E, 0x00, 0x12, 0x1A, 0x00, 0x82, 0x72, 0x6B, 0x00, 0x12, 0x1A, 0x00, 0x82,
-    0x72, 0x6B, 0x00, 0x12, 0x1A, 0x00, 0x82, 0x72, 0x6B, 0x00, 0x12, 0x1A, 0x00, 0x82, 0x72, 0x6B,
-    0x00, 0x44, 0x0A, 0x7E, 0x08, 0x11, 0x7E, 0x0C, 0x18, 0x7E, 0x0F, 0x1F, 0x7E, 0x13, 0x26, 0x7E,
-    0x14, 0x2D, 0x7E, 0x16, 0x34, 0x7E, 0x1A, 0x3B, 0x7E, 0x00, 0x1A, 0x00, 0x83, 0x6F, 0x72, 0x6B,
-    0x00, 0x1A, 0x00, 0x83, 0x6F, 0x72, 0x6B, 0x00, 0x1A, 0x00, 0x83, 0x6F, 0x72, 0x6B, 0x00, 0x1A,
-    0x00, 0x83, 0x6F, 0x72, 0x6B, 0x00, 0x1A, 0x00, 0x83, 0x6F, 0x72, 0x6B, 0x00, 0x1A, 0x00, 0x83,
-    0x6F, 0x72, 0x6B, 0x00, 0x1A, 0x00, 0x83, 0x6F, 0x72, 0x6B, 0x00, 0x48, 0x45, 0x7E, 0x14, 0x4D,
-    0x7E, 0x16, 0x53, 0x7E, 0x00, 0x2C, 0x00, 0x84, 0x77, 0x6F, 0x72, 0x6B, 0x00, 0x84, 0x77, 0x6F,
-    0x72, 0x6B, 0x00, 0x2C, 0x00, 0x84, 0x77, 0x6F, 0x72, 0x6B, 0x00, 0x12, 0x1A, 0x00, 0x82, 0x72,
-    0x6B, 0x00, 0x12, 0x1A, 0x00, 0x82, 0x72, 0x6B, 0x00, 0x06, 0x00, 0x44, 0x78, 0x7E, 0x0C, 0x7D,
-    0x7E, 0x12, 0x82, 0x7E, 0x18, 0x87, 0x7E, 0x00, 0x05, 0x00, 0x81, 0x6B, 0x00, 0x07, 0x00, 0x81,
-    0x6B, 0x00, 0x06, 0x00, 0x81, 0x6B, 0x00, 0x09, 0x00, 0x81, 0x6B, 0x00, 0x15, 0x12, 0x1A, 0x00,
-    0x81, 0x6B, 0x00, 0x06, 0x00, 0x44, 0xA2, 0x7E, 0x0C, 0xA7, 0x7E, 0x12, 0xAC, 0x7E, 0x18, 0xB1,
-    0x7E, 0x00, 0x05, 0x00, 0x81, 0x6B, 0x00, 0x07, 0x00, 0x81, 0x6B, 0x00, 0x06, 0x00, 0x81, 0x6B,
-    0x00, 0x09, 0x00, 0x81, 0x6B, 0x00, 0x06, 0x00, 0x44, 0xC5, 0x7E, 0x0C, 0xCA, 0x7E, 0x12, 0xCF,
-    0x7E, 0x18, 0xD4, 0x7E, 0x00, 0x05, 0x00, 0x81, 0x6B, 0x00, 0x07, 0x00, 0x81, 0x6B, 0x00, 0x06,
-    0x00, 0x81, 0x6B, 0x00, 0x09, 0x00, 0x81, 0x6B, 0x00, 0x11, 0x0C, 0x19, 0x00, 0x80, 0x6C, 0x00,
-    0x44, 0x1D, 0x7F, 0x05, 0x23, 0x87, 0x06, 0x57, 0x8C, 0x07, 0x76, 0x8C, 0x08, 0x88, 0x8C, 0x0A,
-    0x90, 0x8C, 0x0B, 0xA9, 0x8C, 0x0C, 0xD6, 0x8C, 0x0E, 0xEF, 0x8C, 0x0F, 0x28, 0x8D, 0x11, 0x62,
-    0x8F, 0x12, 0x86, 0x8F, 0x14, 0x99, 0x8F, 0x16, 0xB4, 0x8F, 0x17, 0xCF, 0x8F, 0x18, 0xE8, 0x8F,
-    0x19, 0x09, 0x90, 0x1A, 0x22, 0x90, 0x1C, 0x3D, 0x90, 0x1D, 0xBE, 0x91, 0x00, 0x45, 0x48, 0x7F,
-    0x06, 0x52, 0x7F, 0x07, 0xAB, 0x84, 0x0C, 0xCA, 0x84, 0x0D, 0xFF, 0x84, 0x14, 0x16, 0x85, 0x16,
-    0x31, 0x85, 0x17, 0x5B, 0x85, 0x18, 0x73, 0x85, 0x19, 0x98, 0x86, 0x1A, 0xB7, 0x86, 0x1B, 0xD2,
-    0x86, 0x1C, 0xF1, 0x86, 0x1D, 0x08, 0x87, 0x00, 0x05, 0x12, 0x15, 0x13, 0x00, 0x82, 0x61, 0x62,
-    0x6C, 0x00, 0x47, 0x6E, 0x7F, 0x0C, 0x7B, 0x7F, 0x0E, 0x08, 0x84, 0x11, 0x27, 0x84, 0x12, 0x46,
-    0x84, 0x16, 0x65, 0x84, 0x18, 0x72, 0x84, 0x19, 0x91, 0x84, 0x1B, 0x9E, 0x84, 0x00, 0x0C, 0x11,
-    0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x83, 0x63, 0x61, 0x6C, 0x00, 0x44, 0x97, 0x7F, 0x05, 0xB6,
-    0x7F, 0x0B, 0xD5, 0x7F, 0x0D, 0xF4, 0x7F, 0x0E, 0x13, 0x80, 0x10, 0x20, 0x80, 0x11, 0x3F, 0x80,
-    0x12, 0xEE, 0x83, 0x18, 0xFB, 0x83, 0x00, 0x4B, 0x9E, 0x7F, 0x11, 0xA9, 0x7F, 0x00, 0x06, 0x08,
-    0x10, 0x00, 0x83, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x85, 0x61,
-    0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x44, 0xBD, 0x7F, 0x11, 0xC9, 0x7F, 0x00, 0x0B, 0x06, 0x08,
-    0x10, 0x00, 0x84, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x84,
-    0x69, 0x63, 0x61, 0x6C, 0x00, 0x44, 0xDC, 0x7F, 0x11, 0xE8, 0x7F, 0x00, 0x0B, 0x06, 0x08, 0x10,
-    0x00, 0x84, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x84, 0x69,
-    0x63, 0x61, 0x6C, 0x00, 0x44, 0xFB, 0x7F, 0x11, 0x07, 0x80, 0x00, 0x0B, 0x06, 0x08, 0x10, 0x00,
-    0x84, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x84, 0x69, 0x63,
-    0x61, 0x6C, 0x00, 0x11, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x84, 0x69, 0x63, 0x61, 0x6C, 0x00,
-    0x44, 0x27, 0x80, 0x11, 0x33, 0x80, 0x00, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x84, 0x6E, 0x69, 0x63,
-    0x61, 0x6C, 0x00, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x84, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x44,
-    0x5B, 0x80, 0x05, 0x1B, 0x83, 0x0B, 0x28, 0x83, 0x0D, 0x58, 0x83, 0x10, 0x65, 0x83, 0x14, 0x72,
-    0x83, 0x16, 0x91, 0x83, 0x1A, 0xB0, 0x83, 0x1D, 0xCF, 0x83, 0x00, 0x45, 0x7D, 0x80, 0x06, 0x9C,
-    0x80, 0x0A, 0xBB, 0x80, 0x0B, 0xDA, 0x80, 0x0D, 0x8A, 0x82, 0x11, 0xA9, 0x82, 0x14, 0xC8, 0x82,
-    0x16, 0xD5, 0x82, 0x1A, 0xE2, 0x82, 0x1C, 0xEF, 0x82, 0x1D, 0x0E, 0x83, 0x00, 0x46, 0x84, 0x80,
-    0x0B, 0x90, 0x80, 0x00, 0x08, 0x10, 0x00, 0x86, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00,
-    0x06, 0x08, 0x10, 0x00, 0x86, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x48, 0xA3, 0x80, 0x0B,
-    0xAE, 0x80, 0x00, 0x10, 0x00, 0x85, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x08, 0x10,
-    0x00, 0x87, 0x63, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x46, 0xC2, 0x80, 0x0B, 0xCE,
-    0x80, 0x00, 0x08, 0x10, 0x00, 0x86, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x06, 0x08,
-    0x10, 0x00, 0x86, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x45, 0xFC, 0x80, 0x06, 0x09, 0x81,
-    0x07, 0xBC, 0x81, 0x08, 0xDB, 0x81, 0x0A, 0xF9, 0x81, 0x0D, 0x06, 0x82, 0x11, 0x13, 0x82, 0x16,
-    0x20, 0x82, 0x19, 0x3F, 0x82, 0x1B, 0x5E, 0x82, 0x1C, 0x7D, 0x82, 0x00, 0x06, 0x08, 0x10, 0x00,
-    0x87, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x47, 0x22, 0x81, 0x08, 0x40, 0x81, 0x10,
-    0x4E, 0x81, 0x15, 0x59, 0x81, 0x16, 0x77, 0x81, 0x19, 0x84, 0x81, 0x1A, 0x91, 0x81, 0x1B, 0xAF,
-    0x81, 0x00, 0x48, 0x29, 0x81, 0x10, 0x35, 0x81, 0x00, 0x10, 0x00, 0x88, 0x63, 0x68, 0x61, 0x6E,
-    0x69, 0x63, 0x61, 0x6C, 0x00, 0x88, 0x65, 0x63, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00,
-    0x2C, 0x00, 0x88, 0x6D, 0x65, 0x63, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x87, 0x65,
-    0x63, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x48, 0x60, 0x81, 0x10, 0x6C, 0x81, 0x00,
-    0x10, 0x00, 0x88, 0x63, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x88, 0x65, 0x63, 0x68,
-    0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x08, 0x10, 0x00, 0x88, 0x63, 0x68, 0x61, 0x6E, 0x69,
-    0x63, 0x61, 0x6C, 0x00, 0x08, 0x10, 0x00, 0x88, 0x63, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C,
-    0x00, 0x48, 0x98, 0x81, 0x10, 0xA4, 0x81, 0x00, 0x10, 0x00, 0x88, 0x63, 0x68, 0x61, 0x6E, 0x69,
-    0x63, 0x61, 0x6C, 0x00, 0x88, 0x65, 0x63, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x08,
-    0x10, 0x00, 0x88, 0x63, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x46, 0xC3, 0x81, 0x08,
-    0xCF, 0x81, 0x00, 0x08, 0x10, 0x00, 0x87, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x10,
-    0x00, 0x87, 0x63, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x46, 0xE2, 0x81, 0x10, 0xEF,
-    0x81, 0x00, 0x10, 0x00, 0x88, 0x65, 0x63, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x86,
-    0x63, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x06, 0x08, 0x10, 0x00, 0x87, 0x68, 0x61,
-    0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x06, 0x08, 0x10, 0x00, 0x87, 0x68, 0x61, 0x6E, 0x69, 0x63,
-    0x61, 0x6C, 0x00, 0x06, 0x08, 0x10, 0x00, 0x87, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00,
-    0x46, 0x27, 0x82, 0x08, 0x33, 0x82, 0x00, 0x08, 0x10, 0x00, 0x87, 0x68, 0x61, 0x6E, 0x69, 0x63,
-    0x61, 0x6C, 0x00, 0x10, 0x00, 0x87, 0x63, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x46,
-    0x46, 0x82, 0x08, 0x52, 0x82, 0x00, 0x08, 0x10, 0x00, 0x87, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61,
-    0x6C, 0x00, 0x10, 0x00, 0x87, 0x63, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x46, 0x65,
-    0x82, 0x08, 0x71, 0x82, 0x00, 0x08, 0x10, 0x00, 0x87, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C,
-    0x00, 0x10, 0x00, 0x87, 0x63, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x06, 0x08, 0x10,
-    0x00, 0x87, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x46, 0x91, 0x82, 0x0B, 0x9D, 0x82,
-    0x00, 0x08, 0x10, 0x00, 0x86, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x06, 0x08, 0x10,
-    0x00, 0x86, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x46, 0xB0, 0x82, 0x0B, 0xBC, 0x82, 0x00,
-    0x08, 0x10, 0x00, 0x86, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x06, 0x08, 0x10, 0x00,
-    0x86, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x86, 0x61, 0x6E,
-    0x69, 0x63, 0x61, 0x6C, 0x00, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x86, 0x61, 0x6E, 0x69, 0x63, 0x61,
-    0x6C, 0x00, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x86, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x46,
-    0xF6, 0x82, 0x0B, 0x02, 0x83, 0x00, 0x08, 0x10, 0x00, 0x86, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61,
-    0x6C, 0x00, 0x06, 0x08, 0x10, 0x00, 0x86, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x0B, 0x06,
-    0x08, 0x10, 0x00, 0x86, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x04, 0x0B, 0x06, 0x08, 0x10,
-    0x00, 0x85, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x44, 0x2F, 0x83, 0x06, 0x4D, 0x83, 0x00, 0x46,
-    0x36, 0x83, 0x0B, 0x42, 0x83, 0x00, 0x08, 0x10, 0x00, 0x86, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61,
-    0x6C, 0x00, 0x06, 0x08, 0x10, 0x00, 0x85, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x08, 0x10, 0x00,
-    0x84, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x85, 0x6E,
-    0x69, 0x63, 0x61, 0x6C, 0x00, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x85, 0x6E, 0x69, 0x63, 0x61,
-    0x6C, 0x00, 0x44, 0x79, 0x83, 0x0B, 0x85, 0x83, 0x00, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x85, 0x6E,
-    0x69, 0x63, 0x61, 0x6C, 0x00, 0x06, 0x08, 0x10, 0x00, 0x85, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C,
-    0x00, 0x44, 0x98, 0x83, 0x0B, 0xA4, 0x83, 0x00, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x85, 0x6E, 0x69,
-    0x63, 0x61, 0x6C, 0x00, 0x06, 0x08, 0x10, 0x00, 0x85, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00,
-    0x44, 0xB7, 0x83, 0x0B, 0xC3, 0x83, 0x00, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x85, 0x6E, 0x69, 0x63,
-    0x61, 0x6C, 0x00, 0x06, 0x08, 0x10, 0x00, 0x85, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x44,
-    0xD6, 0x83, 0x0B, 0xE2, 0x83, 0x00, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x85, 0x6E, 0x69, 0x63, 0x61,
-    0x6C, 0x00, 0x06, 0x08, 0x10, 0x00, 0x85, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x11, 0x04,
-    0x0B, 0x06, 0x08, 0x10, 0x00, 0x84, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x11, 0x04, 0x0B, 0x06, 0x08,
-    0x10, 0x00, 0x84, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x4C, 0x0F, 0x84, 0x11, 0x1B, 0x84, 0x00, 0x11,
-    0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x83, 0x63, 0x61, 0x6C, 0x00, 0x04, 0x0B, 0x06, 0x08, 0x10,
-    0x00, 0x83, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x44, 0x2E, 0x84, 0x0C, 0x39, 0x84, 0x00, 0x0B, 0x06,
-    0x08, 0x10, 0x00, 0x82, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x84,
-    0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x4C, 0x4D, 0x84, 0x11, 0x59, 0x84, 0x00, 0x11, 0x04, 0x0B,
-    0x06, 0x08, 0x10, 0x00, 0x83, 0x63, 0x61, 0x6C, 0x00, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x83,
-    0x69, 0x63, 0x61, 0x6C, 0x00, 0x0C, 0x11, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x83, 0x63, 0x61,
-    0x6C, 0x00, 0x4C, 0x79, 0x84, 0x11, 0x85, 0x84, 0x00, 0x11, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00,
-    0x83, 0x63, 0x61, 0x6C, 0x00, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x83, 0x69, 0x63, 0x61, 0x6C,
-    0x00, 0x0C, 0x11, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x83, 0x63, 0x61, 0x6C, 0x00, 0x0C, 0x11,
-    0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x83, 0x63, 0x61, 0x6C, 0x00, 0x46, 0xB2, 0x84, 0x0C, 0xBE,
-    0x84, 0x00, 0x0C, 0x11, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x82, 0x61, 0x6C, 0x00, 0x11, 0x04,
-    0x0B, 0x06, 0x08, 0x10, 0x00, 0x82, 0x63, 0x61, 0x6C, 0x00, 0x46, 0xD7, 0x84, 0x11, 0xE4, 0x84,
-    0x17, 0xEF, 0x84, 0x18, 0xF7, 0x84, 0x00, 0x11, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x83, 0x69,
-    0x63, 0x61, 0x6C, 0x00, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x81, 0x63, 0x61, 0x6C, 0x00, 0x06,
-    0x04, 0x00, 0x82, 0x75, 0x61, 0x6C, 0x00, 0x17, 0x06, 0x04, 0x00, 0x82, 0x61, 0x6C, 0x00, 0x57,
-    0x06, 0x85, 0x18, 0x0E, 0x85, 0x00, 0x06, 0x04, 0x00, 0x82, 0x75, 0x61, 0x6C, 0x00, 0x17, 0x06,
-    0x04, 0x00, 0x82, 0x61, 0x6C, 0x00, 0x46, 0x1D, 0x85, 0x18, 0x29, 0x85, 0x00, 0x0C, 0x11, 0x04,
-    0x0B, 0x06, 0x08, 0x10, 0x00, 0x82, 0x61, 0x6C, 0x00, 0x17, 0x06, 0x04, 0x00, 0x82, 0x61, 0x6C,
-    0x00, 0x46, 0x3B, 0x85, 0x0C, 0x47, 0x85, 0x18, 0x53, 0x85, 0x00, 0x0C, 0x11, 0x04, 0x0B, 0x06,
-    0x08, 0x10, 0x00, 0x82, 0x61, 0x6C, 0x00, 0x11, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x82, 0x63,
-    0x61, 0x6C, 0x00, 0x17, 0x06, 0x04, 0x00, 0x82, 0x61, 0x6C, 0x00, 0x46, 0x62, 0x85, 0x18, 0x6A,
-    0x85, 0x00, 0x04, 0x2C, 0x00, 0x81, 0x75, 0x61, 0x6C, 0x00, 0x06, 0x04, 0x00, 0x83, 0x74, 0x75,
-    0x61, 0x6C, 0x00, 0x46, 0x89, 0x85, 0x0A, 0xA1, 0x85, 0x0C, 0xB8, 0x85, 0x0D, 0xC1, 0x85, 0x15,
-    0xCA, 0x85, 0x17, 0xE1, 0x85, 0x1C, 0x81, 0x86, 0x00, 0x44, 0x90, 0x85, 0x17, 0x98, 0x85, 0x00,
-    0x2C, 0x00, 0x82, 0x74, 0x75, 0x61, 0x6C, 0x00, 0x04, 0x00, 0x84, 0x63, 0x74, 0x75, 0x61, 0x6C,
-    0x00, 0x46, 0xA8, 0x85, 0x17, 0xB0, 0x85, 0x00, 0x04, 0x00, 0x83, 0x74, 0x75, 0x61, 0x6C, 0x00,
-    0x06, 0x04, 0x00, 0x83, 0x75, 0x61, 0x6C, 0x00, 0x17, 0x06, 0x04, 0x00, 0x83, 0x75, 0x61, 0x6C,
-    0x00, 0x17, 0x06, 0x04, 0x00, 0x83, 0x75, 0x61, 0x6C, 0x00, 0x46, 0xD1, 0x85, 0x17, 0xD9, 0x85,
-    0x00, 0x04, 0x00, 0x83, 0x74, 0x75, 0x61, 0x6C, 0x00, 0x06, 0x04, 0x00, 0x83, 0x75, 0x61, 0x6C,
-    0x00, 0x44, 0xFD, 0x85, 0x06, 0x04, 0x86, 0x07, 0x0E, 0x86, 0x0A, 0x24, 0x86, 0x15, 0x2D, 0x86,
-    0x16, 0x36, 0x86, 0x19, 0x4C, 0x86, 0x1B, 0x62, 0x86, 0x1C, 0x78, 0x86, 0x00, 0x83, 0x63, 0x74,
-    0x75, 0x61, 0x6C, 0x00, 0x2C, 0x00, 0x84, 0x61, 0x63, 0x74, 0x75, 0x61, 0x6C, 0x00, 0x44, 0x15,
-    0x86, 0x06, 0x1C, 0x86, 0x00, 0x84, 0x63, 0x74, 0x75, 0x61, 0x6C, 0x00, 0x04, 0x00, 0x84, 0x74,
-    0x75, 0x61, 0x6C, 0x00, 0x06, 0x04, 0x00, 0x84, 0x74, 0x75, 0x61, 0x6C, 0x00, 0x06, 0x04, 0x00,
-    0x84, 0x74, 0x75, 0x61, 0x6C, 0x00, 0x44, 0x3D, 0x86, 0x06, 0x44, 0x86, 0x00, 0x84, 0x63, 0x74,
-    0x75, 0x61, 0x6C, 0x00, 0x04, 0x00, 0x84, 0x74, 0x75, 0x61, 0x6C, 0x00, 0x44, 0x53, 0x86, 0x06,
-    0x5A, 0x86, 0x00, 0x84, 0x63, 0x74, 0x75, 0x61, 0x6C, 0x00, 0x04, 0x00, 0x84, 0x74, 0x75, 0x61,
-    0x6C, 0x00, 0x44, 0x69, 0x86, 0x06, 0x70, 0x86, 0x00, 0x84, 0x63, 0x74, 0x75, 0x61, 0x6C, 0x00,
-    0x04, 0x00, 0x84, 0x74, 0x75, 0x61, 0x6C, 0x00, 0x06, 0x04, 0x00, 0x84, 0x74, 0x75, 0x61, 0x6C,
-    0x00, 0x46, 0x88, 0x86, 0x17, 0x90, 0x86, 0x00, 0x04, 0x00, 0x83, 0x74, 0x75, 0x61, 0x6C, 0x00,
-    0x06, 0x04, 0x00, 0x83, 0x75, 0x61, 0x6C, 0x00, 0x46, 0x9F, 0x86, 0x0C, 0xAB, 0x86, 0x00, 0x0C,
-    0x11, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x82, 0x61, 0x6C, 0x00, 0x11, 0x04, 0x0B, 0x06, 0x08,
-    0x10, 0x00, 0x82, 0x63, 0x61, 0x6C, 0x00, 0x46, 0xBE, 0x86, 0x18, 0xCA, 0x86, 0x00, 0x0C, 0x11,
-    0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x82, 0x61, 0x6C, 0x00, 0x17, 0x06, 0x04, 0x00, 0x82, 0x61,
-    0x6C, 0x00, 0x46, 0xD9, 0x86, 0x0C, 0xE5, 0x86, 0x00, 0x0C, 0x11, 0x04, 0x0B, 0x06, 0x08, 0x10,
+    0x2C, 0x00, 0x85, 0x66, 0x75, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x00, 0x06, 0x18, 0x00, 0x49, 0xBD,
+    0x07, 0x00, 0x4A, 0xBD, 0x07, 0x00, 0x46, 0x86, 0x3B, 0x09, 0xAD, 0x3B, 0x00, 0x83, 0x63, 0x6B,
+    0x69, 0x6E, 0x67, 0x00, 0x46, 0x36, 0x3B, 0x0A, 0xBE, 0x3B, 0x12, 0xA2, 0x3B, 0x00, 0x6C, 0x3F,
+    0x3B, 0x00, 0x45, 0xEA, 0x3B, 0x08, 0xF1, 0x3B, 0x09, 0xEA, 0x3B, 0x0A, 0xF5, 0x3B, 0x0B, 0x09,
+    0x3C, 0x0C, 0x0D, 0x3C, 0x0E, 0x9B, 0x3B, 0x0F, 0xFF, 0x38, 0x12, 0xA2, 0x3B, 0x13, 0x0D, 0x3C,
+    0x15, 0x1B, 0x3A, 0x17, 0xEA, 0x3B, 0x19, 0xEA, 0x3B, 0x00, 0x84, 0x67, 0x6F, 0x69, 0x6E, 0x67,
+    0x00, 0x45, 0xBD, 0x07, 0x00, 0x45, 0xE2, 0x07, 0x09, 0x05, 0x3C, 0x0B, 0x05, 0x3C, 0x17, 0x05,
+    0x3C, 0x19, 0xE2, 0x07, 0x00, 0x6C, 0xE2, 0x07, 0x00, 0x6C, 0xEA, 0x3B, 0x00, 0x0A, 0x00, 0x84,
+    0x6F, 0x69, 0x6E, 0x67, 0x00, 0x4A, 0x3F, 0x3B, 0x12, 0xA2, 0x3B, 0x00, 0x48, 0x32, 0x3C, 0x09,
+    0x32, 0x3C, 0x0C, 0x3B, 0x3C, 0x0D, 0x3B, 0x3C, 0x17, 0x32, 0x3C, 0x18, 0x46, 0x3C, 0x1C, 0x3B,
+    0x3C, 0x00, 0x18, 0x07, 0x00, 0x84, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x47, 0xF2, 0x07, 0x18, 0x42,
+    0x3C, 0x00, 0x47, 0x35, 0x3C, 0x00, 0x2C, 0x00, 0x84, 0x64, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x00,
+    0x48, 0x5D, 0x3C, 0x0B, 0x67, 0x3C, 0x15, 0x1B, 0x3A, 0x18, 0x0C, 0x3A, 0x00, 0x10, 0x12, 0x16,
+    0x00, 0x82, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x08, 0x10, 0x12, 0x00, 0x56, 0x75, 0x3A, 0x00, 0x47,
+    0x82, 0x3C, 0x08, 0xF1, 0x3B, 0x0B, 0x9D, 0x39, 0x0E, 0x9B, 0x3B, 0x12, 0xA2, 0x3B, 0x15, 0x8A,
+    0x3C, 0x00, 0x2C, 0x00, 0x82, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x47, 0xF2, 0x07, 0x18, 0x08, 0x3A,
+    0x00, 0x45, 0x1D, 0x39, 0x00, 0x46, 0xAB, 0x3C, 0x08, 0xB1, 0x3C, 0x0B, 0x81, 0x38, 0x0C, 0xB5,
+    0x3C, 0x0E, 0x8C, 0x38, 0x12, 0x93, 0x38, 0x15, 0x97, 0x38, 0x00, 0x18, 0x00, 0x49, 0x4D, 0x39,
+    0x00, 0x45, 0x87, 0x38, 0x00, 0x48, 0xFD, 0x38, 0x12, 0x0C, 0x39, 0x15, 0x10, 0x39, 0x00, 0x12,
+    0x00, 0x4F, 0xFF, 0x38, 0x00, 0x48, 0xB1, 0x3C, 0x0B, 0x81, 0x38, 0x0C, 0xDE, 0x3C, 0x0E, 0xEE,
+    0x3C, 0x0F, 0x00, 0x3D, 0x12, 0x16, 0x3D, 0x13, 0x1D, 0x3D, 0x15, 0x97, 0x38, 0x00, 0x48, 0xFD,
+    0x38, 0x0A, 0x3F, 0x3B, 0x0B, 0x03, 0x39, 0x12, 0x0C, 0x39, 0x15, 0x10, 0x39, 0x00, 0x46, 0xF5,
+    0x3C, 0x0F, 0xFB, 0x3C, 0x00, 0x18, 0x00, 0x49, 0x87, 0x38, 0x00, 0x83, 0x6F, 0x6E, 0x67, 0x00,
+    0x4E, 0x0A, 0x3D, 0x0F, 0x12, 0x3D, 0x12, 0x0A, 0x3D, 0x00, 0x2C, 0x00, 0x84, 0x6C, 0x6F, 0x6E,
+    0x67, 0x00, 0x6C, 0xFB, 0x3C, 0x00, 0x4A, 0x87, 0x38, 0x0F, 0xFF, 0x38, 0x00, 0x4F, 0xFB, 0x3C,
+    0x00, 0x4C, 0x28, 0x3D, 0x18, 0x2E, 0x3D, 0x00, 0x18, 0x00, 0x47, 0x0E, 0x3A, 0x00, 0x47, 0x4D,
+    0x39, 0x00, 0x48, 0xB1, 0x3C, 0x0B, 0x81, 0x38, 0x0C, 0xF0, 0x38, 0x0E, 0x8C, 0x38, 0x12, 0x93,
+    0x38, 0x15, 0x97, 0x38, 0x00, 0x15, 0x0C, 0x09, 0x00, 0x80, 0x74, 0x00, 0x74, 0x68, 0x3D, 0x04,
+    0x75, 0x3D, 0x06, 0x79, 0x3D, 0x0B, 0x7F, 0x3D, 0x0C, 0x85, 0x3D, 0x11, 0x8A, 0x3D, 0x15, 0x94,
+    0x3D, 0x16, 0x99, 0x3D, 0x18, 0xB6, 0x3D, 0x00, 0x11, 0x00, 0x44, 0x71, 0x3D, 0x12, 0x7A, 0x20,
+    0x00, 0x06, 0x00, 0x80, 0x00, 0x4B, 0x21, 0x16, 0x00, 0x04, 0x1B, 0x08, 0x00, 0x80, 0x00, 0x0A,
+    0x0C, 0x15, 0x00, 0x80, 0x00, 0x0B, 0x16, 0x00, 0x80, 0x00, 0x44, 0x02, 0x16, 0x12, 0xC0, 0x38,
+    0x18, 0x71, 0x3D, 0x00, 0x04, 0x13, 0x00, 0x80, 0x00, 0x44, 0xA9, 0x3D, 0x08, 0xD1, 0x15, 0x12,
+    0xBA, 0x18, 0x15, 0xAD, 0x3D, 0x18, 0xB2, 0x3D, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0C, 0x09, 0x00,
+    0x80, 0x00, 0x0D, 0x00, 0x80, 0x00, 0x12, 0x05, 0x04, 0x00, 0x80, 0x00, 0x45, 0xEA, 0x3D, 0x06,
+    0x21, 0x3E, 0x07, 0x1A, 0x40, 0x09, 0x3A, 0x40, 0x0A, 0x41, 0x40, 0x0C, 0xFD, 0x41, 0x0D, 0x04,
+    0x42, 0x11, 0x0E, 0x42, 0x15, 0x28, 0x42, 0x16, 0x35, 0x42, 0x17, 0x3C, 0x42, 0x18, 0x0D, 0x43,
+    0x19, 0x24, 0x43, 0x1B, 0x1A, 0x40, 0x1C, 0x34, 0x43, 0x00, 0x46, 0xF7, 0x3D, 0x0A, 0x03, 0x3E,
+    0x17, 0x09, 0x3E, 0x18, 0x18, 0x3E, 0x00, 0x18, 0x00, 0x50, 0x00, 0x3E, 0x16, 0x00, 0x3E, 0x00,
+    0x81, 0x68, 0x00, 0x0C, 0x0B, 0x00, 0x81, 0x68, 0x00, 0x4C, 0x10, 0x3E, 0x12, 0x14, 0x3E, 0x00,
+    0x5A, 0x00, 0x3E, 0x00, 0x45, 0x00, 0x3E, 0x00, 0x12, 0x15, 0x0B, 0x17, 0x00, 0x81, 0x67, 0x68,
+    0x00, 0x47, 0x4C, 0x3E, 0x0A, 0x6A, 0x3E, 0x0B, 0x78, 0x3E, 0x0C, 0x81, 0x3E, 0x0D, 0x0F, 0x3F,
+    0x0E, 0x13, 0x3F, 0x12, 0x13, 0x3F, 0x15, 0x21, 0x3F, 0x16, 0x28, 0x3F, 0x17, 0x36, 0x3F, 0x18,
+    0xA4, 0x3F, 0x19, 0x4C, 0x3E, 0x1B, 0x4C, 0x3E, 0x1C, 0x10, 0x40, 0x00, 0x4C, 0x56, 0x3E, 0x17,
+    0x5D, 0x3E, 0x18, 0x63, 0x3E, 0x00, 0x0B, 0x1A, 0x00, 0x82, 0x63, 0x68, 0x00, 0x0C, 0x00, 0x45,
+    0x59, 0x3E, 0x00, 0x50, 0x59, 0x3E, 0x16, 0x59, 0x3E, 0x00, 0x4C, 0x71, 0x3E, 0x17, 0x5D, 0x3E,
+    0x00, 0x05, 0x00, 0x82, 0x74, 0x63, 0x68, 0x00, 0x0C, 0x1A, 0x00, 0x83, 0x68, 0x69, 0x63, 0x68,
+    0x00, 0x45, 0xA3, 0x3E, 0x0A, 0xA3, 0x3E, 0x0B, 0xB1, 0x3E, 0x0D, 0xA3, 0x3E, 0x0E, 0xF3, 0x3E,
+    0x11, 0xA3, 0x3E, 0x12, 0xF3, 0x3E, 0x17, 0xF9, 0x3E, 0x18, 0x01, 0x3F, 0x1A, 0x0B, 0x3F, 0x1C,
+    0xA3, 0x3E, 0x00, 0x4B, 0xAA, 0x3E, 0x1A, 0x7B, 0x3E, 0x00, 0x1A, 0x00, 0x83, 0x69, 0x63, 0x68,
+    0x00, 0x44, 0xD0, 0x3E, 0x05, 0xD7, 0x3E, 0x08, 0xD0, 0x3E, 0x0A, 0xD7, 0x3E, 0x0D, 0xD7, 0x3E,
+    0x11, 0xD7, 0x3E, 0x14, 0xD0, 0x3E, 0x16, 0xD0, 0x3E, 0x1A, 0xDF, 0x3E, 0x1C, 0xD7, 0x3E, 0x00,
+    0x84, 0x77, 0x68, 0x69, 0x63, 0x68, 0x00, 0x1A, 0x00, 0x84, 0x68, 0x69, 0x63, 0x68, 0x00, 0x44,
+    0xEC, 0x3E, 0x08, 0xEC, 0x3E, 0x14, 0xEC, 0x3E, 0x16, 0xEC, 0x3E, 0x00, 0x85, 0x77, 0x68, 0x69,
+    0x63, 0x68, 0x00, 0x0B, 0x00, 0x5A, 0xAC, 0x3E, 0x00, 0x05, 0x00, 0x83, 0x69, 0x74, 0x63, 0x68,
+    0x00, 0x4B, 0xAA, 0x3E, 0x10, 0x59, 0x3E, 0x16, 0x59, 0x3E, 0x00, 0x4B, 0xD0, 0x3E, 0x00, 0x58,
+    0x63, 0x3E, 0x00, 0x4B, 0x1A, 0x3F, 0x0C, 0x56, 0x3E, 0x00, 0x1A, 0x00, 0x82, 0x69, 0x63, 0x68,
+    0x00, 0x17, 0x0C, 0x00, 0x45, 0x59, 0x3E, 0x00, 0x4C, 0x56, 0x3E, 0x17, 0x5D, 0x3E, 0x18, 0x32,
+    0x3F, 0x00, 0x56, 0x59, 0x3E, 0x00, 0x45, 0x4F, 0x3F, 0x0A, 0x58, 0x3F, 0x0C, 0x60, 0x3F, 0x0E,
+    0x99, 0x3F, 0x12, 0x58, 0x3F, 0x15, 0x58, 0x3F, 0x18, 0x58, 0x3F, 0x1C, 0x58, 0x3F, 0x00, 0x0C,
+    0x00, 0x84, 0x62, 0x69, 0x74, 0x63, 0x68, 0x00, 0x0C, 0x05, 0x00, 0x83, 0x74, 0x63, 0x68, 0x00,
+    0x45, 0x79, 0x3F, 0x0A, 0x51, 0x3F, 0x0B, 0x8D, 0x3F, 0x0E, 0x8D, 0x3F, 0x11, 0x8D, 0x3F, 0x12,
+    0x8D, 0x3F, 0x18, 0x8D, 0x3F, 0x19, 0x95, 0x3F, 0x00, 0x4A, 0x86, 0x3F, 0x0B, 0x86, 0x3F, 0x11,
+    0x86, 0x3F, 0x19, 0x86, 0x3F, 0x00, 0x85, 0x62, 0x69, 0x74, 0x63, 0x68, 0x00, 0x05, 0x00, 0x84,
+    0x69, 0x74, 0x63, 0x68, 0x00, 0x6C, 0x51, 0x3F, 0x00, 0x45, 0xFB, 0x3E, 0x0C, 0xA0, 0x3F, 0x00,
+    0x45, 0x5B, 0x3F, 0x00, 0x44, 0xC9, 0x3F, 0x07, 0xC9, 0x3F, 0x0B, 0x1A, 0x3F, 0x0C, 0xD0, 0x3F,
+    0x0D, 0xDE, 0x3F, 0x0E, 0xE5, 0x3F, 0x10, 0xE9, 0x3F, 0x11, 0xE5, 0x3F, 0x16, 0xF9, 0x3F, 0x1A,
+    0xC9, 0x3F, 0x1B, 0xC9, 0x3F, 0x1C, 0xDE, 0x3F, 0x00, 0x16, 0x00, 0x83, 0x75, 0x63, 0x68, 0x00,
+    0x4B, 0xDA, 0x3F, 0x10, 0xCB, 0x3F, 0x16, 0xCB, 0x3F, 0x00, 0x5A, 0x59, 0x3E, 0x00, 0x50, 0xCB,
+    0x3F, 0x16, 0xCB, 0x3F, 0x00, 0x50, 0xCB, 0x3F, 0x00, 0x4D, 0xF3, 0x3F, 0x0E, 0xF3, 0x3F, 0x11,
+    0xF3, 0x3F, 0x00, 0x84, 0x6D, 0x75, 0x63, 0x68, 0x00, 0x47, 0x06, 0x40, 0x08, 0x0C, 0x40, 0x1A,
+    0x06, 0x40, 0x1B, 0x06, 0x40, 0x00, 0x84, 0x73, 0x75, 0x63, 0x68, 0x00, 0x6C, 0x06, 0x40, 0x00,
+    0x4C, 0x71, 0x3E, 0x17, 0x5D, 0x3E, 0x18, 0x63, 0x3E, 0x00, 0x46, 0x24, 0x40, 0x0C, 0xA8, 0x16,
+    0x17, 0xAF, 0x16, 0x00, 0x4C, 0x2E, 0x40, 0x17, 0x34, 0x40, 0x18, 0xF9, 0x3D, 0x00, 0x0B, 0x1A,
+    0x00, 0x81, 0x68, 0x00, 0x0C, 0x05, 0x00, 0x81, 0x68, 0x00, 0x4A, 0x03, 0x3E, 0x18, 0x18, 0x3E,
+    0x00, 0x45, 0x6C, 0x40, 0x06, 0xF7, 0x3D, 0x09, 0x6C, 0x40, 0x0A, 0x03, 0x3E, 0x0B, 0x81, 0x40,
+    0x0C, 0x87, 0x40, 0x0D, 0xDE, 0x40, 0x0E, 0x81, 0x40, 0x11, 0xEC, 0x40, 0x12, 0xF0, 0x40, 0x17,
+    0x0C, 0x41, 0x18, 0x1D, 0x41, 0x19, 0x6C, 0x40, 0x1C, 0xDE, 0x40, 0x00, 0x4C, 0x73, 0x40, 0x18,
+    0x79, 0x40, 0x00, 0x0B, 0x00, 0x82, 0x67, 0x68, 0x00, 0x12, 0x15, 0x0B, 0x00, 0x57, 0x75, 0x40,
+    0x00, 0x0C, 0x00, 0x4B, 0x75, 0x40, 0x00, 0x45, 0xA0, 0x40, 0x0A, 0xA0, 0x40, 0x0B, 0xA7, 0x40,
+    0x0D, 0xA0, 0x40, 0x0E, 0xA0, 0x40, 0x12, 0xC1, 0x40, 0x18, 0xD0, 0x40, 0x1C, 0xA0, 0x40, 0x00,
+    0x0B, 0x00, 0x83, 0x69, 0x67, 0x68, 0x00, 0x45, 0xB7, 0x40, 0x0A, 0xB7, 0x40, 0x0D, 0xB7, 0x40,
+    0x11, 0xBD, 0x40, 0x1C, 0xBD, 0x40, 0x00, 0x84, 0x68, 0x69, 0x67, 0x68, 0x00, 0x6C, 0xB7, 0x40,
+    0x00, 0x4B, 0xA2, 0x40, 0x15, 0xC8, 0x40, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x75, 0x67, 0x68, 0x00,
+    0x4B, 0xA2, 0x40, 0x12, 0xD7, 0x40, 0x00, 0x15, 0x0B, 0x00, 0x57, 0x75, 0x40, 0x00, 0x52, 0xE5,
+    0x40, 0x18, 0x79, 0x40, 0x00, 0x15, 0x0B, 0x00, 0x57, 0xCB, 0x40, 0x00, 0x4C, 0xCA, 0x15, 0x00,
+    0x4C, 0x73, 0x40, 0x15, 0xFA, 0x40, 0x18, 0x02, 0x41, 0x00, 0x0B, 0x17, 0x00, 0x81, 0x75, 0x67,
+    0x68, 0x00, 0x15, 0x0B, 0x17, 0x00, 0x83, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x4C, 0x16, 0x41, 0x12,
+    0x14, 0x3E, 0x18, 0x79, 0x40, 0x00, 0x4B, 0x75, 0x40, 0x1A, 0x00, 0x3E, 0x00, 0x4C, 0x33, 0x41,
+    0x0D, 0x4C, 0x41, 0x0F, 0x54, 0x41, 0x12, 0x5B, 0x41, 0x13, 0x54, 0x41, 0x15, 0xE8, 0x41, 0x1C,
+    0x4C, 0x41, 0x00, 0x4B, 0x75, 0x40, 0x12, 0x3D, 0x41, 0x15, 0x46, 0x41, 0x00, 0x15, 0x0B, 0x17,
+    0x00, 0x83, 0x75, 0x67, 0x68, 0x00, 0x0B, 0x00, 0x57, 0x06, 0x41, 0x00, 0x12, 0x15, 0x0B, 0x00,
+    0x57, 0x41, 0x41, 0x00, 0x52, 0x3D, 0x41, 0x15, 0x46, 0x41, 0x00, 0x48, 0x74, 0x41, 0x09, 0x74,
+    0x41, 0x0B, 0x8D, 0x41, 0x0C, 0x98, 0x41, 0x0F, 0x98, 0x41, 0x13, 0x98, 0x41, 0x15, 0x9F, 0x41,
+    0x17, 0x74, 0x41, 0x00, 0x4B, 0x7B, 0x41, 0x15, 0x84, 0x41, 0x00, 0x17, 0x00, 0x84, 0x72, 0x6F,
+    0x75, 0x67, 0x68, 0x00, 0x0B, 0x17, 0x00, 0x84, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x15, 0x17, 0x00,
+    0x85, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x15, 0x0B, 0x00, 0x57, 0x87, 0x41, 0x00, 0x45,
+    0xBB, 0x41, 0x08, 0xCB, 0x41, 0x09, 0xCB, 0x41, 0x0A, 0xBB, 0x41, 0x0B, 0xD1, 0x41, 0x0D, 0xBB,
+    0x41, 0x11, 0xBB, 0x41, 0x17, 0xDC, 0x41, 0x1C, 0xBB, 0x41, 0x00, 0x4B, 0xC2, 0x41, 0x17, 0x90,
+    0x41, 0x00, 0x17, 0x00, 0x85, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x0B, 0x00, 0x57, 0xC4, 0x41,
+    0x00, 0x2C, 0x00, 0x85, 0x74, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x0B, 0x2C, 0x00, 0x86,
+    0x74, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x4B, 0xEF, 0x41, 0x12, 0xF7, 0x41, 0x00, 0x17,
+    0x00, 0x82, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x0B, 0x00, 0x57, 0x7D, 0x41, 0x00, 0x06, 0x0B, 0x00,
+    0x5A, 0x1C, 0x3F, 0x00, 0x46, 0xF7, 0x3D, 0x0A, 0x03, 0x3E, 0x17, 0x09, 0x3E, 0x00, 0x44, 0x91,
+    0x15, 0x06, 0xF7, 0x3D, 0x08, 0x21, 0x42, 0x0A, 0x03, 0x3E, 0x0C, 0x28, 0x16, 0x17, 0x09, 0x3E,
+    0x00, 0x48, 0xD1, 0x15, 0x0B, 0x02, 0x16, 0x00, 0x48, 0x2F, 0x42, 0x17, 0x09, 0x3E, 0x00, 0x19,
+    0x08, 0x00, 0x80, 0x79, 0x00, 0x46, 0x24, 0x40, 0x17, 0xAF, 0x16, 0x00, 0x46, 0x58, 0x42, 0x0A,
+    0x5E, 0x42, 0x0C, 0x7B, 0x42, 0x0E, 0xB1, 0x42, 0x12, 0xB7, 0x42, 0x13, 0xEE, 0x42, 0x15, 0xB1,
+    0x42, 0x18, 0xF4, 0x42, 0x1C, 0x06, 0x43, 0x00, 0x0C, 0x00, 0x45, 0x73, 0x3E, 0x00, 0x4C, 0x65,
+    0x42, 0x12, 0x77, 0x42, 0x00, 0x4B, 0x00, 0x3E, 0x15, 0x6F, 0x42, 0x1A, 0x73, 0x42, 0x00, 0x81,
+    0x68, 0x74, 0x00, 0x82, 0x74, 0x68, 0x00, 0x45, 0x73, 0x42, 0x00, 0x44, 0x94, 0x42, 0x08, 0x94,
+    0x42, 0x0E, 0x94, 0x42, 0x12, 0x9B, 0x42, 0x14, 0x94, 0x42, 0x16, 0x94, 0x42, 0x18, 0x94, 0x42,
+    0x1A, 0xA2, 0x42, 0x00, 0x1A, 0x00, 0x83, 0x69, 0x74, 0x68, 0x00, 0x45, 0x73, 0x42, 0x1A, 0x96,
+    0x42, 0x00, 0x48, 0xA9, 0x42, 0x14, 0xAB, 0x42, 0x00, 0x2C, 0x00, 0x84, 0x77, 0x69, 0x74, 0x68,
+    0x00, 0x0C, 0x00, 0x5A, 0x73, 0x42, 0x00, 0x45, 0xD0, 0x42, 0x0A, 0xE0, 0x42, 0x0B, 0xE0, 0x42,
+    0x0C, 0xE7, 0x42, 0x0F, 0xE0, 0x42, 0x11, 0xE0, 0x42, 0x13, 0xE0, 0x42, 0x19, 0xE0, 0x42, 0x00,
+    0x4A, 0xDA, 0x42, 0x0B, 0xDA, 0x42, 0x19, 0xDA, 0x42, 0x00, 0x84, 0x62, 0x6F, 0x74, 0x68, 0x00,
+    0x05, 0x00, 0x83, 0x6F, 0x74, 0x68, 0x00, 0x45, 0xE2, 0x42, 0x1A, 0x73, 0x42, 0x00, 0x12, 0x00,
+    0x45, 0x73, 0x42, 0x00, 0x4C, 0xFB, 0x42, 0x12, 0xFF, 0x42, 0x00, 0x5A, 0x73, 0x42, 0x00, 0x15,
+    0x0B, 0x00, 0x57, 0x1D, 0x3E, 0x00, 0x4C, 0xFB, 0x42, 0x12, 0x77, 0x42, 0x00, 0x4A, 0x14, 0x43,
+    0x12, 0x1C, 0x43, 0x00, 0x12, 0x15, 0x0B, 0x00, 0x57, 0xCB, 0x40, 0x00, 0x15, 0x0B, 0x17, 0x00,
+    0x80, 0x67, 0x68, 0x00, 0x46, 0x24, 0x40, 0x0A, 0x03, 0x3E, 0x0C, 0xA8, 0x16, 0x17, 0xAF, 0x16,
+    0x18, 0x18, 0x3E, 0x00, 0x46, 0xF7, 0x3D, 0x08, 0x91, 0x15, 0x0A, 0x03, 0x3E, 0x0F, 0x47, 0x43,
+    0x11, 0x47, 0x23, 0x17, 0x09, 0x3E, 0x00, 0x11, 0x12, 0x00, 0x80, 0x00, 0x11, 0x0C, 0x0B, 0x17,
+    0x2C, 0x00, 0x80, 0x6B, 0x00, 0x46, 0xB4, 0x15, 0x0B, 0xD9, 0x15, 0x0E, 0x65, 0x43, 0x10, 0x87,
+    0x43, 0x11, 0x93, 0x43, 0x00, 0x46, 0x72, 0x43, 0x11, 0x7C, 0x43, 0x12, 0x82, 0x43, 0x15, 0x7E,
+    0x16, 0x00, 0x4C, 0x7A, 0x20, 0x12, 0x71, 0x3D, 0x18, 0x93, 0x16, 0x00, 0x0C, 0x0B, 0x17, 0x00,
+    0x80, 0x00, 0x12, 0x0F, 0x00, 0x80, 0x00, 0x48, 0x91, 0x15, 0x12, 0x8E, 0x43, 0x00, 0x15, 0x09,
+    0x00, 0x80, 0x00, 0x44, 0x91, 0x15, 0x08, 0xA0, 0x43, 0x0C, 0xAE, 0x43, 0x1A, 0x8C, 0x15, 0x00,
+    0x48, 0xD1, 0x15, 0x0B, 0x21, 0x16, 0x19, 0xAA, 0x43, 0x00, 0x08, 0x00, 0x80, 0x00, 0x0B, 0x17,
+    0x00, 0x80, 0x6B, 0x00, 0x45, 0xEE, 0x43, 0x06, 0xFC, 0x43, 0x07, 0x5D, 0x45, 0x08, 0x7C, 0x45,
+    0x09, 0x7C, 0x45, 0x0B, 0xEE, 0x43, 0x0C, 0x83, 0x45, 0x0D, 0xA4, 0x45, 0x0F, 0xB1, 0x45, 0x10,
+    0xDD, 0x45, 0x11, 0xEA, 0x45, 0x12, 0xA0, 0x46, 0x13, 0xDC, 0x46, 0x15, 0xE3, 0x46, 0x16, 0x5D,
+    0x45, 0x17, 0x7C, 0x45, 0x19, 0x5D, 0x45, 0x1B, 0x5D, 0x45, 0x1C, 0x32, 0x47, 0x00, 0x4C, 0xF5,
+    0x43, 0x11, 0x3F, 0x0A, 0x00, 0x0B, 0x17, 0x00, 0x81, 0x6E, 0x6B, 0x00, 0x44, 0x2D, 0x44, 0x07,
+    0x65, 0x44, 0x0C, 0x84, 0x44, 0x0D, 0xD5, 0x44, 0x0E, 0xDB, 0x44, 0x0F, 0xE1, 0x44, 0x12, 0xE7,
+    0x44, 0x13, 0xE1, 0x44, 0x14, 0x1A, 0x45, 0x16, 0x65, 0x44, 0x18, 0x20, 0x45, 0x19, 0x65, 0x44,
+    0x1A, 0x1A, 0x45, 0x1B, 0x65, 0x44, 0x1C, 0xD5, 0x44, 0x1D, 0x1A, 0x45, 0x00, 0x45, 0x49, 0x44,
+    0x0A, 0x5E, 0x44, 0x0B, 0x5E, 0x44, 0x11, 0x5E, 0x44, 0x14, 0x5E, 0x44, 0x16, 0x5E, 0x44, 0x19,
+    0x5E, 0x44, 0x1A, 0x5E, 0x44, 0x1D, 0x5E, 0x44, 0x00, 0x4A, 0x56, 0x44, 0x0B, 0x56, 0x44, 0x11,
+    0x56, 0x44, 0x19, 0x58, 0x44, 0x00, 0x2C, 0x00, 0x84, 0x62, 0x61, 0x63, 0x6B, 0x00, 0x05, 0x00,
+    0x83, 0x61, 0x63, 0x6B, 0x00, 0x44, 0x72, 0x44, 0x0C, 0x78, 0x44, 0x12, 0x7C, 0x44, 0x18, 0x80,
+    0x44, 0x00, 0x05, 0x00, 0x82, 0x63, 0x6B, 0x00, 0x47, 0x74, 0x44, 0x00, 0x46, 0x74, 0x44, 0x00,
+    0x49, 0x74, 0x44, 0x00, 0x46, 0xA0, 0x44, 0x07, 0xA7, 0x44, 0x08, 0xA0, 0x44, 0x09, 0xA0, 0x44,
+    0x0E, 0xA0, 0x44, 0x12, 0xC1, 0x44, 0x16, 0xC8, 0x44, 0x18, 0xCE, 0x44, 0x1B, 0xA0, 0x44, 0x00,
+    0x07, 0x00, 0x83, 0x69, 0x63, 0x6B, 0x00, 0x46, 0xB7, 0x44, 0x08, 0xBD, 0x44, 0x09, 0xB7, 0x44,
+    0x16, 0xB7, 0x44, 0x1B, 0xB7, 0x44, 0x00, 0x84, 0x64, 0x69, 0x63, 0x6B, 0x00, 0x6C, 0xB7, 0x44,
+    0x00, 0x46, 0x74, 0x44, 0x07, 0xA2, 0x44, 0x00, 0x07, 0x00, 0x6C, 0xA2, 0x44, 0x00, 0x47, 0xA2,
+    0x44, 0x09, 0x74, 0x44, 0x00, 0x18, 0x00, 0x49, 0x74, 0x44, 0x00, 0x0C, 0x00, 0x47, 0x74, 0x44,
+    0x00, 0x12, 0x00, 0x46, 0x74, 0x44, 0x00, 0x46, 0xFD, 0x44, 0x07, 0x0C, 0x45, 0x0C, 0x13, 0x45,
+    0x13, 0x0C, 0x45, 0x16, 0x0C, 0x45, 0x19, 0x0C, 0x45, 0x1B, 0x0C, 0x45, 0x00, 0x47, 0x04, 0x45,
+    0x1B, 0x06, 0x45, 0x00, 0x2C, 0x00, 0x84, 0x63, 0x6F, 0x63, 0x6B, 0x00, 0x06, 0x00, 0x83, 0x6F,
+    0x63, 0x6B, 0x00, 0x46, 0x0E, 0x45, 0x07, 0x74, 0x44, 0x00, 0x04, 0x00, 0x45, 0x74, 0x44, 0x00,
+    0x46, 0x3C, 0x45, 0x07, 0x3C, 0x45, 0x09, 0x43, 0x45, 0x0A, 0x3C, 0x45, 0x0C, 0x56, 0x45, 0x0D,
+    0x3C, 0x45, 0x15, 0x3C, 0x45, 0x19, 0x3C, 0x45, 0x1C, 0x3C, 0x45, 0x00, 0x09, 0x00, 0x83, 0x75,
+    0x63, 0x6B, 0x00, 0x46, 0x50, 0x45, 0x07, 0x50, 0x45, 0x0A, 0x50, 0x45, 0x19, 0x50, 0x45, 0x00,
+    0x84, 0x66, 0x75, 0x63, 0x6B, 0x00, 0x47, 0x74, 0x44, 0x09, 0x3E, 0x45, 0x00, 0x06, 0x00, 0x44,
+    0x6C, 0x45, 0x0C, 0x70, 0x45, 0x12, 0x74, 0x45, 0x18, 0x78, 0x45, 0x00, 0x45, 0x43, 0x0A, 0x00,
+    0x47, 0x43, 0x0A, 0x00, 0x46, 0x43, 0x0A, 0x00, 0x49, 0x43, 0x0A, 0x00, 0x15, 0x12, 0x1A, 0x00,
+    0x81, 0x6B, 0x00, 0x46, 0x5F, 0x45, 0x11, 0x90, 0x45, 0x12, 0x98, 0x45, 0x15, 0x9E, 0x45, 0x00,
+    0x0B, 0x17, 0x00, 0x82, 0x69, 0x6E, 0x6B, 0x00, 0x12, 0x0F, 0x00, 0x81, 0x6B, 0x00, 0x12, 0x1A,
+    0x00, 0x81, 0x6B, 0x00, 0x46, 0x5F, 0x45, 0x0C, 0xF5, 0x43, 0x12, 0x98, 0x45, 0x15, 0x9E, 0x45,
+    0x00, 0x46, 0x5F, 0x45, 0x0C, 0xC4, 0x45, 0x0F, 0xCA, 0x45, 0x12, 0x98, 0x45, 0x15, 0x9E, 0x45,
+    0x1C, 0xD7, 0x45, 0x00, 0x17, 0x16, 0x00, 0x80, 0x6C, 0x00, 0x0C, 0x00, 0x57, 0xD3, 0x45, 0x1A,
+    0x8A, 0x15, 0x00, 0x16, 0x00, 0x80, 0x00, 0x11, 0x0C, 0x19, 0x00, 0x80, 0x00, 0x48, 0x91, 0x15,
+    0x0C, 0xF5, 0x43, 0x11, 0x3F, 0x0A, 0x12, 0x8E, 0x43, 0x00, 0x45, 0x03, 0x46, 0x0B, 0x0B, 0x46,
+    0x0C, 0x1E, 0x46, 0x0D, 0x03, 0x46, 0x0E, 0x90, 0x45, 0x10, 0x03, 0x46, 0x12, 0x8F, 0x46, 0x18,
+    0x8F, 0x46, 0x00, 0x0C, 0x0B, 0x17, 0x00, 0x82, 0x6E, 0x6B, 0x00, 0x0C, 0x00, 0x4B, 0x14, 0x46,
+    0x17, 0x18, 0x46, 0x00, 0x57, 0x07, 0x46, 0x00, 0x83, 0x68, 0x69, 0x6E, 0x6B, 0x00, 0x45, 0x3D,
+    0x46, 0x0A, 0x3D, 0x46, 0x0B, 0x4B, 0x46, 0x0D, 0x3D, 0x46, 0x0E, 0x85, 0x46, 0x11, 0x3D, 0x46,
+    0x12, 0x85, 0x46, 0x17, 0x8B, 0x46, 0x18, 0x85, 0x46, 0x1C, 0x3D, 0x46, 0x00, 0x4B, 0x44, 0x46,
+    0x17, 0x18, 0x46, 0x00, 0x17, 0x00, 0x83, 0x69, 0x6E, 0x6B, 0x00, 0x45, 0x61, 0x46, 0x0A, 0x69,
+    0x46, 0x0D, 0x61, 0x46, 0x11, 0x61, 0x46, 0x15, 0x69, 0x46, 0x17, 0x70, 0x46, 0x1C, 0x69, 0x46,
+    0x00, 0x17, 0x00, 0x84, 0x68, 0x69, 0x6E, 0x6B, 0x00, 0x84, 0x74, 0x68, 0x69, 0x6E, 0x6B, 0x00,
+    0x4A, 0x7A, 0x46, 0x15, 0x81, 0x46, 0x1C, 0x7A, 0x46, 0x00, 0x85, 0x74, 0x68, 0x69, 0x6E, 0x6B,
+    0x00, 0x6C, 0x7A, 0x46, 0x00, 0x0B, 0x00, 0x57, 0x46, 0x46, 0x00, 0x4B, 0x69, 0x46, 0x00, 0x4B,
+    0x96, 0x46, 0x0C, 0x9A, 0x46, 0x00, 0x57, 0x93, 0x45, 0x00, 0x0B, 0x00, 0x57, 0x07, 0x46, 0x00,
+    0x4C, 0xAD, 0x46, 0x0F, 0xAD, 0x46, 0x12, 0xB4, 0x46, 0x13, 0xAD, 0x46, 0x00, 0x12, 0x0F, 0x00,
+    0x82, 0x6F, 0x6B, 0x00, 0x4C, 0xC4, 0x46, 0x0E, 0xC4, 0x46, 0x0F, 0xCB, 0x46, 0x12, 0xD8, 0x46,
+    0x13, 0xC4, 0x46, 0x00, 0x0F, 0x00, 0x83, 0x6F, 0x6F, 0x6B, 0x00, 0x4E, 0xD2, 0x46, 0x12, 0xD2,
+    0x46, 0x00, 0x84, 0x6C, 0x6F, 0x6F, 0x6B, 0x00, 0x4F, 0x43, 0x0A, 0x00, 0x12, 0x12, 0x0F, 0x00,
+    0x81, 0x6B, 0x00, 0x48, 0xF9, 0x46, 0x09, 0xF9, 0x46, 0x0C, 0xF9, 0x46, 0x0F, 0xF9, 0x46, 0x12,
+    0x00, 0x47, 0x13, 0xF9, 0x46, 0x17, 0xF9, 0x46, 0x00, 0x12, 0x1A, 0x00, 0x82, 0x72, 0x6B, 0x00,
+    0x44, 0x19, 0x47, 0x08, 0x19, 0x47, 0x0C, 0x19, 0x47, 0x0F, 0x19, 0x47, 0x13, 0x19, 0x47, 0x14,
+    0x19, 0x47, 0x16, 0x19, 0x47, 0x1A, 0x20, 0x47, 0x00, 0x1A, 0x00, 0x83, 0x6F, 0x72, 0x6B, 0x00,
+    0x48, 0x2A, 0x47, 0x14, 0x2C, 0x47, 0x16, 0x2A, 0x47, 0x00, 0x2C, 0x00, 0x84, 0x77, 0x6F, 0x72,
+    0x6B, 0x00, 0x11, 0x0C, 0x19, 0x00, 0x80, 0x6C, 0x00, 0x44, 0x76, 0x47, 0x05, 0xEC, 0x4A, 0x06,
+    0x1F, 0x4D, 0x07, 0x3C, 0x4D, 0x08, 0x46, 0x4D, 0x0A, 0x4D, 0x4D, 0x0B, 0x64, 0x4D, 0x0C, 0x7F,
+    0x4D, 0x0E, 0x96, 0x4D, 0x0F, 0xBC, 0x4D, 0x11, 0xD5, 0x4E, 0x12, 0xE7, 0x4E, 0x14, 0xEB, 0x4E,
+    0x16, 0xEB, 0x4E, 0x17, 0x05, 0x4F, 0x18, 0x17, 0x4F, 0x19, 0x4D, 0x4D, 0x1A, 0xEB, 0x4E, 0x1C,
+    0x2E, 0x4F, 0x1D, 0xEB, 0x4E, 0x00, 0x45, 0xA1, 0x47, 0x06, 0xAB, 0x47, 0x07, 0xE2, 0x49, 0x0C,
+    0x01, 0x4A, 0x0D, 0x32, 0x4A, 0x14, 0x39, 0x4A, 0x16, 0x40, 0x4A, 0x17, 0x4A, 0x4A, 0x18, 0x62,
+    0x4A, 0x19, 0xE2, 0x49, 0x1A, 0x39, 0x4A, 0x1B, 0xE2, 0x49, 0x1C, 0x32, 0x4A, 0x1D, 0x39, 0x4A,
+    0x00, 0x05, 0x12, 0x15, 0x13, 0x00, 0x82, 0x61, 0x62, 0x6C, 0x00, 0x47, 0xC7, 0x47, 0x0C, 0xD4,
+    0x47, 0x0E, 0xAA, 0x49, 0x11, 0xC7, 0x49, 0x12, 0xAA, 0x49, 0x16, 0xC7, 0x47, 0x18, 0xAA, 0x49,
+    0x19, 0xC7, 0x47, 0x1B, 0xC7, 0x47, 0x00, 0x0C, 0x11, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x83,
+    0x63, 0x61, 0x6C, 0x00, 0x44, 0xF0, 0x47, 0x05, 0x0F, 0x48, 0x0B, 0x0F, 0x48, 0x0D, 0x0F, 0x48,
+    0x0E, 0x2E, 0x48, 0x10, 0x0F, 0x48, 0x11, 0x38, 0x48, 0x12, 0x2E, 0x48, 0x18, 0x2E, 0x48, 0x00,
+    0x4B, 0xF7, 0x47, 0x11, 0x02, 0x48, 0x00, 0x06, 0x08, 0x10, 0x00, 0x83, 0x6E, 0x69, 0x63, 0x61,
+    0x6C, 0x00, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x85, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x44,
+    0x16, 0x48, 0x11, 0x22, 0x48, 0x00, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x84, 0x6E, 0x69, 0x63, 0x61,
+    0x6C, 0x00, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x84, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x11, 0x04,
+    0x0B, 0x06, 0x08, 0x00, 0x50, 0x28, 0x48, 0x00, 0x44, 0x54, 0x48, 0x05, 0x67, 0x49, 0x0B, 0x74,
+    0x49, 0x0D, 0x67, 0x49, 0x10, 0x67, 0x49, 0x14, 0x94, 0x49, 0x16, 0x94, 0x49, 0x1A, 0x94, 0x49,
+    0x1D, 0x94, 0x49, 0x00, 0x45, 0x76, 0x48, 0x06, 0x95, 0x48, 0x0A, 0x76, 0x48, 0x0B, 0xB4, 0x48,
+    0x0D, 0x76, 0x48, 0x11, 0x76, 0x48, 0x14, 0x5F, 0x49, 0x16, 0x5F, 0x49, 0x1A, 0x5F, 0x49, 0x1C,
+    0x76, 0x48, 0x1D, 0x5F, 0x49, 0x00, 0x46, 0x7D, 0x48, 0x0B, 0x89, 0x48, 0x00, 0x08, 0x10, 0x00,
+    0x86, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x06, 0x08, 0x10, 0x00, 0x86, 0x61, 0x6E,
+    0x69, 0x63, 0x61, 0x6C, 0x00, 0x48, 0x9C, 0x48, 0x0B, 0xA7, 0x48, 0x00, 0x10, 0x00, 0x85, 0x68,
+    0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x08, 0x10, 0x00, 0x87, 0x63, 0x68, 0x61, 0x6E, 0x69,
+    0x63, 0x61, 0x6C, 0x00, 0x45, 0xD6, 0x48, 0x06, 0xE3, 0x48, 0x07, 0x39, 0x49, 0x08, 0x4A, 0x49,
+    0x0A, 0xD6, 0x48, 0x0D, 0xD6, 0x48, 0x11, 0xD6, 0x48, 0x16, 0x39, 0x49, 0x19, 0x39, 0x49, 0x1B,
+    0x39, 0x49, 0x1C, 0xD6, 0x48, 0x00, 0x06, 0x08, 0x10, 0x00, 0x87, 0x68, 0x61, 0x6E, 0x69, 0x63,
+    0x61, 0x6C, 0x00, 0x47, 0xFC, 0x48, 0x08, 0x1A, 0x49, 0x10, 0x28, 0x49, 0x15, 0xFC, 0x48, 0x16,
+    0x33, 0x49, 0x19, 0x33, 0x49, 0x1A, 0xFC, 0x48, 0x1B, 0x33, 0x49, 0x00, 0x48, 0x03, 0x49, 0x10,
+    0x0F, 0x49, 0x00, 0x10, 0x00, 0x88, 0x63, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x88,
+    0x65, 0x63, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x2C, 0x00, 0x88, 0x6D, 0x65, 0x63,
+    0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x87, 0x65, 0x63, 0x68, 0x61, 0x6E, 0x69, 0x63,
+    0x61, 0x6C, 0x00, 0x08, 0x00, 0x50, 0x05, 0x49, 0x00, 0x46, 0x40, 0x49, 0x08, 0x46, 0x49, 0x00,
+    0x08, 0x00, 0x50, 0xDA, 0x48, 0x00, 0x50, 0xAA, 0x48, 0x00, 0x46, 0x51, 0x49, 0x10, 0x55, 0x49,
+    0x00, 0x50, 0x0F, 0x49, 0x00, 0x86, 0x63, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x0B,
+    0x06, 0x08, 0x00, 0x50, 0x8D, 0x48, 0x00, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x85, 0x6E, 0x69,
+    0x63, 0x61, 0x6C, 0x00, 0x44, 0x7B, 0x49, 0x06, 0x89, 0x49, 0x00, 0x46, 0x7D, 0x48, 0x0B, 0x82,
+    0x49, 0x00, 0x06, 0x08, 0x00, 0x50, 0x6D, 0x49, 0x00, 0x08, 0x10, 0x00, 0x84, 0x61, 0x6E, 0x69,
+    0x63, 0x61, 0x6C, 0x00, 0x44, 0x9B, 0x49, 0x0B, 0xA3, 0x49, 0x00, 0x0B, 0x06, 0x08, 0x00, 0x50,
+    0x6D, 0x49, 0x00, 0x06, 0x08, 0x00, 0x50, 0x07, 0x48, 0x00, 0x4C, 0xB1, 0x49, 0x11, 0xBB, 0x49,
+    0x00, 0x11, 0x04, 0x0B, 0x06, 0x08, 0x00, 0x50, 0xCF, 0x47, 0x00, 0x04, 0x0B, 0x06, 0x08, 0x10,
+    0x00, 0x83, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x44, 0xCE, 0x49, 0x0C, 0xD9, 0x49, 0x00, 0x0B, 0x06,
+    0x08, 0x10, 0x00, 0x82, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x04, 0x0B, 0x06, 0x08, 0x00, 0x50, 0x1B,
+    0x48, 0x00, 0x46, 0xE9, 0x49, 0x0C, 0xF5, 0x49, 0x00, 0x0C, 0x11, 0x04, 0x0B, 0x06, 0x08, 0x10,
     0x00, 0x82, 0x61, 0x6C, 0x00, 0x11, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x82, 0x63, 0x61, 0x6C,
-    0x00, 0x57, 0xF8, 0x86, 0x18, 0x00, 0x87, 0x00, 0x06, 0x04, 0x00, 0x82, 0x75, 0x61, 0x6C, 0x00,
-    0x17, 0x06, 0x04, 0x00, 0x82, 0x61, 0x6C, 0x00, 0x46, 0x0F, 0x87, 0x18, 0x1B, 0x87, 0x00, 0x0C,
-    0x11, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x82, 0x61, 0x6C, 0x00, 0x17, 0x06, 0x04, 0x00, 0x82,
-    0x61, 0x6C, 0x00, 0x44, 0x4E, 0x87, 0x05, 0x2F, 0x89, 0x0A, 0x48, 0x89, 0x0B, 0x61, 0x89, 0x0C,
-    0x7A, 0x89, 0x0E, 0x5E, 0x8B, 0x11, 0x77, 0x8B, 0x12, 0x90, 0x8B, 0x14, 0xA9, 0x8B, 0x16, 0xC2,
-    0x8B, 0x18, 0xF3, 0x8B, 0x19, 0x0C, 0x8C, 0x1A, 0x25, 0x8C, 0x1D, 0x3E, 0x8C, 0x00, 0x45, 0x6D,
-    0x87, 0x0A, 0x99, 0x88, 0x0B, 0xB2, 0x88, 0x11, 0xCB, 0x88, 0x12, 0xE4, 0x88, 0x14, 0xFD, 0x88,
-    0x16, 0x07, 0x89, 0x19, 0x11, 0x89, 0x1A, 0x1B, 0x89, 0x1D, 0x25, 0x89, 0x00, 0x4A, 0x89, 0x87,
-    0x0B, 0x93, 0x87, 0x0C, 0x9D, 0x87, 0x0F, 0xB6, 0x87, 0x11, 0xCF, 0x87, 0x12, 0xD9, 0x87, 0x13,
-    0x5E, 0x88, 0x15, 0x77, 0x88, 0x19, 0x8F, 0x88, 0x00, 0x12, 0x15, 0x13, 0x00, 0x84, 0x62, 0x61,
-    0x62, 0x6C, 0x00, 0x12, 0x15, 0x13, 0x00, 0x84, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x52, 0xA4, 0x87,
-    0x15, 0xAD, 0x87, 0x00, 0x15, 0x13, 0x00, 0x84, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x13, 0x00, 0x84,
-    0x6F, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x52, 0xBD, 0x87, 0x15, 0xC6, 0x87, 0x00, 0x15, 0x13, 0x00,
-    0x84, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x13, 0x00, 0x84, 0x6F, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x12,
-    0x15, 0x13, 0x00, 0x84, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x48, 0xEF, 0x87, 0x09, 0x07, 0x88, 0x0C,
-    0x1F, 0x88, 0x0F, 0x29, 0x88, 0x13, 0x33, 0x88, 0x15, 0x3B, 0x88, 0x17, 0x46, 0x88, 0x00, 0x53,
-    0xF6, 0x87, 0x15, 0xFE, 0x87, 0x00, 0x85, 0x72, 0x6F, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x13, 0x00,
-    0x85, 0x6F, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x53, 0x0E, 0x88, 0x15, 0x16, 0x88, 0x00, 0x85, 0x72,
-    0x6F, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x13, 0x00, 0x85, 0x6F, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x15,
-    0x13, 0x00, 0x85, 0x6F, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x15, 0x13, 0x00, 0x85, 0x6F, 0x62, 0x61,
-    0x62, 0x6C, 0x00, 0x84, 0x72, 0x6F, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x2C, 0x00, 0x85, 0x70, 0x72,
-    0x6F, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x53, 0x4D, 0x88, 0x15, 0x55, 0x88, 0x00, 0x85, 0x72, 0x6F,
-    0x62, 0x61, 0x62, 0x6C, 0x00, 0x13, 0x00, 0x85, 0x6F, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x52, 0x65,
-    0x88, 0x15, 0x6E, 0x88, 0x00, 0x15, 0x13, 0x00, 0x84, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x13, 0x00,
-    0x84, 0x6F, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x52, 0x7E, 0x88, 0x13, 0x88, 0x88, 0x00, 0x13, 0x00,
-    0x85, 0x72, 0x6F, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x83, 0x6F, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x12,
-    0x15, 0x13, 0x00, 0x84, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x45, 0xA0, 0x88, 0x12, 0xA9, 0x88, 0x00,
-    0x12, 0x15, 0x13, 0x00, 0x83, 0x61, 0x62, 0x6C, 0x00, 0x15, 0x13, 0x00, 0x83, 0x62, 0x61, 0x62,
-    0x6C, 0x00, 0x45, 0xB9, 0x88, 0x12, 0xC2, 0x88, 0x00, 0x12, 0x15, 0x13, 0x00, 0x83, 0x61, 0x62,
-    0x6C, 0x00, 0x15, 0x13, 0x00, 0x83, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x45, 0xD2, 0x88, 0x12, 0xDB,
-    0x88, 0x00, 0x12, 0x15, 0x13, 0x00, 0x83, 0x61, 0x62, 0x6C, 0x00, 0x15, 0x13, 0x00, 0x83, 0x62,
-    0x61, 0x62, 0x6C, 0x00, 0x45, 0xEB, 0x88, 0x15, 0xF5, 0x88, 0x00, 0x15, 0x13, 0x00, 0x84, 0x6F,
-    0x62, 0x61, 0x62, 0x6C, 0x00, 0x13, 0x00, 0x82, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x05, 0x12, 0x15,
-    0x13, 0x00, 0x83, 0x61, 0x62, 0x6C, 0x00, 0x05, 0x12, 0x15, 0x13, 0x00, 0x83, 0x61, 0x62, 0x6C,
-    0x00, 0x05, 0x12, 0x15, 0x13, 0x00, 0x83, 0x61, 0x62, 0x6C, 0x00, 0x05, 0x12, 0x15, 0x13, 0x00,
-    0x83, 0x61, 0x62, 0x6C, 0x00, 0x05, 0x12, 0x15, 0x13, 0x00, 0x83, 0x61, 0x62, 0x6C, 0x00, 0x44,
-    0x36, 0x89, 0x12, 0x40, 0x89, 0x00, 0x12, 0x15, 0x13, 0x00, 0x83, 0x62, 0x61, 0x62, 0x6C, 0x00,
-    0x15, 0x13, 0x00, 0x81, 0x61, 0x62, 0x6C, 0x00, 0x44, 0x4F, 0x89, 0x0C, 0x58, 0x89, 0x00, 0x05,
-    0x12, 0x15, 0x13, 0x00, 0x82, 0x62, 0x6C, 0x00, 0x16, 0x16, 0x12, 0x13, 0x00, 0x82, 0x62, 0x6C,
-    0x00, 0x44, 0x68, 0x89, 0x0C, 0x71, 0x89, 0x00, 0x05, 0x12, 0x15, 0x13, 0x00, 0x82, 0x62, 0x6C,
-    0x00, 0x16, 0x16, 0x12, 0x13, 0x00, 0x82, 0x62, 0x6C, 0x00, 0x44, 0x96, 0x89, 0x07, 0xAF, 0x89,
-    0x08, 0xC8, 0x89, 0x0E, 0xE1, 0x89, 0x12, 0xEB, 0x89, 0x16, 0xF5, 0x89, 0x18, 0x22, 0x8B, 0x1A,
-    0x2C, 0x8B, 0x1B, 0x45, 0x8B, 0x00, 0x16, 0x00, 0x52, 0x9F, 0x89, 0x16, 0xA7, 0x89, 0x00, 0x13,
-    0x00, 0x83, 0x73, 0x69, 0x62, 0x6C, 0x00, 0x12, 0x13, 0x00, 0x83, 0x69, 0x62, 0x6C, 0x00, 0x16,
-    0x00, 0x52, 0xB8, 0x89, 0x16, 0xC0, 0x89, 0x00, 0x13, 0x00, 0x83, 0x73, 0x69, 0x62, 0x6C, 0x00,
-    0x12, 0x13, 0x00, 0x83, 0x69, 0x62, 0x6C, 0x00, 0x16, 0x00, 0x52, 0xD1, 0x89, 0x16, 0xD9, 0x89,
+    0x00, 0x46, 0x0E, 0x4A, 0x11, 0x18, 0x4A, 0x17, 0x23, 0x4A, 0x18, 0x2B, 0x4A, 0x00, 0x11, 0x04,
+    0x0B, 0x06, 0x08, 0x00, 0x50, 0xC1, 0x49, 0x00, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x81, 0x63,
+    0x61, 0x6C, 0x00, 0x06, 0x04, 0x00, 0x82, 0x75, 0x61, 0x6C, 0x00, 0x17, 0x06, 0x00, 0x44, 0xF1,
+    0x49, 0x00, 0x57, 0x23, 0x4A, 0x18, 0x2B, 0x4A, 0x00, 0x46, 0xE9, 0x49, 0x18, 0x2B, 0x4A, 0x00,
+    0x46, 0xE9, 0x49, 0x0C, 0xF5, 0x49, 0x18, 0x2B, 0x4A, 0x00, 0x46, 0x51, 0x4A, 0x18, 0x59, 0x4A,
+    0x00, 0x04, 0x2C, 0x00, 0x81, 0x75, 0x61, 0x6C, 0x00, 0x06, 0x04, 0x00, 0x83, 0x74, 0x75, 0x61,
+    0x6C, 0x00, 0x46, 0x78, 0x4A, 0x0A, 0x90, 0x4A, 0x0C, 0xA3, 0x4A, 0x0D, 0xA3, 0x4A, 0x15, 0x90,
+    0x4A, 0x17, 0xAA, 0x4A, 0x1C, 0x90, 0x4A, 0x00, 0x44, 0x7F, 0x4A, 0x17, 0x87, 0x4A, 0x00, 0x2C,
+    0x00, 0x82, 0x74, 0x75, 0x61, 0x6C, 0x00, 0x04, 0x00, 0x84, 0x63, 0x74, 0x75, 0x61, 0x6C, 0x00,
+    0x46, 0x97, 0x4A, 0x17, 0x9B, 0x4A, 0x00, 0x44, 0x5C, 0x4A, 0x00, 0x06, 0x04, 0x00, 0x83, 0x75,
+    0x61, 0x6C, 0x00, 0x17, 0x06, 0x00, 0x44, 0x9E, 0x4A, 0x00, 0x44, 0xC6, 0x4A, 0x06, 0xCD, 0x4A,
+    0x07, 0xD7, 0x4A, 0x0A, 0xE6, 0x4A, 0x15, 0xE6, 0x4A, 0x16, 0xD7, 0x4A, 0x19, 0xD7, 0x4A, 0x1B,
+    0xD7, 0x4A, 0x1C, 0xE6, 0x4A, 0x00, 0x83, 0x63, 0x74, 0x75, 0x61, 0x6C, 0x00, 0x2C, 0x00, 0x84,
+    0x61, 0x63, 0x74, 0x75, 0x61, 0x6C, 0x00, 0x44, 0x89, 0x4A, 0x06, 0xDE, 0x4A, 0x00, 0x04, 0x00,
+    0x84, 0x74, 0x75, 0x61, 0x6C, 0x00, 0x06, 0x00, 0x44, 0xE0, 0x4A, 0x00, 0x44, 0x17, 0x4B, 0x05,
+    0xFE, 0x4B, 0x0A, 0x14, 0x4C, 0x0B, 0x14, 0x4C, 0x0C, 0x2C, 0x4C, 0x0E, 0xE5, 0x4C, 0x11, 0x14,
+    0x4C, 0x12, 0xE5, 0x4C, 0x14, 0xF5, 0x4C, 0x16, 0x03, 0x4D, 0x18, 0xE5, 0x4C, 0x19, 0x14, 0x4C,
+    0x1A, 0xF5, 0x4C, 0x1D, 0xF5, 0x4C, 0x00, 0x45, 0x36, 0x4B, 0x0A, 0xC8, 0x4B, 0x0B, 0xC8, 0x4B,
+    0x11, 0xC8, 0x4B, 0x12, 0xE1, 0x4B, 0x14, 0xF6, 0x4B, 0x16, 0xF6, 0x4B, 0x19, 0xF6, 0x4B, 0x1A,
+    0xF6, 0x4B, 0x1D, 0xF6, 0x4B, 0x00, 0x4A, 0x52, 0x4B, 0x0B, 0x52, 0x4B, 0x0C, 0x59, 0x4B, 0x0F,
+    0x59, 0x4B, 0x11, 0x52, 0x4B, 0x12, 0x6F, 0x4B, 0x13, 0x59, 0x4B, 0x15, 0xB6, 0x4B, 0x19, 0x52,
+    0x4B, 0x00, 0x12, 0x15, 0x00, 0x53, 0xD1, 0x09, 0x00, 0x52, 0x60, 0x4B, 0x15, 0x66, 0x4B, 0x00,
+    0x15, 0x00, 0x53, 0xD1, 0x09, 0x00, 0x13, 0x00, 0x84, 0x6F, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x48,
+    0x85, 0x4B, 0x09, 0x85, 0x4B, 0x0C, 0x9D, 0x4B, 0x0F, 0x9D, 0x4B, 0x13, 0xA3, 0x4B, 0x15, 0xAB,
+    0x4B, 0x17, 0x85, 0x4B, 0x00, 0x53, 0x8C, 0x4B, 0x15, 0x94, 0x4B, 0x00, 0x85, 0x72, 0x6F, 0x62,
+    0x61, 0x62, 0x6C, 0x00, 0x13, 0x00, 0x85, 0x6F, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x15, 0x00, 0x53,
+    0x96, 0x4B, 0x00, 0x84, 0x72, 0x6F, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x2C, 0x00, 0x85, 0x70, 0x72,
+    0x6F, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x52, 0xBD, 0x4B, 0x13, 0xC1, 0x4B, 0x00, 0x53, 0x8C, 0x4B,
+    0x00, 0x83, 0x6F, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x45, 0xCF, 0x4B, 0x12, 0xD8, 0x4B, 0x00, 0x12,
+    0x15, 0x13, 0x00, 0x83, 0x61, 0x62, 0x6C, 0x00, 0x15, 0x13, 0x00, 0x83, 0x62, 0x61, 0x62, 0x6C,
+    0x00, 0x45, 0xE8, 0x4B, 0x15, 0xEE, 0x4B, 0x00, 0x15, 0x00, 0x53, 0x68, 0x4B, 0x00, 0x13, 0x00,
+    0x82, 0x62, 0x61, 0x62, 0x6C, 0x00, 0x05, 0x12, 0x15, 0x00, 0x53, 0xD3, 0x4B, 0x00, 0x44, 0x05,
+    0x4C, 0x12, 0x0C, 0x4C, 0x00, 0x12, 0x15, 0x00, 0x53, 0xDB, 0x4B, 0x00, 0x15, 0x13, 0x00, 0x81,
+    0x61, 0x62, 0x6C, 0x00, 0x44, 0x1B, 0x4C, 0x0C, 0x24, 0x4C, 0x00, 0x05, 0x12, 0x15, 0x13, 0x00,
+    0x82, 0x62, 0x6C, 0x00, 0x16, 0x16, 0x12, 0x00, 0x53, 0x20, 0x4C, 0x00, 0x44, 0x48, 0x4C, 0x07,
+    0x48, 0x4C, 0x08, 0x48, 0x4C, 0x0E, 0x61, 0x4C, 0x12, 0x61, 0x4C, 0x16, 0x69, 0x4C, 0x18, 0x61,
+    0x4C, 0x1A, 0x48, 0x4C, 0x1B, 0x48, 0x4C, 0x00, 0x16, 0x00, 0x52, 0x51, 0x4C, 0x16, 0x59, 0x4C,
     0x00, 0x13, 0x00, 0x83, 0x73, 0x69, 0x62, 0x6C, 0x00, 0x12, 0x13, 0x00, 0x83, 0x69, 0x62, 0x6C,
-    0x00, 0x16, 0x16, 0x12, 0x13, 0x00, 0x83, 0x69, 0x62, 0x6C, 0x00, 0x16, 0x16, 0x12, 0x13, 0x00,
-    0x83, 0x69, 0x62, 0x6C, 0x00, 0x44, 0x0B, 0x8A, 0x07, 0x24, 0x8A, 0x08, 0x3D, 0x8A, 0x12, 0x56,
-    0x8A, 0x16, 0x6D, 0x8A, 0x1A, 0xF0, 0x8A, 0x1B, 0x09, 0x8B, 0x00, 0x52, 0x12, 0x8A, 0x16, 0x1B,
-    0x8A, 0x00, 0x13, 0x00, 0x84, 0x73, 0x73, 0x69, 0x62, 0x6C, 0x00, 0x12, 0x13, 0x00, 0x84, 0x73,
-    0x69, 0x62, 0x6C, 0x00, 0x52, 0x2B, 0x8A, 0x16, 0x34, 0x8A, 0x00, 0x13, 0x00, 0x84, 0x73, 0x73,
-    0x69, 0x62, 0x6C, 0x00, 0x12, 0x13, 0x00, 0x84, 0x73, 0x69, 0x62, 0x6C, 0x00, 0x52, 0x44, 0x8A,
-    0x16, 0x4D, 0x8A, 0x00, 0x13, 0x00, 0x84, 0x73, 0x73, 0x69, 0x62, 0x6C, 0x00, 0x12, 0x13, 0x00,
-    0x84, 0x73, 0x69, 0x62, 0x6C, 0x00, 0x53, 0x5D, 0x8A, 0x16, 0x63, 0x8A, 0x00, 0x82, 0x73, 0x69,
-    0x62, 0x6C, 0x00, 0x13, 0x00, 0x85, 0x6F, 0x73, 0x73, 0x69, 0x62, 0x6C, 0x00, 0x44, 0x86, 0x8A,
-    0x07, 0x90, 0x8A, 0x08, 0x9A, 0x8A, 0x0C, 0xA4, 0x8A, 0x0F, 0xBC, 0x8A, 0x13, 0xD4, 0x8A, 0x1A,
-    0xDC, 0x8A, 0x1B, 0xE6, 0x8A, 0x00, 0x12, 0x13, 0x00, 0x85, 0x73, 0x73, 0x69, 0x62, 0x6C, 0x00,
-    0x12, 0x13, 0x00, 0x85, 0x73, 0x73, 0x69, 0x62, 0x6C, 0x00, 0x12, 0x13, 0x00, 0x85, 0x73, 0x73,
-    0x69, 0x62, 0x6C, 0x00, 0x52, 0xAB, 0x8A, 0x13, 0xB4, 0x8A, 0x00, 0x13, 0x00, 0x85, 0x73, 0x73,
-    0x69, 0x62, 0x6C, 0x00, 0x85, 0x6F, 0x73, 0x73, 0x69, 0x62, 0x6C, 0x00, 0x52, 0xC3, 0x8A, 0x13,
-    0xCC, 0x8A, 0x00, 0x13, 0x00, 0x85, 0x73, 0x73, 0x69, 0x62, 0x6C, 0x00, 0x85, 0x6F, 0x73, 0x73,
-    0x69, 0x62, 0x6C, 0x00, 0x84, 0x6F, 0x73, 0x73, 0x69, 0x62, 0x6C, 0x00, 0x12, 0x13, 0x00, 0x85,
-    0x73, 0x73, 0x69, 0x62, 0x6C, 0x00, 0x12, 0x13, 0x00, 0x85, 0x73, 0x73, 0x69, 0x62, 0x6C, 0x00,
-    0x52, 0xF7, 0x8A, 0x16, 0x00, 0x8B, 0x00, 0x13, 0x00, 0x84, 0x73, 0x73, 0x69, 0x62, 0x6C, 0x00,
-    0x12, 0x13, 0x00, 0x84, 0x73, 0x69, 0x62, 0x6C, 0x00, 0x52, 0x10, 0x8B, 0x16, 0x19, 0x8B, 0x00,
-    0x13, 0x00, 0x84, 0x73, 0x73, 0x69, 0x62, 0x6C, 0x00, 0x12, 0x13, 0x00, 0x84, 0x73, 0x69, 0x62,
-    0x6C, 0x00, 0x16, 0x16, 0x12, 0x13, 0x00, 0x83, 0x69, 0x62, 0x6C, 0x00, 0x16, 0x00, 0x52, 0x35,
-    0x8B, 0x16, 0x3D, 0x8B, 0x00, 0x13, 0x00, 0x83, 0x73, 0x69, 0x62, 0x6C, 0x00, 0x12, 0x13, 0x00,
-    0x83, 0x69, 0x62, 0x6C, 0x00, 0x16, 0x00, 0x52, 0x4E, 0x8B, 0x16, 0x56, 0x8B, 0x00, 0x13, 0x00,
-    0x83, 0x73, 0x69, 0x62, 0x6C, 0x00, 0x12, 0x13, 0x00, 0x83, 0x69, 0x62, 0x6C, 0x00, 0x4C, 0x65,
-    0x8B, 0x16, 0x6E, 0x8B, 0x00, 0x16, 0x16, 0x12, 0x13, 0x00, 0x82, 0x62, 0x6C, 0x00, 0x16, 0x12,
-    0x13, 0x00, 0x82, 0x69, 0x62, 0x6C, 0x00, 0x44, 0x7E, 0x8B, 0x0C, 0x87, 0x8B, 0x00, 0x05, 0x12,
-    0x15, 0x13, 0x00, 0x82, 0x62, 0x6C, 0x00, 0x16, 0x16, 0x12, 0x13, 0x00, 0x82, 0x62, 0x6C, 0x00,
-    0x4C, 0x97, 0x8B, 0x16, 0xA0, 0x8B, 0x00, 0x16, 0x16, 0x12, 0x13, 0x00, 0x82, 0x62, 0x6C, 0x00,
-    0x16, 0x12, 0x13, 0x00, 0x82, 0x69, 0x62, 0x6C, 0x00, 0x44, 0xB0, 0x8B, 0x05, 0xB9, 0x8B, 0x00,
-    0x05, 0x12, 0x15, 0x13, 0x00, 0x82, 0x62, 0x6C, 0x00, 0x12, 0x15, 0x13, 0x00, 0x82, 0x61, 0x62,
-    0x6C, 0x00, 0x44, 0xCF, 0x8B, 0x05, 0xD8, 0x8B, 0x0C, 0xE1, 0x8B, 0x16, 0xEB, 0x8B, 0x00, 0x05,
-    0x12, 0x15, 0x13, 0x00, 0x82, 0x62, 0x6C, 0x00, 0x12, 0x15, 0x13, 0x00, 0x82, 0x61, 0x62, 0x6C,
-    0x00, 0x16, 0x12, 0x13, 0x00, 0x83, 0x73, 0x69, 0x62, 0x6C, 0x00, 0x12, 0x13, 0x00, 0x81, 0x69,
-    0x62, 0x6C, 0x00, 0x4C, 0xFA, 0x8B, 0x16, 0x03, 0x8C, 0x00, 0x16, 0x16, 0x12, 0x13, 0x00, 0x82,
-    0x62, 0x6C, 0x00, 0x16, 0x12, 0x13, 0x00, 0x82, 0x69, 0x62, 0x6C, 0x00, 0x44, 0x13, 0x8C, 0x0C,
-    0x1C, 0x8C, 0x00, 0x05, 0x12, 0x15, 0x13, 0x00, 0x82, 0x62, 0x6C, 0x00, 0x16, 0x16, 0x12, 0x13,
-    0x00, 0x82, 0x62, 0x6C, 0x00, 0x44, 0x2C, 0x8C, 0x05, 0x35, 0x8C, 0x00, 0x05, 0x12, 0x15, 0x13,
-    0x00, 0x82, 0x62, 0x6C, 0x00, 0x12, 0x15, 0x13, 0x00, 0x82, 0x61, 0x62, 0x6C, 0x00, 0x44, 0x45,
-    0x8C, 0x05, 0x4E, 0x8C, 0x00, 0x05, 0x12, 0x15, 0x13, 0x00, 0x82, 0x62, 0x6C, 0x00, 0x12, 0x15,
-    0x13, 0x00, 0x82, 0x61, 0x62, 0x6C, 0x00, 0x44, 0x5E, 0x8C, 0x0C, 0x6B, 0x8C, 0x00, 0x0C, 0x11,
-    0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x82, 0x63, 0x61, 0x6C, 0x00, 0x11, 0x04, 0x0B, 0x06, 0x08,
-    0x10, 0x00, 0x80, 0x61, 0x6C, 0x00, 0x18, 0x12, 0x00, 0x46, 0x80, 0x8C, 0x1A, 0x84, 0x8C, 0x00,
-    0x81, 0x6C, 0x64, 0x00, 0x81, 0x6C, 0x64, 0x00, 0x0C, 0x0B, 0x1A, 0x00, 0x81, 0x6C, 0x65, 0x00,
-    0x44, 0x97, 0x8C, 0x0C, 0xA0, 0x8C, 0x00, 0x05, 0x12, 0x15, 0x13, 0x00, 0x81, 0x62, 0x6C, 0x00,
-    0x16, 0x16, 0x12, 0x13, 0x00, 0x81, 0x62, 0x6C, 0x00, 0x44, 0xB6, 0x8C, 0x0C, 0xBF, 0x8C, 0x11,
-    0xC8, 0x8C, 0x1C, 0xCF, 0x8C, 0x00, 0x05, 0x12, 0x15, 0x13, 0x00, 0x81, 0x62, 0x6C, 0x00, 0x16,
-    0x16, 0x12, 0x13, 0x00, 0x81, 0x62, 0x6C, 0x00, 0x0C, 0x19, 0x00, 0x81, 0x79, 0x6C, 0x00, 0x11,
-    0x0C, 0x19, 0x00, 0x81, 0x6C, 0x00, 0x45, 0xDD, 0x8C, 0x16, 0xE7, 0x8C, 0x00, 0x16, 0x16, 0x12,
-    0x13, 0x00, 0x82, 0x69, 0x62, 0x6C, 0x00, 0x16, 0x12, 0x13, 0x00, 0x80, 0x62, 0x6C, 0x00, 0x46,
-    0xFC, 0x8C, 0x0C, 0x0B, 0x8D, 0x0F, 0x12, 0x8D, 0x12, 0x23, 0x8D, 0x00, 0x4C, 0x03, 0x8D, 0x18,
-    0x07, 0x8D, 0x00, 0x07, 0x00, 0x80, 0x00, 0x09, 0x00, 0x80, 0x00, 0x17, 0x16, 0x00, 0x81, 0x6C,
-    0x6C, 0x00, 0x48, 0x19, 0x8D, 0x0C, 0x1E, 0x8D, 0x00, 0x1A, 0x00, 0x81, 0x6C, 0x00, 0x1A, 0x00,
-    0x81, 0x6C, 0x00, 0x12, 0x0F, 0x00, 0x80, 0x00, 0x47, 0x44, 0x8D, 0x08, 0x4B, 0x8D, 0x0C, 0xA7,
-    0x8D, 0x0E, 0x08, 0x8F, 0x12, 0x25, 0x8F, 0x15, 0x38, 0x8F, 0x17, 0x3F, 0x8F, 0x18, 0x48, 0x8F,
-    0x1A, 0x5B, 0x8F, 0x00, 0x08, 0x1A, 0x00, 0x82, 0x6C, 0x6C, 0x00, 0x44, 0x61, 0x8D, 0x07, 0x68,
-    0x8D, 0x08, 0x6F, 0x8D, 0x14, 0x75, 0x8D, 0x15, 0x7C, 0x8D, 0x16, 0x83, 0x8D, 0x1A, 0x8A, 0x8D,
-    0x00, 0x1A, 0x00, 0x83, 0x65, 0x6C, 0x6C, 0x00, 0x1A, 0x00, 0x83, 0x65, 0x6C, 0x6C, 0x00, 0x1A,
-    0x00, 0x82, 0x6C, 0x6C, 0x00, 0x1A, 0x00, 0x83, 0x65, 0x6C, 0x6C, 0x00, 0x1A, 0x00, 0x83, 0x65,
-    0x6C, 0x6C, 0x00, 0x1A, 0x00, 0x83, 0x65, 0x6C, 0x6C, 0x00, 0x48, 0x94, 0x8D, 0x14, 0x9C, 0x8D,
-    0x1A, 0xA2, 0x8D, 0x00, 0x2C, 0x00, 0x84, 0x77, 0x65, 0x6C, 0x6C, 0x00, 0x84, 0x77, 0x65, 0x6C,
-    0x6C, 0x00, 0x83, 0x65, 0x6C, 0x6C, 0x00, 0x44, 0xCC, 0x8D, 0x08, 0xD3, 0x8D, 0x0A, 0xDB, 0x8D,
-    0x0E, 0xEF, 0x8D, 0x12, 0x02, 0x8E, 0x14, 0x15, 0x8E, 0x15, 0x1C, 0x8E, 0x16, 0x30, 0x8E, 0x17,
-    0x43, 0x8E, 0x18, 0xC1, 0x8E, 0x1A, 0xD4, 0x8E, 0x1C, 0xF4, 0x8E, 0x00, 0x1A, 0x00, 0x83, 0x69,
-    0x6C, 0x6C, 0x00, 0x1A, 0x2C, 0x00, 0x83, 0x69, 0x6C, 0x6C, 0x00, 0x56, 0xE2, 0x8D, 0x17, 0xE8,
-    0x8D, 0x00, 0x83, 0x74, 0x69, 0x6C, 0x6C, 0x00, 0x16, 0x00, 0x83, 0x69, 0x6C, 0x6C, 0x00, 0x57,
-    0xF6, 0x8D, 0x1A, 0xFD, 0x8D, 0x00, 0x16, 0x00, 0x83, 0x69, 0x6C, 0x6C, 0x00, 0x83, 0x69, 0x6C,
-    0x6C, 0x00, 0x57, 0x09, 0x8E, 0x1A, 0x10, 0x8E, 0x00, 0x16, 0x00, 0x83, 0x69, 0x6C, 0x6C, 0x00,
-    0x83, 0x69, 0x6C, 0x6C, 0x00, 0x1A, 0x00, 0x83, 0x69, 0x6C, 0x6C, 0x00, 0x56, 0x23, 0x8E, 0x17,
-    0x29, 0x8E, 0x00, 0x83, 0x74, 0x69, 0x6C, 0x6C, 0x00, 0x16, 0x00, 0x83, 0x69, 0x6C, 0x6C, 0x00,
-    0x57, 0x37, 0x8E, 0x1A, 0x3E, 0x8E, 0x00, 0x84, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x00, 0x83, 0x69,
-    0x6C, 0x6C, 0x00, 0x47, 0x5C, 0x8E, 0x08, 0x63, 0x8E, 0x0A, 0x6C, 0x8E, 0x15, 0x74, 0x8E, 0x16,
-    0x7C, 0x8E, 0x1A, 0xA9, 0x8E, 0x1B, 0xB0, 0x8E, 0x1C, 0xB9, 0x8E, 0x00, 0x84, 0x73, 0x74, 0x69,
-    0x6C, 0x6C, 0x00, 0x2C, 0x00, 0x84, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x00, 0x16, 0x00, 0x84, 0x74,
-    0x69, 0x6C, 0x6C, 0x00, 0x16, 0x00, 0x84, 0x74, 0x69, 0x6C, 0x6C, 0x00, 0x47, 0x89, 0x8E, 0x08,
-    0x92, 0x8E, 0x1A, 0x9B, 0x8E, 0x1B, 0xA2, 0x8E, 0x00, 0x2C, 0x00, 0x85, 0x73, 0x74, 0x69, 0x6C,
-    0x6C, 0x00, 0x2C, 0x00, 0x85, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x00, 0x85, 0x73, 0x74, 0x69, 0x6C,
-    0x6C, 0x00, 0x85, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x00, 0x84, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x00,
-    0x2C, 0x00, 0x84, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x00, 0x16, 0x00, 0x84, 0x74, 0x69, 0x6C, 0x6C,
-    0x00, 0x57, 0xC8, 0x8E, 0x1A, 0xCF, 0x8E, 0x00, 0x16, 0x00, 0x83, 0x69, 0x6C, 0x6C, 0x00, 0x83,
-    0x69, 0x6C, 0x6C, 0x00, 0x44, 0xDE, 0x8E, 0x08, 0xE6, 0x8E, 0x14, 0xEE, 0x8E, 0x00, 0x2C, 0x00,
-    0x84, 0x77, 0x69, 0x6C, 0x6C, 0x00, 0x2C, 0x00, 0x84, 0x77, 0x69, 0x6C, 0x6C, 0x00, 0x84, 0x77,
-    0x69, 0x6C, 0x6C, 0x00, 0x56, 0xFB, 0x8E, 0x17, 0x01, 0x8F, 0x00, 0x83, 0x74, 0x69, 0x6C, 0x6C,
-    0x00, 0x16, 0x00, 0x83, 0x69, 0x6C, 0x6C, 0x00, 0x48, 0x12, 0x8F, 0x0C, 0x18, 0x8F, 0x17, 0x1E,
-    0x8F, 0x00, 0x1A, 0x00, 0x82, 0x6C, 0x6C, 0x00, 0x1A, 0x00, 0x82, 0x6C, 0x6C, 0x00, 0x16, 0x00,
-    0x82, 0x69, 0x6C, 0x6C, 0x00, 0x48, 0x2C, 0x8F, 0x0C, 0x32, 0x8F, 0x00, 0x1A, 0x00, 0x82, 0x6C,
-    0x6C, 0x00, 0x1A, 0x00, 0x82, 0x6C, 0x6C, 0x00, 0x08, 0x1A, 0x00, 0x82, 0x6C, 0x6C, 0x00, 0x0C,
-    0x16, 0x00, 0x83, 0x74, 0x69, 0x6C, 0x6C, 0x00, 0x0C, 0x00, 0x57, 0x51, 0x8F, 0x1A, 0x57, 0x8F,
-    0x00, 0x16, 0x00, 0x82, 0x6C, 0x6C, 0x00, 0x82, 0x6C, 0x6C, 0x00, 0x08, 0x1A, 0x00, 0x82, 0x6C,
-    0x6C, 0x00, 0x44, 0x6C, 0x8F, 0x0C, 0x75, 0x8F, 0x1C, 0x7E, 0x8F, 0x00, 0x05, 0x12, 0x15, 0x13,
-    0x00, 0x81, 0x62, 0x6C, 0x00, 0x16, 0x16, 0x12, 0x13, 0x00, 0x81, 0x62, 0x6C, 0x00, 0x0C, 0x19,
-    0x00, 0x82, 0x6E, 0x79, 0x6C, 0x00, 0x0F, 0x00, 0x48, 0x8F, 0x8F, 0x0C, 0x94, 0x8F, 0x00, 0x1A,
-    0x00, 0x81, 0x6C, 0x00, 0x1A, 0x00, 0x81, 0x6C, 0x00, 0x46, 0xA0, 0x8F, 0x18, 0xAC, 0x8F, 0x00,
-    0x0C, 0x11, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x81, 0x61, 0x6C, 0x00, 0x17, 0x06, 0x04, 0x00,
-    0x81, 0x61, 0x6C, 0x00, 0x46, 0xBB, 0x8F, 0x18, 0xC7, 0x8F, 0x00, 0x0C, 0x11, 0x04, 0x0B, 0x06,
-    0x08, 0x10, 0x00, 0x81, 0x61, 0x6C, 0x00, 0x17, 0x06, 0x04, 0x00, 0x81, 0x61, 0x6C, 0x00, 0x51,
-    0xD6, 0x8F, 0x1C, 0xE1, 0x8F, 0x00, 0x08, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x80, 0x6F,
-    0x00, 0x11, 0x0C, 0x19, 0x00, 0x81, 0x6C, 0x00, 0x44, 0xF2, 0x8F, 0x17, 0xFB, 0x8F, 0x1C, 0x02,
-    0x90, 0x00, 0x17, 0x06, 0x04, 0x00, 0x82, 0x75, 0x61, 0x6C, 0x00, 0x06, 0x04, 0x00, 0x80, 0x61,
-    0x6C, 0x00, 0x11, 0x0C, 0x19, 0x00, 0x81, 0x6C, 0x00, 0x44, 0x10, 0x90, 0x0C, 0x19, 0x90, 0x00,
-    0x05, 0x12, 0x15, 0x13, 0x00, 0x81, 0x62, 0x6C, 0x00, 0x16, 0x16, 0x12, 0x13, 0x00, 0x81, 0x62,
-    0x6C, 0x00, 0x46, 0x29, 0x90, 0x18, 0x35, 0x90, 0x00, 0x0C, 0x11, 0x04, 0x0B, 0x06, 0x08, 0x10,
-    0x00, 0x81, 0x61, 0x6C, 0x00, 0x17, 0x06, 0x04, 0x00, 0x81, 0x61, 0x6C, 0x00, 0x45, 0x56, 0x90,
-    0x0B, 0x6B, 0x90, 0x0C, 0x80, 0x90, 0x0D, 0x89, 0x90, 0x10, 0x9E, 0x90, 0x11, 0xB3, 0x90, 0x17,
-    0xAE, 0x91, 0x18, 0xB6, 0x91, 0x00, 0x4C, 0x5D, 0x90, 0x11, 0x64, 0x90, 0x00, 0x19, 0x00, 0x82,
-    0x6E, 0x79, 0x6C, 0x00, 0x0C, 0x19, 0x00, 0x82, 0x79, 0x6C, 0x00, 0x4C, 0x72, 0x90, 0x11, 0x79,
-    0x90, 0x00, 0x19, 0x00, 0x82, 0x6E, 0x79, 0x6C, 0x00, 0x0C, 0x19, 0x00, 0x82, 0x79, 0x6C, 0x00,
-    0x11, 0x19, 0x00, 0x83, 0x69, 0x6E, 0x79, 0x6C, 0x00, 0x4C, 0x90, 0x90, 0x11, 0x97, 0x90, 0x00,
-    0x19, 0x00, 0x82, 0x6E, 0x79, 0x6C, 0x00, 0x0C, 0x19, 0x00, 0x82, 0x79, 0x6C, 0x00, 0x4C, 0xA5,
-    0x90, 0x11, 0xAC, 0x90, 0x00, 0x19, 0x00, 0x82, 0x6E, 0x79, 0x6C, 0x00, 0x0C, 0x19, 0x00, 0x82,
-    0x79, 0x6C, 0x00, 0x45, 0xCF, 0x90, 0x0B, 0xD7, 0x90, 0x0C, 0xDF, 0x90, 0x0D, 0x59, 0x91, 0x0E,
-    0x61, 0x91, 0x10, 0x75, 0x91, 0x12, 0x7D, 0x91, 0x18, 0x91, 0x91, 0x19, 0xA5, 0x91, 0x00, 0x0C,
-    0x19, 0x00, 0x83, 0x6E, 0x79, 0x6C, 0x00, 0x0C, 0x19, 0x00, 0x83, 0x6E, 0x79, 0x6C, 0x00, 0x45,
-    0xF8, 0x90, 0x06, 0x01, 0x91, 0x09, 0x0A, 0x91, 0x0A, 0x11, 0x91, 0x0E, 0x18, 0x91, 0x12, 0x20,
-    0x91, 0x18, 0x28, 0x91, 0x19, 0x30, 0x91, 0x00, 0x2C, 0x00, 0x84, 0x76, 0x69, 0x6E, 0x79, 0x6C,
-    0x00, 0x2C, 0x00, 0x84, 0x76, 0x69, 0x6E, 0x79, 0x6C, 0x00, 0x84, 0x76, 0x69, 0x6E, 0x79, 0x6C,
-    0x00, 0x84, 0x76, 0x69, 0x6E, 0x79, 0x6C, 0x00, 0x19, 0x00, 0x84, 0x69, 0x6E, 0x79, 0x6C, 0x00,
-    0x19, 0x00, 0x84, 0x69, 0x6E, 0x79, 0x6C, 0x00, 0x19, 0x00, 0x84, 0x69, 0x6E, 0x79, 0x6C, 0x00,
-    0x45, 0x3D, 0x91, 0x06, 0x44, 0x91, 0x09, 0x4B, 0x91, 0x0A, 0x52, 0x91, 0x00, 0x85, 0x76, 0x69,
-    0x6E, 0x79, 0x6C, 0x00, 0x85, 0x76, 0x69, 0x6E, 0x79, 0x6C, 0x00, 0x85, 0x76, 0x69, 0x6E, 0x79,
-    0x6C, 0x00, 0x85, 0x76, 0x69, 0x6E, 0x79, 0x6C, 0x00, 0x0C, 0x19, 0x00, 0x83, 0x6E, 0x79, 0x6C,
-    0x00, 0x4C, 0x68, 0x91, 0x19, 0x6F, 0x91, 0x00, 0x19, 0x00, 0x83, 0x6E, 0x79, 0x6C, 0x00, 0x83,
-    0x69, 0x6E, 0x79, 0x6C, 0x00, 0x0C, 0x19, 0x00, 0x83, 0x6E, 0x79, 0x6C, 0x00, 0x4C, 0x84, 0x91,
-    0x19, 0x8B, 0x91, 0x00, 0x19, 0x00, 0x83, 0x6E, 0x79, 0x6C, 0x00, 0x83, 0x69, 0x6E, 0x79, 0x6C,
-    0x00, 0x4C, 0x98, 0x91, 0x19, 0x9F, 0x91, 0x00, 0x19, 0x00, 0x83, 0x6E, 0x79, 0x6C, 0x00, 0x83,
-    0x69, 0x6E, 0x79, 0x6C, 0x00, 0x0C, 0x00, 0x84, 0x76, 0x69, 0x6E, 0x79, 0x6C, 0x00, 0x11, 0x0C,
-    0x19, 0x00, 0x82, 0x79, 0x6C, 0x00, 0x11, 0x0C, 0x19, 0x00, 0x82, 0x79, 0x6C, 0x00, 0x46, 0xC5,
-    0x91, 0x18, 0xD1, 0x91, 0x00, 0x0C, 0x11, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x81, 0x61, 0x6C,
-    0x00, 0x17, 0x06, 0x04, 0x00, 0x81, 0x61, 0x6C, 0x00, 0x47, 0xF8, 0x91, 0x08, 0xFF, 0x91, 0x0C,
-    0x94, 0x92, 0x0D, 0x9B, 0x92, 0x0E, 0xAE, 0x92, 0x0F, 0xC1, 0x92, 0x11, 0xC8, 0x92, 0x12, 0xEC,
-    0x92, 0x13, 0xA1, 0x93, 0x1A, 0xA8, 0x93, 0x00, 0x08, 0x0B, 0x17, 0x00, 0x81, 0x6D, 0x00, 0x45,
-    0x15, 0x92, 0x07, 0x1C, 0x92, 0x0A, 0x23, 0x92, 0x0B, 0x2A, 0x92, 0x0D, 0x7F, 0x92, 0x11, 0x86,
-    0x92, 0x1A, 0x8D, 0x92, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x65, 0x6D, 0x00, 0x0B, 0x17, 0x00, 0x82,
-    0x65, 0x6D, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x65, 0x6D, 0x00, 0x45, 0x40, 0x92, 0x0A, 0x47, 0x92,
-    0x0D, 0x4E, 0x92, 0x11, 0x55, 0x92, 0x15, 0x5C, 0x92, 0x17, 0x63, 0x92, 0x1C, 0x78, 0x92, 0x00,
-    0x17, 0x00, 0x83, 0x68, 0x65, 0x6D, 0x00, 0x17, 0x00, 0x83, 0x68, 0x65, 0x6D, 0x00, 0x17, 0x00,
-    0x83, 0x68, 0x65, 0x6D, 0x00, 0x17, 0x00, 0x83, 0x68, 0x65, 0x6D, 0x00, 0x17, 0x00, 0x83, 0x68,
-    0x65, 0x6D, 0x00, 0x4A, 0x6A, 0x92, 0x1C, 0x70, 0x92, 0x00, 0x84, 0x74, 0x68, 0x65, 0x6D, 0x00,
-    0x2C, 0x00, 0x84, 0x74, 0x68, 0x65, 0x6D, 0x00, 0x17, 0x00, 0x83, 0x68, 0x65, 0x6D, 0x00, 0x0B,
-    0x17, 0x00, 0x82, 0x65, 0x6D, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x65, 0x6D, 0x00, 0x0B, 0x17, 0x00,
-    0x82, 0x65, 0x6D, 0x00, 0x12, 0x15, 0x09, 0x00, 0x81, 0x6D, 0x00, 0x48, 0xA2, 0x92, 0x12, 0xA8,
-    0x92, 0x00, 0x0B, 0x17, 0x00, 0x81, 0x6D, 0x00, 0x15, 0x09, 0x00, 0x81, 0x6D, 0x00, 0x48, 0xB5,
-    0x92, 0x12, 0xBB, 0x92, 0x00, 0x0B, 0x17, 0x00, 0x81, 0x6D, 0x00, 0x15, 0x09, 0x00, 0x81, 0x6D,
-    0x00, 0x12, 0x15, 0x09, 0x00, 0x81, 0x6D, 0x00, 0x44, 0xD2, 0x92, 0x08, 0xD7, 0x92, 0x12, 0xE6,
-    0x92, 0x00, 0x0B, 0x17, 0x00, 0x80, 0x00, 0x48, 0xDE, 0x92, 0x0B, 0xE2, 0x92, 0x00, 0x05, 0x00,
-    0x80, 0x00, 0x1A, 0x00, 0x80, 0x00, 0x15, 0x09, 0x00, 0x81, 0x6D, 0x00, 0x48, 0x02, 0x93, 0x09,
-    0x09, 0x93, 0x0C, 0x10, 0x93, 0x0F, 0x17, 0x93, 0x13, 0x1E, 0x93, 0x15, 0x25, 0x93, 0x17, 0x9A,
-    0x93, 0x00, 0x15, 0x09, 0x00, 0x82, 0x6F, 0x6D, 0x00, 0x15, 0x09, 0x00, 0x82, 0x6F, 0x6D, 0x00,
-    0x15, 0x09, 0x00, 0x82, 0x6F, 0x6D, 0x00, 0x15, 0x09, 0x00, 0x82, 0x6F, 0x6D, 0x00, 0x15, 0x09,
-    0x00, 0x82, 0x6F, 0x6D, 0x00, 0x46, 0x3B, 0x93, 0x07, 0x42, 0x93, 0x09, 0x49, 0x93, 0x0A, 0x7F,
-    0x93, 0x15, 0x86, 0x93, 0x17, 0x8C, 0x93, 0x19, 0x93, 0x93, 0x00, 0x09, 0x00, 0x83, 0x72, 0x6F,
-    0x6D, 0x00, 0x09, 0x00, 0x83, 0x72, 0x6F, 0x6D, 0x00, 0x46, 0x5C, 0x93, 0x07, 0x62, 0x93, 0x09,
-    0x68, 0x93, 0x0A, 0x6D, 0x93, 0x15, 0x73, 0x93, 0x19, 0x79, 0x93, 0x00, 0x84, 0x66, 0x72, 0x6F,
-    0x6D, 0x00, 0x84, 0x66, 0x72, 0x6F, 0x6D, 0x00, 0x83, 0x72, 0x6F, 0x6D, 0x00, 0x84, 0x66, 0x72,
-    0x6F, 0x6D, 0x00, 0x84, 0x66, 0x72, 0x6F, 0x6D, 0x00, 0x84, 0x66, 0x72, 0x6F, 0x6D, 0x00, 0x09,
-    0x00, 0x83, 0x72, 0x6F, 0x6D, 0x00, 0x09, 0x00, 0x82, 0x6F, 0x6D, 0x00, 0x09, 0x00, 0x83, 0x72,
-    0x6F, 0x6D, 0x00, 0x09, 0x00, 0x83, 0x72, 0x6F, 0x6D, 0x00, 0x15, 0x09, 0x00, 0x82, 0x6F, 0x6D,
-    0x00, 0x12, 0x15, 0x09, 0x00, 0x81, 0x6D, 0x00, 0x08, 0x0B, 0x17, 0x00, 0x81, 0x6D, 0x00, 0x44,
-    0xE9, 0x93, 0x05, 0x87, 0x94, 0x06, 0xBE, 0x94, 0x07, 0xD1, 0x94, 0x08, 0xFB, 0x94, 0x0A, 0xC7,
-    0x99, 0x0B, 0xDC, 0x99, 0x0C, 0x3D, 0x9A, 0x0D, 0x46, 0x9A, 0x0E, 0x7D, 0x9A, 0x0F, 0x85, 0x9A,
-    0x10, 0x8E, 0x9A, 0x12, 0xB4, 0x9A, 0x13, 0x63, 0x9C, 0x14, 0x6C, 0x9C, 0x15, 0x7F, 0x9C, 0x16,
-    0xA7, 0x9C, 0x1A, 0xBA, 0x9C, 0x1D, 0xB0, 0x9D, 0x00, 0x4A, 0x05, 0x94, 0x0B, 0x0C, 0x94, 0x0D,
-    0x4A, 0x94, 0x11, 0x51, 0x94, 0x14, 0x58, 0x94, 0x16, 0x5F, 0x94, 0x1A, 0x66, 0x94, 0x1C, 0x78,
-    0x94, 0x1D, 0x80, 0x94, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x61, 0x6E, 0x00, 0x45, 0x1F, 0x94, 0x0A,
-    0x26, 0x94, 0x0D, 0x2D, 0x94, 0x11, 0x34, 0x94, 0x15, 0x3B, 0x94, 0x17, 0x42, 0x94, 0x00, 0x17,
-    0x00, 0x83, 0x68, 0x61, 0x6E, 0x00, 0x17, 0x00, 0x83, 0x68, 0x61, 0x6E, 0x00, 0x17, 0x00, 0x83,
-    0x68, 0x61, 0x6E, 0x00, 0x17, 0x00, 0x83, 0x68, 0x61, 0x6E, 0x00, 0x17, 0x00, 0x83, 0x68, 0x61,
-    0x6E, 0x00, 0x0A, 0x00, 0x84, 0x74, 0x68, 0x61, 0x6E, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x61, 0x6E,
-    0x00, 0x0B, 0x17, 0x00, 0x82, 0x61, 0x6E, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x61, 0x6E, 0x00, 0x0B,
-    0x17, 0x00, 0x82, 0x61, 0x6E, 0x00, 0x4B, 0x6D, 0x94, 0x12, 0x73, 0x94, 0x00, 0x17, 0x00, 0x82,
-    0x61, 0x6E, 0x00, 0x07, 0x00, 0x81, 0x6E, 0x00, 0x0B, 0x17, 0x2C, 0x00, 0x82, 0x61, 0x6E, 0x00,
-    0x0B, 0x17, 0x00, 0x82, 0x61, 0x6E, 0x00, 0x44, 0x91, 0x94, 0x08, 0x97, 0x94, 0x1A, 0xB8, 0x94,
-    0x00, 0x0B, 0x17, 0x00, 0x81, 0x6E, 0x00, 0x48, 0xA1, 0x94, 0x0B, 0xA6, 0x94, 0x19, 0xB3, 0x94,
-    0x00, 0x05, 0x00, 0x81, 0x6E, 0x00, 0x57, 0xAD, 0x94, 0x1A, 0xB0, 0x94, 0x00, 0x81, 0x6E, 0x00,
-    0x81, 0x6E, 0x00, 0x08, 0x00, 0x81, 0x6E, 0x00, 0x12, 0x07, 0x00, 0x81, 0x6E, 0x00, 0x4C, 0xC5,
-    0x94, 0x17, 0xCB, 0x94, 0x00, 0x0B, 0x1A, 0x00, 0x80, 0x68, 0x00, 0x0C, 0x05, 0x00, 0x80, 0x68,
-    0x00, 0x48, 0xD8, 0x94, 0x18, 0xF4, 0x94, 0x00, 0x48, 0xE2, 0x94, 0x0B, 0xE7, 0x94, 0x1A, 0xEC,
-    0x94, 0x00, 0x05, 0x00, 0x81, 0x6E, 0x00, 0x1A, 0x00, 0x81, 0x6E, 0x00, 0x17, 0x08, 0x05, 0x00,
-    0x81, 0x65, 0x6E, 0x00, 0x12, 0x16, 0x00, 0x81, 0x6E, 0x64, 0x00, 0x45, 0x23, 0x95, 0x06, 0x3F,
-    0x95, 0x07, 0x46, 0x95, 0x08, 0x7A, 0x95, 0x09, 0xBB, 0x97, 0x0A, 0xC2, 0x97, 0x0B, 0xDE, 0x97,
-    0x0D, 0xC4, 0x98, 0x11, 0xD5, 0x98, 0x15, 0xE6, 0x98, 0x19, 0x11, 0x99, 0x1A, 0x5A, 0x99, 0x1C,
-    0xB6, 0x99, 0x00, 0x4B, 0x2A, 0x95, 0x19, 0x39, 0x95, 0x00, 0x57, 0x31, 0x95, 0x1A, 0x35, 0x95,
-    0x00, 0x82, 0x65, 0x6E, 0x00, 0x82, 0x65, 0x6E, 0x00, 0x08, 0x00, 0x82, 0x65, 0x6E, 0x00, 0x19,
-    0x08, 0x00, 0x82, 0x65, 0x6E, 0x00, 0x48, 0x53, 0x95, 0x0B, 0x5C, 0x95, 0x19, 0x6B, 0x95, 0x1A,
-    0x71, 0x95, 0x00, 0x1A, 0x17, 0x08, 0x05, 0x00, 0x82, 0x65, 0x6E, 0x00, 0x57, 0x63, 0x95, 0x1A,
-    0x67, 0x95, 0x00, 0x82, 0x65, 0x6E, 0x00, 0x82, 0x65, 0x6E, 0x00, 0x08, 0x00, 0x82, 0x65, 0x6E,
-    0x00, 0x17, 0x08, 0x05, 0x00, 0x82, 0x65, 0x65, 0x6E, 0x00, 0x44, 0xA2, 0x95, 0x05, 0xBB, 0x95,
-    0x07, 0xE0, 0x95, 0x08, 0xF5, 0x95, 0x0A, 0xFF, 0x95, 0x0B, 0x06, 0x96, 0x11, 0x0D, 0x96, 0x14,
-    0x14, 0x96, 0x15, 0x2D, 0x96, 0x16, 0x42, 0x96, 0x17, 0x5B, 0x96, 0x19, 0x74, 0x96, 0x1A, 0x7B,
-    0x96, 0x00, 0x57, 0xA9, 0x95, 0x1A, 0xB2, 0x95, 0x00, 0x08, 0x05, 0x00, 0x83, 0x77, 0x65, 0x65,
-    0x6E, 0x00, 0x17, 0x08, 0x05, 0x00, 0x83, 0x65, 0x65, 0x6E, 0x00, 0x4A, 0xC8, 0x95, 0x0B, 0xCE,
-    0x95, 0x11, 0xD4, 0x95, 0x19, 0xDA, 0x95, 0x00, 0x84, 0x62, 0x65, 0x65, 0x6E, 0x00, 0x84, 0x62,
-    0x65, 0x65, 0x6E, 0x00, 0x84, 0x62, 0x65, 0x65, 0x6E, 0x00, 0x84, 0x62, 0x65, 0x65, 0x6E, 0x00,
-    0x45, 0xE7, 0x95, 0x1A, 0xEC, 0x95, 0x00, 0x83, 0x65, 0x65, 0x6E, 0x00, 0x17, 0x08, 0x05, 0x00,
-    0x83, 0x65, 0x65, 0x6E, 0x00, 0x17, 0x08, 0x05, 0x00, 0x83, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x05,
-    0x00, 0x83, 0x65, 0x65, 0x6E, 0x00, 0x05, 0x00, 0x83, 0x65, 0x65, 0x6E, 0x00, 0x05, 0x00, 0x83,
-    0x65, 0x65, 0x6E, 0x00, 0x57, 0x1B, 0x96, 0x1A, 0x24, 0x96, 0x00, 0x08, 0x05, 0x00, 0x83, 0x77,
-    0x65, 0x65, 0x6E, 0x00, 0x17, 0x08, 0x05, 0x00, 0x83, 0x65, 0x65, 0x6E, 0x00, 0x45, 0x34, 0x96,
-    0x1A, 0x39, 0x96, 0x00, 0x83, 0x65, 0x65, 0x6E, 0x00, 0x17, 0x08, 0x05, 0x00, 0x83, 0x65, 0x65,
-    0x6E, 0x00, 0x57, 0x49, 0x96, 0x1A, 0x52, 0x96, 0x00, 0x08, 0x05, 0x00, 0x83, 0x77, 0x65, 0x65,
-    0x6E, 0x00, 0x17, 0x08, 0x05, 0x00, 0x83, 0x65, 0x65, 0x6E, 0x00, 0x48, 0x62, 0x96, 0x1A, 0x6A,
-    0x96, 0x00, 0x05, 0x00, 0x82, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x08, 0x05, 0x00, 0x84, 0x74, 0x77,
-    0x65, 0x65, 0x6E, 0x00, 0x05, 0x00, 0x83, 0x65, 0x65, 0x6E, 0x00, 0x44, 0x9A, 0x96, 0x05, 0xA4,
-    0x96, 0x08, 0xA9, 0x96, 0x0A, 0xCE, 0x96, 0x14, 0xE7, 0x96, 0x15, 0xF1, 0x96, 0x16, 0x0A, 0x97,
-    0x17, 0x14, 0x97, 0x1A, 0x99, 0x97, 0x1C, 0xA2, 0x97, 0x00, 0x17, 0x08, 0x05, 0x00, 0x84, 0x77,
-    0x65, 0x65, 0x6E, 0x00, 0x83, 0x65, 0x65, 0x6E, 0x00, 0x45, 0xB0, 0x96, 0x17, 0xB7, 0x96, 0x00,
-    0x83, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x45, 0xBE, 0x96, 0x08, 0xC6, 0x96, 0x00, 0x85, 0x65,
-    0x74, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x05, 0x00, 0x84, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x48, 0xD5,
-    0x96, 0x17, 0xDE, 0x96, 0x00, 0x05, 0x00, 0x84, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x08, 0x05,
-    0x00, 0x84, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x17, 0x08, 0x05, 0x00, 0x84, 0x77, 0x65, 0x65, 0x6E,
-    0x00, 0x48, 0xF8, 0x96, 0x17, 0x01, 0x97, 0x00, 0x05, 0x00, 0x84, 0x74, 0x77, 0x65, 0x65, 0x6E,
-    0x00, 0x08, 0x05, 0x00, 0x84, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x17, 0x08, 0x05, 0x00, 0x84, 0x77,
-    0x65, 0x65, 0x6E, 0x00, 0x45, 0x2A, 0x97, 0x07, 0x32, 0x97, 0x08, 0x4A, 0x97, 0x0A, 0x55, 0x97,
-    0x15, 0x5F, 0x97, 0x1A, 0x77, 0x97, 0x1C, 0x8F, 0x97, 0x00, 0x84, 0x65, 0x74, 0x77, 0x65, 0x65,
-    0x6E, 0x00, 0x45, 0x39, 0x97, 0x08, 0x41, 0x97, 0x00, 0x85, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E,
-    0x00, 0x05, 0x00, 0x85, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x2C, 0x00, 0x85, 0x62, 0x65, 0x74,
-    0x77, 0x65, 0x65, 0x6E, 0x00, 0x08, 0x05, 0x00, 0x85, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x45,
-    0x66, 0x97, 0x08, 0x6E, 0x97, 0x00, 0x85, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x05, 0x00,
-    0x85, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x45, 0x7E, 0x97, 0x08, 0x86, 0x97, 0x00, 0x85, 0x65,
-    0x74, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x05, 0x00, 0x85, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x08,
-    0x05, 0x00, 0x85, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x17, 0x08, 0x05, 0x00, 0x83, 0x65, 0x65,
-    0x6E, 0x00, 0x48, 0xA9, 0x97, 0x17, 0xB2, 0x97, 0x00, 0x05, 0x00, 0x84, 0x74, 0x77, 0x65, 0x65,
-    0x6E, 0x00, 0x08, 0x05, 0x00, 0x84, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x19, 0x08, 0x00, 0x82, 0x65,
-    0x6E, 0x00, 0x4B, 0xC9, 0x97, 0x19, 0xD8, 0x97, 0x00, 0x57, 0xD0, 0x97, 0x1A, 0xD4, 0x97, 0x00,
-    0x82, 0x65, 0x6E, 0x00, 0x82, 0x65, 0x6E, 0x00, 0x08, 0x00, 0x82, 0x65, 0x6E, 0x00, 0x44, 0x03,
-    0x98, 0x05, 0x0A, 0x98, 0x08, 0x1B, 0x98, 0x0A, 0x22, 0x98, 0x0D, 0x33, 0x98, 0x11, 0x44, 0x98,
-    0x14, 0x55, 0x98, 0x15, 0x5C, 0x98, 0x16, 0x63, 0x98, 0x17, 0x6A, 0x98, 0x1A, 0x8C, 0x98, 0x1C,
-    0xB3, 0x98, 0x00, 0x1A, 0x00, 0x83, 0x68, 0x65, 0x6E, 0x00, 0x57, 0x11, 0x98, 0x1A, 0x16, 0x98,
-    0x00, 0x83, 0x68, 0x65, 0x6E, 0x00, 0x83, 0x68, 0x65, 0x6E, 0x00, 0x1A, 0x00, 0x83, 0x68, 0x65,
-    0x6E, 0x00, 0x57, 0x29, 0x98, 0x1A, 0x2E, 0x98, 0x00, 0x83, 0x68, 0x65, 0x6E, 0x00, 0x83, 0x68,
-    0x65, 0x6E, 0x00, 0x57, 0x3A, 0x98, 0x1A, 0x3F, 0x98, 0x00, 0x83, 0x68, 0x65, 0x6E, 0x00, 0x83,
-    0x68, 0x65, 0x6E, 0x00, 0x57, 0x4B, 0x98, 0x1A, 0x50, 0x98, 0x00, 0x83, 0x68, 0x65, 0x6E, 0x00,
-    0x83, 0x68, 0x65, 0x6E, 0x00, 0x1A, 0x00, 0x83, 0x68, 0x65, 0x6E, 0x00, 0x17, 0x00, 0x83, 0x68,
-    0x65, 0x6E, 0x00, 0x1A, 0x00, 0x83, 0x68, 0x65, 0x6E, 0x00, 0x4A, 0x74, 0x98, 0x15, 0x7C, 0x98,
-    0x1C, 0x84, 0x98, 0x00, 0x2C, 0x00, 0x84, 0x74, 0x68, 0x65, 0x6E, 0x00, 0x2C, 0x00, 0x84, 0x74,
-    0x68, 0x65, 0x6E, 0x00, 0x2C, 0x00, 0x84, 0x74, 0x68, 0x65, 0x6E, 0x00, 0x44, 0x99, 0x98, 0x08,
-    0x9F, 0x98, 0x14, 0xA7, 0x98, 0x16, 0xAD, 0x98, 0x00, 0x84, 0x77, 0x68, 0x65, 0x6E, 0x00, 0x2C,
-    0x00, 0x84, 0x77, 0x68, 0x65, 0x6E, 0x00, 0x84, 0x77, 0x68, 0x65, 0x6E, 0x00, 0x84, 0x77, 0x68,
-    0x65, 0x6E, 0x00, 0x57, 0xBA, 0x98, 0x1A, 0xBF, 0x98, 0x00, 0x83, 0x68, 0x65, 0x6E, 0x00, 0x83,
-    0x68, 0x65, 0x6E, 0x00, 0x0B, 0x00, 0x57, 0xCD, 0x98, 0x1A, 0xD1, 0x98, 0x00, 0x82, 0x65, 0x6E,
-    0x00, 0x82, 0x65, 0x6E, 0x00, 0x0B, 0x00, 0x57, 0xDE, 0x98, 0x1A, 0xE2, 0x98, 0x00, 0x82, 0x65,
-    0x6E, 0x00, 0x82, 0x65, 0x6E, 0x00, 0x48, 0xF3, 0x98, 0x0B, 0xFC, 0x98, 0x19, 0x02, 0x99, 0x1A,
-    0x08, 0x99, 0x00, 0x1A, 0x17, 0x08, 0x05, 0x00, 0x82, 0x65, 0x6E, 0x00, 0x1A, 0x00, 0x82, 0x65,
-    0x6E, 0x00, 0x08, 0x00, 0x82, 0x65, 0x6E, 0x00, 0x17, 0x08, 0x05, 0x00, 0x82, 0x65, 0x65, 0x6E,
-    0x00, 0x45, 0x27, 0x99, 0x06, 0x2E, 0x99, 0x07, 0x35, 0x99, 0x08, 0x3C, 0x99, 0x09, 0x45, 0x99,
-    0x0A, 0x4C, 0x99, 0x1A, 0x53, 0x99, 0x00, 0x08, 0x00, 0x83, 0x76, 0x65, 0x6E, 0x00, 0x08, 0x00,
-    0x83, 0x76, 0x65, 0x6E, 0x00, 0x08, 0x00, 0x83, 0x76, 0x65, 0x6E, 0x00, 0x1A, 0x2C, 0x00, 0x84,
-    0x65, 0x76, 0x65, 0x6E, 0x00, 0x08, 0x00, 0x83, 0x76, 0x65, 0x6E, 0x00, 0x08, 0x00, 0x83, 0x76,
-    0x65, 0x6E, 0x00, 0x08, 0x00, 0x83, 0x76, 0x65, 0x6E, 0x00, 0x48, 0x6D, 0x99, 0x0B, 0x8C, 0x99,
-    0x12, 0x9B, 0x99, 0x17, 0xA0, 0x99, 0x19, 0xA7, 0x99, 0x1A, 0xAD, 0x99, 0x00, 0x45, 0x77, 0x99,
-    0x17, 0x7B, 0x99, 0x1A, 0x84, 0x99, 0x00, 0x82, 0x65, 0x6E, 0x00, 0x08, 0x05, 0x00, 0x83, 0x77,
-    0x65, 0x65, 0x6E, 0x00, 0x17, 0x08, 0x05, 0x00, 0x82, 0x65, 0x6E, 0x00, 0x57, 0x93, 0x99, 0x1A,
-    0x97, 0x99, 0x00, 0x82, 0x65, 0x6E, 0x00, 0x82, 0x65, 0x6E, 0x00, 0x07, 0x00, 0x81, 0x6E, 0x00,
-    0x08, 0x05, 0x00, 0x80, 0x65, 0x6E, 0x00, 0x08, 0x00, 0x82, 0x65, 0x6E, 0x00, 0x17, 0x08, 0x05,
-    0x00, 0x82, 0x65, 0x65, 0x6E, 0x00, 0x0B, 0x00, 0x57, 0xBF, 0x99, 0x1A, 0xC3, 0x99, 0x00, 0x82,
-    0x65, 0x6E, 0x00, 0x82, 0x65, 0x6E, 0x00, 0x0C, 0x00, 0x48, 0xD0, 0x99, 0x12, 0xD6, 0x99, 0x00,
-    0x05, 0x00, 0x81, 0x6E, 0x67, 0x00, 0x0A, 0x00, 0x81, 0x6E, 0x67, 0x00, 0x44, 0xEF, 0x99, 0x06,
-    0xF5, 0x99, 0x08, 0x06, 0x9A, 0x12, 0x27, 0x9A, 0x17, 0x30, 0x9A, 0x1A, 0x37, 0x9A, 0x00, 0x0B,
-    0x17, 0x00, 0x81, 0x6E, 0x00, 0x4C, 0xFC, 0x99, 0x17, 0x01, 0x9A, 0x00, 0x0B, 0x1A, 0x00, 0x80,
-    0x00, 0x0C, 0x05, 0x00, 0x80, 0x00, 0x48, 0x10, 0x9A, 0x0B, 0x15, 0x9A, 0x19, 0x22, 0x9A, 0x00,
-    0x05, 0x00, 0x81, 0x6E, 0x00, 0x57, 0x1C, 0x9A, 0x1A, 0x1F, 0x9A, 0x00, 0x81, 0x6E, 0x00, 0x81,
-    0x6E, 0x00, 0x08, 0x00, 0x81, 0x6E, 0x00, 0x17, 0x1C, 0x13, 0x00, 0x82, 0x68, 0x6F, 0x6E, 0x00,
-    0x1C, 0x13, 0x00, 0x80, 0x6F, 0x6E, 0x00, 0x12, 0x07, 0x00, 0x81, 0x6E, 0x00, 0x0B, 0x17, 0x1C,
-    0x13, 0x00, 0x81, 0x6F, 0x6E, 0x00, 0x44, 0x50, 0x9A, 0x08, 0x56, 0x9A, 0x1A, 0x77, 0x9A, 0x00,
-    0x0B, 0x17, 0x00, 0x81, 0x6E, 0x00, 0x48, 0x60, 0x9A, 0x0B, 0x65, 0x9A, 0x19, 0x72, 0x9A, 0x00,
-    0x05, 0x00, 0x81, 0x6E, 0x00, 0x57, 0x6C, 0x9A, 0x1A, 0x6F, 0x9A, 0x00, 0x81, 0x6E, 0x00, 0x81,
-    0x6E, 0x00, 0x08, 0x00, 0x81, 0x6E, 0x00, 0x12, 0x07, 0x00, 0x81, 0x6E, 0x00, 0x0C, 0x0B, 0x17,
-    0x00, 0x81, 0x6E, 0x6B, 0x00, 0x0B, 0x17, 0x1C, 0x13, 0x00, 0x81, 0x6F, 0x6E, 0x00, 0x48, 0x95,
-    0x9A, 0x1A, 0xAE, 0x9A, 0x00, 0x48, 0x9F, 0x9A, 0x0B, 0xA4, 0x9A, 0x19, 0xA9, 0x9A, 0x00, 0x05,
-    0x00, 0x81, 0x6E, 0x00, 0x1A, 0x00, 0x81, 0x6E, 0x00, 0x08, 0x00, 0x81, 0x6E, 0x00, 0x12, 0x07,
-    0x00, 0x81, 0x6E, 0x00, 0x45, 0xD3, 0x9A, 0x0A, 0xEA, 0x9A, 0x0B, 0x01, 0x9B, 0x0C, 0xFA, 0x9B,
-    0x0D, 0x03, 0x9C, 0x0F, 0x1A, 0x9C, 0x11, 0x23, 0x9C, 0x13, 0x2C, 0x9C, 0x17, 0x35, 0x9C, 0x1C,
-    0x4C, 0x9C, 0x00, 0x4B, 0xDA, 0x9A, 0x17, 0xE2, 0x9A, 0x00, 0x17, 0x1C, 0x13, 0x00, 0x82, 0x6F,
-    0x6E, 0x00, 0x1C, 0x13, 0x00, 0x82, 0x68, 0x6F, 0x6E, 0x00, 0x4B, 0xF1, 0x9A, 0x17, 0xF9, 0x9A,
-    0x00, 0x17, 0x1C, 0x13, 0x00, 0x82, 0x6F, 0x6E, 0x00, 0x1C, 0x13, 0x00, 0x82, 0x68, 0x6F, 0x6E,
-    0x00, 0x45, 0x17, 0x9B, 0x0A, 0x20, 0x9B, 0x0D, 0x37, 0x9B, 0x11, 0x40, 0x9B, 0x15, 0x49, 0x9B,
-    0x17, 0x60, 0x9B, 0x1C, 0xCD, 0x9B, 0x00, 0x17, 0x1C, 0x13, 0x00, 0x83, 0x68, 0x6F, 0x6E, 0x00,
-    0x57, 0x27, 0x9B, 0x1C, 0x2F, 0x9B, 0x00, 0x1C, 0x13, 0x00, 0x83, 0x68, 0x6F, 0x6E, 0x00, 0x13,
-    0x00, 0x83, 0x74, 0x68, 0x6F, 0x6E, 0x00, 0x17, 0x1C, 0x13, 0x00, 0x83, 0x68, 0x6F, 0x6E, 0x00,
-    0x17, 0x1C, 0x13, 0x00, 0x83, 0x68, 0x6F, 0x6E, 0x00, 0x57, 0x50, 0x9B, 0x1C, 0x58, 0x9B, 0x00,
-    0x1C, 0x13, 0x00, 0x83, 0x68, 0x6F, 0x6E, 0x00, 0x13, 0x00, 0x83, 0x74, 0x68, 0x6F, 0x6E, 0x00,
-    0x4A, 0x76, 0x9B, 0x0B, 0x7F, 0x9B, 0x13, 0x88, 0x9B, 0x15, 0x8F, 0x9B, 0x17, 0x98, 0x9B, 0x18,
-    0xAD, 0x9B, 0x1C, 0xC3, 0x9B, 0x00, 0x1C, 0x13, 0x00, 0x84, 0x74, 0x68, 0x6F, 0x6E, 0x00, 0x1C,
-    0x13, 0x00, 0x84, 0x74, 0x68, 0x6F, 0x6E, 0x00, 0x83, 0x79, 0x74, 0x68, 0x6F, 0x6E, 0x00, 0x1C,
-    0x13, 0x00, 0x84, 0x74, 0x68, 0x6F, 0x6E, 0x00, 0x53, 0x9F, 0x9B, 0x1C, 0xA6, 0x9B, 0x00, 0x84,
-    0x79, 0x74, 0x68, 0x6F, 0x6E, 0x00, 0x13, 0x00, 0x83, 0x68, 0x6F, 0x6E, 0x00, 0x53, 0xB4, 0x9B,
-    0x1C, 0xBB, 0x9B, 0x00, 0x84, 0x79, 0x74, 0x68, 0x6F, 0x6E, 0x00, 0x13, 0x00, 0x84, 0x74, 0x68,
-    0x6F, 0x6E, 0x00, 0x2C, 0x00, 0x84, 0x70, 0x79, 0x74, 0x68, 0x6F, 0x6E, 0x00, 0x53, 0xD7, 0x9B,
-    0x17, 0xDD, 0x9B, 0x1C, 0xF2, 0x9B, 0x00, 0x82, 0x74, 0x68, 0x6F, 0x6E, 0x00, 0x53, 0xE4, 0x9B,
-    0x1C, 0xEB, 0x9B, 0x00, 0x84, 0x79, 0x74, 0x68, 0x6F, 0x6E, 0x00, 0x13, 0x00, 0x83, 0x68, 0x6F,
-    0x6E, 0x00, 0x13, 0x00, 0x83, 0x74, 0x68, 0x6F, 0x6E, 0x00, 0x0B, 0x17, 0x1C, 0x13, 0x00, 0x82,
-    0x6F, 0x6E, 0x00, 0x4B, 0x0A, 0x9C, 0x17, 0x12, 0x9C, 0x00, 0x17, 0x1C, 0x13, 0x00, 0x82, 0x6F,
-    0x6E, 0x00, 0x1C, 0x13, 0x00, 0x82, 0x68, 0x6F, 0x6E, 0x00, 0x0B, 0x17, 0x1C, 0x13, 0x00, 0x82,
-    0x6F, 0x6E, 0x00, 0x17, 0x1C, 0x13, 0x00, 0x82, 0x68, 0x6F, 0x6E, 0x00, 0x0B, 0x17, 0x1C, 0x13,
-    0x00, 0x82, 0x6F, 0x6E, 0x00, 0x4B, 0x3C, 0x9C, 0x1C, 0x45, 0x9C, 0x00, 0x1C, 0x13, 0x00, 0x83,
-    0x74, 0x68, 0x6F, 0x6E, 0x00, 0x13, 0x00, 0x81, 0x68, 0x6F, 0x6E, 0x00, 0x4B, 0x53, 0x9C, 0x17,
-    0x5B, 0x9C, 0x00, 0x17, 0x1C, 0x13, 0x00, 0x82, 0x6F, 0x6E, 0x00, 0x1C, 0x13, 0x00, 0x82, 0x68,
-    0x6F, 0x6E, 0x00, 0x0B, 0x17, 0x1C, 0x13, 0x00, 0x81, 0x6F, 0x6E, 0x00, 0x44, 0x73, 0x9C, 0x1A,
-    0x79, 0x9C, 0x00, 0x0B, 0x17, 0x00, 0x81, 0x6E, 0x00, 0x12, 0x07, 0x00, 0x81, 0x6E, 0x00, 0x08,
-    0x00, 0x48, 0x8B, 0x9C, 0x0B, 0x90, 0x9C, 0x1A, 0x9F, 0x9C, 0x00, 0x05, 0x00, 0x81, 0x6E, 0x00,
-    0x57, 0x97, 0x9C, 0x1A, 0x9C, 0x9C, 0x00, 0x2C, 0x00, 0x81, 0x6E, 0x00, 0x81, 0x6E, 0x00, 0x17,
-    0x08, 0x05, 0x00, 0x81, 0x65, 0x6E, 0x00, 0x44, 0xAE, 0x9C, 0x1A, 0xB4, 0x9C, 0x00, 0x0B, 0x17,
-    0x00, 0x81, 0x6E, 0x00, 0x12, 0x07, 0x00, 0x81, 0x6E, 0x00, 0x44, 0xD3, 0x9C, 0x08, 0xDA, 0x9C,
-    0x0C, 0x07, 0x9D, 0x0F, 0x0E, 0x9D, 0x12, 0x15, 0x9D, 0x13, 0x9B, 0x9D, 0x14, 0xA2, 0x9D, 0x16,
-    0xA9, 0x9D, 0x00, 0x12, 0x07, 0x00, 0x82, 0x77, 0x6E, 0x00, 0x48, 0xEA, 0x9C, 0x0B, 0xEF, 0x9C,
-    0x12, 0xF4, 0x9C, 0x19, 0xFA, 0x9C, 0x1A, 0xFF, 0x9C, 0x00, 0x05, 0x00, 0x81, 0x6E, 0x00, 0x1A,
-    0x00, 0x81, 0x6E, 0x00, 0x07, 0x00, 0x82, 0x77, 0x6E, 0x00, 0x08, 0x00, 0x81, 0x6E, 0x00, 0x17,
-    0x08, 0x05, 0x00, 0x81, 0x65, 0x6E, 0x00, 0x12, 0x07, 0x00, 0x82, 0x77, 0x6E, 0x00, 0x12, 0x07,
-    0x00, 0x82, 0x77, 0x6E, 0x00, 0x46, 0x31, 0x9D, 0x07, 0x38, 0x9D, 0x08, 0x6A, 0x9D, 0x09, 0x71,
-    0x9D, 0x0C, 0x78, 0x9D, 0x0F, 0x7F, 0x9D, 0x13, 0x86, 0x9D, 0x16, 0x8D, 0x9D, 0x1B, 0x94, 0x9D,
-    0x00, 0x07, 0x00, 0x83, 0x6F, 0x77, 0x6E, 0x00, 0x46, 0x48, 0x9D, 0x08, 0x4E, 0x9D, 0x09, 0x56,
-    0x9D, 0x16, 0x5C, 0x9D, 0x1B, 0x64, 0x9D, 0x00, 0x84, 0x64, 0x6F, 0x77, 0x6E, 0x00, 0x2C, 0x00,
-    0x84, 0x64, 0x6F, 0x77, 0x6E, 0x00, 0x84, 0x64, 0x6F, 0x77, 0x6E, 0x00, 0x2C, 0x00, 0x84, 0x64,
-    0x6F, 0x77, 0x6E, 0x00, 0x84, 0x64, 0x6F, 0x77, 0x6E, 0x00, 0x07, 0x00, 0x83, 0x6F, 0x77, 0x6E,
-    0x00, 0x07, 0x00, 0x83, 0x6F, 0x77, 0x6E, 0x00, 0x07, 0x00, 0x83, 0x6F, 0x77, 0x6E, 0x00, 0x07,
-    0x00, 0x83, 0x6F, 0x77, 0x6E, 0x00, 0x07, 0x00, 0x83, 0x6F, 0x77, 0x6E, 0x00, 0x07, 0x00, 0x83,
-    0x6F, 0x77, 0x6E, 0x00, 0x07, 0x00, 0x83, 0x6F, 0x77, 0x6E, 0x00, 0x12, 0x07, 0x00, 0x82, 0x77,
-    0x6E, 0x00, 0x12, 0x07, 0x00, 0x82, 0x77, 0x6E, 0x00, 0x12, 0x07, 0x00, 0x82, 0x77, 0x6E, 0x00,
-    0x04, 0x0B, 0x17, 0x00, 0x81, 0x6E, 0x00, 0x44, 0xE2, 0x9D, 0x07, 0xE9, 0x9D, 0x08, 0xF0, 0x9D,
-    0x0A, 0xF7, 0x9D, 0x0C, 0x20, 0x9E, 0x0F, 0x33, 0x9E, 0x11, 0x4E, 0x9E, 0x13, 0x6D, 0x9E, 0x15,
-    0x7F, 0x9E, 0x16, 0x9E, 0x9E, 0x17, 0x26, 0x9F, 0x1A, 0x4E, 0xA5, 0x1B, 0x55, 0xA5, 0x1C, 0x5C,
-    0xA5, 0x00, 0x16, 0x0F, 0x04, 0x00, 0x81, 0x6F, 0x00, 0x16, 0x0F, 0x04, 0x00, 0x81, 0x6F, 0x00,
-    0x16, 0x0F, 0x04, 0x00, 0x81, 0x6F, 0x00, 0x51, 0xFE, 0x9D, 0x17, 0x0A, 0x9E, 0x00, 0x08, 0x10,
-    0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x81, 0x74, 0x6F, 0x00, 0x11, 0x00, 0x48, 0x13, 0x9E, 0x0C,
-    0x1D, 0x9E, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x81, 0x6F, 0x00, 0x81, 0x6F, 0x00,
-    0x56, 0x27, 0x9E, 0x17, 0x2D, 0x9E, 0x00, 0x0F, 0x04, 0x00, 0x81, 0x6F, 0x00, 0x11, 0x0C, 0x00,
-    0x81, 0x6F, 0x00, 0x4F, 0x3D, 0x9E, 0x16, 0x42, 0x9E, 0x1C, 0x48, 0x9E, 0x00, 0x08, 0x1A, 0x00,
-    0x80, 0x00, 0x0F, 0x04, 0x00, 0x81, 0x6F, 0x00, 0x11, 0x0C, 0x19, 0x00, 0x80, 0x00, 0x48, 0x55,
-    0x9E, 0x17, 0x60, 0x9E, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x80, 0x74, 0x6F, 0x00,
-    0x08, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x82, 0x6E, 0x74, 0x6F, 0x00, 0x4F, 0x74, 0x9E,
-    0x16, 0x79, 0x9E, 0x00, 0x08, 0x0B, 0x00, 0x80, 0x00, 0x0F, 0x04, 0x00, 0x81, 0x6F, 0x00, 0x51,
-    0x86, 0x9E, 0x17, 0x92, 0x9E, 0x00, 0x08, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x81, 0x74,
-    0x6F, 0x00, 0x11, 0x08, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x81, 0x6F, 0x00, 0x44, 0xB1,
-    0x9E, 0x07, 0xB8, 0x9E, 0x0E, 0xBF, 0x9E, 0x0F, 0xC6, 0x9E, 0x1A, 0x18, 0x9F, 0x1B, 0x1F, 0x9F,
-    0x00, 0x0F, 0x04, 0x00, 0x82, 0x73, 0x6F, 0x00, 0x0F, 0x04, 0x00, 0x82, 0x73, 0x6F, 0x00, 0x0F,
-    0x04, 0x00, 0x82, 0x73, 0x6F, 0x00, 0x44, 0xD9, 0x9E, 0x0E, 0xF5, 0x9E, 0x12, 0xFC, 0x9E, 0x14,
-    0x03, 0x9F, 0x16, 0x0A, 0x9F, 0x1D, 0x11, 0x9F, 0x00, 0x54, 0xE3, 0x9E, 0x1A, 0xE9, 0x9E, 0x1D,
-    0xEF, 0x9E, 0x00, 0x84, 0x61, 0x6C, 0x73, 0x6F, 0x00, 0x84, 0x61, 0x6C, 0x73, 0x6F, 0x00, 0x84,
-    0x61, 0x6C, 0x73, 0x6F, 0x00, 0x04, 0x00, 0x83, 0x6C, 0x73, 0x6F, 0x00, 0x04, 0x00, 0x83, 0x6C,
-    0x73, 0x6F, 0x00, 0x04, 0x00, 0x83, 0x6C, 0x73, 0x6F, 0x00, 0x04, 0x00, 0x83, 0x6C, 0x73, 0x6F,
-    0x00, 0x04, 0x00, 0x83, 0x6C, 0x73, 0x6F, 0x00, 0x0F, 0x04, 0x00, 0x82, 0x73, 0x6F, 0x00, 0x0F,
-    0x04, 0x00, 0x82, 0x73, 0x6F, 0x00, 0x45, 0x42, 0x9F, 0x08, 0x6B, 0x9F, 0x0A, 0x8A, 0x9F, 0x0B,
-    0x97, 0x9F, 0x0D, 0xC0, 0x9F, 0x10, 0xE9, 0x9F, 0x11, 0x12, 0xA0, 0x15, 0x1E, 0xA5, 0x1C, 0x36,
-    0xA5, 0x00, 0x48, 0x49, 0x9F, 0x11, 0x55, 0x9F, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00,
-    0x82, 0x6E, 0x74, 0x6F, 0x00, 0x48, 0x5C, 0x9F, 0x0C, 0x67, 0x9F, 0x00, 0x10, 0x04, 0x15, 0x06,
-    0x04, 0x16, 0x00, 0x82, 0x74, 0x6F, 0x00, 0x82, 0x74, 0x6F, 0x00, 0x50, 0x72, 0x9F, 0x11, 0x7D,
-    0x9F, 0x00, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x81, 0x6E, 0x74, 0x6F, 0x00, 0x10, 0x04, 0x15,
-    0x06, 0x04, 0x16, 0x00, 0x83, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x11, 0x08, 0x10, 0x04, 0x15, 0x06,
-    0x04, 0x16, 0x00, 0x82, 0x74, 0x6F, 0x00, 0x48, 0x9E, 0x9F, 0x11, 0xAA, 0x9F, 0x00, 0x10, 0x04,
-    0x15, 0x06, 0x04, 0x16, 0x00, 0x82, 0x6E, 0x74, 0x6F, 0x00, 0x48, 0xB1, 0x9F, 0x0C, 0xBC, 0x9F,
-    0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x82, 0x74, 0x6F, 0x00, 0x82, 0x74, 0x6F, 0x00,
-    0x48, 0xC7, 0x9F, 0x11, 0xD3, 0x9F, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x82, 0x6E,
-    0x74, 0x6F, 0x00, 0x48, 0xDA, 0x9F, 0x0C, 0xE5, 0x9F, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16,
-    0x00, 0x82, 0x74, 0x6F, 0x00, 0x82, 0x74, 0x6F, 0x00, 0x48, 0xF0, 0x9F, 0x11, 0xFC, 0x9F, 0x00,
-    0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x82, 0x6E, 0x74, 0x6F, 0x00, 0x48, 0x03, 0xA0, 0x0C,
-    0x0E, 0xA0, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x82, 0x74, 0x6F, 0x00, 0x82, 0x74,
-    0x6F, 0x00, 0x45, 0x34, 0xA0, 0x07, 0x4C, 0xA0, 0x08, 0x6B, 0xA0, 0x0B, 0x61, 0xA4, 0x0C, 0x79,
-    0xA4, 0x0D, 0x82, 0xA4, 0x0E, 0x9A, 0xA4, 0x10, 0xA1, 0xA4, 0x15, 0xD9, 0xA4, 0x18, 0xF8, 0xA4,
-    0x1A, 0xFF, 0xA4, 0x00, 0x48, 0x3B, 0xA0, 0x0C, 0x47, 0xA0, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04,
-    0x16, 0x00, 0x83, 0x6E, 0x74, 0x6F, 0x00, 0x83, 0x6E, 0x74, 0x6F, 0x00, 0x48, 0x53, 0xA0, 0x10,
-    0x5F, 0xA0, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x83, 0x6E, 0x74, 0x6F, 0x00, 0x04,
-    0x15, 0x06, 0x04, 0x16, 0x00, 0x83, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x44, 0x84, 0xA0, 0x07, 0xA3,
-    0xA0, 0x0D, 0xB0, 0xA0, 0x0E, 0xCF, 0xA0, 0x10, 0xEE, 0xA0, 0x11, 0x28, 0xA4, 0x15, 0x47, 0xA4,
-    0x1A, 0x54, 0xA4, 0x00, 0x50, 0x8B, 0xA0, 0x15, 0x98, 0xA0, 0x00, 0x15, 0x06, 0x04, 0x16, 0x00,
-    0x85, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x06, 0x04, 0x16, 0x00, 0x83, 0x6D, 0x65, 0x6E,
-    0x74, 0x6F, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x84, 0x65, 0x6E, 0x74, 0x6F, 0x00,
-    0x44, 0xB7, 0xA0, 0x10, 0xC3, 0xA0, 0x00, 0x15, 0x06, 0x04, 0x16, 0x00, 0x84, 0x6D, 0x65, 0x6E,
-    0x74, 0x6F, 0x00, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x84, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x44,
-    0xD6, 0xA0, 0x10, 0xE2, 0xA0, 0x00, 0x15, 0x06, 0x04, 0x16, 0x00, 0x84, 0x6D, 0x65, 0x6E, 0x74,
-    0x6F, 0x00, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x84, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x44, 0x0A,
-    0xA1, 0x0D, 0x66, 0xA3, 0x0E, 0x73, 0xA3, 0x11, 0x80, 0xA3, 0x14, 0x8D, 0xA3, 0x15, 0xAC, 0xA3,
-    0x16, 0xCB, 0xA3, 0x1A, 0xEA, 0xA3, 0x1D, 0x09, 0xA4, 0x00, 0x46, 0x26, 0xA1, 0x08, 0x45, 0xA1,
-    0x09, 0x64, 0xA1, 0x14, 0x83, 0xA1, 0x15, 0x90, 0xA1, 0x16, 0x20, 0xA3, 0x17, 0x2D, 0xA3, 0x1A,
-    0x4C, 0xA3, 0x1D, 0x59, 0xA3, 0x00, 0x44, 0x2D, 0xA1, 0x15, 0x38, 0xA1, 0x00, 0x16, 0x00, 0x85,
-    0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x04, 0x16, 0x00, 0x87, 0x63, 0x72, 0x61, 0x6D,
-    0x65, 0x6E, 0x74, 0x6F, 0x00, 0x46, 0x4C, 0xA1, 0x15, 0x58, 0xA1, 0x00, 0x04, 0x16, 0x00, 0x86,
-    0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x06, 0x04, 0x16, 0x00, 0x86, 0x61, 0x6D, 0x65,
-    0x6E, 0x74, 0x6F, 0x00, 0x46, 0x6B, 0xA1, 0x15, 0x77, 0xA1, 0x00, 0x04, 0x16, 0x00, 0x86, 0x72,
-    0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x06, 0x04, 0x16, 0x00, 0x86, 0x61, 0x6D, 0x65, 0x6E,
-    0x74, 0x6F, 0x00, 0x15, 0x06, 0x04, 0x16, 0x00, 0x86, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00,
-    0x44, 0xAC, 0xA1, 0x06, 0xCA, 0xA1, 0x07, 0x7D, 0xA2, 0x08, 0x9C, 0xA2, 0x09, 0xA9, 0xA2, 0x16,
-    0xB6, 0xA2, 0x17, 0xD5, 0xA2, 0x19, 0xE2, 0xA2, 0x1B, 0x01, 0xA3, 0x00, 0x46, 0xB3, 0xA1, 0x16,
-    0xC0, 0xA1, 0x00, 0x16, 0x00, 0x88, 0x61, 0x63, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00,
-    0x86, 0x63, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x44, 0xE3, 0xA1, 0x07, 0xF1, 0xA1,
-    0x14, 0xFE, 0xA1, 0x16, 0x1C, 0xA2, 0x19, 0x27, 0xA2, 0x1A, 0x34, 0xA2, 0x1B, 0x52, 0xA2, 0x1D,
-    0x5F, 0xA2, 0x00, 0x2C, 0x00, 0x88, 0x73, 0x61, 0x63, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F,
-    0x00, 0x04, 0x16, 0x00, 0x88, 0x63, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x44, 0x05,
-    0xA2, 0x16, 0x11, 0xA2, 0x00, 0x16, 0x00, 0x88, 0x63, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F,
-    0x00, 0x88, 0x61, 0x63, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x87, 0x61, 0x63, 0x72,
-    0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x04, 0x16, 0x00, 0x88, 0x63, 0x72, 0x61, 0x6D, 0x65,
-    0x6E, 0x74, 0x6F, 0x00, 0x44, 0x3B, 0xA2, 0x16, 0x47, 0xA2, 0x00, 0x16, 0x00, 0x88, 0x63, 0x72,
-    0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x88, 0x61, 0x63, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74,
+    0x00, 0x16, 0x16, 0x12, 0x00, 0x53, 0x5C, 0x4C, 0x00, 0x44, 0x7F, 0x4C, 0x07, 0x7F, 0x4C, 0x08,
+    0x7F, 0x4C, 0x12, 0x98, 0x4C, 0x16, 0xAF, 0x4C, 0x1A, 0x7F, 0x4C, 0x1B, 0x7F, 0x4C, 0x00, 0x52,
+    0x86, 0x4C, 0x16, 0x8F, 0x4C, 0x00, 0x13, 0x00, 0x84, 0x73, 0x73, 0x69, 0x62, 0x6C, 0x00, 0x12,
+    0x13, 0x00, 0x84, 0x73, 0x69, 0x62, 0x6C, 0x00, 0x53, 0x9F, 0x4C, 0x16, 0xA5, 0x4C, 0x00, 0x82,
+    0x73, 0x69, 0x62, 0x6C, 0x00, 0x13, 0x00, 0x85, 0x6F, 0x73, 0x73, 0x69, 0x62, 0x6C, 0x00, 0x44,
+    0xC8, 0x4C, 0x07, 0xC8, 0x4C, 0x08, 0xC8, 0x4C, 0x0C, 0xD2, 0x4C, 0x0F, 0xD2, 0x4C, 0x13, 0xDD,
+    0x4C, 0x1A, 0xC8, 0x4C, 0x1B, 0xC8, 0x4C, 0x00, 0x12, 0x13, 0x00, 0x85, 0x73, 0x73, 0x69, 0x62,
+    0x6C, 0x00, 0x52, 0xD9, 0x4C, 0x13, 0xA7, 0x4C, 0x00, 0x53, 0xCB, 0x4C, 0x00, 0x84, 0x6F, 0x73,
+    0x73, 0x69, 0x62, 0x6C, 0x00, 0x4C, 0x24, 0x4C, 0x16, 0xEC, 0x4C, 0x00, 0x16, 0x12, 0x13, 0x00,
+    0x82, 0x69, 0x62, 0x6C, 0x00, 0x44, 0x1B, 0x4C, 0x05, 0xFC, 0x4C, 0x00, 0x12, 0x15, 0x00, 0x53,
+    0xA6, 0x47, 0x00, 0x44, 0x1B, 0x4C, 0x05, 0xFC, 0x4C, 0x0C, 0x10, 0x4D, 0x16, 0x17, 0x4D, 0x00,
+    0x16, 0x12, 0x00, 0x53, 0x53, 0x4C, 0x00, 0x12, 0x13, 0x00, 0x81, 0x69, 0x62, 0x6C, 0x00, 0x44,
+    0x26, 0x4D, 0x0C, 0x31, 0x4D, 0x00, 0x0C, 0x11, 0x04, 0x0B, 0x06, 0x08, 0x00, 0x50, 0xFC, 0x49,
+    0x00, 0x11, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x80, 0x61, 0x6C, 0x00, 0x18, 0x12, 0x00, 0x46,
+    0x69, 0x1A, 0x1A, 0x69, 0x1A, 0x00, 0x0C, 0x0B, 0x00, 0x5A, 0xC1, 0x06, 0x00, 0x44, 0x54, 0x4D,
+    0x0C, 0x5C, 0x4D, 0x00, 0x05, 0x12, 0x15, 0x00, 0x53, 0x0C, 0x16, 0x00, 0x16, 0x16, 0x12, 0x00,
+    0x53, 0x0C, 0x16, 0x00, 0x44, 0x54, 0x4D, 0x0C, 0x5C, 0x4D, 0x11, 0x71, 0x4D, 0x1C, 0x78, 0x4D,
+    0x00, 0x0C, 0x19, 0x00, 0x81, 0x79, 0x6C, 0x00, 0x11, 0x0C, 0x19, 0x00, 0x81, 0x6C, 0x00, 0x45,
+    0x86, 0x4D, 0x16, 0x8E, 0x4D, 0x00, 0x16, 0x16, 0x12, 0x00, 0x53, 0xF0, 0x4C, 0x00, 0x16, 0x12,
+    0x13, 0x00, 0x80, 0x62, 0x6C, 0x00, 0x46, 0xA3, 0x4D, 0x0C, 0xAA, 0x4D, 0x0F, 0xB1, 0x4D, 0x12,
+    0x82, 0x43, 0x00, 0x4C, 0x7A, 0x20, 0x18, 0x93, 0x16, 0x00, 0x17, 0x16, 0x00, 0x81, 0x6C, 0x6C,
+    0x00, 0x48, 0xB8, 0x4D, 0x0C, 0xB8, 0x4D, 0x00, 0x5A, 0x03, 0x0C, 0x00, 0x47, 0xD8, 0x4D, 0x08,
+    0xDE, 0x4D, 0x0C, 0x11, 0x4E, 0x0E, 0xAA, 0x4E, 0x12, 0xBB, 0x4E, 0x15, 0xD8, 0x4D, 0x17, 0xC2,
+    0x4E, 0x18, 0xC8, 0x4E, 0x1A, 0xD8, 0x4D, 0x00, 0x08, 0x00, 0x5A, 0x5F, 0x0A, 0x00, 0x44, 0xF4,
+    0x4D, 0x07, 0xF4, 0x4D, 0x08, 0xFB, 0x4D, 0x14, 0xF4, 0x4D, 0x15, 0xF4, 0x4D, 0x16, 0xF4, 0x4D,
+    0x1A, 0xFF, 0x4D, 0x00, 0x1A, 0x00, 0x83, 0x65, 0x6C, 0x6C, 0x00, 0x5A, 0x5F, 0x0A, 0x00, 0x48,
+    0x09, 0x4E, 0x14, 0x0B, 0x4E, 0x1A, 0xF6, 0x4D, 0x00, 0x2C, 0x00, 0x84, 0x77, 0x65, 0x6C, 0x6C,
+    0x00, 0x44, 0x36, 0x4E, 0x08, 0x3A, 0x4E, 0x0A, 0x40, 0x4E, 0x0E, 0x51, 0x4E, 0x12, 0x51, 0x4E,
+    0x14, 0x36, 0x4E, 0x15, 0x40, 0x4E, 0x16, 0x58, 0x4E, 0x17, 0x66, 0x4E, 0x18, 0x51, 0x4E, 0x1A,
+    0x98, 0x4E, 0x1C, 0x40, 0x4E, 0x00, 0x5A, 0xEA, 0x09, 0x00, 0x1A, 0x00, 0x6C, 0xEA, 0x09, 0x00,
+    0x56, 0x47, 0x4E, 0x17, 0x4D, 0x4E, 0x00, 0x83, 0x74, 0x69, 0x6C, 0x6C, 0x00, 0x56, 0xEA, 0x09,
+    0x00, 0x57, 0x4D, 0x4E, 0x1A, 0xEA, 0x09, 0x00, 0x57, 0x5F, 0x4E, 0x1A, 0xEA, 0x09, 0x00, 0x84,
+    0x73, 0x74, 0x69, 0x6C, 0x6C, 0x00, 0x47, 0x5F, 0x4E, 0x08, 0x7F, 0x4E, 0x0A, 0x83, 0x4E, 0x15,
+    0x83, 0x4E, 0x16, 0x8B, 0x4E, 0x1A, 0x5F, 0x4E, 0x1B, 0x7F, 0x4E, 0x1C, 0x83, 0x4E, 0x00, 0x6C,
+    0x5F, 0x4E, 0x00, 0x16, 0x00, 0x84, 0x74, 0x69, 0x6C, 0x6C, 0x00, 0x47, 0x26, 0x0A, 0x08, 0x26,
+    0x0A, 0x1A, 0x28, 0x0A, 0x1B, 0x28, 0x0A, 0x00, 0x44, 0xA2, 0x4E, 0x08, 0xA2, 0x4E, 0x14, 0xA4,
+    0x4E, 0x00, 0x2C, 0x00, 0x84, 0x77, 0x69, 0x6C, 0x6C, 0x00, 0x48, 0xFB, 0x4D, 0x0C, 0xFB, 0x4D,
+    0x17, 0xB4, 0x4E, 0x00, 0x16, 0x00, 0x82, 0x69, 0x6C, 0x6C, 0x00, 0x48, 0xFB, 0x4D, 0x0C, 0xFB,
+    0x4D, 0x00, 0x0C, 0x00, 0x56, 0x47, 0x4E, 0x00, 0x0C, 0x00, 0x57, 0xD1, 0x4E, 0x1A, 0x5F, 0x0A,
+    0x00, 0x56, 0x5F, 0x0A, 0x00, 0x44, 0x54, 0x4D, 0x0C, 0x5C, 0x4D, 0x1C, 0xDF, 0x4E, 0x00, 0x0C,
+    0x19, 0x00, 0x82, 0x6E, 0x79, 0x6C, 0x00, 0x4F, 0xB1, 0x4D, 0x00, 0x46, 0xF2, 0x4E, 0x18, 0xFE,
+    0x4E, 0x00, 0x0C, 0x11, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x81, 0x61, 0x6C, 0x00, 0x17, 0x06,
+    0x00, 0x44, 0xFA, 0x4E, 0x00, 0x51, 0x0C, 0x4F, 0x1C, 0x78, 0x4D, 0x00, 0x08, 0x10, 0x04, 0x15,
+    0x06, 0x04, 0x16, 0x00, 0x80, 0x6F, 0x00, 0x44, 0x21, 0x4F, 0x17, 0x28, 0x4F, 0x1C, 0x78, 0x4D,
+    0x00, 0x17, 0x06, 0x00, 0x44, 0x26, 0x4A, 0x00, 0x06, 0x00, 0x44, 0x38, 0x4D, 0x00, 0x45, 0x47,
+    0x4F, 0x0B, 0x47, 0x4F, 0x0C, 0x52, 0x4F, 0x0D, 0x47, 0x4F, 0x10, 0x47, 0x4F, 0x11, 0x5B, 0x4F,
+    0x17, 0xCC, 0x4F, 0x18, 0xCC, 0x4F, 0x00, 0x4C, 0x4E, 0x4F, 0x11, 0x76, 0x0A, 0x00, 0x59, 0xE2,
+    0x4E, 0x00, 0x11, 0x19, 0x00, 0x83, 0x69, 0x6E, 0x79, 0x6C, 0x00, 0x45, 0x77, 0x4F, 0x0B, 0x77,
+    0x4F, 0x0C, 0x7F, 0x4F, 0x0D, 0x77, 0x4F, 0x0E, 0xBD, 0x4F, 0x10, 0x77, 0x4F, 0x12, 0xBD, 0x4F,
+    0x18, 0xBD, 0x4F, 0x19, 0xC8, 0x4F, 0x00, 0x0C, 0x19, 0x00, 0x83, 0x6E, 0x79, 0x6C, 0x00, 0x45,
+    0x98, 0x4F, 0x06, 0x98, 0x4F, 0x09, 0x9A, 0x4F, 0x0A, 0x9A, 0x4F, 0x0E, 0xA1, 0x4F, 0x12, 0xA1,
+    0x4F, 0x18, 0xA1, 0x4F, 0x19, 0xA9, 0x4F, 0x00, 0x2C, 0x00, 0x84, 0x76, 0x69, 0x6E, 0x79, 0x6C,
+    0x00, 0x19, 0x00, 0x84, 0x69, 0x6E, 0x79, 0x6C, 0x00, 0x45, 0xB6, 0x4F, 0x06, 0xB6, 0x4F, 0x09,
+    0xB6, 0x4F, 0x0A, 0xB6, 0x4F, 0x00, 0x85, 0x76, 0x69, 0x6E, 0x79, 0x6C, 0x00, 0x4C, 0xC4, 0x4F,
+    0x19, 0x55, 0x4F, 0x00, 0x59, 0x7A, 0x4F, 0x00, 0x4C, 0x9A, 0x4F, 0x00, 0x11, 0x0C, 0x00, 0x59,
+    0x79, 0x0A, 0x00, 0x47, 0xF2, 0x4F, 0x08, 0xF9, 0x4F, 0x0C, 0x44, 0x50, 0x0D, 0x4B, 0x50, 0x0E,
+    0x4B, 0x50, 0x0F, 0x44, 0x50, 0x11, 0x5E, 0x50, 0x12, 0x68, 0x50, 0x13, 0x44, 0x50, 0x1A, 0xF2,
+    0x4F, 0x00, 0x08, 0x0B, 0x17, 0x00, 0x81, 0x6D, 0x00, 0x45, 0x0F, 0x50, 0x07, 0x0F, 0x50, 0x0A,
+    0x0F, 0x50, 0x0B, 0x16, 0x50, 0x0D, 0x0F, 0x50, 0x11, 0x0F, 0x50, 0x1A, 0x0F, 0x50, 0x00, 0x0B,
+    0x17, 0x00, 0x82, 0x65, 0x6D, 0x00, 0x45, 0x2C, 0x50, 0x0A, 0x2C, 0x50, 0x0D, 0x2C, 0x50, 0x11,
+    0x2C, 0x50, 0x15, 0x2C, 0x50, 0x17, 0x33, 0x50, 0x1C, 0x2C, 0x50, 0x00, 0x17, 0x00, 0x83, 0x68,
+    0x65, 0x6D, 0x00, 0x4A, 0x3A, 0x50, 0x1C, 0x40, 0x50, 0x00, 0x84, 0x74, 0x68, 0x65, 0x6D, 0x00,
+    0x6C, 0x3A, 0x50, 0x00, 0x12, 0x15, 0x09, 0x00, 0x81, 0x6D, 0x00, 0x48, 0x52, 0x50, 0x12, 0x58,
+    0x50, 0x00, 0x0B, 0x17, 0x00, 0x81, 0x6D, 0x00, 0x15, 0x09, 0x00, 0x81, 0x6D, 0x00, 0x44, 0x91,
+    0x15, 0x08, 0x21, 0x42, 0x12, 0x58, 0x50, 0x00, 0x48, 0x7E, 0x50, 0x09, 0x7E, 0x50, 0x0C, 0x7E,
+    0x50, 0x0F, 0x7E, 0x50, 0x13, 0x7E, 0x50, 0x15, 0x85, 0x50, 0x17, 0x7E, 0x50, 0x00, 0x15, 0x09,
+    0x00, 0x82, 0x6F, 0x6D, 0x00, 0x46, 0x9B, 0x50, 0x07, 0x9B, 0x50, 0x09, 0xA2, 0x50, 0x0A, 0x9B,
+    0x50, 0x15, 0xBB, 0x50, 0x17, 0x9B, 0x50, 0x19, 0x9B, 0x50, 0x00, 0x09, 0x00, 0x83, 0x72, 0x6F,
+    0x6D, 0x00, 0x46, 0xB5, 0x50, 0x07, 0xB5, 0x50, 0x09, 0x9D, 0x50, 0x0A, 0xB5, 0x50, 0x15, 0xB5,
+    0x50, 0x19, 0xB5, 0x50, 0x00, 0x84, 0x66, 0x72, 0x6F, 0x6D, 0x00, 0x49, 0x81, 0x50, 0x00, 0x44,
+    0xF9, 0x50, 0x05, 0x55, 0x51, 0x06, 0xB4, 0x15, 0x07, 0x84, 0x51, 0x08, 0xA7, 0x51, 0x0A, 0xE8,
+    0x53, 0x0B, 0xF1, 0x53, 0x0C, 0x1B, 0x54, 0x0D, 0x55, 0x51, 0x0E, 0x24, 0x54, 0x0F, 0x1B, 0x54,
+    0x10, 0x2B, 0x54, 0x12, 0x3C, 0x54, 0x13, 0x1B, 0x54, 0x14, 0x1D, 0x55, 0x15, 0x24, 0x55, 0x16,
+    0x1D, 0x55, 0x1A, 0x3B, 0x55, 0x1D, 0xAC, 0x55, 0x00, 0x4A, 0x15, 0x51, 0x0B, 0x1C, 0x51, 0x0D,
+    0x15, 0x51, 0x11, 0x15, 0x51, 0x14, 0x15, 0x51, 0x16, 0x15, 0x51, 0x1A, 0x3E, 0x51, 0x1C, 0x4E,
+    0x51, 0x1D, 0x15, 0x51, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x61, 0x6E, 0x00, 0x45, 0x2F, 0x51, 0x0A,
+    0x2F, 0x51, 0x0D, 0x2F, 0x51, 0x11, 0x2F, 0x51, 0x15, 0x2F, 0x51, 0x17, 0x36, 0x51, 0x00, 0x17,
+    0x00, 0x83, 0x68, 0x61, 0x6E, 0x00, 0x0A, 0x00, 0x84, 0x74, 0x68, 0x61, 0x6E, 0x00, 0x4B, 0x45,
+    0x51, 0x12, 0x49, 0x51, 0x00, 0x57, 0x18, 0x51, 0x00, 0x07, 0x00, 0x81, 0x6E, 0x00, 0x0B, 0x17,
+    0x00, 0x6C, 0x18, 0x51, 0x00, 0x44, 0x5F, 0x51, 0x08, 0x65, 0x51, 0x1A, 0x7E, 0x51, 0x00, 0x0B,
+    0x17, 0x00, 0x81, 0x6E, 0x00, 0x48, 0x6F, 0x51, 0x0B, 0x73, 0x51, 0x19, 0x7A, 0x51, 0x00, 0x45,
+    0x4B, 0x51, 0x00, 0x57, 0x4B, 0x51, 0x1A, 0x4B, 0x51, 0x00, 0x48, 0x4B, 0x51, 0x00, 0x12, 0x07,
+    0x00, 0x81, 0x6E, 0x00, 0x48, 0x8B, 0x51, 0x18, 0xA1, 0x51, 0x00, 0x48, 0x6F, 0x51, 0x0B, 0x95,
+    0x51, 0x1A, 0x99, 0x51, 0x00, 0x5A, 0x4B, 0x51, 0x00, 0x17, 0x08, 0x05, 0x00, 0x81, 0x65, 0x6E,
+    0x00, 0x12, 0x00, 0x56, 0x23, 0x18, 0x00, 0x45, 0xCF, 0x51, 0x06, 0xE5, 0x51, 0x07, 0xEB, 0x51,
+    0x08, 0x09, 0x52, 0x09, 0xE5, 0x51, 0x0A, 0xCF, 0x51, 0x0B, 0x22, 0x53, 0x0D, 0x82, 0x53, 0x11,
+    0x82, 0x53, 0x15, 0x86, 0x53, 0x19, 0x97, 0x53, 0x1A, 0xBD, 0x53, 0x1C, 0x82, 0x53, 0x00, 0x4B,
+    0xD6, 0x51, 0x19, 0xE1, 0x51, 0x00, 0x57, 0xDD, 0x51, 0x1A, 0xDD, 0x51, 0x00, 0x82, 0x65, 0x6E,
+    0x00, 0x48, 0xDD, 0x51, 0x00, 0x19, 0x00, 0x48, 0xDD, 0x51, 0x00, 0x48, 0xF8, 0x51, 0x0B, 0xD6,
+    0x51, 0x19, 0xE1, 0x51, 0x1A, 0x00, 0x52, 0x00, 0x1A, 0x17, 0x08, 0x00, 0x45, 0xDD, 0x51, 0x00,
+    0x17, 0x08, 0x05, 0x00, 0x82, 0x65, 0x65, 0x6E, 0x00, 0x44, 0x31, 0x52, 0x05, 0x4A, 0x52, 0x07,
+    0x5D, 0x52, 0x08, 0x64, 0x52, 0x0A, 0x6B, 0x52, 0x0B, 0x6B, 0x52, 0x11, 0x6B, 0x52, 0x14, 0x31,
+    0x52, 0x15, 0x5D, 0x52, 0x16, 0x31, 0x52, 0x17, 0x6F, 0x52, 0x19, 0x6B, 0x52, 0x1A, 0x88, 0x52,
+    0x00, 0x57, 0x38, 0x52, 0x1A, 0x41, 0x52, 0x00, 0x08, 0x05, 0x00, 0x83, 0x77, 0x65, 0x65, 0x6E,
+    0x00, 0x17, 0x08, 0x05, 0x00, 0x83, 0x65, 0x65, 0x6E, 0x00, 0x4A, 0x57, 0x52, 0x0B, 0x57, 0x52,
+    0x11, 0x57, 0x52, 0x19, 0x57, 0x52, 0x00, 0x84, 0x62, 0x65, 0x65, 0x6E, 0x00, 0x45, 0x45, 0x52,
+    0x1A, 0x41, 0x52, 0x00, 0x17, 0x08, 0x00, 0x45, 0x3B, 0x52, 0x00, 0x45, 0x45, 0x52, 0x00, 0x48,
+    0x76, 0x52, 0x1A, 0x7E, 0x52, 0x00, 0x05, 0x00, 0x82, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x08, 0x05,
+    0x00, 0x84, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x44, 0xA7, 0x52, 0x05, 0x45, 0x52, 0x08, 0xB1,
+    0x52, 0x0A, 0xD2, 0x52, 0x14, 0xA7, 0x52, 0x15, 0xD2, 0x52, 0x16, 0xA7, 0x52, 0x17, 0xE3, 0x52,
+    0x1A, 0x41, 0x52, 0x1C, 0xD2, 0x52, 0x00, 0x17, 0x08, 0x05, 0x00, 0x84, 0x77, 0x65, 0x65, 0x6E,
+    0x00, 0x45, 0xB8, 0x52, 0x17, 0xBF, 0x52, 0x00, 0x83, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x45,
+    0xC6, 0x52, 0x08, 0xCE, 0x52, 0x00, 0x85, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x45, 0xAB,
+    0x52, 0x00, 0x48, 0xD9, 0x52, 0x17, 0xDD, 0x52, 0x00, 0x45, 0x81, 0x52, 0x00, 0x08, 0x00, 0x45,
+    0xAB, 0x52, 0x00, 0x45, 0xF9, 0x52, 0x07, 0x01, 0x53, 0x08, 0x11, 0x53, 0x0A, 0x1C, 0x53, 0x15,
+    0x01, 0x53, 0x1A, 0x01, 0x53, 0x1C, 0x1C, 0x53, 0x00, 0x84, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E,
+    0x00, 0x45, 0xC6, 0x52, 0x08, 0x08, 0x53, 0x00, 0x05, 0x00, 0x85, 0x74, 0x77, 0x65, 0x65, 0x6E,
+    0x00, 0x2C, 0x00, 0x85, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x08, 0x00, 0x45, 0x0A,
+    0x53, 0x00, 0x44, 0x47, 0x53, 0x05, 0x4E, 0x53, 0x08, 0x47, 0x53, 0x0A, 0x4E, 0x53, 0x0D, 0x4E,
+    0x53, 0x11, 0x4E, 0x53, 0x14, 0x47, 0x53, 0x15, 0x55, 0x53, 0x16, 0x47, 0x53, 0x17, 0x59, 0x53,
+    0x1A, 0x6B, 0x53, 0x1C, 0x4E, 0x53, 0x00, 0x1A, 0x00, 0x83, 0x68, 0x65, 0x6E, 0x00, 0x57, 0x49,
+    0x53, 0x1A, 0x49, 0x53, 0x00, 0x57, 0x49, 0x53, 0x00, 0x4A, 0x63, 0x53, 0x15, 0x63, 0x53, 0x1C,
+    0x63, 0x53, 0x00, 0x2C, 0x00, 0x84, 0x74, 0x68, 0x65, 0x6E, 0x00, 0x44, 0x78, 0x53, 0x08, 0x7E,
+    0x53, 0x14, 0x78, 0x53, 0x16, 0x78, 0x53, 0x00, 0x84, 0x77, 0x68, 0x65, 0x6E, 0x00, 0x6C, 0x78,
+    0x53, 0x00, 0x4B, 0xD6, 0x51, 0x00, 0x48, 0xF8, 0x51, 0x0B, 0x93, 0x53, 0x19, 0xE1, 0x51, 0x1A,
+    0x00, 0x52, 0x00, 0x5A, 0xDD, 0x51, 0x00, 0x45, 0xAD, 0x53, 0x06, 0xAD, 0x53, 0x07, 0xAD, 0x53,
+    0x08, 0xB4, 0x53, 0x09, 0xAD, 0x53, 0x0A, 0xAD, 0x53, 0x1A, 0xAD, 0x53, 0x00, 0x08, 0x00, 0x83,
+    0x76, 0x65, 0x6E, 0x00, 0x1A, 0x2C, 0x00, 0x84, 0x65, 0x76, 0x65, 0x6E, 0x00, 0x48, 0xD0, 0x53,
+    0x0B, 0xD6, 0x51, 0x12, 0x49, 0x51, 0x17, 0xE1, 0x53, 0x19, 0xE1, 0x51, 0x1A, 0x00, 0x52, 0x00,
+    0x45, 0xDD, 0x51, 0x17, 0x38, 0x52, 0x1A, 0xDA, 0x53, 0x00, 0x17, 0x08, 0x00, 0x45, 0xDD, 0x51,
+    0x00, 0x08, 0x05, 0x00, 0x80, 0x65, 0x6E, 0x00, 0x0C, 0x00, 0x48, 0x14, 0x38, 0x12, 0x23, 0x38,
+    0x00, 0x44, 0x5F, 0x51, 0x06, 0x04, 0x54, 0x08, 0x65, 0x51, 0x12, 0x0B, 0x54, 0x17, 0x14, 0x54,
+    0x1A, 0x7E, 0x51, 0x00, 0x4C, 0xEA, 0x15, 0x17, 0xEF, 0x15, 0x00, 0x17, 0x1C, 0x13, 0x00, 0x82,
+    0x68, 0x6F, 0x6E, 0x00, 0x1C, 0x13, 0x00, 0x80, 0x6F, 0x6E, 0x00, 0x0B, 0x17, 0x1C, 0x13, 0x00,
+    0x81, 0x6F, 0x6E, 0x00, 0x0C, 0x0B, 0x00, 0x57, 0xF8, 0x43, 0x00, 0x48, 0x32, 0x54, 0x1A, 0x7E,
+    0x51, 0x00, 0x48, 0x6F, 0x51, 0x0B, 0x95, 0x51, 0x19, 0x7A, 0x51, 0x00, 0x45, 0x5B, 0x54, 0x0A,
+    0x5B, 0x54, 0x0B, 0x70, 0x54, 0x0C, 0x01, 0x55, 0x0D, 0x5B, 0x54, 0x0F, 0x01, 0x55, 0x11, 0x0B,
+    0x54, 0x13, 0x01, 0x55, 0x17, 0x09, 0x55, 0x1C, 0x5B, 0x54, 0x00, 0x4B, 0x62, 0x54, 0x17, 0x6A,
+    0x54, 0x00, 0x17, 0x1C, 0x13, 0x00, 0x82, 0x6F, 0x6E, 0x00, 0x1C, 0x00, 0x53, 0x0F, 0x54, 0x00,
+    0x45, 0x86, 0x54, 0x0A, 0x8F, 0x54, 0x0D, 0x86, 0x54, 0x11, 0x86, 0x54, 0x15, 0x8F, 0x54, 0x17,
+    0xA4, 0x54, 0x1C, 0xF1, 0x54, 0x00, 0x17, 0x1C, 0x13, 0x00, 0x83, 0x68, 0x6F, 0x6E, 0x00, 0x57,
+    0x96, 0x54, 0x1C, 0x9C, 0x54, 0x00, 0x1C, 0x00, 0x53, 0x8A, 0x54, 0x00, 0x13, 0x00, 0x83, 0x74,
+    0x68, 0x6F, 0x6E, 0x00, 0x4A, 0xBA, 0x54, 0x0B, 0xBA, 0x54, 0x13, 0xC3, 0x54, 0x15, 0xBA, 0x54,
+    0x17, 0xCA, 0x54, 0x18, 0xDC, 0x54, 0x1C, 0xE7, 0x54, 0x00, 0x1C, 0x13, 0x00, 0x84, 0x74, 0x68,
+    0x6F, 0x6E, 0x00, 0x83, 0x79, 0x74, 0x68, 0x6F, 0x6E, 0x00, 0x53, 0xD1, 0x54, 0x1C, 0xD8, 0x54,
+    0x00, 0x84, 0x79, 0x74, 0x68, 0x6F, 0x6E, 0x00, 0x53, 0x8A, 0x54, 0x00, 0x53, 0xD1, 0x54, 0x1C,
+    0xE3, 0x54, 0x00, 0x53, 0xBD, 0x54, 0x00, 0x2C, 0x00, 0x84, 0x70, 0x79, 0x74, 0x68, 0x6F, 0x6E,
+    0x00, 0x53, 0xFB, 0x54, 0x17, 0xCA, 0x54, 0x1C, 0x9C, 0x54, 0x00, 0x82, 0x74, 0x68, 0x6F, 0x6E,
+    0x00, 0x0B, 0x17, 0x1C, 0x00, 0x53, 0x66, 0x54, 0x00, 0x4B, 0x10, 0x55, 0x1C, 0x16, 0x55, 0x00,
+    0x1C, 0x00, 0x53, 0x9E, 0x54, 0x00, 0x13, 0x00, 0x81, 0x68, 0x6F, 0x6E, 0x00, 0x44, 0x5F, 0x51,
+    0x1A, 0x7E, 0x51, 0x00, 0x08, 0x00, 0x48, 0x6F, 0x51, 0x0B, 0x30, 0x55, 0x1A, 0x99, 0x51, 0x00,
+    0x57, 0x37, 0x55, 0x1A, 0x4B, 0x51, 0x00, 0x6C, 0x4B, 0x51, 0x00, 0x44, 0x54, 0x55, 0x08, 0x5B,
+    0x55, 0x0C, 0x54, 0x55, 0x0F, 0x54, 0x55, 0x12, 0x6F, 0x55, 0x13, 0x54, 0x55, 0x14, 0x54, 0x55,
+    0x16, 0x54, 0x55, 0x00, 0x12, 0x07, 0x00, 0x82, 0x77, 0x6E, 0x00, 0x48, 0x6F, 0x51, 0x0B, 0x95,
+    0x51, 0x12, 0x6B, 0x55, 0x19, 0x7A, 0x51, 0x1A, 0x99, 0x51, 0x00, 0x47, 0x57, 0x55, 0x00, 0x46,
+    0x8B, 0x55, 0x07, 0x92, 0x55, 0x08, 0x8B, 0x55, 0x09, 0x8B, 0x55, 0x0C, 0x8B, 0x55, 0x0F, 0x8B,
+    0x55, 0x13, 0x8B, 0x55, 0x16, 0x8B, 0x55, 0x1B, 0x8B, 0x55, 0x00, 0x07, 0x00, 0x83, 0x6F, 0x77,
+    0x6E, 0x00, 0x46, 0xA2, 0x55, 0x08, 0xA8, 0x55, 0x09, 0xA2, 0x55, 0x16, 0xA8, 0x55, 0x1B, 0xA2,
+    0x55, 0x00, 0x84, 0x64, 0x6F, 0x77, 0x6E, 0x00, 0x6C, 0xA2, 0x55, 0x00, 0x04, 0x0B, 0x17, 0x00,
+    0x81, 0x6E, 0x00, 0x44, 0xDE, 0x55, 0x07, 0xDE, 0x55, 0x08, 0xDE, 0x55, 0x0A, 0xE5, 0x55, 0x0C,
+    0x0B, 0x56, 0x0F, 0x1E, 0x56, 0x11, 0x2D, 0x56, 0x13, 0x4C, 0x56, 0x15, 0x58, 0x56, 0x16, 0x5F,
+    0x56, 0x17, 0xA3, 0x56, 0x1A, 0xDE, 0x55, 0x1B, 0xDE, 0x55, 0x1C, 0x45, 0x59, 0x00, 0x16, 0x0F,
+    0x04, 0x00, 0x81, 0x6F, 0x00, 0x51, 0xEC, 0x55, 0x17, 0xF8, 0x55, 0x00, 0x08, 0x10, 0x04, 0x15,
+    0x06, 0x04, 0x16, 0x00, 0x81, 0x74, 0x6F, 0x00, 0x11, 0x00, 0x48, 0x01, 0x56, 0x0C, 0x5A, 0x09,
+    0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x81, 0x6F, 0x00, 0x56, 0x12, 0x56, 0x17, 0x18,
+    0x56, 0x00, 0x0F, 0x04, 0x00, 0x81, 0x6F, 0x00, 0x11, 0x0C, 0x00, 0x81, 0x6F, 0x00, 0x4F, 0x28,
+    0x56, 0x16, 0x12, 0x56, 0x1C, 0xD7, 0x45, 0x00, 0x08, 0x1A, 0x00, 0x80, 0x00, 0x48, 0x34, 0x56,
+    0x17, 0x3F, 0x56, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x80, 0x74, 0x6F, 0x00, 0x08,
+    0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x82, 0x6E, 0x74, 0x6F, 0x00, 0x4F, 0x53, 0x56, 0x16,
+    0x12, 0x56, 0x00, 0x08, 0x0B, 0x00, 0x80, 0x00, 0x51, 0xEC, 0x55, 0x17, 0x51, 0x09, 0x00, 0x44,
+    0x72, 0x56, 0x07, 0x72, 0x56, 0x0E, 0x72, 0x56, 0x0F, 0x79, 0x56, 0x1A, 0x72, 0x56, 0x1B, 0x72,
+    0x56, 0x00, 0x0F, 0x04, 0x00, 0x82, 0x73, 0x6F, 0x00, 0x44, 0x8C, 0x56, 0x0E, 0x9C, 0x56, 0x12,
+    0x9C, 0x56, 0x14, 0x9C, 0x56, 0x16, 0x9C, 0x56, 0x1D, 0x9C, 0x56, 0x00, 0x54, 0x96, 0x56, 0x1A,
+    0x96, 0x56, 0x1D, 0x96, 0x56, 0x00, 0x84, 0x61, 0x6C, 0x73, 0x6F, 0x00, 0x04, 0x00, 0x83, 0x6C,
+    0x73, 0x6F, 0x00, 0x45, 0xBF, 0x56, 0x08, 0xE2, 0x56, 0x0A, 0x01, 0x57, 0x0B, 0xBF, 0x56, 0x0D,
+    0xBF, 0x56, 0x10, 0xBF, 0x56, 0x11, 0x0D, 0x57, 0x15, 0x41, 0x59, 0x1C, 0x41, 0x59, 0x00, 0x48,
+    0xC6, 0x56, 0x11, 0xD0, 0x56, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x00, 0x56, 0x47, 0x56, 0x00,
+    0x48, 0xD7, 0x56, 0x0C, 0xDE, 0x56, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x82, 0x74,
+    0x6F, 0x00, 0x50, 0xE9, 0x56, 0x11, 0xF4, 0x56, 0x00, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x81,
+    0x6E, 0x74, 0x6F, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x83, 0x65, 0x6E, 0x74, 0x6F,
+    0x00, 0x11, 0x08, 0x10, 0x04, 0x15, 0x06, 0x04, 0x00, 0x56, 0xDE, 0x56, 0x00, 0x45, 0x2F, 0x57,
+    0x07, 0x42, 0x57, 0x08, 0x52, 0x57, 0x0B, 0x2F, 0x57, 0x0C, 0x0F, 0x59, 0x0D, 0x2F, 0x57, 0x0E,
+    0x18, 0x59, 0x10, 0x1C, 0x59, 0x15, 0x42, 0x57, 0x18, 0x18, 0x59, 0x1A, 0x42, 0x57, 0x00, 0x48,
+    0x36, 0x57, 0x0C, 0x3D, 0x57, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x83, 0x6E, 0x74,
+    0x6F, 0x00, 0x48, 0x36, 0x57, 0x10, 0x49, 0x57, 0x00, 0x04, 0x15, 0x06, 0x04, 0x00, 0x56, 0xFB,
+    0x56, 0x00, 0x44, 0x6B, 0x57, 0x07, 0x8A, 0x57, 0x0D, 0x97, 0x57, 0x0E, 0x97, 0x57, 0x10, 0xB3,
+    0x57, 0x11, 0x97, 0x57, 0x15, 0x8A, 0x57, 0x1A, 0x8A, 0x57, 0x00, 0x50, 0x72, 0x57, 0x15, 0x7F,
+    0x57, 0x00, 0x15, 0x06, 0x04, 0x16, 0x00, 0x85, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x06,
+    0x04, 0x16, 0x00, 0x83, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16,
+    0x00, 0x84, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x44, 0x9E, 0x57, 0x10, 0xAA, 0x57, 0x00, 0x15, 0x06,
+    0x04, 0x16, 0x00, 0x84, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x04, 0x15, 0x06, 0x04, 0x00, 0x56,
+    0x91, 0x57, 0x00, 0x44, 0xCF, 0x57, 0x0D, 0xD3, 0x58, 0x0E, 0xD3, 0x58, 0x11, 0xD3, 0x58, 0x14,
+    0xE0, 0x58, 0x15, 0xF6, 0x58, 0x16, 0xE0, 0x58, 0x1A, 0xE0, 0x58, 0x1D, 0xE0, 0x58, 0x00, 0x46,
+    0xEB, 0x57, 0x08, 0x0A, 0x58, 0x09, 0x0A, 0x58, 0x14, 0x29, 0x58, 0x15, 0x31, 0x58, 0x16, 0x29,
+    0x58, 0x17, 0x0A, 0x58, 0x1A, 0x29, 0x58, 0x1D, 0x29, 0x58, 0x00, 0x44, 0xF2, 0x57, 0x15, 0xFD,
+    0x57, 0x00, 0x16, 0x00, 0x85, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x04, 0x16, 0x00,
+    0x87, 0x63, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x46, 0x11, 0x58, 0x15, 0x1D, 0x58,
+    0x00, 0x04, 0x16, 0x00, 0x86, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x06, 0x04, 0x16,
+    0x00, 0x86, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x15, 0x06, 0x04, 0x00, 0x56, 0x21, 0x58,
+    0x00, 0x44, 0x4D, 0x58, 0x06, 0x6B, 0x58, 0x07, 0xB5, 0x58, 0x08, 0xCC, 0x58, 0x09, 0xCC, 0x58,
+    0x16, 0xB5, 0x58, 0x17, 0xCC, 0x58, 0x19, 0xB5, 0x58, 0x1B, 0xB5, 0x58, 0x00, 0x46, 0x54, 0x58,
+    0x16, 0x61, 0x58, 0x00, 0x16, 0x00, 0x88, 0x61, 0x63, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F,
+    0x00, 0x86, 0x63, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x44, 0x84, 0x58, 0x07, 0x92,
+    0x58, 0x14, 0x9F, 0x58, 0x16, 0xAA, 0x58, 0x19, 0x92, 0x58, 0x1A, 0x9F, 0x58, 0x1B, 0x92, 0x58,
+    0x1D, 0x9F, 0x58, 0x00, 0x2C, 0x00, 0x88, 0x73, 0x61, 0x63, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74,
     0x6F, 0x00, 0x04, 0x16, 0x00, 0x88, 0x63, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x44,
-    0x66, 0xA2, 0x16, 0x72, 0xA2, 0x00, 0x16, 0x00, 0x88, 0x63, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74,
-    0x6F, 0x00, 0x88, 0x61, 0x63, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x44, 0x84, 0xA2,
-    0x06, 0x90, 0xA2, 0x00, 0x16, 0x00, 0x87, 0x63, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00,
-    0x04, 0x16, 0x00, 0x87, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x06, 0x04, 0x16, 0x00,
-    0x87, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x06, 0x04, 0x16, 0x00, 0x87, 0x72, 0x61,
-    0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x44, 0xBD, 0xA2, 0x06, 0xC9, 0xA2, 0x00, 0x16, 0x00, 0x87,
-    0x63, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x04, 0x16, 0x00, 0x87, 0x72, 0x61, 0x6D,
-    0x65, 0x6E, 0x74, 0x6F, 0x00, 0x06, 0x04, 0x16, 0x00, 0x87, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74,
-    0x6F, 0x00, 0x44, 0xE9, 0xA2, 0x06, 0xF5, 0xA2, 0x00, 0x16, 0x00, 0x87, 0x63, 0x72, 0x61, 0x6D,
-    0x65, 0x6E, 0x74, 0x6F, 0x00, 0x04, 0x16, 0x00, 0x87, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F,
-    0x00, 0x44, 0x08, 0xA3, 0x06, 0x14, 0xA3, 0x00, 0x16, 0x00, 0x87, 0x63, 0x72, 0x61, 0x6D, 0x65,
-    0x6E, 0x74, 0x6F, 0x00, 0x04, 0x16, 0x00, 0x87, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00,
-    0x15, 0x06, 0x04, 0x16, 0x00, 0x86, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x46, 0x34, 0xA3,
-    0x15, 0x40, 0xA3, 0x00, 0x04, 0x16, 0x00, 0x86, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00,
-    0x06, 0x04, 0x16, 0x00, 0x86, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x15, 0x06, 0x04, 0x16,
-    0x00, 0x86, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x15, 0x06, 0x04, 0x16, 0x00, 0x86, 0x61,
-    0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x85, 0x6D, 0x65, 0x6E,
-    0x74, 0x6F, 0x00, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x85, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00,
-    0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x85, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x44, 0x94, 0xA3,
-    0x15, 0xA0, 0xA3, 0x00, 0x15, 0x06, 0x04, 0x16, 0x00, 0x85, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00,
-    0x06, 0x04, 0x16, 0x00, 0x85, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x44, 0xB3, 0xA3, 0x06,
-    0xC0, 0xA3, 0x00, 0x06, 0x04, 0x16, 0x00, 0x86, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00,
-    0x04, 0x16, 0x00, 0x84, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x44, 0xD2, 0xA3, 0x15, 0xDE,
-    0xA3, 0x00, 0x15, 0x06, 0x04, 0x16, 0x00, 0x85, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x06, 0x04,
-    0x16, 0x00, 0x85, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x44, 0xF1, 0xA3, 0x15, 0xFD, 0xA3,
-    0x00, 0x15, 0x06, 0x04, 0x16, 0x00, 0x85, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x06, 0x04, 0x16,
-    0x00, 0x85, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x44, 0x10, 0xA4, 0x15, 0x1C, 0xA4, 0x00,
-    0x15, 0x06, 0x04, 0x16, 0x00, 0x85, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x06, 0x04, 0x16, 0x00,
-    0x85, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x44, 0x2F, 0xA4, 0x10, 0x3B, 0xA4, 0x00, 0x15,
-    0x06, 0x04, 0x16, 0x00, 0x84, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x04, 0x15, 0x06, 0x04, 0x16,
-    0x00, 0x84, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x84, 0x65,
-    0x6E, 0x74, 0x6F, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x84, 0x65, 0x6E, 0x74, 0x6F,
-    0x00, 0x48, 0x68, 0xA4, 0x0C, 0x74, 0xA4, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x83,
-    0x6E, 0x74, 0x6F, 0x00, 0x83, 0x6E, 0x74, 0x6F, 0x00, 0x18, 0x2C, 0x00, 0x84, 0x69, 0x6E, 0x74,
-    0x6F, 0x00, 0x48, 0x89, 0xA4, 0x0C, 0x95, 0xA4, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00,
-    0x83, 0x6E, 0x74, 0x6F, 0x00, 0x83, 0x6E, 0x74, 0x6F, 0x00, 0x0C, 0x00, 0x83, 0x6E, 0x74, 0x6F,
-    0x00, 0x44, 0xAB, 0xA4, 0x08, 0xB6, 0xA4, 0x0C, 0xD4, 0xA4, 0x00, 0x15, 0x06, 0x04, 0x16, 0x00,
-    0x82, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x44, 0xBD, 0xA4, 0x10, 0xC9, 0xA4, 0x00, 0x15, 0x06, 0x04,
-    0x16, 0x00, 0x84, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x83,
-    0x6E, 0x74, 0x6F, 0x00, 0x83, 0x6E, 0x74, 0x6F, 0x00, 0x48, 0xE0, 0xA4, 0x10, 0xEC, 0xA4, 0x00,
-    0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x83, 0x6E, 0x74, 0x6F, 0x00, 0x04, 0x15, 0x06, 0x04,
-    0x16, 0x00, 0x83, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x0C, 0x00, 0x83, 0x6E, 0x74, 0x6F, 0x00, 0x48,
-    0x06, 0xA5, 0x10, 0x12, 0xA5, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x83, 0x6E, 0x74,
-    0x6F, 0x00, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x83, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x11, 0x00,
-    0x48, 0x27, 0xA5, 0x0C, 0x32, 0xA5, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x82, 0x74,
-    0x6F, 0x00, 0x82, 0x74, 0x6F, 0x00, 0x11, 0x00, 0x48, 0x3F, 0xA5, 0x0C, 0x4A, 0xA5, 0x00, 0x10,
-    0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x82, 0x74, 0x6F, 0x00, 0x82, 0x74, 0x6F, 0x00, 0x16, 0x0F,
-    0x04, 0x00, 0x81, 0x6F, 0x00, 0x16, 0x0F, 0x04, 0x00, 0x81, 0x6F, 0x00, 0x51, 0x63, 0xA5, 0x17,
-    0x7A, 0xA5, 0x00, 0x48, 0x6A, 0xA5, 0x0C, 0x75, 0xA5, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16,
-    0x00, 0x81, 0x74, 0x6F, 0x00, 0x19, 0x00, 0x80, 0x6C, 0x00, 0x11, 0x00, 0x48, 0x83, 0xA5, 0x0C,
-    0x8D, 0xA5, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x81, 0x6F, 0x00, 0x81, 0x6F, 0x00,
-    0x4E, 0x9D, 0xA5, 0x0F, 0xA4, 0xA5, 0x12, 0x53, 0xA6, 0x17, 0x5A, 0xA6, 0x00, 0x0F, 0x08, 0x0B,
-    0x00, 0x81, 0x70, 0x00, 0x47, 0xB7, 0xA5, 0x08, 0xBE, 0xA5, 0x0E, 0x37, 0xA6, 0x12, 0x3E, 0xA6,
-    0x15, 0x45, 0xA6, 0x1A, 0x4C, 0xA6, 0x00, 0x08, 0x0B, 0x00, 0x82, 0x6C, 0x70, 0x00, 0x45, 0xDA,
-    0xA5, 0x07, 0xE1, 0xA5, 0x0A, 0xE8, 0xA5, 0x0B, 0xEF, 0xA5, 0x0D, 0x14, 0xA6, 0x11, 0x1B, 0xA6,
-    0x15, 0x22, 0xA6, 0x1A, 0x29, 0xA6, 0x1C, 0x30, 0xA6, 0x00, 0x0B, 0x00, 0x83, 0x65, 0x6C, 0x70,
-    0x00, 0x0B, 0x00, 0x83, 0x65, 0x6C, 0x70, 0x00, 0x0B, 0x00, 0x83, 0x65, 0x6C, 0x70, 0x00, 0x45,
-    0xFC, 0xA5, 0x0A, 0x02, 0xA6, 0x0D, 0x08, 0xA6, 0x1C, 0x0E, 0xA6, 0x00, 0x84, 0x68, 0x65, 0x6C,
-    0x70, 0x00, 0x84, 0x68, 0x65, 0x6C, 0x70, 0x00, 0x84, 0x68, 0x65, 0x6C, 0x70, 0x00, 0x84, 0x68,
-    0x65, 0x6C, 0x70, 0x00, 0x0B, 0x00, 0x83, 0x65, 0x6C, 0x70, 0x00, 0x0B, 0x00, 0x83, 0x65, 0x6C,
-    0x70, 0x00, 0x0B, 0x00, 0x83, 0x65, 0x6C, 0x70, 0x00, 0x0B, 0x00, 0x83, 0x65, 0x6C, 0x70, 0x00,
-    0x0B, 0x00, 0x83, 0x65, 0x6C, 0x70, 0x00, 0x08, 0x0B, 0x00, 0x82, 0x6C, 0x70, 0x00, 0x08, 0x0B,
-    0x00, 0x82, 0x6C, 0x70, 0x00, 0x08, 0x0B, 0x00, 0x82, 0x6C, 0x70, 0x00, 0x08, 0x0B, 0x00, 0x82,
-    0x6C, 0x70, 0x00, 0x17, 0x11, 0x0C, 0x2C, 0x00, 0x80, 0x00, 0x11, 0x08, 0x10, 0x04, 0x15, 0x06,
-    0x04, 0x16, 0x00, 0x80, 0x6F, 0x00, 0x1A, 0x12, 0x11, 0x0E, 0x00, 0x80, 0x00, 0x74, 0xAD, 0xA6,
-    0x04, 0xC0, 0xA6, 0x06, 0x54, 0xA7, 0x07, 0x5B, 0xA7, 0x08, 0xE1, 0xA7, 0x09, 0xA5, 0xB3, 0x0B,
-    0xC1, 0xB3, 0x0C, 0xE1, 0xB3, 0x0D, 0x5E, 0xB5, 0x0E, 0x65, 0xB5, 0x0F, 0x7A, 0xB5, 0x12, 0x81,
-    0xB5, 0x14, 0x89, 0xB5, 0x15, 0x90, 0xB5, 0x16, 0xC2, 0xB5, 0x17, 0xDE, 0xB5, 0x18, 0x65, 0xB6,
-    0x19, 0xF9, 0xB6, 0x1A, 0x02, 0xB7, 0x1C, 0x81, 0xB7, 0x1D, 0x95, 0xB7, 0x00, 0x11, 0x00, 0x44,
-    0xB6, 0xA6, 0x12, 0xBB, 0xA6, 0x00, 0x06, 0x00, 0x80, 0x74, 0x00, 0x07, 0x00, 0x80, 0x74, 0x00,
-    0x47, 0xD3, 0xA6, 0x08, 0xDA, 0xA6, 0x14, 0x38, 0xA7, 0x15, 0x3F, 0xA7, 0x16, 0x46, 0xA7, 0x1D,
-    0x4D, 0xA7, 0x00, 0x08, 0x1C, 0x00, 0x82, 0x61, 0x72, 0x00, 0x47, 0xED, 0xA6, 0x15, 0xF4, 0xA6,
-    0x17, 0x03, 0xA7, 0x18, 0x0A, 0xA7, 0x1A, 0x11, 0xA7, 0x1C, 0x18, 0xA7, 0x00, 0x1C, 0x00, 0x83,
-    0x65, 0x61, 0x72, 0x00, 0x4A, 0xFB, 0xA6, 0x1C, 0xFE, 0xA6, 0x00, 0x80, 0x74, 0x00, 0x83, 0x65,
-    0x61, 0x72, 0x00, 0x1C, 0x00, 0x83, 0x65, 0x61, 0x72, 0x00, 0x1C, 0x00, 0x83, 0x65, 0x61, 0x72,
-    0x00, 0x1C, 0x00, 0x83, 0x65, 0x61, 0x72, 0x00, 0x4B, 0x22, 0xA7, 0x17, 0x2A, 0xA7, 0x18, 0x32,
-    0xA7, 0x00, 0x2C, 0x00, 0x84, 0x79, 0x65, 0x61, 0x72, 0x00, 0x2C, 0x00, 0x84, 0x79, 0x65, 0x61,
-    0x72, 0x00, 0x84, 0x79, 0x65, 0x61, 0x72, 0x00, 0x08, 0x1C, 0x00, 0x82, 0x61, 0x72, 0x00, 0x08,
-    0x1C, 0x00, 0x82, 0x61, 0x72, 0x00, 0x08, 0x1C, 0x00, 0x82, 0x61, 0x72, 0x00, 0x08, 0x1C, 0x00,
-    0x82, 0x61, 0x72, 0x00, 0x04, 0x1B, 0x08, 0x00, 0x80, 0x74, 0x00, 0x47, 0x6B, 0xA7, 0x08, 0x81,
-    0xA7, 0x0C, 0xBD, 0xA7, 0x17, 0xC6, 0xA7, 0x19, 0xDA, 0xA7, 0x00, 0x4C, 0x72, 0xA7, 0x11, 0x7B,
-    0xA7, 0x00, 0x16, 0x11, 0x12, 0x06, 0x00, 0x81, 0x65, 0x72, 0x00, 0x18, 0x00, 0x81, 0x65, 0x72,
-    0x00, 0x47, 0x94, 0xA7, 0x0B, 0x9A, 0xA7, 0x0C, 0xA0, 0xA7, 0x11, 0xAA, 0xA7, 0x17, 0xB1, 0xA7,
-    0x19, 0xB7, 0xA7, 0x00, 0x11, 0x18, 0x00, 0x81, 0x72, 0x00, 0x17, 0x12, 0x00, 0x81, 0x72, 0x00,
-    0x16, 0x11, 0x12, 0x06, 0x00, 0x82, 0x64, 0x65, 0x72, 0x00, 0x18, 0x00, 0x82, 0x64, 0x65, 0x72,
-    0x00, 0x09, 0x04, 0x00, 0x81, 0x72, 0x00, 0x08, 0x11, 0x00, 0x81, 0x72, 0x00, 0x16, 0x11, 0x12,
-    0x06, 0x00, 0x80, 0x65, 0x72, 0x00, 0x49, 0xCD, 0xA7, 0x17, 0xD3, 0xA7, 0x00, 0x04, 0x00, 0x81,
-    0x65, 0x72, 0x00, 0x08, 0x05, 0x00, 0x81, 0x65, 0x72, 0x00, 0x08, 0x11, 0x00, 0x81, 0x65, 0x72,
-    0x00, 0x44, 0x1E, 0xA8, 0x05, 0x24, 0xA8, 0x06, 0x4E, 0xA8, 0x07, 0x93, 0xA8, 0x08, 0xF1, 0xAC,
-    0x09, 0x19, 0xAD, 0x0A, 0x69, 0xAD, 0x0B, 0xBB, 0xAD, 0x0C, 0x43, 0xAF, 0x0D, 0x5E, 0xAF, 0x10,
-    0x73, 0xAF, 0x11, 0x79, 0xAF, 0x15, 0x99, 0xAF, 0x16, 0xD0, 0xAF, 0x17, 0x07, 0xB0, 0x18, 0xD2,
-    0xB1, 0x19, 0xD8, 0xB1, 0x1A, 0xE7, 0xB2, 0x1B, 0x36, 0xB3, 0x1C, 0x67, 0xB3, 0x00, 0x08, 0x1C,
-    0x00, 0x81, 0x72, 0x00, 0x48, 0x2E, 0xA8, 0x0B, 0x36, 0xA8, 0x19, 0x3D, 0xA8, 0x00, 0x11, 0x2C,
-    0x00, 0x82, 0x76, 0x65, 0x72, 0x00, 0x17, 0x12, 0x00, 0x82, 0x65, 0x72, 0x00, 0x48, 0x44, 0xA8,
-    0x12, 0x4A, 0xA8, 0x00, 0x11, 0x00, 0x82, 0x65, 0x72, 0x00, 0x82, 0x65, 0x72, 0x00, 0x47, 0x5B,
-    0xA8, 0x08, 0x71, 0xA8, 0x0C, 0x78, 0xA8, 0x19, 0x82, 0xA8, 0x00, 0x4C, 0x62, 0xA8, 0x11, 0x6B,
-    0xA8, 0x00, 0x16, 0x11, 0x12, 0x06, 0x00, 0x82, 0x65, 0x72, 0x00, 0x18, 0x00, 0x82, 0x65, 0x72,
-    0x00, 0x11, 0x00, 0x82, 0x76, 0x65, 0x72, 0x00, 0x16, 0x11, 0x12, 0x06, 0x00, 0x82, 0x64, 0x65,
-    0x72, 0x00, 0x48, 0x89, 0xA8, 0x12, 0x8F, 0xA8, 0x00, 0x11, 0x00, 0x82, 0x65, 0x72, 0x00, 0x82,
-    0x65, 0x72, 0x00, 0x44, 0xCA, 0xA8, 0x05, 0xCF, 0xA8, 0x06, 0xD7, 0xA8, 0x07, 0xEF, 0xA8, 0x08,
-    0x05, 0xA9, 0x09, 0x1D, 0xA9, 0x0B, 0x35, 0xA9, 0x0C, 0x52, 0xA9, 0x0D, 0xA0, 0xAB, 0x0E, 0xB4,
-    0xAB, 0x10, 0xCF, 0xAB, 0x11, 0xE3, 0xAB, 0x12, 0x3D, 0xAC, 0x16, 0x58, 0xAC, 0x17, 0x8D, 0xAC,
-    0x18, 0xA1, 0xAC, 0x19, 0xC8, 0xAC, 0x1B, 0xD9, 0xAC, 0x00, 0x10, 0x2C, 0x00, 0x80, 0x00, 0x11,
-    0x18, 0x00, 0x83, 0x64, 0x65, 0x72, 0x00, 0x4C, 0xDE, 0xA8, 0x11, 0xE8, 0xA8, 0x00, 0x16, 0x11,
-    0x12, 0x06, 0x00, 0x83, 0x64, 0x65, 0x72, 0x00, 0x18, 0x00, 0x83, 0x64, 0x65, 0x72, 0x00, 0x4C,
-    0xF6, 0xA8, 0x11, 0xFF, 0xA8, 0x00, 0x16, 0x11, 0x12, 0x06, 0x00, 0x82, 0x65, 0x72, 0x00, 0x18,
-    0x00, 0x82, 0x65, 0x72, 0x00, 0x4C, 0x0C, 0xA9, 0x11, 0x16, 0xA9, 0x00, 0x16, 0x11, 0x12, 0x06,
-    0x00, 0x83, 0x64, 0x65, 0x72, 0x00, 0x18, 0x00, 0x83, 0x64, 0x65, 0x72, 0x00, 0x4C, 0x24, 0xA9,
-    0x11, 0x2E, 0xA9, 0x00, 0x16, 0x11, 0x12, 0x06, 0x00, 0x83, 0x64, 0x65, 0x72, 0x00, 0x18, 0x00,
-    0x83, 0x64, 0x65, 0x72, 0x00, 0x51, 0x3F, 0xA9, 0x17, 0x46, 0xA9, 0x18, 0x4C, 0xA9, 0x00, 0x18,
-    0x00, 0x83, 0x64, 0x65, 0x72, 0x00, 0x12, 0x00, 0x82, 0x65, 0x72, 0x00, 0x83, 0x6E, 0x64, 0x65,
-    0x72, 0x00, 0x44, 0x71, 0xA9, 0x07, 0x7C, 0xA9, 0x08, 0x97, 0xA9, 0x0E, 0xB2, 0xA9, 0x11, 0xBD,
-    0xA9, 0x12, 0xD8, 0xA9, 0x16, 0xE3, 0xA9, 0x18, 0x5F, 0xAB, 0x1A, 0x6A, 0xAB, 0x1B, 0x85, 0xAB,
-    0x00, 0x11, 0x12, 0x06, 0x00, 0x84, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x51, 0x83, 0xA9, 0x16,
-    0x8D, 0xA9, 0x00, 0x12, 0x06, 0x00, 0x84, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x11, 0x12, 0x06,
-    0x00, 0x84, 0x69, 0x64, 0x65, 0x72, 0x00, 0x51, 0x9E, 0xA9, 0x16, 0xA8, 0xA9, 0x00, 0x12, 0x06,
-    0x00, 0x84, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x11, 0x12, 0x06, 0x00, 0x84, 0x69, 0x64, 0x65,
-    0x72, 0x00, 0x16, 0x11, 0x12, 0x06, 0x00, 0x84, 0x69, 0x64, 0x65, 0x72, 0x00, 0x52, 0xC4, 0xA9,
-    0x16, 0xCD, 0xA9, 0x00, 0x06, 0x00, 0x83, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x12, 0x06, 0x00,
-    0x85, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x16, 0x11, 0x12, 0x06, 0x00, 0x84, 0x69, 0x64,
-    0x65, 0x72, 0x00, 0x44, 0x05, 0xAA, 0x05, 0x10, 0xAA, 0x07, 0x2B, 0xAA, 0x08, 0x36, 0xAA, 0x0B,
-    0x41, 0xAA, 0x0D, 0x5C, 0xAA, 0x10, 0x77, 0xAA, 0x11, 0x92, 0xAA, 0x12, 0x3D, 0xAB, 0x1A, 0x49,
-    0xAB, 0x1B, 0x54, 0xAB, 0x00, 0x11, 0x12, 0x06, 0x00, 0x85, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00,
-    0x51, 0x17, 0xAA, 0x12, 0x21, 0xAA, 0x00, 0x12, 0x06, 0x00, 0x85, 0x73, 0x69, 0x64, 0x65, 0x72,
-    0x00, 0x06, 0x00, 0x85, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x11, 0x12, 0x06, 0x00, 0x85,
-    0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x11, 0x12, 0x06, 0x00, 0x85, 0x73, 0x69, 0x64, 0x65, 0x72,
-    0x00, 0x51, 0x48, 0xAA, 0x12, 0x52, 0xAA, 0x00, 0x12, 0x06, 0x00, 0x85, 0x73, 0x69, 0x64, 0x65,
-    0x72, 0x00, 0x06, 0x00, 0x85, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x51, 0x63, 0xAA, 0x12,
-    0x6D, 0xAA, 0x00, 0x12, 0x06, 0x00, 0x85, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x06, 0x00, 0x85,
-    0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x51, 0x7E, 0xAA, 0x12, 0x88, 0xAA, 0x00, 0x12, 0x06,
-    0x00, 0x85, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x06, 0x00, 0x85, 0x6E, 0x73, 0x69, 0x64, 0x65,
-    0x72, 0x00, 0x45, 0xAE, 0xAA, 0x06, 0xB9, 0xAA, 0x0B, 0xC2, 0xAA, 0x0C, 0xCD, 0xAA, 0x0D, 0xE7,
-    0xAA, 0x0F, 0xF2, 0xAA, 0x10, 0x0C, 0xAB, 0x12, 0x17, 0xAB, 0x13, 0x23, 0xAB, 0x00, 0x12, 0x06,
-    0x00, 0x86, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x85, 0x6F, 0x6E, 0x73, 0x69, 0x64, 0x65,
-    0x72, 0x00, 0x12, 0x06, 0x00, 0x86, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x46, 0xD4, 0xAA,
-    0x12, 0xDD, 0xAA, 0x00, 0x86, 0x6F, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x06, 0x00, 0x86,
-    0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x12, 0x06, 0x00, 0x86, 0x6E, 0x73, 0x69, 0x64, 0x65,
-    0x72, 0x00, 0x46, 0xF9, 0xAA, 0x12, 0x02, 0xAB, 0x00, 0x86, 0x6F, 0x6E, 0x73, 0x69, 0x64, 0x65,
-    0x72, 0x00, 0x06, 0x00, 0x86, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x12, 0x06, 0x00, 0x86,
-    0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x2C, 0x00, 0x86, 0x63, 0x6F, 0x6E, 0x73, 0x69, 0x64,
-    0x65, 0x72, 0x00, 0x46, 0x2A, 0xAB, 0x12, 0x33, 0xAB, 0x00, 0x86, 0x6F, 0x6E, 0x73, 0x69, 0x64,
-    0x65, 0x72, 0x00, 0x06, 0x00, 0x86, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x11, 0x06, 0x00,
-    0x86, 0x6F, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x11, 0x12, 0x06, 0x00, 0x85, 0x73, 0x69,
-    0x64, 0x65, 0x72, 0x00, 0x11, 0x12, 0x06, 0x00, 0x85, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x16,
-    0x11, 0x12, 0x06, 0x00, 0x84, 0x69, 0x64, 0x65, 0x72, 0x00, 0x51, 0x71, 0xAB, 0x16, 0x7B, 0xAB,
-    0x00, 0x12, 0x06, 0x00, 0x84, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x11, 0x12, 0x06, 0x00, 0x84,
-    0x69, 0x64, 0x65, 0x72, 0x00, 0x51, 0x8C, 0xAB, 0x16, 0x96, 0xAB, 0x00, 0x12, 0x06, 0x00, 0x84,
-    0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x11, 0x12, 0x06, 0x00, 0x84, 0x69, 0x64, 0x65, 0x72, 0x00,
-    0x51, 0xA7, 0xAB, 0x18, 0xAE, 0xAB, 0x00, 0x18, 0x00, 0x83, 0x64, 0x65, 0x72, 0x00, 0x83, 0x6E,
-    0x64, 0x65, 0x72, 0x00, 0x4C, 0xBB, 0xAB, 0x16, 0xC5, 0xAB, 0x00, 0x16, 0x11, 0x12, 0x06, 0x00,
-    0x83, 0x64, 0x65, 0x72, 0x00, 0x11, 0x12, 0x06, 0x00, 0x83, 0x69, 0x64, 0x65, 0x72, 0x00, 0x51,
-    0xD6, 0xAB, 0x18, 0xDD, 0xAB, 0x00, 0x18, 0x00, 0x83, 0x64, 0x65, 0x72, 0x00, 0x83, 0x6E, 0x64,
-    0x65, 0x72, 0x00, 0x45, 0xF6, 0xAB, 0x0B, 0xFE, 0xAB, 0x0D, 0x06, 0xAC, 0x10, 0x0D, 0xAC, 0x18,
-    0x15, 0xAC, 0x1C, 0x34, 0xAC, 0x00, 0x18, 0x00, 0x84, 0x6E, 0x64, 0x65, 0x72, 0x00, 0x18, 0x00,
-    0x84, 0x6E, 0x64, 0x65, 0x72, 0x00, 0x84, 0x75, 0x6E, 0x64, 0x65, 0x72, 0x00, 0x18, 0x00, 0x84,
-    0x6E, 0x64, 0x65, 0x72, 0x00, 0x4C, 0x1F, 0xAC, 0x0D, 0x26, 0xAC, 0x1C, 0x2D, 0xAC, 0x00, 0x85,
-    0x75, 0x6E, 0x64, 0x65, 0x72, 0x00, 0x85, 0x75, 0x6E, 0x64, 0x65, 0x72, 0x00, 0x85, 0x75, 0x6E,
-    0x64, 0x65, 0x72, 0x00, 0x2C, 0x00, 0x84, 0x75, 0x6E, 0x64, 0x65, 0x72, 0x00, 0x4C, 0x44, 0xAC,
-    0x16, 0x4E, 0xAC, 0x00, 0x16, 0x11, 0x12, 0x06, 0x00, 0x83, 0x64, 0x65, 0x72, 0x00, 0x11, 0x12,
-    0x06, 0x00, 0x83, 0x69, 0x64, 0x65, 0x72, 0x00, 0x4C, 0x5F, 0xAC, 0x11, 0x79, 0xAC, 0x00, 0x51,
-    0x66, 0xAC, 0x16, 0x70, 0xAC, 0x00, 0x12, 0x06, 0x00, 0x84, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00,
-    0x11, 0x12, 0x06, 0x00, 0x83, 0x64, 0x65, 0x72, 0x00, 0x52, 0x80, 0xAC, 0x18, 0x88, 0xAC, 0x00,
-    0x06, 0x00, 0x82, 0x69, 0x64, 0x65, 0x72, 0x00, 0x83, 0x64, 0x65, 0x72, 0x00, 0x49, 0x94, 0xAC,
-    0x17, 0x9A, 0xAC, 0x00, 0x04, 0x00, 0x82, 0x65, 0x72, 0x00, 0x08, 0x05, 0x00, 0x82, 0x65, 0x72,
-    0x00, 0x4C, 0xAB, 0xAC, 0x11, 0xB5, 0xAC, 0x16, 0xBE, 0xAC, 0x00, 0x16, 0x11, 0x12, 0x06, 0x00,
-    0x83, 0x64, 0x65, 0x72, 0x00, 0x2C, 0x00, 0x84, 0x75, 0x6E, 0x64, 0x65, 0x72, 0x00, 0x11, 0x12,
-    0x06, 0x00, 0x83, 0x69, 0x64, 0x65, 0x72, 0x00, 0x48, 0xCF, 0xAC, 0x12, 0xD5, 0xAC, 0x00, 0x11,
-    0x00, 0x82, 0x65, 0x72, 0x00, 0x82, 0x65, 0x72, 0x00, 0x4C, 0xE0, 0xAC, 0x11, 0xEA, 0xAC, 0x00,
-    0x16, 0x11, 0x12, 0x06, 0x00, 0x83, 0x64, 0x65, 0x72, 0x00, 0x18, 0x00, 0x83, 0x64, 0x65, 0x72,
-    0x00, 0x4C, 0xFE, 0xAC, 0x11, 0x08, 0xAD, 0x15, 0x0F, 0xAD, 0x19, 0x14, 0xAD, 0x00, 0x16, 0x11,
-    0x12, 0x06, 0x00, 0x82, 0x64, 0x65, 0x72, 0x00, 0x18, 0x00, 0x82, 0x64, 0x65, 0x72, 0x00, 0x0B,
-    0x17, 0x00, 0x80, 0x00, 0x12, 0x00, 0x81, 0x72, 0x00, 0x47, 0x29, 0xAD, 0x08, 0x3F, 0xAD, 0x0C,
-    0x46, 0xAD, 0x17, 0x50, 0xAD, 0x19, 0x58, 0xAD, 0x00, 0x4C, 0x30, 0xAD, 0x11, 0x39, 0xAD, 0x00,
-    0x16, 0x11, 0x12, 0x06, 0x00, 0x82, 0x65, 0x72, 0x00, 0x18, 0x00, 0x82, 0x65, 0x72, 0x00, 0x11,
-    0x00, 0x82, 0x76, 0x65, 0x72, 0x00, 0x16, 0x11, 0x12, 0x06, 0x00, 0x82, 0x64, 0x65, 0x72, 0x00,
-    0x04, 0x00, 0x83, 0x66, 0x74, 0x65, 0x72, 0x00, 0x48, 0x5F, 0xAD, 0x12, 0x65, 0xAD, 0x00, 0x11,
-    0x00, 0x82, 0x65, 0x72, 0x00, 0x82, 0x65, 0x72, 0x00, 0x49, 0x76, 0xAD, 0x0B, 0x7D, 0xAD, 0x17,
-    0x84, 0xAD, 0x19, 0xAA, 0xAD, 0x00, 0x04, 0x00, 0x82, 0x74, 0x65, 0x72, 0x00, 0x17, 0x12, 0x00,
-    0x82, 0x65, 0x72, 0x00, 0x48, 0x91, 0xAD, 0x09, 0x98, 0xAD, 0x12, 0x9E, 0xAD, 0x17, 0xA3, 0xAD,
-    0x00, 0x05, 0x00, 0x82, 0x74, 0x65, 0x72, 0x00, 0x04, 0x00, 0x82, 0x65, 0x72, 0x00, 0x82, 0x68,
-    0x65, 0x72, 0x00, 0x08, 0x05, 0x00, 0x82, 0x65, 0x72, 0x00, 0x48, 0xB1, 0xAD, 0x12, 0xB7, 0xAD,
-    0x00, 0x11, 0x00, 0x82, 0x65, 0x72, 0x00, 0x82, 0x65, 0x72, 0x00, 0x45, 0xD4, 0xAD, 0x0A, 0xDC,
-    0xAD, 0x0D, 0xF2, 0xAD, 0x11, 0xFA, 0xAD, 0x12, 0x02, 0xAE, 0x15, 0x0D, 0xAE, 0x17, 0x21, 0xAE,
-    0x1C, 0x2F, 0xAF, 0x00, 0x17, 0x12, 0x00, 0x83, 0x68, 0x65, 0x72, 0x00, 0x52, 0xE3, 0xAD, 0x17,
-    0xEB, 0xAD, 0x00, 0x2C, 0x00, 0x83, 0x74, 0x68, 0x65, 0x72, 0x00, 0x12, 0x00, 0x83, 0x68, 0x65,
-    0x72, 0x00, 0x17, 0x12, 0x00, 0x83, 0x68, 0x65, 0x72, 0x00, 0x17, 0x12, 0x00, 0x83, 0x68, 0x65,
-    0x72, 0x00, 0x17, 0x11, 0x04, 0x00, 0x84, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x00, 0x52, 0x14, 0xAE,
-    0x17, 0x1A, 0xAE, 0x00, 0x83, 0x74, 0x68, 0x65, 0x72, 0x00, 0x12, 0x00, 0x83, 0x68, 0x65, 0x72,
-    0x00, 0x4A, 0x34, 0xAE, 0x0C, 0x3C, 0xAE, 0x11, 0x45, 0xAE, 0x12, 0x50, 0xAE, 0x13, 0x20, 0xAF,
-    0x1C, 0x27, 0xAF, 0x00, 0x12, 0x00, 0x84, 0x74, 0x68, 0x65, 0x72, 0x00, 0x12, 0x2C, 0x00, 0x84,
-    0x74, 0x68, 0x65, 0x72, 0x00, 0x12, 0x04, 0x00, 0x85, 0x6E, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x00,
-    0x44, 0x69, 0xAE, 0x05, 0x71, 0xAE, 0x0B, 0x7B, 0xAE, 0x0D, 0x93, 0xAE, 0x0F, 0xAB, 0xAE, 0x10,
-    0xB4, 0xAE, 0x11, 0xBE, 0xAE, 0x13, 0x16, 0xAF, 0x00, 0x84, 0x6E, 0x6F, 0x74, 0x68, 0x65, 0x72,
-    0x00, 0x04, 0x00, 0x85, 0x6E, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x00, 0x44, 0x82, 0xAE, 0x11, 0x8A,
-    0xAE, 0x00, 0x85, 0x6E, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x00, 0x04, 0x00, 0x85, 0x6F, 0x74, 0x68,
-    0x65, 0x72, 0x00, 0x44, 0x9A, 0xAE, 0x11, 0xA2, 0xAE, 0x00, 0x85, 0x6E, 0x6F, 0x74, 0x68, 0x65,
-    0x72, 0x00, 0x04, 0x00, 0x85, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x00, 0x2C, 0x00, 0x85, 0x6F, 0x74,
-    0x68, 0x65, 0x72, 0x00, 0x11, 0x04, 0x00, 0x85, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x00, 0x4B, 0xD4,
-    0xAE, 0x0D, 0xDE, 0xAE, 0x10, 0xE8, 0xAE, 0x14, 0xF2, 0xAE, 0x16, 0xFB, 0xAE, 0x1A, 0x04, 0xAF,
-    0x1D, 0x0D, 0xAF, 0x00, 0x04, 0x00, 0x86, 0x6E, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x00, 0x04, 0x00,
-    0x86, 0x6E, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x00, 0x04, 0x00, 0x86, 0x6E, 0x6F, 0x74, 0x68, 0x65,
-    0x72, 0x00, 0x86, 0x61, 0x6E, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x00, 0x86, 0x61, 0x6E, 0x6F, 0x74,
-    0x68, 0x65, 0x72, 0x00, 0x86, 0x61, 0x6E, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x00, 0x86, 0x61, 0x6E,
-    0x6F, 0x74, 0x68, 0x65, 0x72, 0x00, 0x11, 0x04, 0x00, 0x85, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x00,
-    0x84, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x00, 0x12, 0x00, 0x84, 0x74, 0x68, 0x65, 0x72, 0x00, 0x52,
-    0x36, 0xAF, 0x17, 0x3C, 0xAF, 0x00, 0x83, 0x74, 0x68, 0x65, 0x72, 0x00, 0x12, 0x00, 0x83, 0x68,
-    0x65, 0x72, 0x00, 0x47, 0x4A, 0xAF, 0x16, 0x55, 0xAF, 0x00, 0x16, 0x11, 0x12, 0x06, 0x00, 0x83,
-    0x69, 0x64, 0x65, 0x72, 0x00, 0x11, 0x12, 0x06, 0x00, 0x81, 0x64, 0x65, 0x72, 0x00, 0x4B, 0x65,
-    0xAF, 0x17, 0x6C, 0xAF, 0x00, 0x17, 0x12, 0x00, 0x82, 0x65, 0x72, 0x00, 0x12, 0x00, 0x82, 0x68,
-    0x65, 0x72, 0x00, 0x04, 0x16, 0x2C, 0x00, 0x80, 0x00, 0x47, 0x83, 0xAF, 0x0B, 0x8B, 0xAF, 0x17,
-    0x92, 0xAF, 0x00, 0x18, 0x00, 0x83, 0x6E, 0x64, 0x65, 0x72, 0x00, 0x17, 0x12, 0x00, 0x82, 0x65,
-    0x72, 0x00, 0x12, 0x00, 0x82, 0x68, 0x65, 0x72, 0x00, 0x48, 0xAC, 0xAF, 0x09, 0xB1, 0xAF, 0x0B,
-    0xB8, 0xAF, 0x12, 0xBD, 0xAF, 0x17, 0xC2, 0xAF, 0x19, 0xCA, 0xAF, 0x00, 0x1A, 0x2C, 0x00, 0x80,
-    0x00, 0x04, 0x00, 0x82, 0x74, 0x65, 0x72, 0x00, 0x17, 0x00, 0x80, 0x65, 0x00, 0x10, 0x2C, 0x00,
-    0x80, 0x00, 0x08, 0x05, 0x00, 0x82, 0x74, 0x65, 0x72, 0x00, 0x12, 0x00, 0x82, 0x65, 0x72, 0x00,
-    0x47, 0xDD, 0xAF, 0x08, 0xF3, 0xAF, 0x0C, 0xF8, 0xAF, 0x12, 0x02, 0xB0, 0x00, 0x4C, 0xE4, 0xAF,
-    0x11, 0xED, 0xAF, 0x00, 0x16, 0x11, 0x12, 0x06, 0x00, 0x82, 0x65, 0x72, 0x00, 0x18, 0x00, 0x82,
-    0x65, 0x72, 0x00, 0x0B, 0x17, 0x00, 0x80, 0x00, 0x16, 0x11, 0x12, 0x06, 0x00, 0x82, 0x64, 0x65,
-    0x72, 0x00, 0x0B, 0x17, 0x00, 0x80, 0x00, 0x44, 0x29, 0xB0, 0x06, 0x32, 0xB0, 0x07, 0x48, 0xB0,
-    0x08, 0x50, 0xB0, 0x09, 0x65, 0xB0, 0x0A, 0xE7, 0xB0, 0x0B, 0x11, 0xB1, 0x15, 0x19, 0xB1, 0x17,
-    0x2F, 0xB1, 0x19, 0x9D, 0xB1, 0x1C, 0xB1, 0xB1, 0x00, 0x09, 0x00, 0x84, 0x61, 0x66, 0x74, 0x65,
-    0x72, 0x00, 0x44, 0x39, 0xB0, 0x09, 0x41, 0xB0, 0x00, 0x2C, 0x00, 0x83, 0x66, 0x74, 0x65, 0x72,
-    0x00, 0x04, 0x00, 0x83, 0x74, 0x65, 0x72, 0x00, 0x09, 0x04, 0x00, 0x83, 0x74, 0x65, 0x72, 0x00,
-    0x45, 0x57, 0xB0, 0x17, 0x5C, 0xB0, 0x00, 0x81, 0x74, 0x65, 0x72, 0x00, 0x05, 0x00, 0x84, 0x65,
-    0x74, 0x74, 0x65, 0x72, 0x00, 0x44, 0x84, 0xB0, 0x06, 0xA3, 0xB0, 0x07, 0xAB, 0xB0, 0x0A, 0xB3,
-    0xB0, 0x14, 0xBB, 0xB0, 0x15, 0xC2, 0xB0, 0x16, 0xCA, 0xB0, 0x19, 0xD1, 0xB0, 0x1A, 0xD9, 0xB0,
-    0x1D, 0xE0, 0xB0, 0x00, 0x54, 0x8E, 0xB0, 0x16, 0x95, 0xB0, 0x1D, 0x9C, 0xB0, 0x00, 0x85, 0x61,
-    0x66, 0x74, 0x65, 0x72, 0x00, 0x85, 0x61, 0x66, 0x74, 0x65, 0x72, 0x00, 0x85, 0x61, 0x66, 0x74,
-    0x65, 0x72, 0x00, 0x04, 0x00, 0x84, 0x66, 0x74, 0x65, 0x72, 0x00, 0x04, 0x00, 0x84, 0x66, 0x74,
-    0x65, 0x72, 0x00, 0x04, 0x00, 0x84, 0x66, 0x74, 0x65, 0x72, 0x00, 0x84, 0x61, 0x66, 0x74, 0x65,
-    0x72, 0x00, 0x04, 0x00, 0x84, 0x66, 0x74, 0x65, 0x72, 0x00, 0x84, 0x61, 0x66, 0x74, 0x65, 0x72,
-    0x00, 0x04, 0x00, 0x84, 0x66, 0x74, 0x65, 0x72, 0x00, 0x84, 0x61, 0x66, 0x74, 0x65, 0x72, 0x00,
-    0x84, 0x61, 0x66, 0x74, 0x65, 0x72, 0x00, 0x44, 0xF4, 0xB0, 0x08, 0xFA, 0xB0, 0x09, 0x02, 0xB1,
-    0x17, 0x09, 0xB1, 0x00, 0x83, 0x66, 0x74, 0x65, 0x72, 0x00, 0x05, 0x00, 0x83, 0x74, 0x74, 0x65,
-    0x72, 0x00, 0x04, 0x00, 0x83, 0x74, 0x65, 0x72, 0x00, 0x08, 0x05, 0x00, 0x83, 0x74, 0x65, 0x72,
-    0x00, 0x12, 0x00, 0x83, 0x74, 0x68, 0x65, 0x72, 0x00, 0x49, 0x20, 0xB1, 0x17, 0x27, 0xB1, 0x00,
-    0x04, 0x00, 0x83, 0x74, 0x65, 0x72, 0x00, 0x08, 0x05, 0x00, 0x83, 0x74, 0x65, 0x72, 0x00, 0x45,
-    0x42, 0xB1, 0x07, 0x49, 0xB1, 0x0A, 0x5F, 0xB1, 0x15, 0x68, 0xB1, 0x1A, 0x7E, 0xB1, 0x1C, 0x94,
-    0xB1, 0x00, 0x83, 0x65, 0x74, 0x74, 0x65, 0x72, 0x00, 0x45, 0x50, 0xB1, 0x08, 0x57, 0xB1, 0x00,
-    0x84, 0x65, 0x74, 0x74, 0x65, 0x72, 0x00, 0x05, 0x00, 0x84, 0x74, 0x74, 0x65, 0x72, 0x00, 0x08,
-    0x05, 0x00, 0x84, 0x74, 0x74, 0x65, 0x72, 0x00, 0x45, 0x6F, 0xB1, 0x08, 0x76, 0xB1, 0x00, 0x84,
-    0x65, 0x74, 0x74, 0x65, 0x72, 0x00, 0x05, 0x00, 0x84, 0x74, 0x74, 0x65, 0x72, 0x00, 0x45, 0x85,
-    0xB1, 0x08, 0x8C, 0xB1, 0x00, 0x84, 0x65, 0x74, 0x74, 0x65, 0x72, 0x00, 0x05, 0x00, 0x84, 0x74,
-    0x74, 0x65, 0x72, 0x00, 0x08, 0x05, 0x00, 0x84, 0x74, 0x74, 0x65, 0x72, 0x00, 0x44, 0xA4, 0xB1,
-    0x09, 0xAA, 0xB1, 0x00, 0x83, 0x66, 0x74, 0x65, 0x72, 0x00, 0x04, 0x00, 0x83, 0x74, 0x65, 0x72,
-    0x00, 0x48, 0xBB, 0xB1, 0x09, 0xC3, 0xB1, 0x17, 0xCA, 0xB1, 0x00, 0x05, 0x00, 0x83, 0x74, 0x74,
-    0x65, 0x72, 0x00, 0x04, 0x00, 0x83, 0x74, 0x65, 0x72, 0x00, 0x08, 0x05, 0x00, 0x83, 0x74, 0x65,
-    0x72, 0x00, 0x12, 0x1C, 0x00, 0x81, 0x72, 0x00, 0x45, 0xFA, 0xB1, 0x06, 0x02, 0xB2, 0x07, 0x15,
-    0xB2, 0x08, 0x29, 0xB2, 0x09, 0x8F, 0xB2, 0x0A, 0xA2, 0xB2, 0x0C, 0xB5, 0xB2, 0x0F, 0xBC, 0xB2,
-    0x13, 0xC4, 0xB2, 0x15, 0xCB, 0xB2, 0x1A, 0xD3, 0xB2, 0x00, 0x08, 0x11, 0x00, 0x83, 0x76, 0x65,
-    0x72, 0x00, 0x48, 0x09, 0xB2, 0x12, 0x10, 0xB2, 0x00, 0x11, 0x00, 0x83, 0x76, 0x65, 0x72, 0x00,
-    0x83, 0x76, 0x65, 0x72, 0x00, 0x48, 0x1C, 0xB2, 0x11, 0x23, 0xB2, 0x00, 0x11, 0x00, 0x83, 0x76,
-    0x65, 0x72, 0x00, 0x83, 0x65, 0x76, 0x65, 0x72, 0x00, 0x47, 0x3C, 0xB2, 0x0B, 0x45, 0xB2, 0x0D,
-    0x4E, 0xB2, 0x10, 0x55, 0xB2, 0x11, 0x5E, 0xB2, 0x1A, 0x87, 0xB2, 0x00, 0x11, 0x2C, 0x00, 0x84,
-    0x65, 0x76, 0x65, 0x72, 0x00, 0x2C, 0x00, 0x84, 0x6E, 0x65, 0x76, 0x65, 0x72, 0x00, 0x84, 0x6E,
-    0x65, 0x76, 0x65, 0x72, 0x00, 0x2C, 0x00, 0x84, 0x6E, 0x65, 0x76, 0x65, 0x72, 0x00, 0x45, 0x6B,
-    0xB2, 0x0B, 0x72, 0xB2, 0x0D, 0x79, 0xB2, 0x10, 0x80, 0xB2, 0x00, 0x85, 0x6E, 0x65, 0x76, 0x65,
-    0x72, 0x00, 0x85, 0x6E, 0x65, 0x76, 0x65, 0x72, 0x00, 0x85, 0x6E, 0x65, 0x76, 0x65, 0x72, 0x00,
-    0x85, 0x6E, 0x65, 0x76, 0x65, 0x72, 0x00, 0x11, 0x00, 0x84, 0x65, 0x76, 0x65, 0x72, 0x00, 0x48,
-    0x96, 0xB2, 0x12, 0x9D, 0xB2, 0x00, 0x11, 0x00, 0x83, 0x76, 0x65, 0x72, 0x00, 0x83, 0x76, 0x65,
-    0x72, 0x00, 0x48, 0xA9, 0xB2, 0x12, 0xB0, 0xB2, 0x00, 0x11, 0x00, 0x83, 0x76, 0x65, 0x72, 0x00,
-    0x83, 0x76, 0x65, 0x72, 0x00, 0x12, 0x00, 0x83, 0x76, 0x65, 0x72, 0x00, 0x12, 0x2C, 0x00, 0x83,
-    0x76, 0x65, 0x72, 0x00, 0x12, 0x00, 0x83, 0x76, 0x65, 0x72, 0x00, 0x11, 0x00, 0x83, 0x65, 0x76,
-    0x65, 0x72, 0x00, 0x48, 0xDA, 0xB2, 0x11, 0xE1, 0xB2, 0x00, 0x11, 0x00, 0x83, 0x76, 0x65, 0x72,
-    0x00, 0x83, 0x65, 0x76, 0x65, 0x72, 0x00, 0x47, 0xF4, 0xB2, 0x0B, 0x0A, 0xB3, 0x17, 0x11, 0xB3,
-    0x19, 0x25, 0xB3, 0x00, 0x4C, 0xFB, 0xB2, 0x11, 0x04, 0xB3, 0x00, 0x16, 0x11, 0x12, 0x06, 0x00,
-    0x82, 0x65, 0x72, 0x00, 0x18, 0x00, 0x82, 0x65, 0x72, 0x00, 0x17, 0x12, 0x00, 0x82, 0x65, 0x72,
-    0x00, 0x49, 0x18, 0xB3, 0x17, 0x1E, 0xB3, 0x00, 0x04, 0x00, 0x82, 0x65, 0x72, 0x00, 0x08, 0x05,
-    0x00, 0x82, 0x65, 0x72, 0x00, 0x48, 0x2C, 0xB3, 0x12, 0x32, 0xB3, 0x00, 0x11, 0x00, 0x82, 0x65,
-    0x72, 0x00, 0x82, 0x65, 0x72, 0x00, 0x47, 0x40, 0xB3, 0x0C, 0x56, 0xB3, 0x11, 0x60, 0xB3, 0x00,
-    0x4C, 0x47, 0xB3, 0x11, 0x50, 0xB3, 0x00, 0x16, 0x11, 0x12, 0x06, 0x00, 0x82, 0x65, 0x72, 0x00,
-    0x18, 0x00, 0x82, 0x65, 0x72, 0x00, 0x16, 0x11, 0x12, 0x06, 0x00, 0x82, 0x64, 0x65, 0x72, 0x00,
-    0x18, 0x00, 0x82, 0x64, 0x65, 0x72, 0x00, 0x49, 0x71, 0xB3, 0x0B, 0x78, 0xB3, 0x17, 0x7F, 0xB3,
-    0x00, 0x04, 0x00, 0x82, 0x74, 0x65, 0x72, 0x00, 0x17, 0x12, 0x00, 0x82, 0x65, 0x72, 0x00, 0x48,
-    0x8C, 0xB3, 0x09, 0x93, 0xB3, 0x12, 0x99, 0xB3, 0x17, 0x9E, 0xB3, 0x00, 0x05, 0x00, 0x82, 0x74,
-    0x65, 0x72, 0x00, 0x04, 0x00, 0x82, 0x65, 0x72, 0x00, 0x82, 0x68, 0x65, 0x72, 0x00, 0x08, 0x05,
-    0x00, 0x82, 0x65, 0x72, 0x00, 0x44, 0xAF, 0xB3, 0x08, 0xB5, 0xB3, 0x18, 0xBB, 0xB3, 0x00, 0x08,
-    0x1C, 0x00, 0x81, 0x72, 0x00, 0x19, 0x12, 0x00, 0x81, 0x72, 0x00, 0x12, 0x1C, 0x00, 0x81, 0x72,
-    0x00, 0x48, 0xCB, 0xB3, 0x0A, 0xD3, 0xB3, 0x17, 0xD9, 0xB3, 0x00, 0x17, 0x12, 0x00, 0x82, 0x68,
-    0x65, 0x72, 0x00, 0x0C, 0x15, 0x00, 0x80, 0x74, 0x00, 0x12, 0x11, 0x04, 0x00, 0x80, 0x65, 0x72,
-    0x00, 0x47, 0xFA, 0xB3, 0x08, 0x0F, 0xB4, 0x0B, 0x15, 0xB5, 0x0E, 0x1E, 0xB5, 0x12, 0x26, 0xB5,
-    0x15, 0x2E, 0xB5, 0x18, 0x36, 0xB5, 0x1A, 0x49, 0xB5, 0x00, 0x48, 0x01, 0xB4, 0x0B, 0x08, 0xB4,
-    0x00, 0x0B, 0x17, 0x00, 0x82, 0x69, 0x72, 0x00, 0x17, 0x00, 0x82, 0x65, 0x69, 0x72, 0x00, 0x45,
-    0x2E, 0xB4, 0x07, 0x42, 0xB4, 0x0A, 0x4A, 0xB4, 0x0B, 0x5E, 0xB4, 0x0D, 0xC0, 0xB4, 0x11, 0xD4,
-    0xB4, 0x15, 0xE8, 0xB4, 0x17, 0xF0, 0xB4, 0x1A, 0xF9, 0xB4, 0x1C, 0x01, 0xB5, 0x00, 0x4B, 0x35,
-    0xB4, 0x17, 0x3C, 0xB4, 0x00, 0x17, 0x00, 0x83, 0x65, 0x69, 0x72, 0x00, 0x83, 0x68, 0x65, 0x69,
-    0x72, 0x00, 0x0B, 0x17, 0x00, 0x83, 0x65, 0x69, 0x72, 0x00, 0x4B, 0x51, 0xB4, 0x17, 0x58, 0xB4,
-    0x00, 0x17, 0x00, 0x83, 0x65, 0x69, 0x72, 0x00, 0x83, 0x68, 0x65, 0x69, 0x72, 0x00, 0x45, 0x74,
-    0xB4, 0x0A, 0x7C, 0xB4, 0x0D, 0x83, 0xB4, 0x11, 0x8B, 0xB4, 0x15, 0x93, 0xB4, 0x17, 0x9A, 0xB4,
-    0x1C, 0xB9, 0xB4, 0x00, 0x17, 0x00, 0x84, 0x68, 0x65, 0x69, 0x72, 0x00, 0x84, 0x74, 0x68, 0x65,
-    0x69, 0x72, 0x00, 0x17, 0x00, 0x84, 0x68, 0x65, 0x69, 0x72, 0x00, 0x17, 0x00, 0x84, 0x68, 0x65,
-    0x69, 0x72, 0x00, 0x84, 0x74, 0x68, 0x65, 0x69, 0x72, 0x00, 0x4A, 0xA4, 0xB4, 0x15, 0xAB, 0xB4,
-    0x1C, 0xB2, 0xB4, 0x00, 0x85, 0x74, 0x68, 0x65, 0x69, 0x72, 0x00, 0x85, 0x74, 0x68, 0x65, 0x69,
-    0x72, 0x00, 0x85, 0x74, 0x68, 0x65, 0x69, 0x72, 0x00, 0x84, 0x74, 0x68, 0x65, 0x69, 0x72, 0x00,
-    0x4B, 0xC7, 0xB4, 0x17, 0xCE, 0xB4, 0x00, 0x17, 0x00, 0x83, 0x65, 0x69, 0x72, 0x00, 0x83, 0x68,
-    0x65, 0x69, 0x72, 0x00, 0x4B, 0xDB, 0xB4, 0x17, 0xE2, 0xB4, 0x00, 0x17, 0x00, 0x83, 0x65, 0x69,
-    0x72, 0x00, 0x83, 0x68, 0x65, 0x69, 0x72, 0x00, 0x0B, 0x17, 0x00, 0x83, 0x65, 0x69, 0x72, 0x00,
-    0x0B, 0x00, 0x84, 0x74, 0x68, 0x65, 0x69, 0x72, 0x00, 0x0B, 0x17, 0x00, 0x83, 0x65, 0x69, 0x72,
-    0x00, 0x4B, 0x08, 0xB5, 0x17, 0x0F, 0xB5, 0x00, 0x17, 0x00, 0x83, 0x65, 0x69, 0x72, 0x00, 0x83,
-    0x68, 0x65, 0x69, 0x72, 0x00, 0x08, 0x17, 0x00, 0x83, 0x68, 0x65, 0x69, 0x72, 0x00, 0x08, 0x0B,
-    0x17, 0x00, 0x82, 0x69, 0x72, 0x00, 0x08, 0x0B, 0x17, 0x00, 0x82, 0x69, 0x72, 0x00, 0x0B, 0x17,
-    0x00, 0x82, 0x65, 0x69, 0x72, 0x00, 0x48, 0x3D, 0xB5, 0x12, 0x44, 0xB5, 0x00, 0x0B, 0x17, 0x00,
-    0x82, 0x69, 0x72, 0x00, 0x1C, 0x00, 0x81, 0x72, 0x00, 0x48, 0x50, 0xB5, 0x0B, 0x57, 0xB5, 0x00,
-    0x0B, 0x17, 0x00, 0x82, 0x69, 0x72, 0x00, 0x17, 0x00, 0x82, 0x65, 0x69, 0x72, 0x00, 0x18, 0x12,
-    0x1C, 0x00, 0x81, 0x72, 0x00, 0x48, 0x6C, 0xB5, 0x0C, 0x73, 0xB5, 0x00, 0x0B, 0x17, 0x00, 0x81,
-    0x69, 0x72, 0x00, 0x08, 0x0B, 0x17, 0x00, 0x81, 0x72, 0x00, 0x0C, 0x0B, 0x1A, 0x00, 0x80, 0x65,
-    0x00, 0x0C, 0x08, 0x0B, 0x17, 0x00, 0x81, 0x72, 0x00, 0x04, 0x08, 0x1C, 0x00, 0x81, 0x72, 0x00,
-    0x47, 0xA0, 0xB5, 0x08, 0xA7, 0xB5, 0x0B, 0xAD, 0xB5, 0x17, 0xB4, 0xB5, 0x19, 0xBB, 0xB5, 0x00,
-    0x11, 0x18, 0x00, 0x81, 0x65, 0x72, 0x00, 0x19, 0x08, 0x11, 0x00, 0x80, 0x00, 0x17, 0x12, 0x00,
-    0x81, 0x65, 0x72, 0x00, 0x09, 0x04, 0x00, 0x81, 0x65, 0x72, 0x00, 0x08, 0x11, 0x00, 0x81, 0x65,
-    0x72, 0x00, 0x48, 0xCC, 0xB5, 0x12, 0xD2, 0xB5, 0x15, 0xD8, 0xB5, 0x00, 0x0B, 0x17, 0x00, 0x80,
-    0x65, 0x00, 0x0B, 0x17, 0x00, 0x80, 0x65, 0x00, 0x0C, 0x09, 0x00, 0x80, 0x74, 0x00, 0x74, 0xF7,
-    0xB5, 0x04, 0x08, 0xB6, 0x08, 0x21, 0xB6, 0x0C, 0x3F, 0xB6, 0x11, 0x44, 0xB6, 0x16, 0x49, 0xB6,
-    0x17, 0x4E, 0xB6, 0x18, 0x55, 0xB6, 0x00, 0x11, 0x00, 0x44, 0x00, 0xB6, 0x12, 0x04, 0xB6, 0x00,
-    0x06, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x48, 0x0F, 0xB6, 0x0B, 0x1D, 0xB6, 0x00, 0x55,
-    0x16, 0xB6, 0x1C, 0x1A, 0xB6, 0x00, 0x0A, 0x00, 0x80, 0x00, 0x81, 0x72, 0x00, 0x17, 0x00, 0x80,
-    0x00, 0x49, 0x2B, 0xB6, 0x17, 0x32, 0xB6, 0x19, 0x3A, 0xB6, 0x00, 0x04, 0x00, 0x82, 0x74, 0x65,
-    0x72, 0x00, 0x08, 0x05, 0x00, 0x82, 0x74, 0x65, 0x72, 0x00, 0x12, 0x00, 0x81, 0x72, 0x00, 0x0B,
-    0x16, 0x00, 0x80, 0x00, 0x18, 0x06, 0x00, 0x80, 0x00, 0x18, 0x0D, 0x00, 0x80, 0x00, 0x08, 0x05,
-    0x00, 0x80, 0x65, 0x72, 0x00, 0x12, 0x00, 0x45, 0x5E, 0xB6, 0x1C, 0x62, 0xB6, 0x00, 0x04, 0x00,
-    0x80, 0x00, 0x81, 0x72, 0x00, 0x4C, 0x78, 0xB6, 0x0D, 0x8B, 0xB6, 0x0F, 0x92, 0xB6, 0x12, 0x99,
-    0xB6, 0x13, 0xEB, 0xB6, 0x1C, 0xF2, 0xB6, 0x00, 0x48, 0x7F, 0xB6, 0x12, 0x85, 0xB6, 0x00, 0x0B,
-    0x17, 0x00, 0x81, 0x72, 0x00, 0x1C, 0x00, 0x82, 0x75, 0x72, 0x00, 0x12, 0x1C, 0x00, 0x82, 0x75,
-    0x72, 0x00, 0x12, 0x1C, 0x00, 0x82, 0x75, 0x72, 0x00, 0x45, 0xB2, 0xB6, 0x0B, 0xB8, 0xB6, 0x0C,
-    0xBF, 0xB6, 0x0F, 0xC6, 0xB6, 0x13, 0xCD, 0xB6, 0x17, 0xD4, 0xB6, 0x18, 0xDC, 0xB6, 0x1C, 0xE3,
-    0xB6, 0x00, 0x04, 0x2C, 0x00, 0x80, 0x74, 0x00, 0x1C, 0x00, 0x83, 0x6F, 0x75, 0x72, 0x00, 0x1C,
-    0x00, 0x83, 0x6F, 0x75, 0x72, 0x00, 0x1C, 0x00, 0x83, 0x6F, 0x75, 0x72, 0x00, 0x1C, 0x00, 0x83,
-    0x6F, 0x75, 0x72, 0x00, 0x1C, 0x2C, 0x00, 0x83, 0x6F, 0x75, 0x72, 0x00, 0x1C, 0x00, 0x83, 0x6F,
-    0x75, 0x72, 0x00, 0x18, 0x00, 0x84, 0x79, 0x6F, 0x75, 0x72, 0x00, 0x12, 0x1C, 0x00, 0x82, 0x75,
-    0x72, 0x00, 0x12, 0x1C, 0x00, 0x82, 0x75, 0x72, 0x00, 0x08, 0x08, 0x11, 0x00, 0x82, 0x76, 0x65,
-    0x72, 0x00, 0x44, 0x15, 0xB7, 0x07, 0x1B, 0xB7, 0x08, 0x31, 0xB7, 0x0B, 0x5F, 0xB7, 0x17, 0x66,
-    0xB7, 0x19, 0x7A, 0xB7, 0x00, 0x08, 0x1C, 0x00, 0x81, 0x72, 0x00, 0x4C, 0x22, 0xB7, 0x11, 0x2B,
-    0xB7, 0x00, 0x16, 0x11, 0x12, 0x06, 0x00, 0x81, 0x65, 0x72, 0x00, 0x18, 0x00, 0x81, 0x65, 0x72,
-    0x00, 0x47, 0x3E, 0xB7, 0x0B, 0x44, 0xB7, 0x17, 0x4A, 0xB7, 0x19, 0x50, 0xB7, 0x00, 0x11, 0x18,
-    0x00, 0x81, 0x72, 0x00, 0x17, 0x12, 0x00, 0x81, 0x72, 0x00, 0x09, 0x04, 0x00, 0x81, 0x72, 0x00,
-    0x48, 0x57, 0xB7, 0x12, 0x5C, 0xB7, 0x00, 0x11, 0x00, 0x81, 0x72, 0x00, 0x81, 0x72, 0x00, 0x17,
-    0x12, 0x00, 0x81, 0x65, 0x72, 0x00, 0x49, 0x6D, 0xB7, 0x17, 0x73, 0xB7, 0x00, 0x04, 0x00, 0x81,
-    0x65, 0x72, 0x00, 0x08, 0x05, 0x00, 0x81, 0x65, 0x72, 0x00, 0x08, 0x11, 0x00, 0x81, 0x65, 0x72,
-    0x00, 0x48, 0x88, 0xB7, 0x18, 0x8F, 0xB7, 0x00, 0x19, 0x08, 0x00, 0x81, 0x72, 0x79, 0x00, 0x12,
-    0x1C, 0x00, 0x81, 0x72, 0x00, 0x04, 0x08, 0x1C, 0x00, 0x81, 0x72, 0x00, 0x74, 0xDC, 0xB7, 0x04,
-    0x31, 0xB9, 0x05, 0x71, 0xB9, 0x07, 0x88, 0xB9, 0x08, 0xF7, 0xB9, 0x09, 0x44, 0xC0, 0x0A, 0x65,
-    0xC0, 0x0B, 0x3E, 0xC2, 0x0C, 0x6B, 0xC2, 0x0E, 0xB3, 0xC6, 0x0F, 0xCA, 0xC6, 0x11, 0xE6, 0xC6,
-    0x12, 0x11, 0xC7, 0x15, 0x1C, 0xC7, 0x16, 0xC7, 0xC7, 0x17, 0xD1, 0xC7, 0x18, 0x20, 0xC8, 0x19,
-    0x4E, 0xC8, 0x1A, 0x65, 0xC8, 0x1B, 0x98, 0xC8, 0x1C, 0xB4, 0xC8, 0x00, 0x44, 0xEC, 0xB7, 0x0A,
-    0x03, 0xB8, 0x15, 0x18, 0xB8, 0x17, 0x2D, 0xB8, 0x1C, 0x1C, 0xB9, 0x00, 0x4B, 0xF3, 0xB7, 0x17,
-    0xFA, 0xB7, 0x00, 0x17, 0x00, 0x81, 0x74, 0x27, 0x73, 0x00, 0x0B, 0x17, 0x00, 0x83, 0x61, 0x74,
-    0x27, 0x73, 0x00, 0x44, 0x0A, 0xB8, 0x17, 0x12, 0xB8, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x74, 0x27,
-    0x73, 0x00, 0x0C, 0x00, 0x82, 0x27, 0x73, 0x00, 0x44, 0x1F, 0xB8, 0x17, 0x27, 0xB8, 0x00, 0x0B,
-    0x17, 0x00, 0x82, 0x74, 0x27, 0x73, 0x00, 0x0C, 0x00, 0x82, 0x27, 0x73, 0x00, 0x44, 0x55, 0xB8,
-    0x0A, 0x9C, 0xB8, 0x0B, 0xA3, 0xB8, 0x0C, 0xB9, 0xB8, 0x0E, 0xD5, 0xB8, 0x12, 0xDC, 0xB8, 0x14,
-    0xE3, 0xB8, 0x15, 0xEC, 0xB8, 0x16, 0xF3, 0xB8, 0x18, 0xFC, 0xB8, 0x1A, 0x03, 0xB9, 0x1C, 0x0C,
-    0xB9, 0x1D, 0x13, 0xB9, 0x00, 0x45, 0x68, 0xB8, 0x0A, 0x71, 0xB8, 0x0D, 0x7A, 0xB8, 0x11, 0x83,
-    0xB8, 0x17, 0x8C, 0xB8, 0x1C, 0x93, 0xB8, 0x00, 0x17, 0x00, 0x84, 0x68, 0x61, 0x74, 0x27, 0x73,
-    0x00, 0x17, 0x00, 0x84, 0x68, 0x61, 0x74, 0x27, 0x73, 0x00, 0x17, 0x00, 0x84, 0x68, 0x61, 0x74,
-    0x27, 0x73, 0x00, 0x17, 0x00, 0x84, 0x68, 0x61, 0x74, 0x27, 0x73, 0x00, 0x83, 0x68, 0x61, 0x74,
-    0x27, 0x73, 0x00, 0x17, 0x00, 0x84, 0x68, 0x61, 0x74, 0x27, 0x73, 0x00, 0x0C, 0x00, 0x83, 0x74,
-    0x27, 0x73, 0x00, 0x44, 0xAA, 0xB8, 0x17, 0xB3, 0xB8, 0x00, 0x17, 0x00, 0x84, 0x68, 0x61, 0x74,
-    0x27, 0x73, 0x00, 0x82, 0x61, 0x74, 0x27, 0x73, 0x00, 0x4E, 0xC3, 0xB8, 0x12, 0xC9, 0xB8, 0x18,
-    0xCF, 0xB8, 0x00, 0x84, 0x69, 0x74, 0x27, 0x73, 0x00, 0x84, 0x69, 0x74, 0x27, 0x73, 0x00, 0x84,
-    0x69, 0x74, 0x27, 0x73, 0x00, 0x0C, 0x00, 0x83, 0x74, 0x27, 0x73, 0x00, 0x0C, 0x00, 0x83, 0x74,
-    0x27, 0x73, 0x00, 0x0B, 0x17, 0x00, 0x83, 0x61, 0x74, 0x27, 0x73, 0x00, 0x0C, 0x00, 0x83, 0x74,
-    0x27, 0x73, 0x00, 0x0B, 0x17, 0x00, 0x83, 0x61, 0x74, 0x27, 0x73, 0x00, 0x0C, 0x00, 0x83, 0x74,
-    0x27, 0x73, 0x00, 0x0B, 0x17, 0x00, 0x83, 0x61, 0x74, 0x27, 0x73, 0x00, 0x0C, 0x00, 0x83, 0x74,
-    0x27, 0x73, 0x00, 0x0B, 0x17, 0x00, 0x83, 0x61, 0x74, 0x27, 0x73, 0x00, 0x44, 0x23, 0xB9, 0x17,
-    0x2B, 0xB9, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x74, 0x27, 0x73, 0x00, 0x0C, 0x00, 0x82, 0x27, 0x73,
-    0x00, 0x74, 0x41, 0xB9, 0x08, 0x47, 0xB9, 0x15, 0x4D, 0xB9, 0x1A, 0x61, 0xB9, 0x1C, 0x68, 0xB9,
-    0x00, 0x17, 0x0C, 0x00, 0x81, 0x73, 0x00, 0x12, 0x07, 0x00, 0x81, 0x73, 0x00, 0x44, 0x54, 0xB9,
-    0x08, 0x5A, 0xB9, 0x00, 0x08, 0x1C, 0x00, 0x81, 0x73, 0x00, 0x1C, 0x00, 0x82, 0x61, 0x72, 0x73,
-    0x00, 0x0F, 0x04, 0x00, 0x80, 0x79, 0x73, 0x00, 0x1A, 0x0F, 0x04, 0x00, 0x82, 0x61, 0x79, 0x73,
-    0x00, 0x4A, 0x78, 0xB9, 0x11, 0x80, 0xB9, 0x00, 0x11, 0x0C, 0x0B, 0x17, 0x00, 0x81, 0x73, 0x00,
-    0x0C, 0x0B, 0x17, 0x00, 0x81, 0x67, 0x73, 0x00, 0x74, 0x9B, 0xB9, 0x08, 0xA1, 0xB9, 0x0C, 0xB1,
-    0xB9, 0x0F, 0xC1, 0xB9, 0x11, 0xD2, 0xB9, 0x15, 0xF0, 0xB9, 0x00, 0x17, 0x0C, 0x00, 0x81, 0x73,
-    0x00, 0x52, 0xA8, 0xB9, 0x16, 0xAD, 0xB9, 0x00, 0x07, 0x00, 0x81, 0x73, 0x00, 0x18, 0x00, 0x80,
-    0x00, 0x44, 0xB8, 0xB9, 0x0B, 0xBC, 0xB9, 0x00, 0x16, 0x00, 0x80, 0x00, 0x17, 0x00, 0x81, 0x73,
-    0x00, 0x55, 0xC8, 0xB9, 0x18, 0xCD, 0xB9, 0x00, 0x12, 0x1A, 0x00, 0x80, 0x00, 0x12, 0x06, 0x00,
-    0x80, 0x00, 0x4C, 0xDC, 0xB9, 0x12, 0xE0, 0xB9, 0x18, 0xEB, 0xB9, 0x00, 0x09, 0x00, 0x80, 0x00,
-    0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x81, 0x65, 0x73, 0x00, 0x12, 0x16, 0x00, 0x80, 0x00,
-    0x04, 0x08, 0x1C, 0x00, 0x81, 0x73, 0x00, 0x74, 0x1F, 0xBA, 0x04, 0x25, 0xBA, 0x05, 0x2C, 0xBA,
-    0x07, 0x4B, 0xBA, 0x08, 0x58, 0xBA, 0x0B, 0x6B, 0xBA, 0x0C, 0x8A, 0xBA, 0x0D, 0x91, 0xBA, 0x10,
-    0xB0, 0xBA, 0x11, 0xBD, 0xBA, 0x12, 0x72, 0xBF, 0x15, 0x12, 0xC0, 0x1A, 0x2B, 0xC0, 0x00, 0x17,
-    0x0C, 0x00, 0x81, 0x73, 0x00, 0x08, 0x1C, 0x00, 0x81, 0x72, 0x73, 0x00, 0x51, 0x33, 0xBA, 0x12,
-    0x3F, 0xBA, 0x00, 0x12, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x82, 0x65, 0x73, 0x00, 0x0B,
-    0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x82, 0x6E, 0x65, 0x73, 0x00, 0x11, 0x12, 0x0B, 0x13, 0x07,
-    0x04, 0x08, 0x0B, 0x00, 0x82, 0x65, 0x73, 0x00, 0x4B, 0x5F, 0xBA, 0x12, 0x66, 0xBA, 0x00, 0x17,
-    0x2C, 0x00, 0x81, 0x73, 0x65, 0x00, 0x07, 0x00, 0x81, 0x73, 0x00, 0x51, 0x72, 0xBA, 0x12, 0x7E,
-    0xBA, 0x00, 0x12, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x82, 0x65, 0x73, 0x00, 0x0B, 0x13,
-    0x07, 0x04, 0x08, 0x0B, 0x00, 0x82, 0x6E, 0x65, 0x73, 0x00, 0x12, 0x07, 0x00, 0x82, 0x65, 0x73,
-    0x00, 0x51, 0x98, 0xBA, 0x12, 0xA4, 0xBA, 0x00, 0x12, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00,
-    0x82, 0x65, 0x73, 0x00, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x82, 0x6E, 0x65, 0x73, 0x00,
-    0x12, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x82, 0x6E, 0x65, 0x73, 0x00, 0x45, 0xD3, 0xBA,
-    0x0B, 0xE0, 0xBA, 0x0C, 0x10, 0xBB, 0x0D, 0x2F, 0xBB, 0x0F, 0x3C, 0xBB, 0x12, 0x5B, 0xBB, 0x13,
-    0x53, 0xBF, 0x00, 0x12, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x83, 0x6E, 0x65, 0x73, 0x00,
-    0x52, 0xE7, 0xBA, 0x13, 0x05, 0xBB, 0x00, 0x4B, 0xEE, 0xBA, 0x13, 0xF9, 0xBA, 0x00, 0x13, 0x07,
-    0x04, 0x08, 0x0B, 0x00, 0x83, 0x6E, 0x65, 0x73, 0x00, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x84, 0x68,
-    0x6F, 0x6E, 0x65, 0x73, 0x00, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x82, 0x6F, 0x6E, 0x65, 0x73, 0x00,
-    0x4B, 0x17, 0xBB, 0x12, 0x23, 0xBB, 0x00, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x83, 0x6F, 0x6E,
-    0x65, 0x73, 0x00, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x83, 0x6E, 0x65, 0x73, 0x00, 0x12,
-    0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x83, 0x6E, 0x65, 0x73, 0x00, 0x4B, 0x43, 0xBB, 0x12,
-    0x4F, 0xBB, 0x00, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x83, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x0B,
-    0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x83, 0x6E, 0x65, 0x73, 0x00, 0x45, 0x77, 0xBB, 0x0A, 0x96,
-    0xBB, 0x0B, 0xB5, 0xBB, 0x0C, 0xAC, 0xBE, 0x0D, 0xB9, 0xBE, 0x0F, 0xD8, 0xBE, 0x11, 0xE5, 0xBE,
-    0x13, 0x04, 0xBF, 0x1C, 0x34, 0xBF, 0x00, 0x4B, 0x7E, 0xBB, 0x13, 0x8A, 0xBB, 0x00, 0x13, 0x07,
-    0x04, 0x08, 0x0B, 0x00, 0x84, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x84,
-    0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x4B, 0x9D, 0xBB, 0x13, 0xA9, 0xBB, 0x00, 0x13, 0x07, 0x04,
-    0x08, 0x0B, 0x00, 0x84, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x84, 0x68,
-    0x6F, 0x6E, 0x65, 0x73, 0x00, 0x45, 0xCB, 0xBB, 0x07, 0xD8, 0xBB, 0x0A, 0xF7, 0xBB, 0x0D, 0x04,
-    0xBC, 0x11, 0x11, 0xBC, 0x12, 0x1E, 0xBC, 0x13, 0x3D, 0xBC, 0x00, 0x13, 0x07, 0x04, 0x08, 0x0B,
-    0x00, 0x85, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x44, 0xDF, 0xBB, 0x13, 0xEA, 0xBB, 0x00, 0x08,
-    0x0B, 0x00, 0x84, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x04, 0x08, 0x0B, 0x00, 0x86, 0x64,
-    0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x85, 0x68, 0x6F,
-    0x6E, 0x65, 0x73, 0x00, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x85, 0x68, 0x6F, 0x6E, 0x65, 0x73,
-    0x00, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x85, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x47, 0x25,
-    0xBC, 0x13, 0x31, 0xBC, 0x00, 0x04, 0x08, 0x0B, 0x00, 0x85, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73,
-    0x00, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x85, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x44, 0x56, 0xBC,
-    0x06, 0x75, 0xBC, 0x07, 0x94, 0xBC, 0x08, 0x23, 0xBE, 0x09, 0x42, 0xBE, 0x12, 0x61, 0xBE, 0x16,
-    0x6E, 0xBE, 0x1B, 0x8D, 0xBE, 0x00, 0x47, 0x5D, 0xBC, 0x08, 0x6A, 0xBC, 0x00, 0x08, 0x0B, 0x00,
-    0x87, 0x61, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x0B, 0x00, 0x85, 0x64, 0x70, 0x68,
-    0x6F, 0x6E, 0x65, 0x73, 0x00, 0x44, 0x7C, 0xBC, 0x07, 0x88, 0xBC, 0x00, 0x08, 0x0B, 0x00, 0x86,
-    0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x04, 0x08, 0x0B, 0x00, 0x86, 0x70, 0x68, 0x6F,
-    0x6E, 0x65, 0x73, 0x00, 0x44, 0xB0, 0xBC, 0x06, 0x52, 0xBD, 0x08, 0x5F, 0xBD, 0x09, 0x8D, 0xBD,
-    0x14, 0x9A, 0xBD, 0x16, 0xB9, 0xBD, 0x1A, 0xD8, 0xBD, 0x1B, 0xF7, 0xBD, 0x1D, 0x04, 0xBE, 0x00,
-    0x47, 0xC6, 0xBC, 0x0B, 0xE4, 0xBC, 0x14, 0xEF, 0xBC, 0x15, 0xFC, 0xBC, 0x16, 0x1A, 0xBD, 0x1A,
-    0x27, 0xBD, 0x1D, 0x45, 0xBD, 0x00, 0x48, 0xCD, 0xBC, 0x0B, 0xD9, 0xBC, 0x00, 0x0B, 0x00, 0x88,
-    0x61, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x88, 0x65, 0x61, 0x64, 0x70, 0x68, 0x6F,
-    0x6E, 0x65, 0x73, 0x00, 0x87, 0x65, 0x61, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x08,
-    0x0B, 0x00, 0x88, 0x61, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x48, 0x03, 0xBD, 0x0B,
-    0x0F, 0xBD, 0x00, 0x0B, 0x00, 0x88, 0x61, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x88,
-    0x65, 0x61, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x08, 0x0B, 0x00, 0x88, 0x61, 0x64,
-    0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x48, 0x2E, 0xBD, 0x0B, 0x3A, 0xBD, 0x00, 0x0B, 0x00,
-    0x88, 0x61, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x88, 0x65, 0x61, 0x64, 0x70, 0x68,
-    0x6F, 0x6E, 0x65, 0x73, 0x00, 0x08, 0x0B, 0x00, 0x88, 0x61, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65,
-    0x73, 0x00, 0x04, 0x08, 0x0B, 0x00, 0x87, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x44,
-    0x66, 0xBD, 0x0B, 0x83, 0xBD, 0x00, 0x48, 0x6D, 0xBD, 0x0B, 0x78, 0xBD, 0x00, 0x0B, 0x00, 0x87,
-    0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x88, 0x65, 0x61, 0x64, 0x70, 0x68, 0x6F, 0x6E,
-    0x65, 0x73, 0x00, 0x86, 0x61, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x04, 0x08, 0x0B,
-    0x00, 0x87, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x44, 0xA1, 0xBD, 0x08, 0xAD, 0xBD,
-    0x00, 0x08, 0x0B, 0x00, 0x87, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x0B, 0x00, 0x87,
-    0x61, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x44, 0xC0, 0xBD, 0x08, 0xCC, 0xBD, 0x00,
-    0x08, 0x0B, 0x00, 0x87, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x0B, 0x00, 0x87, 0x61,
-    0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x44, 0xDF, 0xBD, 0x08, 0xEB, 0xBD, 0x00, 0x08,
-    0x0B, 0x00, 0x87, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x0B, 0x00, 0x87, 0x61, 0x64,
-    0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x04, 0x08, 0x0B, 0x00, 0x87, 0x64, 0x70, 0x68, 0x6F,
-    0x6E, 0x65, 0x73, 0x00, 0x44, 0x0B, 0xBE, 0x08, 0x17, 0xBE, 0x00, 0x08, 0x0B, 0x00, 0x87, 0x64,
-    0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x0B, 0x00, 0x87, 0x61, 0x64, 0x70, 0x68, 0x6F, 0x6E,
-    0x65, 0x73, 0x00, 0x44, 0x2A, 0xBE, 0x07, 0x36, 0xBE, 0x00, 0x08, 0x0B, 0x00, 0x86, 0x64, 0x70,
-    0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x04, 0x08, 0x0B, 0x00, 0x86, 0x70, 0x68, 0x6F, 0x6E, 0x65,
-    0x73, 0x00, 0x44, 0x49, 0xBE, 0x07, 0x55, 0xBE, 0x00, 0x08, 0x0B, 0x00, 0x86, 0x64, 0x70, 0x68,
-    0x6F, 0x6E, 0x65, 0x73, 0x00, 0x04, 0x08, 0x0B, 0x00, 0x86, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73,
-    0x00, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x86, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x44, 0x75,
-    0xBE, 0x07, 0x81, 0xBE, 0x00, 0x08, 0x0B, 0x00, 0x86, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73,
-    0x00, 0x04, 0x08, 0x0B, 0x00, 0x86, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x44, 0x94, 0xBE,
-    0x07, 0xA0, 0xBE, 0x00, 0x08, 0x0B, 0x00, 0x86, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00,
-    0x04, 0x08, 0x0B, 0x00, 0x86, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x0B, 0x13, 0x07, 0x04,
-    0x08, 0x0B, 0x00, 0x84, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x4B, 0xC0, 0xBE, 0x13, 0xCC, 0xBE, 0x00,
-    0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x84, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x07, 0x04, 0x08, 0x0B,
-    0x00, 0x84, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x84,
-    0x6F, 0x6E, 0x65, 0x73, 0x00, 0x4B, 0xEC, 0xBE, 0x13, 0xF8, 0xBE, 0x00, 0x13, 0x07, 0x04, 0x08,
-    0x0B, 0x00, 0x84, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x84, 0x68, 0x6F,
-    0x6E, 0x65, 0x73, 0x00, 0x47, 0x0B, 0xBF, 0x0B, 0x16, 0xBF, 0x00, 0x04, 0x08, 0x0B, 0x00, 0x83,
-    0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x47, 0x1D, 0xBF, 0x13, 0x29, 0xBF, 0x00, 0x04, 0x08, 0x0B,
-    0x00, 0x85, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x84, 0x6F,
-    0x6E, 0x65, 0x73, 0x00, 0x4B, 0x3B, 0xBF, 0x13, 0x47, 0xBF, 0x00, 0x13, 0x07, 0x04, 0x08, 0x0B,
-    0x00, 0x84, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x84, 0x68, 0x6F, 0x6E,
-    0x65, 0x73, 0x00, 0x4B, 0x5A, 0xBF, 0x12, 0x66, 0xBF, 0x00, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00,
-    0x83, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x83, 0x6E, 0x65,
-    0x73, 0x00, 0x46, 0x91, 0xBF, 0x07, 0x98, 0xBF, 0x08, 0xC6, 0xBF, 0x09, 0xCD, 0xBF, 0x0B, 0xD4,
-    0xBF, 0x0F, 0xE9, 0xBF, 0x11, 0xF0, 0xBF, 0x13, 0xFD, 0xBF, 0x16, 0x04, 0xC0, 0x1B, 0x0B, 0xC0,
-    0x00, 0x07, 0x00, 0x83, 0x6F, 0x65, 0x73, 0x00, 0x46, 0xA8, 0xBF, 0x08, 0xAE, 0xBF, 0x09, 0xB4,
-    0xBF, 0x16, 0xBA, 0xBF, 0x1B, 0xC0, 0xBF, 0x00, 0x84, 0x64, 0x6F, 0x65, 0x73, 0x00, 0x84, 0x64,
-    0x6F, 0x65, 0x73, 0x00, 0x84, 0x64, 0x6F, 0x65, 0x73, 0x00, 0x84, 0x64, 0x6F, 0x65, 0x73, 0x00,
-    0x84, 0x64, 0x6F, 0x65, 0x73, 0x00, 0x07, 0x00, 0x83, 0x6F, 0x65, 0x73, 0x00, 0x07, 0x00, 0x83,
-    0x6F, 0x65, 0x73, 0x00, 0x53, 0xDB, 0xBF, 0x17, 0xE5, 0xBF, 0x00, 0x07, 0x04, 0x08, 0x0B, 0x00,
-    0x81, 0x6E, 0x65, 0x73, 0x00, 0x81, 0x73, 0x65, 0x00, 0x07, 0x00, 0x83, 0x6F, 0x65, 0x73, 0x00,
-    0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x83, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x07, 0x00, 0x83,
-    0x6F, 0x65, 0x73, 0x00, 0x07, 0x00, 0x83, 0x6F, 0x65, 0x73, 0x00, 0x07, 0x00, 0x83, 0x6F, 0x65,
-    0x73, 0x00, 0x44, 0x19, 0xC0, 0x11, 0x1F, 0xC0, 0x00, 0x08, 0x1C, 0x00, 0x81, 0x73, 0x00, 0x12,
-    0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x82, 0x65, 0x73, 0x00, 0x51, 0x32, 0xC0, 0x12, 0x3E,
-    0xC0, 0x00, 0x12, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x82, 0x65, 0x73, 0x00, 0x07, 0x00,
-    0x82, 0x65, 0x73, 0x00, 0x44, 0x4E, 0xC0, 0x0A, 0x55, 0xC0, 0x11, 0x5D, 0xC0, 0x00, 0x08, 0x1C,
-    0x00, 0x81, 0x72, 0x73, 0x00, 0x11, 0x0C, 0x0B, 0x17, 0x00, 0x81, 0x73, 0x00, 0x0C, 0x0B, 0x17,
-    0x00, 0x81, 0x67, 0x73, 0x00, 0x45, 0x81, 0xC0, 0x09, 0x98, 0xC0, 0x0B, 0xA1, 0xC0, 0x0C, 0xB8,
-    0xC0, 0x0D, 0xCF, 0xC0, 0x10, 0xD8, 0xC0, 0x11, 0xEF, 0xC0, 0x17, 0x2C, 0xC2, 0x19, 0x35, 0xC2,
-    0x00, 0x4C, 0x88, 0xC0, 0x11, 0x90, 0xC0, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x6E, 0x67, 0x73, 0x00,
-    0x0C, 0x0B, 0x17, 0x00, 0x82, 0x67, 0x73, 0x00, 0x11, 0x0C, 0x0B, 0x17, 0x00, 0x82, 0x67, 0x73,
-    0x00, 0x4C, 0xA8, 0xC0, 0x11, 0xB0, 0xC0, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x6E, 0x67, 0x73, 0x00,
-    0x0C, 0x0B, 0x17, 0x00, 0x82, 0x67, 0x73, 0x00, 0x4B, 0xBF, 0xC0, 0x11, 0xC6, 0xC0, 0x00, 0x17,
-    0x00, 0x81, 0x6E, 0x67, 0x73, 0x00, 0x0B, 0x17, 0x00, 0x83, 0x69, 0x6E, 0x67, 0x73, 0x00, 0x0C,
-    0x0B, 0x17, 0x00, 0x82, 0x6E, 0x67, 0x73, 0x00, 0x4C, 0xDF, 0xC0, 0x11, 0xE7, 0xC0, 0x00, 0x0B,
-    0x17, 0x00, 0x82, 0x6E, 0x67, 0x73, 0x00, 0x0C, 0x0B, 0x17, 0x00, 0x82, 0x67, 0x73, 0x00, 0x45,
-    0x08, 0xC1, 0x0B, 0x11, 0xC1, 0x0C, 0x33, 0xC1, 0x0D, 0xE2, 0xC1, 0x0E, 0xEB, 0xC1, 0x10, 0xF4,
-    0xC1, 0x12, 0xFD, 0xC1, 0x18, 0x15, 0xC2, 0x00, 0x0C, 0x0B, 0x17, 0x00, 0x83, 0x6E, 0x67, 0x73,
-    0x00, 0x4C, 0x18, 0xC1, 0x17, 0x2D, 0xC1, 0x00, 0x4B, 0x1F, 0xC1, 0x17, 0x26, 0xC1, 0x00, 0x17,
-    0x00, 0x83, 0x6E, 0x67, 0x73, 0x00, 0x84, 0x68, 0x69, 0x6E, 0x67, 0x73, 0x00, 0x82, 0x69, 0x6E,
-    0x67, 0x73, 0x00, 0x45, 0x4F, 0xC1, 0x0A, 0x65, 0xC1, 0x0B, 0x7B, 0xC1, 0x0D, 0x85, 0xC1, 0x0E,
-    0x9B, 0xC1, 0x11, 0xA4, 0xC1, 0x17, 0xBA, 0xC1, 0x18, 0xC3, 0xC1, 0x1C, 0xCC, 0xC1, 0x00, 0x4B,
-    0x56, 0xC1, 0x17, 0x5E, 0xC1, 0x00, 0x17, 0x00, 0x84, 0x69, 0x6E, 0x67, 0x73, 0x00, 0x84, 0x68,
-    0x69, 0x6E, 0x67, 0x73, 0x00, 0x4B, 0x6C, 0xC1, 0x17, 0x74, 0xC1, 0x00, 0x17, 0x00, 0x84, 0x69,
-    0x6E, 0x67, 0x73, 0x00, 0x84, 0x68, 0x69, 0x6E, 0x67, 0x73, 0x00, 0x2C, 0x00, 0x84, 0x74, 0x68,
-    0x69, 0x6E, 0x67, 0x73, 0x00, 0x4B, 0x8C, 0xC1, 0x17, 0x94, 0xC1, 0x00, 0x17, 0x00, 0x84, 0x69,
-    0x6E, 0x67, 0x73, 0x00, 0x84, 0x68, 0x69, 0x6E, 0x67, 0x73, 0x00, 0x0B, 0x17, 0x00, 0x84, 0x69,
-    0x6E, 0x67, 0x73, 0x00, 0x4B, 0xAB, 0xC1, 0x17, 0xB3, 0xC1, 0x00, 0x17, 0x00, 0x84, 0x69, 0x6E,
-    0x67, 0x73, 0x00, 0x84, 0x68, 0x69, 0x6E, 0x67, 0x73, 0x00, 0x2C, 0x00, 0x83, 0x68, 0x69, 0x6E,
-    0x67, 0x73, 0x00, 0x0B, 0x17, 0x00, 0x84, 0x69, 0x6E, 0x67, 0x73, 0x00, 0x4B, 0xD3, 0xC1, 0x17,
-    0xDB, 0xC1, 0x00, 0x17, 0x00, 0x84, 0x69, 0x6E, 0x67, 0x73, 0x00, 0x84, 0x68, 0x69, 0x6E, 0x67,
-    0x73, 0x00, 0x0C, 0x0B, 0x17, 0x00, 0x83, 0x6E, 0x67, 0x73, 0x00, 0x0B, 0x17, 0x00, 0x83, 0x69,
-    0x6E, 0x67, 0x73, 0x00, 0x0C, 0x0B, 0x17, 0x00, 0x83, 0x6E, 0x67, 0x73, 0x00, 0x4B, 0x04, 0xC2,
-    0x0C, 0x0D, 0xC2, 0x00, 0x17, 0x2C, 0x00, 0x83, 0x69, 0x6E, 0x67, 0x73, 0x00, 0x0B, 0x17, 0x00,
-    0x83, 0x6E, 0x67, 0x73, 0x00, 0x4B, 0x1C, 0xC2, 0x0C, 0x24, 0xC2, 0x00, 0x17, 0x00, 0x83, 0x69,
-    0x6E, 0x67, 0x73, 0x00, 0x0B, 0x17, 0x00, 0x83, 0x6E, 0x67, 0x73, 0x00, 0x11, 0x0C, 0x0B, 0x17,
-    0x00, 0x82, 0x67, 0x73, 0x00, 0x11, 0x0C, 0x0B, 0x17, 0x00, 0x82, 0x67, 0x73, 0x00, 0x44, 0x4B,
-    0xC2, 0x0A, 0x53, 0xC2, 0x11, 0x5B, 0xC2, 0x1C, 0x63, 0xC2, 0x00, 0x1A, 0x0F, 0x04, 0x00, 0x81,
-    0x79, 0x73, 0x00, 0x11, 0x0C, 0x0B, 0x17, 0x00, 0x81, 0x73, 0x00, 0x0C, 0x0B, 0x17, 0x00, 0x81,
-    0x67, 0x73, 0x00, 0x04, 0x1A, 0x0F, 0x04, 0x00, 0x81, 0x73, 0x00, 0x44, 0x99, 0xC2, 0x05, 0xB4,
-    0xC2, 0x07, 0xBB, 0xC2, 0x08, 0xD6, 0xC2, 0x0A, 0xF1, 0xC2, 0x0B, 0xF8, 0xC2, 0x0D, 0x58, 0xC3,
-    0x0E, 0x5F, 0xC3, 0x11, 0x76, 0xC3, 0x12, 0x7D, 0xC3, 0x16, 0x94, 0xC3, 0x18, 0x4B, 0xC6, 0x1A,
-    0x62, 0xC6, 0x1B, 0x7D, 0xC6, 0x1C, 0x98, 0xC6, 0x00, 0x56, 0xA0, 0xC2, 0x1C, 0xAA, 0xC2, 0x00,
-    0x1C, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x82, 0x69, 0x73, 0x00, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x82,
-    0x73, 0x69, 0x73, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x69, 0x73, 0x00, 0x56, 0xC2, 0xC2, 0x1C, 0xCC,
-    0xC2, 0x00, 0x1C, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x82, 0x69, 0x73, 0x00, 0x0F, 0x04, 0x11, 0x04,
-    0x00, 0x82, 0x73, 0x69, 0x73, 0x00, 0x56, 0xDD, 0xC2, 0x1C, 0xE7, 0xC2, 0x00, 0x1C, 0x0F, 0x04,
-    0x11, 0x04, 0x00, 0x82, 0x69, 0x73, 0x00, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x82, 0x73, 0x69, 0x73,
-    0x00, 0x0B, 0x17, 0x00, 0x82, 0x69, 0x73, 0x00, 0x45, 0x0E, 0xC3, 0x0A, 0x15, 0xC3, 0x0D, 0x1C,
-    0xC3, 0x11, 0x23, 0xC3, 0x15, 0x2A, 0xC3, 0x17, 0x31, 0xC3, 0x1C, 0x51, 0xC3, 0x00, 0x17, 0x00,
-    0x83, 0x68, 0x69, 0x73, 0x00, 0x17, 0x00, 0x83, 0x68, 0x69, 0x73, 0x00, 0x17, 0x00, 0x83, 0x68,
-    0x69, 0x73, 0x00, 0x17, 0x00, 0x83, 0x68, 0x69, 0x73, 0x00, 0x17, 0x00, 0x83, 0x68, 0x69, 0x73,
-    0x00, 0x4A, 0x3B, 0xC3, 0x15, 0x41, 0xC3, 0x1C, 0x49, 0xC3, 0x00, 0x84, 0x74, 0x68, 0x69, 0x73,
-    0x00, 0x2C, 0x00, 0x84, 0x74, 0x68, 0x69, 0x73, 0x00, 0x2C, 0x00, 0x84, 0x74, 0x68, 0x69, 0x73,
-    0x00, 0x17, 0x00, 0x83, 0x68, 0x69, 0x73, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x69, 0x73, 0x00, 0x4B,
-    0x66, 0xC3, 0x16, 0x6C, 0xC3, 0x00, 0x17, 0x00, 0x82, 0x69, 0x73, 0x00, 0x1C, 0x0F, 0x04, 0x11,
-    0x04, 0x00, 0x82, 0x69, 0x73, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x69, 0x73, 0x00, 0x4B, 0x84, 0xC3,
-    0x16, 0x8A, 0xC3, 0x00, 0x17, 0x00, 0x82, 0x69, 0x73, 0x00, 0x1C, 0x0F, 0x04, 0x11, 0x04, 0x00,
-    0x82, 0x69, 0x73, 0x00, 0x44, 0xB3, 0xC3, 0x07, 0xBE, 0xC3, 0x08, 0xC9, 0xC3, 0x0B, 0xD4, 0xC3,
-    0x0F, 0xEF, 0xC3, 0x17, 0x0A, 0xC4, 0x18, 0x25, 0xC4, 0x1A, 0x40, 0xC4, 0x1B, 0x4B, 0xC4, 0x1C,
-    0x56, 0xC4, 0x00, 0x1C, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x83, 0x73, 0x69, 0x73, 0x00, 0x1C, 0x0F,
-    0x04, 0x11, 0x04, 0x00, 0x83, 0x73, 0x69, 0x73, 0x00, 0x1C, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x83,
-    0x73, 0x69, 0x73, 0x00, 0x4F, 0xDB, 0xC3, 0x1C, 0xE5, 0xC3, 0x00, 0x04, 0x11, 0x04, 0x00, 0x83,
-    0x79, 0x73, 0x69, 0x73, 0x00, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x83, 0x73, 0x69, 0x73, 0x00, 0x44,
-    0xF6, 0xC3, 0x1C, 0xFF, 0xC3, 0x00, 0x11, 0x04, 0x00, 0x82, 0x79, 0x73, 0x69, 0x73, 0x00, 0x04,
-    0x11, 0x04, 0x00, 0x84, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x4F, 0x11, 0xC4, 0x1C, 0x1B, 0xC4,
-    0x00, 0x04, 0x11, 0x04, 0x00, 0x83, 0x79, 0x73, 0x69, 0x73, 0x00, 0x0F, 0x04, 0x11, 0x04, 0x00,
-    0x83, 0x73, 0x69, 0x73, 0x00, 0x4F, 0x2C, 0xC4, 0x1C, 0x36, 0xC4, 0x00, 0x04, 0x11, 0x04, 0x00,
-    0x83, 0x79, 0x73, 0x69, 0x73, 0x00, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x83, 0x73, 0x69, 0x73, 0x00,
-    0x1C, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x83, 0x73, 0x69, 0x73, 0x00, 0x1C, 0x0F, 0x04, 0x11, 0x04,
-    0x00, 0x83, 0x73, 0x69, 0x73, 0x00, 0x44, 0x6C, 0xC4, 0x0B, 0x87, 0xC4, 0x0E, 0x92, 0xC4, 0x0F,
-    0xAD, 0xC4, 0x12, 0x1A, 0xC6, 0x17, 0x35, 0xC6, 0x18, 0x40, 0xC6, 0x00, 0x4F, 0x73, 0xC4, 0x11,
-    0x7E, 0xC4, 0x00, 0x11, 0x04, 0x00, 0x85, 0x61, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x04, 0x00,
-    0x83, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x84, 0x79, 0x73, 0x69,
-    0x73, 0x00, 0x44, 0x99, 0xC4, 0x0F, 0xA3, 0xC4, 0x00, 0x11, 0x04, 0x00, 0x84, 0x6C, 0x79, 0x73,
-    0x69, 0x73, 0x00, 0x04, 0x11, 0x04, 0x00, 0x84, 0x79, 0x73, 0x69, 0x73, 0x00, 0x44, 0xC6, 0xC4,
-    0x0E, 0x8E, 0xC5, 0x11, 0x99, 0xC5, 0x12, 0xA3, 0xC5, 0x14, 0xAE, 0xC5, 0x16, 0xC9, 0xC5, 0x1A,
-    0xE4, 0xC5, 0x1D, 0xFF, 0xC5, 0x00, 0x44, 0xE5, 0xC4, 0x05, 0xEE, 0xC4, 0x0B, 0x08, 0xC5, 0x0D,
-    0x22, 0xC5, 0x10, 0x3C, 0xC5, 0x11, 0x56, 0xC5, 0x14, 0x62, 0xC5, 0x16, 0x6D, 0xC5, 0x1A, 0x78,
-    0xC5, 0x1D, 0x83, 0xC5, 0x00, 0x85, 0x6E, 0x61, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x44, 0xF5,
-    0xC4, 0x11, 0xFE, 0xC4, 0x00, 0x86, 0x6E, 0x61, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x04, 0x00,
-    0x86, 0x61, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x44, 0x0F, 0xC5, 0x11, 0x18, 0xC5, 0x00, 0x86,
-    0x6E, 0x61, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x04, 0x00, 0x86, 0x61, 0x6C, 0x79, 0x73, 0x69,
-    0x73, 0x00, 0x44, 0x29, 0xC5, 0x11, 0x32, 0xC5, 0x00, 0x86, 0x6E, 0x61, 0x6C, 0x79, 0x73, 0x69,
-    0x73, 0x00, 0x04, 0x00, 0x86, 0x61, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x44, 0x43, 0xC5, 0x11,
-    0x4C, 0xC5, 0x00, 0x86, 0x6E, 0x61, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x04, 0x00, 0x86, 0x61,
-    0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x2C, 0x00, 0x86, 0x61, 0x6E, 0x61, 0x6C, 0x79, 0x73, 0x69,
-    0x73, 0x00, 0x11, 0x04, 0x00, 0x86, 0x61, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x11, 0x04, 0x00,
-    0x86, 0x61, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x11, 0x04, 0x00, 0x86, 0x61, 0x6C, 0x79, 0x73,
-    0x69, 0x73, 0x00, 0x11, 0x04, 0x00, 0x86, 0x61, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x04, 0x11,
-    0x04, 0x00, 0x85, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x04, 0x00, 0x84, 0x61, 0x6C, 0x79, 0x73,
-    0x69, 0x73, 0x00, 0x04, 0x11, 0x04, 0x00, 0x85, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x44, 0xB5,
-    0xC5, 0x11, 0xBF, 0xC5, 0x00, 0x11, 0x04, 0x00, 0x85, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x04,
-    0x00, 0x85, 0x61, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x44, 0xD0, 0xC5, 0x11, 0xDA, 0xC5, 0x00,
-    0x11, 0x04, 0x00, 0x85, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x04, 0x00, 0x85, 0x61, 0x6C, 0x79,
-    0x73, 0x69, 0x73, 0x00, 0x44, 0xEB, 0xC5, 0x11, 0xF5, 0xC5, 0x00, 0x11, 0x04, 0x00, 0x85, 0x6C,
-    0x79, 0x73, 0x69, 0x73, 0x00, 0x04, 0x00, 0x85, 0x61, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x44,
-    0x06, 0xC6, 0x11, 0x10, 0xC6, 0x00, 0x11, 0x04, 0x00, 0x85, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00,
-    0x04, 0x00, 0x85, 0x61, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x44, 0x21, 0xC6, 0x0F, 0x2B, 0xC6,
-    0x00, 0x11, 0x04, 0x00, 0x84, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x04, 0x11, 0x04, 0x00, 0x84,
-    0x79, 0x73, 0x69, 0x73, 0x00, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x84, 0x79, 0x73, 0x69, 0x73, 0x00,
-    0x0F, 0x04, 0x11, 0x04, 0x00, 0x84, 0x79, 0x73, 0x69, 0x73, 0x00, 0x4B, 0x52, 0xC6, 0x16, 0x58,
-    0xC6, 0x00, 0x17, 0x00, 0x82, 0x69, 0x73, 0x00, 0x1C, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x82, 0x69,
-    0x73, 0x00, 0x56, 0x69, 0xC6, 0x1C, 0x73, 0xC6, 0x00, 0x1C, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x82,
-    0x69, 0x73, 0x00, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x82, 0x73, 0x69, 0x73, 0x00, 0x56, 0x84, 0xC6,
-    0x1C, 0x8E, 0xC6, 0x00, 0x1C, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x82, 0x69, 0x73, 0x00, 0x0F, 0x04,
-    0x11, 0x04, 0x00, 0x82, 0x73, 0x69, 0x73, 0x00, 0x4F, 0x9F, 0xC6, 0x16, 0xA8, 0xC6, 0x00, 0x04,
-    0x11, 0x04, 0x00, 0x81, 0x73, 0x69, 0x73, 0x00, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x83, 0x79, 0x73,
-    0x69, 0x73, 0x00, 0x4C, 0xBA, 0xC6, 0x16, 0xC0, 0xC6, 0x00, 0x0B, 0x17, 0x00, 0x81, 0x73, 0x00,
-    0x1C, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x81, 0x69, 0x73, 0x00, 0x55, 0xD1, 0xC6, 0x18, 0xD7, 0xC6,
-    0x00, 0x12, 0x1A, 0x00, 0x80, 0x64, 0x00, 0x12, 0x00, 0x46, 0xE0, 0xC6, 0x1A, 0xE3, 0xC6, 0x00,
-    0x80, 0x64, 0x00, 0x80, 0x64, 0x00, 0x48, 0xF0, 0xC6, 0x0A, 0xFD, 0xC6, 0x12, 0x06, 0xC7, 0x00,
-    0x12, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x82, 0x6E, 0x65, 0x73, 0x00, 0x0C, 0x0B, 0x17,
-    0x00, 0x82, 0x6E, 0x67, 0x73, 0x00, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x80, 0x65, 0x73,
-    0x00, 0x16, 0x1C, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x81, 0x69, 0x73, 0x00, 0x44, 0x32, 0xC7, 0x08,
-    0x6C, 0xC7, 0x11, 0x8E, 0xC7, 0x14, 0x9A, 0xC7, 0x16, 0xA2, 0xC7, 0x1A, 0xB7, 0xC7, 0x1D, 0xBF,
-    0xC7, 0x00, 0x47, 0x42, 0xC7, 0x08, 0x4A, 0xC7, 0x15, 0x53, 0xC7, 0x1A, 0x5B, 0xC7, 0x1C, 0x63,
-    0xC7, 0x00, 0x1C, 0x00, 0x83, 0x65, 0x61, 0x72, 0x73, 0x00, 0x18, 0x00, 0x84, 0x79, 0x65, 0x61,
-    0x72, 0x73, 0x00, 0x1C, 0x00, 0x83, 0x65, 0x61, 0x72, 0x73, 0x00, 0x1C, 0x00, 0x83, 0x65, 0x61,
-    0x72, 0x73, 0x00, 0x08, 0x00, 0x84, 0x79, 0x65, 0x61, 0x72, 0x73, 0x00, 0x44, 0x76, 0xC7, 0x11,
-    0x7E, 0xC7, 0x12, 0x89, 0xC7, 0x00, 0x1C, 0x00, 0x83, 0x65, 0x61, 0x72, 0x73, 0x00, 0x12, 0x0B,
-    0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x81, 0x73, 0x00, 0x07, 0x00, 0x81, 0x73, 0x00, 0x12, 0x0B,
-    0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x81, 0x65, 0x73, 0x00, 0x08, 0x1C, 0x00, 0x82, 0x61, 0x72,
-    0x73, 0x00, 0x44, 0xA9, 0xC7, 0x08, 0xB0, 0xC7, 0x00, 0x08, 0x1C, 0x00, 0x82, 0x72, 0x73, 0x00,
-    0x1C, 0x00, 0x82, 0x61, 0x72, 0x73, 0x00, 0x08, 0x1C, 0x00, 0x82, 0x61, 0x72, 0x73, 0x00, 0x08,
-    0x1C, 0x00, 0x82, 0x61, 0x72, 0x73, 0x00, 0x1C, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x80, 0x69, 0x73,
-    0x00, 0x74, 0xE4, 0xC7, 0x04, 0xED, 0xC7, 0x0A, 0x01, 0xC8, 0x11, 0x09, 0xC8, 0x15, 0x11, 0xC8,
-    0x1C, 0x18, 0xC8, 0x00, 0x04, 0x0B, 0x17, 0x00, 0x82, 0x74, 0x27, 0x73, 0x00, 0x48, 0xF4, 0xC7,
-    0x1A, 0xFA, 0xC7, 0x00, 0x1C, 0x00, 0x81, 0x72, 0x73, 0x00, 0x0F, 0x04, 0x00, 0x81, 0x79, 0x73,
-    0x00, 0x11, 0x0C, 0x0B, 0x17, 0x00, 0x81, 0x73, 0x00, 0x0C, 0x0B, 0x17, 0x00, 0x81, 0x67, 0x73,
-    0x00, 0x0C, 0x09, 0x00, 0x81, 0x73, 0x74, 0x00, 0x04, 0x1A, 0x0F, 0x04, 0x00, 0x81, 0x73, 0x00,
-    0x44, 0x2D, 0xC8, 0x0C, 0x35, 0xC8, 0x16, 0x3C, 0xC8, 0x1C, 0x46, 0xC8, 0x00, 0x1A, 0x0F, 0x04,
-    0x00, 0x81, 0x79, 0x73, 0x00, 0x0B, 0x17, 0x2C, 0x00, 0x81, 0x73, 0x00, 0x1C, 0x0F, 0x04, 0x11,
-    0x04, 0x00, 0x81, 0x69, 0x73, 0x00, 0x04, 0x1A, 0x0F, 0x04, 0x00, 0x81, 0x73, 0x00, 0x4A, 0x55,
-    0xC8, 0x11, 0x5D, 0xC8, 0x00, 0x11, 0x0C, 0x0B, 0x17, 0x00, 0x81, 0x73, 0x00, 0x0C, 0x0B, 0x17,
-    0x00, 0x81, 0x67, 0x73, 0x00, 0x74, 0x75, 0xC8, 0x08, 0x7B, 0xC8, 0x0C, 0x81, 0xC8, 0x11, 0x87,
-    0xC8, 0x12, 0x93, 0xC8, 0x00, 0x17, 0x0C, 0x00, 0x81, 0x73, 0x00, 0x12, 0x07, 0x00, 0x81, 0x73,
-    0x00, 0x0B, 0x17, 0x00, 0x81, 0x73, 0x00, 0x12, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x81,
-    0x65, 0x73, 0x00, 0x11, 0x0E, 0x00, 0x80, 0x00, 0x74, 0xA2, 0xC8, 0x08, 0xA8, 0xC8, 0x0C, 0xAE,
-    0xC8, 0x00, 0x17, 0x0C, 0x00, 0x81, 0x73, 0x00, 0x12, 0x07, 0x00, 0x81, 0x73, 0x00, 0x0B, 0x17,
-    0x00, 0x81, 0x73, 0x00, 0x44, 0xCD, 0xC8, 0x0B, 0xCC, 0xC9, 0x14, 0xD5, 0xC9, 0x16, 0xEC, 0xC9,
-    0x17, 0xF5, 0xC9, 0x18, 0xFE, 0xC9, 0x1A, 0x07, 0xCA, 0x1D, 0x36, 0xCA, 0x00, 0x44, 0xE3, 0xC8,
-    0x08, 0xF9, 0xC8, 0x0F, 0x10, 0xC9, 0x14, 0x1A, 0xC9, 0x16, 0x31, 0xC9, 0x1A, 0x48, 0xC9, 0x1D,
-    0xC3, 0xC9, 0x00, 0x4F, 0xEA, 0xC8, 0x1A, 0xF2, 0xC8, 0x00, 0x04, 0x00, 0x83, 0x77, 0x61, 0x79,
-    0x73, 0x00, 0x0F, 0x04, 0x00, 0x82, 0x79, 0x73, 0x00, 0x4F, 0x00, 0xC9, 0x1A, 0x08, 0xC9, 0x00,
-    0x04, 0x00, 0x83, 0x77, 0x61, 0x79, 0x73, 0x00, 0x0F, 0x04, 0x00, 0x83, 0x61, 0x79, 0x73, 0x00,
-    0x1A, 0x04, 0x00, 0x84, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x00, 0x4F, 0x21, 0xC9, 0x1A, 0x29, 0xC9,
-    0x00, 0x04, 0x00, 0x83, 0x77, 0x61, 0x79, 0x73, 0x00, 0x0F, 0x04, 0x00, 0x83, 0x61, 0x79, 0x73,
-    0x00, 0x4F, 0x38, 0xC9, 0x1A, 0x40, 0xC9, 0x00, 0x04, 0x00, 0x83, 0x77, 0x61, 0x79, 0x73, 0x00,
-    0x0F, 0x04, 0x00, 0x83, 0x61, 0x79, 0x73, 0x00, 0x44, 0x61, 0xC9, 0x08, 0x6A, 0xC9, 0x0E, 0x73,
-    0xC9, 0x0F, 0x89, 0xC9, 0x12, 0x93, 0xC9, 0x14, 0xA9, 0xC9, 0x16, 0xB2, 0xC9, 0x1A, 0xBB, 0xC9,
-    0x00, 0x2C, 0x00, 0x83, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x00, 0x0F, 0x04, 0x00, 0x84, 0x77, 0x61,
-    0x79, 0x73, 0x00, 0x44, 0x7A, 0xC9, 0x0F, 0x81, 0xC9, 0x00, 0x84, 0x6C, 0x77, 0x61, 0x79, 0x73,
-    0x00, 0x04, 0x00, 0x84, 0x77, 0x61, 0x79, 0x73, 0x00, 0x2C, 0x00, 0x84, 0x61, 0x6C, 0x77, 0x61,
-    0x79, 0x73, 0x00, 0x44, 0x9A, 0xC9, 0x0F, 0xA1, 0xC9, 0x00, 0x84, 0x6C, 0x77, 0x61, 0x79, 0x73,
-    0x00, 0x04, 0x00, 0x84, 0x77, 0x61, 0x79, 0x73, 0x00, 0x0F, 0x04, 0x00, 0x84, 0x77, 0x61, 0x79,
-    0x73, 0x00, 0x0F, 0x04, 0x00, 0x84, 0x77, 0x61, 0x79, 0x73, 0x00, 0x0F, 0x04, 0x00, 0x83, 0x61,
-    0x79, 0x73, 0x00, 0x1A, 0x0F, 0x04, 0x00, 0x83, 0x61, 0x79, 0x73, 0x00, 0x04, 0x1A, 0x0F, 0x04,
-    0x00, 0x82, 0x79, 0x73, 0x00, 0x44, 0xDC, 0xC9, 0x1A, 0xE4, 0xC9, 0x00, 0x1A, 0x0F, 0x04, 0x00,
-    0x82, 0x79, 0x73, 0x00, 0x0F, 0x04, 0x00, 0x82, 0x61, 0x79, 0x73, 0x00, 0x1A, 0x0F, 0x04, 0x00,
-    0x82, 0x61, 0x79, 0x73, 0x00, 0x04, 0x1A, 0x0F, 0x04, 0x00, 0x82, 0x79, 0x73, 0x00, 0x04, 0x1A,
-    0x0F, 0x04, 0x00, 0x82, 0x79, 0x73, 0x00, 0x44, 0x11, 0xCA, 0x0F, 0x27, 0xCA, 0x1A, 0x2E, 0xCA,
-    0x00, 0x4F, 0x18, 0xCA, 0x1A, 0x20, 0xCA, 0x00, 0x04, 0x00, 0x83, 0x77, 0x61, 0x79, 0x73, 0x00,
-    0x0F, 0x04, 0x00, 0x82, 0x79, 0x73, 0x00, 0x04, 0x00, 0x81, 0x61, 0x79, 0x73, 0x00, 0x0F, 0x04,
-    0x00, 0x82, 0x61, 0x79, 0x73, 0x00, 0x44, 0x3D, 0xCA, 0x1A, 0x45, 0xCA, 0x00, 0x1A, 0x0F, 0x04,
-    0x00, 0x82, 0x79, 0x73, 0x00, 0x0F, 0x04, 0x00, 0x82, 0x61, 0x79, 0x73, 0x00, 0x74, 0x96, 0xCA,
-    0x04, 0x8A, 0xCD, 0x05, 0x75, 0xD0, 0x06, 0x9E, 0xD0, 0x07, 0xF3, 0xD1, 0x08, 0x3F, 0xD2, 0x09,
-    0x90, 0xD2, 0x0A, 0x97, 0xD2, 0x0B, 0x13, 0xD3, 0x0C, 0xB8, 0xD4, 0x0D, 0xF9, 0xD6, 0x0E, 0x36,
-    0xD7, 0x10, 0x4B, 0xD7, 0x11, 0x76, 0xD7, 0x12, 0x04, 0xD9, 0x14, 0x0B, 0xD9, 0x15, 0x33, 0xD9,
-    0x16, 0x17, 0xDA, 0x18, 0x8B, 0xDD, 0x19, 0xEE, 0xDE, 0x1A, 0x03, 0xDF, 0x1B, 0x62, 0xDF, 0x1C,
-    0xAE, 0xDF, 0x1D, 0x36, 0xE0, 0x00, 0x44, 0xAC, 0xCA, 0x05, 0xB5, 0xCA, 0x0B, 0xE0, 0xCA, 0x0D,
-    0x0B, 0xCB, 0x10, 0x36, 0xCB, 0x11, 0x61, 0xCB, 0x12, 0x81, 0xCD, 0x00, 0x11, 0x06, 0x00, 0x83,
-    0x61, 0x6E, 0x27, 0x74, 0x00, 0x44, 0xBF, 0xCA, 0x11, 0xC6, 0xCA, 0x12, 0xD9, 0xCA, 0x00, 0x06,
-    0x00, 0x82, 0x6E, 0x27, 0x74, 0x00, 0x44, 0xCD, 0xCA, 0x12, 0xD3, 0xCA, 0x00, 0x06, 0x00, 0x82,
-    0x27, 0x74, 0x00, 0x07, 0x00, 0x82, 0x27, 0x74, 0x00, 0x07, 0x00, 0x82, 0x6E, 0x27, 0x74, 0x00,
-    0x44, 0xEA, 0xCA, 0x11, 0xF1, 0xCA, 0x12, 0x04, 0xCB, 0x00, 0x06, 0x00, 0x82, 0x6E, 0x27, 0x74,
-    0x00, 0x44, 0xF8, 0xCA, 0x12, 0xFE, 0xCA, 0x00, 0x06, 0x00, 0x82, 0x27, 0x74, 0x00, 0x07, 0x00,
-    0x82, 0x27, 0x74, 0x00, 0x07, 0x00, 0x82, 0x6E, 0x27, 0x74, 0x00, 0x44, 0x15, 0xCB, 0x11, 0x1C,
-    0xCB, 0x12, 0x2F, 0xCB, 0x00, 0x06, 0x00, 0x82, 0x6E, 0x27, 0x74, 0x00, 0x44, 0x23, 0xCB, 0x12,
-    0x29, 0xCB, 0x00, 0x06, 0x00, 0x82, 0x27, 0x74, 0x00, 0x07, 0x00, 0x82, 0x27, 0x74, 0x00, 0x07,
-    0x00, 0x82, 0x6E, 0x27, 0x74, 0x00, 0x44, 0x40, 0xCB, 0x11, 0x47, 0xCB, 0x12, 0x5A, 0xCB, 0x00,
-    0x06, 0x00, 0x82, 0x6E, 0x27, 0x74, 0x00, 0x44, 0x4E, 0xCB, 0x12, 0x54, 0xCB, 0x00, 0x06, 0x00,
-    0x82, 0x27, 0x74, 0x00, 0x07, 0x00, 0x82, 0x27, 0x74, 0x00, 0x07, 0x00, 0x82, 0x6E, 0x27, 0x74,
-    0x00, 0x44, 0x8F, 0xCB, 0x05, 0x05, 0xCC, 0x06, 0x1A, 0xCC, 0x07, 0x23, 0xCC, 0x0B, 0x2C, 0xCC,
-    0x0C, 0x41, 0xCC, 0x0D, 0x55, 0xCC, 0x0F, 0x6A, 0xCC, 0x10, 0x7E, 0xCC, 0x12, 0x93, 0xCC, 0x13,
-    0x1D, 0xCD, 0x14, 0x31, 0xCD, 0x16, 0x45, 0xCD, 0x1A, 0x59, 0xCD, 0x1D, 0x6D, 0xCD, 0x00, 0x46,
-    0xA8, 0xCB, 0x07, 0xD1, 0xCB, 0x14, 0xD8, 0xCB, 0x16, 0xE0, 0xCB, 0x19, 0xE7, 0xCB, 0x1A, 0xEE,
-    0xCB, 0x1B, 0xF6, 0xCB, 0x1D, 0xFD, 0xCB, 0x00, 0x47, 0xB5, 0xCB, 0x16, 0xBC, 0xCB, 0x19, 0xC3,
-    0xCB, 0x1B, 0xCA, 0xCB, 0x00, 0x85, 0x63, 0x61, 0x6E, 0x27, 0x74, 0x00, 0x85, 0x63, 0x61, 0x6E,
-    0x27, 0x74, 0x00, 0x85, 0x63, 0x61, 0x6E, 0x27, 0x74, 0x00, 0x85, 0x63, 0x61, 0x6E, 0x27, 0x74,
-    0x00, 0x84, 0x63, 0x61, 0x6E, 0x27, 0x74, 0x00, 0x06, 0x00, 0x84, 0x61, 0x6E, 0x27, 0x74, 0x00,
-    0x84, 0x63, 0x61, 0x6E, 0x27, 0x74, 0x00, 0x84, 0x63, 0x61, 0x6E, 0x27, 0x74, 0x00, 0x06, 0x00,
-    0x84, 0x61, 0x6E, 0x27, 0x74, 0x00, 0x84, 0x63, 0x61, 0x6E, 0x27, 0x74, 0x00, 0x06, 0x00, 0x84,
-    0x61, 0x6E, 0x27, 0x74, 0x00, 0x44, 0x0C, 0xCC, 0x12, 0x13, 0xCC, 0x00, 0x06, 0x00, 0x83, 0x6E,
-    0x27, 0x74, 0x00, 0x07, 0x00, 0x83, 0x6E, 0x27, 0x74, 0x00, 0x04, 0x00, 0x84, 0x63, 0x61, 0x6E,
-    0x27, 0x74, 0x00, 0x12, 0x00, 0x84, 0x64, 0x6F, 0x6E, 0x27, 0x74, 0x00, 0x44, 0x33, 0xCC, 0x12,
-    0x3A, 0xCC, 0x00, 0x06, 0x00, 0x83, 0x6E, 0x27, 0x74, 0x00, 0x07, 0x00, 0x83, 0x6E, 0x27, 0x74,
-    0x00, 0x47, 0x48, 0xCC, 0x12, 0x4E, 0xCC, 0x00, 0x83, 0x6F, 0x6E, 0x27, 0x74, 0x00, 0x07, 0x00,
-    0x83, 0x6E, 0x27, 0x74, 0x00, 0x44, 0x5C, 0xCC, 0x12, 0x63, 0xCC, 0x00, 0x06, 0x00, 0x83, 0x6E,
-    0x27, 0x74, 0x00, 0x07, 0x00, 0x83, 0x6E, 0x27, 0x74, 0x00, 0x47, 0x71, 0xCC, 0x12, 0x77, 0xCC,
-    0x00, 0x83, 0x6F, 0x6E, 0x27, 0x74, 0x00, 0x07, 0x00, 0x83, 0x6E, 0x27, 0x74, 0x00, 0x44, 0x85,
-    0xCC, 0x12, 0x8C, 0xCC, 0x00, 0x06, 0x00, 0x83, 0x6E, 0x27, 0x74, 0x00, 0x07, 0x00, 0x83, 0x6E,
-    0x27, 0x74, 0x00, 0x46, 0xAF, 0xCC, 0x07, 0xB6, 0xCC, 0x08, 0xE9, 0xCC, 0x09, 0xF0, 0xCC, 0x0C,
-    0xF7, 0xCC, 0x0F, 0xFF, 0xCC, 0x13, 0x07, 0xCD, 0x16, 0x0F, 0xCD, 0x1B, 0x16, 0xCD, 0x00, 0x84,
-    0x64, 0x6F, 0x6E, 0x27, 0x74, 0x00, 0x46, 0xC6, 0xCC, 0x08, 0xCD, 0xCC, 0x09, 0xD4, 0xCC, 0x16,
-    0xDB, 0xCC, 0x1B, 0xE2, 0xCC, 0x00, 0x85, 0x64, 0x6F, 0x6E, 0x27, 0x74, 0x00, 0x85, 0x64, 0x6F,
-    0x6E, 0x27, 0x74, 0x00, 0x85, 0x64, 0x6F, 0x6E, 0x27, 0x74, 0x00, 0x85, 0x64, 0x6F, 0x6E, 0x27,
-    0x74, 0x00, 0x85, 0x64, 0x6F, 0x6E, 0x27, 0x74, 0x00, 0x84, 0x64, 0x6F, 0x6E, 0x27, 0x74, 0x00,
-    0x84, 0x64, 0x6F, 0x6E, 0x27, 0x74, 0x00, 0x07, 0x00, 0x84, 0x6F, 0x6E, 0x27, 0x74, 0x00, 0x07,
-    0x00, 0x84, 0x6F, 0x6E, 0x27, 0x74, 0x00, 0x07, 0x00, 0x84, 0x6F, 0x6E, 0x27, 0x74, 0x00, 0x84,
-    0x64, 0x6F, 0x6E, 0x27, 0x74, 0x00, 0x84, 0x64, 0x6F, 0x6E, 0x27, 0x74, 0x00, 0x47, 0x24, 0xCD,
-    0x12, 0x2A, 0xCD, 0x00, 0x83, 0x6F, 0x6E, 0x27, 0x74, 0x00, 0x07, 0x00, 0x83, 0x6E, 0x27, 0x74,
-    0x00, 0x44, 0x38, 0xCD, 0x06, 0x3F, 0xCD, 0x00, 0x06, 0x00, 0x83, 0x6E, 0x27, 0x74, 0x00, 0x83,
-    0x61, 0x6E, 0x27, 0x74, 0x00, 0x44, 0x4C, 0xCD, 0x06, 0x53, 0xCD, 0x00, 0x06, 0x00, 0x83, 0x6E,
-    0x27, 0x74, 0x00, 0x83, 0x61, 0x6E, 0x27, 0x74, 0x00, 0x44, 0x60, 0xCD, 0x06, 0x67, 0xCD, 0x00,
-    0x06, 0x00, 0x83, 0x6E, 0x27, 0x74, 0x00, 0x83, 0x61, 0x6E, 0x27, 0x74, 0x00, 0x44, 0x74, 0xCD,
-    0x06, 0x7B, 0xCD, 0x00, 0x06, 0x00, 0x83, 0x6E, 0x27, 0x74, 0x00, 0x83, 0x61, 0x6E, 0x27, 0x74,
-    0x00, 0x11, 0x07, 0x00, 0x83, 0x6F, 0x6E, 0x27, 0x74, 0x00, 0x45, 0xB2, 0xCD, 0x07, 0xC3, 0xCD,
-    0x08, 0xD8, 0xCD, 0x0A, 0xB0, 0xCE, 0x0B, 0xC1, 0xCE, 0x0D, 0x8D, 0xCF, 0x11, 0x9E, 0xCF, 0x14,
-    0xAF, 0xCF, 0x15, 0xCC, 0xCF, 0x16, 0xEA, 0xCF, 0x1A, 0x29, 0xD0, 0x1C, 0x47, 0xD0, 0x1D, 0x58,
-    0xD0, 0x00, 0x0B, 0x00, 0x57, 0xBB, 0xCD, 0x1A, 0xBF, 0xCD, 0x00, 0x82, 0x61, 0x74, 0x00, 0x82,
-    0x61, 0x74, 0x00, 0x48, 0xCA, 0xCD, 0x15, 0xD1, 0xCD, 0x00, 0x15, 0x0A, 0x00, 0x82, 0x61, 0x74,
-    0x00, 0x0A, 0x00, 0x82, 0x65, 0x61, 0x74, 0x00, 0x47, 0xEE, 0xCD, 0x08, 0xF6, 0xCD, 0x09, 0x09,
-    0xCE, 0x0A, 0x1D, 0xCE, 0x15, 0x27, 0xCE, 0x17, 0x94, 0xCE, 0x1A, 0xA8, 0xCE, 0x00, 0x15, 0x0A,
-    0x00, 0x83, 0x65, 0x61, 0x74, 0x00, 0x4A, 0xFD, 0xCD, 0x15, 0x03, 0xCE, 0x00, 0x83, 0x72, 0x65,
-    0x61, 0x74, 0x00, 0x0A, 0x00, 0x82, 0x61, 0x74, 0x00, 0x4A, 0x10, 0xCE, 0x15, 0x16, 0xCE, 0x00,
-    0x83, 0x72, 0x65, 0x61, 0x74, 0x00, 0x0A, 0x00, 0x83, 0x65, 0x61, 0x74, 0x00, 0x15, 0x2C, 0x00,
-    0x84, 0x67, 0x72, 0x65, 0x61, 0x74, 0x00, 0x48, 0x3A, 0xCE, 0x0A, 0x42, 0xCE, 0x0B, 0x75, 0xCE,
-    0x15, 0x7E, 0xCE, 0x17, 0x85, 0xCE, 0x19, 0x8D, 0xCE, 0x00, 0x0A, 0x00, 0x84, 0x72, 0x65, 0x61,
-    0x74, 0x00, 0x45, 0x52, 0xCE, 0x09, 0x59, 0xCE, 0x0B, 0x60, 0xCE, 0x17, 0x67, 0xCE, 0x19, 0x6E,
-    0xCE, 0x00, 0x85, 0x67, 0x72, 0x65, 0x61, 0x74, 0x00, 0x85, 0x67, 0x72, 0x65, 0x61, 0x74, 0x00,
-    0x85, 0x67, 0x72, 0x65, 0x61, 0x74, 0x00, 0x85, 0x67, 0x72, 0x65, 0x61, 0x74, 0x00, 0x85, 0x67,
-    0x72, 0x65, 0x61, 0x74, 0x00, 0x2C, 0x00, 0x84, 0x67, 0x72, 0x65, 0x61, 0x74, 0x00, 0x0A, 0x00,
-    0x83, 0x65, 0x61, 0x74, 0x00, 0x0A, 0x00, 0x84, 0x72, 0x65, 0x61, 0x74, 0x00, 0x84, 0x67, 0x72,
-    0x65, 0x61, 0x74, 0x00, 0x4A, 0x9B, 0xCE, 0x15, 0xA1, 0xCE, 0x00, 0x83, 0x72, 0x65, 0x61, 0x74,
-    0x00, 0x0A, 0x00, 0x83, 0x65, 0x61, 0x74, 0x00, 0x15, 0x0A, 0x00, 0x83, 0x65, 0x61, 0x74, 0x00,
-    0x0B, 0x00, 0x57, 0xB9, 0xCE, 0x1A, 0xBD, 0xCE, 0x00, 0x82, 0x61, 0x74, 0x00, 0x82, 0x61, 0x74,
-    0x00, 0x44, 0xE6, 0xCE, 0x05, 0xED, 0xCE, 0x08, 0xFE, 0xCE, 0x0A, 0x05, 0xCF, 0x0D, 0x16, 0xCF,
-    0x11, 0x27, 0xCF, 0x14, 0x38, 0xCF, 0x15, 0x3F, 0xCF, 0x16, 0x46, 0xCF, 0x17, 0x4D, 0xCF, 0x1A,
-    0x55, 0xCF, 0x1C, 0x7C, 0xCF, 0x00, 0x1A, 0x00, 0x83, 0x68, 0x61, 0x74, 0x00, 0x57, 0xF4, 0xCE,
-    0x1A, 0xF9, 0xCE, 0x00, 0x83, 0x68, 0x61, 0x74, 0x00, 0x83, 0x68, 0x61, 0x74, 0x00, 0x1A, 0x00,
-    0x83, 0x68, 0x61, 0x74, 0x00, 0x57, 0x0C, 0xCF, 0x1A, 0x11, 0xCF, 0x00, 0x83, 0x68, 0x61, 0x74,
-    0x00, 0x83, 0x68, 0x61, 0x74, 0x00, 0x57, 0x1D, 0xCF, 0x1A, 0x22, 0xCF, 0x00, 0x83, 0x68, 0x61,
-    0x74, 0x00, 0x83, 0x68, 0x61, 0x74, 0x00, 0x57, 0x2E, 0xCF, 0x1A, 0x33, 0xCF, 0x00, 0x83, 0x68,
-    0x61, 0x74, 0x00, 0x83, 0x68, 0x61, 0x74, 0x00, 0x1A, 0x00, 0x83, 0x68, 0x61, 0x74, 0x00, 0x17,
-    0x00, 0x83, 0x68, 0x61, 0x74, 0x00, 0x1A, 0x00, 0x83, 0x68, 0x61, 0x74, 0x00, 0x15, 0x00, 0x84,
-    0x74, 0x68, 0x61, 0x74, 0x00, 0x44, 0x62, 0xCF, 0x08, 0x68, 0xCF, 0x14, 0x70, 0xCF, 0x16, 0x76,
-    0xCF, 0x00, 0x84, 0x77, 0x68, 0x61, 0x74, 0x00, 0x2C, 0x00, 0x84, 0x77, 0x68, 0x61, 0x74, 0x00,
-    0x84, 0x77, 0x68, 0x61, 0x74, 0x00, 0x84, 0x77, 0x68, 0x61, 0x74, 0x00, 0x57, 0x83, 0xCF, 0x1A,
-    0x88, 0xCF, 0x00, 0x83, 0x68, 0x61, 0x74, 0x00, 0x83, 0x68, 0x61, 0x74, 0x00, 0x0B, 0x00, 0x57,
-    0x96, 0xCF, 0x1A, 0x9A, 0xCF, 0x00, 0x82, 0x61, 0x74, 0x00, 0x82, 0x61, 0x74, 0x00, 0x0B, 0x00,
-    0x57, 0xA7, 0xCF, 0x1A, 0xAB, 0xCF, 0x00, 0x82, 0x61, 0x74, 0x00, 0x82, 0x61, 0x74, 0x00, 0x48,
-    0xB6, 0xCF, 0x0B, 0xBD, 0xCF, 0x00, 0x15, 0x0A, 0x00, 0x82, 0x61, 0x74, 0x00, 0x57, 0xC4, 0xCF,
-    0x1A, 0xC8, 0xCF, 0x00, 0x82, 0x61, 0x74, 0x00, 0x82, 0x61, 0x74, 0x00, 0x48, 0xD6, 0xCF, 0x0C,
-    0xDD, 0xCF, 0x15, 0xE3, 0xCF, 0x00, 0x15, 0x0A, 0x00, 0x82, 0x61, 0x74, 0x00, 0x09, 0x00, 0x81,
-    0x73, 0x74, 0x00, 0x0A, 0x00, 0x82, 0x65, 0x61, 0x74, 0x00, 0x44, 0xFA, 0xCF, 0x08, 0xFF, 0xCF,
-    0x0B, 0x0F, 0xD0, 0x15, 0x1E, 0xD0, 0x18, 0x24, 0xD0, 0x00, 0x0F, 0x00, 0x81, 0x74, 0x00, 0x45,
-    0x06, 0xD0, 0x15, 0x09, 0xD0, 0x00, 0x81, 0x74, 0x00, 0x0A, 0x00, 0x82, 0x61, 0x74, 0x00, 0x57,
-    0x16, 0xD0, 0x1A, 0x1A, 0xD0, 0x00, 0x82, 0x61, 0x74, 0x00, 0x82, 0x61, 0x74, 0x00, 0x0C, 0x09,
-    0x00, 0x81, 0x74, 0x00, 0x0D, 0x00, 0x81, 0x74, 0x00, 0x48, 0x33, 0xD0, 0x0B, 0x3A, 0xD0, 0x15,
-    0x40, 0xD0, 0x00, 0x15, 0x0A, 0x00, 0x82, 0x61, 0x74, 0x00, 0x1A, 0x00, 0x82, 0x61, 0x74, 0x00,
-    0x0A, 0x00, 0x82, 0x65, 0x61, 0x74, 0x00, 0x0B, 0x00, 0x57, 0x50, 0xD0, 0x1A, 0x54, 0xD0, 0x00,
-    0x82, 0x61, 0x74, 0x00, 0x82, 0x61, 0x74, 0x00, 0x48, 0x5F, 0xD0, 0x0B, 0x66, 0xD0, 0x00, 0x15,
-    0x0A, 0x00, 0x82, 0x61, 0x74, 0x00, 0x57, 0x6D, 0xD0, 0x1A, 0x71, 0xD0, 0x00, 0x82, 0x61, 0x74,
-    0x00, 0x82, 0x61, 0x74, 0x00, 0x4A, 0x7F, 0xD0, 0x0B, 0x86, 0xD0, 0x11, 0x8D, 0xD0, 0x00, 0x0C,
-    0x15, 0x00, 0x81, 0x68, 0x74, 0x00, 0x0A, 0x0C, 0x15, 0x00, 0x81, 0x74, 0x00, 0x44, 0x94, 0xD0,
-    0x18, 0x99, 0xD0, 0x00, 0x1A, 0x00, 0x81, 0x74, 0x00, 0x06, 0x00, 0x81, 0x74, 0x00, 0x44, 0xB7,
-    0xD0, 0x07, 0x7A, 0xD1, 0x14, 0x82, 0xD1, 0x16, 0x97, 0xD1, 0x19, 0xAC, 0xD1, 0x1A, 0xB4, 0xD1,
-    0x1B, 0xC9, 0xD1, 0x1D, 0xDE, 0xD1, 0x00, 0x46, 0xCD, 0xD0, 0x08, 0xE1, 0xD0, 0x14, 0xEA, 0xD0,
-    0x16, 0xF2, 0xD0, 0x1A, 0x06, 0xD1, 0x1B, 0x0E, 0xD1, 0x1D, 0x66, 0xD1, 0x00, 0x48, 0xD4, 0xD0,
-    0x1B, 0xDA, 0xD0, 0x00, 0x83, 0x78, 0x61, 0x63, 0x74, 0x00, 0x08, 0x00, 0x83, 0x61, 0x63, 0x74,
-    0x00, 0x1B, 0x00, 0x84, 0x65, 0x78, 0x61, 0x63, 0x74, 0x00, 0x1B, 0x08, 0x00, 0x83, 0x61, 0x63,
-    0x74, 0x00, 0x48, 0xF9, 0xD0, 0x1B, 0xFF, 0xD0, 0x00, 0x83, 0x78, 0x61, 0x63, 0x74, 0x00, 0x08,
-    0x00, 0x83, 0x61, 0x63, 0x74, 0x00, 0x1B, 0x08, 0x00, 0x83, 0x61, 0x63, 0x74, 0x00, 0x46, 0x24,
-    0xD1, 0x07, 0x2C, 0xD1, 0x08, 0x33, 0xD1, 0x15, 0x48, 0xD1, 0x16, 0x4F, 0xD1, 0x1A, 0x57, 0xD1,
-    0x1D, 0x5E, 0xD1, 0x00, 0x08, 0x00, 0x84, 0x78, 0x61, 0x63, 0x74, 0x00, 0x84, 0x65, 0x78, 0x61,
-    0x63, 0x74, 0x00, 0x47, 0x3A, 0xD1, 0x1A, 0x41, 0xD1, 0x00, 0x85, 0x65, 0x78, 0x61, 0x63, 0x74,
-    0x00, 0x85, 0x65, 0x78, 0x61, 0x63, 0x74, 0x00, 0x84, 0x65, 0x78, 0x61, 0x63, 0x74, 0x00, 0x08,
-    0x00, 0x84, 0x78, 0x61, 0x63, 0x74, 0x00, 0x84, 0x65, 0x78, 0x61, 0x63, 0x74, 0x00, 0x08, 0x00,
-    0x84, 0x78, 0x61, 0x63, 0x74, 0x00, 0x48, 0x6D, 0xD1, 0x1B, 0x73, 0xD1, 0x00, 0x83, 0x78, 0x61,
-    0x63, 0x74, 0x00, 0x08, 0x00, 0x83, 0x61, 0x63, 0x74, 0x00, 0x04, 0x1B, 0x08, 0x00, 0x82, 0x63,
-    0x74, 0x00, 0x44, 0x89, 0xD1, 0x1B, 0x90, 0xD1, 0x00, 0x1B, 0x08, 0x00, 0x82, 0x63, 0x74, 0x00,
-    0x08, 0x00, 0x82, 0x61, 0x63, 0x74, 0x00, 0x44, 0x9E, 0xD1, 0x1B, 0xA5, 0xD1, 0x00, 0x1B, 0x08,
-    0x00, 0x82, 0x63, 0x74, 0x00, 0x08, 0x00, 0x82, 0x61, 0x63, 0x74, 0x00, 0x04, 0x1B, 0x08, 0x00,
-    0x82, 0x63, 0x74, 0x00, 0x44, 0xBB, 0xD1, 0x1B, 0xC2, 0xD1, 0x00, 0x1B, 0x08, 0x00, 0x82, 0x63,
-    0x74, 0x00, 0x08, 0x00, 0x82, 0x61, 0x63, 0x74, 0x00, 0x04, 0x00, 0x48, 0xD2, 0xD1, 0x1B, 0xD8,
-    0xD1, 0x00, 0x83, 0x78, 0x61, 0x63, 0x74, 0x00, 0x08, 0x00, 0x82, 0x63, 0x74, 0x00, 0x44, 0xE5,
-    0xD1, 0x1B, 0xEC, 0xD1, 0x00, 0x1B, 0x08, 0x00, 0x82, 0x63, 0x74, 0x00, 0x08, 0x00, 0x82, 0x61,
-    0x63, 0x74, 0x00, 0x44, 0x00, 0xD2, 0x06, 0x07, 0xD2, 0x15, 0x0E, 0xD2, 0x16, 0x15, 0xD2, 0x00,
-    0x1B, 0x08, 0x00, 0x81, 0x63, 0x74, 0x00, 0x04, 0x1B, 0x08, 0x00, 0x81, 0x74, 0x00, 0x0C, 0x09,
-    0x00, 0x81, 0x73, 0x74, 0x00, 0x44, 0x25, 0xD2, 0x08, 0x2A, 0xD2, 0x12, 0x2F, 0xD2, 0x15, 0x34,
-    0xD2, 0x18, 0x3A, 0xD2, 0x00, 0x0F, 0x00, 0x81, 0x74, 0x00, 0x05, 0x00, 0x81, 0x74, 0x00, 0x10,
-    0x00, 0x81, 0x74, 0x00, 0x0C, 0x09, 0x00, 0x81, 0x74, 0x00, 0x0D, 0x00, 0x81, 0x74, 0x00, 0x44,
-    0x4F, 0xD2, 0x0B, 0x63, 0xD2, 0x16, 0x6A, 0xD2, 0x17, 0x84, 0xD2, 0x19, 0x8A, 0xD2, 0x00, 0x55,
-    0x56, 0xD2, 0x17, 0x5D, 0xD2, 0x00, 0x0A, 0x00, 0x82, 0x65, 0x61, 0x74, 0x00, 0x16, 0x00, 0x81,
-    0x74, 0x65, 0x00, 0x17, 0x12, 0x2C, 0x00, 0x80, 0x72, 0x00, 0x44, 0x74, 0xD2, 0x15, 0x79, 0xD2,
-    0x18, 0x7F, 0xD2, 0x00, 0x0F, 0x00, 0x81, 0x74, 0x00, 0x0C, 0x09, 0x00, 0x81, 0x74, 0x00, 0x0D,
-    0x00, 0x81, 0x74, 0x00, 0x09, 0x04, 0x00, 0x80, 0x72, 0x00, 0x08, 0x11, 0x00, 0x80, 0x72, 0x00,
-    0x15, 0x04, 0x13, 0x00, 0x81, 0x74, 0x00, 0x44, 0xAD, 0xD2, 0x0A, 0xBC, 0xD2, 0x0B, 0xC3, 0xD2,
-    0x0C, 0xCB, 0xD2, 0x11, 0xD1, 0xD2, 0x15, 0xEC, 0xD2, 0x16, 0xF2, 0xD2, 0x00, 0x0B, 0x00, 0x57,
-    0xB6, 0xD2, 0x1A, 0xB9, 0xD2, 0x00, 0x81, 0x74, 0x00, 0x81, 0x74, 0x00, 0x0C, 0x15, 0x00, 0x81,
-    0x68, 0x74, 0x00, 0x0C, 0x15, 0x00, 0x82, 0x67, 0x68, 0x74, 0x00, 0x0B, 0x16, 0x00, 0x81, 0x74,
-    0x00, 0x4C, 0xD8, 0xD2, 0x18, 0xE7, 0xD2, 0x00, 0x48, 0xDF, 0xD2, 0x12, 0xE3, 0xD2, 0x00, 0x05,
-    0x00, 0x80, 0x00, 0x0A, 0x00, 0x80, 0x00, 0x06, 0x00, 0x81, 0x74, 0x00, 0x04, 0x13, 0x00, 0x81,
-    0x74, 0x00, 0x44, 0xFF, 0xD2, 0x08, 0x04, 0xD3, 0x12, 0x09, 0xD3, 0x18, 0x0E, 0xD3, 0x00, 0x0F,
-    0x00, 0x81, 0x74, 0x00, 0x05, 0x00, 0x81, 0x74, 0x00, 0x10, 0x00, 0x81, 0x74, 0x00, 0x0D, 0x00,
-    0x81, 0x74, 0x00, 0x45, 0x32, 0xD3, 0x09, 0x47, 0xD3, 0x0A, 0x5C, 0xD3, 0x0B, 0x53, 0xD4, 0x0C,
-    0x67, 0xD4, 0x0D, 0x70, 0xD4, 0x11, 0x78, 0xD4, 0x17, 0x93, 0xD4, 0x19, 0x9B, 0xD4, 0x1C, 0xB0,
-    0xD4, 0x00, 0x4A, 0x39, 0xD3, 0x0C, 0x40, 0xD3, 0x00, 0x0C, 0x15, 0x00, 0x82, 0x68, 0x74, 0x00,
-    0x15, 0x00, 0x82, 0x67, 0x68, 0x74, 0x00, 0x4A, 0x4E, 0xD3, 0x0C, 0x55, 0xD3, 0x00, 0x0C, 0x15,
-    0x00, 0x82, 0x68, 0x74, 0x00, 0x15, 0x00, 0x82, 0x67, 0x68, 0x74, 0x00, 0x45, 0x7E, 0xD3, 0x09,
-    0x86, 0xD3, 0x0A, 0x8E, 0xD3, 0x0B, 0x95, 0xD3, 0x0C, 0x9D, 0xD3, 0x0E, 0xFE, 0xD3, 0x12, 0x12,
-    0xD4, 0x15, 0x26, 0xD4, 0x17, 0x2F, 0xD4, 0x18, 0x37, 0xD4, 0x19, 0x4B, 0xD4, 0x00, 0x0C, 0x15,
-    0x00, 0x83, 0x67, 0x68, 0x74, 0x00, 0x0C, 0x15, 0x00, 0x83, 0x67, 0x68, 0x74, 0x00, 0x0C, 0x15,
-    0x00, 0x82, 0x68, 0x74, 0x00, 0x0C, 0x15, 0x00, 0x83, 0x67, 0x68, 0x74, 0x00, 0x48, 0xB3, 0xD3,
-    0x09, 0xBC, 0xD3, 0x0E, 0xC4, 0xD3, 0x12, 0xCC, 0xD3, 0x15, 0xD4, 0xD3, 0x17, 0xED, 0xD3, 0x18,
-    0xF6, 0xD3, 0x00, 0x15, 0x2C, 0x00, 0x84, 0x69, 0x67, 0x68, 0x74, 0x00, 0x15, 0x00, 0x84, 0x69,
-    0x67, 0x68, 0x74, 0x00, 0x15, 0x00, 0x84, 0x69, 0x67, 0x68, 0x74, 0x00, 0x15, 0x00, 0x84, 0x69,
-    0x67, 0x68, 0x74, 0x00, 0x48, 0xDB, 0xD3, 0x17, 0xE4, 0xD3, 0x00, 0x2C, 0x00, 0x85, 0x72, 0x69,
-    0x67, 0x68, 0x74, 0x00, 0x2C, 0x00, 0x85, 0x72, 0x69, 0x67, 0x68, 0x74, 0x00, 0x15, 0x2C, 0x00,
-    0x84, 0x69, 0x67, 0x68, 0x74, 0x00, 0x15, 0x00, 0x84, 0x69, 0x67, 0x68, 0x74, 0x00, 0x4C, 0x05,
-    0xD4, 0x15, 0x0C, 0xD4, 0x00, 0x15, 0x00, 0x83, 0x67, 0x68, 0x74, 0x00, 0x83, 0x69, 0x67, 0x68,
-    0x74, 0x00, 0x4C, 0x19, 0xD4, 0x15, 0x20, 0xD4, 0x00, 0x15, 0x00, 0x83, 0x67, 0x68, 0x74, 0x00,
-    0x83, 0x69, 0x67, 0x68, 0x74, 0x00, 0x0C, 0x00, 0x84, 0x72, 0x69, 0x67, 0x68, 0x74, 0x00, 0x0C,
-    0x15, 0x00, 0x83, 0x67, 0x68, 0x74, 0x00, 0x4C, 0x3E, 0xD4, 0x15, 0x45, 0xD4, 0x00, 0x15, 0x00,
-    0x83, 0x67, 0x68, 0x74, 0x00, 0x83, 0x69, 0x67, 0x68, 0x74, 0x00, 0x0C, 0x15, 0x00, 0x83, 0x67,
-    0x68, 0x74, 0x00, 0x4A, 0x5A, 0xD4, 0x0C, 0x60, 0xD4, 0x00, 0x0C, 0x15, 0x00, 0x81, 0x74, 0x00,
-    0x15, 0x00, 0x82, 0x67, 0x68, 0x74, 0x00, 0x0A, 0x15, 0x00, 0x83, 0x69, 0x67, 0x68, 0x74, 0x00,
-    0x0A, 0x0C, 0x15, 0x00, 0x82, 0x68, 0x74, 0x00, 0x44, 0x82, 0xD4, 0x0A, 0x87, 0xD4, 0x18, 0x8E,
-    0xD4, 0x00, 0x1A, 0x00, 0x81, 0x74, 0x00, 0x0C, 0x15, 0x00, 0x82, 0x68, 0x74, 0x00, 0x06, 0x00,
-    0x81, 0x74, 0x00, 0x0C, 0x15, 0x00, 0x82, 0x67, 0x68, 0x74, 0x00, 0x4A, 0xA2, 0xD4, 0x0C, 0xA9,
-    0xD4, 0x00, 0x0C, 0x15, 0x00, 0x82, 0x68, 0x74, 0x00, 0x15, 0x00, 0x82, 0x67, 0x68, 0x74, 0x00,
-    0x0A, 0x0C, 0x15, 0x00, 0x82, 0x68, 0x74, 0x00, 0x45, 0xD7, 0xD4, 0x0A, 0xDE, 0xD4, 0x0B, 0xE5,
-    0xD4, 0x0D, 0x6A, 0xD5, 0x0E, 0x8C, 0xD5, 0x10, 0xAE, 0xD5, 0x11, 0x94, 0xD6, 0x12, 0xB6, 0xD6,
-    0x18, 0xD4, 0xD6, 0x1C, 0xF2, 0xD6, 0x00, 0x0B, 0x16, 0x00, 0x82, 0x69, 0x74, 0x00, 0x0B, 0x16,
-    0x00, 0x82, 0x69, 0x74, 0x00, 0x44, 0x04, 0xD5, 0x05, 0x0B, 0xD5, 0x07, 0x12, 0xD5, 0x08, 0x19,
-    0xD5, 0x0A, 0x20, 0xD5, 0x0D, 0x27, 0xD5, 0x11, 0x2E, 0xD5, 0x16, 0x35, 0xD5, 0x1B, 0x5C, 0xD5,
-    0x1C, 0x63, 0xD5, 0x00, 0x16, 0x00, 0x83, 0x68, 0x69, 0x74, 0x00, 0x16, 0x00, 0x83, 0x68, 0x69,
-    0x74, 0x00, 0x16, 0x00, 0x83, 0x68, 0x69, 0x74, 0x00, 0x16, 0x00, 0x83, 0x68, 0x69, 0x74, 0x00,
-    0x16, 0x00, 0x83, 0x68, 0x69, 0x74, 0x00, 0x16, 0x00, 0x83, 0x68, 0x69, 0x74, 0x00, 0x16, 0x00,
-    0x83, 0x68, 0x69, 0x74, 0x00, 0x47, 0x42, 0xD5, 0x08, 0x48, 0xD5, 0x1A, 0x50, 0xD5, 0x1B, 0x56,
-    0xD5, 0x00, 0x84, 0x73, 0x68, 0x69, 0x74, 0x00, 0x2C, 0x00, 0x84, 0x73, 0x68, 0x69, 0x74, 0x00,
-    0x84, 0x73, 0x68, 0x69, 0x74, 0x00, 0x84, 0x73, 0x68, 0x69, 0x74, 0x00, 0x16, 0x00, 0x83, 0x68,
-    0x69, 0x74, 0x00, 0x16, 0x00, 0x83, 0x68, 0x69, 0x74, 0x00, 0x4B, 0x71, 0xD5, 0x10, 0x77, 0xD5,
-    0x00, 0x16, 0x00, 0x82, 0x69, 0x74, 0x00, 0x50, 0x7E, 0xD5, 0x12, 0x85, 0xD5, 0x00, 0x12, 0x06,
-    0x00, 0x82, 0x69, 0x74, 0x00, 0x06, 0x00, 0x82, 0x6D, 0x69, 0x74, 0x00, 0x4B, 0x93, 0xD5, 0x10,
-    0x99, 0xD5, 0x00, 0x16, 0x00, 0x82, 0x69, 0x74, 0x00, 0x50, 0xA0, 0xD5, 0x12, 0xA7, 0xD5, 0x00,
-    0x12, 0x06, 0x00, 0x82, 0x69, 0x74, 0x00, 0x06, 0x00, 0x82, 0x6D, 0x69, 0x74, 0x00, 0x4D, 0xBE,
-    0xD5, 0x0E, 0xD5, 0xD5, 0x10, 0xEC, 0xD5, 0x11, 0x73, 0xD6, 0x12, 0x8A, 0xD6, 0x00, 0x50, 0xC5,
-    0xD5, 0x12, 0xCD, 0xD5, 0x00, 0x12, 0x06, 0x00, 0x83, 0x6D, 0x69, 0x74, 0x00, 0x06, 0x00, 0x83,
-    0x6D, 0x6D, 0x69, 0x74, 0x00, 0x50, 0xDC, 0xD5, 0x12, 0xE4, 0xD5, 0x00, 0x12, 0x06, 0x00, 0x83,
-    0x6D, 0x69, 0x74, 0x00, 0x06, 0x00, 0x83, 0x6D, 0x6D, 0x69, 0x74, 0x00, 0x46, 0x05, 0xD6, 0x0C,
-    0x0C, 0xD6, 0x0D, 0x22, 0xD6, 0x0E, 0x2B, 0xD6, 0x0F, 0x34, 0xD6, 0x11, 0x4A, 0xD6, 0x12, 0x53,
-    0xD6, 0x13, 0x5D, 0xD6, 0x00, 0x83, 0x6F, 0x6D, 0x6D, 0x69, 0x74, 0x00, 0x46, 0x13, 0xD6, 0x12,
-    0x1A, 0xD6, 0x00, 0x84, 0x6F, 0x6D, 0x6D, 0x69, 0x74, 0x00, 0x06, 0x00, 0x84, 0x6D, 0x6D, 0x69,
-    0x74, 0x00, 0x12, 0x06, 0x00, 0x84, 0x6D, 0x6D, 0x69, 0x74, 0x00, 0x12, 0x06, 0x00, 0x84, 0x6D,
-    0x6D, 0x69, 0x74, 0x00, 0x46, 0x3B, 0xD6, 0x12, 0x42, 0xD6, 0x00, 0x84, 0x6F, 0x6D, 0x6D, 0x69,
-    0x74, 0x00, 0x06, 0x00, 0x84, 0x6D, 0x6D, 0x69, 0x74, 0x00, 0x12, 0x06, 0x00, 0x84, 0x6D, 0x6D,
-    0x69, 0x74, 0x00, 0x2C, 0x00, 0x84, 0x63, 0x6F, 0x6D, 0x6D, 0x69, 0x74, 0x00, 0x46, 0x64, 0xD6,
-    0x12, 0x6B, 0xD6, 0x00, 0x84, 0x6F, 0x6D, 0x6D, 0x69, 0x74, 0x00, 0x06, 0x00, 0x84, 0x6D, 0x6D,
-    0x69, 0x74, 0x00, 0x50, 0x7A, 0xD6, 0x12, 0x82, 0xD6, 0x00, 0x12, 0x06, 0x00, 0x83, 0x6D, 0x69,
-    0x74, 0x00, 0x06, 0x00, 0x83, 0x6D, 0x6D, 0x69, 0x74, 0x00, 0x10, 0x06, 0x00, 0x84, 0x6F, 0x6D,
-    0x6D, 0x69, 0x74, 0x00, 0x4B, 0x9B, 0xD6, 0x10, 0xA1, 0xD6, 0x00, 0x16, 0x00, 0x82, 0x69, 0x74,
-    0x00, 0x50, 0xA8, 0xD6, 0x12, 0xAF, 0xD6, 0x00, 0x12, 0x06, 0x00, 0x82, 0x69, 0x74, 0x00, 0x06,
-    0x00, 0x82, 0x6D, 0x69, 0x74, 0x00, 0x45, 0xC0, 0xD6, 0x0B, 0xC6, 0xD6, 0x10, 0xCC, 0xD6, 0x00,
-    0x04, 0x00, 0x81, 0x75, 0x74, 0x00, 0x16, 0x00, 0x82, 0x69, 0x74, 0x00, 0x10, 0x12, 0x06, 0x00,
-    0x82, 0x69, 0x74, 0x00, 0x4B, 0xDE, 0xD6, 0x10, 0xE4, 0xD6, 0x12, 0xEC, 0xD6, 0x00, 0x16, 0x00,
-    0x82, 0x69, 0x74, 0x00, 0x10, 0x12, 0x06, 0x00, 0x82, 0x69, 0x74, 0x00, 0x05, 0x04, 0x00, 0x81,
-    0x74, 0x00, 0x0B, 0x16, 0x00, 0x82, 0x69, 0x74, 0x00, 0x4A, 0x09, 0xD7, 0x0B, 0x10, 0xD7, 0x11,
-    0x17, 0xD7, 0x12, 0x28, 0xD7, 0x18, 0x2F, 0xD7, 0x00, 0x0C, 0x15, 0x00, 0x81, 0x68, 0x74, 0x00,
-    0x0A, 0x0C, 0x15, 0x00, 0x81, 0x74, 0x00, 0x44, 0x1E, 0xD7, 0x18, 0x23, 0xD7, 0x00, 0x1A, 0x00,
-    0x81, 0x74, 0x00, 0x06, 0x00, 0x81, 0x74, 0x00, 0x05, 0x04, 0x00, 0x81, 0x75, 0x74, 0x00, 0x12,
-    0x05, 0x04, 0x00, 0x81, 0x74, 0x00, 0x4C, 0x3D, 0xD7, 0x10, 0x43, 0xD7, 0x00, 0x0B, 0x16, 0x00,
-    0x81, 0x74, 0x00, 0x10, 0x12, 0x06, 0x00, 0x81, 0x69, 0x74, 0x00, 0x4C, 0x55, 0xD7, 0x10, 0x5E,
-    0xD7, 0x11, 0x65, 0xD7, 0x00, 0x10, 0x12, 0x06, 0x00, 0x82, 0x6D, 0x69, 0x74, 0x00, 0x12, 0x06,
-    0x00, 0x80, 0x69, 0x74, 0x00, 0x44, 0x6C, 0xD7, 0x18, 0x71, 0xD7, 0x00, 0x1A, 0x00, 0x81, 0x74,
-    0x00, 0x06, 0x00, 0x81, 0x74, 0x00, 0x74, 0x9E, 0xD7, 0x04, 0xB3, 0xD7, 0x05, 0x03, 0xD8, 0x0A,
-    0x16, 0xD8, 0x0B, 0x1D, 0xD8, 0x0C, 0x39, 0xD8, 0x0D, 0x53, 0xD8, 0x10, 0x66, 0xD8, 0x14, 0x79,
-    0xD8, 0x18, 0x80, 0xD8, 0x1A, 0xEF, 0xD8, 0x1C, 0xF6, 0xD8, 0x1D, 0xFD, 0xD8, 0x00, 0x44, 0xA5,
-    0xD7, 0x12, 0xAC, 0xD7, 0x00, 0x06, 0x00, 0x82, 0x6E, 0x27, 0x74, 0x00, 0x07, 0x00, 0x82, 0x6E,
-    0x27, 0x74, 0x00, 0x44, 0xC6, 0xD7, 0x08, 0xCC, 0xD7, 0x14, 0xD3, 0xD7, 0x16, 0xDA, 0xD7, 0x1A,
-    0xE1, 0xD7, 0x1D, 0xFC, 0xD7, 0x00, 0x1A, 0x00, 0x82, 0x6E, 0x74, 0x00, 0x1A, 0x00, 0x83, 0x61,
-    0x6E, 0x74, 0x00, 0x1A, 0x00, 0x83, 0x61, 0x6E, 0x74, 0x00, 0x1A, 0x00, 0x83, 0x61, 0x6E, 0x74,
-    0x00, 0x48, 0xEB, 0xD7, 0x14, 0xF1, 0xD7, 0x1A, 0xF7, 0xD7, 0x00, 0x84, 0x77, 0x61, 0x6E, 0x74,
-    0x00, 0x84, 0x77, 0x61, 0x6E, 0x74, 0x00, 0x83, 0x61, 0x6E, 0x74, 0x00, 0x1A, 0x00, 0x83, 0x61,
-    0x6E, 0x74, 0x00, 0x44, 0x0A, 0xD8, 0x18, 0x10, 0xD8, 0x00, 0x1A, 0x00, 0x82, 0x6E, 0x74, 0x00,
-    0x06, 0x00, 0x82, 0x6E, 0x74, 0x00, 0x0C, 0x15, 0x00, 0x81, 0x68, 0x74, 0x00, 0x44, 0x27, 0xD8,
-    0x0A, 0x2D, 0xD8, 0x18, 0x33, 0xD8, 0x00, 0x1A, 0x00, 0x82, 0x6E, 0x74, 0x00, 0x0C, 0x15, 0x00,
-    0x81, 0x74, 0x00, 0x06, 0x00, 0x82, 0x6E, 0x74, 0x00, 0x48, 0x43, 0xD8, 0x12, 0x48, 0xD8, 0x18,
-    0x4D, 0xD8, 0x00, 0x05, 0x00, 0x80, 0x67, 0x00, 0x0A, 0x00, 0x80, 0x67, 0x00, 0x06, 0x00, 0x82,
-    0x6E, 0x74, 0x00, 0x44, 0x5A, 0xD8, 0x18, 0x60, 0xD8, 0x00, 0x1A, 0x00, 0x82, 0x6E, 0x74, 0x00,
-    0x06, 0x00, 0x82, 0x6E, 0x74, 0x00, 0x44, 0x6D, 0xD8, 0x18, 0x73, 0xD8, 0x00, 0x1A, 0x00, 0x82,
-    0x6E, 0x74, 0x00, 0x06, 0x00, 0x82, 0x6E, 0x74, 0x00, 0x04, 0x1A, 0x00, 0x82, 0x6E, 0x74, 0x00,
-    0x46, 0x99, 0xD8, 0x07, 0xBE, 0xD8, 0x0C, 0xC5, 0xD8, 0x0D, 0xCC, 0xD8, 0x16, 0xD3, 0xD8, 0x19,
-    0xDA, 0xD8, 0x1B, 0xE1, 0xD8, 0x1C, 0xE8, 0xD8, 0x00, 0x47, 0xA6, 0xD8, 0x16, 0xAC, 0xD8, 0x19,
-    0xB2, 0xD8, 0x1B, 0xB8, 0xD8, 0x00, 0x84, 0x63, 0x75, 0x6E, 0x74, 0x00, 0x84, 0x63, 0x75, 0x6E,
-    0x74, 0x00, 0x84, 0x63, 0x75, 0x6E, 0x74, 0x00, 0x84, 0x63, 0x75, 0x6E, 0x74, 0x00, 0x06, 0x00,
-    0x83, 0x75, 0x6E, 0x74, 0x00, 0x06, 0x00, 0x83, 0x75, 0x6E, 0x74, 0x00, 0x06, 0x00, 0x83, 0x75,
-    0x6E, 0x74, 0x00, 0x06, 0x00, 0x83, 0x75, 0x6E, 0x74, 0x00, 0x06, 0x00, 0x83, 0x75, 0x6E, 0x74,
-    0x00, 0x06, 0x00, 0x83, 0x75, 0x6E, 0x74, 0x00, 0x06, 0x00, 0x83, 0x75, 0x6E, 0x74, 0x00, 0x04,
-    0x1A, 0x00, 0x82, 0x6E, 0x74, 0x00, 0x18, 0x06, 0x00, 0x82, 0x6E, 0x74, 0x00, 0x04, 0x1A, 0x00,
-    0x82, 0x6E, 0x74, 0x00, 0x0C, 0x0B, 0x16, 0x00, 0x81, 0x74, 0x00, 0x44, 0x12, 0xD9, 0x08, 0x2C,
-    0xD9, 0x00, 0x48, 0x19, 0xD9, 0x0B, 0x1F, 0xD9, 0x00, 0x15, 0x0A, 0x00, 0x81, 0x74, 0x00, 0x57,
-    0x26, 0xD9, 0x1A, 0x29, 0xD9, 0x00, 0x81, 0x74, 0x00, 0x81, 0x74, 0x00, 0x15, 0x0A, 0x00, 0x81,
-    0x61, 0x74, 0x00, 0x44, 0x58, 0xD9, 0x08, 0x97, 0xD9, 0x09, 0x9E, 0xD9, 0x0C, 0xA5, 0xD9, 0x11,
-    0xAB, 0xD9, 0x14, 0xBC, 0xD9, 0x15, 0xC3, 0xD9, 0x16, 0xC9, 0xD9, 0x17, 0xFD, 0xD9, 0x18, 0x04,
-    0xDA, 0x1A, 0x09, 0xDA, 0x1D, 0x10, 0xDA, 0x00, 0x52, 0x6B, 0xD9, 0x13, 0x72, 0xD9, 0x14, 0x7B,
-    0xD9, 0x16, 0x82, 0xD9, 0x1A, 0x89, 0xD9, 0x1D, 0x90, 0xD9, 0x00, 0x13, 0x00, 0x83, 0x61, 0x72,
-    0x74, 0x00, 0x12, 0x2C, 0x00, 0x84, 0x70, 0x61, 0x72, 0x74, 0x00, 0x13, 0x00, 0x83, 0x61, 0x72,
-    0x74, 0x00, 0x13, 0x00, 0x83, 0x61, 0x72, 0x74, 0x00, 0x13, 0x00, 0x83, 0x61, 0x72, 0x74, 0x00,
-    0x13, 0x00, 0x83, 0x61, 0x72, 0x74, 0x00, 0x04, 0x13, 0x00, 0x82, 0x72, 0x74, 0x00, 0x04, 0x13,
-    0x00, 0x82, 0x72, 0x74, 0x00, 0x08, 0x0B, 0x17, 0x00, 0x80, 0x00, 0x44, 0xB2, 0xD9, 0x18, 0xB7,
-    0xD9, 0x00, 0x1A, 0x00, 0x81, 0x74, 0x00, 0x06, 0x00, 0x81, 0x74, 0x00, 0x04, 0x13, 0x00, 0x82,
-    0x72, 0x74, 0x00, 0x04, 0x13, 0x00, 0x81, 0x74, 0x00, 0x44, 0xD9, 0xD9, 0x08, 0xE7, 0xD9, 0x0C,
-    0xEC, 0xD9, 0x12, 0xF3, 0xD9, 0x18, 0xF8, 0xD9, 0x00, 0x4F, 0xE0, 0xD9, 0x13, 0xE3, 0xD9, 0x00,
-    0x81, 0x74, 0x00, 0x82, 0x72, 0x74, 0x00, 0x05, 0x00, 0x81, 0x74, 0x00, 0x09, 0x00, 0x82, 0x72,
-    0x73, 0x74, 0x00, 0x10, 0x00, 0x81, 0x74, 0x00, 0x0D, 0x00, 0x81, 0x74, 0x00, 0x04, 0x13, 0x00,
-    0x82, 0x72, 0x74, 0x00, 0x12, 0x1C, 0x00, 0x80, 0x00, 0x04, 0x13, 0x00, 0x82, 0x72, 0x74, 0x00,
-    0x04, 0x13, 0x00, 0x82, 0x72, 0x74, 0x00, 0x44, 0x4B, 0xDA, 0x06, 0xD6, 0xDA, 0x07, 0xDD, 0xDA,
-    0x08, 0xFA, 0xDA, 0x09, 0x56, 0xDB, 0x0C, 0x6B, 0xDB, 0x0D, 0x73, 0xDB, 0x0F, 0x7A, 0xDB, 0x12,
-    0x81, 0xDB, 0x14, 0xCE, 0xDB, 0x15, 0xD5, 0xDB, 0x17, 0xB4, 0xDC, 0x18, 0xBC, 0xDC, 0x1A, 0x28,
-    0xDD, 0x1B, 0x4E, 0xDD, 0x1C, 0x7D, 0xDD, 0x1D, 0x84, 0xDD, 0x00, 0x44, 0x70, 0xDA, 0x08, 0x76,
-    0xDA, 0x0B, 0x7C, 0xDA, 0x0E, 0x81, 0xDA, 0x0F, 0x88, 0xDA, 0x12, 0x9D, 0xDA, 0x14, 0xAD, 0xDA,
-    0x15, 0xB4, 0xDA, 0x16, 0xBB, 0xDA, 0x18, 0xC2, 0xDA, 0x1A, 0xC8, 0xDA, 0x1D, 0xCF, 0xDA, 0x00,
-    0x0F, 0x00, 0x82, 0x73, 0x74, 0x00, 0x15, 0x0A, 0x00, 0x81, 0x74, 0x00, 0x1A, 0x00, 0x81, 0x74,
-    0x00, 0x0F, 0x00, 0x83, 0x61, 0x73, 0x74, 0x00, 0x4E, 0x8F, 0xDA, 0x12, 0x95, 0xDA, 0x00, 0x84,
-    0x6C, 0x61, 0x73, 0x74, 0x00, 0x2C, 0x00, 0x84, 0x6C, 0x61, 0x73, 0x74, 0x00, 0x4F, 0xA4, 0xDA,
-    0x10, 0xA9, 0xDA, 0x00, 0x83, 0x61, 0x73, 0x74, 0x00, 0x82, 0x73, 0x74, 0x00, 0x0F, 0x00, 0x83,
-    0x61, 0x73, 0x74, 0x00, 0x0C, 0x09, 0x00, 0x82, 0x73, 0x74, 0x00, 0x0F, 0x00, 0x83, 0x61, 0x73,
-    0x74, 0x00, 0x0D, 0x00, 0x82, 0x73, 0x74, 0x00, 0x0F, 0x00, 0x83, 0x61, 0x73, 0x74, 0x00, 0x0F,
-    0x00, 0x83, 0x61, 0x73, 0x74, 0x00, 0x04, 0x1B, 0x08, 0x00, 0x81, 0x74, 0x00, 0x52, 0xE7, 0xDA,
-    0x15, 0xED, 0xDA, 0x18, 0xF4, 0xDA, 0x00, 0x10, 0x00, 0x82, 0x73, 0x74, 0x00, 0x0C, 0x09, 0x00,
-    0x82, 0x73, 0x74, 0x00, 0x0D, 0x00, 0x82, 0x73, 0x74, 0x00, 0x45, 0x10, 0xDB, 0x07, 0x2C, 0xDB,
-    0x0A, 0x34, 0xDB, 0x0B, 0x3B, 0xDB, 0x11, 0x42, 0xDB, 0x18, 0x49, 0xDB, 0x1A, 0x4F, 0xDB, 0x00,
-    0x4A, 0x1A, 0xDB, 0x0B, 0x20, 0xDB, 0x19, 0x26, 0xDB, 0x00, 0x84, 0x62, 0x65, 0x73, 0x74, 0x00,
-    0x84, 0x62, 0x65, 0x73, 0x74, 0x00, 0x84, 0x62, 0x65, 0x73, 0x74, 0x00, 0x05, 0x2C, 0x00, 0x83,
-    0x65, 0x73, 0x74, 0x00, 0x05, 0x00, 0x83, 0x65, 0x73, 0x74, 0x00, 0x05, 0x00, 0x83, 0x65, 0x73,
-    0x74, 0x00, 0x05, 0x00, 0x83, 0x65, 0x73, 0x74, 0x00, 0x0D, 0x00, 0x82, 0x73, 0x74, 0x00, 0x05,
-    0x00, 0x83, 0x65, 0x73, 0x74, 0x00, 0x4C, 0x5D, 0xDB, 0x15, 0x64, 0xDB, 0x00, 0x09, 0x00, 0x82,
-    0x72, 0x73, 0x74, 0x00, 0x0C, 0x09, 0x00, 0x82, 0x73, 0x74, 0x00, 0x18, 0x0D, 0x2C, 0x00, 0x82,
-    0x73, 0x74, 0x00, 0x18, 0x0D, 0x00, 0x82, 0x73, 0x74, 0x00, 0x12, 0x10, 0x00, 0x82, 0x73, 0x74,
-    0x00, 0x4D, 0x91, 0xDB, 0x0E, 0x98, 0xDB, 0x0F, 0x9F, 0xDB, 0x10, 0xA6, 0xDB, 0x13, 0xC6, 0xDB,
-    0x00, 0x10, 0x00, 0x83, 0x6F, 0x73, 0x74, 0x00, 0x10, 0x00, 0x83, 0x6F, 0x73, 0x74, 0x00, 0x10,
-    0x00, 0x83, 0x6F, 0x73, 0x74, 0x00, 0x4D, 0xB0, 0xDB, 0x0E, 0xB6, 0xDB, 0x11, 0xBE, 0xDB, 0x00,
-    0x84, 0x6D, 0x6F, 0x73, 0x74, 0x00, 0x2C, 0x00, 0x84, 0x6D, 0x6F, 0x73, 0x74, 0x00, 0x2C, 0x00,
-    0x84, 0x6D, 0x6F, 0x73, 0x74, 0x00, 0x10, 0x2C, 0x00, 0x83, 0x6F, 0x73, 0x74, 0x00, 0x04, 0x0F,
-    0x00, 0x82, 0x73, 0x74, 0x00, 0x48, 0xEB, 0xDB, 0x09, 0xF3, 0xDB, 0x0C, 0xFC, 0xDB, 0x0E, 0x88,
-    0xDC, 0x12, 0x9C, 0xDC, 0x17, 0xA4, 0xDC, 0x18, 0xAC, 0xDC, 0x00, 0x0C, 0x09, 0x00, 0x83, 0x72,
-    0x73, 0x74, 0x00, 0x0C, 0x00, 0x84, 0x66, 0x69, 0x72, 0x73, 0x74, 0x00, 0x46, 0x18, 0xDC, 0x07,
-    0x1F, 0xDC, 0x09, 0x26, 0xDC, 0x0A, 0x5B, 0xDC, 0x0E, 0x62, 0xDC, 0x12, 0x6A, 0xDC, 0x15, 0x72,
-    0xDC, 0x18, 0x79, 0xDC, 0x19, 0x81, 0xDC, 0x00, 0x84, 0x66, 0x69, 0x72, 0x73, 0x74, 0x00, 0x84,
-    0x66, 0x69, 0x72, 0x73, 0x74, 0x00, 0x46, 0x36, 0xDC, 0x07, 0x3D, 0xDC, 0x0A, 0x46, 0xDC, 0x15,
-    0x4D, 0xDC, 0x19, 0x54, 0xDC, 0x00, 0x85, 0x66, 0x69, 0x72, 0x73, 0x74, 0x00, 0x2C, 0x00, 0x85,
-    0x66, 0x69, 0x72, 0x73, 0x74, 0x00, 0x85, 0x66, 0x69, 0x72, 0x73, 0x74, 0x00, 0x85, 0x66, 0x69,
-    0x72, 0x73, 0x74, 0x00, 0x85, 0x66, 0x69, 0x72, 0x73, 0x74, 0x00, 0x84, 0x66, 0x69, 0x72, 0x73,
-    0x74, 0x00, 0x09, 0x00, 0x84, 0x69, 0x72, 0x73, 0x74, 0x00, 0x09, 0x00, 0x84, 0x69, 0x72, 0x73,
-    0x74, 0x00, 0x84, 0x66, 0x69, 0x72, 0x73, 0x74, 0x00, 0x09, 0x00, 0x84, 0x69, 0x72, 0x73, 0x74,
-    0x00, 0x84, 0x66, 0x69, 0x72, 0x73, 0x74, 0x00, 0x49, 0x8F, 0xDC, 0x0C, 0x95, 0xDC, 0x00, 0x83,
-    0x69, 0x72, 0x73, 0x74, 0x00, 0x09, 0x00, 0x83, 0x72, 0x73, 0x74, 0x00, 0x0C, 0x09, 0x00, 0x83,
-    0x72, 0x73, 0x74, 0x00, 0x0C, 0x09, 0x00, 0x83, 0x72, 0x73, 0x74, 0x00, 0x0C, 0x09, 0x00, 0x83,
-    0x72, 0x73, 0x74, 0x00, 0x0C, 0x09, 0x00, 0x82, 0x72, 0x73, 0x74, 0x00, 0x4B, 0xD2, 0xDC, 0x0C,
-    0xD9, 0xDC, 0x0D, 0xE0, 0xDC, 0x0E, 0x0D, 0xDD, 0x10, 0x14, 0xDD, 0x18, 0x1B, 0xDD, 0x1C, 0x21,
-    0xDD, 0x00, 0x0D, 0x00, 0x83, 0x75, 0x73, 0x74, 0x00, 0x0D, 0x00, 0x83, 0x75, 0x73, 0x74, 0x00,
-    0x4B, 0xF0, 0xDC, 0x0D, 0xF6, 0xDC, 0x0E, 0xFB, 0xDC, 0x10, 0x01, 0xDD, 0x18, 0x07, 0xDD, 0x00,
-    0x84, 0x6A, 0x75, 0x73, 0x74, 0x00, 0x83, 0x75, 0x73, 0x74, 0x00, 0x84, 0x6A, 0x75, 0x73, 0x74,
-    0x00, 0x84, 0x6A, 0x75, 0x73, 0x74, 0x00, 0x84, 0x6A, 0x75, 0x73, 0x74, 0x00, 0x0D, 0x00, 0x83,
-    0x75, 0x73, 0x74, 0x00, 0x0D, 0x00, 0x83, 0x75, 0x73, 0x74, 0x00, 0x0D, 0x00, 0x82, 0x73, 0x74,
-    0x00, 0x0D, 0x00, 0x83, 0x75, 0x73, 0x74, 0x00, 0x44, 0x35, 0xDD, 0x08, 0x3B, 0xDD, 0x15, 0x41,
-    0xDD, 0x18, 0x48, 0xDD, 0x00, 0x0F, 0x00, 0x82, 0x73, 0x74, 0x00, 0x05, 0x00, 0x82, 0x73, 0x74,
-    0x00, 0x0C, 0x09, 0x00, 0x82, 0x73, 0x74, 0x00, 0x0D, 0x00, 0x82, 0x73, 0x74, 0x00, 0x44, 0x5E,
-    0xDD, 0x08, 0x64, 0xDD, 0x12, 0x6A, 0xDD, 0x15, 0x70, 0xDD, 0x18, 0x77, 0xDD, 0x00, 0x0F, 0x00,
-    0x82, 0x73, 0x74, 0x00, 0x05, 0x00, 0x82, 0x73, 0x74, 0x00, 0x10, 0x00, 0x82, 0x73, 0x74, 0x00,
-    0x0C, 0x09, 0x00, 0x82, 0x73, 0x74, 0x00, 0x0D, 0x00, 0x82, 0x73, 0x74, 0x00, 0x18, 0x0D, 0x00,
-    0x82, 0x73, 0x74, 0x00, 0x04, 0x0F, 0x00, 0x82, 0x73, 0x74, 0x00, 0x45, 0xA1, 0xDD, 0x0C, 0xAA,
-    0xDD, 0x0D, 0xC7, 0xDD, 0x0F, 0xCF, 0xDD, 0x12, 0xD7, 0xDD, 0x13, 0xD1, 0xDE, 0x1C, 0xE6, 0xDE,
-    0x00, 0x12, 0x04, 0x00, 0x83, 0x62, 0x6F, 0x75, 0x74, 0x00, 0x45, 0xB4, 0xDD, 0x0B, 0xBB, 0xDD,
-    0x12, 0xC0, 0xDD, 0x00, 0x04, 0x00, 0x82, 0x6F, 0x75, 0x74, 0x00, 0x16, 0x00, 0x81, 0x74, 0x00,
-    0x05, 0x04, 0x00, 0x82, 0x75, 0x74, 0x00, 0x12, 0x05, 0x04, 0x00, 0x82, 0x75, 0x74, 0x00, 0x12,
-    0x05, 0x04, 0x00, 0x82, 0x75, 0x74, 0x00, 0x44, 0xF3, 0xDD, 0x05, 0xFC, 0xDD, 0x0A, 0x7D, 0xDE,
-    0x0B, 0x85, 0xDE, 0x0C, 0x9B, 0xDE, 0x0F, 0xA3, 0xDE, 0x11, 0xAB, 0xDE, 0x13, 0xC1, 0xDE, 0x19,
-    0xC9, 0xDE, 0x00, 0x05, 0x00, 0x84, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x00, 0x44, 0x18, 0xDE, 0x0A,
-    0x41, 0xDE, 0x0B, 0x49, 0xDE, 0x11, 0x51, 0xDE, 0x14, 0x59, 0xDE, 0x16, 0x60, 0xDE, 0x19, 0x67,
-    0xDE, 0x1A, 0x6F, 0xDE, 0x1D, 0x76, 0xDE, 0x00, 0x54, 0x25, 0xDE, 0x16, 0x2C, 0xDE, 0x1A, 0x33,
-    0xDE, 0x1D, 0x3A, 0xDE, 0x00, 0x85, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x00, 0x85, 0x61, 0x62, 0x6F,
-    0x75, 0x74, 0x00, 0x85, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x00, 0x85, 0x61, 0x62, 0x6F, 0x75, 0x74,
-    0x00, 0x04, 0x00, 0x84, 0x62, 0x6F, 0x75, 0x74, 0x00, 0x04, 0x00, 0x84, 0x62, 0x6F, 0x75, 0x74,
-    0x00, 0x04, 0x00, 0x84, 0x62, 0x6F, 0x75, 0x74, 0x00, 0x84, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x00,
-    0x84, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x00, 0x04, 0x00, 0x84, 0x62, 0x6F, 0x75, 0x74, 0x00, 0x84,
-    0x61, 0x62, 0x6F, 0x75, 0x74, 0x00, 0x84, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x00, 0x05, 0x04, 0x00,
-    0x83, 0x6F, 0x75, 0x74, 0x00, 0x44, 0x8C, 0xDE, 0x05, 0x94, 0xDE, 0x00, 0x2C, 0x00, 0x83, 0x62,
-    0x6F, 0x75, 0x74, 0x00, 0x04, 0x00, 0x83, 0x6F, 0x75, 0x74, 0x00, 0x05, 0x04, 0x00, 0x83, 0x6F,
-    0x75, 0x74, 0x00, 0x05, 0x04, 0x00, 0x83, 0x6F, 0x75, 0x74, 0x00, 0x44, 0xB2, 0xDE, 0x05, 0xBA,
-    0xDE, 0x00, 0x2C, 0x00, 0x83, 0x62, 0x6F, 0x75, 0x74, 0x00, 0x04, 0x00, 0x83, 0x6F, 0x75, 0x74,
-    0x00, 0x05, 0x04, 0x00, 0x83, 0x6F, 0x75, 0x74, 0x00, 0x05, 0x04, 0x00, 0x83, 0x6F, 0x75, 0x74,
-    0x00, 0x45, 0xD8, 0xDE, 0x12, 0xDF, 0xDE, 0x00, 0x04, 0x00, 0x82, 0x6F, 0x75, 0x74, 0x00, 0x05,
-    0x04, 0x00, 0x82, 0x75, 0x74, 0x00, 0x12, 0x05, 0x04, 0x00, 0x82, 0x75, 0x74, 0x00, 0x44, 0xF5,
-    0xDE, 0x06, 0xFC, 0xDE, 0x00, 0x1B, 0x08, 0x00, 0x81, 0x63, 0x74, 0x00, 0x04, 0x1B, 0x08, 0x00,
-    0x81, 0x74, 0x00, 0x44, 0x10, 0xDF, 0x08, 0x2A, 0xDF, 0x15, 0x31, 0xDF, 0x16, 0x38, 0xDF, 0x00,
-    0x48, 0x17, 0xDF, 0x0B, 0x1D, 0xDF, 0x00, 0x15, 0x0A, 0x00, 0x81, 0x74, 0x00, 0x57, 0x24, 0xDF,
-    0x1A, 0x27, 0xDF, 0x00, 0x81, 0x74, 0x00, 0x81, 0x74, 0x00, 0x15, 0x0A, 0x00, 0x81, 0x61, 0x74,
-    0x00, 0x0C, 0x09, 0x00, 0x81, 0x73, 0x74, 0x00, 0x44, 0x48, 0xDF, 0x08, 0x4D, 0xDF, 0x12, 0x52,
-    0xDF, 0x15, 0x57, 0xDF, 0x18, 0x5D, 0xDF, 0x00, 0x0F, 0x00, 0x81, 0x74, 0x00, 0x05, 0x00, 0x81,
-    0x74, 0x00, 0x10, 0x00, 0x81, 0x74, 0x00, 0x0C, 0x09, 0x00, 0x81, 0x74, 0x00, 0x0D, 0x00, 0x81,
-    0x74, 0x00, 0x44, 0x6F, 0xDF, 0x06, 0x76, 0xDF, 0x15, 0x7D, 0xDF, 0x16, 0x84, 0xDF, 0x00, 0x1B,
-    0x08, 0x00, 0x81, 0x63, 0x74, 0x00, 0x04, 0x1B, 0x08, 0x00, 0x81, 0x74, 0x00, 0x0C, 0x09, 0x00,
-    0x81, 0x73, 0x74, 0x00, 0x44, 0x94, 0xDF, 0x08, 0x99, 0xDF, 0x12, 0x9E, 0xDF, 0x15, 0xA3, 0xDF,
-    0x18, 0xA9, 0xDF, 0x00, 0x0F, 0x00, 0x81, 0x74, 0x00, 0x05, 0x00, 0x81, 0x74, 0x00, 0x10, 0x00,
-    0x81, 0x74, 0x00, 0x0C, 0x09, 0x00, 0x81, 0x74, 0x00, 0x0D, 0x00, 0x81, 0x74, 0x00, 0x44, 0xCA,
-    0xDF, 0x08, 0xD9, 0xDF, 0x0A, 0xDE, 0xDF, 0x0C, 0xE5, 0xDF, 0x0F, 0xEB, 0xDF, 0x11, 0xF0, 0xDF,
-    0x12, 0x08, 0xE0, 0x15, 0x0F, 0xE0, 0x16, 0x15, 0xE0, 0x00, 0x0B, 0x00, 0x57, 0xD3, 0xDF, 0x1A,
-    0xD6, 0xDF, 0x00, 0x81, 0x74, 0x00, 0x81, 0x74, 0x00, 0x0B, 0x17, 0x00, 0x80, 0x00, 0x0C, 0x15,
-    0x00, 0x81, 0x68, 0x74, 0x00, 0x0B, 0x16, 0x00, 0x81, 0x74, 0x00, 0x11, 0x12, 0x00, 0x80, 0x00,
-    0x44, 0xF7, 0xDF, 0x18, 0x03, 0xE0, 0x00, 0x50, 0xFE, 0xDF, 0x1A, 0x00, 0xE0, 0x00, 0x80, 0x00,
-    0x81, 0x74, 0x00, 0x06, 0x00, 0x81, 0x74, 0x00, 0x05, 0x04, 0x00, 0x81, 0x75, 0x74, 0x00, 0x04,
-    0x13, 0x00, 0x81, 0x74, 0x00, 0x44, 0x22, 0xE0, 0x08, 0x27, 0xE0, 0x12, 0x2C, 0xE0, 0x18, 0x31,
-    0xE0, 0x00, 0x0F, 0x00, 0x81, 0x74, 0x00, 0x05, 0x00, 0x81, 0x74, 0x00, 0x10, 0x00, 0x81, 0x74,
-    0x00, 0x0D, 0x00, 0x81, 0x74, 0x00, 0x44, 0x3D, 0xE0, 0x08, 0x57, 0xE0, 0x00, 0x48, 0x44, 0xE0,
-    0x0B, 0x4A, 0xE0, 0x00, 0x15, 0x0A, 0x00, 0x81, 0x74, 0x00, 0x57, 0x51, 0xE0, 0x1A, 0x54, 0xE0,
-    0x00, 0x81, 0x74, 0x00, 0x81, 0x74, 0x00, 0x15, 0x0A, 0x00, 0x81, 0x61, 0x74, 0x00, 0x55, 0x65,
-    0xE0, 0x1C, 0x6C, 0xE0, 0x00, 0x08, 0x19, 0x08, 0x00, 0x80, 0x79, 0x00, 0x48, 0x79, 0xE0, 0x0F,
-    0x7E, 0xE0, 0x11, 0x83, 0xE0, 0x15, 0x88, 0xE0, 0x00, 0x0B, 0x17, 0x00, 0x80, 0x00, 0x11, 0x12,
-    0x00, 0x80, 0x00, 0x04, 0x10, 0x00, 0x80, 0x00, 0x08, 0x19, 0x00, 0x80, 0x00, 0x46, 0x97, 0xE0,
-    0x0A, 0x9E, 0xE0, 0x11, 0xBA, 0xE0, 0x00, 0x0C, 0x16, 0x04, 0x05, 0x00, 0x80, 0x00, 0x11, 0x00,
-    0x4C, 0xA7, 0xE0, 0x12, 0xB6, 0xE0, 0x00, 0x48, 0xAE, 0xE0, 0x12, 0xB2, 0xE0, 0x00, 0x05, 0x00,
-    0x80, 0x00, 0x0A, 0x00, 0x80, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x0C, 0x00, 0x48, 0xC3, 0xE0, 0x12,
-    0xC8, 0xE0, 0x00, 0x05, 0x00, 0x80, 0x67, 0x00, 0x0A, 0x00, 0x80, 0x67, 0x00, 0x44, 0xF2, 0xE0,
-    0x06, 0xF9, 0xE0, 0x08, 0x00, 0xE1, 0x0A, 0x68, 0xE1, 0x0C, 0x70, 0xE1, 0x0F, 0x77, 0xE1, 0x12,
-    0x8A, 0xE1, 0x14, 0x27, 0xE2, 0x15, 0x2E, 0xE2, 0x16, 0x41, 0xE2, 0x17, 0x7A, 0xE2, 0x1C, 0x81,
-    0xE2, 0x00, 0x12, 0x11, 0x0E, 0x00, 0x81, 0x77, 0x00, 0x11, 0x0C, 0x16, 0x00, 0x80, 0x65, 0x00,
-    0x46, 0x1C, 0xE1, 0x07, 0x22, 0xE1, 0x0E, 0x27, 0xE1, 0x0F, 0x2C, 0xE1, 0x10, 0x32, 0xE1, 0x11,
-    0x41, 0xE1, 0x12, 0x4C, 0xE1, 0x15, 0x52, 0xE1, 0x16, 0x57, 0xE1, 0x00, 0x11, 0x0C, 0x16, 0x00,
-    0x80, 0x00, 0x04, 0x10, 0x00, 0x80, 0x00, 0x04, 0x17, 0x00, 0x80, 0x00, 0x0C, 0x0B, 0x1A, 0x00,
-    0x80, 0x00, 0x44, 0x39, 0xE1, 0x12, 0x3D, 0xE1, 0x00, 0x16, 0x00, 0x80, 0x00, 0x06, 0x00, 0x80,
-    0x00, 0x12, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x80, 0x73, 0x00, 0x11, 0x0E, 0x00, 0x81,
-    0x77, 0x00, 0x12, 0x10, 0x00, 0x80, 0x00, 0x48, 0x5E, 0xE1, 0x12, 0x63, 0xE1, 0x00, 0x0B, 0x17,
-    0x00, 0x80, 0x00, 0x0B, 0x17, 0x00, 0x80, 0x00, 0x11, 0x0C, 0x0B, 0x17, 0x00, 0x80, 0x73, 0x00,
-    0x12, 0x11, 0x0E, 0x00, 0x81, 0x77, 0x00, 0x4C, 0x7E, 0xE1, 0x12, 0x84, 0xE1, 0x00, 0x0B, 0x1A,
-    0x00, 0x80, 0x65, 0x00, 0x11, 0x0E, 0x00, 0x81, 0x77, 0x00, 0x45, 0xA3, 0xE1, 0x0B, 0xAA, 0xE1,
-    0x0C, 0xB1, 0xE1, 0x0D, 0xB8, 0xE1, 0x0F, 0xBF, 0xE1, 0x10, 0xC6, 0xE1, 0x11, 0xCD, 0xE1, 0x13,
-    0x20, 0xE2, 0x00, 0x11, 0x0E, 0x00, 0x82, 0x6F, 0x77, 0x00, 0x11, 0x0E, 0x00, 0x82, 0x6F, 0x77,
-    0x00, 0x11, 0x0E, 0x00, 0x82, 0x6F, 0x77, 0x00, 0x11, 0x0E, 0x00, 0x82, 0x6F, 0x77, 0x00, 0x11,
-    0x0E, 0x00, 0x82, 0x6F, 0x77, 0x00, 0x11, 0x0E, 0x00, 0x82, 0x6F, 0x77, 0x00, 0x45, 0xE3, 0xE1,
-    0x0B, 0xEA, 0xE1, 0x0C, 0xF1, 0xE1, 0x0D, 0xF8, 0xE1, 0x0E, 0xFF, 0xE1, 0x0F, 0x12, 0xE2, 0x10,
-    0x19, 0xE2, 0x00, 0x0E, 0x00, 0x83, 0x6E, 0x6F, 0x77, 0x00, 0x0E, 0x00, 0x83, 0x6E, 0x6F, 0x77,
-    0x00, 0x0E, 0x00, 0x83, 0x6E, 0x6F, 0x77, 0x00, 0x0E, 0x00, 0x83, 0x6E, 0x6F, 0x77, 0x00, 0x4C,
-    0x06, 0xE2, 0x0D, 0x0C, 0xE2, 0x00, 0x84, 0x6B, 0x6E, 0x6F, 0x77, 0x00, 0x84, 0x6B, 0x6E, 0x6F,
-    0x77, 0x00, 0x0E, 0x00, 0x83, 0x6E, 0x6F, 0x77, 0x00, 0x0E, 0x00, 0x83, 0x6E, 0x6F, 0x77, 0x00,
-    0x11, 0x0E, 0x00, 0x82, 0x6F, 0x77, 0x00, 0x12, 0x11, 0x0E, 0x00, 0x81, 0x77, 0x00, 0x44, 0x35,
-    0xE2, 0x08, 0x3B, 0xE2, 0x00, 0x08, 0x1C, 0x00, 0x80, 0x73, 0x00, 0x0B, 0x1A, 0x00, 0x80, 0x65,
-    0x00, 0x74, 0x4E, 0xE2, 0x08, 0x53, 0xE2, 0x12, 0x63, 0xE2, 0x15, 0x74, 0xE2, 0x00, 0x17, 0x0C,
-    0x00, 0x80, 0x00, 0x4B, 0x5A, 0xE2, 0x12, 0x5F, 0xE2, 0x00, 0x17, 0x00, 0x80, 0x65, 0x00, 0x07,
-    0x00, 0x80, 0x00, 0x4B, 0x6A, 0xE2, 0x11, 0x6F, 0xE2, 0x00, 0x17, 0x00, 0x80, 0x65, 0x00, 0x0E,
-    0x00, 0x81, 0x77, 0x00, 0x04, 0x08, 0x1C, 0x00, 0x80, 0x00, 0x04, 0x17, 0x16, 0x00, 0x80, 0x65,
-    0x00, 0x04, 0x1A, 0x0F, 0x04, 0x00, 0x80, 0x73, 0x00, 0x46, 0xA8, 0xE2, 0x07, 0xAF, 0xE2, 0x08,
-    0x01, 0xE3, 0x0A, 0x0D, 0xE3, 0x0C, 0x15, 0xE3, 0x0F, 0x1C, 0xE3, 0x11, 0x38, 0xE3, 0x15, 0x3F,
-    0xE3, 0x16, 0x46, 0xE3, 0x1C, 0x68, 0xE3, 0x00, 0x0C, 0x16, 0x04, 0x05, 0x00, 0x80, 0x00, 0x48,
-    0xBF, 0xE2, 0x0C, 0xCE, 0xE2, 0x0F, 0xD3, 0xE2, 0x11, 0xEC, 0xE2, 0x12, 0xFC, 0xE2, 0x00, 0x48,
-    0xC6, 0xE2, 0x16, 0xCA, 0xE2, 0x00, 0x11, 0x00, 0x80, 0x00, 0x18, 0x00, 0x80, 0x00, 0x04, 0x16,
-    0x00, 0x80, 0x00, 0x55, 0xDA, 0xE2, 0x18, 0xDF, 0xE2, 0x00, 0x12, 0x1A, 0x00, 0x80, 0x00, 0x12,
-    0x00, 0x46, 0xE8, 0xE2, 0x1A, 0xEA, 0xE2, 0x00, 0x80, 0x00, 0x80, 0x00, 0x4C, 0xF3, 0xE2, 0x18,
-    0xF7, 0xE2, 0x00, 0x09, 0x00, 0x80, 0x00, 0x12, 0x16, 0x00, 0x80, 0x00, 0x12, 0x0A, 0x00, 0x80,
-    0x00, 0x11, 0x12, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x80, 0x73, 0x00, 0x11, 0x0C, 0x0B,
-    0x17, 0x00, 0x80, 0x73, 0x00, 0x16, 0x04, 0x05, 0x00, 0x80, 0x63, 0x00, 0x55, 0x23, 0xE3, 0x18,
-    0x29, 0xE3, 0x00, 0x12, 0x1A, 0x00, 0x80, 0x64, 0x00, 0x12, 0x00, 0x46, 0x32, 0xE3, 0x1A, 0x35,
-    0xE3, 0x00, 0x80, 0x64, 0x00, 0x80, 0x64, 0x00, 0x18, 0x12, 0x16, 0x00, 0x80, 0x64, 0x00, 0x04,
-    0x08, 0x1C, 0x00, 0x80, 0x73, 0x00, 0x74, 0x53, 0xE3, 0x08, 0x58, 0xE3, 0x0C, 0x5D, 0xE3, 0x15,
-    0x62, 0xE3, 0x00, 0x17, 0x0C, 0x00, 0x80, 0x00, 0x12, 0x07, 0x00, 0x80, 0x00, 0x0B, 0x17, 0x00,
-    0x80, 0x00, 0x04, 0x08, 0x1C, 0x00, 0x80, 0x00, 0x04, 0x1A, 0x0F, 0x04, 0x00, 0x80, 0x73, 0x00,
-    0x74, 0xAD, 0xE3, 0x04, 0xC0, 0xE3, 0x05, 0xC7, 0xE3, 0x06, 0xDD, 0xE3, 0x07, 0xF0, 0xE3, 0x08,
-    0xF7, 0xE3, 0x09, 0xBE, 0xE4, 0x0A, 0xDE, 0xE4, 0x0B, 0x22, 0xE7, 0x0D, 0x75, 0xE7, 0x0E, 0x7C,
-    0xE7, 0x0F, 0x91, 0xE7, 0x10, 0x9A, 0xE9, 0x11, 0xA1, 0xE9, 0x12, 0x5B, 0xEA, 0x15, 0x89, 0xEA,
-    0x16, 0xCF, 0xEB, 0x17, 0xD6, 0xEB, 0x18, 0x7A, 0xEC, 0x19, 0xA8, 0xEC, 0x00, 0x11, 0x00, 0x44,
-    0xB6, 0xE3, 0x12, 0xBB, 0xE3, 0x00, 0x06, 0x00, 0x80, 0x74, 0x00, 0x07, 0x00, 0x80, 0x74, 0x00,
-    0x08, 0x15, 0x0A, 0x00, 0x80, 0x74, 0x00, 0x51, 0xCE, 0xE3, 0x12, 0xD4, 0xE3, 0x00, 0x04, 0x10,
-    0x00, 0x81, 0x79, 0x00, 0x0F, 0x12, 0x08, 0x0A, 0x00, 0x81, 0x67, 0x79, 0x00, 0x4C, 0xE4, 0xE3,
-    0x17, 0xEA, 0xE3, 0x00, 0x0B, 0x1A, 0x00, 0x80, 0x68, 0x00, 0x0C, 0x05, 0x00, 0x80, 0x68, 0x00,
-    0x08, 0x0B, 0x17, 0x00, 0x81, 0x79, 0x00, 0x45, 0x16, 0xE4, 0x07, 0x1D, 0xE4, 0x08, 0x24, 0xE4,
-    0x0A, 0x2B, 0xE4, 0x0B, 0x32, 0xE4, 0x0D, 0x8E, 0xE4, 0x11, 0x95, 0xE4, 0x15, 0x9C, 0xE4, 0x1A,
-    0xB0, 0xE4, 0x1C, 0xB7, 0xE4, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x65, 0x79, 0x00, 0x0B, 0x17, 0x00,
-    0x82, 0x65, 0x79, 0x00, 0x19, 0x08, 0x00, 0x81, 0x72, 0x79, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x65,
-    0x79, 0x00, 0x45, 0x48, 0xE4, 0x0A, 0x4F, 0xE4, 0x0D, 0x56, 0xE4, 0x11, 0x5D, 0xE4, 0x15, 0x64,
-    0xE4, 0x17, 0x6B, 0xE4, 0x1C, 0x87, 0xE4, 0x00, 0x17, 0x00, 0x83, 0x68, 0x65, 0x79, 0x00, 0x17,
-    0x00, 0x83, 0x68, 0x65, 0x79, 0x00, 0x17, 0x00, 0x83, 0x68, 0x65, 0x79, 0x00, 0x17, 0x00, 0x83,
-    0x68, 0x65, 0x79, 0x00, 0x17, 0x00, 0x83, 0x68, 0x65, 0x79, 0x00, 0x4A, 0x75, 0xE4, 0x15, 0x7B,
-    0xE4, 0x1C, 0x81, 0xE4, 0x00, 0x84, 0x74, 0x68, 0x65, 0x79, 0x00, 0x84, 0x74, 0x68, 0x65, 0x79,
-    0x00, 0x84, 0x74, 0x68, 0x65, 0x79, 0x00, 0x17, 0x00, 0x83, 0x68, 0x65, 0x79, 0x00, 0x0B, 0x17,
-    0x00, 0x82, 0x65, 0x79, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x65, 0x79, 0x00, 0x4B, 0xA3, 0xE4, 0x19,
-    0xA9, 0xE4, 0x00, 0x17, 0x00, 0x82, 0x65, 0x79, 0x00, 0x08, 0x00, 0x82, 0x65, 0x72, 0x79, 0x00,
-    0x0B, 0x17, 0x00, 0x82, 0x65, 0x79, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x65, 0x79, 0x00, 0x48, 0xC8,
-    0xE4, 0x12, 0xCF, 0xE4, 0x15, 0xD8, 0xE4, 0x00, 0x19, 0x08, 0x00, 0x81, 0x72, 0x79, 0x00, 0x0F,
-    0x12, 0x08, 0x0A, 0x00, 0x81, 0x67, 0x79, 0x00, 0x08, 0x19, 0x00, 0x81, 0x79, 0x00, 0x45, 0xFA,
-    0xE4, 0x09, 0x04, 0xE5, 0x0B, 0x0E, 0xE5, 0x0C, 0x18, 0xE5, 0x0F, 0x31, 0xE5, 0x12, 0x63, 0xE5,
-    0x13, 0xF5, 0xE6, 0x17, 0x0E, 0xE7, 0x19, 0x18, 0xE7, 0x00, 0x12, 0x0F, 0x12, 0x08, 0x0A, 0x00,
-    0x82, 0x67, 0x79, 0x00, 0x12, 0x0F, 0x12, 0x08, 0x0A, 0x00, 0x82, 0x67, 0x79, 0x00, 0x12, 0x0F,
-    0x12, 0x08, 0x0A, 0x00, 0x82, 0x67, 0x79, 0x00, 0x4F, 0x1F, 0xE5, 0x12, 0x28, 0xE5, 0x00, 0x12,
-    0x08, 0x0A, 0x00, 0x82, 0x6F, 0x67, 0x79, 0x00, 0x0F, 0x12, 0x08, 0x0A, 0x00, 0x82, 0x67, 0x79,
-    0x00, 0x4F, 0x38, 0xE5, 0x12, 0x41, 0xE5, 0x00, 0x12, 0x08, 0x0A, 0x00, 0x82, 0x6F, 0x67, 0x79,
-    0x00, 0x48, 0x4B, 0xE5, 0x0F, 0x52, 0xE5, 0x12, 0x5A, 0xE5, 0x00, 0x0A, 0x00, 0x81, 0x6F, 0x67,
-    0x79, 0x00, 0x12, 0x08, 0x0A, 0x00, 0x82, 0x67, 0x79, 0x00, 0x08, 0x0A, 0x00, 0x83, 0x6C, 0x6F,
-    0x67, 0x79, 0x00, 0x4C, 0x73, 0xE5, 0x0E, 0x7D, 0xE5, 0x0F, 0x96, 0xE5, 0x12, 0xB9, 0xE6, 0x13,
-    0xEB, 0xE6, 0x00, 0x0F, 0x12, 0x08, 0x0A, 0x00, 0x83, 0x6F, 0x67, 0x79, 0x00, 0x4F, 0x84, 0xE5,
-    0x12, 0x8D, 0xE5, 0x00, 0x12, 0x08, 0x0A, 0x00, 0x83, 0x6F, 0x67, 0x79, 0x00, 0x08, 0x0A, 0x00,
-    0x83, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x48, 0xA9, 0xE5, 0x0C, 0xC1, 0xE5, 0x0E, 0xDA, 0xE5, 0x0F,
-    0xE4, 0xE5, 0x12, 0xFC, 0xE5, 0x13, 0xA0, 0xE6, 0x00, 0x4A, 0xB0, 0xE5, 0x12, 0xB7, 0xE5, 0x00,
-    0x83, 0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x0A, 0x00, 0x85, 0x65, 0x6F, 0x6C, 0x6F, 0x67, 0x79,
-    0x00, 0x48, 0xC8, 0xE5, 0x12, 0xD1, 0xE5, 0x00, 0x0A, 0x00, 0x84, 0x6F, 0x6C, 0x6F, 0x67, 0x79,
-    0x00, 0x08, 0x0A, 0x00, 0x84, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x12, 0x08, 0x0A, 0x00, 0x84, 0x6C,
-    0x6F, 0x67, 0x79, 0x00, 0x48, 0xEB, 0xE5, 0x12, 0xF4, 0xE5, 0x00, 0x0A, 0x00, 0x84, 0x6F, 0x6C,
-    0x6F, 0x67, 0x79, 0x00, 0x08, 0x0A, 0x00, 0x83, 0x6F, 0x67, 0x79, 0x00, 0x47, 0x18, 0xE6, 0x08,
-    0x30, 0xE6, 0x0A, 0x3B, 0xE6, 0x0C, 0x45, 0xE6, 0x0F, 0x50, 0xE6, 0x12, 0x5B, 0xE6, 0x13, 0x64,
-    0xE6, 0x15, 0x6E, 0xE6, 0x1A, 0x88, 0xE6, 0x00, 0x48, 0x1F, 0xE6, 0x0A, 0x28, 0xE6, 0x00, 0x0A,
-    0x00, 0x85, 0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x85, 0x65, 0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00,
-    0x2C, 0x00, 0x85, 0x67, 0x65, 0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x2C, 0x00, 0x84, 0x65, 0x6F,
-    0x6C, 0x6F, 0x67, 0x79, 0x00, 0x08, 0x0A, 0x2C, 0x00, 0x85, 0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00,
-    0x08, 0x0A, 0x2C, 0x00, 0x85, 0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x08, 0x0A, 0x00, 0x84, 0x6C,
-    0x6F, 0x67, 0x79, 0x00, 0x08, 0x0A, 0x00, 0x85, 0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x48, 0x75,
-    0xE6, 0x0A, 0x7E, 0xE6, 0x00, 0x0A, 0x00, 0x85, 0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x2C, 0x00,
-    0x85, 0x65, 0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x48, 0x8F, 0xE6, 0x0A, 0x98, 0xE6, 0x00, 0x0A,
-    0x00, 0x85, 0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x85, 0x65, 0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00,
-    0x48, 0xA7, 0xE6, 0x12, 0xB0, 0xE6, 0x00, 0x0A, 0x00, 0x84, 0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00,
-    0x08, 0x0A, 0x00, 0x84, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x48, 0xC3, 0xE6, 0x0F, 0xCB, 0xE6, 0x12,
-    0xE2, 0xE6, 0x00, 0x0A, 0x00, 0x82, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x48, 0xD2, 0xE6, 0x12, 0xDB,
-    0xE6, 0x00, 0x0A, 0x00, 0x84, 0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x08, 0x0A, 0x00, 0x82, 0x67,
-    0x79, 0x00, 0x08, 0x0A, 0x00, 0x83, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x0F, 0x12, 0x08, 0x0A, 0x00,
-    0x83, 0x6F, 0x67, 0x79, 0x00, 0x4F, 0xFC, 0xE6, 0x12, 0x05, 0xE7, 0x00, 0x12, 0x08, 0x0A, 0x00,
-    0x82, 0x6F, 0x67, 0x79, 0x00, 0x0F, 0x12, 0x08, 0x0A, 0x00, 0x82, 0x67, 0x79, 0x00, 0x12, 0x0F,
-    0x12, 0x08, 0x0A, 0x00, 0x82, 0x67, 0x79, 0x00, 0x12, 0x0F, 0x12, 0x08, 0x0A, 0x00, 0x82, 0x67,
-    0x79, 0x00, 0x46, 0x35, 0xE7, 0x08, 0x4C, 0xE7, 0x0A, 0x52, 0xE7, 0x0F, 0x60, 0xE7, 0x11, 0x66,
-    0xE7, 0x12, 0x6C, 0xE7, 0x00, 0x4C, 0x3C, 0xE7, 0x18, 0x41, 0xE7, 0x00, 0x0B, 0x1A, 0x00, 0x80,
-    0x00, 0x50, 0x48, 0xE7, 0x16, 0x4A, 0xE7, 0x00, 0x80, 0x00, 0x80, 0x00, 0x0B, 0x17, 0x00, 0x81,
-    0x79, 0x00, 0x0C, 0x00, 0x4B, 0x5B, 0xE7, 0x15, 0x5D, 0xE7, 0x00, 0x80, 0x00, 0x80, 0x74, 0x00,
-    0x11, 0x12, 0x00, 0x81, 0x79, 0x00, 0x04, 0x10, 0x00, 0x81, 0x79, 0x00, 0x0F, 0x12, 0x08, 0x0A,
-    0x00, 0x81, 0x67, 0x79, 0x00, 0x11, 0x04, 0x10, 0x00, 0x81, 0x79, 0x00, 0x0F, 0x00, 0x44, 0x85,
-    0xE7, 0x11, 0x8C, 0xE7, 0x00, 0x08, 0x15, 0x00, 0x81, 0x6C, 0x79, 0x00, 0x12, 0x00, 0x81, 0x79,
-    0x00, 0x44, 0xAD, 0xE7, 0x05, 0xC3, 0xE7, 0x0B, 0xCA, 0xE7, 0x0D, 0xD1, 0xE7, 0x0E, 0xD8, 0xE7,
-    0x0F, 0xF9, 0xE7, 0x10, 0x0B, 0xE9, 0x11, 0x12, 0xE9, 0x12, 0x83, 0xE9, 0x00, 0x48, 0xB4, 0xE7,
-    0x0F, 0xBA, 0xE7, 0x00, 0x15, 0x00, 0x80, 0x6C, 0x79, 0x00, 0x08, 0x15, 0x00, 0x83, 0x61, 0x6C,
-    0x6C, 0x79, 0x00, 0x11, 0x12, 0x00, 0x82, 0x6C, 0x79, 0x00, 0x11, 0x12, 0x00, 0x82, 0x6C, 0x79,
-    0x00, 0x11, 0x12, 0x00, 0x82, 0x6C, 0x79, 0x00, 0x44, 0xE2, 0xE7, 0x0F, 0xEA, 0xE7, 0x11, 0xF2,
-    0xE7, 0x00, 0x08, 0x15, 0x00, 0x82, 0x6C, 0x6C, 0x79, 0x00, 0x04, 0x08, 0x15, 0x00, 0x82, 0x6C,
-    0x79, 0x00, 0x12, 0x2C, 0x00, 0x82, 0x6C, 0x79, 0x00, 0x44, 0x12, 0xE8, 0x08, 0x93, 0xE8, 0x0E,
-    0x9D, 0xE8, 0x12, 0xA6, 0xE8, 0x14, 0xAF, 0xE8, 0x16, 0xC6, 0xE8, 0x1A, 0xDD, 0xE8, 0x1D, 0xF4,
-    0xE8, 0x00, 0x47, 0x28, 0xE8, 0x08, 0x40, 0xE8, 0x14, 0x4A, 0xE8, 0x15, 0x53, 0xE8, 0x16, 0x6B,
-    0xE8, 0x1A, 0x74, 0xE8, 0x1D, 0x8A, 0xE8, 0x00, 0x48, 0x2F, 0xE8, 0x15, 0x37, 0xE8, 0x00, 0x15,
-    0x00, 0x84, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x2C, 0x00, 0x84, 0x65, 0x61, 0x6C, 0x6C, 0x79, 0x00,
-    0x2C, 0x00, 0x84, 0x72, 0x65, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x08, 0x15, 0x00, 0x84, 0x61, 0x6C,
-    0x6C, 0x79, 0x00, 0x48, 0x5A, 0xE8, 0x15, 0x64, 0xE8, 0x00, 0x2C, 0x00, 0x85, 0x72, 0x65, 0x61,
-    0x6C, 0x6C, 0x79, 0x00, 0x84, 0x65, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x08, 0x15, 0x00, 0x84, 0x61,
-    0x6C, 0x6C, 0x79, 0x00, 0x48, 0x7B, 0xE8, 0x15, 0x83, 0xE8, 0x00, 0x15, 0x00, 0x84, 0x61, 0x6C,
-    0x6C, 0x79, 0x00, 0x84, 0x65, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x08, 0x15, 0x00, 0x84, 0x61, 0x6C,
-    0x6C, 0x79, 0x00, 0x04, 0x15, 0x00, 0x84, 0x65, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x04, 0x08, 0x15,
-    0x00, 0x83, 0x6C, 0x6C, 0x79, 0x00, 0x04, 0x08, 0x15, 0x00, 0x83, 0x6C, 0x6C, 0x79, 0x00, 0x44,
-    0xB6, 0xE8, 0x08, 0xBE, 0xE8, 0x00, 0x08, 0x15, 0x00, 0x83, 0x6C, 0x6C, 0x79, 0x00, 0x15, 0x00,
-    0x83, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x44, 0xCD, 0xE8, 0x08, 0xD5, 0xE8, 0x00, 0x08, 0x15, 0x00,
-    0x83, 0x6C, 0x6C, 0x79, 0x00, 0x15, 0x00, 0x83, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x44, 0xE4, 0xE8,
-    0x08, 0xEC, 0xE8, 0x00, 0x08, 0x15, 0x00, 0x83, 0x6C, 0x6C, 0x79, 0x00, 0x15, 0x00, 0x83, 0x61,
-    0x6C, 0x6C, 0x79, 0x00, 0x44, 0xFB, 0xE8, 0x08, 0x03, 0xE9, 0x00, 0x08, 0x15, 0x00, 0x83, 0x6C,
-    0x6C, 0x79, 0x00, 0x15, 0x00, 0x83, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x11, 0x12, 0x00, 0x82, 0x6C,
-    0x79, 0x00, 0x45, 0x2B, 0xE9, 0x0B, 0x32, 0xE9, 0x0C, 0x39, 0xE9, 0x0D, 0x49, 0xE9, 0x0F, 0x50,
-    0xE9, 0x10, 0x57, 0xE9, 0x12, 0x5E, 0xE9, 0x13, 0x7C, 0xE9, 0x00, 0x12, 0x00, 0x83, 0x6E, 0x6C,
-    0x79, 0x00, 0x12, 0x00, 0x83, 0x6E, 0x6C, 0x79, 0x00, 0x52, 0x40, 0xE9, 0x19, 0x45, 0xE9, 0x00,
-    0x83, 0x6E, 0x6C, 0x79, 0x00, 0x81, 0x79, 0x6C, 0x00, 0x12, 0x00, 0x83, 0x6E, 0x6C, 0x79, 0x00,
-    0x12, 0x00, 0x83, 0x6E, 0x6C, 0x79, 0x00, 0x12, 0x00, 0x83, 0x6E, 0x6C, 0x79, 0x00, 0x4C, 0x68,
-    0xE9, 0x0F, 0x70, 0xE9, 0x13, 0x76, 0xE9, 0x00, 0x2C, 0x00, 0x84, 0x6F, 0x6E, 0x6C, 0x79, 0x00,
-    0x84, 0x6F, 0x6E, 0x6C, 0x79, 0x00, 0x84, 0x6F, 0x6E, 0x6C, 0x79, 0x00, 0x12, 0x00, 0x83, 0x6E,
-    0x6C, 0x79, 0x00, 0x44, 0x8A, 0xE9, 0x0F, 0x92, 0xE9, 0x00, 0x08, 0x15, 0x00, 0x82, 0x6C, 0x6C,
-    0x79, 0x00, 0x04, 0x08, 0x15, 0x00, 0x82, 0x6C, 0x79, 0x00, 0x11, 0x04, 0x10, 0x00, 0x81, 0x79,
-    0x00, 0x44, 0xBD, 0xE9, 0x05, 0x23, 0xEA, 0x0B, 0x2A, 0xEA, 0x0D, 0x31, 0xEA, 0x10, 0x38, 0xEA,
-    0x14, 0x3F, 0xEA, 0x16, 0x46, 0xEA, 0x1A, 0x4D, 0xEA, 0x1D, 0x54, 0xEA, 0x00, 0x4D, 0xD6, 0xE9,
-    0x0E, 0xDD, 0xE9, 0x10, 0xE4, 0xE9, 0x11, 0x00, 0xEA, 0x14, 0x07, 0xEA, 0x16, 0x0E, 0xEA, 0x1A,
-    0x15, 0xEA, 0x1D, 0x1C, 0xEA, 0x00, 0x10, 0x00, 0x83, 0x61, 0x6E, 0x79, 0x00, 0x10, 0x00, 0x83,
-    0x61, 0x6E, 0x79, 0x00, 0x4D, 0xEE, 0xE9, 0x0E, 0xF4, 0xE9, 0x11, 0xFA, 0xE9, 0x00, 0x84, 0x6D,
-    0x61, 0x6E, 0x79, 0x00, 0x84, 0x6D, 0x61, 0x6E, 0x79, 0x00, 0x84, 0x6D, 0x61, 0x6E, 0x79, 0x00,
-    0x10, 0x00, 0x83, 0x61, 0x6E, 0x79, 0x00, 0x10, 0x00, 0x83, 0x61, 0x6E, 0x79, 0x00, 0x10, 0x00,
-    0x83, 0x61, 0x6E, 0x79, 0x00, 0x10, 0x00, 0x83, 0x61, 0x6E, 0x79, 0x00, 0x10, 0x00, 0x83, 0x61,
-    0x6E, 0x79, 0x00, 0x04, 0x10, 0x00, 0x82, 0x6E, 0x79, 0x00, 0x04, 0x10, 0x00, 0x82, 0x6E, 0x79,
-    0x00, 0x04, 0x10, 0x00, 0x82, 0x6E, 0x79, 0x00, 0x04, 0x10, 0x00, 0x82, 0x6E, 0x79, 0x00, 0x04,
-    0x10, 0x00, 0x82, 0x6E, 0x79, 0x00, 0x04, 0x10, 0x00, 0x82, 0x6E, 0x79, 0x00, 0x04, 0x10, 0x00,
-    0x82, 0x6E, 0x79, 0x00, 0x04, 0x10, 0x00, 0x82, 0x6E, 0x79, 0x00, 0x4A, 0x62, 0xEA, 0x0F, 0x6C,
-    0xEA, 0x00, 0x0F, 0x12, 0x08, 0x0A, 0x00, 0x82, 0x6F, 0x67, 0x79, 0x00, 0x44, 0x76, 0xEA, 0x11,
-    0x7D, 0xEA, 0x12, 0x82, 0xEA, 0x00, 0x08, 0x15, 0x00, 0x81, 0x6C, 0x79, 0x00, 0x12, 0x00, 0x81,
-    0x79, 0x00, 0x08, 0x0A, 0x00, 0x80, 0x67, 0x79, 0x00, 0x47, 0x9F, 0xEA, 0x08, 0xB3, 0xEA, 0x09,
-    0x90, 0xEB, 0x15, 0x97, 0xEB, 0x17, 0xAA, 0xEB, 0x19, 0xB2, 0xEB, 0x1A, 0xBB, 0xEB, 0x00, 0x48,
-    0xA6, 0xEA, 0x19, 0xAC, 0xEA, 0x00, 0x19, 0x00, 0x82, 0x72, 0x79, 0x00, 0x08, 0x00, 0x82, 0x65,
-    0x72, 0x79, 0x00, 0x45, 0xD2, 0xEA, 0x06, 0xD9, 0xEA, 0x07, 0xEB, 0xEA, 0x08, 0xF2, 0xEA, 0x09,
-    0xF9, 0xEA, 0x0A, 0x0D, 0xEB, 0x0B, 0x1F, 0xEB, 0x15, 0x25, 0xEB, 0x19, 0x2C, 0xEB, 0x1A, 0x89,
-    0xEB, 0x00, 0x19, 0x00, 0x83, 0x65, 0x72, 0x79, 0x00, 0x48, 0xE0, 0xEA, 0x19, 0xE6, 0xEA, 0x00,
-    0x83, 0x76, 0x65, 0x72, 0x79, 0x00, 0x83, 0x65, 0x72, 0x79, 0x00, 0x19, 0x00, 0x83, 0x65, 0x72,
-    0x79, 0x00, 0x19, 0x08, 0x00, 0x82, 0x72, 0x79, 0x00, 0x48, 0x00, 0xEB, 0x19, 0x08, 0xEB, 0x00,
-    0x2C, 0x00, 0x83, 0x76, 0x65, 0x72, 0x79, 0x00, 0x83, 0x65, 0x72, 0x79, 0x00, 0x48, 0x14, 0xEB,
-    0x19, 0x1A, 0xEB, 0x00, 0x83, 0x76, 0x65, 0x72, 0x79, 0x00, 0x83, 0x65, 0x72, 0x79, 0x00, 0x17,
-    0x2C, 0x00, 0x81, 0x79, 0x00, 0x19, 0x00, 0x83, 0x65, 0x72, 0x79, 0x00, 0x45, 0x45, 0xEB, 0x06,
-    0x4B, 0xEB, 0x07, 0x51, 0xEB, 0x08, 0x58, 0xEB, 0x09, 0x6D, 0xEB, 0x0A, 0x73, 0xEB, 0x15, 0x79,
-    0xEB, 0x1A, 0x82, 0xEB, 0x00, 0x84, 0x76, 0x65, 0x72, 0x79, 0x00, 0x84, 0x76, 0x65, 0x72, 0x79,
-    0x00, 0x84, 0x65, 0x76, 0x65, 0x72, 0x79, 0x00, 0x47, 0x5F, 0xEB, 0x1A, 0x66, 0xEB, 0x00, 0x85,
-    0x65, 0x76, 0x65, 0x72, 0x79, 0x00, 0x85, 0x65, 0x76, 0x65, 0x72, 0x79, 0x00, 0x84, 0x76, 0x65,
-    0x72, 0x79, 0x00, 0x84, 0x76, 0x65, 0x72, 0x79, 0x00, 0x2C, 0x00, 0x84, 0x65, 0x76, 0x65, 0x72,
-    0x79, 0x00, 0x84, 0x65, 0x76, 0x65, 0x72, 0x79, 0x00, 0x19, 0x00, 0x83, 0x65, 0x72, 0x79, 0x00,
-    0x08, 0x19, 0x00, 0x82, 0x72, 0x79, 0x00, 0x48, 0x9E, 0xEB, 0x19, 0xA3, 0xEB, 0x00, 0x19, 0x00,
-    0x81, 0x79, 0x00, 0x08, 0x00, 0x82, 0x65, 0x72, 0x79, 0x00, 0x08, 0x19, 0x2C, 0x00, 0x82, 0x72,
-    0x79, 0x00, 0x08, 0x08, 0x00, 0x83, 0x76, 0x65, 0x72, 0x79, 0x00, 0x48, 0xC2, 0xEB, 0x19, 0xC8,
-    0xEB, 0x00, 0x19, 0x00, 0x82, 0x72, 0x79, 0x00, 0x08, 0x00, 0x82, 0x65, 0x72, 0x79, 0x00, 0x15,
-    0x0C, 0x09, 0x00, 0x80, 0x74, 0x00, 0x74, 0xF8, 0xEB, 0x04, 0x09, 0xEC, 0x06, 0x20, 0xEC, 0x08,
-    0x26, 0xEC, 0x0C, 0x39, 0xEC, 0x0F, 0x3E, 0xEC, 0x11, 0x44, 0xEC, 0x12, 0x55, 0xEC, 0x15, 0x5E,
-    0xEC, 0x16, 0x65, 0xEC, 0x18, 0x74, 0xEC, 0x00, 0x11, 0x00, 0x44, 0x01, 0xEC, 0x12, 0x05, 0xEC,
-    0x00, 0x06, 0x00, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x48, 0x10, 0xEC, 0x0B, 0x15, 0xEC, 0x00,
-    0x15, 0x0A, 0x00, 0x80, 0x00, 0x57, 0x1C, 0xEC, 0x1A, 0x1E, 0xEC, 0x00, 0x80, 0x00, 0x80, 0x00,
-    0x04, 0x1B, 0x08, 0x00, 0x80, 0x00, 0x4B, 0x2D, 0xEC, 0x19, 0x33, 0xEC, 0x00, 0x17, 0x2C, 0x00,
-    0x81, 0x79, 0x00, 0x08, 0x00, 0x81, 0x72, 0x79, 0x00, 0x0B, 0x16, 0x00, 0x80, 0x00, 0x11, 0x12,
-    0x00, 0x81, 0x79, 0x00, 0x44, 0x4B, 0xEC, 0x18, 0x51, 0xEC, 0x00, 0x10, 0x2C, 0x00, 0x81, 0x79,
-    0x00, 0x06, 0x00, 0x80, 0x00, 0x0F, 0x12, 0x08, 0x0A, 0x00, 0x81, 0x67, 0x79, 0x00, 0x08, 0x19,
-    0x2C, 0x00, 0x81, 0x79, 0x00, 0x48, 0x6C, 0xEC, 0x18, 0x70, 0xEC, 0x00, 0x05, 0x00, 0x80, 0x00,
-    0x0D, 0x00, 0x80, 0x00, 0x12, 0x05, 0x04, 0x00, 0x80, 0x00, 0x48, 0x8A, 0xEC, 0x0F, 0x90, 0xEC,
-    0x11, 0x96, 0xEC, 0x12, 0x9C, 0xEC, 0x15, 0xA2, 0xEC, 0x00, 0x0B, 0x17, 0x00, 0x81, 0x79, 0x00,
-    0x11, 0x12, 0x00, 0x81, 0x79, 0x00, 0x04, 0x10, 0x00, 0x81, 0x79, 0x00, 0x05, 0x04, 0x00, 0x80,
-    0x74, 0x00, 0x08, 0x19, 0x00, 0x81, 0x79, 0x00, 0x12, 0x0F, 0x12, 0x08, 0x0A, 0x00, 0x81, 0x67,
-    0x79, 0x00
+    0xA6, 0x58, 0x16, 0x56, 0x58, 0x00, 0x56, 0x95, 0x58, 0x00, 0x87, 0x61, 0x63, 0x72, 0x61, 0x6D,
+    0x65, 0x6E, 0x74, 0x6F, 0x00, 0x44, 0xBC, 0x58, 0x06, 0xC0, 0x58, 0x00, 0x56, 0x00, 0x58, 0x00,
+    0x04, 0x16, 0x00, 0x87, 0x72, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x06, 0x04, 0x00, 0x56,
+    0xC3, 0x58, 0x00, 0x04, 0x15, 0x06, 0x04, 0x16, 0x00, 0x85, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00,
+    0x44, 0xE7, 0x58, 0x15, 0xEF, 0x58, 0x00, 0x15, 0x06, 0x04, 0x00, 0x56, 0xD9, 0x58, 0x00, 0x06,
+    0x04, 0x00, 0x56, 0x77, 0x57, 0x00, 0x44, 0xFD, 0x58, 0x06, 0x04, 0x59, 0x00, 0x06, 0x04, 0x00,
+    0x56, 0x14, 0x58, 0x00, 0x04, 0x16, 0x00, 0x84, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00, 0x18,
+    0x2C, 0x00, 0x84, 0x69, 0x6E, 0x74, 0x6F, 0x00, 0x4C, 0x3D, 0x57, 0x00, 0x44, 0x26, 0x59, 0x08,
+    0x31, 0x59, 0x0C, 0x3D, 0x57, 0x00, 0x15, 0x06, 0x04, 0x16, 0x00, 0x82, 0x65, 0x6E, 0x74, 0x6F,
+    0x00, 0x44, 0x9E, 0x57, 0x10, 0x38, 0x59, 0x00, 0x04, 0x15, 0x06, 0x04, 0x00, 0x56, 0x3D, 0x57,
+    0x00, 0x51, 0xD0, 0x56, 0x00, 0x51, 0x4C, 0x59, 0x17, 0xF8, 0x55, 0x00, 0x48, 0x53, 0x59, 0x0C,
+    0x5D, 0x59, 0x00, 0x10, 0x04, 0x15, 0x06, 0x04, 0x00, 0x56, 0xF4, 0x55, 0x00, 0x59, 0xDC, 0x00,
+    0x00, 0x4E, 0x6E, 0x59, 0x0F, 0x75, 0x59, 0x12, 0xC5, 0x59, 0x17, 0xCC, 0x59, 0x00, 0x0F, 0x08,
+    0x0B, 0x00, 0x81, 0x70, 0x00, 0x47, 0x88, 0x59, 0x08, 0x8F, 0x59, 0x0E, 0x88, 0x59, 0x12, 0x88,
+    0x59, 0x15, 0x88, 0x59, 0x1A, 0x88, 0x59, 0x00, 0x08, 0x0B, 0x00, 0x82, 0x6C, 0x70, 0x00, 0x45,
+    0xAB, 0x59, 0x07, 0xAB, 0x59, 0x0A, 0xAB, 0x59, 0x0B, 0xB2, 0x59, 0x0D, 0xAB, 0x59, 0x11, 0xAB,
+    0x59, 0x15, 0xAB, 0x59, 0x1A, 0xAB, 0x59, 0x1C, 0xAB, 0x59, 0x00, 0x0B, 0x00, 0x83, 0x65, 0x6C,
+    0x70, 0x00, 0x45, 0xBF, 0x59, 0x0A, 0xBF, 0x59, 0x0D, 0xBF, 0x59, 0x1C, 0xBF, 0x59, 0x00, 0x84,
+    0x68, 0x65, 0x6C, 0x70, 0x00, 0x17, 0x11, 0x0C, 0x2C, 0x00, 0x80, 0x00, 0x11, 0x08, 0x10, 0x04,
+    0x15, 0x06, 0x04, 0x16, 0x00, 0x80, 0x6F, 0x00, 0x1A, 0x12, 0x11, 0x0E, 0x00, 0x80, 0x00, 0x74,
+    0xE8, 0x37, 0x04, 0x1F, 0x5A, 0x06, 0x6C, 0x5A, 0x07, 0x73, 0x5A, 0x08, 0xE5, 0x5A, 0x09, 0x4C,
+    0x60, 0x0B, 0x5C, 0x60, 0x0C, 0x73, 0x60, 0x0D, 0x28, 0x61, 0x0E, 0x2F, 0x61, 0x0F, 0x3D, 0x61,
+    0x12, 0x44, 0x61, 0x14, 0x4C, 0x61, 0x15, 0x53, 0x61, 0x16, 0x75, 0x61, 0x17, 0x8B, 0x61, 0x18,
+    0xD9, 0x61, 0x19, 0x39, 0x62, 0x1A, 0x40, 0x62, 0x1C, 0x6B, 0x62, 0x1D, 0x4C, 0x61, 0x00, 0x47,
+    0x32, 0x5A, 0x08, 0x39, 0x5A, 0x14, 0x32, 0x5A, 0x15, 0x32, 0x5A, 0x16, 0x32, 0x5A, 0x1D, 0x32,
+    0x5A, 0x00, 0x08, 0x1C, 0x00, 0x82, 0x61, 0x72, 0x00, 0x47, 0x4C, 0x5A, 0x15, 0x53, 0x5A, 0x17,
+    0x4C, 0x5A, 0x18, 0x4C, 0x5A, 0x1A, 0x4C, 0x5A, 0x1C, 0x5A, 0x5A, 0x00, 0x1C, 0x00, 0x83, 0x65,
+    0x61, 0x72, 0x00, 0x4A, 0x1E, 0x09, 0x1C, 0x4E, 0x5A, 0x00, 0x4B, 0x64, 0x5A, 0x17, 0x64, 0x5A,
+    0x18, 0x66, 0x5A, 0x00, 0x2C, 0x00, 0x84, 0x79, 0x65, 0x61, 0x72, 0x00, 0x04, 0x1B, 0x08, 0x00,
+    0x80, 0x74, 0x00, 0x47, 0x83, 0x5A, 0x08, 0x96, 0x5A, 0x0C, 0xC9, 0x5A, 0x17, 0xD2, 0x5A, 0x19,
+    0xDF, 0x5A, 0x00, 0x4C, 0x8A, 0x5A, 0x11, 0x92, 0x5A, 0x00, 0x16, 0x11, 0x12, 0x00, 0x46, 0x5A,
+    0x31, 0x00, 0x58, 0x5A, 0x31, 0x00, 0x47, 0x4A, 0x03, 0x0B, 0xA9, 0x5A, 0x0C, 0xAF, 0x5A, 0x11,
+    0xB9, 0x5A, 0x17, 0xBD, 0x5A, 0x19, 0xC3, 0x5A, 0x00, 0x17, 0x12, 0x00, 0x81, 0x72, 0x00, 0x16,
+    0x11, 0x12, 0x06, 0x00, 0x82, 0x64, 0x65, 0x72, 0x00, 0x58, 0xB4, 0x5A, 0x00, 0x09, 0x04, 0x00,
+    0x81, 0x72, 0x00, 0x08, 0x11, 0x00, 0x81, 0x72, 0x00, 0x16, 0x11, 0x12, 0x06, 0x00, 0x80, 0x65,
+    0x72, 0x00, 0x49, 0x58, 0x31, 0x17, 0xD9, 0x5A, 0x00, 0x08, 0x00, 0x45, 0x5A, 0x31, 0x00, 0x08,
+    0x00, 0x51, 0x5A, 0x31, 0x00, 0x44, 0x22, 0x5B, 0x05, 0x28, 0x5B, 0x06, 0x4B, 0x5B, 0x07, 0x6F,
+    0x5B, 0x08, 0x43, 0x5D, 0x09, 0x54, 0x5D, 0x0A, 0x6C, 0x5D, 0x0B, 0x91, 0x5D, 0x0C, 0x56, 0x5E,
+    0x0D, 0x6E, 0x5E, 0x10, 0x79, 0x5E, 0x11, 0x7F, 0x5E, 0x15, 0x8D, 0x5E, 0x16, 0xAB, 0x5E, 0x17,
+    0xB8, 0x5E, 0x18, 0xA2, 0x5F, 0x19, 0xA8, 0x5F, 0x1A, 0x2B, 0x60, 0x1B, 0x38, 0x60, 0x1C, 0x42,
+    0x60, 0x00, 0x08, 0x1C, 0x00, 0x81, 0x72, 0x00, 0x48, 0x32, 0x5B, 0x0B, 0x3A, 0x5B, 0x19, 0x40,
+    0x5B, 0x00, 0x11, 0x2C, 0x00, 0x82, 0x76, 0x65, 0x72, 0x00, 0x17, 0x00, 0x52, 0x62, 0x05, 0x00,
+    0x48, 0x47, 0x5B, 0x12, 0x62, 0x05, 0x00, 0x51, 0x62, 0x05, 0x00, 0x47, 0x58, 0x5B, 0x08, 0x6B,
+    0x5B, 0x0C, 0xAF, 0x5A, 0x19, 0x40, 0x5B, 0x00, 0x4C, 0x5F, 0x5B, 0x11, 0x67, 0x5B, 0x00, 0x16,
+    0x11, 0x12, 0x00, 0x46, 0x62, 0x05, 0x00, 0x58, 0x62, 0x05, 0x00, 0x51, 0x35, 0x5B, 0x00, 0x44,
+    0x4C, 0x19, 0x05, 0x81, 0x0D, 0x06, 0xA6, 0x5B, 0x07, 0x58, 0x5B, 0x08, 0xA6, 0x5B, 0x09, 0xA6,
+    0x5B, 0x0B, 0xB9, 0x5B, 0x0C, 0xCD, 0x5B, 0x0D, 0xC0, 0x5C, 0x0E, 0xC7, 0x5C, 0x10, 0xC0, 0x5C,
+    0x11, 0xD8, 0x5C, 0x12, 0xC7, 0x5C, 0x16, 0x04, 0x5D, 0x17, 0x28, 0x5D, 0x18, 0x39, 0x5D, 0x19,
+    0x40, 0x5B, 0x1B, 0xA6, 0x5B, 0x00, 0x4C, 0xAD, 0x5B, 0x11, 0xB5, 0x5B, 0x00, 0x16, 0x11, 0x12,
+    0x00, 0x46, 0x48, 0x0D, 0x00, 0x58, 0x48, 0x0D, 0x00, 0x51, 0xB5, 0x5B, 0x17, 0xC3, 0x5B, 0x18,
+    0xC7, 0x5B, 0x00, 0x52, 0x62, 0x05, 0x00, 0x83, 0x6E, 0x64, 0x65, 0x72, 0x00, 0x44, 0xEC, 0x5B,
+    0x07, 0xF7, 0x5B, 0x08, 0xF7, 0x5B, 0x0E, 0x0E, 0x5C, 0x11, 0x16, 0x5C, 0x12, 0x0E, 0x5C, 0x16,
+    0x2C, 0x5C, 0x18, 0x0E, 0x5C, 0x1A, 0xF7, 0x5B, 0x1B, 0xF7, 0x5B, 0x00, 0x11, 0x12, 0x06, 0x00,
+    0x84, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x51, 0xFE, 0x5B, 0x16, 0x04, 0x5C, 0x00, 0x12, 0x00,
+    0x46, 0xF0, 0x5B, 0x00, 0x11, 0x12, 0x06, 0x00, 0x84, 0x69, 0x64, 0x65, 0x72, 0x00, 0x16, 0x11,
+    0x12, 0x00, 0x46, 0x08, 0x5C, 0x00, 0x52, 0x1D, 0x5C, 0x16, 0x26, 0x5C, 0x00, 0x06, 0x00, 0x83,
+    0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x12, 0x00, 0x46, 0x65, 0x0D, 0x00, 0x44, 0x4E, 0x5C, 0x05,
+    0x59, 0x5C, 0x07, 0x4E, 0x5C, 0x08, 0x4E, 0x5C, 0x0B, 0x59, 0x5C, 0x0D, 0x59, 0x5C, 0x10, 0x59,
+    0x5C, 0x11, 0x6A, 0x5C, 0x12, 0xBA, 0x5C, 0x1A, 0x4E, 0x5C, 0x1B, 0x4E, 0x5C, 0x00, 0x11, 0x12,
+    0x06, 0x00, 0x85, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x51, 0x60, 0x5C, 0x12, 0x66, 0x5C, 0x00,
+    0x12, 0x00, 0x46, 0x52, 0x5C, 0x00, 0x46, 0x65, 0x0D, 0x00, 0x45, 0x86, 0x5C, 0x06, 0x91, 0x5C,
+    0x0B, 0x86, 0x5C, 0x0C, 0x9A, 0x5C, 0x0D, 0x86, 0x5C, 0x0F, 0x9A, 0x5C, 0x10, 0x86, 0x5C, 0x12,
+    0xAE, 0x5C, 0x13, 0x9A, 0x5C, 0x00, 0x12, 0x06, 0x00, 0x86, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72,
+    0x00, 0x85, 0x6F, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x46, 0xA1, 0x5C, 0x12, 0xAA, 0x5C,
+    0x00, 0x86, 0x6F, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x46, 0x89, 0x5C, 0x00, 0x2C, 0x00,
+    0x86, 0x63, 0x6F, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x11, 0x00, 0x46, 0xA1, 0x5C, 0x00,
+    0x51, 0xB5, 0x5B, 0x18, 0xC7, 0x5B, 0x00, 0x4C, 0xAD, 0x5B, 0x16, 0xCE, 0x5C, 0x00, 0x11, 0x12,
+    0x06, 0x00, 0x83, 0x69, 0x64, 0x65, 0x72, 0x00, 0x45, 0xEB, 0x5C, 0x0B, 0xEB, 0x5C, 0x0D, 0xEF,
+    0x5C, 0x10, 0xEB, 0x5C, 0x18, 0xF6, 0x5C, 0x1C, 0x00, 0x5D, 0x00, 0x58, 0x5A, 0x0D, 0x00, 0x84,
+    0x75, 0x6E, 0x64, 0x65, 0x72, 0x00, 0x4C, 0x70, 0x0D, 0x0D, 0x70, 0x0D, 0x1C, 0x70, 0x0D, 0x00,
+    0x6C, 0xEF, 0x5C, 0x00, 0x4C, 0x0B, 0x5D, 0x11, 0x19, 0x5D, 0x00, 0x51, 0xFE, 0x5B, 0x16, 0x12,
+    0x5D, 0x00, 0x11, 0x12, 0x00, 0x46, 0x48, 0x0D, 0x00, 0x52, 0x20, 0x5D, 0x18, 0x48, 0x0D, 0x00,
+    0x06, 0x00, 0x82, 0x69, 0x64, 0x65, 0x72, 0x00, 0x49, 0x2F, 0x5D, 0x17, 0x33, 0x5D, 0x00, 0x44,
+    0x62, 0x05, 0x00, 0x08, 0x00, 0x45, 0x62, 0x05, 0x00, 0x4C, 0xAD, 0x5B, 0x11, 0x00, 0x5D, 0x16,
+    0xCE, 0x5C, 0x00, 0x4C, 0xAF, 0x5A, 0x11, 0xB9, 0x5A, 0x15, 0x91, 0x15, 0x19, 0x50, 0x5D, 0x00,
+    0x52, 0x4D, 0x03, 0x00, 0x47, 0x58, 0x5B, 0x08, 0x6B, 0x5B, 0x0C, 0xAF, 0x5A, 0x17, 0x64, 0x5D,
+    0x19, 0x40, 0x5B, 0x00, 0x04, 0x00, 0x83, 0x66, 0x74, 0x65, 0x72, 0x00, 0x49, 0x79, 0x5D, 0x0B,
+    0x3A, 0x5B, 0x17, 0x80, 0x5D, 0x19, 0x40, 0x5B, 0x00, 0x04, 0x00, 0x82, 0x74, 0x65, 0x72, 0x00,
+    0x48, 0x8D, 0x5D, 0x09, 0x2F, 0x5D, 0x12, 0x01, 0x0E, 0x17, 0x33, 0x5D, 0x00, 0x45, 0x7B, 0x5D,
+    0x00, 0x45, 0xAA, 0x5D, 0x0A, 0xB0, 0x5D, 0x0D, 0xAA, 0x5D, 0x11, 0xAA, 0x5D, 0x12, 0xBF, 0x5D,
+    0x15, 0xCA, 0x5D, 0x17, 0xD1, 0x5D, 0x1C, 0xCA, 0x5D, 0x00, 0x17, 0x00, 0x52, 0x34, 0x0D, 0x00,
+    0x52, 0xB7, 0x5D, 0x17, 0xBB, 0x5D, 0x00, 0x6C, 0x92, 0x0D, 0x00, 0x52, 0x34, 0x0D, 0x00, 0x17,
+    0x11, 0x04, 0x00, 0x84, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x00, 0x52, 0x92, 0x0D, 0x17, 0xBB, 0x5D,
+    0x00, 0x4A, 0xE4, 0x5D, 0x0C, 0xEC, 0x5D, 0x11, 0xF2, 0x5D, 0x12, 0xFD, 0x5D, 0x13, 0xC3, 0x5D,
+    0x1C, 0xE4, 0x5D, 0x00, 0x12, 0x00, 0x84, 0x74, 0x68, 0x65, 0x72, 0x00, 0x12, 0x00, 0x6C, 0xE6,
+    0x5D, 0x00, 0x12, 0x04, 0x00, 0x85, 0x6E, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x00, 0x44, 0x16, 0x5E,
+    0x05, 0x1E, 0x5E, 0x0B, 0x22, 0x5E, 0x0D, 0x22, 0x5E, 0x0F, 0xA2, 0x0D, 0x10, 0x2D, 0x5E, 0x11,
+    0x33, 0x5E, 0x13, 0x2D, 0x5E, 0x00, 0x84, 0x6E, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x00, 0x44, 0xF5,
+    0x5D, 0x00, 0x44, 0xF5, 0x5D, 0x11, 0x29, 0x5E, 0x00, 0x44, 0xA4, 0x0D, 0x00, 0x11, 0x00, 0x44,
+    0xA4, 0x0D, 0x00, 0x4B, 0x49, 0x5E, 0x0D, 0x49, 0x5E, 0x10, 0x49, 0x5E, 0x14, 0x4D, 0x5E, 0x16,
+    0x4D, 0x5E, 0x1A, 0x4D, 0x5E, 0x1D, 0x4D, 0x5E, 0x00, 0x44, 0xBE, 0x0D, 0x00, 0x86, 0x61, 0x6E,
+    0x6F, 0x74, 0x68, 0x65, 0x72, 0x00, 0x47, 0x5D, 0x5E, 0x16, 0x65, 0x5E, 0x00, 0x16, 0x11, 0x12,
+    0x00, 0x46, 0xD2, 0x5C, 0x00, 0x11, 0x12, 0x06, 0x00, 0x81, 0x64, 0x65, 0x72, 0x00, 0x4B, 0x3A,
+    0x5B, 0x17, 0x75, 0x5E, 0x00, 0x52, 0x01, 0x0E, 0x00, 0x04, 0x16, 0x2C, 0x00, 0x80, 0x00, 0x47,
+    0x89, 0x5E, 0x0B, 0x3A, 0x5B, 0x17, 0x75, 0x5E, 0x00, 0x58, 0xC7, 0x5B, 0x00, 0x48, 0xA0, 0x5E,
+    0x09, 0x79, 0x5D, 0x0B, 0x8C, 0x20, 0x12, 0x4C, 0x19, 0x17, 0xA5, 0x5E, 0x19, 0xC3, 0x5B, 0x00,
+    0x1A, 0x2C, 0x00, 0x80, 0x00, 0x08, 0x00, 0x45, 0x7B, 0x5D, 0x00, 0x47, 0x58, 0x5B, 0x08, 0x91,
+    0x15, 0x0C, 0xAF, 0x5A, 0x12, 0x91, 0x15, 0x00, 0x44, 0xDA, 0x5E, 0x06, 0xE3, 0x5E, 0x07, 0xF5,
+    0x5E, 0x08, 0xFB, 0x5E, 0x09, 0x10, 0x5F, 0x0A, 0x40, 0x5F, 0x0B, 0x5B, 0x5F, 0x15, 0x5F, 0x5F,
+    0x17, 0x66, 0x5F, 0x19, 0x91, 0x5F, 0x1C, 0x98, 0x5F, 0x00, 0x09, 0x00, 0x84, 0x61, 0x66, 0x74,
+    0x65, 0x72, 0x00, 0x44, 0xEA, 0x5E, 0x09, 0xEE, 0x5E, 0x00, 0x6C, 0x66, 0x5D, 0x00, 0x04, 0x00,
+    0x83, 0x74, 0x65, 0x72, 0x00, 0x09, 0x00, 0x44, 0xF0, 0x5E, 0x00, 0x45, 0x02, 0x5F, 0x17, 0x07,
+    0x5F, 0x00, 0x81, 0x74, 0x65, 0x72, 0x00, 0x05, 0x00, 0x84, 0x65, 0x74, 0x74, 0x65, 0x72, 0x00,
+    0x44, 0x2F, 0x5F, 0x06, 0xF6, 0x0D, 0x07, 0xF6, 0x0D, 0x0A, 0xF6, 0x0D, 0x14, 0xDC, 0x5E, 0x15,
+    0xF6, 0x0D, 0x16, 0xDC, 0x5E, 0x19, 0xF6, 0x0D, 0x1A, 0xDC, 0x5E, 0x1D, 0xDC, 0x5E, 0x00, 0x54,
+    0x39, 0x5F, 0x16, 0x39, 0x5F, 0x1D, 0x39, 0x5F, 0x00, 0x85, 0x61, 0x66, 0x74, 0x65, 0x72, 0x00,
+    0x44, 0x66, 0x5D, 0x08, 0x4D, 0x5F, 0x09, 0xEE, 0x5E, 0x17, 0x55, 0x5F, 0x00, 0x05, 0x00, 0x83,
+    0x74, 0x74, 0x65, 0x72, 0x00, 0x08, 0x00, 0x45, 0xF0, 0x5E, 0x00, 0x52, 0x92, 0x0D, 0x00, 0x49,
+    0xEE, 0x5E, 0x17, 0x55, 0x5F, 0x00, 0x45, 0x79, 0x5F, 0x07, 0x80, 0x5F, 0x0A, 0x8B, 0x5F, 0x15,
+    0x80, 0x5F, 0x1A, 0x80, 0x5F, 0x1C, 0x8B, 0x5F, 0x00, 0x83, 0x65, 0x74, 0x74, 0x65, 0x72, 0x00,
+    0x45, 0x09, 0x5F, 0x08, 0x87, 0x5F, 0x00, 0x45, 0x14, 0x0E, 0x00, 0x08, 0x00, 0x45, 0x14, 0x0E,
+    0x00, 0x44, 0x66, 0x5D, 0x09, 0xEE, 0x5E, 0x00, 0x48, 0x4D, 0x5F, 0x09, 0xEE, 0x5E, 0x17, 0x55,
+    0x5F, 0x00, 0x12, 0x1C, 0x00, 0x81, 0x72, 0x00, 0x45, 0xCA, 0x5F, 0x06, 0xD2, 0x5F, 0x07, 0xDD,
+    0x5F, 0x08, 0xEA, 0x5F, 0x09, 0xD2, 0x5F, 0x0A, 0xD2, 0x5F, 0x0C, 0x1D, 0x60, 0x0F, 0x21, 0x60,
+    0x13, 0x1D, 0x60, 0x15, 0x27, 0x60, 0x1A, 0xDD, 0x5F, 0x00, 0x08, 0x11, 0x00, 0x83, 0x76, 0x65,
+    0x72, 0x00, 0x48, 0xD9, 0x5F, 0x12, 0xCD, 0x5F, 0x00, 0x51, 0xCD, 0x5F, 0x00, 0x48, 0xD9, 0x5F,
+    0x11, 0xE4, 0x5F, 0x00, 0x83, 0x65, 0x76, 0x65, 0x72, 0x00, 0x47, 0xFD, 0x5F, 0x0B, 0x03, 0x60,
+    0x0D, 0x05, 0x60, 0x10, 0x03, 0x60, 0x11, 0x0C, 0x60, 0x1A, 0x19, 0x60, 0x00, 0x11, 0x00, 0x6C,
+    0x7B, 0x0D, 0x00, 0x2C, 0x00, 0x84, 0x6E, 0x65, 0x76, 0x65, 0x72, 0x00, 0x45, 0x4B, 0x0E, 0x0B,
+    0x4B, 0x0E, 0x0D, 0x4B, 0x0E, 0x10, 0x4B, 0x0E, 0x00, 0x51, 0x7B, 0x0D, 0x00, 0x52, 0xCD, 0x5F,
+    0x00, 0x12, 0x00, 0x6C, 0xCD, 0x5F, 0x00, 0x51, 0xE4, 0x5F, 0x00, 0x47, 0x58, 0x5B, 0x0B, 0x3A,
+    0x5B, 0x17, 0x28, 0x5D, 0x19, 0x40, 0x5B, 0x00, 0x47, 0x58, 0x5B, 0x0C, 0xAF, 0x5A, 0x11, 0xB9,
+    0x5A, 0x00, 0x49, 0x79, 0x5D, 0x0B, 0x3A, 0x5B, 0x17, 0x80, 0x5D, 0x00, 0x44, 0x22, 0x5B, 0x08,
+    0x56, 0x60, 0x18, 0xA2, 0x5F, 0x00, 0x19, 0x12, 0x00, 0x81, 0x72, 0x00, 0x48, 0x66, 0x60, 0x0A,
+    0x5A, 0x38, 0x17, 0x6C, 0x60, 0x00, 0x17, 0x00, 0x52, 0x01, 0x0E, 0x00, 0x12, 0x11, 0x00, 0x44,
+    0xCE, 0x5A, 0x00, 0x47, 0x8C, 0x60, 0x08, 0x9A, 0x60, 0x0B, 0x0A, 0x61, 0x0E, 0x10, 0x61, 0x12,
+    0x10, 0x61, 0x15, 0x17, 0x61, 0x18, 0x1D, 0x61, 0x1A, 0x8C, 0x60, 0x00, 0x48, 0x68, 0x0E, 0x0B,
+    0x93, 0x60, 0x00, 0x17, 0x00, 0x82, 0x65, 0x69, 0x72, 0x00, 0x45, 0xB9, 0x60, 0x07, 0xCA, 0x60,
+    0x0A, 0xB9, 0x60, 0x0B, 0xD0, 0x60, 0x0D, 0xB9, 0x60, 0x11, 0xB9, 0x60, 0x15, 0xCA, 0x60, 0x17,
+    0x06, 0x61, 0x1A, 0xCA, 0x60, 0x1C, 0xB9, 0x60, 0x00, 0x4B, 0xC0, 0x60, 0x17, 0xC4, 0x60, 0x00,
+    0x57, 0xD3, 0x0D, 0x00, 0x83, 0x68, 0x65, 0x69, 0x72, 0x00, 0x0B, 0x00, 0x57, 0xD3, 0x0D, 0x00,
+    0x45, 0xE6, 0x60, 0x0A, 0xEE, 0x60, 0x0D, 0xE6, 0x60, 0x11, 0xE6, 0x60, 0x15, 0xEE, 0x60, 0x17,
+    0xF5, 0x60, 0x1C, 0xEE, 0x60, 0x00, 0x17, 0x00, 0x84, 0x68, 0x65, 0x69, 0x72, 0x00, 0x84, 0x74,
+    0x68, 0x65, 0x69, 0x72, 0x00, 0x4A, 0xFF, 0x60, 0x15, 0xFF, 0x60, 0x1C, 0xFF, 0x60, 0x00, 0x85,
+    0x74, 0x68, 0x65, 0x69, 0x72, 0x00, 0x4B, 0xEE, 0x60, 0x00, 0x08, 0x00, 0x57, 0xC4, 0x60, 0x00,
+    0x08, 0x0B, 0x00, 0x57, 0x44, 0x09, 0x00, 0x0B, 0x00, 0x57, 0x95, 0x60, 0x00, 0x48, 0x68, 0x0E,
+    0x12, 0x24, 0x61, 0x00, 0x5C, 0x4D, 0x03, 0x00, 0x18, 0x12, 0x1C, 0x00, 0x81, 0x72, 0x00, 0x48,
+    0x36, 0x61, 0x0C, 0x6B, 0x07, 0x00, 0x0B, 0x17, 0x00, 0x81, 0x69, 0x72, 0x00, 0x0C, 0x0B, 0x1A,
+    0x00, 0x80, 0x65, 0x00, 0x0C, 0x08, 0x0B, 0x17, 0x00, 0x81, 0x72, 0x00, 0x04, 0x08, 0x1C, 0x00,
+    0x81, 0x72, 0x00, 0x47, 0x63, 0x61, 0x08, 0xAF, 0x37, 0x0B, 0x69, 0x61, 0x17, 0x6F, 0x61, 0x19,
+    0xDF, 0x5A, 0x00, 0x11, 0x00, 0x58, 0x5A, 0x31, 0x00, 0x17, 0x00, 0x52, 0x5A, 0x31, 0x00, 0x09,
+    0x00, 0x44, 0x5A, 0x31, 0x00, 0x48, 0x7F, 0x61, 0x12, 0x7F, 0x61, 0x15, 0x85, 0x61, 0x00, 0x0B,
+    0x17, 0x00, 0x80, 0x65, 0x00, 0x0C, 0x09, 0x00, 0x80, 0x74, 0x00, 0x74, 0x68, 0x3D, 0x04, 0xA4,
+    0x61, 0x08, 0xB2, 0x61, 0x0C, 0x85, 0x3D, 0x11, 0xBC, 0x61, 0x16, 0xC1, 0x61, 0x17, 0xC6, 0x61,
+    0x18, 0xCC, 0x61, 0x00, 0x48, 0xAB, 0x61, 0x0B, 0x7E, 0x19, 0x00, 0x55, 0xD5, 0x15, 0x1C, 0x4D,
+    0x03, 0x00, 0x49, 0x79, 0x5D, 0x17, 0xA5, 0x5E, 0x19, 0x50, 0x5D, 0x00, 0x18, 0x06, 0x00, 0x80,
+    0x00, 0x18, 0x0D, 0x00, 0x80, 0x00, 0x08, 0x00, 0x45, 0xCE, 0x5A, 0x00, 0x12, 0x00, 0x45, 0xD5,
+    0x61, 0x1C, 0x4D, 0x03, 0x00, 0x04, 0x00, 0x80, 0x00, 0x4C, 0xEC, 0x61, 0x0D, 0xFF, 0x61, 0x0F,
+    0xFF, 0x61, 0x12, 0x05, 0x62, 0x13, 0xFF, 0x61, 0x1C, 0xFF, 0x61, 0x00, 0x48, 0xF3, 0x61, 0x12,
+    0xF9, 0x61, 0x00, 0x0B, 0x17, 0x00, 0x81, 0x72, 0x00, 0x1C, 0x00, 0x82, 0x75, 0x72, 0x00, 0x12,
+    0x00, 0x5C, 0xFB, 0x61, 0x00, 0x45, 0x1E, 0x62, 0x0B, 0x24, 0x62, 0x0C, 0x24, 0x62, 0x0F, 0x24,
+    0x62, 0x13, 0x24, 0x62, 0x17, 0x2B, 0x62, 0x18, 0x24, 0x62, 0x1C, 0x31, 0x62, 0x00, 0x04, 0x2C,
+    0x00, 0x80, 0x74, 0x00, 0x1C, 0x00, 0x83, 0x6F, 0x75, 0x72, 0x00, 0x1C, 0x00, 0x6C, 0x26, 0x62,
+    0x00, 0x18, 0x00, 0x84, 0x79, 0x6F, 0x75, 0x72, 0x00, 0x08, 0x08, 0x00, 0x51, 0x35, 0x5B, 0x00,
+    0x44, 0x22, 0x5B, 0x07, 0x83, 0x5A, 0x08, 0x53, 0x62, 0x0B, 0x69, 0x61, 0x17, 0xD2, 0x5A, 0x19,
+    0xDF, 0x5A, 0x00, 0x47, 0x4A, 0x03, 0x0B, 0xA9, 0x5A, 0x17, 0xBD, 0x5A, 0x19, 0x60, 0x62, 0x00,
+    0x48, 0x67, 0x62, 0x12, 0x4D, 0x03, 0x00, 0x51, 0x4D, 0x03, 0x00, 0x48, 0x72, 0x62, 0x18, 0xA2,
+    0x5F, 0x00, 0x19, 0x08, 0x00, 0x81, 0x72, 0x79, 0x00, 0x74, 0xB9, 0x62, 0x04, 0x64, 0x63, 0x05,
+    0xA4, 0x63, 0x07, 0xB2, 0x63, 0x08, 0x03, 0x64, 0x09, 0xFD, 0x66, 0x0A, 0x07, 0x67, 0x0B, 0x03,
+    0x68, 0x0C, 0x20, 0x68, 0x0E, 0x04, 0x6A, 0x0F, 0x79, 0x17, 0x11, 0x1B, 0x6A, 0x12, 0x30, 0x6A,
+    0x15, 0x3A, 0x6A, 0x16, 0xA9, 0x6A, 0x17, 0xB3, 0x6A, 0x18, 0xE5, 0x6A, 0x19, 0xA4, 0x63, 0x1A,
+    0xF9, 0x6A, 0x1B, 0x0E, 0x6B, 0x1C, 0x18, 0x6B, 0x00, 0x44, 0xC9, 0x62, 0x0A, 0xE0, 0x62, 0x15,
+    0xE0, 0x62, 0x17, 0xF5, 0x62, 0x1C, 0xE0, 0x62, 0x00, 0x4B, 0xD0, 0x62, 0x17, 0xD7, 0x62, 0x00,
+    0x17, 0x00, 0x81, 0x74, 0x27, 0x73, 0x00, 0x0B, 0x17, 0x00, 0x83, 0x61, 0x74, 0x27, 0x73, 0x00,
+    0x44, 0xE7, 0x62, 0x17, 0xEF, 0x62, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x74, 0x27, 0x73, 0x00, 0x0C,
+    0x00, 0x82, 0x27, 0x73, 0x00, 0x44, 0x1D, 0x63, 0x0A, 0x40, 0x63, 0x0B, 0x47, 0x63, 0x0C, 0x54,
+    0x63, 0x0E, 0x40, 0x63, 0x12, 0x40, 0x63, 0x14, 0xD7, 0x62, 0x15, 0x40, 0x63, 0x16, 0xD7, 0x62,
+    0x18, 0x40, 0x63, 0x1A, 0xD7, 0x62, 0x1C, 0x40, 0x63, 0x1D, 0xD7, 0x62, 0x00, 0x45, 0x30, 0x63,
+    0x0A, 0x30, 0x63, 0x0D, 0x30, 0x63, 0x11, 0x30, 0x63, 0x17, 0x39, 0x63, 0x1C, 0x30, 0x63, 0x00,
+    0x17, 0x00, 0x84, 0x68, 0x61, 0x74, 0x27, 0x73, 0x00, 0x83, 0x68, 0x61, 0x74, 0x27, 0x73, 0x00,
+    0x0C, 0x00, 0x83, 0x74, 0x27, 0x73, 0x00, 0x44, 0x30, 0x63, 0x17, 0x4E, 0x63, 0x00, 0x82, 0x61,
+    0x74, 0x27, 0x73, 0x00, 0x4E, 0x5E, 0x63, 0x12, 0x5E, 0x63, 0x18, 0x5E, 0x63, 0x00, 0x84, 0x69,
+    0x74, 0x27, 0x73, 0x00, 0x74, 0x74, 0x63, 0x08, 0x7A, 0x63, 0x15, 0x80, 0x63, 0x1A, 0x94, 0x63,
+    0x1C, 0x9B, 0x63, 0x00, 0x17, 0x0C, 0x00, 0x81, 0x73, 0x00, 0x12, 0x07, 0x00, 0x81, 0x73, 0x00,
+    0x44, 0x87, 0x63, 0x08, 0x8D, 0x63, 0x00, 0x08, 0x1C, 0x00, 0x81, 0x73, 0x00, 0x1C, 0x00, 0x82,
+    0x61, 0x72, 0x73, 0x00, 0x0F, 0x04, 0x00, 0x80, 0x79, 0x73, 0x00, 0x1A, 0x0F, 0x04, 0x00, 0x82,
+    0x61, 0x79, 0x73, 0x00, 0x4A, 0xDF, 0x00, 0x11, 0xAB, 0x63, 0x00, 0x0C, 0x0B, 0x00, 0x57, 0x91,
+    0x0F, 0x00, 0x74, 0x74, 0x63, 0x08, 0xC5, 0x63, 0x0C, 0xD0, 0x63, 0x0F, 0xDB, 0x63, 0x11, 0xE7,
+    0x63, 0x15, 0xFC, 0x63, 0x00, 0x52, 0xCC, 0x63, 0x16, 0x6E, 0x16, 0x00, 0x47, 0xE4, 0x00, 0x00,
+    0x44, 0xD3, 0x45, 0x0B, 0xD7, 0x63, 0x00, 0x57, 0xE4, 0x00, 0x00, 0x55, 0x7E, 0x16, 0x18, 0xE2,
+    0x63, 0x00, 0x12, 0x06, 0x00, 0x80, 0x00, 0x4C, 0x93, 0x16, 0x12, 0xF1, 0x63, 0x18, 0x97, 0x16,
+    0x00, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x81, 0x65, 0x73, 0x00, 0x04, 0x08, 0x1C, 0x00,
+    0x81, 0x73, 0x00, 0x74, 0x74, 0x63, 0x04, 0x2B, 0x64, 0x05, 0x32, 0x64, 0x07, 0x51, 0x64, 0x08,
+    0x5D, 0x64, 0x0B, 0x32, 0x64, 0x0C, 0x6A, 0x64, 0x0D, 0x32, 0x64, 0x10, 0x70, 0x64, 0x11, 0x7B,
+    0x64, 0x12, 0x94, 0x66, 0x15, 0xEB, 0x66, 0x1A, 0xF2, 0x66, 0x00, 0x08, 0x1C, 0x00, 0x81, 0x72,
+    0x73, 0x00, 0x51, 0x39, 0x64, 0x12, 0x45, 0x64, 0x00, 0x12, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B,
+    0x00, 0x82, 0x65, 0x73, 0x00, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x82, 0x6E, 0x65, 0x73,
+    0x00, 0x11, 0x12, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x00, 0x4B, 0x41, 0x64, 0x00, 0x4B, 0x64, 0x64,
+    0x12, 0xCC, 0x63, 0x00, 0x17, 0x00, 0x6C, 0x52, 0x21, 0x00, 0x12, 0x00, 0x47, 0x41, 0x64, 0x00,
+    0x12, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x00, 0x4B, 0x4C, 0x64, 0x00, 0x45, 0x91, 0x64, 0x0B, 0x9E,
+    0x64, 0x0C, 0xCC, 0x64, 0x0D, 0x91, 0x64, 0x0F, 0xCC, 0x64, 0x12, 0xE9, 0x64, 0x13, 0xCC, 0x64,
+    0x00, 0x12, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x83, 0x6E, 0x65, 0x73, 0x00, 0x52, 0xA5,
+    0x64, 0x13, 0xC1, 0x64, 0x00, 0x4B, 0xAC, 0x64, 0x13, 0xB5, 0x64, 0x00, 0x13, 0x07, 0x04, 0x08,
+    0x00, 0x4B, 0x99, 0x64, 0x00, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x84, 0x68, 0x6F, 0x6E, 0x65, 0x73,
+    0x00, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x82, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x4B, 0xD3, 0x64, 0x12,
+    0xDF, 0x64, 0x00, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x83, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x0B,
+    0x13, 0x07, 0x04, 0x08, 0x00, 0x4B, 0x99, 0x64, 0x00, 0x45, 0x05, 0x65, 0x0A, 0x05, 0x65, 0x0B,
+    0x18, 0x65, 0x0C, 0x69, 0x66, 0x0D, 0x05, 0x65, 0x0F, 0x69, 0x66, 0x11, 0x05, 0x65, 0x13, 0x73,
+    0x66, 0x1C, 0x05, 0x65, 0x00, 0x4B, 0x0C, 0x65, 0x13, 0xB5, 0x64, 0x00, 0x13, 0x07, 0x04, 0x08,
+    0x0B, 0x00, 0x84, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x45, 0x2E, 0x65, 0x07, 0x3B, 0x65, 0x0A, 0x2E,
+    0x65, 0x0D, 0x2E, 0x65, 0x11, 0x2E, 0x65, 0x12, 0x5A, 0x65, 0x13, 0x75, 0x65, 0x00, 0x13, 0x07,
+    0x04, 0x08, 0x0B, 0x00, 0x85, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x44, 0x42, 0x65, 0x13, 0x4D,
+    0x65, 0x00, 0x08, 0x0B, 0x00, 0x84, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x04, 0x08, 0x0B,
+    0x00, 0x86, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x47, 0x61, 0x65, 0x13, 0x6D, 0x65,
+    0x00, 0x04, 0x08, 0x0B, 0x00, 0x85, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x07, 0x04, 0x08,
+    0x00, 0x4B, 0x34, 0x65, 0x00, 0x44, 0x8E, 0x65, 0x06, 0xAD, 0x65, 0x07, 0xC6, 0x65, 0x08, 0xAD,
+    0x65, 0x09, 0xAD, 0x65, 0x12, 0x61, 0x66, 0x16, 0xAD, 0x65, 0x1B, 0xAD, 0x65, 0x00, 0x47, 0x95,
+    0x65, 0x08, 0xA2, 0x65, 0x00, 0x08, 0x0B, 0x00, 0x87, 0x61, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65,
+    0x73, 0x00, 0x0B, 0x00, 0x85, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x44, 0xB4, 0x65,
+    0x07, 0xBA, 0x65, 0x00, 0x08, 0x00, 0x4B, 0x51, 0x65, 0x00, 0x04, 0x08, 0x0B, 0x00, 0x86, 0x70,
+    0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x44, 0xE2, 0x65, 0x06, 0x27, 0x66, 0x08, 0x34, 0x66, 0x09,
+    0x27, 0x66, 0x14, 0x50, 0x66, 0x16, 0x50, 0x66, 0x1A, 0x50, 0x66, 0x1B, 0x27, 0x66, 0x1D, 0x50,
+    0x66, 0x00, 0x47, 0xF8, 0x65, 0x0B, 0x16, 0x66, 0x14, 0x21, 0x66, 0x15, 0xF8, 0x65, 0x16, 0x21,
+    0x66, 0x1A, 0xF8, 0x65, 0x1D, 0x21, 0x66, 0x00, 0x48, 0xFF, 0x65, 0x0B, 0x0B, 0x66, 0x00, 0x0B,
+    0x00, 0x88, 0x61, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x88, 0x65, 0x61, 0x64, 0x70,
+    0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00, 0x87, 0x65, 0x61, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73,
+    0x00, 0x08, 0x00, 0x4B, 0x01, 0x66, 0x00, 0x04, 0x08, 0x0B, 0x00, 0x87, 0x64, 0x70, 0x68, 0x6F,
+    0x6E, 0x65, 0x73, 0x00, 0x44, 0x3B, 0x66, 0x0B, 0x46, 0x66, 0x00, 0x48, 0x42, 0x66, 0x0B, 0x0B,
+    0x66, 0x00, 0x4B, 0x2B, 0x66, 0x00, 0x86, 0x61, 0x64, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x73, 0x00,
+    0x44, 0x57, 0x66, 0x08, 0x5D, 0x66, 0x00, 0x08, 0x00, 0x4B, 0x2B, 0x66, 0x00, 0x4B, 0x98, 0x65,
+    0x00, 0x07, 0x04, 0x08, 0x00, 0x4B, 0xBE, 0x65, 0x00, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x00, 0x4B,
+    0x12, 0x65, 0x00, 0x47, 0x7A, 0x66, 0x0B, 0x85, 0x66, 0x00, 0x04, 0x08, 0x0B, 0x00, 0x83, 0x68,
+    0x6F, 0x6E, 0x65, 0x73, 0x00, 0x47, 0x61, 0x65, 0x13, 0x8C, 0x66, 0x00, 0x07, 0x04, 0x08, 0x00,
+    0x4B, 0x12, 0x65, 0x00, 0x46, 0xB3, 0x66, 0x07, 0xBA, 0x66, 0x08, 0xB3, 0x66, 0x09, 0xB3, 0x66,
+    0x0B, 0xD0, 0x66, 0x0F, 0xB3, 0x66, 0x11, 0xE1, 0x66, 0x13, 0xB3, 0x66, 0x16, 0xB3, 0x66, 0x1B,
+    0xB3, 0x66, 0x00, 0x07, 0x00, 0x83, 0x6F, 0x65, 0x73, 0x00, 0x46, 0xCA, 0x66, 0x08, 0xCA, 0x66,
+    0x09, 0xCA, 0x66, 0x16, 0xCA, 0x66, 0x1B, 0xCA, 0x66, 0x00, 0x84, 0x64, 0x6F, 0x65, 0x73, 0x00,
+    0x53, 0xD7, 0x66, 0x17, 0x52, 0x21, 0x00, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x81, 0x6E, 0x65, 0x73,
+    0x00, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x00, 0x4B, 0xD9, 0x64, 0x00, 0x44, 0x87, 0x63, 0x11, 0x39,
+    0x64, 0x00, 0x51, 0x39, 0x64, 0x12, 0xF9, 0x66, 0x00, 0x47, 0x41, 0x64, 0x00, 0x44, 0x2B, 0x64,
+    0x0A, 0xDF, 0x00, 0x11, 0xAB, 0x63, 0x00, 0x45, 0x23, 0x67, 0x09, 0x3A, 0x67, 0x0B, 0x23, 0x67,
+    0x0C, 0x42, 0x67, 0x0D, 0x59, 0x67, 0x10, 0x23, 0x67, 0x11, 0x60, 0x67, 0x17, 0x3A, 0x67, 0x19,
+    0x3A, 0x67, 0x00, 0x4C, 0x2A, 0x67, 0x11, 0x32, 0x67, 0x00, 0x0B, 0x17, 0x00, 0x82, 0x6E, 0x67,
+    0x73, 0x00, 0x0C, 0x0B, 0x17, 0x00, 0x82, 0x67, 0x73, 0x00, 0x11, 0x0C, 0x0B, 0x00, 0x57, 0x36,
+    0x67, 0x00, 0x4B, 0x49, 0x67, 0x11, 0x50, 0x67, 0x00, 0x17, 0x00, 0x81, 0x6E, 0x67, 0x73, 0x00,
+    0x0B, 0x17, 0x00, 0x83, 0x69, 0x6E, 0x67, 0x73, 0x00, 0x0C, 0x0B, 0x00, 0x57, 0x2D, 0x67, 0x00,
+    0x45, 0x79, 0x67, 0x0B, 0x82, 0x67, 0x0C, 0xA1, 0x67, 0x0D, 0x79, 0x67, 0x0E, 0x50, 0x67, 0x10,
+    0x79, 0x67, 0x12, 0xE5, 0x67, 0x18, 0xF8, 0x67, 0x00, 0x0C, 0x0B, 0x17, 0x00, 0x83, 0x6E, 0x67,
+    0x73, 0x00, 0x4C, 0x89, 0x67, 0x17, 0x9B, 0x67, 0x00, 0x4B, 0x90, 0x67, 0x17, 0x94, 0x67, 0x00,
+    0x57, 0x7D, 0x67, 0x00, 0x84, 0x68, 0x69, 0x6E, 0x67, 0x73, 0x00, 0x82, 0x69, 0x6E, 0x67, 0x73,
+    0x00, 0x45, 0xBD, 0x67, 0x0A, 0xBD, 0x67, 0x0B, 0xCC, 0x67, 0x0D, 0xBD, 0x67, 0x0E, 0xD6, 0x67,
+    0x11, 0xBD, 0x67, 0x17, 0xDC, 0x67, 0x18, 0xD6, 0x67, 0x1C, 0xBD, 0x67, 0x00, 0x4B, 0xC4, 0x67,
+    0x17, 0x94, 0x67, 0x00, 0x17, 0x00, 0x84, 0x69, 0x6E, 0x67, 0x73, 0x00, 0x2C, 0x00, 0x84, 0x74,
+    0x68, 0x69, 0x6E, 0x67, 0x73, 0x00, 0x0B, 0x00, 0x57, 0xC6, 0x67, 0x00, 0x2C, 0x00, 0x83, 0x68,
+    0x69, 0x6E, 0x67, 0x73, 0x00, 0x4B, 0xEC, 0x67, 0x0C, 0xF2, 0x67, 0x00, 0x17, 0x00, 0x6C, 0x53,
+    0x67, 0x00, 0x0B, 0x00, 0x57, 0x7D, 0x67, 0x00, 0x4B, 0xFF, 0x67, 0x0C, 0xF2, 0x67, 0x00, 0x57,
+    0x53, 0x67, 0x00, 0x44, 0x10, 0x68, 0x0A, 0xDF, 0x00, 0x11, 0xAB, 0x63, 0x1C, 0x18, 0x68, 0x00,
+    0x1A, 0x0F, 0x04, 0x00, 0x81, 0x79, 0x73, 0x00, 0x04, 0x1A, 0x0F, 0x04, 0x00, 0x81, 0x73, 0x00,
+    0x44, 0x4E, 0x68, 0x05, 0x69, 0x68, 0x07, 0x4E, 0x68, 0x08, 0x4E, 0x68, 0x0A, 0x69, 0x68, 0x0B,
+    0x6F, 0x68, 0x0D, 0x69, 0x68, 0x0E, 0xA0, 0x68, 0x11, 0x69, 0x68, 0x12, 0xA0, 0x68, 0x16, 0xAB,
+    0x68, 0x18, 0xA0, 0x68, 0x1A, 0x4E, 0x68, 0x1B, 0x4E, 0x68, 0x1C, 0xEC, 0x69, 0x00, 0x56, 0x55,
+    0x68, 0x1C, 0x5F, 0x68, 0x00, 0x1C, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x82, 0x69, 0x73, 0x00, 0x0F,
+    0x04, 0x11, 0x04, 0x00, 0x82, 0x73, 0x69, 0x73, 0x00, 0x0B, 0x00, 0x57, 0x5B, 0x68, 0x00, 0x45,
+    0x85, 0x68, 0x0A, 0x85, 0x68, 0x0D, 0x85, 0x68, 0x11, 0x85, 0x68, 0x15, 0x85, 0x68, 0x17, 0x8C,
+    0x68, 0x1C, 0x85, 0x68, 0x00, 0x17, 0x00, 0x83, 0x68, 0x69, 0x73, 0x00, 0x4A, 0x96, 0x68, 0x15,
+    0x9C, 0x68, 0x1C, 0x9C, 0x68, 0x00, 0x84, 0x74, 0x68, 0x69, 0x73, 0x00, 0x6C, 0x96, 0x68, 0x00,
+    0x4B, 0xA7, 0x68, 0x16, 0x55, 0x68, 0x00, 0x57, 0x5B, 0x68, 0x00, 0x44, 0xCA, 0x68, 0x07, 0xCA,
+    0x68, 0x08, 0xCA, 0x68, 0x0B, 0xD5, 0x68, 0x0F, 0xEE, 0x68, 0x17, 0xD5, 0x68, 0x18, 0xD5, 0x68,
+    0x1A, 0xCA, 0x68, 0x1B, 0xCA, 0x68, 0x1C, 0x09, 0x69, 0x00, 0x1C, 0x0F, 0x04, 0x11, 0x04, 0x00,
+    0x83, 0x73, 0x69, 0x73, 0x00, 0x4F, 0xDC, 0x68, 0x1C, 0xE6, 0x68, 0x00, 0x04, 0x11, 0x04, 0x00,
+    0x83, 0x79, 0x73, 0x69, 0x73, 0x00, 0x0F, 0x04, 0x11, 0x00, 0x44, 0xD0, 0x68, 0x00, 0x44, 0xF5,
+    0x68, 0x1C, 0xFE, 0x68, 0x00, 0x11, 0x04, 0x00, 0x82, 0x79, 0x73, 0x69, 0x73, 0x00, 0x04, 0x11,
+    0x04, 0x00, 0x84, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x44, 0x1F, 0x69, 0x0B, 0x3A, 0x69, 0x0E,
+    0x45, 0x69, 0x0F, 0x59, 0x69, 0x12, 0x45, 0x69, 0x17, 0x3A, 0x69, 0x18, 0x3A, 0x69, 0x00, 0x4F,
+    0x26, 0x69, 0x11, 0x31, 0x69, 0x00, 0x11, 0x04, 0x00, 0x85, 0x61, 0x6C, 0x79, 0x73, 0x69, 0x73,
+    0x00, 0x04, 0x00, 0x83, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x84,
+    0x79, 0x73, 0x69, 0x73, 0x00, 0x44, 0x4C, 0x69, 0x0F, 0x52, 0x69, 0x00, 0x11, 0x00, 0x44, 0x02,
+    0x69, 0x00, 0x04, 0x11, 0x00, 0x44, 0x3F, 0x69, 0x00, 0x44, 0x72, 0x69, 0x0E, 0xC6, 0x69, 0x11,
+    0xD1, 0x69, 0x12, 0xC6, 0x69, 0x14, 0xDB, 0x69, 0x16, 0xDB, 0x69, 0x1A, 0xDB, 0x69, 0x1D, 0xDB,
+    0x69, 0x00, 0x44, 0x91, 0x69, 0x05, 0x9A, 0x69, 0x0B, 0x9A, 0x69, 0x0D, 0x9A, 0x69, 0x10, 0x9A,
+    0x69, 0x11, 0xB4, 0x69, 0x14, 0xC0, 0x69, 0x16, 0xC0, 0x69, 0x1A, 0xC0, 0x69, 0x1D, 0xC0, 0x69,
+    0x00, 0x85, 0x6E, 0x61, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x44, 0xA1, 0x69, 0x11, 0xAA, 0x69,
+    0x00, 0x86, 0x6E, 0x61, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x04, 0x00, 0x86, 0x61, 0x6C, 0x79,
+    0x73, 0x69, 0x73, 0x00, 0x2C, 0x00, 0x86, 0x61, 0x6E, 0x61, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00,
+    0x11, 0x00, 0x44, 0xAC, 0x69, 0x00, 0x04, 0x11, 0x04, 0x00, 0x85, 0x6C, 0x79, 0x73, 0x69, 0x73,
+    0x00, 0x04, 0x00, 0x84, 0x61, 0x6C, 0x79, 0x73, 0x69, 0x73, 0x00, 0x44, 0xE2, 0x69, 0x11, 0xE8,
+    0x69, 0x00, 0x11, 0x00, 0x44, 0xCA, 0x69, 0x00, 0x44, 0x29, 0x69, 0x00, 0x4F, 0xF3, 0x69, 0x16,
+    0xFC, 0x69, 0x00, 0x04, 0x11, 0x04, 0x00, 0x81, 0x73, 0x69, 0x73, 0x00, 0x0F, 0x04, 0x11, 0x00,
+    0x44, 0xE0, 0x68, 0x00, 0x4C, 0x0B, 0x6A, 0x16, 0x11, 0x6A, 0x00, 0x0B, 0x17, 0x00, 0x81, 0x73,
+    0x00, 0x1C, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x81, 0x69, 0x73, 0x00, 0x48, 0x70, 0x64, 0x0A, 0x59,
+    0x67, 0x12, 0x25, 0x6A, 0x00, 0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x80, 0x65, 0x73, 0x00,
+    0x16, 0x1C, 0x0F, 0x04, 0x11, 0x00, 0x44, 0x17, 0x6A, 0x00, 0x44, 0x50, 0x6A, 0x08, 0x75, 0x6A,
+    0x11, 0x8A, 0x6A, 0x14, 0x95, 0x6A, 0x16, 0x9B, 0x6A, 0x1A, 0x95, 0x6A, 0x1D, 0x95, 0x6A, 0x00,
+    0x47, 0x60, 0x6A, 0x08, 0x68, 0x6A, 0x15, 0x60, 0x6A, 0x1A, 0x60, 0x6A, 0x1C, 0x71, 0x6A, 0x00,
+    0x1C, 0x00, 0x83, 0x65, 0x61, 0x72, 0x73, 0x00, 0x18, 0x00, 0x84, 0x79, 0x65, 0x61, 0x72, 0x73,
+    0x00, 0x48, 0x6A, 0x6A, 0x00, 0x44, 0x60, 0x6A, 0x11, 0x7F, 0x6A, 0x12, 0xCC, 0x63, 0x00, 0x12,
+    0x0B, 0x13, 0x07, 0x04, 0x08, 0x0B, 0x00, 0x81, 0x73, 0x00, 0x12, 0x0B, 0x13, 0x07, 0x04, 0x08,
+    0x00, 0x4B, 0xF8, 0x63, 0x00, 0x08, 0x00, 0x5C, 0x8F, 0x63, 0x00, 0x44, 0xA2, 0x6A, 0x08, 0x8D,
+    0x63, 0x00, 0x08, 0x1C, 0x00, 0x82, 0x72, 0x73, 0x00, 0x1C, 0x0F, 0x04, 0x11, 0x04, 0x00, 0x80,
+    0x69, 0x73, 0x00, 0x74, 0xC6, 0x6A, 0x04, 0xCD, 0x6A, 0x0A, 0xDF, 0x00, 0x11, 0xAB, 0x63, 0x15,
+    0xDE, 0x6A, 0x1C, 0x18, 0x68, 0x00, 0x04, 0x0B, 0x00, 0x57, 0xEA, 0x62, 0x00, 0x48, 0xD4, 0x6A,
+    0x1A, 0xD8, 0x6A, 0x00, 0x5C, 0x2E, 0x64, 0x00, 0x0F, 0x00, 0x44, 0x14, 0x68, 0x00, 0x0C, 0x09,
+    0x00, 0x81, 0x73, 0x74, 0x00, 0x44, 0x10, 0x68, 0x0C, 0xF2, 0x6A, 0x16, 0x11, 0x6A, 0x1C, 0x18,
+    0x68, 0x00, 0x0B, 0x17, 0x2C, 0x00, 0x81, 0x73, 0x00, 0x74, 0x74, 0x63, 0x08, 0x7A, 0x63, 0x0C,
+    0x0B, 0x6A, 0x11, 0x8A, 0x6A, 0x12, 0x09, 0x6B, 0x00, 0x11, 0x0E, 0x00, 0x80, 0x00, 0x74, 0x74,
+    0x63, 0x08, 0x7A, 0x63, 0x0C, 0x0B, 0x6A, 0x00, 0x44, 0x31, 0x6B, 0x0B, 0xB9, 0x6B, 0x14, 0xC1,
+    0x6B, 0x16, 0x9B, 0x63, 0x17, 0xB9, 0x6B, 0x18, 0xB9, 0x6B, 0x1A, 0xD5, 0x6B, 0x1D, 0xC1, 0x6B,
+    0x00, 0x44, 0x47, 0x6B, 0x08, 0x59, 0x6B, 0x0F, 0x68, 0x6B, 0x14, 0x59, 0x6B, 0x16, 0x59, 0x6B,
+    0x1A, 0x72, 0x6B, 0x1D, 0xB2, 0x6B, 0x00, 0x4F, 0x4E, 0x6B, 0x1A, 0x52, 0x6B, 0x00, 0x44, 0xBB,
+    0x0F, 0x00, 0x0F, 0x04, 0x00, 0x82, 0x79, 0x73, 0x00, 0x4F, 0x4E, 0x6B, 0x1A, 0x60, 0x6B, 0x00,
+    0x0F, 0x04, 0x00, 0x83, 0x61, 0x79, 0x73, 0x00, 0x1A, 0x04, 0x00, 0x84, 0x6C, 0x77, 0x61, 0x79,
+    0x73, 0x00, 0x44, 0x8B, 0x6B, 0x08, 0x94, 0x6B, 0x0E, 0x9D, 0x6B, 0x0F, 0xA8, 0x6B, 0x12, 0x9D,
+    0x6B, 0x14, 0x94, 0x6B, 0x16, 0x94, 0x6B, 0x1A, 0x60, 0x6B, 0x00, 0x2C, 0x00, 0x83, 0x6C, 0x77,
+    0x61, 0x79, 0x73, 0x00, 0x0F, 0x04, 0x00, 0x84, 0x77, 0x61, 0x79, 0x73, 0x00, 0x44, 0x6B, 0x6B,
+    0x0F, 0xA4, 0x6B, 0x00, 0x44, 0x97, 0x6B, 0x00, 0x2C, 0x00, 0x84, 0x61, 0x6C, 0x77, 0x61, 0x79,
+    0x73, 0x00, 0x1A, 0x0F, 0x00, 0x44, 0x63, 0x6B, 0x00, 0x04, 0x1A, 0x0F, 0x00, 0x44, 0x55, 0x6B,
+    0x00, 0x44, 0xC8, 0x6B, 0x1A, 0xCF, 0x6B, 0x00, 0x1A, 0x0F, 0x00, 0x44, 0x55, 0x6B, 0x00, 0x0F,
+    0x00, 0x44, 0x9F, 0x63, 0x00, 0x44, 0x47, 0x6B, 0x0F, 0xDF, 0x6B, 0x1A, 0xCF, 0x6B, 0x00, 0x04,
+    0x00, 0x81, 0x61, 0x79, 0x73, 0x00, 0x74, 0x2F, 0x6C, 0x04, 0x52, 0x6D, 0x05, 0xA4, 0x6E, 0x06,
+    0xCA, 0x6E, 0x07, 0x67, 0x6F, 0x08, 0x99, 0x6F, 0x09, 0xC7, 0x6F, 0x0A, 0xCE, 0x6F, 0x0B, 0x15,
+    0x70, 0x0C, 0xE1, 0x70, 0x0D, 0xF2, 0x71, 0x0E, 0x0F, 0x72, 0x10, 0x1E, 0x72, 0x11, 0x36, 0x72,
+    0x12, 0xF3, 0x72, 0x14, 0xFA, 0x72, 0x15, 0x15, 0x73, 0x16, 0x82, 0x73, 0x18, 0x5C, 0x75, 0x19,
+    0x08, 0x76, 0x1A, 0x0F, 0x76, 0x1B, 0x67, 0x6F, 0x1C, 0x1C, 0x76, 0x1D, 0xFA, 0x72, 0x00, 0x44,
+    0x45, 0x6C, 0x05, 0x4E, 0x6C, 0x0B, 0x4E, 0x6C, 0x0D, 0x4E, 0x6C, 0x10, 0x4E, 0x6C, 0x11, 0x74,
+    0x6C, 0x12, 0x4C, 0x6D, 0x00, 0x11, 0x06, 0x00, 0x83, 0x61, 0x6E, 0x27, 0x74, 0x00, 0x44, 0x58,
+    0x6C, 0x11, 0x5F, 0x6C, 0x12, 0x70, 0x6C, 0x00, 0x06, 0x00, 0x82, 0x6E, 0x27, 0x74, 0x00, 0x44,
+    0x66, 0x6C, 0x12, 0x6C, 0x6C, 0x00, 0x06, 0x00, 0x82, 0x27, 0x74, 0x00, 0x47, 0x68, 0x6C, 0x00,
+    0x47, 0x5A, 0x6C, 0x00, 0x44, 0xA2, 0x6C, 0x05, 0xDE, 0x6C, 0x06, 0xF0, 0x6C, 0x07, 0xF4, 0x6C,
+    0x0B, 0xDE, 0x6C, 0x0C, 0xFD, 0x6C, 0x0D, 0xDE, 0x6C, 0x0F, 0xFD, 0x6C, 0x10, 0xDE, 0x6C, 0x12,
+    0x0A, 0x6D, 0x13, 0xFD, 0x6C, 0x14, 0x45, 0x6D, 0x16, 0x45, 0x6D, 0x1A, 0x45, 0x6D, 0x1D, 0x45,
+    0x6D, 0x00, 0x46, 0xBB, 0x6C, 0x07, 0xCF, 0x6C, 0x14, 0xD6, 0x6C, 0x16, 0xCF, 0x6C, 0x19, 0xCF,
+    0x6C, 0x1A, 0xD6, 0x6C, 0x1B, 0xCF, 0x6C, 0x1D, 0xD6, 0x6C, 0x00, 0x47, 0xC8, 0x6C, 0x16, 0xC8,
+    0x6C, 0x19, 0xC8, 0x6C, 0x1B, 0xC8, 0x6C, 0x00, 0x85, 0x63, 0x61, 0x6E, 0x27, 0x74, 0x00, 0x84,
+    0x63, 0x61, 0x6E, 0x27, 0x74, 0x00, 0x06, 0x00, 0x84, 0x61, 0x6E, 0x27, 0x74, 0x00, 0x44, 0xE5,
+    0x6C, 0x12, 0xEC, 0x6C, 0x00, 0x06, 0x00, 0x83, 0x6E, 0x27, 0x74, 0x00, 0x47, 0xE7, 0x6C, 0x00,
+    0x44, 0xCF, 0x6C, 0x00, 0x12, 0x00, 0x84, 0x64, 0x6F, 0x6E, 0x27, 0x74, 0x00, 0x47, 0x04, 0x6D,
+    0x12, 0xEC, 0x6C, 0x00, 0x83, 0x6F, 0x6E, 0x27, 0x74, 0x00, 0x46, 0xF6, 0x6C, 0x07, 0x26, 0x6D,
+    0x08, 0xF6, 0x6C, 0x09, 0xF6, 0x6C, 0x0C, 0x3D, 0x6D, 0x0F, 0x3D, 0x6D, 0x13, 0x3D, 0x6D, 0x16,
+    0xF6, 0x6C, 0x1B, 0xF6, 0x6C, 0x00, 0x46, 0x36, 0x6D, 0x08, 0x36, 0x6D, 0x09, 0x36, 0x6D, 0x16,
+    0x36, 0x6D, 0x1B, 0x36, 0x6D, 0x00, 0x85, 0x64, 0x6F, 0x6E, 0x27, 0x74, 0x00, 0x07, 0x00, 0x84,
+    0x6F, 0x6E, 0x27, 0x74, 0x00, 0x44, 0xE5, 0x6C, 0x06, 0x48, 0x6C, 0x00, 0x11, 0x00, 0x47, 0x04,
+    0x6D, 0x00, 0x45, 0x7A, 0x6D, 0x07, 0x83, 0x6D, 0x08, 0x97, 0x6D, 0x0A, 0x7A, 0x6D, 0x0B, 0x06,
+    0x6E, 0x0D, 0x7A, 0x6D, 0x11, 0x7A, 0x6D, 0x14, 0x5C, 0x6E, 0x15, 0x63, 0x6E, 0x16, 0x71, 0x6E,
+    0x1A, 0x96, 0x6E, 0x1C, 0x7A, 0x6D, 0x1D, 0x5C, 0x6E, 0x00, 0x0B, 0x00, 0x57, 0x5B, 0x11, 0x1A,
+    0x5B, 0x11, 0x00, 0x48, 0x8A, 0x6D, 0x15, 0x90, 0x6D, 0x00, 0x15, 0x00, 0x4A, 0x5B, 0x11, 0x00,
+    0x0A, 0x00, 0x82, 0x65, 0x61, 0x74, 0x00, 0x47, 0xAD, 0x6D, 0x08, 0xB5, 0x6D, 0x09, 0xC6, 0x6D,
+    0x0A, 0xD1, 0x6D, 0x15, 0xDB, 0x6D, 0x17, 0xC6, 0x6D, 0x1A, 0xAD, 0x6D, 0x00, 0x15, 0x0A, 0x00,
+    0x83, 0x65, 0x61, 0x74, 0x00, 0x4A, 0xBC, 0x6D, 0x15, 0xC2, 0x6D, 0x00, 0x83, 0x72, 0x65, 0x61,
+    0x74, 0x00, 0x4A, 0x5B, 0x11, 0x00, 0x4A, 0xBC, 0x6D, 0x15, 0xCD, 0x6D, 0x00, 0x4A, 0xB0, 0x6D,
+    0x00, 0x15, 0x2C, 0x00, 0x84, 0x67, 0x72, 0x65, 0x61, 0x74, 0x00, 0x48, 0xEE, 0x6D, 0x0A, 0xF2,
+    0x6D, 0x0B, 0x02, 0x6E, 0x15, 0xCD, 0x6D, 0x17, 0xEE, 0x6D, 0x19, 0xD4, 0x6D, 0x00, 0x4A, 0x25,
+    0x10, 0x00, 0x45, 0x0A, 0x10, 0x09, 0x0A, 0x10, 0x0B, 0x0A, 0x10, 0x17, 0x0A, 0x10, 0x19, 0x0A,
+    0x10, 0x00, 0x6C, 0xD4, 0x6D, 0x00, 0x44, 0x2B, 0x6E, 0x05, 0x32, 0x6E, 0x08, 0x2B, 0x6E, 0x0A,
+    0x32, 0x6E, 0x0D, 0x32, 0x6E, 0x11, 0x32, 0x6E, 0x14, 0x2B, 0x6E, 0x15, 0x39, 0x6E, 0x16, 0x2B,
+    0x6E, 0x17, 0x3D, 0x6E, 0x1A, 0x45, 0x6E, 0x1C, 0x32, 0x6E, 0x00, 0x1A, 0x00, 0x83, 0x68, 0x61,
+    0x74, 0x00, 0x57, 0x2D, 0x6E, 0x1A, 0x2D, 0x6E, 0x00, 0x57, 0x2D, 0x6E, 0x00, 0x15, 0x00, 0x84,
+    0x74, 0x68, 0x61, 0x74, 0x00, 0x44, 0x52, 0x6E, 0x08, 0x58, 0x6E, 0x14, 0x52, 0x6E, 0x16, 0x52,
+    0x6E, 0x00, 0x84, 0x77, 0x68, 0x61, 0x74, 0x00, 0x6C, 0x52, 0x6E, 0x00, 0x48, 0x8A, 0x6D, 0x0B,
+    0x7C, 0x6D, 0x00, 0x48, 0x8A, 0x6D, 0x0C, 0x6D, 0x6E, 0x15, 0x90, 0x6D, 0x00, 0x49, 0xE1, 0x6A,
+    0x00, 0x44, 0x81, 0x6E, 0x08, 0x85, 0x6E, 0x0B, 0x7C, 0x6D, 0x15, 0x8C, 0x6E, 0x18, 0x92, 0x6E,
+    0x00, 0x4F, 0x2A, 0x08, 0x00, 0x45, 0x2A, 0x08, 0x15, 0xC2, 0x6D, 0x00, 0x0C, 0x09, 0x00, 0x81,
+    0x74, 0x00, 0x4D, 0x2A, 0x08, 0x00, 0x48, 0x8A, 0x6D, 0x0B, 0xA0, 0x6E, 0x15, 0x90, 0x6D, 0x00,
+    0x5A, 0x5B, 0x11, 0x00, 0x4A, 0xAE, 0x6E, 0x0B, 0xB4, 0x6E, 0x11, 0xBB, 0x6E, 0x00, 0x0C, 0x00,
+    0x55, 0x6F, 0x42, 0x00, 0x0A, 0x0C, 0x15, 0x00, 0x81, 0x74, 0x00, 0x44, 0xC2, 0x6E, 0x18, 0xC6,
+    0x6E, 0x00, 0x5A, 0x2A, 0x08, 0x00, 0x46, 0x2A, 0x08, 0x00, 0x44, 0xE3, 0x6E, 0x07, 0x3F, 0x6F,
+    0x14, 0x46, 0x6F, 0x16, 0x46, 0x6F, 0x19, 0x3F, 0x6F, 0x1A, 0x46, 0x6F, 0x1B, 0x5A, 0x6F, 0x1D,
+    0x46, 0x6F, 0x00, 0x46, 0xF9, 0x6E, 0x08, 0x0A, 0x6F, 0x14, 0xF9, 0x0F, 0x16, 0xF9, 0x6E, 0x1A,
+    0xF9, 0x0F, 0x1B, 0x13, 0x6F, 0x1D, 0xF9, 0x6E, 0x00, 0x48, 0x00, 0x6F, 0x1B, 0x06, 0x6F, 0x00,
+    0x83, 0x78, 0x61, 0x63, 0x74, 0x00, 0x48, 0xFC, 0x0F, 0x00, 0x1B, 0x00, 0x84, 0x65, 0x78, 0x61,
+    0x63, 0x74, 0x00, 0x46, 0x29, 0x6F, 0x07, 0x0C, 0x6F, 0x08, 0x31, 0x6F, 0x15, 0x0C, 0x6F, 0x16,
+    0x29, 0x6F, 0x1A, 0x0C, 0x6F, 0x1D, 0x29, 0x6F, 0x00, 0x08, 0x00, 0x84, 0x78, 0x61, 0x63, 0x74,
+    0x00, 0x47, 0x38, 0x6F, 0x1A, 0x38, 0x6F, 0x00, 0x85, 0x65, 0x78, 0x61, 0x63, 0x74, 0x00, 0x04,
+    0x1B, 0x00, 0x48, 0x0F, 0x11, 0x00, 0x44, 0x4D, 0x6F, 0x1B, 0x53, 0x6F, 0x00, 0x1B, 0x00, 0x48,
+    0x0F, 0x11, 0x00, 0x08, 0x00, 0x82, 0x61, 0x63, 0x74, 0x00, 0x04, 0x00, 0x48, 0x00, 0x6F, 0x1B,
+    0x63, 0x6F, 0x00, 0x48, 0x0F, 0x11, 0x00, 0x44, 0x74, 0x6F, 0x06, 0x7A, 0x6F, 0x15, 0xDE, 0x6A,
+    0x16, 0x81, 0x6F, 0x00, 0x1B, 0x00, 0x48, 0xA1, 0x17, 0x00, 0x04, 0x1B, 0x08, 0x00, 0x81, 0x74,
+    0x00, 0x44, 0x81, 0x6E, 0x08, 0x91, 0x6F, 0x12, 0x95, 0x6F, 0x15, 0x8C, 0x6E, 0x18, 0x92, 0x6E,
+    0x00, 0x45, 0x2A, 0x08, 0x00, 0x50, 0x2A, 0x08, 0x00, 0x44, 0xA9, 0x6F, 0x0B, 0xB6, 0x6F, 0x16,
+    0xBD, 0x6F, 0x17, 0x85, 0x37, 0x19, 0x12, 0x24, 0x00, 0x55, 0x90, 0x6D, 0x17, 0xB0, 0x6F, 0x00,
+    0x16, 0x00, 0x81, 0x74, 0x65, 0x00, 0x17, 0x12, 0x2C, 0x00, 0x80, 0x72, 0x00, 0x44, 0x81, 0x6E,
+    0x15, 0x8C, 0x6E, 0x18, 0x92, 0x6E, 0x00, 0x15, 0x04, 0x13, 0x00, 0x81, 0x74, 0x00, 0x44, 0xE4,
+    0x6F, 0x0A, 0xAE, 0x6E, 0x0B, 0xED, 0x6F, 0x0C, 0xF5, 0x6F, 0x11, 0xFB, 0x6F, 0x15, 0x02, 0x70,
+    0x16, 0x08, 0x70, 0x00, 0x0B, 0x00, 0x57, 0x2A, 0x08, 0x1A, 0x2A, 0x08, 0x00, 0x0C, 0x15, 0x00,
+    0x82, 0x67, 0x68, 0x74, 0x00, 0x0B, 0x16, 0x00, 0x81, 0x74, 0x00, 0x4C, 0xCA, 0x15, 0x18, 0xC6,
+    0x6E, 0x00, 0x04, 0x13, 0x00, 0x81, 0x74, 0x00, 0x44, 0x81, 0x6E, 0x08, 0x91, 0x6F, 0x12, 0x95,
+    0x6F, 0x18, 0x92, 0x6E, 0x00, 0x45, 0x34, 0x70, 0x09, 0x34, 0x70, 0x0A, 0x46, 0x70, 0x0B, 0xBD,
+    0x70, 0x0C, 0xCA, 0x70, 0x0D, 0xD0, 0x70, 0x11, 0xD7, 0x70, 0x17, 0xED, 0x6F, 0x19, 0x34, 0x70,
+    0x1C, 0xD0, 0x70, 0x00, 0x4A, 0x3B, 0x70, 0x0C, 0x42, 0x70, 0x00, 0x0C, 0x15, 0x00, 0x82, 0x68,
+    0x74, 0x00, 0x55, 0xF0, 0x6F, 0x00, 0x45, 0x68, 0x70, 0x09, 0x68, 0x70, 0x0A, 0x3B, 0x70, 0x0B,
+    0x68, 0x70, 0x0C, 0x70, 0x70, 0x0E, 0xA3, 0x70, 0x12, 0xA3, 0x70, 0x15, 0xB4, 0x70, 0x17, 0x68,
+    0x70, 0x18, 0xA3, 0x70, 0x19, 0x68, 0x70, 0x00, 0x0C, 0x15, 0x00, 0x83, 0x67, 0x68, 0x74, 0x00,
+    0x48, 0x86, 0x70, 0x09, 0x8F, 0x70, 0x0E, 0x8F, 0x70, 0x12, 0x8F, 0x70, 0x15, 0x93, 0x70, 0x17,
+    0x86, 0x70, 0x18, 0x8F, 0x70, 0x00, 0x15, 0x2C, 0x00, 0x84, 0x69, 0x67, 0x68, 0x74, 0x00, 0x55,
+    0x89, 0x70, 0x00, 0x48, 0x9A, 0x70, 0x17, 0x9A, 0x70, 0x00, 0x2C, 0x00, 0x85, 0x72, 0x69, 0x67,
+    0x68, 0x74, 0x00, 0x4C, 0xAA, 0x70, 0x15, 0xAE, 0x70, 0x00, 0x55, 0x6B, 0x70, 0x00, 0x83, 0x69,
+    0x67, 0x68, 0x74, 0x00, 0x0C, 0x00, 0x84, 0x72, 0x69, 0x67, 0x68, 0x74, 0x00, 0x4A, 0xC4, 0x70,
+    0x0C, 0x42, 0x70, 0x00, 0x0C, 0x15, 0x00, 0x81, 0x74, 0x00, 0x0A, 0x00, 0x55, 0xAE, 0x70, 0x00,
+    0x0A, 0x0C, 0x00, 0x55, 0x3E, 0x70, 0x00, 0x44, 0xC2, 0x6E, 0x0A, 0x3B, 0x70, 0x18, 0xC6, 0x6E,
+    0x00, 0x45, 0x00, 0x71, 0x0A, 0x00, 0x71, 0x0B, 0x06, 0x71, 0x0D, 0x43, 0x71, 0x0E, 0x43, 0x71,
+    0x10, 0x5F, 0x71, 0x11, 0x43, 0x71, 0x12, 0xD2, 0x71, 0x18, 0xE2, 0x71, 0x1C, 0x00, 0x71, 0x00,
+    0x0B, 0x00, 0x56, 0xB0, 0x11, 0x00, 0x44, 0x25, 0x71, 0x05, 0x25, 0x71, 0x07, 0x25, 0x71, 0x08,
+    0x25, 0x71, 0x0A, 0x25, 0x71, 0x0D, 0x25, 0x71, 0x11, 0x25, 0x71, 0x16, 0x2C, 0x71, 0x1B, 0x25,
+    0x71, 0x1C, 0x25, 0x71, 0x00, 0x16, 0x00, 0x83, 0x68, 0x69, 0x74, 0x00, 0x47, 0x39, 0x71, 0x08,
+    0x3F, 0x71, 0x1A, 0x39, 0x71, 0x1B, 0x39, 0x71, 0x00, 0x84, 0x73, 0x68, 0x69, 0x74, 0x00, 0x6C,
+    0x39, 0x71, 0x00, 0x4B, 0x4A, 0x71, 0x10, 0x4E, 0x71, 0x00, 0x56, 0xB0, 0x11, 0x00, 0x50, 0x55,
+    0x71, 0x12, 0x5B, 0x71, 0x00, 0x12, 0x00, 0x46, 0xB0, 0x11, 0x00, 0x46, 0xA1, 0x10, 0x00, 0x4D,
+    0x6F, 0x71, 0x0E, 0x6F, 0x71, 0x10, 0x86, 0x71, 0x11, 0x6F, 0x71, 0x12, 0xCC, 0x71, 0x00, 0x50,
+    0x76, 0x71, 0x12, 0x7E, 0x71, 0x00, 0x12, 0x06, 0x00, 0x83, 0x6D, 0x69, 0x74, 0x00, 0x06, 0x00,
+    0x83, 0x6D, 0x6D, 0x69, 0x74, 0x00, 0x46, 0x9F, 0x71, 0x0C, 0xA6, 0x71, 0x0D, 0xBC, 0x71, 0x0E,
+    0xBC, 0x71, 0x0F, 0xA6, 0x71, 0x11, 0xBC, 0x71, 0x12, 0xC2, 0x71, 0x13, 0xA6, 0x71, 0x00, 0x83,
+    0x6F, 0x6D, 0x6D, 0x69, 0x74, 0x00, 0x46, 0xAD, 0x71, 0x12, 0xB4, 0x71, 0x00, 0x84, 0x6F, 0x6D,
+    0x6D, 0x69, 0x74, 0x00, 0x06, 0x00, 0x84, 0x6D, 0x6D, 0x69, 0x74, 0x00, 0x12, 0x00, 0x46, 0xB6,
+    0x71, 0x00, 0x2C, 0x00, 0x84, 0x63, 0x6F, 0x6D, 0x6D, 0x69, 0x74, 0x00, 0x10, 0x00, 0x46, 0xAD,
+    0x71, 0x00, 0x45, 0xDC, 0x71, 0x0B, 0x4A, 0x71, 0x10, 0xAC, 0x11, 0x00, 0x04, 0x00, 0x81, 0x75,
+    0x74, 0x00, 0x4B, 0x4A, 0x71, 0x10, 0xAC, 0x11, 0x12, 0xEC, 0x71, 0x00, 0x05, 0x04, 0x00, 0x81,
+    0x74, 0x00, 0x4A, 0xAE, 0x6E, 0x0B, 0xB4, 0x6E, 0x11, 0xBB, 0x6E, 0x12, 0x02, 0x72, 0x18, 0x08,
+    0x72, 0x00, 0x05, 0x00, 0x44, 0xDE, 0x71, 0x00, 0x12, 0x05, 0x04, 0x00, 0x81, 0x74, 0x00, 0x4C,
+    0xF5, 0x6F, 0x10, 0x16, 0x72, 0x00, 0x10, 0x12, 0x06, 0x00, 0x81, 0x69, 0x74, 0x00, 0x4C, 0x28,
+    0x72, 0x10, 0x2F, 0x72, 0x11, 0xBB, 0x6E, 0x00, 0x10, 0x12, 0x00, 0x46, 0xA1, 0x10, 0x00, 0x12,
+    0x06, 0x00, 0x80, 0x69, 0x74, 0x00, 0x74, 0x5E, 0x72, 0x04, 0x65, 0x72, 0x05, 0x95, 0x72, 0x0A,
+    0xAE, 0x6E, 0x0B, 0xA0, 0x72, 0x0C, 0xAA, 0x72, 0x0D, 0x95, 0x72, 0x10, 0x95, 0x72, 0x14, 0xB4,
+    0x72, 0x18, 0xBA, 0x72, 0x1A, 0xB4, 0x72, 0x1C, 0xED, 0x72, 0x1D, 0xB4, 0x72, 0x00, 0x44, 0x58,
+    0x6C, 0x12, 0x70, 0x6C, 0x00, 0x44, 0x78, 0x72, 0x08, 0x7E, 0x72, 0x14, 0x7E, 0x72, 0x16, 0x7E,
+    0x72, 0x1A, 0x85, 0x72, 0x1D, 0x7E, 0x72, 0x00, 0x1A, 0x00, 0x82, 0x6E, 0x74, 0x00, 0x1A, 0x00,
+    0x83, 0x61, 0x6E, 0x74, 0x00, 0x48, 0x8F, 0x72, 0x14, 0x8F, 0x72, 0x1A, 0x80, 0x72, 0x00, 0x84,
+    0x77, 0x61, 0x6E, 0x74, 0x00, 0x44, 0x78, 0x72, 0x18, 0x9C, 0x72, 0x00, 0x46, 0x7A, 0x72, 0x00,
+    0x44, 0x78, 0x72, 0x0A, 0xC4, 0x70, 0x18, 0x9C, 0x72, 0x00, 0x48, 0x2F, 0x16, 0x12, 0x33, 0x16,
+    0x18, 0x9C, 0x72, 0x00, 0x04, 0x00, 0x5A, 0x7A, 0x72, 0x00, 0x46, 0xD3, 0x72, 0x07, 0xE6, 0x72,
+    0x0C, 0xE6, 0x72, 0x0D, 0xE6, 0x72, 0x16, 0xE6, 0x72, 0x19, 0xE6, 0x72, 0x1B, 0xE6, 0x72, 0x1C,
+    0xE6, 0x72, 0x00, 0x47, 0xE0, 0x72, 0x16, 0xE0, 0x72, 0x19, 0xE0, 0x72, 0x1B, 0xE0, 0x72, 0x00,
+    0x84, 0x63, 0x75, 0x6E, 0x74, 0x00, 0x06, 0x00, 0x83, 0x75, 0x6E, 0x74, 0x00, 0x18, 0x00, 0x46,
+    0x7A, 0x72, 0x00, 0x0C, 0x0B, 0x16, 0x00, 0x81, 0x74, 0x00, 0x44, 0x01, 0x73, 0x08, 0x0E, 0x73,
+    0x00, 0x48, 0x08, 0x73, 0x0B, 0xE6, 0x6F, 0x00, 0x15, 0x0A, 0x00, 0x81, 0x74, 0x00, 0x15, 0x0A,
+    0x00, 0x81, 0x61, 0x74, 0x00, 0x44, 0x3A, 0x73, 0x08, 0x5D, 0x73, 0x09, 0x5D, 0x73, 0x0C, 0xB5,
+    0x37, 0x11, 0xBB, 0x6E, 0x14, 0x5D, 0x73, 0x15, 0x02, 0x70, 0x16, 0x64, 0x73, 0x17, 0x5D, 0x73,
+    0x18, 0xBB, 0x37, 0x1A, 0x5D, 0x73, 0x1D, 0x5D, 0x73, 0x00, 0x52, 0x4D, 0x73, 0x13, 0x54, 0x73,
+    0x14, 0x4D, 0x73, 0x16, 0x4D, 0x73, 0x1A, 0x4D, 0x73, 0x1D, 0x4D, 0x73, 0x00, 0x13, 0x00, 0x83,
+    0x61, 0x72, 0x74, 0x00, 0x12, 0x2C, 0x00, 0x84, 0x70, 0x61, 0x72, 0x74, 0x00, 0x04, 0x13, 0x00,
+    0x82, 0x72, 0x74, 0x00, 0x44, 0x74, 0x73, 0x08, 0x91, 0x6F, 0x0C, 0x7B, 0x73, 0x12, 0x95, 0x6F,
+    0x18, 0x92, 0x6E, 0x00, 0x4F, 0x2A, 0x08, 0x13, 0x60, 0x73, 0x00, 0x09, 0x00, 0x82, 0x72, 0x73,
+    0x74, 0x00, 0x44, 0xB6, 0x73, 0x06, 0x7A, 0x6F, 0x07, 0x08, 0x74, 0x08, 0x16, 0x74, 0x09, 0x48,
+    0x74, 0x0C, 0x4F, 0x74, 0x0D, 0x56, 0x74, 0x0F, 0x5C, 0x74, 0x12, 0x62, 0x74, 0x14, 0x93, 0x74,
+    0x15, 0x99, 0x74, 0x17, 0x02, 0x75, 0x18, 0x08, 0x75, 0x1A, 0x3B, 0x75, 0x1B, 0x4C, 0x75, 0x1C,
+    0x56, 0x74, 0x1D, 0x93, 0x74, 0x00, 0x44, 0xDB, 0x73, 0x08, 0x08, 0x73, 0x0B, 0xC2, 0x6E, 0x0E,
+    0xDF, 0x73, 0x0F, 0xE6, 0x73, 0x12, 0xF7, 0x73, 0x14, 0xDF, 0x73, 0x15, 0xFE, 0x73, 0x16, 0xDF,
+    0x73, 0x18, 0x04, 0x74, 0x1A, 0xDF, 0x73, 0x1D, 0xDF, 0x73, 0x00, 0x4F, 0x5D, 0x10, 0x00, 0x0F,
+    0x00, 0x83, 0x61, 0x73, 0x74, 0x00, 0x4E, 0xED, 0x73, 0x12, 0xF3, 0x73, 0x00, 0x84, 0x6C, 0x61,
+    0x73, 0x74, 0x00, 0x6C, 0xED, 0x73, 0x00, 0x4F, 0xE1, 0x73, 0x10, 0x5D, 0x10, 0x00, 0x0C, 0x00,
+    0x49, 0x5D, 0x10, 0x00, 0x4D, 0x5D, 0x10, 0x00, 0x52, 0x12, 0x74, 0x15, 0xFE, 0x73, 0x18, 0x04,
+    0x74, 0x00, 0x50, 0x5D, 0x10, 0x00, 0x45, 0x2C, 0x74, 0x07, 0x3C, 0x74, 0x0A, 0x44, 0x74, 0x0B,
+    0x44, 0x74, 0x11, 0x44, 0x74, 0x18, 0x04, 0x74, 0x1A, 0x44, 0x74, 0x00, 0x4A, 0x36, 0x74, 0x0B,
+    0x36, 0x74, 0x19, 0x36, 0x74, 0x00, 0x84, 0x62, 0x65, 0x73, 0x74, 0x00, 0x05, 0x2C, 0x00, 0x83,
+    0x65, 0x73, 0x74, 0x00, 0x45, 0x3F, 0x74, 0x00, 0x4C, 0x7B, 0x73, 0x15, 0xFE, 0x73, 0x00, 0x18,
+    0x0D, 0x00, 0x6C, 0x5D, 0x10, 0x00, 0x18, 0x00, 0x4D, 0x5D, 0x10, 0x00, 0x12, 0x00, 0x50, 0x5D,
+    0x10, 0x00, 0x4D, 0x72, 0x74, 0x0E, 0x72, 0x74, 0x0F, 0x72, 0x74, 0x10, 0x79, 0x74, 0x13, 0x8D,
+    0x74, 0x00, 0x10, 0x00, 0x83, 0x6F, 0x73, 0x74, 0x00, 0x4D, 0x83, 0x74, 0x0E, 0x89, 0x74, 0x11,
+    0x89, 0x74, 0x00, 0x84, 0x6D, 0x6F, 0x73, 0x74, 0x00, 0x6C, 0x83, 0x74, 0x00, 0x10, 0x00, 0x6C,
+    0x74, 0x74, 0x00, 0x04, 0x00, 0x4F, 0x5D, 0x10, 0x00, 0x48, 0xAF, 0x74, 0x09, 0xB5, 0x74, 0x0C,
+    0xBE, 0x74, 0x0E, 0xF5, 0x74, 0x12, 0xAF, 0x74, 0x17, 0xAF, 0x74, 0x18, 0xAF, 0x74, 0x00, 0x0C,
+    0x00, 0x49, 0x47, 0x11, 0x00, 0x0C, 0x00, 0x84, 0x66, 0x69, 0x72, 0x73, 0x74, 0x00, 0x46, 0xB7,
+    0x74, 0x07, 0xB7, 0x74, 0x09, 0xDA, 0x74, 0x0A, 0xB7, 0x74, 0x0E, 0x87, 0x11, 0x12, 0x87, 0x11,
+    0x15, 0xB7, 0x74, 0x18, 0x87, 0x11, 0x19, 0xB7, 0x74, 0x00, 0x46, 0xEA, 0x74, 0x07, 0xF1, 0x74,
+    0x0A, 0xEA, 0x74, 0x15, 0xEA, 0x74, 0x19, 0xEA, 0x74, 0x00, 0x85, 0x66, 0x69, 0x72, 0x73, 0x74,
+    0x00, 0x6C, 0xEA, 0x74, 0x00, 0x49, 0xFC, 0x74, 0x0C, 0x45, 0x11, 0x00, 0x83, 0x69, 0x72, 0x73,
+    0x74, 0x00, 0x0C, 0x00, 0x49, 0x7D, 0x73, 0x00, 0x4B, 0x1E, 0x75, 0x0C, 0x1E, 0x75, 0x0D, 0x25,
+    0x75, 0x0E, 0x1E, 0x75, 0x10, 0x1E, 0x75, 0x18, 0x04, 0x74, 0x1C, 0x1E, 0x75, 0x00, 0x0D, 0x00,
+    0x83, 0x75, 0x73, 0x74, 0x00, 0x4B, 0x35, 0x75, 0x0D, 0x20, 0x75, 0x0E, 0x35, 0x75, 0x10, 0x35,
+    0x75, 0x18, 0x35, 0x75, 0x00, 0x84, 0x6A, 0x75, 0x73, 0x74, 0x00, 0x44, 0xDB, 0x73, 0x08, 0x48,
+    0x75, 0x15, 0xFE, 0x73, 0x18, 0x04, 0x74, 0x00, 0x45, 0x5D, 0x10, 0x00, 0x44, 0xDB, 0x73, 0x08,
+    0x48, 0x75, 0x12, 0x12, 0x74, 0x15, 0xFE, 0x73, 0x18, 0x04, 0x74, 0x00, 0x45, 0x72, 0x75, 0x0C,
+    0x7B, 0x75, 0x0D, 0x96, 0x75, 0x0F, 0x96, 0x75, 0x12, 0x9D, 0x75, 0x13, 0x01, 0x76, 0x1C, 0x96,
+    0x75, 0x00, 0x12, 0x04, 0x00, 0x83, 0x62, 0x6F, 0x75, 0x74, 0x00, 0x45, 0x85, 0x75, 0x0B, 0x8C,
+    0x75, 0x12, 0x90, 0x75, 0x00, 0x04, 0x00, 0x82, 0x6F, 0x75, 0x74, 0x00, 0x56, 0x2A, 0x08, 0x00,
+    0x05, 0x00, 0x44, 0xCE, 0x11, 0x00, 0x12, 0x05, 0x00, 0x44, 0xCE, 0x11, 0x00, 0x44, 0xB9, 0x75,
+    0x05, 0xC2, 0x75, 0x0A, 0xA6, 0x11, 0x0B, 0xF2, 0x75, 0x0C, 0xA6, 0x11, 0x0F, 0xA6, 0x11, 0x11,
+    0xF2, 0x75, 0x13, 0xA6, 0x11, 0x19, 0xA6, 0x11, 0x00, 0x05, 0x00, 0x84, 0x61, 0x62, 0x6F, 0x75,
+    0x74, 0x00, 0x44, 0xDE, 0x75, 0x0A, 0xC4, 0x11, 0x0B, 0xC4, 0x11, 0x11, 0xC4, 0x11, 0x14, 0xBB,
+    0x75, 0x16, 0xBB, 0x75, 0x19, 0xC4, 0x11, 0x1A, 0xBB, 0x75, 0x1D, 0xBB, 0x75, 0x00, 0x54, 0xEB,
+    0x75, 0x16, 0xEB, 0x75, 0x1A, 0xEB, 0x75, 0x1D, 0xEB, 0x75, 0x00, 0x85, 0x61, 0x62, 0x6F, 0x75,
+    0x74, 0x00, 0x44, 0xF9, 0x75, 0x05, 0xFD, 0x75, 0x00, 0x6C, 0x75, 0x75, 0x00, 0x44, 0xBD, 0x10,
+    0x00, 0x45, 0x85, 0x75, 0x12, 0x90, 0x75, 0x00, 0x44, 0x74, 0x6F, 0x06, 0x7A, 0x6F, 0x00, 0x44,
+    0x01, 0x73, 0x08, 0x0E, 0x73, 0x15, 0xDE, 0x6A, 0x16, 0x81, 0x6F, 0x00, 0x44, 0xE4, 0x6F, 0x08,
+    0x91, 0x15, 0x0A, 0xAE, 0x6E, 0x0C, 0xF5, 0x6F, 0x0F, 0x47, 0x43, 0x11, 0x38, 0x76, 0x12, 0x02,
+    0x72, 0x15, 0x02, 0x70, 0x16, 0x08, 0x70, 0x00, 0x44, 0x3F, 0x76, 0x18, 0xC6, 0x6E, 0x00, 0x50,
+    0x8A, 0x15, 0x1A, 0x2A, 0x08, 0x00, 0x55, 0x4D, 0x76, 0x1C, 0x54, 0x76, 0x00, 0x08, 0x19, 0x08,
+    0x00, 0x80, 0x79, 0x00, 0x48, 0x91, 0x15, 0x0F, 0x47, 0x43, 0x11, 0x47, 0x23, 0x15, 0x61, 0x76,
+    0x00, 0x08, 0x19, 0x00, 0x80, 0x00, 0x46, 0x70, 0x76, 0x0A, 0x77, 0x76, 0x11, 0x80, 0x76, 0x00,
+    0x0C, 0x16, 0x04, 0x05, 0x00, 0x80, 0x00, 0x11, 0x00, 0x4C, 0xCA, 0x15, 0x12, 0xA9, 0x3D, 0x00,
+    0x4C, 0x28, 0x16, 0x00, 0x44, 0xA9, 0x76, 0x06, 0xB0, 0x76, 0x08, 0xB7, 0x76, 0x0A, 0xD0, 0x19,
+    0x0C, 0xA9, 0x76, 0x0F, 0xF1, 0x76, 0x12, 0xFE, 0x76, 0x14, 0xA9, 0x76, 0x15, 0x48, 0x77, 0x16,
+    0x55, 0x77, 0x17, 0x74, 0x77, 0x1C, 0x9C, 0x15, 0x00, 0x12, 0x11, 0x0E, 0x00, 0x81, 0x77, 0x00,
+    0x11, 0x0C, 0x16, 0x00, 0x80, 0x65, 0x00, 0x46, 0xAA, 0x18, 0x07, 0x47, 0x23, 0x0E, 0xD3, 0x76,
+    0x0F, 0x0A, 0x19, 0x10, 0xD8, 0x76, 0x11, 0x77, 0x23, 0x12, 0xDF, 0x76, 0x15, 0xE5, 0x76, 0x16,
+    0xEA, 0x76, 0x00, 0x04, 0x17, 0x00, 0x80, 0x00, 0x44, 0xD3, 0x45, 0x12, 0x71, 0x3D, 0x00, 0x11,
+    0x0E, 0x00, 0x81, 0x77, 0x00, 0x12, 0x10, 0x00, 0x80, 0x00, 0x48, 0x91, 0x15, 0x12, 0x91, 0x15,
+    0x00, 0x4C, 0xF8, 0x76, 0x12, 0xDF, 0x76, 0x00, 0x0B, 0x1A, 0x00, 0x80, 0x65, 0x00, 0x45, 0x17,
+    0x77, 0x0B, 0x17, 0x77, 0x0C, 0x17, 0x77, 0x0D, 0x17, 0x77, 0x0F, 0x17, 0x77, 0x10, 0x17, 0x77,
+    0x11, 0x1E, 0x77, 0x13, 0x17, 0x77, 0x00, 0x11, 0x0E, 0x00, 0x82, 0x6F, 0x77, 0x00, 0x45, 0x34,
+    0x77, 0x0B, 0x34, 0x77, 0x0C, 0x34, 0x77, 0x0D, 0x34, 0x77, 0x0E, 0x3B, 0x77, 0x0F, 0x34, 0x77,
+    0x10, 0x34, 0x77, 0x00, 0x0E, 0x00, 0x83, 0x6E, 0x6F, 0x77, 0x00, 0x4C, 0x42, 0x77, 0x0D, 0x42,
+    0x77, 0x00, 0x84, 0x6B, 0x6E, 0x6F, 0x77, 0x00, 0x44, 0x4F, 0x77, 0x08, 0xF8, 0x76, 0x00, 0x08,
+    0x1C, 0x00, 0x80, 0x73, 0x00, 0x74, 0x87, 0x15, 0x08, 0x62, 0x77, 0x12, 0x69, 0x77, 0x15, 0x96,
+    0x15, 0x00, 0x4B, 0x8C, 0x20, 0x12, 0x7A, 0x20, 0x00, 0x4B, 0x8C, 0x20, 0x11, 0x70, 0x77, 0x00,
+    0x4E, 0xAD, 0x76, 0x00, 0x04, 0x17, 0x16, 0x00, 0x80, 0x65, 0x00, 0x46, 0x70, 0x76, 0x07, 0x53,
+    0x16, 0x08, 0xC0, 0x12, 0x0A, 0xD0, 0x19, 0x0C, 0x9A, 0x77, 0x0F, 0x79, 0x17, 0x11, 0x8F, 0x17,
+    0x15, 0xA1, 0x77, 0x16, 0x7A, 0x15, 0x1C, 0x9C, 0x15, 0x00, 0x16, 0x04, 0x05, 0x00, 0x80, 0x63,
+    0x00, 0x04, 0x08, 0x1C, 0x00, 0x80, 0x73, 0x00, 0x74, 0xE8, 0x37, 0x04, 0xF9, 0x37, 0x05, 0xE5,
+    0x77, 0x06, 0xB4, 0x15, 0x07, 0xFB, 0x77, 0x08, 0x02, 0x78, 0x09, 0x67, 0x78, 0x0A, 0x77, 0x78,
+    0x0B, 0xD5, 0x79, 0x0D, 0x04, 0x7A, 0x0E, 0x0B, 0x7A, 0x0F, 0x1F, 0x7A, 0x10, 0x04, 0x7A, 0x11,
+    0x43, 0x7B, 0x12, 0x96, 0x7B, 0x15, 0xB6, 0x7B, 0x16, 0x45, 0x3D, 0x17, 0x73, 0x7C, 0x18, 0xC7,
+    0x7C, 0x19, 0xDD, 0x7C, 0x00, 0x51, 0xEC, 0x77, 0x12, 0xF2, 0x77, 0x00, 0x04, 0x10, 0x00, 0x81,
+    0x79, 0x00, 0x0F, 0x12, 0x08, 0x0A, 0x00, 0x81, 0x67, 0x79, 0x00, 0x08, 0x0B, 0x17, 0x00, 0x81,
+    0x79, 0x00, 0x45, 0x21, 0x78, 0x07, 0x21, 0x78, 0x08, 0x72, 0x62, 0x0A, 0x21, 0x78, 0x0B, 0x28,
+    0x78, 0x0D, 0x21, 0x78, 0x11, 0x21, 0x78, 0x15, 0x55, 0x78, 0x1A, 0x21, 0x78, 0x1C, 0x21, 0x78,
+    0x00, 0x0B, 0x17, 0x00, 0x82, 0x65, 0x79, 0x00, 0x45, 0x3E, 0x78, 0x0A, 0x3E, 0x78, 0x0D, 0x3E,
+    0x78, 0x11, 0x3E, 0x78, 0x15, 0x3E, 0x78, 0x17, 0x45, 0x78, 0x1C, 0x3E, 0x78, 0x00, 0x17, 0x00,
+    0x83, 0x68, 0x65, 0x79, 0x00, 0x4A, 0x4F, 0x78, 0x15, 0x4F, 0x78, 0x1C, 0x4F, 0x78, 0x00, 0x84,
+    0x74, 0x68, 0x65, 0x79, 0x00, 0x4B, 0x5C, 0x78, 0x19, 0x60, 0x78, 0x00, 0x57, 0x24, 0x78, 0x00,
+    0x08, 0x00, 0x82, 0x65, 0x72, 0x79, 0x00, 0x48, 0x72, 0x62, 0x12, 0xF2, 0x77, 0x15, 0x71, 0x78,
+    0x00, 0x08, 0x19, 0x00, 0x81, 0x79, 0x00, 0x45, 0x93, 0x78, 0x09, 0x93, 0x78, 0x0B, 0x93, 0x78,
+    0x0C, 0x9D, 0x78, 0x0F, 0xB5, 0x78, 0x12, 0xDD, 0x78, 0x13, 0x9D, 0x78, 0x17, 0x93, 0x78, 0x19,
+    0x93, 0x78, 0x00, 0x12, 0x0F, 0x12, 0x08, 0x0A, 0x00, 0x82, 0x67, 0x79, 0x00, 0x4F, 0xA4, 0x78,
+    0x12, 0xAD, 0x78, 0x00, 0x12, 0x08, 0x0A, 0x00, 0x82, 0x6F, 0x67, 0x79, 0x00, 0x0F, 0x12, 0x08,
+    0x00, 0x4A, 0x99, 0x78, 0x00, 0x4F, 0xA4, 0x78, 0x12, 0xBC, 0x78, 0x00, 0x48, 0xC6, 0x78, 0x0F,
+    0xCD, 0x78, 0x12, 0xD4, 0x78, 0x00, 0x0A, 0x00, 0x81, 0x6F, 0x67, 0x79, 0x00, 0x12, 0x08, 0x00,
+    0x4A, 0x99, 0x78, 0x00, 0x08, 0x0A, 0x00, 0x83, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x4C, 0xED, 0x78,
+    0x0E, 0xF7, 0x78, 0x0F, 0x05, 0x79, 0x12, 0xB6, 0x79, 0x13, 0xED, 0x78, 0x00, 0x0F, 0x12, 0x08,
+    0x0A, 0x00, 0x83, 0x6F, 0x67, 0x79, 0x00, 0x4F, 0xFE, 0x78, 0x12, 0xD4, 0x78, 0x00, 0x12, 0x08,
+    0x00, 0x4A, 0xF2, 0x78, 0x00, 0x48, 0x18, 0x79, 0x0C, 0x30, 0x79, 0x0E, 0x49, 0x79, 0x0F, 0x50,
+    0x79, 0x12, 0x5D, 0x79, 0x13, 0x30, 0x79, 0x00, 0x4A, 0x1F, 0x79, 0x12, 0x26, 0x79, 0x00, 0x83,
+    0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x0A, 0x00, 0x85, 0x65, 0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00,
+    0x48, 0x37, 0x79, 0x12, 0x40, 0x79, 0x00, 0x0A, 0x00, 0x84, 0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00,
+    0x08, 0x0A, 0x00, 0x84, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x12, 0x08, 0x00, 0x4A, 0x43, 0x79, 0x00,
+    0x48, 0x37, 0x79, 0x12, 0x57, 0x79, 0x00, 0x08, 0x00, 0x4A, 0xF2, 0x78, 0x00, 0x47, 0x79, 0x79,
+    0x08, 0x89, 0x79, 0x0A, 0x94, 0x79, 0x0C, 0x9E, 0x79, 0x0F, 0x9E, 0x79, 0x12, 0x40, 0x79, 0x13,
+    0xA5, 0x79, 0x15, 0xAB, 0x79, 0x1A, 0x79, 0x79, 0x00, 0x48, 0x80, 0x79, 0x0A, 0x28, 0x79, 0x00,
+    0x0A, 0x00, 0x85, 0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x2C, 0x00, 0x85, 0x67, 0x65, 0x6F, 0x6C,
+    0x6F, 0x67, 0x79, 0x00, 0x2C, 0x00, 0x84, 0x65, 0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x08, 0x0A,
+    0x00, 0x6C, 0x82, 0x79, 0x00, 0x08, 0x00, 0x4A, 0x82, 0x79, 0x00, 0x48, 0x80, 0x79, 0x0A, 0xB2,
+    0x79, 0x00, 0x6C, 0x28, 0x79, 0x00, 0x48, 0xC0, 0x79, 0x0F, 0xC8, 0x79, 0x12, 0xD4, 0x78, 0x00,
+    0x0A, 0x00, 0x82, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x48, 0x37, 0x79, 0x12, 0xCF, 0x79, 0x00, 0x08,
+    0x00, 0x4A, 0x99, 0x78, 0x00, 0x46, 0xE8, 0x79, 0x08, 0xEF, 0x79, 0x0A, 0xF5, 0x79, 0x0F, 0xFE,
+    0x79, 0x11, 0xEC, 0x77, 0x12, 0xF2, 0x77, 0x00, 0x4C, 0xEA, 0x15, 0x18, 0xF4, 0x15, 0x00, 0x0B,
+    0x17, 0x00, 0x81, 0x79, 0x00, 0x0C, 0x00, 0x4B, 0x8A, 0x15, 0x15, 0x1E, 0x09, 0x00, 0x11, 0x12,
+    0x00, 0x81, 0x79, 0x00, 0x11, 0x04, 0x10, 0x00, 0x81, 0x79, 0x00, 0x0F, 0x00, 0x44, 0x14, 0x7A,
+    0x11, 0x1B, 0x7A, 0x00, 0x08, 0x15, 0x00, 0x81, 0x6C, 0x79, 0x00, 0x52, 0xEF, 0x77, 0x00, 0x44,
+    0x3B, 0x7A, 0x05, 0x4E, 0x7A, 0x0B, 0x4E, 0x7A, 0x0D, 0x4E, 0x7A, 0x0E, 0x55, 0x7A, 0x0F, 0x74,
+    0x7A, 0x10, 0x4E, 0x7A, 0x11, 0x03, 0x7B, 0x12, 0x3C, 0x7B, 0x00, 0x48, 0x42, 0x7A, 0x0F, 0x48,
+    0x7A, 0x00, 0x15, 0x00, 0x80, 0x6C, 0x79, 0x00, 0x08, 0x00, 0x55, 0x80, 0x12, 0x00, 0x11, 0x12,
+    0x00, 0x82, 0x6C, 0x79, 0x00, 0x44, 0x5F, 0x7A, 0x0F, 0x67, 0x7A, 0x11, 0x6E, 0x7A, 0x00, 0x08,
+    0x15, 0x00, 0x82, 0x6C, 0x6C, 0x79, 0x00, 0x04, 0x08, 0x00, 0x55, 0x51, 0x7A, 0x00, 0x12, 0x00,
+    0x6C, 0x51, 0x7A, 0x00, 0x44, 0x8D, 0x7A, 0x08, 0xE3, 0x7A, 0x0E, 0xE9, 0x7A, 0x12, 0xE9, 0x7A,
+    0x14, 0xF2, 0x7A, 0x16, 0xF2, 0x7A, 0x1A, 0xF2, 0x7A, 0x1D, 0xF2, 0x7A, 0x00, 0x47, 0xA3, 0x7A,
+    0x08, 0xBB, 0x7A, 0x14, 0xC5, 0x7A, 0x15, 0xCB, 0x7A, 0x16, 0xC5, 0x7A, 0x1A, 0xDC, 0x7A, 0x1D,
+    0xC5, 0x7A, 0x00, 0x48, 0xAA, 0x7A, 0x15, 0xB2, 0x7A, 0x00, 0x15, 0x00, 0x84, 0x61, 0x6C, 0x6C,
+    0x79, 0x00, 0x2C, 0x00, 0x84, 0x65, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x2C, 0x00, 0x84, 0x72, 0x65,
+    0x61, 0x6C, 0x6C, 0x79, 0x00, 0x08, 0x00, 0x55, 0xAC, 0x7A, 0x00, 0x48, 0xD2, 0x7A, 0x15, 0xB4,
+    0x7A, 0x00, 0x2C, 0x00, 0x85, 0x72, 0x65, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x48, 0xAA, 0x7A, 0x15,
+    0xB4, 0x7A, 0x00, 0x04, 0x00, 0x55, 0xB4, 0x7A, 0x00, 0x04, 0x08, 0x15, 0x00, 0x83, 0x6C, 0x6C,
+    0x79, 0x00, 0x44, 0xF9, 0x7A, 0x08, 0xFF, 0x7A, 0x00, 0x08, 0x00, 0x55, 0xED, 0x7A, 0x00, 0x55,
+    0x80, 0x12, 0x00, 0x45, 0x1C, 0x7B, 0x0B, 0x1C, 0x7B, 0x0C, 0x23, 0x7B, 0x0D, 0x1C, 0x7B, 0x0F,
+    0x1C, 0x7B, 0x10, 0x1C, 0x7B, 0x12, 0x2A, 0x7B, 0x13, 0x1C, 0x7B, 0x00, 0x12, 0x00, 0x83, 0x6E,
+    0x6C, 0x79, 0x00, 0x52, 0x1E, 0x7B, 0x19, 0x74, 0x4D, 0x00, 0x4C, 0x34, 0x7B, 0x0F, 0x36, 0x7B,
+    0x13, 0x36, 0x7B, 0x00, 0x2C, 0x00, 0x84, 0x6F, 0x6E, 0x6C, 0x79, 0x00, 0x44, 0x5F, 0x7A, 0x0F,
+    0x67, 0x7A, 0x00, 0x44, 0x5F, 0x7B, 0x05, 0x8F, 0x7B, 0x0B, 0x8F, 0x7B, 0x0D, 0x8F, 0x7B, 0x10,
+    0x8F, 0x7B, 0x14, 0x8F, 0x7B, 0x16, 0x8F, 0x7B, 0x1A, 0x8F, 0x7B, 0x1D, 0x8F, 0x7B, 0x00, 0x4D,
+    0x78, 0x7B, 0x0E, 0x78, 0x7B, 0x10, 0x7F, 0x7B, 0x11, 0x78, 0x7B, 0x14, 0x78, 0x7B, 0x16, 0x78,
+    0x7B, 0x1A, 0x78, 0x7B, 0x1D, 0x78, 0x7B, 0x00, 0x10, 0x00, 0x83, 0x61, 0x6E, 0x79, 0x00, 0x4D,
+    0x89, 0x7B, 0x0E, 0x89, 0x7B, 0x11, 0x89, 0x7B, 0x00, 0x84, 0x6D, 0x61, 0x6E, 0x79, 0x00, 0x04,
+    0x10, 0x00, 0x82, 0x6E, 0x79, 0x00, 0x4A, 0x9D, 0x7B, 0x0F, 0xA5, 0x7B, 0x00, 0x0F, 0x12, 0x08,
+    0x00, 0x4A, 0xA8, 0x78, 0x00, 0x44, 0x14, 0x7A, 0x11, 0x1B, 0x7A, 0x12, 0xAF, 0x7B, 0x00, 0x08,
+    0x0A, 0x00, 0x80, 0x67, 0x79, 0x00, 0x47, 0xCC, 0x7B, 0x08, 0xD9, 0x7B, 0x09, 0x55, 0x7C, 0x15,
+    0x5B, 0x7C, 0x17, 0x66, 0x7C, 0x19, 0x6D, 0x7C, 0x1A, 0xCC, 0x7B, 0x00, 0x48, 0xD3, 0x7B, 0x19,
+    0x60, 0x78, 0x00, 0x19, 0x00, 0x82, 0x72, 0x79, 0x00, 0x45, 0xF8, 0x7B, 0x06, 0xFF, 0x7B, 0x07,
+    0xF8, 0x7B, 0x08, 0x0C, 0x7C, 0x09, 0x12, 0x7C, 0x0A, 0xFF, 0x7B, 0x0B, 0x1D, 0x7C, 0x15, 0xF8,
+    0x7B, 0x19, 0x23, 0x7C, 0x1A, 0xF8, 0x7B, 0x00, 0x19, 0x00, 0x83, 0x65, 0x72, 0x79, 0x00, 0x48,
+    0x06, 0x7C, 0x19, 0xFA, 0x7B, 0x00, 0x83, 0x76, 0x65, 0x72, 0x79, 0x00, 0x19, 0x00, 0x48, 0xD5,
+    0x7B, 0x00, 0x48, 0x19, 0x7C, 0x19, 0xFA, 0x7B, 0x00, 0x6C, 0x06, 0x7C, 0x00, 0x17, 0x2C, 0x00,
+    0x81, 0x79, 0x00, 0x45, 0x93, 0x12, 0x06, 0x93, 0x12, 0x07, 0x3C, 0x7C, 0x08, 0x43, 0x7C, 0x09,
+    0x93, 0x12, 0x0A, 0x93, 0x12, 0x15, 0x51, 0x7C, 0x1A, 0x3C, 0x7C, 0x00, 0x84, 0x65, 0x76, 0x65,
+    0x72, 0x79, 0x00, 0x47, 0x4A, 0x7C, 0x1A, 0x4A, 0x7C, 0x00, 0x85, 0x65, 0x76, 0x65, 0x72, 0x79,
+    0x00, 0x6C, 0x3C, 0x7C, 0x00, 0x08, 0x00, 0x59, 0xD5, 0x7B, 0x00, 0x48, 0x62, 0x7C, 0x19, 0x60,
+    0x78, 0x00, 0x59, 0xEF, 0x77, 0x00, 0x08, 0x19, 0x00, 0x6C, 0xD5, 0x7B, 0x00, 0x08, 0x00, 0x48,
+    0x06, 0x7C, 0x00, 0x74, 0x68, 0x3D, 0x04, 0x95, 0x7C, 0x06, 0x79, 0x3D, 0x08, 0xA1, 0x7C, 0x0C,
+    0x85, 0x3D, 0x0F, 0xFE, 0x79, 0x11, 0xAC, 0x7C, 0x12, 0xF2, 0x77, 0x15, 0xB9, 0x7C, 0x16, 0xC0,
+    0x7C, 0x18, 0xB6, 0x3D, 0x00, 0x48, 0x9C, 0x7C, 0x0B, 0x21, 0x16, 0x00, 0x15, 0x0A, 0x00, 0x80,
+    0x00, 0x4B, 0x1D, 0x7C, 0x19, 0xA8, 0x7C, 0x00, 0x48, 0x75, 0x62, 0x00, 0x44, 0xB3, 0x7C, 0x18,
+    0x71, 0x3D, 0x00, 0x10, 0x2C, 0x00, 0x81, 0x79, 0x00, 0x08, 0x19, 0x2C, 0x00, 0x81, 0x79, 0x00,
+    0x48, 0xD1, 0x15, 0x18, 0xB2, 0x3D, 0x00, 0x48, 0xEF, 0x79, 0x0F, 0xFE, 0x79, 0x11, 0xEC, 0x77,
+    0x12, 0xD7, 0x7C, 0x15, 0x71, 0x78, 0x00, 0x05, 0x04, 0x00, 0x80, 0x74, 0x00, 0x12, 0x0F, 0x12,
+    0x08, 0x00, 0x4A, 0xF7, 0x77, 0x00
+};
+
+#endif
+
+#define AUTOCORRECT_JUMP_TABLE_SIZE 28
+
+#ifdef AUTOCORRECT_JUMP_TABLE
+// State after the root for each newest key (a-z, ', boundary); 0 = no typo ends in it
+static const uint16_t autocorrect_jump_table[AUTOCORRECT_JUMP_TABLE_SIZE] PROGMEM __attribute__((unused)) = {
+    0x12A7, 0x15A4, 0x1637, 0x17A5, 0x20D6, 0x374D, 0x37C0, 0x3DBC,  // a b c d e f g h
+    0x434C, 0x4355, 0x43B4, 0x4739, 0x4FD3, 0x50BF, 0x55B3, 0x5961,  // i j k l m n o p
+    0x59D8, 0x59DF, 0x6279, 0x6BE6, 0x7646, 0x7666, 0x7684, 0x777B,  // q r s t u v w x
+    0x77A8, 0x0000, 0x0052, 0x0075,  // y z ' :
+};
+#endif
+
+#define AUTOCORRECT_COMPACT_SIZE 20397
+
+#ifdef AUTOCORRECT_COMPACT_TRIE
+#define AUTOCORRECT_COMPACT_MAX_CORRECTION 10
+
+// Bit-packed trie, see autocorrdata.py for the format
+static const uint8_t autocorrect_compact_data[AUTOCORRECT_COMPACT_SIZE] PROGMEM __attribute__((unused)) = {
+    0xB5, 0x38, 0xEF, 0x81, 0x10, 0xC8, 0x53, 0x1D, 0x09, 0x52, 0xD8, 0xD7, 0x3E, 0x12, 0x9D, 0x2B,
+    0x6B, 0xE3, 0x20, 0x01, 0x50, 0xD6, 0xA1, 0x01, 0xEE, 0xA0, 0x09, 0xFA, 0x06, 0x65, 0x08, 0xCF,
+    0x32, 0x05, 0x5B, 0x00, 0xE7, 0xC2, 0x84, 0x58, 0x42, 0x80, 0x00, 0x02, 0x30, 0x13, 0x86, 0x0B,
+    0x2E, 0x45, 0xFD, 0x40, 0x0F, 0xAF, 0x0A, 0x11, 0xC0, 0xF8, 0xF8, 0x01, 0x7B, 0x14, 0x8E, 0x01,
+    0xD5, 0x5C, 0x5D, 0xC5, 0xC0, 0x07, 0xC0, 0x01, 0xD4, 0x02, 0x84, 0xC0, 0x30, 0x20, 0x34, 0xB6,
+    0xBD, 0xDE, 0xE5, 0x80, 0x07, 0x72, 0x51, 0x44, 0xE0, 0x0B, 0x04, 0x13, 0xCE, 0x8B, 0x5E, 0x81,
+    0x45, 0x01, 0xDC, 0xC0, 0x8E, 0x82, 0x60, 0xBD, 0xE4, 0x18, 0x3B, 0xA0, 0x10, 0x99, 0xEA, 0x41,
+    0x3C, 0xB2, 0x8D, 0x8B, 0x62, 0x81, 0x90, 0x43, 0x41, 0x58, 0xE9, 0x0C, 0x99, 0x25, 0xAA, 0x28,
+    0x00, 0x15, 0xCF, 0x00, 0x0A, 0x16, 0x80, 0x05, 0x2D, 0x80, 0x04, 0x24, 0x0C, 0xEE, 0x7A, 0x23,
+    0x74, 0xCC, 0x22, 0x00, 0x08, 0x98, 0x26, 0x2B, 0xD9, 0x41, 0x00, 0x70, 0x21, 0xC0, 0x38, 0x11,
+    0xD0, 0x4C, 0xF4, 0xA8, 0x8C, 0x00, 0x10, 0x4C, 0x57, 0xA8, 0x82, 0x00, 0x08, 0x70, 0x01, 0x0D,
+    0x2B, 0x63, 0xE8, 0x86, 0x11, 0x91, 0x99, 0x85, 0x40, 0x30, 0x03, 0xD1, 0xC9, 0xE0, 0x00, 0x77,
+    0x15, 0xA1, 0x79, 0x0C, 0x33, 0x01, 0xE0, 0x8A, 0x72, 0x15, 0x6F, 0x95, 0xD1, 0x80, 0x00, 0x00,
+    0x02, 0x95, 0x01, 0x32, 0x00, 0x90, 0x71, 0x10, 0xE8, 0x53, 0xA5, 0x7C, 0x80, 0x00, 0x8C, 0x00,
+    0x00, 0x00, 0x00, 0x22, 0x03, 0x2B, 0x20, 0x08, 0x61, 0x11, 0xD5, 0x90, 0x22, 0x0A, 0xC8, 0x02,
+    0x22, 0x98, 0x33, 0xA1, 0xC2, 0xB0, 0x6C, 0x57, 0x2F, 0xAE, 0x11, 0x3E, 0x49, 0x00, 0x44, 0xC0,
+    0x2B, 0x93, 0xAE, 0x89, 0x41, 0x32, 0x68, 0xF2, 0xA2, 0xE0, 0x20, 0x0A, 0x91, 0x00, 0x80, 0x41,
+    0x3D, 0x06, 0xD6, 0x0A, 0xD2, 0xF9, 0x30, 0x97, 0x00, 0x10, 0x8E, 0x9A, 0x54, 0xCB, 0x25, 0x45,
+    0xC0, 0x02, 0xA4, 0x40, 0x02, 0x08, 0x5B, 0x30, 0x00, 0x84, 0xC2, 0x85, 0x34, 0xED, 0x66, 0x30,
+    0x58, 0x82, 0xDD, 0x94, 0x10, 0xD2, 0xE0, 0x01, 0x15, 0x6C, 0x21, 0x4E, 0xE9, 0x19, 0x91, 0xAD,
+    0x78, 0x4A, 0xC8, 0x58, 0x82, 0x69, 0x55, 0xE5, 0x7D, 0xC0, 0x20, 0x15, 0xE3, 0x00, 0x80, 0x84,
+    0x7A, 0x95, 0x26, 0x5B, 0xAB, 0xF2, 0x00, 0x1A, 0xC5, 0x70, 0x00, 0x62, 0xA2, 0x80, 0x02, 0x11,
+    0xD1, 0x4B, 0x1E, 0x78, 0xB4, 0x78, 0x12, 0x02, 0x98, 0x20, 0x48, 0x0A, 0x57, 0x01, 0x20, 0x41,
+    0x65, 0x53, 0x22, 0x2A, 0xF9, 0x80, 0x40, 0x42, 0x39, 0x52, 0xC3, 0x2C, 0x96, 0x75, 0x00, 0x0A,
+    0x19, 0x80, 0x05, 0xAB, 0xE0, 0x84, 0x77, 0x00, 0x08, 0x8C, 0x68, 0xD0, 0xB7, 0x5C, 0x45, 0xF0,
+    0x01, 0xE0, 0x94, 0xC1, 0x6B, 0xCB, 0x73, 0x55, 0x91, 0x80, 0x04, 0x34, 0x3C, 0x6E, 0x92, 0x81,
+    0x90, 0xCA, 0xBD, 0x80, 0x01, 0x5F, 0x70, 0x00, 0xC9, 0x45, 0x00, 0x04, 0x23, 0xA5, 0xF5, 0x28,
+    0xA1, 0x08, 0x00, 0x10, 0x60, 0x01, 0x0C, 0x00, 0x21, 0xB6, 0xE1, 0x2A, 0x6B, 0xD0, 0x03, 0x70,
+    0x0C, 0xAB, 0xC8, 0x00, 0x15, 0x14, 0x01, 0x60, 0x84, 0xDB, 0x15, 0x16, 0xDA, 0xD9, 0x42, 0x14,
+    0x00, 0x49, 0x6A, 0x46, 0x42, 0x9D, 0x8E, 0x94, 0xF3, 0x54, 0x40, 0xE4, 0x82, 0xE4, 0x0D, 0x20,
+    0xF9, 0x01, 0x18, 0x11, 0x82, 0x96, 0x09, 0x16, 0x98, 0x44, 0x00, 0xC0, 0xD5, 0x7C, 0xC0, 0x20,
+    0x18, 0x25, 0xC8, 0x13, 0x03, 0xB9, 0x28, 0xA0, 0x13, 0x03, 0x86, 0xEC, 0x08, 0x13, 0x03, 0xB9,
+    0xE8, 0x83, 0x90, 0x25, 0x40, 0x13, 0x04, 0x16, 0x56, 0x53, 0xCA, 0x8F, 0x82, 0x11, 0xDC, 0x01,
+    0x01, 0x0D, 0xBB, 0x2A, 0x65, 0xD3, 0xB9, 0x91, 0x80, 0x65, 0x68, 0x90, 0x00, 0xC1, 0x2E, 0x40,
+    0x04, 0x46, 0x3C, 0xA9, 0x63, 0x80, 0x66, 0xA8, 0x42, 0x60, 0x17, 0x55, 0xE7, 0x00, 0x10, 0x4C,
+    0x59, 0xA8, 0x8E, 0x00, 0x09, 0x50, 0x01, 0x05, 0x95, 0x4D, 0xEA, 0xAB, 0xE6, 0x00, 0x20, 0xB2,
+    0xB2, 0xB1, 0x24, 0x7E, 0xC9, 0xF2, 0x92, 0xB2, 0x15, 0x2A, 0x5B, 0x1C, 0xF8, 0x5C, 0x85, 0x02,
+    0x30, 0x8C, 0x11, 0x81, 0x18, 0x9E, 0x4A, 0x80, 0x8C, 0x00, 0x31, 0x51, 0x40, 0x5A, 0x06, 0x7C,
+    0x8C, 0x0B, 0x41, 0x04, 0xC5, 0x7B, 0xCA, 0x8A, 0x02, 0xD0, 0x2C, 0x8C, 0x0B, 0x41, 0x09, 0xA5,
+    0x0B, 0xE0, 0x9B, 0xFA, 0xD8, 0x2D, 0x2A, 0x29, 0xE1, 0xB6, 0x2E, 0x91, 0x8E, 0x22, 0x1D, 0x0A,
+    0x75, 0xC0, 0x00, 0x46, 0x00, 0x00, 0x05, 0x45, 0x02, 0x2B, 0x41, 0x18, 0xE2, 0x3A, 0x9D, 0x2A,
+    0x64, 0x00, 0x00, 0x00, 0x11, 0x80, 0x4A, 0x06, 0x82, 0xB4, 0x10, 0x4C, 0x7C, 0xBE, 0x25, 0x10,
+    0x56, 0x81, 0x39, 0x9E, 0x54, 0x63, 0x94, 0xC9, 0x64, 0x25, 0x40, 0x00, 0x00, 0x00, 0x46, 0x01,
+    0x64, 0x60, 0x9E, 0xD0, 0x46, 0x3C, 0x86, 0x43, 0x1E, 0x96, 0x32, 0x65, 0xE1, 0x93, 0x26, 0x50,
+    0xDA, 0x6F, 0x28, 0x60, 0xE4, 0xF6, 0x82, 0x2A, 0x06, 0x43, 0x1E, 0x56, 0x00, 0x94, 0x00, 0x00,
+    0x00, 0x10, 0xD2, 0x7B, 0x41, 0x2D, 0x81, 0x19, 0x4E, 0x96, 0x3E, 0x32, 0x9D, 0x32, 0x04, 0x65,
+    0xDB, 0x06, 0x40, 0x00, 0x0D, 0x23, 0x66, 0x00, 0x01, 0x82, 0x1F, 0xA0, 0x8D, 0x0B, 0x4C, 0xF7,
+    0x2C, 0x1B, 0x81, 0x9C, 0x99, 0x80, 0x50, 0x30, 0x69, 0x30, 0x0A, 0x08, 0x26, 0x4B, 0xDE, 0x54,
+    0x5C, 0x02, 0x81, 0x5C, 0xB0, 0x6E, 0x08, 0x28, 0x09, 0x69, 0x94, 0xB9, 0x02, 0x60, 0x86, 0xC2,
+    0xED, 0xF2, 0x81, 0xA0, 0x3C, 0x83, 0x38, 0x2D, 0x43, 0xE9, 0x5E, 0x94, 0x00, 0xA0, 0x82, 0x77,
+    0x22, 0x52, 0x2C, 0x1B, 0x82, 0x39, 0xC4, 0x84, 0xA9, 0x8D, 0x74, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x30, 0x0A, 0xE5, 0x84, 0xFB, 0x82, 0x31, 0xC4, 0x84, 0xA9, 0x6C, 0x68, 0x00, 0x00, 0x11, 0x80,
+    0x00, 0x8B, 0x0D, 0xCF, 0xB8, 0x20, 0x85, 0x2A, 0x08, 0xB7, 0x3E, 0xE0, 0x90, 0xE5, 0x8C, 0x8C,
+    0x6B, 0x9F, 0x29, 0x80, 0x65, 0x48, 0xD0, 0x0A, 0x00, 0x6A, 0x81, 0x35, 0xE8, 0x68, 0x03, 0x20,
+    0x37, 0x28, 0x68, 0x00, 0x15, 0xED, 0x00, 0x0C, 0xE4, 0xCC, 0x00, 0x32, 0x51, 0x70, 0x01, 0x04,
+    0x25, 0x7B, 0x75, 0x09, 0xCE, 0xF4, 0x40, 0x8C, 0x12, 0xA0, 0x09, 0x82, 0x0B, 0x42, 0xF8, 0xCC,
+    0xA4, 0xC0, 0x04, 0x86, 0xD0, 0x88, 0x4A, 0xD8, 0xE9, 0xD6, 0x89, 0xE0, 0x55, 0x08, 0xA0, 0x2C,
+    0x66, 0xFF, 0x2A, 0x90, 0x14, 0x02, 0xC5, 0x83, 0x82, 0x82, 0x3A, 0x01, 0x92, 0x11, 0x05, 0x34,
+    0x8C, 0x10, 0x4E, 0x9A, 0x23, 0x54, 0x5C, 0x11, 0xA0, 0x0A, 0x91, 0x67, 0x9F, 0x04, 0xE9, 0x9A,
+    0x36, 0x98, 0x44, 0x08, 0xC0, 0xA1, 0x10, 0x29, 0x18, 0x24, 0x25, 0x61, 0x21, 0x5F, 0x3A, 0xDF,
+    0x07, 0xB1, 0x40, 0xA0, 0x00, 0xED, 0x00, 0x0A, 0x05, 0x0D, 0x30, 0x88, 0x24, 0x8C, 0x10, 0x4C,
+    0x19, 0xB4, 0x82, 0xD5, 0x24, 0x28, 0x45, 0xA2, 0x62, 0x0A, 0x26, 0x1A, 0xB8, 0x26, 0x08, 0x99,
+    0x41, 0x69, 0xA2, 0x86, 0x19, 0xA4, 0x60, 0x90, 0x92, 0x04, 0x45, 0x8C, 0xEF, 0x8D, 0x23, 0x45,
+    0x00, 0x02, 0xAC, 0xAC, 0xAA, 0x00, 0x2A, 0xA8, 0x44, 0x1C, 0xD2, 0x30, 0x20, 0x44, 0x10, 0x66,
+    0x91, 0x82, 0x0A, 0x82, 0x2B, 0xAD, 0x05, 0xA2, 0x06, 0x3A, 0x62, 0x11, 0x1D, 0x13, 0xBE, 0xAE,
+    0xA4, 0x29, 0x88, 0xA0, 0x00, 0x00, 0x00, 0x20, 0x84, 0x0C, 0xD2, 0x30, 0x27, 0x35, 0x5D, 0xF0,
+    0xCE, 0x74, 0x3A, 0xC0, 0x12, 0x00, 0x14, 0x41, 0x9A, 0x46, 0x04, 0xE6, 0x78, 0xB1, 0xDC, 0xB2,
+    0xA5, 0xCF, 0x9D, 0x73, 0x6F, 0xA0, 0x1C, 0x40, 0x22, 0x80, 0x01, 0x74, 0x30, 0x00, 0x16, 0xE6,
+    0x3B, 0xA4, 0xF3, 0x3A, 0x58, 0x11, 0x82, 0x90, 0x82, 0x09, 0xE4, 0x97, 0x6E, 0xF3, 0x25, 0x8A,
+    0x11, 0x80, 0x90, 0x81, 0xE4, 0xF3, 0x25, 0x98, 0x11, 0x84, 0xE4, 0x84, 0x12, 0x14, 0xB1, 0x21,
+    0x4D, 0x73, 0xE5, 0x51, 0x14, 0x45, 0x11, 0x44, 0x55, 0xC0, 0x00, 0x34, 0xC0, 0x07, 0x74, 0x9E,
+    0x67, 0x4B, 0x02, 0x30, 0x92, 0x10, 0x41, 0x3B, 0xA4, 0xE9, 0xE4, 0xF3, 0x25, 0x98, 0x11, 0xE8,
+    0x94, 0x77, 0x99, 0x2C, 0x50, 0x8F, 0x55, 0x15, 0x04, 0xEF, 0x73, 0xB7, 0x32, 0x58, 0x14, 0x18,
+    0x2E, 0x48, 0x40, 0xEF, 0x32, 0x58, 0xA1, 0x18, 0x72, 0x72, 0x42, 0x09, 0x0A, 0x11, 0x4C, 0x85,
+    0x35, 0xF2, 0xA1, 0xBC, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x22, 0xAC, 0x86, 0xF3, 0xC9, 0xE6, 0x4B,
+    0x30, 0x23, 0x0D, 0xC9, 0x08, 0x20, 0x9C, 0xD2, 0x6E, 0xE9, 0x60, 0x46, 0x14, 0x9C, 0x90, 0x81,
+    0xCC, 0x96, 0x05, 0x06, 0x23, 0xE4, 0xE4, 0x84, 0x10, 0x4E, 0xF9, 0x32, 0x73, 0x25, 0x81, 0x41,
+    0xEA, 0x8A, 0xDD, 0xE6, 0x4B, 0x14, 0x23, 0xD5, 0x63, 0xC6, 0x51, 0x4C, 0x96, 0x3E, 0x14, 0x2F,
+    0x04, 0x51, 0x15, 0x92, 0x11, 0x40, 0x07, 0x79, 0x92, 0xC5, 0x08, 0xC4, 0x93, 0x92, 0x10, 0x41,
+    0x39, 0x9E, 0xA5, 0xD2, 0xC0, 0x8F, 0x54, 0xC0, 0xE6, 0x4B, 0x02, 0x83, 0xD3, 0x6A, 0x82, 0x74,
+    0xBD, 0xBB, 0x30, 0x23, 0x0D, 0xF2, 0x72, 0x42, 0x08, 0x27, 0x32, 0x54, 0xBA, 0x58, 0x11, 0xEA,
+    0xB4, 0x19, 0x81, 0x18, 0xA6, 0x7C, 0x9C, 0x90, 0x82, 0x42, 0x98, 0x32, 0x18, 0xE9, 0x84, 0xAC,
+    0x22, 0x88, 0xAA, 0xE0, 0x8A, 0x46, 0x00, 0x02, 0x28, 0x8A, 0xE6, 0x4B, 0x02, 0x83, 0x15, 0xF2,
+    0x72, 0x42, 0x08, 0x2A, 0x32, 0x6D, 0x67, 0x4B, 0x02, 0x3D, 0x12, 0xB0, 0x4E, 0xC3, 0x37, 0x50,
+    0x8C, 0x43, 0x3E, 0x4E, 0x48, 0x41, 0x04, 0xE9, 0x62, 0x36, 0x60, 0x47, 0xA6, 0x02, 0xA1, 0x18,
+    0xC9, 0x33, 0xE4, 0xE4, 0x84, 0x12, 0x54, 0x32, 0x1D, 0x2B, 0x63, 0xE5, 0x5B, 0x00, 0x00, 0x02,
+    0x30, 0x20, 0x90, 0x62, 0x08, 0x00, 0x20, 0x80, 0x0E, 0x96, 0x04, 0x63, 0x19, 0xF2, 0x72, 0x42,
+    0x08, 0x2A, 0x4B, 0x2C, 0xB6, 0x60, 0x47, 0xA2, 0x56, 0x09, 0xC2, 0x96, 0xE8, 0x31, 0x52, 0x67,
+    0xC9, 0xC9, 0x08, 0x14, 0x23, 0x1D, 0x89, 0x33, 0xE4, 0xE4, 0x84, 0x11, 0x15, 0x50, 0xAD, 0x8F,
+    0x10, 0x4D, 0x24, 0x9C, 0xD2, 0x66, 0x04, 0x63, 0xA4, 0xCF, 0x93, 0x92, 0x10, 0x41, 0x38, 0xD8,
+    0xCC, 0x66, 0x24, 0xCF, 0x93, 0x92, 0x10, 0x20, 0xC8, 0x0B, 0x12, 0x67, 0xC9, 0xC9, 0x08, 0x20,
+    0x98, 0x2C, 0x69, 0x07, 0xAA, 0x78, 0x50, 0x8F, 0x55, 0xD9, 0x1D, 0x23, 0x0A, 0xDF, 0x19, 0xDF,
+    0x47, 0x91, 0xC0, 0xE1, 0x7E, 0xBF, 0x5F, 0xAF, 0xC7, 0x0B, 0x12, 0x67, 0xC9, 0xC9, 0x08, 0x14,
+    0x23, 0x21, 0x89, 0x33, 0xE4, 0xE4, 0x84, 0x09, 0xC2, 0x06, 0x16, 0x24, 0xCF, 0x93, 0x92, 0x10,
+    0x41, 0x50, 0x47, 0x10, 0xA0, 0xF4, 0xD3, 0xA9, 0x34, 0xA2, 0x19, 0x0C, 0x84, 0xA9, 0x8D, 0x73,
+    0xE1, 0x29, 0xD2, 0xD8, 0xC8, 0x1A, 0x52, 0xCE, 0x0C, 0xC0, 0x00, 0x01, 0xA4, 0x6B, 0x82, 0xDF,
+    0x29, 0x30, 0x5C, 0x4C, 0x00, 0x1D, 0x40, 0x11, 0x8F, 0x14, 0x19, 0x80, 0x00, 0x06, 0x60, 0x33,
+    0x00, 0x8C, 0xD2, 0x7D, 0xC1, 0x58, 0x19, 0xEF, 0x60, 0x2B, 0x03, 0x39, 0x36, 0x01, 0x80, 0x82,
+    0x74, 0xB9, 0x1A, 0xA2, 0x80, 0xB9, 0x60, 0x64, 0xA2, 0x80, 0xAC, 0x08, 0x38, 0x68, 0x0A, 0x5F,
+    0x51, 0x93, 0x24, 0xB4, 0x10, 0x2B, 0x02, 0x10, 0x15, 0x81, 0x06, 0x0A, 0xC0, 0x86, 0x05, 0x60,
+    0x86, 0xF2, 0xA5, 0xCF, 0xFD, 0x91, 0xFB, 0xAE, 0xD3, 0x7E, 0xFA, 0x31, 0xD0, 0xCE, 0x96, 0x3E,
+    0x00, 0x11, 0x80, 0x57, 0xB0, 0x27, 0xAC, 0x11, 0x0E, 0xF4, 0xAD, 0x90, 0x32, 0x65, 0xE1, 0x94,
+    0x60, 0x2B, 0x02, 0x30, 0x37, 0xBD, 0x60, 0x82, 0x15, 0xBC, 0x23, 0x1E, 0xF5, 0x82, 0x1A, 0xDE,
+    0x34, 0xCA, 0xDA, 0xD6, 0x60, 0x3C, 0xAF, 0x60, 0x2B, 0x02, 0xBE, 0xE0, 0xAC, 0x10, 0xD6, 0xE1,
+    0xBE, 0x54, 0xE3, 0xC1, 0xFA, 0x15, 0x45, 0x02, 0x4B, 0x96, 0x08, 0xC7, 0x29, 0x92, 0xC7, 0xC2,
+    0x80, 0x00, 0x00, 0x46, 0x00, 0x02, 0xBE, 0xE1, 0x49, 0x60, 0x8E, 0x70, 0x95, 0x2C, 0x84, 0x67,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1A, 0x5C, 0x37, 0xC9, 0x60, 0x84, 0x68, 0x96, 0x6F, 0xBE,
+    0x25, 0xDF, 0x25, 0x81, 0x39, 0x9E, 0x54, 0x56, 0x24, 0x6C, 0x7C, 0xB3, 0x69, 0x20, 0x79, 0xB2,
+    0x9B, 0x64, 0x03, 0xCB, 0x49, 0x80, 0xC0, 0x33, 0x93, 0x60, 0x00, 0x89, 0x82, 0xEB, 0xD2, 0x57,
+    0xD0, 0x01, 0x1D, 0x62, 0x42, 0x54, 0xB6, 0xBE, 0xA0, 0xA0, 0x6C, 0x80, 0x0A, 0x38, 0x00, 0x04,
+    0x20, 0x84, 0x64, 0xA2, 0x81, 0x39, 0x60, 0x44, 0xC1, 0x32, 0x28, 0xC2, 0x53, 0x45, 0x70, 0x68,
+    0x4B, 0x96, 0x08, 0x26, 0x42, 0x5B, 0x4A, 0x6B, 0x8D, 0xEA, 0x8A, 0x69, 0x9D, 0x49, 0x4A, 0xC4,
+    0x74, 0x29, 0xCF, 0xA5, 0x72, 0x55, 0x2A, 0xA3, 0x4A, 0xA5, 0x50, 0x00, 0xA0, 0x00, 0x55, 0x54,
+    0x50, 0x34, 0xB9, 0x60, 0x44, 0x09, 0x44, 0x25, 0xCB, 0x04, 0x15, 0x22, 0x94, 0x42, 0x53, 0x44,
+    0x0C, 0x64, 0x88, 0xEA, 0x74, 0xA9, 0x99, 0xF8, 0x00, 0x01, 0x3F, 0x14, 0x4F, 0xD2, 0x82, 0x21,
+    0x2E, 0x58, 0x21, 0x1C, 0xF2, 0xCA, 0x40, 0x02, 0xD1, 0x09, 0x72, 0xC0, 0x9C, 0xCF, 0x16, 0x7B,
+    0x14, 0x12, 0x25, 0x6C, 0x7C, 0x23, 0x3A, 0xDA, 0xF8, 0xCE, 0x84, 0x58, 0x1E, 0x50, 0x8C, 0x08,
+    0xC0, 0xFC, 0x84, 0x80, 0xFC, 0x17, 0x01, 0xE4, 0xC5, 0x81, 0xE4, 0x17, 0x01, 0xE4, 0x00, 0x01,
+    0x71, 0x6A, 0x60, 0x86, 0xB0, 0x2A, 0x49, 0x9E, 0x7A, 0xBC, 0x7A, 0x2C, 0x94, 0x22, 0xD1, 0x2B,
+    0x0D, 0x01, 0x4B, 0xEA, 0x32, 0x64, 0x96, 0x82, 0xD3, 0x44, 0x42, 0x69, 0x95, 0xA0, 0xF4, 0xC4,
+    0x90, 0xDA, 0xAF, 0x89, 0x07, 0x38, 0x90, 0xE8, 0xCE, 0xD7, 0xD2, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x08, 0x30, 0x8D, 0x60, 0x86, 0x6B, 0x1D, 0x0E, 0x7D, 0xF7, 0xC4, 0x10, 0x46, 0xB0,
+    0x27, 0x33, 0xCA, 0x8C, 0x82, 0x0D, 0x30, 0x9D, 0xB0, 0xA6, 0x46, 0x00, 0x00, 0x00, 0x00, 0x83,
+    0x0D, 0xE3, 0x58, 0x20, 0xAC, 0x64, 0xAB, 0x3A, 0x2D, 0xA0, 0x9B, 0x04, 0x7C, 0x41, 0xBC, 0x6B,
+    0x02, 0x73, 0x3C, 0xA9, 0x08, 0x19, 0x0C, 0x74, 0xAA, 0x56, 0xC8, 0x02, 0x90, 0x01, 0x18, 0x00,
+    0x00, 0x00, 0x02, 0x18, 0x3A, 0x8D, 0x60, 0x82, 0x72, 0x1A, 0x4E, 0xB8, 0x5B, 0x0C, 0x23, 0x21,
+    0xEC, 0x04, 0x35, 0x46, 0xB0, 0x48, 0x48, 0xC8, 0x53, 0x2D, 0xF3, 0xAE, 0x14, 0x40, 0x00, 0x00,
+    0x00, 0x7E, 0x23, 0x38, 0x00, 0x10, 0x81, 0xA4, 0x6B, 0x02, 0x93, 0x99, 0xE5, 0x41, 0x40, 0xC9,
+    0x59, 0xB2, 0xBE, 0xA0, 0xB0, 0x86, 0xAD, 0x8D, 0x36, 0x78, 0x86, 0x19, 0x4D, 0x3C, 0x3E, 0x00,
+    0x00, 0x08, 0x44, 0x8D, 0x60, 0x4E, 0x67, 0x95, 0x35, 0x81, 0x21, 0x4E, 0x96, 0x3A, 0x12, 0x9D,
+    0x2F, 0x8C, 0x80, 0x00, 0x00, 0x11, 0xD0, 0x3B, 0x05, 0x88, 0x7F, 0x81, 0x18, 0xCE, 0x1A, 0x7A,
+    0x35, 0x80, 0x00, 0x00, 0x16, 0x23, 0x4D, 0x81, 0x05, 0xE0, 0x82, 0x66, 0x4D, 0x95, 0x2A, 0x00,
+    0x02, 0xB0, 0x20, 0xBC, 0x10, 0x4F, 0x49, 0xC5, 0x57, 0x24, 0x17, 0x82, 0x13, 0x59, 0x3C, 0xFD,
+    0xCA, 0x74, 0xCA, 0x5B, 0x80, 0x08, 0x27, 0x2D, 0x1D, 0xBB, 0x43, 0x21, 0xA8, 0x66, 0x05, 0x1E,
+    0x07, 0x2B, 0x43, 0x26, 0x18, 0x66, 0x13, 0xA8, 0xF0, 0x41, 0x43, 0xA8, 0x80, 0xE5, 0x68, 0x64,
+    0xC3, 0x0C, 0xC1, 0xA3, 0xC0, 0xEE, 0x2B, 0x42, 0xF2, 0x18, 0x66, 0x0B, 0xC1, 0x05, 0x34, 0x75,
+    0x85, 0x1D, 0x04, 0xC9, 0x2A, 0x00, 0xBC, 0x0E, 0xD0, 0xC8, 0x6A, 0x19, 0x82, 0xF0, 0x41, 0x4B,
+    0xA9, 0x76, 0x82, 0x64, 0x95, 0x94, 0xB0, 0x0C, 0x03, 0xB4, 0x32, 0x1A, 0x86, 0x7A, 0xA9, 0x68,
+    0xA7, 0x09, 0x16, 0xCB, 0xE0, 0x00, 0x04, 0x60, 0x00, 0x2B, 0x02, 0x14, 0xDE, 0x08, 0xA7, 0x58,
+    0x5F, 0x19, 0xE9, 0x18, 0x00, 0x00, 0x00, 0x20, 0x43, 0x64, 0xDE, 0x08, 0x41, 0x8D, 0xF4, 0x08,
+    0x16, 0x4D, 0xE0, 0x90, 0xA3, 0x88, 0xA8, 0x53, 0x5D, 0x2C, 0xA7, 0xA5, 0x02, 0x7A, 0x9E, 0xA7,
+    0xAC, 0xB0, 0x8A, 0x22, 0xBB, 0x8A, 0xD0, 0xBC, 0x86, 0x19, 0x85, 0x47, 0x81, 0x1D, 0x04, 0xE5,
+    0x4C, 0x57, 0x68, 0x64, 0x35, 0x0C, 0xF4, 0x48, 0x41, 0x3B, 0x5C, 0xED, 0xC3, 0x21, 0x85, 0x26,
+    0x0B, 0xA8, 0xF0, 0x3B, 0x43, 0x21, 0xA8, 0x66, 0x19, 0x5D, 0x47, 0x82, 0x0A, 0x8A, 0xEB, 0xC5,
+    0xDA, 0x19, 0x0D, 0x43, 0x3D, 0x95, 0xF1, 0x29, 0x4B, 0x11, 0x0A, 0x84, 0xA9, 0xB2, 0xAD, 0xC5,
+    0x02, 0x91, 0xE6, 0x14, 0x02, 0x31, 0x40, 0xF5, 0x29, 0x00, 0x02, 0x91, 0x12, 0x1B, 0xA8, 0xF0,
+    0x2D, 0x78, 0x22, 0x5D, 0x47, 0x82, 0x0A, 0x0A, 0x99, 0xB7, 0x68, 0x64, 0x35, 0x0C, 0xF4, 0xD9,
+    0x60, 0xA1, 0xA5, 0xAC, 0x70, 0xC8, 0x61, 0x49, 0xEB, 0xBD, 0x90, 0x94, 0x12, 0xA4, 0x37, 0xB9,
+    0x5E, 0x43, 0x0C, 0xC2, 0x2B, 0xA8, 0xF0, 0x41, 0x3B, 0x42, 0xC9, 0xC3, 0x21, 0x85, 0x27, 0xAA,
+    0x5F, 0x79, 0x0C, 0x33, 0x11, 0xA5, 0x75, 0x1E, 0x08, 0xEA, 0x20, 0x54, 0xB6, 0xBA, 0x57, 0x11,
+    0x4D, 0xA3, 0x69, 0x2C, 0x36, 0x80, 0x00, 0x01, 0xDA, 0x19, 0x0D, 0x43, 0x31, 0x0A, 0xEA, 0x3C,
+    0x10, 0x4F, 0x26, 0xB7, 0x61, 0x86, 0x61, 0xB4, 0xAE, 0xA3, 0xC0, 0xF2, 0x18, 0x66, 0x28, 0x5A,
+    0x57, 0x51, 0xE0, 0x82, 0xA6, 0x86, 0x50, 0x70, 0xC8, 0x61, 0x49, 0xEA, 0xBE, 0xA4, 0x29, 0x41,
+    0x5B, 0xA3, 0x29, 0xDF, 0x4A, 0x10, 0x00, 0x00, 0x08, 0xA5, 0x68, 0x8A, 0x22, 0x88, 0xAE, 0x19,
+    0x0C, 0x29, 0x31, 0x5A, 0x57, 0x51, 0xE0, 0x82, 0x70, 0xC9, 0x3B, 0xC8, 0x61, 0x9E, 0x89, 0x86,
+    0x18, 0x67, 0xAA, 0x4F, 0x82, 0x71, 0x85, 0xBA, 0x86, 0x62, 0x05, 0xA5, 0x75, 0x1E, 0x06, 0x18,
+    0x66, 0x34, 0x82, 0xD2, 0xBA, 0x8F, 0x04, 0x85, 0x44, 0x65, 0x34, 0xA7, 0x4B, 0xE8, 0x41, 0x35,
+    0x8D, 0x64, 0xD4, 0x00, 0x35, 0x80, 0x00, 0x01, 0xE4, 0x30, 0xCC, 0x60, 0xB4, 0xAE, 0xA3, 0xC1,
+    0x04, 0xE1, 0x93, 0x74, 0x98, 0xB2, 0x0B, 0x4A, 0xEA, 0x3C, 0x0A, 0x19, 0x8E, 0x39, 0x05, 0xA5,
+    0x75, 0x1E, 0x08, 0x26, 0x1C, 0x9F, 0x50, 0xCF, 0x54, 0x70, 0xC3, 0x0C, 0xF5, 0x5C, 0x72, 0x14,
+    0x50, 0x8C, 0x86, 0x9D, 0x2D, 0x81, 0x05, 0x28, 0x34, 0x80, 0x03, 0x48, 0x00, 0x34, 0x8D, 0x26,
+    0x18, 0x66, 0x3C, 0x82, 0xD2, 0xBA, 0x8F, 0x04, 0x13, 0xCC, 0x6C, 0xC6, 0x1C, 0x82, 0xD2, 0xBA,
+    0x8F, 0x02, 0x4C, 0x80, 0x8E, 0x41, 0x69, 0x5D, 0x47, 0x82, 0x09, 0x82, 0x36, 0xD2, 0x7A, 0xEE,
+    0xE2, 0x86, 0x7A, 0xAE, 0xB8, 0xE9, 0x98, 0x49, 0x1B, 0x5F, 0x1A, 0x3C, 0x8E, 0x17, 0xE3, 0x85,
+    0xF8, 0xE1, 0x7E, 0x38, 0x47, 0x20, 0xB4, 0xAE, 0xA3, 0xC0, 0xA1, 0x99, 0x03, 0x90, 0x5A, 0x57,
+    0x51, 0xE0, 0x4E, 0x11, 0x30, 0x8E, 0x41, 0x69, 0x5D, 0x47, 0x82, 0x0A, 0x83, 0x38, 0x81, 0x27,
+    0xA6, 0x9D, 0x4A, 0x1A, 0x08, 0x86, 0x42, 0x9D, 0x09, 0x52, 0xD8, 0xD7, 0xC2, 0x32, 0x9D, 0xC0,
+    0xD9, 0x80, 0xB7, 0xEC, 0xE1, 0xC0, 0x97, 0xC3, 0x16, 0x00, 0x34, 0x41, 0x44, 0x40, 0x13, 0x00,
+    0xB7, 0xC0, 0x08, 0xC0, 0x13, 0x00, 0x4A, 0xC2, 0x03, 0xC0, 0x13, 0x00, 0x1E, 0x40, 0x6F, 0x80,
+    0x1E, 0x41, 0x81, 0x18, 0x28, 0xA0, 0x2E, 0x03, 0x25, 0x14, 0xDF, 0x70, 0xF5, 0xD1, 0x4C, 0xC0,
+    0x17, 0xB8, 0x10, 0x4C, 0x1B, 0xBC, 0xA8, 0xA0, 0x2E, 0x02, 0xBC, 0x80, 0xB8, 0x08, 0x98, 0x26,
+    0x2B, 0xDE, 0x41, 0x02, 0xE3, 0x81, 0x0F, 0x9E, 0xA4, 0x14, 0x96, 0xF6, 0x98, 0x47, 0x2A, 0x2C,
+    0x65, 0x92, 0x08, 0x17, 0x01, 0x2E, 0x0B, 0x80, 0x85, 0x05, 0xC0, 0x42, 0xC2, 0x45, 0xCA, 0x88,
+    0x12, 0x86, 0xA1, 0x44, 0x09, 0x5C, 0x08, 0x26, 0xBD, 0x10, 0x05, 0xC0, 0x4E, 0x02, 0xE0, 0x41,
+    0x3D, 0x4A, 0x8D, 0x5F, 0x30, 0x5C, 0x40, 0x42, 0x51, 0x51, 0x7A, 0xFB, 0x24, 0xD5, 0x4A, 0x42,
+    0x59, 0x43, 0x7B, 0x0B, 0x68, 0xE1, 0x29, 0x05, 0xB4, 0x69, 0x33, 0x41, 0x0D, 0x2E, 0x05, 0xC0,
+    0x90, 0x93, 0xA1, 0x4E, 0x8C, 0xEF, 0x9D, 0x24, 0x80, 0x00, 0x00, 0x00, 0x00, 0x88, 0x23, 0x00,
+    0x2A, 0x28, 0x10, 0x5C, 0x06, 0x45, 0x39, 0x9E, 0x54, 0x13, 0x3D, 0x0C, 0xA1, 0x01, 0x70, 0x12,
+    0x9A, 0x6F, 0x91, 0x4E, 0x23, 0xA9, 0xD2, 0xA0, 0x00, 0x00, 0x00, 0x23, 0x4A, 0x06, 0x80, 0xB8,
+    0x08, 0x71, 0x28, 0x80, 0xB8, 0x11, 0x59, 0x40, 0x8C, 0xAF, 0xBD, 0x8F, 0x02, 0x86, 0xCC, 0x81,
+    0x1D, 0x9E, 0x2E, 0x60, 0x03, 0xDC, 0x06, 0xA6, 0x60, 0x12, 0x1E, 0xE0, 0x41, 0x82, 0x69, 0x5D,
+    0x0D, 0xC2, 0xB9, 0x5A, 0x3A, 0x42, 0x54, 0xB1, 0xF0, 0x8C, 0xC4, 0x60, 0x00, 0x02, 0x44, 0x00,
+    0x00, 0x00, 0x2B, 0xC8, 0x15, 0xDC, 0x08, 0x8C, 0x79, 0x51, 0x6B, 0xD4, 0x25, 0x4E, 0xD5, 0xB5,
+    0x81, 0xA1, 0x34, 0xDF, 0x64, 0x1C, 0x64, 0x29, 0x92, 0xC8, 0x4F, 0x08, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x40, 0xDF, 0x77, 0x02, 0x21, 0x86, 0x53, 0x4F, 0x0F, 0x80, 0xF8, 0x02, 0x11,
+    0xF7, 0x70, 0x13, 0x99, 0xE5, 0x49, 0x5A, 0x44, 0x74, 0x29, 0x8E, 0x85, 0x32, 0x0B, 0x41, 0x68,
+    0xF9, 0x05, 0xA0, 0x02, 0x75, 0x00, 0x01, 0x18, 0x0B, 0x5D, 0x14, 0xCC, 0x02, 0x7B, 0x81, 0x04,
+    0xE8, 0xA2, 0x26, 0xA6, 0x61, 0xA2, 0xB1, 0x73, 0x0D, 0x71, 0xC6, 0x09, 0xF2, 0x84, 0x69, 0x00,
+    0x50, 0xF7, 0x01, 0x73, 0x00, 0xE8, 0x87, 0xB8, 0x11, 0x94, 0x23, 0xA9, 0xD2, 0xA6, 0x42, 0xD0,
+    0x00, 0x00, 0x0B, 0x52, 0x32, 0x01, 0xA9, 0x98, 0x06, 0x87, 0xB8, 0x10, 0x4D, 0x4C, 0xBA, 0xB9,
+    0x86, 0x8A, 0xD4, 0x86, 0xAB, 0xDA, 0x12, 0x21, 0x4C, 0x8F, 0xDD, 0x85, 0x44, 0x3D, 0xC0, 0x82,
+    0x6C, 0xC1, 0x94, 0x86, 0x98, 0xA0, 0x99, 0xA2, 0x1E, 0xE0, 0x46, 0x4C, 0x0E, 0x89, 0x52, 0xB9,
+    0x12, 0x09, 0x04, 0x94, 0x24, 0x19, 0x44, 0x3C, 0xD1, 0x0F, 0x70, 0x17, 0x30, 0x12, 0x88, 0x7B,
+    0x80, 0x9C, 0x12, 0x19, 0xA2, 0x1E, 0xE0, 0x41, 0x56, 0x61, 0x6A, 0x24, 0x34, 0xDD, 0xA6, 0x30,
+    0x62, 0x21, 0x4C, 0x74, 0x29, 0xD2, 0xB5, 0xF2, 0x0A, 0x43, 0xB8, 0x9E, 0x60, 0x00, 0x0A, 0x46,
+    0x76, 0x04, 0x60, 0x46, 0x26, 0x21, 0x10, 0x45, 0x40, 0x46, 0xB6, 0x28, 0x45, 0x70, 0x11, 0x10,
+    0x43, 0x4B, 0xB4, 0x5E, 0x41, 0x45, 0x91, 0x78, 0x85, 0xD1, 0x0D, 0x18, 0xE2, 0x19, 0x0A, 0x63,
+    0xDC, 0x00, 0x04, 0x60, 0x00, 0x00, 0x42, 0x87, 0x62, 0xB8, 0x0B, 0x7E, 0x08, 0x5B, 0x15, 0xC0,
+    0x86, 0x94, 0x16, 0xD7, 0x0D, 0x41, 0x08, 0x69, 0x7D, 0x54, 0x43, 0xDE, 0x85, 0x16, 0xA9, 0x7D,
+    0xA8, 0x51, 0x04, 0x52, 0xB8, 0x10, 0xD4, 0x54, 0x5A, 0xF0, 0x94, 0xAD, 0xCA, 0xE9, 0xAE, 0x45,
+    0x6D, 0x0A, 0x87, 0xDA, 0xE0, 0x23, 0xEC, 0xBD, 0x1F, 0x7B, 0xB7, 0xF1, 0xA5, 0x28, 0x80, 0x2B,
+    0x81, 0x09, 0x77, 0x15, 0x29, 0x28, 0x25, 0x6A, 0x14, 0x5A, 0xE8, 0x02, 0x94, 0x41, 0xDC, 0xA5,
+    0x70, 0x25, 0xA4, 0x22, 0x29, 0xD4, 0xE8, 0xCA, 0x74, 0xBE, 0x47, 0x40, 0x01, 0xD0, 0xE8, 0x74,
+    0x00, 0x11, 0x80, 0x0C, 0x0A, 0x51, 0xD2, 0x5C, 0x34, 0x15, 0xC0, 0x4A, 0x67, 0x9F, 0x04, 0x34,
+    0xBB, 0x45, 0x4C, 0x20, 0x9E, 0x59, 0x13, 0x82, 0x51, 0x05, 0x70, 0x21, 0x98, 0x25, 0x8C, 0xDF,
+    0x00, 0x01, 0x2E, 0x82, 0xB8, 0x09, 0xCC, 0xF2, 0xA6, 0x28, 0xE1, 0x11, 0x0A, 0x87, 0x46, 0x53,
+    0xA5, 0xAE, 0x66, 0x09, 0x04, 0x50, 0x46, 0x00, 0x00, 0x06, 0x61, 0x14, 0x66, 0x1F, 0x60, 0x02,
+    0xE4, 0x82, 0x0C, 0xA5, 0x70, 0x1A, 0x85, 0x16, 0xBA, 0x39, 0x0C, 0x27, 0x43, 0xAC, 0x04, 0x11,
+    0x4A, 0xE0, 0x41, 0x4D, 0xC5, 0x60, 0x6A, 0x14, 0x5A, 0x67, 0xB0, 0x4F, 0x4B, 0xC0, 0xD7, 0x16,
+    0xE0, 0x9C, 0xB7, 0x50, 0x82, 0x0A, 0xE5, 0x2B, 0x80, 0xA5, 0x10, 0x94, 0xB9, 0x4A, 0xE0, 0x49,
+    0x58, 0x44, 0x53, 0xC6, 0x53, 0xA5, 0xF3, 0x7D, 0x84, 0x28, 0x32, 0x00, 0x00, 0xC8, 0x00, 0x12,
+    0x4D, 0x2C, 0x0C, 0x9A, 0x85, 0x10, 0x97, 0x29, 0x5C, 0x08, 0x26, 0x2D, 0x1A, 0x41, 0x6A, 0xB4,
+    0xD4, 0xA2, 0xD1, 0x1D, 0x04, 0xE2, 0xA2, 0x40, 0xE9, 0x72, 0x95, 0xC0, 0x82, 0x62, 0x89, 0x94,
+    0x16, 0x98, 0xC0, 0xA5, 0xA5, 0xCA, 0x57, 0x02, 0x32, 0x44, 0x42, 0x9E, 0x57, 0xCA, 0x48, 0xB6,
+    0x29, 0x49, 0x24, 0x85, 0x22, 0x16, 0x97, 0x29, 0x5C, 0x05, 0x28, 0x85, 0xA5, 0xCA, 0x57, 0x01,
+    0x38, 0x28, 0x8B, 0x4B, 0x94, 0xAE, 0x04, 0x15, 0x14, 0x56, 0x02, 0x0B, 0x4D, 0xB2, 0x9C, 0x03,
+    0xB1, 0x0C, 0x85, 0x31, 0xD0, 0xA5, 0xB1, 0xAE, 0x7C, 0xA7, 0x4A, 0xD8, 0x03, 0x08, 0x05, 0xEA,
+    0x6A, 0x4C, 0x00, 0x8C, 0x17, 0x10, 0x07, 0x74, 0x4D, 0x70, 0x13, 0x9C, 0x01, 0x18, 0x04, 0x64,
+    0x37, 0x10, 0x01, 0x18, 0x0E, 0x3C, 0x0B, 0xB0, 0x28, 0xB0, 0x01, 0xA4, 0x1E, 0x80, 0x09, 0x24,
+    0x02, 0x31, 0x8B, 0x23, 0x81, 0x40, 0x31, 0x51, 0x40, 0x72, 0x06, 0x70, 0x5A, 0x0E, 0x40, 0xD2,
+    0x49, 0x80, 0xA0, 0x1D, 0xEC, 0x79, 0x50, 0xE0, 0x9F, 0x20, 0x47, 0x41, 0x30, 0x5E, 0xCA, 0x0C,
+    0x0A, 0x01, 0x08, 0x05, 0x00, 0x8C, 0x82, 0x67, 0x05, 0x94, 0x78, 0x39, 0x02, 0x96, 0x40, 0xB3,
+    0x20, 0x82, 0x67, 0x3D, 0xE5, 0x0B, 0x41, 0xC8, 0x1D, 0x8F, 0x29, 0xF5, 0x5A, 0x10, 0x91, 0x22,
+    0xBC, 0x7A, 0xB1, 0x4B, 0x60, 0x72, 0x05, 0xB1, 0x41, 0x96, 0x41, 0x11, 0x25, 0x63, 0x9F, 0x20,
+    0xF4, 0x10, 0x79, 0x76, 0x54, 0x50, 0x1C, 0x81, 0x5C, 0xF0, 0x72, 0x05, 0x10, 0x40, 0xA0, 0x20,
+    0x9C, 0xEC, 0x64, 0xEC, 0x79, 0x4E, 0x13, 0xCF, 0x90, 0x42, 0x5B, 0xC2, 0xEB, 0xD7, 0x74, 0x94,
+    0xA7, 0x00, 0xF9, 0x04, 0x83, 0x88, 0x28, 0x53, 0x63, 0x3B, 0xE9, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x42, 0xD0, 0x9D, 0x90, 0x47, 0x3A, 0x96, 0xD7, 0x46, 0x77, 0xD0, 0x04, 0x60, 0x00,
+    0x00, 0x00, 0x01, 0x1A, 0x18, 0x5D, 0x90, 0x42, 0x0A, 0x96, 0xE0, 0x46, 0x85, 0xD9, 0x04, 0x55,
+    0x9C, 0x65, 0x63, 0x9E, 0x0F, 0xEA, 0x55, 0x68, 0x89, 0xD1, 0xB1, 0x13, 0x04, 0xA8, 0x92, 0xC0,
+    0x00, 0x14, 0x04, 0x18, 0x26, 0xB2, 0xBD, 0x7C, 0x25, 0x68, 0xA4, 0xB0, 0x44, 0x29, 0xD0, 0xA7,
+    0x4A, 0xF9, 0x00, 0x0B, 0xB8, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x05,
+    0x45, 0x02, 0x2E, 0x41, 0x04, 0xC8, 0xB3, 0x09, 0x4D, 0x16, 0xE8, 0x50, 0x8B, 0x2C, 0x82, 0x31,
+    0xC4, 0x75, 0x3A, 0x54, 0xC8, 0x00, 0x00, 0x00, 0x23, 0x00, 0x94, 0x0D, 0x05, 0xC8, 0x21, 0x04,
+    0xF2, 0xC8, 0x25, 0x10, 0x5C, 0x82, 0x53, 0x13, 0xB0, 0x8C, 0xAC, 0x73, 0xE5, 0x3A, 0x85, 0x90,
+    0xC9, 0x00, 0xC8, 0x9E, 0x52, 0xA8, 0x7C, 0x4A, 0xC8, 0x2A, 0x83, 0xC0, 0x1B, 0xAA, 0x26, 0x00,
+    0x18, 0x38, 0x28, 0x00, 0x67, 0x88, 0x20, 0x01, 0x8B, 0x6E, 0x03, 0x90, 0x41, 0x85, 0x4B, 0x1D,
+    0x90, 0x8A, 0x00, 0x08, 0xE8, 0x30, 0x0B, 0xE5, 0xAF, 0x38, 0x4B, 0x5C, 0xC1, 0x80, 0x6B, 0x2D,
+    0x26, 0xAD, 0xE0, 0x39, 0x04, 0x13, 0x22, 0xCF, 0x2D, 0x38, 0x0E, 0x40, 0x85, 0xD9, 0x08, 0xF0,
+    0x60, 0x54, 0x48, 0xFE, 0x2C, 0x8E, 0x00, 0x23, 0x24, 0xC4, 0x2C, 0xA9, 0x6B, 0xAB, 0x1C, 0xE7,
+    0x11, 0x19, 0x11, 0x58, 0xA5, 0xB0, 0x52, 0xC8, 0x18, 0xB6, 0xE6, 0x79, 0x4A, 0x52, 0x87, 0x62,
+    0xCB, 0x20, 0x82, 0xC2, 0xDA, 0xE8, 0x52, 0xC0, 0xE4, 0x10, 0x58, 0x5B, 0x5B, 0x32, 0x5B, 0x4C,
+    0x9E, 0x4A, 0xC4, 0x32, 0x14, 0xC7, 0x44, 0xAD, 0x70, 0x84, 0x00, 0x01, 0x18, 0x71, 0x08, 0x56,
+    0x68, 0x00, 0x0A, 0xA0, 0x00, 0x96, 0x0C, 0xB2, 0xC8, 0x16, 0xC5, 0xD5, 0x22, 0x41, 0x41, 0x6D,
+    0x53, 0xAA, 0x59, 0x82, 0x92, 0xDA, 0xF2, 0x9C, 0xD5, 0x10, 0x47, 0x40, 0x86, 0x42, 0x98, 0xF2,
+    0xB8, 0x00, 0xFA, 0xD0, 0x00, 0x02, 0x18, 0xF8, 0x96, 0x2C, 0xB2, 0x01, 0x0B, 0x62, 0xCB, 0x20,
+    0x4E, 0x67, 0x8B, 0x04, 0x24, 0xB8, 0x52, 0xD8, 0xB2, 0xC8, 0x24, 0x2C, 0x41, 0x42, 0x96, 0xC6,
+    0xB9, 0xE0, 0x8C, 0x00, 0x00, 0x01, 0xE4, 0x96, 0x80, 0x01, 0x3C, 0x11, 0x4A, 0xE7, 0x84, 0xCC,
+    0x82, 0x09, 0x8A, 0xC7, 0x92, 0x40, 0x33, 0x20, 0x52, 0xC8, 0x30, 0xB1, 0x99, 0x04, 0x13, 0x85,
+    0x8A, 0x14, 0xB2, 0x09, 0x8C, 0xC8, 0x18, 0x25, 0x96, 0x98, 0xE4, 0x24, 0x38, 0x2C, 0x8A, 0xB2,
+    0x57, 0xF3, 0x55, 0xA5, 0x1D, 0x02, 0x42, 0x54, 0xC6, 0xBE, 0x00, 0x04, 0x60, 0x00, 0x00, 0x0A,
+    0xA0, 0x08, 0xF0, 0xDC, 0xCC, 0x82, 0x09, 0xEC, 0xF9, 0x20, 0xE5, 0x80, 0x84, 0x66, 0x26, 0x0F,
+    0x80, 0x23, 0xDC, 0xCC, 0x81, 0x39, 0x9E, 0x54, 0x74, 0xAC, 0x25, 0x7C, 0x67, 0x7D, 0x2D, 0x05,
+    0xA0, 0x02, 0xF9, 0x7C, 0xBE, 0x5F, 0x60, 0x96, 0x41, 0xB1, 0x99, 0x02, 0x86, 0x42, 0x14, 0x2C,
+    0x66, 0x41, 0x04, 0xC1, 0x2B, 0xCA, 0x59, 0x69, 0xBD, 0x24, 0xB5, 0xCE, 0xA8, 0xC9, 0x89, 0x0B,
+    0x29, 0xDF, 0x49, 0x81, 0x6B, 0x3C, 0x00, 0x5F, 0x00, 0x29, 0x64, 0x20, 0x58, 0xCC, 0x81, 0x38,
+    0x24, 0x8A, 0x16, 0x33, 0x20, 0x82, 0xA2, 0xCA, 0xA3, 0x49, 0x69, 0xBB, 0x41, 0x3C, 0x8B, 0x29,
+    0x39, 0xAA, 0x53, 0x82, 0xA2, 0xCA, 0x33, 0x4E, 0x0B, 0x22, 0x85, 0x8C, 0xC8, 0x24, 0x28, 0x46,
+    0x42, 0x58, 0xF8, 0x52, 0xC0, 0x00, 0x00, 0x1B, 0x14, 0x6B, 0x00, 0x6C, 0x00, 0x00, 0x0E, 0xF6,
+    0x3C, 0xA8, 0x70, 0x8F, 0x90, 0x41, 0x3B, 0x1E, 0xA1, 0x9E, 0x53, 0xEE, 0xBB, 0x05, 0xD8, 0xF2,
+    0x9F, 0x4D, 0xFA, 0x0A, 0x1E, 0xC9, 0x28, 0x48, 0x2B, 0x1E, 0x46, 0x8E, 0x87, 0x05, 0xE7, 0xC8,
+    0x19, 0xE5, 0x3E, 0xAB, 0xB9, 0x4A, 0x70, 0xD8, 0xF3, 0xE4, 0x11, 0x14, 0x95, 0xB1, 0xF0, 0x0C,
+    0x93, 0x41, 0xCC, 0x00, 0x76, 0x3C, 0xA7, 0x0D, 0xE7, 0xC8, 0x20, 0xA5, 0x8F, 0x9A, 0xB3, 0xCA,
+    0x7D, 0x14, 0xB0, 0x94, 0x56, 0x3C, 0x28, 0xB9, 0x10, 0xE1, 0x31, 0xE7, 0xC8, 0x20, 0x9D, 0xE5,
+    0x40, 0xA5, 0x3E, 0xBA, 0xDA, 0x87, 0x11, 0xEC, 0x79, 0xF2, 0x08, 0xAA, 0x59, 0x52, 0xC7, 0xC0,
+    0x70, 0x38, 0xC3, 0x24, 0x88, 0xE3, 0x67, 0x94, 0xE2, 0x31, 0xE7, 0xC8, 0x20, 0xA5, 0xE5, 0x93,
+    0x29, 0x4F, 0xAA, 0x18, 0x82, 0x73, 0xBD, 0x20, 0x6F, 0x63, 0xCF, 0x90, 0x21, 0xC5, 0x2B, 0xD8,
+    0xF3, 0xE4, 0x10, 0x54, 0xF2, 0xCE, 0x8A, 0x53, 0xEA, 0xBC, 0x64, 0x24, 0xE4, 0x2A, 0x58, 0xF8,
+    0x4A, 0xEB, 0xD3, 0x22, 0x6D, 0x37, 0x60, 0x19, 0x3D, 0x97, 0xA9, 0xC1, 0x0A, 0xF6, 0x3C, 0xF9,
+    0x02, 0x94, 0xE2, 0xBD, 0x8F, 0x3E, 0x40, 0x9C, 0x14, 0xE5, 0x7B, 0x1E, 0x7C, 0x81, 0x8A, 0x7E,
+    0x68, 0x83, 0x82, 0xA2, 0x9E, 0x3A, 0x43, 0xE9, 0xA5, 0x41, 0x39, 0xCB, 0x29, 0x39, 0xAE, 0xF4,
+    0xCE, 0x72, 0x44, 0x32, 0x18, 0xEA, 0x74, 0xA7, 0x4A, 0xDB, 0x19, 0x0B, 0x29, 0x15, 0xB0, 0x9F,
+    0xC0, 0x2D, 0x23, 0x08, 0x19, 0x31, 0x08, 0xC1, 0x0B, 0x07, 0xC8, 0x4B, 0xA0, 0x25, 0x03, 0xAC,
+    0x09, 0xFC, 0x31, 0xC6, 0x1A, 0x2E, 0x12, 0x46, 0x80, 0x41, 0x31, 0xEA, 0xF2, 0xA5, 0x00, 0xA0,
+    0x0E, 0xF9, 0x22, 0x80, 0x9D, 0x00, 0x82, 0x77, 0x9D, 0x43, 0x49, 0x14, 0x00, 0xE8, 0x03, 0xBE,
+    0x48, 0xA0, 0x55, 0x3A, 0x01, 0x04, 0xC5, 0xA3, 0xCB, 0x62, 0x81, 0x90, 0x41, 0x32, 0x5E, 0xCA,
+    0x5C, 0x14, 0x01, 0x04, 0x0A, 0x01, 0x09, 0x43, 0x3D, 0x28, 0x7E, 0x0D, 0x2B, 0x04, 0x2D, 0x98,
+    0x14, 0x02, 0x0C, 0x07, 0x49, 0x29, 0x78, 0x48, 0x4D, 0x2A, 0x3D, 0x10, 0xA8, 0xB8, 0x28, 0x02,
+    0xA4, 0x40, 0xA0, 0x10, 0xA0, 0x34, 0xD2, 0x47, 0x4A, 0x47, 0xD7, 0x4D, 0x3A, 0x1A, 0xC6, 0x7A,
+    0x56, 0x9F, 0x63, 0xAA, 0xB9, 0xAA, 0xA6, 0x8B, 0x11, 0x94, 0xEC, 0x75, 0x2E, 0xF7, 0x5F, 0xCA,
+    0xEB, 0xBE, 0x9D, 0xDF, 0xB3, 0xFB, 0x55, 0xAA, 0x16, 0x89, 0x01, 0x9D, 0x34, 0xAF, 0xE1, 0xC4,
+    0x83, 0xDC, 0x84, 0xF7, 0xE2, 0xB6, 0xBB, 0xEB, 0x16, 0x21, 0x19, 0x4E, 0x9A, 0x7F, 0x48, 0x30,
+    0xCC, 0xDF, 0xBA, 0x7B, 0xBB, 0x77, 0xF2, 0x8F, 0x8D, 0xDA, 0x6E, 0x42, 0xD6, 0x33, 0xA5, 0xF0,
+    0x95, 0x72, 0x0F, 0xC7, 0xCA, 0x67, 0x2D, 0x60, 0x8C, 0x00, 0x0B, 0x50, 0xCE, 0xA9, 0xB8, 0x54,
+    0x40, 0x15, 0xE2, 0xCF, 0x3D, 0x52, 0x20, 0xA8, 0x34, 0x02, 0x09, 0x92, 0xF6, 0x52, 0xFA, 0x6E,
+    0x48, 0x2D, 0x35, 0x98, 0x28, 0x7A, 0x6C, 0x1A, 0x48, 0xA6, 0xCA, 0x3B, 0x82, 0x84, 0xBE, 0x16,
+    0x12, 0x91, 0x2B, 0x82, 0x16, 0x40, 0x28, 0x00, 0x28, 0xA0, 0x23, 0xA0, 0xE2, 0x42, 0x58, 0xE8,
+    0x58, 0x8C, 0x01, 0x7C, 0x00, 0x00, 0x00, 0x01, 0x04, 0x1B, 0xE8, 0x80, 0x42, 0x09, 0xD1, 0x60,
+    0x41, 0x3E, 0x88, 0x04, 0x15, 0x8A, 0xF6, 0xDF, 0x4D, 0xE6, 0x3A, 0x02, 0x55, 0xBE, 0x33, 0xAD,
+    0xC0, 0x00, 0x08, 0xC0, 0x00, 0x00, 0x14, 0x92, 0xE1, 0xA6, 0x88, 0x04, 0x13, 0x8A, 0xF2, 0x75,
+    0xCE, 0x98, 0x26, 0x89, 0x5F, 0x12, 0xE9, 0xA2, 0x00, 0x9C, 0xCF, 0x2A, 0x6B, 0x50, 0x21, 0x98,
+    0xE9, 0x52, 0xDC, 0xFA, 0x56, 0xD9, 0x02, 0x26, 0x01, 0x40, 0x89, 0x68, 0xC0, 0xE8, 0x82, 0x80,
+    0x00, 0x00, 0x23, 0x07, 0x28, 0x5B, 0x06, 0xB8, 0x04, 0x40, 0x50, 0x2A, 0x50, 0x11, 0xD0, 0x04,
+    0x4F, 0x1B, 0x94, 0xB4, 0x13, 0x26, 0xAC, 0x22, 0x34, 0x4B, 0x3B, 0xE4, 0x8A, 0x69, 0xB7, 0x41,
+    0x43, 0xEB, 0x74, 0xD2, 0x45, 0x36, 0xD9, 0x3E, 0x12, 0x64, 0x9A, 0xD3, 0x85, 0x0A, 0x8A, 0x03,
+    0x53, 0xA0, 0x0D, 0x24, 0x50, 0x37, 0xD4, 0xE8, 0x04, 0x26, 0xA5, 0xF5, 0xB0, 0xE7, 0xB5, 0xE0,
+    0xAA, 0xE8, 0x93, 0x41, 0x40, 0x23, 0xA4, 0x47, 0x42, 0x96, 0xFA, 0xE4, 0x00, 0xA5, 0x00, 0x00,
+    0x04, 0x66, 0x20, 0x02, 0x20, 0x34, 0x9D, 0x00, 0x82, 0x79, 0x22, 0x4A, 0xA2, 0x9B, 0x69, 0x1D,
+    0x05, 0x0F, 0x44, 0x4B, 0x49, 0x14, 0xD7, 0x49, 0x62, 0x18, 0x47, 0x53, 0xB2, 0x00, 0x0F, 0xBE,
+    0x22, 0x12, 0x74, 0x01, 0x39, 0x9E, 0x54, 0x65, 0x29, 0x2C, 0x7C, 0x25, 0x94, 0x20, 0x32, 0x52,
+    0x03, 0x22, 0x44, 0x00, 0x77, 0xC9, 0x14, 0x0E, 0xA7, 0x40, 0x20, 0x9D, 0xF2, 0x44, 0xD2, 0x45,
+    0x34, 0x53, 0xAA, 0x29, 0xAE, 0x7A, 0xC1, 0x3A, 0x1E, 0xA1, 0x28, 0x13, 0xEA, 0x74, 0x01, 0x51,
+    0x41, 0x24, 0xFA, 0x9D, 0x00, 0x84, 0x94, 0x3E, 0x51, 0xA9, 0xE6, 0xCA, 0xFF, 0x8E, 0x94, 0x94,
+    0xC8, 0x64, 0x25, 0x43, 0x49, 0xA4, 0x64, 0x00, 0x00, 0x2F, 0x4D, 0x2D, 0x24, 0x50, 0x47, 0xD4,
+    0xE8, 0x02, 0xCA, 0x82, 0xA2, 0x4F, 0xA9, 0xD0, 0x08, 0x26, 0x44, 0x9A, 0x4A, 0x6A, 0xA2, 0x95,
+    0x14, 0xD3, 0x56, 0x90, 0x92, 0x88, 0xC7, 0x42, 0x9D, 0x4C, 0xA9, 0x40, 0x0A, 0x51, 0x92, 0x95,
+    0x4A, 0x69, 0x52, 0xAA, 0x28, 0x2C, 0x9F, 0x53, 0xA0, 0x09, 0xC1, 0x68, 0x89, 0x3E, 0xA7, 0x40,
+    0x15, 0x1C, 0x1A, 0x88, 0x93, 0xEA, 0x74, 0x02, 0x0A, 0x91, 0x48, 0xF5, 0x29, 0xA6, 0x61, 0x35,
+    0x92, 0x21, 0xD0, 0x95, 0x2D, 0xF3, 0xA5, 0x6D, 0x8C, 0x8B, 0xD8, 0x42, 0x01, 0x43, 0x10, 0x02,
+    0xA8, 0x6D, 0x86, 0xD8, 0x9A, 0x0F, 0xD2, 0x09, 0x0B, 0xD8, 0xBD, 0x8D, 0xD3, 0x51, 0x22, 0x08,
+    0x68, 0x02, 0xA6, 0xE1, 0xA1, 0x23, 0x40, 0x12, 0xB0, 0x42, 0xD9, 0xB4, 0x47, 0xC1, 0x32, 0x68,
+    0xEA, 0x0B, 0x6C, 0xA4, 0x95, 0x22, 0xD3, 0x38, 0x82, 0x64, 0x25, 0xE4, 0xBE, 0xEB, 0x2D, 0x55,
+    0x17, 0xD5, 0x6F, 0xC2, 0x4D, 0x53, 0x4D, 0xA5, 0x71, 0x27, 0xAA, 0x98, 0x84, 0xA4, 0xD2, 0xB8,
+    0x9D, 0x69, 0xA6, 0xB7, 0x09, 0x49, 0xA5, 0x6D, 0x49, 0xD7, 0x55, 0x4D, 0x1D, 0x27, 0x12, 0x56,
+    0xF9, 0x57, 0x22, 0x85, 0x49, 0x54, 0x00, 0x00, 0x00, 0x00, 0x15, 0x22, 0x0E, 0x83, 0x40, 0x11,
+    0x22, 0x09, 0x34, 0x1A, 0x01, 0x04, 0xC2, 0x4B, 0xE1, 0xA6, 0x83, 0x40, 0x10, 0x5A, 0x6C, 0xB1,
+    0xD2, 0x81, 0x1D, 0x6E, 0x7D, 0x6C, 0x42, 0x8A, 0x80, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x04, 0x22,
+    0x68, 0x34, 0x01, 0x39, 0xAA, 0xD3, 0x86, 0x13, 0xA1, 0xD6, 0x02, 0x89, 0x34, 0x1A, 0x01, 0x2D,
+    0x61, 0x22, 0x12, 0xA5, 0xB5, 0xD3, 0xBE, 0x32, 0x00, 0x21, 0x20, 0x9C, 0x07, 0x40, 0x8C, 0x30,
+    0x02, 0x31, 0xCA, 0x00, 0x00, 0x00, 0x3A, 0x49, 0x87, 0x51, 0xA0, 0x08, 0xDC, 0xF3, 0xE0, 0x85,
+    0xB3, 0x68, 0xA9, 0x84, 0x15, 0x2D, 0xC0, 0x8D, 0xA8, 0xD0, 0x08, 0x49, 0x43, 0x67, 0x40, 0xA0,
+    0x25, 0xF6, 0x52, 0xDC, 0x33, 0x10, 0xB7, 0xC3, 0xE0, 0x00, 0x24, 0xEA, 0x34, 0x01, 0x39, 0x9E,
+    0x54, 0xA4, 0xAC, 0x47, 0x42, 0x9C, 0xFA, 0x56, 0xF9, 0x38, 0x9C, 0x5D, 0xC7, 0x13, 0x88, 0x00,
+    0x50, 0xAC, 0x22, 0x1C, 0x55, 0x17, 0x0D, 0x23, 0x40, 0x10, 0x5B, 0x2F, 0x75, 0x10, 0x25, 0xD0,
+    0x91, 0xA0, 0x10, 0x58, 0x8B, 0xC7, 0x32, 0x5F, 0x4D, 0x8A, 0x13, 0x10, 0xD9, 0xC3, 0xBC, 0x3B,
+    0xE8, 0xA5, 0x92, 0xA1, 0x04, 0xA7, 0x53, 0xA3, 0x3B, 0xE6, 0xC7, 0xB1, 0xC0, 0x00, 0x00, 0x00,
+    0xB1, 0xEC, 0x70, 0xA0, 0x00, 0x4B, 0x88, 0x84, 0x8D, 0x00, 0x86, 0x10, 0x96, 0x33, 0x02, 0xDD,
+    0x09, 0x1A, 0x01, 0x31, 0xE6, 0xD8, 0x44, 0x34, 0x25, 0x4D, 0x74, 0xE9, 0x69, 0x37, 0x12, 0x3D,
+    0x80, 0x3F, 0x00, 0x23, 0x06, 0xA2, 0x05, 0x94, 0x15, 0x68, 0x2A, 0xD0, 0xB9, 0x92, 0x57, 0xC1,
+    0xEC, 0x00, 0x00, 0x67, 0x3D, 0x80, 0x9C, 0x10, 0xA2, 0x14, 0xD2, 0xC6, 0x8B, 0x63, 0x63, 0x5C,
+    0x14, 0x0A, 0x02, 0x09, 0x9C, 0x97, 0x95, 0xEC, 0x04, 0xE0, 0x87, 0x09, 0x15, 0x0F, 0xAF, 0xF0,
+    0x00, 0x25, 0xB0, 0x0E, 0x5A, 0x93, 0x85, 0x7E, 0xA3, 0xD0, 0xAD, 0x7A, 0x4F, 0x85, 0x7C, 0xE4,
+    0x24, 0x49, 0x0E, 0x23, 0x53, 0x5A, 0x90, 0x07, 0x1C, 0x0F, 0x42, 0xB5, 0xE9, 0x3D, 0x17, 0x70,
+    0xD0, 0xF4, 0x2E, 0x4C, 0x27, 0xE4, 0x68, 0x70, 0x92, 0xE3, 0x81, 0x6A, 0x4C, 0xF2, 0x98, 0x75,
+    0x36, 0x8A, 0x87, 0xA1, 0x5A, 0xF4, 0x9E, 0x9B, 0xBC, 0x15, 0xB9, 0x37, 0xAA, 0x09, 0x9E, 0x96,
+    0x51, 0x80, 0x9C, 0x10, 0x4C, 0x57, 0xB2, 0x82, 0x04, 0xE0, 0x43, 0x82, 0x70, 0x44, 0x89, 0xC6,
+    0x97, 0x52, 0xC0, 0xF3, 0xFC, 0xFE, 0xFE, 0x70, 0x58, 0x11, 0x15, 0x32, 0x02, 0x80, 0x90, 0xF9,
+    0x6C, 0x23, 0x42, 0x5D, 0x3A, 0xCD, 0x7A, 0x00, 0x6F, 0x33, 0x84, 0x00, 0xCC, 0xCC, 0x80, 0x0B,
+    0x00, 0x2B, 0x66, 0x7F, 0xA8, 0x60, 0x00, 0x18, 0xE9, 0x90, 0x00, 0x44, 0x71, 0xB0, 0x12, 0x42,
+    0x88, 0x5F, 0x5F, 0xEE, 0x65, 0x8F, 0x93, 0x8D, 0x7B, 0xA6, 0x24, 0x5E, 0x12, 0xCA, 0xB5, 0xAE,
+    0x8A, 0xD8, 0xC0, 0x00, 0x53, 0x98, 0xA0, 0x8D, 0x00, 0x0A, 0x93, 0x00, 0x09, 0x6C, 0x60, 0x8A,
+    0x84, 0xA9, 0x6D, 0x7C, 0x25, 0x50, 0xBD, 0x02, 0x31, 0xAF, 0x60, 0x00, 0xBD, 0x28, 0xB0, 0xBD,
+    0x3F, 0xC0, 0x00, 0x05, 0x03, 0x81, 0x57, 0xB0, 0x27, 0x1C, 0x0A, 0x91, 0x06, 0x54, 0xB8, 0xE0,
+    0x82, 0x7A, 0xA5, 0x1A, 0x10, 0x14, 0xB8, 0xE0, 0x5A, 0x90, 0x39, 0x25, 0xC7, 0x04, 0x13, 0x3D,
+    0x2C, 0xA3, 0x34, 0xC7, 0x21, 0xA0, 0xA8, 0x7C, 0x94, 0xC6, 0x8D, 0x10, 0x5A, 0xAC, 0xA4, 0x3E,
+    0xAA, 0xC1, 0x6A, 0x4D, 0x54, 0x8B, 0xD0, 0xAD, 0x7A, 0x4F, 0x54, 0xBF, 0x09, 0x54, 0x4B, 0xC2,
+    0x9B, 0xED, 0xCA, 0xD7, 0xCF, 0x54, 0xDF, 0x11, 0x54, 0x2A, 0x1F, 0x2B, 0x5B, 0x29, 0xBC, 0x30,
+    0xA7, 0x2B, 0x5F, 0x30, 0xD0, 0x97, 0x1C, 0x11, 0x98, 0x51, 0xA1, 0x2B, 0x7C, 0x80, 0x72, 0x38,
+    0x80, 0xF2, 0x30, 0x22, 0x06, 0x29, 0x10, 0x5B, 0x21, 0xB9, 0x6A, 0x6D, 0x74, 0xE2, 0x12, 0xCA,
+    0xF9, 0x5D, 0x5B, 0xDF, 0xAE, 0xD4, 0xC5, 0x69, 0x50, 0x95, 0xBE, 0x57, 0xF8, 0xE8, 0x35, 0xF5,
+    0xAF, 0x2F, 0x7B, 0xAD, 0x30, 0x68, 0xED, 0x81, 0x50, 0x95, 0xB1, 0xF2, 0xF3, 0xBD, 0xD6, 0x42,
+    0x02, 0x05, 0x90, 0x4C, 0x80, 0x8E, 0xE3, 0x68, 0xC0, 0xDE, 0xE3, 0x82, 0x0B, 0x0E, 0xCB, 0x3E,
+    0xDB, 0x6A, 0x88, 0x28, 0x1B, 0x24, 0x96, 0xA6, 0xDB, 0x66, 0x88, 0x46, 0x62, 0xDE, 0xCB, 0x29,
+    0xCD, 0x33, 0x04, 0xE0, 0x8C, 0x7B, 0x8E, 0x08, 0x8C, 0x39, 0x50, 0xF9, 0x5A, 0x4D, 0xCE, 0x5B,
+    0x1D, 0xBE, 0x86, 0xF4, 0xB8, 0xE0, 0xA4, 0xD2, 0x08, 0x65, 0x31, 0xD0, 0x95, 0x2D, 0x8E, 0x7C,
+    0x25, 0x4A, 0xDF, 0x22, 0x47, 0x06, 0x91, 0x6D, 0x40, 0xF8, 0x14, 0x95, 0x62, 0x86, 0x74, 0x53,
+    0xC8, 0xFA, 0x0F, 0xE8, 0x52, 0x4E, 0x62, 0x04, 0x41, 0xC8, 0x8B, 0x88, 0x95, 0x20, 0x28, 0x0A,
+    0x4A, 0x94, 0x41, 0xA5, 0xC7, 0x02, 0x0B, 0x64, 0x4C, 0x41, 0x53, 0xCF, 0x14, 0x21, 0xF4, 0x49,
+    0x41, 0x34, 0xAA, 0xF2, 0xD4, 0x9A, 0x6B, 0x08, 0x4D, 0x90, 0xEF, 0x04, 0xF5, 0x5A, 0x84, 0x30,
+    0x4B, 0x4B, 0x8E, 0x05, 0xA9, 0x84, 0x1A, 0xD2, 0xE3, 0x82, 0x0B, 0x11, 0x49, 0x94, 0x7A, 0x15,
+    0xAF, 0x49, 0xEA, 0x9C, 0x61, 0x30, 0x67, 0x7E, 0x5E, 0x40, 0xFA, 0xD4, 0xC1, 0xAD, 0x2E, 0x38,
+    0x21, 0x28, 0xE3, 0x7F, 0x49, 0x1C, 0x27, 0x35, 0xC4, 0x58, 0x4C, 0x2A, 0x29, 0xDE, 0x31, 0x0A,
+    0x20, 0x8A, 0x97, 0x1C, 0x10, 0x98, 0x34, 0x53, 0xA6, 0xA0, 0xBB, 0x55, 0xDD, 0x0D, 0x65, 0x44,
+    0xAA, 0x0C, 0xAB, 0xAD, 0x93, 0x66, 0xBE, 0x61, 0x21, 0x2E, 0x38, 0x1C, 0xAD, 0x7C, 0xC4, 0xA2,
+    0x12, 0xE3, 0x82, 0x32, 0x0A, 0x64, 0xAA, 0x95, 0xC8, 0x02, 0xFA, 0xF8, 0x01, 0x6A, 0xFA, 0xD4,
+    0x82, 0x49, 0x2E, 0x38, 0x13, 0x82, 0x12, 0xB2, 0x4B, 0x8E, 0x08, 0x27, 0x25, 0x52, 0x09, 0x59,
+    0x25, 0xC7, 0x02, 0x13, 0x4D, 0x56, 0x2B, 0x0A, 0x44, 0x2D, 0xF2, 0x01, 0xCC, 0x5C, 0x04, 0x4B,
+    0x55, 0x06, 0xA4, 0x16, 0xCA, 0xE3, 0x4E, 0x05, 0x24, 0xB8, 0xE0, 0x61, 0xD4, 0xDB, 0x2A, 0x56,
+    0x0A, 0xAA, 0x4B, 0x4D, 0x09, 0xB2, 0x96, 0x64, 0x30, 0x82, 0x3A, 0x1D, 0x2A, 0xDA, 0xE0, 0xE6,
+    0x05, 0x18, 0x59, 0x85, 0x80, 0x89, 0x4D, 0x18, 0x58, 0x00, 0x08, 0x21, 0x0A, 0x97, 0x1C, 0x09,
+    0xCD, 0x97, 0xD1, 0x05, 0x42, 0xAD, 0xCF, 0xA2, 0x5A, 0x19, 0xCE, 0x87, 0x58, 0x02, 0x40, 0x02,
+    0x88, 0xA9, 0x71, 0xC0, 0x9C, 0xCF, 0x16, 0x63, 0x44, 0x53, 0x1D, 0x09, 0x5B, 0x1F, 0x09, 0x52,
+    0xDC, 0xF5, 0x00, 0x00, 0x19, 0x00, 0x98, 0x02, 0x4E, 0x9C, 0xC2, 0x7F, 0x09, 0x40, 0x24, 0xC3,
+    0xF0, 0x00, 0x00, 0x00, 0x21, 0xDE, 0x97, 0x1C, 0x08, 0x71, 0x1E, 0x97, 0x1C, 0x09, 0xCD, 0x13,
+    0x91, 0x0E, 0x23, 0x22, 0x96, 0x48, 0x91, 0x20, 0x01, 0x4E, 0xF4, 0xB8, 0xE0, 0x4E, 0x67, 0x8B,
+    0x25, 0xB5, 0x19, 0x10, 0xB7, 0xCA, 0x76, 0xC0, 0x1C, 0xEE, 0xD5, 0x7B, 0xED, 0xD3, 0x5A, 0xDE,
+    0xDD, 0x77, 0x6A, 0xBB, 0x55, 0xDA, 0xA0, 0x9C, 0xC3, 0x48, 0x18, 0xD6, 0x97, 0x1C, 0x08, 0x61,
+    0x6A, 0x35, 0xA5, 0xC7, 0x04, 0x44, 0x19, 0x2A, 0xAE, 0x62, 0x62, 0x4A, 0x62, 0x44, 0xA8, 0xD6,
+    0x97, 0x1C, 0x09, 0xC1, 0x4D, 0x51, 0xAD, 0x2E, 0x38, 0x23, 0xA8, 0x45, 0x3A, 0x9D, 0x2A, 0x64,
+    0x40, 0x32, 0xC0, 0x00, 0x00, 0x00, 0x4E, 0x0C, 0xB7, 0xA1, 0x5A, 0xF4, 0x98, 0x88, 0x4B, 0x8E,
+    0x08, 0x27, 0x6D, 0x19, 0x2B, 0xE6, 0x1D, 0x10, 0x97, 0x1C, 0x0C, 0xD7, 0xCC, 0x52, 0xD1, 0x09,
+    0x71, 0xC1, 0x04, 0xE5, 0xA2, 0x76, 0x6B, 0xE7, 0xB6, 0xE3, 0xEE, 0x56, 0xBE, 0x7A, 0xAE, 0x98,
+    0xCA, 0x39, 0x0A, 0xD9, 0x5F, 0x37, 0x61, 0x8E, 0x1E, 0x5D, 0x97, 0x60, 0x00, 0xE5, 0x6B, 0xE6,
+    0x2D, 0x10, 0x97, 0x1C, 0x10, 0x4E, 0xF2, 0xB2, 0x49, 0x88, 0x5A, 0x21, 0x2E, 0x38, 0x15, 0xF3,
+    0x19, 0xA5, 0xA2, 0x12, 0xE3, 0x82, 0x22, 0x5E, 0xA5, 0xB5, 0xD7, 0xBB, 0xDB, 0xD5, 0x0F, 0x04,
+    0xF3, 0x6A, 0xE1, 0x5A, 0x5A, 0x21, 0x2E, 0x38, 0x12, 0x63, 0xBD, 0xA5, 0xA2, 0x12, 0xE3, 0x82,
+    0x09, 0xDA, 0xF6, 0xEA, 0xF9, 0x8C, 0x5A, 0x21, 0x2E, 0x38, 0x12, 0x7A, 0xA9, 0x48, 0x89, 0x9A,
+    0x58, 0xF8, 0x43, 0x61, 0xA3, 0x38, 0x68, 0xCF, 0x69, 0x68, 0x84, 0xB8, 0xE0, 0x4E, 0x0F, 0x37,
+    0xB4, 0xB4, 0x42, 0x5C, 0x70, 0x53, 0x71, 0x42, 0x21, 0x90, 0xE8, 0x4A, 0xD8, 0xE7, 0xC6, 0x74,
+    0xAD, 0xAF, 0x9D, 0x31, 0x14, 0x6F, 0x50, 0x61, 0x00, 0x30, 0x81, 0x36, 0x1F, 0xC8, 0x23, 0x02,
+    0x2F, 0x90, 0x76, 0x1D, 0x00, 0x05, 0x01, 0x05, 0x04, 0x14, 0x0C, 0x78, 0x51, 0x20, 0x4D, 0x84,
+    0x14, 0x28, 0xA0, 0x41, 0x4C, 0x94, 0x5C, 0x16, 0x14, 0x08, 0xC8, 0x21, 0x2A, 0x49, 0x70, 0x58,
+    0x05, 0xAB, 0xE0, 0x84, 0x77, 0x02, 0xC2, 0x02, 0x09, 0xC2, 0x96, 0x0E, 0x27, 0xCA, 0x1C, 0x68,
+    0x6C, 0x2F, 0x39, 0xBE, 0x1C, 0x68, 0x66, 0x30, 0x4F, 0x31, 0x28, 0x69, 0xBE, 0x00, 0x09, 0x80,
+    0x79, 0xCD, 0xF0, 0x09, 0x22, 0x60, 0x20, 0x9F, 0x2E, 0x46, 0xCE, 0x4D, 0x81, 0x60, 0x1C, 0xAD,
+    0x0C, 0x98, 0x61, 0x98, 0x0F, 0x04, 0x13, 0xD4, 0x6A, 0x1A, 0x83, 0x08, 0x21, 0x60, 0x1D, 0x2E,
+    0x0A, 0x18, 0x65, 0x6E, 0x8B, 0x18, 0x4A, 0xA0, 0x72, 0x11, 0xDE, 0x8A, 0x30, 0x80, 0x16, 0x01,
+    0xA8, 0x30, 0x85, 0x50, 0xB0, 0x10, 0x4E, 0x90, 0xB6, 0x77, 0x05, 0x03, 0x52, 0xB7, 0x4D, 0xAD,
+    0xD2, 0xE0, 0xA1, 0x86, 0x56, 0x84, 0x30, 0xB0, 0x10, 0x97, 0x90, 0xA6, 0x73, 0xD1, 0x75, 0x4D,
+    0x82, 0x76, 0x58, 0x08, 0x6B, 0x70, 0x53, 0x98, 0xFD, 0x2B, 0xAB, 0x92, 0xA6, 0xDC, 0x2D, 0x72,
+    0x61, 0xC5, 0x23, 0x63, 0xC0, 0x04, 0x7F, 0xB7, 0xFA, 0x25, 0xC2, 0xD2, 0x60, 0xB1, 0x80, 0x83,
+    0x14, 0xD6, 0x8A, 0x1F, 0xC6, 0x89, 0x9F, 0x1D, 0x34, 0x12, 0x12, 0xA6, 0xBA, 0xA5, 0x52, 0xA8,
+    0xA0, 0xAA, 0x55, 0x55, 0x00, 0x19, 0xC9, 0xB0, 0x59, 0x60, 0x15, 0xD6, 0x0D, 0x2E, 0xCB, 0x01,
+    0x04, 0xC9, 0x73, 0x69, 0x6D, 0x77, 0x31, 0x53, 0x6D, 0x36, 0x99, 0x09, 0x12, 0x12, 0xA5, 0xB5,
+    0xF5, 0xB0, 0x01, 0x1A, 0x00, 0x2A, 0x80, 0x0A, 0xA5, 0x51, 0x42, 0xA6, 0xC1, 0xBB, 0x2C, 0x02,
+    0x24, 0x4B, 0x25, 0xD9, 0x60, 0x20, 0xA9, 0x36, 0xA5, 0x92, 0xDA, 0x20, 0x63, 0xA5, 0x62, 0x19,
+    0x8E, 0xFA, 0xD8, 0x50, 0x28, 0x98, 0xCC, 0x40, 0x00, 0x02, 0x12, 0x58, 0x44, 0xBB, 0x2C, 0x02,
+    0x73, 0x55, 0xDF, 0x0C, 0x22, 0x19, 0x8E, 0x05, 0xB2, 0x5D, 0x96, 0x02, 0x42, 0x88, 0x54, 0xAD,
+    0xF2, 0xA5, 0x6E, 0x88, 0x3F, 0xE6, 0x00, 0xA0, 0x00, 0x04, 0x63, 0xF8, 0x00, 0xA5, 0xB8, 0x4C,
+    0x60, 0x15, 0x33, 0x0E, 0x89, 0x63, 0x01, 0x04, 0x25, 0x49, 0x2F, 0xA2, 0x3D, 0x13, 0x05, 0x34,
+    0xBD, 0x9D, 0x27, 0xA6, 0x9D, 0x09, 0x34, 0x2A, 0x6F, 0x57, 0xA4, 0x98, 0x49, 0x63, 0x01, 0x19,
+    0x41, 0x21, 0x63, 0x29, 0xDC, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x08, 0xD2, 0xE1, 0x95, 0x8C,
+    0x04, 0x24, 0x44, 0xB7, 0x1F, 0xBB, 0x12, 0xE5, 0x63, 0x00, 0x9C, 0xCF, 0x2A, 0x5A, 0x82, 0x53,
+    0xAD, 0xF1, 0x94, 0xE9, 0x5B, 0xE4, 0x23, 0x2E, 0x03, 0xF0, 0xFC, 0x00, 0x2E, 0x07, 0x55, 0x14,
+    0x3F, 0x3A, 0x0B, 0x84, 0xB8, 0x69, 0x63, 0x00, 0xB7, 0xE6, 0x79, 0x50, 0x51, 0x4B, 0xD6, 0x24,
+    0xF4, 0x4A, 0x41, 0x4D, 0x2F, 0x75, 0x12, 0x74, 0x4B, 0x18, 0x08, 0x28, 0x9D, 0x21, 0xF5, 0xC9,
+    0x48, 0x46, 0x88, 0x4A, 0xFB, 0xE2, 0x5D, 0x2C, 0x60, 0x13, 0x99, 0xE5, 0x47, 0x51, 0xC8, 0x59,
+    0x4E, 0xF8, 0xCD, 0xAA, 0x14, 0x00, 0x02, 0x15, 0xAA, 0x14, 0x00, 0x09, 0x31, 0x28, 0x96, 0x30,
+    0x09, 0xCD, 0x54, 0x9C, 0x33, 0xDC, 0x85, 0xC2, 0x44, 0x80, 0x05, 0x9D, 0x12, 0xC6, 0x01, 0x39,
+    0x9E, 0x2C, 0xD6, 0x08, 0x27, 0x42, 0x56, 0xE7, 0xC6, 0x75, 0xB5, 0xF4, 0xAC, 0xE0, 0xEE, 0x0E,
+    0xE4, 0x20, 0x1C, 0xE0, 0xEE, 0x1C, 0xE2, 0x58, 0x2F, 0x01, 0xCE, 0x0E, 0xE2, 0x58, 0x25, 0x90,
+    0x4E, 0xF0, 0xA8, 0x59, 0x40, 0x10, 0x89, 0x80, 0x67, 0xCA, 0x01, 0x88, 0x22, 0x60, 0x20, 0x9C,
+    0x29, 0x5A, 0xE2, 0x7C, 0xA0, 0x10, 0x98, 0x07, 0x9C, 0xDF, 0x0C, 0xF1, 0x60, 0xA2, 0x69, 0xBC,
+    0x69, 0xBE, 0x1B, 0x62, 0xE3, 0x05, 0x22, 0x0D, 0x25, 0x9F, 0x28, 0x04, 0x11, 0x30, 0x10, 0xD5,
+    0x30, 0x89, 0x36, 0xF7, 0x2A, 0x14, 0x2B, 0xE0, 0x0A, 0x44, 0xC0, 0x34, 0xDF, 0x00, 0xE6, 0x91,
+    0x30, 0x12, 0x12, 0xB0, 0x90, 0xAF, 0x9D, 0x6F, 0x81, 0x90, 0xC8, 0x64, 0x00, 0x47, 0x00, 0x06,
+    0x43, 0x27, 0x9C, 0xDF, 0x00, 0xD2, 0x26, 0x01, 0x27, 0x04, 0xCF, 0x9B, 0x49, 0x0D, 0x57, 0x7A,
+    0xBE, 0x1A, 0x22, 0xA3, 0x25, 0xE1, 0x21, 0x67, 0x7C, 0x1B, 0x4D, 0xA6, 0xD7, 0x21, 0xB4, 0xDB,
+    0x04, 0xD0, 0x9B, 0xE1, 0x4D, 0x22, 0x60, 0x12, 0x02, 0xBE, 0x73, 0x48, 0x98, 0x08, 0x27, 0x7C,
+    0xD6, 0xA4, 0x04, 0x9C, 0xD2, 0x26, 0x01, 0x5F, 0x01, 0x26, 0x91, 0x30, 0x11, 0xD1, 0x00, 0x90,
+    0xA9, 0x65, 0xF0, 0x52, 0x52, 0x52, 0xB6, 0xB6, 0x52, 0x52, 0x23, 0xE7, 0x34, 0x89, 0x80, 0x57,
+    0xC0, 0x59, 0xCD, 0x22, 0x60, 0x20, 0xA9, 0xF0, 0x9E, 0x52, 0x1A, 0x29, 0x24, 0xAA, 0x22, 0x3A,
+    0x1C, 0xF9, 0xDA, 0xFA, 0x42, 0x43, 0x20, 0xC8, 0x32, 0x24, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1C,
+    0x4F, 0x94, 0x03, 0x08, 0x98, 0x08, 0x27, 0x13, 0xD1, 0x33, 0xE5, 0x0D, 0x14, 0xEB, 0x28, 0x6C,
+    0x9C, 0x78, 0x27, 0x90, 0x94, 0x24, 0x02, 0x10, 0x44, 0xC0, 0x2C, 0xA0, 0x23, 0xC4, 0x11, 0x30,
+    0x12, 0x12, 0x74, 0x25, 0x8E, 0x7C, 0x25, 0x60, 0x02, 0x95, 0x4A, 0x00, 0x7C, 0xA9, 0x46, 0x40,
+    0x06, 0x7C, 0xA0, 0x20, 0x82, 0x26, 0x02, 0x09, 0xE0, 0xF4, 0x81, 0xBC, 0x41, 0x13, 0x00, 0x90,
+    0x16, 0x4F, 0x10, 0x44, 0xC0, 0x41, 0x33, 0xE4, 0xF2, 0xCA, 0x1A, 0x66, 0x89, 0x0D, 0x53, 0x14,
+    0x64, 0xC0, 0xA6, 0x4B, 0x25, 0x44, 0x92, 0x48, 0x52, 0x29, 0x2D, 0xA4, 0x84, 0x93, 0xC4, 0x11,
+    0x30, 0x0B, 0x28, 0x0A, 0xF1, 0x04, 0x4C, 0x02, 0x70, 0x58, 0x49, 0xE2, 0x08, 0x98, 0x08, 0x2A,
+    0x94, 0x26, 0xC4, 0x86, 0x9B, 0x64, 0xD6, 0x08, 0x64, 0x4A, 0xA3, 0x3A, 0x56, 0xD7, 0xC6, 0x74,
+    0xA9, 0x62, 0xC0, 0x3F, 0x00, 0x58, 0x20, 0xC3, 0x72, 0x12, 0x85, 0x6C, 0x2C, 0x02, 0x0C, 0x2C,
+    0x00, 0x58, 0x20, 0xCE, 0x27, 0xCA, 0x1B, 0x6D, 0x25, 0x04, 0xF4, 0xAA, 0x35, 0x18, 0x77, 0x52,
+    0x14, 0xD4, 0x18, 0x42, 0x0B, 0x01, 0x04, 0xE3, 0xAA, 0x85, 0x0F, 0x01, 0xA8, 0x58, 0x05, 0x18,
+    0x43, 0xA5, 0x42, 0xC0, 0x41, 0x48, 0xEB, 0x47, 0x74, 0xB8, 0x28, 0x61, 0x95, 0xBA, 0x63, 0xF0,
+    0x50, 0x91, 0xD3, 0xBB, 0x82, 0x81, 0xA9, 0x5B, 0xBA, 0x85, 0x58, 0x4A, 0x1A, 0x6B, 0xCB, 0x50,
+    0x9A, 0x65, 0xB0, 0xD4, 0xE1, 0xD2, 0xA1, 0xDC, 0x27, 0x1B, 0x38, 0x50, 0x32, 0xA3, 0x41, 0x18,
+    0x58, 0x07, 0x70, 0x50, 0x35, 0x2B, 0x43, 0x48, 0xC2, 0xC0, 0x46, 0x4A, 0x46, 0x75, 0x4A, 0x99,
+    0x40, 0x8B, 0x40, 0x02, 0xD7, 0x98, 0xB5, 0xA8, 0x30, 0x87, 0x50, 0xB0, 0x10, 0x4C, 0x3A, 0x36,
+    0x81, 0xD7, 0x5A, 0x14, 0x61, 0xD1, 0x25, 0x04, 0xE1, 0xA2, 0x84, 0xE0, 0x54, 0xA8, 0x58, 0x04,
+    0x08, 0x83, 0xA5, 0x42, 0xC0, 0x48, 0x48, 0x46, 0x43, 0xCA, 0x76, 0xC6, 0x4A, 0x28, 0x31, 0x20,
+    0x91, 0x06, 0x83, 0x41, 0x89, 0x03, 0x1D, 0x2A, 0x16, 0x01, 0x46, 0x11, 0x29, 0x50, 0xB0, 0x09,
+    0xC1, 0x02, 0x3A, 0x54, 0x2C, 0x04, 0x15, 0x0C, 0x35, 0xC2, 0x07, 0x4D, 0xDA, 0x42, 0x88, 0x95,
+    0xB9, 0xF3, 0xAD, 0xB0, 0xB3, 0x1B, 0xC2, 0x29, 0xBC, 0x00, 0x1B, 0xC0, 0x00, 0x00, 0xE9, 0x70,
+    0x50, 0xC3, 0x2B, 0x43, 0x18, 0x58, 0x08, 0x27, 0x0A, 0x5B, 0xBA, 0x06, 0x56, 0x84, 0x91, 0x85,
+    0x80, 0x70, 0xA0, 0x65, 0x46, 0x88, 0xE4, 0x8C, 0x2C, 0x04, 0x13, 0xA5, 0xCD, 0xDD, 0xC1, 0x40,
+    0xD4, 0xAD, 0xD5, 0x7C, 0xB8, 0x50, 0x32, 0xA3, 0x76, 0x5A, 0xEC, 0x85, 0x2C, 0x22, 0x42, 0x9A,
+    0xE7, 0xD4, 0x45, 0x36, 0x8D, 0xA3, 0x68, 0xDA, 0x54, 0xC0, 0x00, 0x01, 0xDC, 0x14, 0x0D, 0x4A,
+    0xD1, 0x12, 0x30, 0xB0, 0x10, 0x4E, 0x87, 0x37, 0x61, 0x95, 0xA1, 0xB9, 0x23, 0x0B, 0x00, 0xE8,
+    0x19, 0x5A, 0x28, 0x5C, 0x91, 0x85, 0x80, 0x82, 0x70, 0xB9, 0x53, 0xA0, 0x65, 0x6E, 0xBB, 0x54,
+    0xE1, 0x40, 0xCA, 0x8D, 0xD5, 0x69, 0xC8, 0x50, 0x82, 0x85, 0x36, 0x33, 0xBE, 0x97, 0xE2, 0xB4,
+    0x00, 0x00, 0x04, 0x51, 0x14, 0x45, 0x11, 0x5C, 0x28, 0x19, 0x51, 0xA2, 0xB9, 0x23, 0x0B, 0x01,
+    0x04, 0xE1, 0x42, 0x77, 0x40, 0xCA, 0xDD, 0x13, 0x0C, 0x32, 0xB7, 0x54, 0x51, 0x04, 0xE3, 0x0B,
+    0x75, 0x2B, 0x44, 0x0B, 0x92, 0x30, 0xB0, 0x10, 0x4E, 0x81, 0xA4, 0x61, 0x95, 0xBA, 0xAD, 0xF5,
+    0x2B, 0x46, 0x40, 0x5C, 0x91, 0x85, 0x80, 0x94, 0xA8, 0x88, 0x67, 0x42, 0x9D, 0x3B, 0xE7, 0x42,
+    0x09, 0x06, 0x20, 0xA3, 0x02, 0x08, 0x82, 0x00, 0x00, 0x02, 0x08, 0x00, 0xE8, 0x19, 0x5A, 0x30,
+    0x5C, 0x91, 0x85, 0x80, 0x82, 0xA4, 0x0E, 0xBC, 0x61, 0x95, 0xBA, 0x25, 0x60, 0x9C, 0xA8, 0x6E,
+    0x8D, 0x15, 0x01, 0x72, 0x46, 0x16, 0x01, 0x4A, 0xD1, 0xC6, 0x80, 0xB9, 0x23, 0x0B, 0x01, 0x29,
+    0x42, 0x19, 0x0A, 0x75, 0x3A, 0x76, 0xC6, 0x52, 0x63, 0x48, 0x41, 0x00, 0x00, 0x00, 0x00, 0xD2,
+    0x34, 0x8D, 0x20, 0x01, 0x86, 0x56, 0x8E, 0x80, 0xB9, 0x23, 0x0B, 0x01, 0x04, 0xED, 0x1B, 0x31,
+    0x86, 0x80, 0xB9, 0x23, 0x0B, 0x00, 0x8D, 0x20, 0xA3, 0x40, 0x5C, 0x91, 0x85, 0x80, 0x82, 0x61,
+    0x95, 0xE5, 0x2B, 0x74, 0xC1, 0xD1, 0xBA, 0xA0, 0x08, 0xE9, 0x69, 0x0B, 0x29, 0xDA, 0xF8, 0x5F,
+    0x9E, 0x57, 0xE3, 0x81, 0xC2, 0xFC, 0x70, 0x39, 0x46, 0x80, 0xB9, 0x23, 0x0B, 0x00, 0xA5, 0x69,
+    0x03, 0x40, 0x5C, 0x91, 0x85, 0x80, 0x4E, 0x10, 0xD2, 0x8D, 0x01, 0x72, 0x46, 0x16, 0x02, 0x0A,
+    0x8A, 0xD8, 0x89, 0x1B, 0xA6, 0x9D, 0x52, 0x33, 0xD8, 0x44, 0x42, 0x98, 0xE8, 0x4A, 0xD8, 0xE7,
+    0xCA, 0x95, 0xB5, 0xF1, 0x90, 0x51, 0xE8, 0x11, 0xD8, 0x00, 0xE2, 0x06, 0x83, 0x0F, 0x8E, 0x00,
+    0x6C, 0x02, 0x29, 0x60, 0x20, 0x20, 0xAF, 0xB8, 0x03, 0x7A, 0x42, 0x7A, 0x02, 0x90, 0x00, 0x1B,
+    0x02, 0x10, 0x40, 0xAE, 0x80, 0x36, 0x80, 0x03, 0x88, 0x0F, 0x30, 0x02, 0x92, 0x0D, 0x44, 0x7C,
+    0xB0, 0x2E, 0x40, 0x80, 0x99, 0x81, 0xE7, 0x96, 0x05, 0x5C, 0x10, 0x53, 0x30, 0x41, 0x39, 0xDC,
+    0xA1, 0xDC, 0x94, 0x50, 0x19, 0x81, 0x92, 0x8A, 0x02, 0x79, 0x82, 0x09, 0x93, 0x37, 0x95, 0x14,
+    0x06, 0x60, 0x7C, 0xB0, 0x2E, 0x40, 0xE9, 0x89, 0xC2, 0x46, 0xCA, 0x91, 0xE8, 0x65, 0xA2, 0x41,
+    0x98, 0x15, 0xE4, 0x06, 0x60, 0x84, 0xA0, 0x9D, 0xD5, 0x7D, 0xAE, 0xA5, 0xC8, 0x32, 0x98, 0x21,
+    0xA8, 0x27, 0x76, 0x64, 0xE9, 0xD8, 0x28, 0x6B, 0xB0, 0x20, 0xE6, 0x60, 0x70, 0xDD, 0x81, 0x06,
+    0x60, 0x84, 0x83, 0x95, 0xED, 0x05, 0xAC, 0x94, 0x50, 0x27, 0x1E, 0x60, 0x74, 0x40, 0x81, 0x52,
+    0xA0, 0x02, 0xCC, 0x0E, 0xF4, 0x40, 0x8C, 0x12, 0xA0, 0x27, 0x16, 0x60, 0x86, 0xB4, 0x86, 0x79,
+    0xD2, 0xF5, 0xBF, 0x5F, 0xB2, 0x29, 0xC0, 0x66, 0x08, 0x8B, 0x7E, 0xCA, 0x97, 0x55, 0x7A, 0xEB,
+    0x37, 0x40, 0xCA, 0xB9, 0x60, 0x01, 0xDE, 0x88, 0x11, 0x82, 0x54, 0x02, 0x59, 0x82, 0x22, 0xEF,
+    0xB2, 0xCB, 0x32, 0xB6, 0x65, 0x85, 0x00, 0x46, 0xAC, 0x08, 0x19, 0x98, 0x1A, 0xEC, 0x08, 0x41,
+    0xCC, 0xC1, 0x04, 0xC1, 0x2B, 0xCA, 0x5C, 0x83, 0x30, 0x26, 0x42, 0x0C, 0xA6, 0x08, 0xAC, 0x96,
+    0xC2, 0x77, 0x64, 0x08, 0xC1, 0x42, 0xAD, 0x2B, 0x73, 0x23, 0x95, 0x26, 0x06, 0x74, 0x03, 0x05,
+    0x14, 0x0A, 0x9B, 0x98, 0x20, 0x98, 0xB7, 0x71, 0x33, 0xB2, 0xE2, 0xD5, 0x81, 0xD9, 0x7A, 0x11,
+    0x59, 0x2D, 0x95, 0x2C, 0x75, 0x45, 0x81, 0x18, 0x31, 0x85, 0x18, 0x71, 0xB0, 0x4B, 0x90, 0x66,
+    0x08, 0x31, 0x7C, 0xE3, 0x6F, 0x08, 0x40, 0x66, 0x08, 0x31, 0x40, 0x64, 0xB2, 0xC9, 0x40, 0x66,
+    0x08, 0x31, 0xAC, 0xA2, 0xCF, 0x6A, 0xF1, 0x80, 0x08, 0x51, 0x7A, 0x6B, 0x16, 0xAD, 0x8D, 0x6C,
+    0x3A, 0x20, 0x40, 0xA9, 0x51, 0xAE, 0x10, 0x46, 0x64, 0x42, 0x57, 0x4E, 0xFA, 0x0F, 0x80, 0x64,
+    0xB7, 0xE0, 0x20, 0x00, 0x00, 0x00, 0x52, 0xE7, 0x5C, 0x82, 0x82, 0xB0, 0x96, 0x2C, 0x29, 0x72,
+    0x14, 0xA6, 0x08, 0x4B, 0x0B, 0x9E, 0x0A, 0x2F, 0x32, 0x64, 0x32, 0x86, 0x53, 0x03, 0xBD, 0x10,
+    0x23, 0x04, 0xA8, 0x06, 0x60, 0x88, 0x92, 0x92, 0x57, 0xCD, 0x52, 0xA9, 0x54, 0x16, 0xA5, 0x44,
+    0xC9, 0x43, 0x29, 0x81, 0x0B, 0x9E, 0x2C, 0x44, 0x9C, 0x32, 0xA6, 0x4B, 0x60, 0x06, 0x40, 0x02,
+    0x09, 0xA8, 0x17, 0x91, 0x21, 0x6E, 0x60, 0x54, 0x53, 0x65, 0x97, 0xC1, 0x3A, 0x28, 0x8D, 0x28,
+    0x0D, 0x37, 0x30, 0x2A, 0x28, 0x18, 0x69, 0xB9, 0x82, 0x62, 0x4E, 0x14, 0x25, 0x6F, 0x8C, 0xA7,
+    0x5B, 0xE7, 0x4C, 0x72, 0xF8, 0x8C, 0x00, 0x00, 0x8D, 0x00, 0x23, 0x40, 0x08, 0xD0, 0x02, 0x34,
+    0x89, 0x0E, 0x9B, 0x98, 0x21, 0x05, 0x6F, 0xA8, 0x22, 0x69, 0xB9, 0x82, 0x09, 0xA8, 0x17, 0xC2,
+    0x0D, 0x37, 0x30, 0x25, 0x04, 0x40, 0x69, 0xB9, 0x82, 0x2A, 0x28, 0x23, 0xA9, 0xD9, 0x81, 0x81,
+    0x81, 0x81, 0x81, 0x0D, 0x01, 0xA6, 0xE6, 0x08, 0xED, 0x40, 0x63, 0x3A, 0x56, 0xFA, 0x09, 0xF0,
+    0x0B, 0x6E, 0x2E, 0x00, 0x00, 0x00, 0x02, 0x38, 0x05, 0xAE, 0x1B, 0xB0, 0x21, 0x66, 0x60, 0x82,
+    0x70, 0xDD, 0x13, 0x5D, 0x81, 0xD1, 0x58, 0xAC, 0x0E, 0xDB, 0x4E, 0x42, 0x43, 0x03, 0x72, 0x3B,
+    0x34, 0x08, 0x21, 0xCC, 0xC1, 0x04, 0xD7, 0x63, 0xCA, 0xC0, 0xE9, 0x81, 0x20, 0x43, 0xB8, 0x73,
+    0x30, 0x46, 0x4E, 0x82, 0x56, 0x46, 0x77, 0x9C, 0x97, 0xC5, 0xA5, 0xF2, 0xFA, 0x75, 0xAE, 0xC0,
+    0x86, 0x1C, 0xCC, 0x0B, 0x70, 0x88, 0xCB, 0x87, 0x33, 0x04, 0x15, 0x5D, 0x97, 0xA2, 0xB0, 0x3A,
+    0x6E, 0xD1, 0xD2, 0x12, 0xAD, 0x8F, 0x8C, 0xEE, 0x2D, 0x46, 0x16, 0x91, 0x82, 0xD1, 0x6D, 0xBD,
+    0x38, 0x1B, 0x2E, 0x1C, 0xCC, 0x0A, 0xC0, 0x89, 0x70, 0xE6, 0x60, 0x4E, 0x08, 0x16, 0x5C, 0x39,
+    0x98, 0x20, 0xA9, 0x81, 0x9F, 0xD0, 0x3A, 0x6E, 0xD2, 0x1A, 0x61, 0x21, 0x2A, 0x6B, 0xA9, 0x60,
+    0x16, 0x80, 0xB4, 0x11, 0xD0, 0xCF, 0x01, 0x68, 0x3E, 0xC0, 0x00, 0x00, 0x07, 0x72, 0x51, 0x40,
+    0x8F, 0x30, 0x41, 0x3A, 0x5C, 0x89, 0x51, 0x4D, 0xB0, 0x76, 0x64, 0xA2, 0x9A, 0x22, 0xA0, 0x9D,
+    0x0E, 0x46, 0x94, 0x05, 0xC7, 0x98, 0x15, 0x14, 0x0D, 0x2E, 0x3C, 0xC1, 0x1D, 0x42, 0x42, 0x54,
+    0xB6, 0xBE, 0xA5, 0xDA, 0xA0, 0x00, 0x6B, 0x20, 0x00, 0xFE, 0x16, 0xB2, 0x51, 0x40, 0xDC, 0x79,
+    0x82, 0x09, 0x90, 0x96, 0x52, 0x9A, 0x60, 0xAA, 0x8A, 0x68, 0x94, 0x82, 0x74, 0x26, 0x32, 0xD3,
+    0x9A, 0xAA, 0xC8, 0x26, 0xA2, 0x5F, 0x09, 0x2E, 0x3C, 0xC1, 0x04, 0xC8, 0xA3, 0x49, 0x4D, 0x57,
+    0x38, 0x88, 0x4B, 0x8F, 0x30, 0x48, 0x4A, 0xC4, 0x74, 0x29, 0xD4, 0xAE, 0x51, 0x88, 0xC2, 0xD2,
+    0x31, 0x18, 0x2D, 0x00, 0x23, 0x15, 0x14, 0x11, 0x2E, 0x3C, 0xC0, 0x9C, 0x0D, 0x09, 0x71, 0xE6,
+    0x04, 0xE0, 0x94, 0x42, 0x5C, 0x79, 0x82, 0x0A, 0x91, 0x4A, 0xBD, 0x29, 0xA6, 0x93, 0x39, 0x62,
+    0x09, 0x0A, 0x74, 0x29, 0x6E, 0x7C, 0xEB, 0x7C, 0x64, 0x84, 0x10, 0x82, 0x10, 0x00, 0x0A, 0xC8,
+    0x00, 0x04, 0x60, 0x00, 0x11, 0xA3, 0x20, 0x46, 0x42, 0x08, 0x40, 0x87, 0x54, 0x50, 0x24, 0xCC,
+    0x10, 0x4C, 0x89, 0xB0, 0x94, 0xD1, 0x6E, 0xF9, 0x60, 0x5C, 0x81, 0xD1, 0x0F, 0x04, 0xEC, 0x9A,
+    0xD6, 0x0B, 0x82, 0x0C, 0xD3, 0x30, 0x3B, 0x02, 0xE0, 0x87, 0x99, 0xA6, 0x60, 0x82, 0x9C, 0xCE,
+    0x60, 0xEC, 0x0B, 0x82, 0x14, 0xD3, 0x30, 0x46, 0x38, 0x8E, 0xA7, 0x4A, 0x99, 0x00, 0x00, 0x00,
+    0x04, 0x60, 0x12, 0x81, 0xA1, 0x33, 0x04, 0x23, 0x1E, 0x59, 0x7D, 0xF1, 0x28, 0x84, 0xCC, 0x09,
+    0xCC, 0xF2, 0xA4, 0xA8, 0x24, 0x2A, 0x19, 0x4A, 0xDF, 0x19, 0x00, 0x00, 0x00, 0xEC, 0xA5, 0x0E,
+    0xC3, 0xB0, 0x00, 0x00, 0x49, 0x9F, 0x2C, 0x0B, 0x90, 0x21, 0xCD, 0x33, 0x04, 0x13, 0xB3, 0x29,
+    0x58, 0x2E, 0x0E, 0xBB, 0x44, 0xEC, 0x0B, 0x83, 0xA6, 0xF9, 0x04, 0xE1, 0xCA, 0xD5, 0x70, 0x42,
+    0xCC, 0xD3, 0x30, 0x30, 0x5C, 0x11, 0x19, 0x99, 0xA6, 0x60, 0x8C, 0xA4, 0x05, 0x6C, 0x7D, 0x2A,
+    0x1B, 0x97, 0x08, 0xB1, 0x70, 0x00, 0x00, 0x0E, 0xC0, 0xB8, 0x22, 0x66, 0x69, 0x98, 0x20, 0x9D,
+    0xCC, 0x5A, 0x81, 0x0D, 0x99, 0x9A, 0x66, 0x05, 0x70, 0x45, 0x0B, 0x33, 0x34, 0xCC, 0x10, 0x4C,
+    0x16, 0x3E, 0xAE, 0x0E, 0xA9, 0xF9, 0x82, 0xE0, 0xE9, 0x81, 0x47, 0x4B, 0x82, 0xB7, 0xC6, 0x77,
+    0xD2, 0xF0, 0x64, 0x32, 0x34, 0x9A, 0x4D, 0x26, 0x94, 0x08, 0x81, 0x66, 0x66, 0x99, 0x81, 0x82,
+    0xE0, 0x8A, 0xCC, 0xCD, 0x33, 0x04, 0x13, 0x05, 0xCE, 0xAB, 0x83, 0xA2, 0x8D, 0x03, 0xAA, 0x4A,
+    0x92, 0x90, 0x89, 0x0A, 0x6B, 0xA3, 0x3B, 0xE9, 0x42, 0xA1, 0x50, 0xA8, 0x4C, 0xA2, 0xE1, 0x70,
+    0xB8, 0x5C, 0x2B, 0x82, 0xCC, 0xCD, 0x33, 0x02, 0xB8, 0x23, 0x05, 0x99, 0x9A, 0x66, 0x04, 0xE0,
+    0xC1, 0x70, 0x59, 0x99, 0xA6, 0x60, 0x82, 0x70, 0xB9, 0x70, 0xCE, 0x0B, 0x33, 0x34, 0xCC, 0x08,
+    0x1D, 0x33, 0x79, 0x8E, 0x4E, 0xC2, 0x22, 0x15, 0x0A, 0x6B, 0x9F, 0x2B, 0xC2, 0xC7, 0x0E, 0x70,
+    0x28, 0x00, 0x11, 0x80, 0xC4, 0x0A, 0x00, 0x28, 0x11, 0x89, 0x06, 0x58, 0x0C, 0xD0, 0x15, 0x20,
+    0x84, 0x2B, 0xC8, 0x11, 0x66, 0x07, 0x73, 0xD1, 0x07, 0x20, 0x4A, 0x8D, 0x15, 0x90, 0x5C, 0x87,
+    0xCD, 0x38, 0xB4, 0xE0, 0x33, 0x28, 0x20, 0xB9, 0xC1, 0x91, 0x55, 0xDE, 0x88, 0x11, 0x82, 0x54,
+    0x69, 0x83, 0x41, 0x43, 0xDD, 0x4E, 0x84, 0xD5, 0x67, 0x41, 0x4B, 0xDD, 0x6E, 0x74, 0x40, 0x81,
+    0x52, 0xA3, 0x74, 0x34, 0x72, 0x52, 0x32, 0x14, 0xC8, 0x63, 0xA1, 0x3C, 0x1A, 0x00, 0x00, 0x05,
+    0x80, 0x00, 0x46, 0x00, 0x00, 0x00, 0x10, 0x81, 0xBC, 0xB3, 0x03, 0xA2, 0x04, 0x0A, 0x95, 0x01,
+    0xBD, 0xC5, 0x98, 0x22, 0x04, 0x65, 0x34, 0xF0, 0x02, 0x11, 0xE5, 0x98, 0x20, 0xAE, 0x14, 0xB3,
+    0x4E, 0x40, 0x95, 0x00, 0xB8, 0xB3, 0x04, 0x65, 0x09, 0x09, 0x53, 0x1F, 0x03, 0x28, 0x45, 0x00,
+    0x04, 0x56, 0xA4, 0x45, 0x77, 0xA2, 0x04, 0x60, 0x95, 0x01, 0xB8, 0xB3, 0x04, 0x13, 0xA1, 0xEC,
+    0x9E, 0x04, 0x09, 0x51, 0x1A, 0xA4, 0x77, 0x44, 0x08, 0x15, 0x2A, 0x34, 0xD8, 0x60, 0x9E, 0x0F,
+    0x6E, 0xE4, 0x09, 0x50, 0x13, 0xDC, 0x59, 0x82, 0x09, 0xD1, 0x06, 0x4F, 0x02, 0x04, 0xA8, 0x8D,
+    0x55, 0xF3, 0x90, 0x25, 0x40, 0x88, 0x7B, 0x8B, 0x30, 0x48, 0x52, 0x44, 0x74, 0x29, 0x8E, 0x86,
+    0x44, 0x51, 0x15, 0x6B, 0x11, 0x40, 0x01, 0x14, 0x95, 0x11, 0x5D, 0x10, 0x20, 0x54, 0xA8, 0x11,
+    0xEE, 0x2C, 0xC1, 0x05, 0x48, 0x85, 0xAC, 0xF0, 0x20, 0x4A, 0x88, 0xD1, 0x23, 0x04, 0xE4, 0x43,
+    0x76, 0x09, 0x50, 0x1A, 0x1E, 0xE2, 0xCC, 0x10, 0x4F, 0x02, 0x29, 0x72, 0x04, 0xA8, 0xD5, 0x7B,
+    0xB0, 0x4A, 0x81, 0x60, 0x87, 0xB8, 0xB3, 0x04, 0x65, 0x08, 0x87, 0x53, 0x9F, 0x01, 0x14, 0x00,
+    0x00, 0x00, 0x03, 0x69, 0x23, 0x78, 0x10, 0x25, 0x44, 0x0A, 0x87, 0xB8, 0xB3, 0x04, 0x13, 0x86,
+    0x0D, 0xD4, 0xA8, 0x12, 0x08, 0x7B, 0x8B, 0x30, 0x30, 0x4A, 0x81, 0x89, 0x04, 0x3D, 0xC5, 0x98,
+    0x20, 0xAA, 0x04, 0x97, 0xDC, 0x81, 0x2A, 0x35, 0x5F, 0xD1, 0xD4, 0xF0, 0x8C, 0x85, 0x34, 0xF0,
+    0x20, 0x9A, 0xC9, 0xB9, 0xAC, 0x6B, 0x1A, 0xC6, 0xB3, 0x90, 0x25, 0x40, 0xD0, 0x43, 0xDC, 0x59,
+    0x82, 0x09, 0xCA, 0x46, 0xE8, 0x81, 0x49, 0x04, 0x3D, 0xC5, 0x98, 0x14, 0xA8, 0x1C, 0x24, 0x82,
+    0x1E, 0xE2, 0xCC, 0x10, 0x4E, 0x12, 0x20, 0x52, 0xA3, 0x5D, 0xFC, 0x60, 0x95, 0x1A, 0xAE, 0x19,
+    0x0A, 0x18, 0x4A, 0x68, 0xCE, 0xF8, 0xD2, 0xA4, 0x4A, 0x00, 0x02, 0x08, 0x82, 0x20, 0x80, 0x02,
+    0x0B, 0x04, 0xA8, 0x1C, 0x90, 0x43, 0xDC, 0x59, 0x82, 0x09, 0x82, 0x57, 0x54, 0xA8, 0xD1, 0x32,
+    0x88, 0xD5, 0x27, 0xC1, 0x3A, 0x02, 0xCC, 0x60, 0x92, 0x08, 0x7B, 0x8B, 0x30, 0x41, 0x31, 0x50,
+    0xD2, 0x23, 0x55, 0xF2, 0x41, 0x42, 0x48, 0x21, 0xEE, 0x2C, 0xC1, 0x19, 0x08, 0x24, 0x65, 0x3B,
+    0xE9, 0xE4, 0xE1, 0xE4, 0xE1, 0xE4, 0xE0, 0x72, 0x84, 0x90, 0x43, 0xDC, 0x59, 0x81, 0x4A, 0x82,
+    0x02, 0x48, 0x21, 0xEE, 0x2C, 0xC1, 0x05, 0x45, 0x45, 0xA0, 0x88, 0xD1, 0x2B, 0x5A, 0x50, 0x08,
+    0x86, 0x42, 0x98, 0xE8, 0x4A, 0x96, 0xC6, 0xB9, 0xF2, 0x9D, 0x2B, 0x7C, 0x64, 0x01, 0x07, 0x00,
+    0x63, 0x00, 0x43, 0x30, 0x00, 0x8C, 0x0B, 0xC9, 0x00, 0xEB, 0xEF, 0x13, 0x30, 0x06, 0x30, 0x07,
+    0x8D, 0x00, 0x63, 0x00, 0x2E, 0x90, 0x6B, 0x08, 0x01, 0x8C, 0x09, 0x22, 0x40, 0x97, 0xF0, 0x49,
+    0x58, 0x05, 0x0A, 0x00, 0x27, 0x00, 0x63, 0xD0, 0x01, 0x14, 0x02, 0x4E, 0xBC, 0x56, 0xD9, 0xEF,
+    0x38, 0x24, 0x02, 0x17, 0x95, 0xE5, 0x78, 0x85, 0x82, 0x62, 0xCD, 0x94, 0x70, 0x24, 0x02, 0x54,
+    0x12, 0x01, 0x03, 0x04, 0xD4, 0x7B, 0x29, 0x30, 0x0A, 0x07, 0x16, 0x4A, 0xB0, 0x64, 0x40, 0x41,
+    0x3B, 0xE4, 0xB5, 0xC5, 0x92, 0xAC, 0x09, 0x10, 0x0E, 0xF1, 0x64, 0xA8, 0xB0, 0x83, 0x22, 0x02,
+    0x0A, 0x1D, 0x55, 0x38, 0x26, 0x4D, 0x59, 0x43, 0x02, 0x40, 0x2B, 0xE6, 0x09, 0x00, 0x8F, 0x83,
+    0x19, 0x4E, 0x6D, 0x0A, 0x81, 0xE3, 0x36, 0x64, 0x86, 0xB4, 0x95, 0xCF, 0xB7, 0xE0, 0x78, 0x1E,
+    0x28, 0x66, 0x09, 0x00, 0xA9, 0x30, 0x24, 0x02, 0xBC, 0xE0, 0x90, 0x10, 0x92, 0xC4, 0xD6, 0xF2,
+    0x35, 0x5A, 0xBE, 0x08, 0x47, 0x70, 0x24, 0x02, 0x3E, 0x14, 0x10, 0x3B, 0xD1, 0x14, 0x51, 0x14,
+    0x24, 0xF8, 0x51, 0x04, 0x44, 0x58, 0x4A, 0x97, 0x3E, 0x27, 0x68, 0xFD, 0x5B, 0xB2, 0xDD, 0xE2,
+    0xC9, 0x51, 0x7A, 0xE5, 0xFC, 0x36, 0x38, 0xA9, 0x7D, 0xEB, 0x82, 0x2F, 0x2A, 0x22, 0x60, 0x98,
+    0xD3, 0x40, 0x12, 0x00, 0x02, 0x82, 0x09, 0x83, 0x36, 0x52, 0x60, 0x90, 0x0A, 0x11, 0x00, 0x08,
+    0x92, 0x4E, 0xCA, 0xE7, 0xDD, 0x9C, 0xA0, 0x03, 0xA7, 0xFA, 0x6C, 0x00, 0x19, 0xC1, 0x4A, 0x03,
+    0x42, 0x4A, 0x00, 0x08, 0x32, 0x7A, 0x2F, 0x49, 0x34, 0x38, 0x24, 0x04, 0x29, 0x15, 0xF3, 0xBA,
+    0x3A, 0xBF, 0xA5, 0x9D, 0x94, 0x5B, 0x0D, 0x6F, 0x4B, 0x1D, 0x04, 0x45, 0x70, 0x58, 0x82, 0x64,
+    0x49, 0xE4, 0x98, 0x0C, 0x20, 0x10, 0x20, 0x38, 0x80, 0x47, 0xC1, 0x34, 0xE4, 0xD0, 0x55, 0x71,
+    0x00, 0x81, 0xCF, 0x3D, 0x1F, 0x08, 0xC3, 0x45, 0xDA, 0x00, 0x2A, 0xB0, 0x80, 0x49, 0xE7, 0x9F,
+    0x1D, 0x11, 0x0A, 0xDF, 0x3A, 0xDF, 0x4F, 0xA4, 0x68, 0x80, 0x00, 0x00, 0x00, 0x0A, 0x19, 0x84,
+    0x92, 0x01, 0x83, 0x3E, 0x67, 0x95, 0x05, 0x61, 0x7D, 0x74, 0x49, 0xE8, 0x91, 0x8E, 0x92, 0x04,
+    0xB1, 0x9D, 0xF1, 0xAB, 0xA8, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x09, 0x30, 0xC2, 0x92, 0x02,
+    0x21, 0x82, 0x42, 0xDF, 0x00, 0x3E, 0x00, 0x02, 0x4C, 0x29, 0x20, 0x13, 0x99, 0xE5, 0x45, 0x64,
+    0x92, 0xC7, 0xC2, 0xA0, 0x9A, 0x10, 0xE1, 0xD8, 0x04, 0xB2, 0xCC, 0xAF, 0xBF, 0x09, 0xBA, 0xD6,
+    0x79, 0xF8, 0x13, 0xC8, 0x08, 0x2C, 0x78, 0x6A, 0x11, 0x0F, 0xA2, 0xC6, 0x12, 0x24, 0xFA, 0xDE,
+    0x8F, 0x2B, 0xEE, 0x09, 0x00, 0x8F, 0xD9, 0x0A, 0x72, 0x0E, 0x23, 0x1D, 0x09, 0x64, 0x29, 0x60,
+    0x0F, 0xD1, 0x80, 0x00, 0x00, 0x00, 0x04, 0x38, 0x6F, 0x79, 0x00, 0xA7, 0xE6, 0x79, 0x51, 0x02,
+    0x23, 0x22, 0x96, 0x01, 0x0E, 0xF7, 0x90, 0x13, 0xA4, 0xB0, 0x8C, 0x85, 0x4B, 0x1A, 0xE7, 0xCA,
+    0x76, 0xBE, 0x00, 0x0D, 0xCB, 0xBE, 0xB4, 0x01, 0x67, 0x00, 0x9F, 0xBF, 0x57, 0x3B, 0xBF, 0x2C,
+    0x00, 0x5F, 0x00, 0x43, 0xBF, 0x5A, 0xF0, 0x06, 0xF8, 0x03, 0xAC, 0x00, 0x07, 0x80, 0x08, 0xA0,
+    0x00, 0xF1, 0x92, 0xCE, 0x00, 0x06, 0x0A, 0x38, 0x00, 0x16, 0x75, 0x08, 0xA4, 0x02, 0x06, 0x08,
+    0x4F, 0x30, 0x00, 0x82, 0x69, 0x95, 0x84, 0xAE, 0x88, 0xC5, 0x77, 0x34, 0xDB, 0xA0, 0xA1, 0xF3,
+    0xAC, 0xDB, 0x2B, 0x08, 0x2D, 0x7D, 0x67, 0x24, 0xE8, 0x81, 0x02, 0xA5, 0x40, 0x13, 0x04, 0x28,
+    0x94, 0x33, 0xBE, 0x82, 0xFF, 0xC0, 0x91, 0xDA, 0xA8, 0xC8, 0x6A, 0x79, 0x51, 0x30, 0xDC, 0x19,
+    0xAA, 0x95, 0xBC, 0x00, 0x0B, 0x4E, 0x00, 0x50, 0x41, 0x35, 0xDC, 0xA2, 0x70, 0x00, 0x27, 0x35,
+    0xDC, 0xC9, 0x2D, 0x11, 0x0A, 0x85, 0x35, 0xD2, 0x9D, 0xC0, 0x47, 0x01, 0xD0, 0x11, 0x80, 0x00,
+    0x00, 0x00, 0x3F, 0x00, 0x04, 0x0D, 0x80, 0x46, 0x8E, 0x0C, 0xA5, 0x20, 0x15, 0xDC, 0xCF, 0x2A,
+    0x10, 0x44, 0xA6, 0x82, 0x38, 0xA5, 0x20, 0x24, 0xC8, 0x24, 0x2A, 0x54, 0xFA, 0xDF, 0x19, 0x00,
+    0x00, 0x00, 0x07, 0xB0, 0x00, 0x8C, 0x00, 0x00, 0xB4, 0xF5, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0xA1, 0xCC, 0xA4, 0x02, 0xD7, 0x99, 0xE5, 0x42, 0x0A, 0x55, 0x90, 0x4A,
+    0xCC, 0xA4, 0x04, 0x14, 0xA2, 0xB6, 0xFD, 0xB3, 0x40, 0x92, 0xA6, 0x04, 0xA6, 0x7C, 0x67, 0x4B,
+    0xE9, 0xAE, 0x58, 0x02, 0x81, 0x8C, 0xE4, 0x39, 0x02, 0x83, 0x90, 0xE4, 0x57, 0xDC, 0x29, 0x30,
+    0x80, 0x70, 0xBC, 0x59, 0x52, 0xAC, 0x29, 0x10, 0x10, 0x4E, 0x20, 0xAD, 0x6C, 0x95, 0x60, 0x86,
+    0x44, 0x03, 0x8B, 0x25, 0x58, 0x6F, 0x0C, 0x88, 0x08, 0x27, 0x78, 0x56, 0xB8, 0xB2, 0x55, 0xEE,
+    0xB5, 0x59, 0xDE, 0x2C, 0x95, 0x17, 0xAA, 0xEE, 0x82, 0x84, 0x06, 0xC2, 0x08, 0x69, 0x72, 0x70,
+    0x02, 0x82, 0x42, 0xA2, 0x24, 0xB1, 0xF0, 0x9D, 0xF4, 0x1D, 0x97, 0x85, 0xE2, 0x4E, 0x5E, 0x00,
+    0x00, 0x00, 0x00, 0xEF, 0x16, 0x4A, 0x8B, 0x0C, 0x32, 0x20, 0x20, 0x9F, 0x2F, 0x5A, 0xA5, 0x58,
+    0x4F, 0x0C, 0x88, 0x06, 0xC9, 0x56, 0x20, 0x9E, 0x19, 0x10, 0x10, 0x4E, 0x27, 0xA5, 0x6C, 0x95,
+    0x7A, 0xEC, 0x83, 0x8B, 0x25, 0x5E, 0xAB, 0xEA, 0x42, 0x92, 0x23, 0xA1, 0x8E, 0x85, 0xB2, 0x8B,
+    0x06, 0xE1, 0xB8, 0x00, 0x1B, 0x80, 0x01, 0xB9, 0x2A, 0xE2, 0xC9, 0x56, 0x23, 0xC3, 0x22, 0x02,
+    0x09, 0xC5, 0x94, 0x4D, 0x92, 0xAF, 0x45, 0x12, 0x95, 0x7A, 0xA5, 0x38, 0x27, 0x28, 0x96, 0xA2,
+    0xC3, 0x13, 0xC3, 0x22, 0x01, 0x4A, 0xB1, 0x72, 0x27, 0x86, 0x44, 0x04, 0x75, 0x1C, 0xA8, 0x75,
+    0x2B, 0x6C, 0x91, 0x41, 0xB8, 0x00, 0x1B, 0x86, 0xE0, 0x02, 0x20, 0xD9, 0x2A, 0xC5, 0x13, 0xC3,
+    0x22, 0x02, 0x09, 0x8B, 0x96, 0x91, 0x7A, 0xAF, 0x05, 0x2A, 0xF4, 0x44, 0xC1, 0x3A, 0xF2, 0xC9,
+    0x38, 0x26, 0x44, 0xF0, 0xC8, 0x80, 0x45, 0x8C, 0x5C, 0x89, 0xE1, 0x91, 0x01, 0x1D, 0x2B, 0x21,
+    0x51, 0x2A, 0x56, 0xEA, 0x13, 0x28, 0xB9, 0x42, 0x2E, 0x17, 0x28, 0x45, 0x2E, 0x44, 0xF0, 0xC8,
+    0x80, 0x52, 0xAC, 0x6C, 0x89, 0xE1, 0x91, 0x00, 0x9C, 0x19, 0x65, 0xC8, 0x9E, 0x19, 0x10, 0x10,
+    0x54, 0x55, 0xD3, 0xC8, 0xBD, 0x36, 0x29, 0x2C, 0x29, 0x92, 0xA5, 0xBE, 0x54, 0xAE, 0x40, 0x00,
+    0x3A, 0x42, 0xB4, 0x17, 0x04, 0xE4, 0x95, 0x40, 0x01, 0x18, 0x02, 0xB6, 0x09, 0x9F, 0x27, 0x52,
+    0xFB, 0x6E, 0xAE, 0xAF, 0xB8, 0x4C, 0x20, 0x16, 0xAF, 0x84, 0x84, 0x0E, 0xF6, 0x56, 0x49, 0x3D,
+    0x13, 0x50, 0x5D, 0x57, 0xD5, 0xF0, 0x8F, 0xD1, 0x03, 0x09, 0xC8, 0x7D, 0x6A, 0xA9, 0xFE, 0xC5,
+    0x2E, 0x01, 0x41, 0x09, 0x08, 0x95, 0x4A, 0x1F, 0x56, 0x7C, 0x06, 0xAC, 0x20, 0x20, 0x99, 0xF7,
+    0x69, 0x2F, 0xAA, 0x85, 0x0D, 0xF2, 0x61, 0x01, 0x0D, 0x43, 0x43, 0xEE, 0x0F, 0xC9, 0x60, 0x00,
+    0x6F, 0xAB, 0x08, 0x04, 0x9E, 0x79, 0x51, 0xD2, 0x53, 0x25, 0x8F, 0x85, 0x2E, 0x00, 0x2A, 0x95,
+    0x51, 0xA5, 0x50, 0x00, 0xA1, 0x5F, 0x70, 0xE4, 0xC2, 0x01, 0x1E, 0x25, 0xDF, 0x26, 0x10, 0x10,
+    0x54, 0xFB, 0xD0, 0xA9, 0x7D, 0x10, 0x31, 0xD2, 0x90, 0x95, 0x90, 0x8C, 0xEF, 0x31, 0x98, 0x80,
+    0x00, 0x13, 0x19, 0x88, 0xA1, 0x2E, 0x23, 0xE4, 0xC2, 0x02, 0x19, 0xE2, 0x12, 0xCD, 0x22, 0x40,
+    0x02, 0xDD, 0xF2, 0x61, 0x00, 0x9C, 0xCF, 0x16, 0x42, 0x86, 0x84, 0xA9, 0x8F, 0x85, 0xF2, 0x2D,
+    0x24, 0x66, 0x12, 0x46, 0xBD, 0x24, 0x61, 0x69, 0x84, 0x8F, 0x10, 0x6F, 0xAB, 0x08, 0x04, 0x78,
+    0x97, 0x7D, 0x58, 0x40, 0x41, 0x34, 0xDE, 0xF8, 0x4F, 0xAB, 0x08, 0x04, 0x98, 0x88, 0x7D, 0x58,
+    0x40, 0x23, 0xE1, 0x18, 0x68, 0xBB, 0x40, 0x07, 0x56, 0x10, 0x09, 0x3C, 0xF3, 0xE1, 0xB0, 0x68,
+    0x7D, 0xEF, 0xBB, 0xD9, 0x00, 0x03, 0x65, 0xDE, 0x51, 0x5A, 0x02, 0x21, 0x90, 0xA7, 0x4A, 0x98,
+    0xE8, 0x46, 0x76, 0xBE, 0x33, 0x66, 0xC6, 0x00, 0x32, 0xAD, 0xD6, 0x6C, 0x60, 0x10, 0x91, 0x80,
+    0x42, 0x46, 0x01, 0x09, 0xB3, 0x65, 0x0E, 0xB7, 0x07, 0x9A, 0xDC, 0x30, 0x13, 0x82, 0x4D, 0x0F,
+    0xAB, 0x08, 0x08, 0x61, 0x24, 0xED, 0x80, 0x28, 0xDF, 0x56, 0x10, 0x10, 0xC2, 0x12, 0xC6, 0x60,
+    0x5B, 0xBE, 0xAC, 0x20, 0x20, 0xAD, 0x13, 0xA4, 0x49, 0x31, 0x1F, 0x56, 0x10, 0x10, 0x90, 0x34,
+    0x5E, 0xB4, 0x03, 0x45, 0x3C, 0x24, 0xA0, 0x77, 0xBD, 0x5E, 0x85, 0x9A, 0x1F, 0x56, 0x10, 0x12,
+    0x16, 0xB1, 0x21, 0x2A, 0x6B, 0xEB, 0x90, 0x46, 0x08, 0xCC, 0x19, 0x3B, 0x04, 0x62, 0x5D, 0x70,
+    0x90, 0x75, 0x49, 0x82, 0x71, 0x01, 0x04, 0xC9, 0xAB, 0x08, 0x6D, 0x16, 0xE8, 0xF8, 0x28, 0x94,
+    0xE4, 0x10, 0x3A, 0x6E, 0xF0, 0x51, 0x54, 0xC5, 0x41, 0x34, 0xE4, 0xF8, 0x6F, 0xAB, 0x88, 0x04,
+    0x0E, 0x79, 0x50, 0x52, 0xFA, 0xCC, 0x77, 0x41, 0x15, 0x09, 0xC9, 0x7D, 0x60, 0x53, 0xFB, 0x97,
+    0x55, 0x79, 0x1D, 0x23, 0x21, 0x8E, 0xF9, 0x56, 0xC0, 0x02, 0x38, 0x00, 0x46, 0x00, 0x5D, 0x00,
+    0x10, 0xC1, 0xA5, 0xC4, 0x02, 0xC8, 0x3B, 0xEF, 0xD2, 0x44, 0x30, 0xC8, 0x79, 0x58, 0x00, 0x1F,
+    0x00, 0x43, 0x25, 0xC4, 0x02, 0x73, 0x3C, 0xA8, 0x2B, 0x33, 0xEC, 0x7E, 0x98, 0xF4, 0x75, 0x4D,
+    0x2A, 0x63, 0xE1, 0x2C, 0xA8, 0x42, 0xF9, 0x6A, 0xCC, 0x9E, 0xC1, 0x68, 0xBE, 0x8F, 0x12, 0x6F,
+    0xAB, 0x88, 0x05, 0x78, 0x44, 0x93, 0xEA, 0xE2, 0x01, 0x1F, 0x04, 0xD3, 0x93, 0x41, 0xD5, 0xC4,
+    0x02, 0x07, 0x3C, 0xF8, 0x4B, 0x7C, 0xA7, 0x2B, 0xE4, 0x86, 0x9B, 0x94, 0x25, 0xCD, 0xF2, 0xE8,
+    0x31, 0xB9, 0x39, 0xAE, 0x1A, 0x43, 0x61, 0x9F, 0x29, 0xF7, 0x16, 0x07, 0xDF, 0x86, 0xCB, 0x1A,
+    0x92, 0xBA, 0x04, 0xA6, 0x4B, 0x21, 0x29, 0xE0, 0x31, 0x5C, 0xF1, 0x52, 0x0B, 0x41, 0x68, 0xD9,
+    0x31, 0xC4, 0x4A, 0xE7, 0xAC, 0x82, 0x23, 0xEA, 0xE2, 0x02, 0x09, 0xE5, 0x38, 0x88, 0x1D, 0x15,
+    0x90, 0x51, 0x29, 0xC7, 0x0A, 0x19, 0x3E, 0xAE, 0x20, 0x20, 0xA0, 0x32, 0x83, 0xD7, 0x4A, 0x20,
+    0xA6, 0x72, 0xA9, 0x27, 0x35, 0x5F, 0x91, 0x0E, 0x12, 0x16, 0xF8, 0x00, 0x90, 0x00, 0x01, 0x66,
+    0xFA, 0xB8, 0x80, 0x4E, 0x67, 0x8B, 0x19, 0x45, 0x34, 0x67, 0x4B, 0xE8, 0x00, 0xA1, 0xE8, 0x70,
+    0x00, 0x2D, 0xA1, 0xD0, 0x22, 0xC9, 0xF5, 0x71, 0x00, 0x9C, 0xD5, 0x20, 0x54, 0x88, 0xF6, 0x12,
+    0x14, 0xC8, 0x4A, 0x96, 0xC7, 0xC6, 0x53, 0xA5, 0x6D, 0x7C, 0xEA, 0x42, 0x4C, 0x03, 0xCA, 0x05,
+    0x87, 0x83, 0xF0, 0x80, 0x3D, 0x80, 0x25, 0x70, 0x62, 0xC0, 0x00, 0x8C, 0x02, 0x4C, 0x00, 0x46,
+    0x00, 0x46, 0x00, 0x1A, 0x40, 0x5C, 0x80, 0x18, 0x90, 0x47, 0x50, 0x14, 0xE4, 0x01, 0x68, 0x06,
+    0xF1, 0x00, 0x70, 0x80, 0x1A, 0x58, 0x38, 0x28, 0x14, 0x03, 0x55, 0xF9, 0x06, 0x40, 0x64, 0xA2,
+    0xE0, 0x14, 0x0C, 0x12, 0xE4, 0x19, 0x01, 0xD2, 0x54, 0x50, 0x19, 0x01, 0x8A, 0x57, 0x05, 0x62,
+    0xC8, 0x10, 0x63, 0x52, 0xC8, 0x60, 0x95, 0xF9, 0x06, 0x40, 0x82, 0x72, 0xA5, 0x1A, 0xA2, 0x80,
+    0xA6, 0x40, 0x62, 0xA2, 0x80, 0xC8, 0x10, 0x8C, 0x57, 0xC8, 0x07, 0x95, 0x14, 0x00, 0xA0, 0x54,
+    0x98, 0x0A, 0x02, 0x12, 0x82, 0x5A, 0x83, 0xD7, 0x6A, 0x97, 0x20, 0xC8, 0x0B, 0x67, 0x83, 0x20,
+    0x42, 0x89, 0x4F, 0x4A, 0xC4, 0xA0, 0x00, 0xA1, 0x68, 0xF0, 0x90, 0x59, 0x01, 0x9E, 0xE0, 0x80,
+    0x59, 0x02, 0x24, 0x88, 0x54, 0x52, 0xD5, 0xD1, 0xF8, 0x00, 0x46, 0x00, 0x1F, 0x80, 0x0B, 0x8A,
+    0xEA, 0x82, 0x59, 0x01, 0x68, 0xFC, 0xF3, 0xD4, 0xC1, 0xD1, 0x64, 0xA5, 0x76, 0x89, 0x58, 0xA7,
+    0x21, 0x63, 0x29, 0xE9, 0x18, 0x00, 0x00, 0x00, 0x29, 0x72, 0x10, 0x64, 0x08, 0xA8, 0x24, 0xA9,
+    0x5B, 0xE4, 0x8C, 0x00, 0x00, 0x01, 0x41, 0x32, 0x19, 0x43, 0x20, 0x41, 0x39, 0xF3, 0x24, 0x0A,
+    0x02, 0x11, 0xAA, 0x8A, 0x3E, 0xF8, 0x99, 0x28, 0x64, 0x04, 0xE6, 0x79, 0x51, 0x50, 0xA4, 0xB1,
+    0xF0, 0xC9, 0x18, 0x03, 0xA8, 0x00, 0x02, 0xBF, 0x21, 0x56, 0x40, 0x82, 0x62, 0xBD, 0xE5, 0x45,
+    0x01, 0x90, 0x13, 0x3A, 0x26, 0x63, 0xA0, 0x48, 0x4B, 0x21, 0x4A, 0xE4, 0x78, 0x78, 0x78, 0x79,
+    0x04, 0x79, 0x75, 0x43, 0xC0, 0x28, 0x04, 0xC8, 0x6F, 0xAC, 0x80, 0xB9, 0xE6, 0x79, 0x49, 0x51,
+    0x32, 0xFA, 0xC8, 0x11, 0x59, 0x40, 0x90, 0xA8, 0xB5, 0x62, 0x02, 0xC8, 0x5E, 0x60, 0xEE, 0x2B,
+    0x41, 0x31, 0xA8, 0xE2, 0x07, 0x65, 0xE8, 0x29, 0x45, 0xB2, 0xEB, 0xE0, 0x99, 0xC9, 0x71, 0x2B,
+    0xB2, 0xDD, 0xDE, 0x6E, 0x78, 0xF6, 0x5A, 0x64, 0x34, 0x11, 0x14, 0xB0, 0xF1, 0xE2, 0xD2, 0xBA,
+    0xA0, 0xC8, 0x0B, 0x47, 0x83, 0x20, 0x29, 0x82, 0x0C, 0x81, 0x04, 0xCF, 0x2A, 0x00, 0xC8, 0x08,
+    0xE0, 0x64, 0x08, 0xF1, 0x76, 0xC2, 0x54, 0xCE, 0x95, 0x8F, 0xEE, 0x00, 0x27, 0x00, 0x1F, 0x31,
+    0xF2, 0xA0, 0x00, 0xC8, 0x00, 0xC8, 0x00, 0xA6, 0xB5, 0x18, 0x00, 0x5A, 0xA8, 0x00, 0x29, 0x45,
+    0xB2, 0x39, 0xD1, 0xF0, 0x4D, 0x91, 0x20, 0x0C, 0x80, 0x81, 0x00, 0x10, 0x5E, 0x54, 0x4C, 0x88,
+    0x83, 0x2C, 0xCA, 0xAD, 0xBB, 0x06, 0x40, 0x84, 0x7B, 0x1A, 0x86, 0x5E, 0x23, 0xC1, 0x90, 0x10,
+    0x21, 0x50, 0xB2, 0x02, 0x94, 0x59, 0xE5, 0x44, 0x62, 0x48, 0x5A, 0x5B, 0x13, 0x00, 0xB2, 0xFC,
+    0xE1, 0x25, 0xE6, 0xE7, 0x8F, 0x6D, 0xCF, 0xE2, 0xAE, 0xC4, 0x42, 0x5D, 0x48, 0xB5, 0x1E, 0x02,
+    0x08, 0x1E, 0x92, 0xCA, 0x57, 0x03, 0x20, 0x25, 0x42, 0x21, 0x64, 0x07, 0x9B, 0x9E, 0x3C, 0xF0,
+    0x23, 0xA9, 0x64, 0x2A, 0x1F, 0x2A, 0xDC, 0xD0, 0x41, 0x85, 0x00, 0x00, 0x28, 0x1F, 0x4D, 0x06,
+    0x2A, 0x28, 0x12, 0x64, 0x05, 0x45, 0x02, 0x2A, 0x64, 0x05, 0x2D, 0x03, 0x41, 0x53, 0x20, 0x41,
+    0x33, 0xCA, 0xCA, 0x64, 0x19, 0x01, 0x51, 0x4D, 0x34, 0x38, 0x27, 0x41, 0x62, 0xA5, 0x34, 0xCC,
+    0x24, 0xA4, 0x82, 0x3A, 0x14, 0xE9, 0x52, 0xF9, 0x2A, 0x95, 0x51, 0xA5, 0x52, 0xA8, 0x00, 0x50,
+    0x00, 0x2A, 0xAA, 0x28, 0x19, 0x53, 0x20, 0x22, 0x04, 0xA2, 0x0A, 0x99, 0x02, 0x0A, 0x91, 0x49,
+    0x51, 0x29, 0xA2, 0x06, 0x32, 0x44, 0x75, 0x3A, 0x54, 0xCC, 0xFC, 0x00, 0x00, 0x9F, 0x8A, 0x27,
+    0xE9, 0x41, 0x10, 0x54, 0xC8, 0x10, 0x82, 0x79, 0x64, 0x16, 0x88, 0x2A, 0x64, 0x0A, 0x6E, 0x68,
+    0x44, 0x32, 0x14, 0xC7, 0x42, 0x54, 0xE9, 0x4E, 0x95, 0xB5, 0xF1, 0x9C, 0x37, 0xC1, 0xBA, 0x13,
+    0x4D, 0x21, 0x70, 0x54, 0x45, 0xAC, 0x18, 0xB4, 0x92, 0x90, 0x1E, 0xC0, 0x1E, 0x03, 0xF0, 0x34,
+    0x20, 0x91, 0x8D, 0x4D, 0xBF, 0x30, 0x68, 0x51, 0x4E, 0x02, 0xFD, 0x0F, 0xE9, 0x83, 0x3E, 0x00,
+    0x08, 0x27, 0x45, 0x11, 0xAD, 0x1E, 0x11, 0x64, 0x04, 0x7E, 0xD8, 0x75, 0xC1, 0x3C, 0xC8, 0xB5,
+    0x9C, 0xF1, 0x82, 0x42, 0xC8, 0x0F, 0x37, 0x3C, 0x61, 0xA4, 0x85, 0x90, 0x21, 0x24, 0x88, 0xA4,
+    0x4A, 0x6A, 0x95, 0x0D, 0xC4, 0x2C, 0x81, 0x0E, 0x49, 0x74, 0xAD, 0xFC, 0x96, 0x54, 0x7C, 0x9F,
+    0xBE, 0xA6, 0xC9, 0x3C, 0x84, 0xA2, 0xA2, 0xD2, 0x90, 0x46, 0xAE, 0xE6, 0xEB, 0x5F, 0xE0, 0xA8,
+    0xAF, 0x87, 0x51, 0xDA, 0xA0, 0x38, 0x72, 0x21, 0x52, 0xFA, 0x8B, 0xBF, 0xF8, 0x5A, 0xA8, 0xBB,
+    0xE0, 0x99, 0xC9, 0x6D, 0x2B, 0xAE, 0xBB, 0x3C, 0xDC, 0xF1, 0xEB, 0xA9, 0x90, 0x9A, 0x44, 0xBA,
+    0xF8, 0x97, 0xA1, 0xD3, 0x5A, 0x8B, 0x22, 0x99, 0x0F, 0xA5, 0xBF, 0x5C, 0xEA, 0xDA, 0xAF, 0xCB,
+    0x5E, 0xFD, 0x7C, 0x40, 0x01, 0x95, 0xBF, 0x00, 0x02, 0x3F, 0x5C, 0x4F, 0x84, 0xDA, 0x19, 0x15,
+    0x65, 0xE0, 0x64, 0x37, 0x18, 0xAF, 0xA0, 0x03, 0x96, 0x76, 0x80, 0x72, 0x81, 0xD9, 0x76, 0x88,
+    0x2D, 0xB4, 0xEB, 0x52, 0x8B, 0x65, 0xBB, 0x43, 0x69, 0x48, 0x9B, 0x76, 0x0A, 0xBB, 0x9C, 0xF2,
+    0x47, 0x6E, 0xA9, 0x4E, 0x1B, 0x28, 0x44, 0x5B, 0x48, 0x2A, 0xFF, 0x24, 0x20, 0xA4, 0xD4, 0x8B,
+    0xEA, 0xB3, 0x62, 0x36, 0x84, 0x2A, 0x6D, 0xC9, 0x7F, 0x8A, 0xD3, 0xC7, 0x80, 0xE8, 0x10, 0xCD,
+    0x42, 0xC8, 0x10, 0xD8, 0x64, 0x52, 0xD3, 0x95, 0xB7, 0xD7, 0x37, 0xB6, 0x61, 0xF2, 0x92, 0x91,
+    0x0C, 0x85, 0x31, 0xD9, 0x09, 0x5C, 0x46, 0x84, 0x5E, 0x3A, 0x50, 0x88, 0x41, 0xF8, 0x00, 0xB8,
+    0xBC, 0x47, 0x87, 0x62, 0xC8, 0x0A, 0x57, 0x67, 0x94, 0xAF, 0xE6, 0x8A, 0xD4, 0x70, 0x65, 0xB1,
+    0x64, 0x08, 0x29, 0x2B, 0xEC, 0xC8, 0xED, 0x34, 0xD8, 0x28, 0x2B, 0xA2, 0xF4, 0x5D, 0x45, 0x4A,
+    0x88, 0x86, 0xBA, 0xE4, 0xC3, 0x41, 0xA1, 0x00, 0x24, 0x11, 0xC5, 0xB1, 0x64, 0x04, 0x70, 0x85,
+    0xB1, 0x64, 0x05, 0x77, 0x33, 0xC5, 0x4E, 0x68, 0x80, 0x86, 0x11, 0x21, 0x4D, 0x02, 0xB8, 0xB6,
+    0x2C, 0x81, 0x1D, 0x22, 0x3A, 0x9C, 0xF9, 0x53, 0x2B, 0x30, 0x00, 0x00, 0x50, 0x5F, 0x74, 0x17,
+    0xD6, 0x8F, 0x0D, 0x05, 0x90, 0x1A, 0x8E, 0x08, 0x8F, 0xA2, 0x0B, 0x20, 0x41, 0x33, 0xE8, 0xF8,
+    0x74, 0x41, 0x64, 0x04, 0x7E, 0x9A, 0xDC, 0x13, 0xBE, 0x92, 0x93, 0x9A, 0x24, 0xE2, 0xA8, 0xE9,
+    0x73, 0xE1, 0x90, 0xA0, 0x44, 0x1E, 0xEF, 0x70, 0x01, 0x1E, 0x25, 0x10, 0x59, 0x01, 0x5F, 0xCC,
+    0xF1, 0x55, 0xE1, 0x15, 0xCF, 0xA2, 0x0B, 0x20, 0x47, 0x48, 0x44, 0x85, 0x31, 0xAE, 0x81, 0x59,
+    0x1A, 0x8D, 0x14, 0x9C, 0x18, 0xC7, 0x01, 0x1C, 0xFA, 0x20, 0xB2, 0x02, 0x70, 0x57, 0xD1, 0x05,
+    0x90, 0x10, 0x3A, 0xAF, 0x45, 0x70, 0x74, 0x52, 0xC1, 0x53, 0x83, 0x5B, 0xA0, 0x74, 0xDB, 0x23,
+    0x1E, 0x28, 0x53, 0x67, 0x7D, 0x2E, 0x5C, 0xB8, 0x00, 0x00, 0x03, 0x05, 0xCF, 0xA2, 0x0B, 0x20,
+    0x20, 0x46, 0x73, 0xE8, 0x82, 0xC8, 0x12, 0x96, 0x40, 0x8C, 0xA6, 0x3A, 0x25, 0x4B, 0x64, 0x22,
+    0x11, 0x01, 0x5A, 0xC3, 0xCF, 0x08, 0x28, 0x29, 0x88, 0xCC, 0x38, 0x98, 0xA5, 0x30, 0x43, 0xA1,
+    0x64, 0x04, 0x7E, 0xCB, 0xD5, 0x43, 0x08, 0x13, 0x50, 0xB2, 0x04, 0x16, 0x98, 0x37, 0x7C, 0x40,
+    0xE9, 0xB0, 0xC1, 0x30, 0xA8, 0xD0, 0x34, 0x2C, 0x80, 0x82, 0x10, 0xB4, 0xA1, 0x64, 0x08, 0x29,
+    0x09, 0xAC, 0xA9, 0xCD, 0xB6, 0xC4, 0x82, 0x9A, 0x1A, 0x52, 0xA5, 0x16, 0xAA, 0x12, 0x12, 0x8A,
+    0x6A, 0x5B, 0x7D, 0x92, 0x08, 0x3A, 0x50, 0xB2, 0x04, 0x35, 0x04, 0xA6, 0xA7, 0x35, 0x3A, 0xE9,
+    0x9B, 0x6B, 0xBB, 0x15, 0x02, 0x21, 0xE5, 0x7C, 0xA8, 0x92, 0x28, 0xA8, 0x92, 0x06, 0x5A, 0x50,
+    0xB2, 0x02, 0x94, 0x42, 0x52, 0x85, 0x90, 0x20, 0xAC, 0xA2, 0xBE, 0xA8, 0x2D, 0x15, 0x12, 0x56,
+    0x30, 0x90, 0xF1, 0x94, 0xED, 0x7D, 0x02, 0x80, 0x00, 0x00, 0x24, 0xE8, 0x00, 0x93, 0xA0, 0x02,
+    0x4E, 0xC9, 0xD4, 0x08, 0x86, 0xA1, 0x64, 0x08, 0x41, 0x8C, 0xF4, 0x0A, 0x13, 0x50, 0xB2, 0x05,
+    0x18, 0x08, 0x23, 0x21, 0x4C, 0x84, 0xA9, 0x6D, 0x73, 0xE7, 0x4A, 0xDB, 0x17, 0x72, 0xE0, 0x0C,
+    0x9D, 0xE1, 0xE0, 0x0C, 0x80, 0x0C, 0x80, 0x1D, 0xE0, 0x65, 0xE0, 0x05, 0x00, 0x15, 0x20, 0x05,
+    0x00, 0x4D, 0x40, 0x15, 0x20, 0x32, 0x1E, 0x3D, 0xE0, 0x26, 0xDD, 0xCF, 0xE0, 0x0C, 0x8A, 0xEA,
+    0x86, 0x42, 0xC8, 0x10, 0x5C, 0xEA, 0xDA, 0xB2, 0x95, 0xD1, 0x55, 0x04, 0xE9, 0x74, 0xB7, 0x9B,
+    0x9E, 0x3D, 0x36, 0x58, 0x28, 0x9A, 0x6E, 0x99, 0xCF, 0x1E, 0xEB, 0x18, 0x61, 0x39, 0xD4, 0xAD,
+    0xE5, 0x96, 0x3F, 0xE9, 0x8B, 0x42, 0x4B, 0x93, 0x38, 0xF5, 0x91, 0x38, 0x25, 0x5C, 0x42, 0xC8,
+    0x10, 0x50, 0xE4, 0xA4, 0x41, 0x53, 0xEB, 0x20, 0x20, 0xC2, 0x49, 0x0B, 0x20, 0x41, 0x3C, 0xDC,
+    0x95, 0x9C, 0xF1, 0xEB, 0xBA, 0xCA, 0xF1, 0x89, 0x34, 0x90, 0xB2, 0x04, 0x55, 0x09, 0x0A, 0x6D,
+    0x72, 0x00, 0x54, 0xC0, 0x00, 0x51, 0x4E, 0xA5, 0x44, 0x71, 0x0B, 0x20, 0x42, 0x0A, 0x55, 0x90,
+    0x5A, 0xB8, 0x85, 0x90, 0x24, 0xA8, 0x24, 0x2A, 0xDC, 0xF9, 0xD6, 0xF8, 0x16, 0xC5, 0xB0, 0x90,
+    0x9E, 0x09, 0x11, 0xF0, 0x90, 0x5B, 0x16, 0xD9, 0xCF, 0x1E, 0xA9, 0x6D, 0xE6, 0xE7, 0x8C, 0x44,
+    0x90, 0xB2, 0x04, 0x15, 0xCD, 0xD7, 0xD5, 0x9C, 0xF1, 0xE8, 0x9E, 0x82, 0x77, 0xCD, 0x6A, 0x0C,
+    0x39, 0xA4, 0x85, 0x90, 0x15, 0xE3, 0x15, 0xD3, 0x49, 0x0B, 0x20, 0x4A, 0x48, 0x44, 0x42, 0xA1,
+    0x4D, 0x73, 0xEF, 0x83, 0x98, 0x00, 0x00, 0x73, 0x39, 0x9C, 0xD8, 0xE3, 0x70, 0x00, 0x01, 0x9C,
+    0xF1, 0x8B, 0x34, 0x90, 0xB2, 0x02, 0xB8, 0x63, 0x3D, 0xD3, 0x49, 0x0B, 0x20, 0x41, 0x33, 0x9E,
+    0xF2, 0xBC, 0x7A, 0x6C, 0xC8, 0x3D, 0x53, 0x9C, 0x84, 0x8C, 0x48, 0x4A, 0x98, 0xD7, 0xC0, 0x5C,
+    0x2E, 0x50, 0x8B, 0x94, 0x22, 0xE3, 0x2A, 0x84, 0x57, 0xBA, 0x69, 0x21, 0x64, 0x05, 0x78, 0xC6,
+    0x74, 0xD2, 0x42, 0xC8, 0x09, 0xC1, 0x86, 0xF7, 0x4D, 0x24, 0x2C, 0x81, 0x05, 0x4F, 0x1C, 0x78,
+    0x83, 0xD3, 0x62, 0xAE, 0xF3, 0x6C, 0x22, 0x19, 0x0A, 0x74, 0x25, 0x4B, 0x6B, 0x9F, 0x19, 0x4E,
+    0xB6, 0xBE, 0x33, 0xA3, 0xD9, 0x88, 0xF9, 0xC0, 0xD8, 0x0B, 0x2B, 0x07, 0x00, 0x12, 0x68, 0x31,
+    0x69, 0x5B, 0xC3, 0x34, 0xC0, 0xBB, 0x40, 0x23, 0x02, 0x72, 0x23, 0x50, 0x00, 0x8C, 0x08, 0x78,
+    0x8B, 0x55, 0x4C, 0xC3, 0x8E, 0x00, 0x54, 0x05, 0xC7, 0x07, 0x00, 0x1E, 0x50, 0x08, 0x7B, 0x48,
+    0x30, 0x06, 0x80, 0x64, 0xA2, 0x60, 0xD0, 0x10, 0x4C, 0x96, 0xBC, 0xA8, 0x98, 0x34, 0x03, 0x35,
+    0xE3, 0x05, 0x34, 0x04, 0x13, 0x84, 0x69, 0xD7, 0x05, 0xE5, 0x50, 0x34, 0x30, 0x70, 0x50, 0x68,
+    0x08, 0x27, 0x28, 0x51, 0xAC, 0x8E, 0x08, 0x68, 0x08, 0x26, 0x2A, 0x1E, 0x59, 0x1C, 0x1A, 0x02,
+    0x08, 0x69, 0x70, 0x34, 0x04, 0x24, 0x1D, 0x0E, 0x26, 0x49, 0x54, 0xCB, 0x8C, 0x47, 0x1D, 0x8E,
+    0x99, 0x03, 0x40, 0x41, 0x30, 0x6A, 0xCA, 0x5C, 0x1A, 0x01, 0x06, 0x0D, 0x01, 0x09, 0x0D, 0x4B,
+    0x88, 0xE1, 0xD5, 0xE3, 0x01, 0x34, 0x03, 0x35, 0xE3, 0x09, 0xA9, 0xA0, 0x22, 0x29, 0xE7, 0x43,
+    0xAB, 0x50, 0xD8, 0xF7, 0x50, 0x46, 0xA2, 0x08, 0x35, 0xA0, 0x19, 0xE2, 0x08, 0x34, 0x04, 0x38,
+    0xCC, 0x23, 0x97, 0xF3, 0xCB, 0xFA, 0x33, 0x75, 0x8A, 0x88, 0x80, 0x95, 0xF2, 0xA8, 0xC9, 0x93,
+    0x22, 0x5A, 0x30, 0x1A, 0x01, 0x04, 0x0D, 0x00, 0x8D, 0x06, 0x80, 0x45, 0x03, 0x40, 0x2A, 0x4C,
+    0x0D, 0x01, 0x12, 0x48, 0x0C, 0xE9, 0x60, 0x00, 0x8C, 0x00, 0x80, 0xA2, 0xB0, 0x68, 0xAD, 0xF6,
+    0xA3, 0xF8, 0x04, 0x81, 0x04, 0xD4, 0x93, 0xC9, 0x30, 0x68, 0x50, 0x21, 0xC2, 0x28, 0x68, 0x08,
+    0x4A, 0x0C, 0xAB, 0x63, 0x55, 0xBA, 0xA5, 0x18, 0x71, 0x09, 0x65, 0x3F, 0xD8, 0x95, 0xCD, 0x0F,
+    0xFB, 0x73, 0xB2, 0xC8, 0xA3, 0x32, 0x41, 0x3A, 0x12, 0xE9, 0x82, 0x35, 0x9B, 0x80, 0xF4, 0xDF,
+    0x03, 0x10, 0x4E, 0xA8, 0x60, 0x0D, 0x00, 0xA9, 0x90, 0x47, 0x45, 0x00, 0x88, 0xD9, 0x50, 0x70,
+    0x58, 0x9A, 0xD9, 0x8F, 0x2A, 0x09, 0xF6, 0x1A, 0xC2, 0x57, 0xD6, 0x57, 0xCC, 0x89, 0xC3, 0xAE,
+    0x42, 0x48, 0x93, 0x82, 0x53, 0xA5, 0x8F, 0x94, 0xFF, 0xE8, 0xDA, 0x00, 0x7F, 0xF9, 0x7E, 0xFE,
+    0x01, 0x68, 0x03, 0x8F, 0xEB, 0x77, 0xFE, 0x47, 0xFF, 0xB9, 0x20, 0xB0, 0x35, 0x9D, 0xA8, 0x25,
+    0x6D, 0xD6, 0x00, 0x01, 0xA0, 0x25, 0xC8, 0xA1, 0x32, 0x5D, 0x19, 0x4E, 0x95, 0xBE, 0x80, 0x02,
+    0x30, 0x00, 0x02, 0x85, 0xA0, 0xFE, 0x18, 0x40, 0x00, 0x0F, 0xF3, 0x84, 0x00, 0xC0, 0x00, 0x00,
+    0x28, 0x56, 0x90, 0x00, 0x00, 0x00, 0x00, 0x50, 0xC0, 0x29, 0x50, 0x11, 0x4E, 0xF8, 0x46, 0x77,
+    0xD2, 0x30, 0x00, 0x00, 0x00, 0x48, 0x06, 0x19, 0x50, 0x0A, 0xFE, 0x09, 0x00, 0xCA, 0x80, 0x88,
+    0xC4, 0x84, 0xAF, 0xA8, 0x11, 0xCA, 0xCC, 0xB9, 0x4C, 0x5A, 0x18, 0x29, 0x4E, 0x80, 0x82, 0xA6,
+    0x42, 0xB6, 0x06, 0x80, 0x8E, 0x92, 0x06, 0x33, 0xB5, 0xF1, 0xA7, 0x08, 0xA0, 0x50, 0x00, 0x14,
+    0x21, 0x05, 0x0C, 0x1C, 0x14, 0x21, 0xD0, 0x10, 0x4C, 0x1C, 0x3A, 0xB8, 0x2E, 0x8B, 0x24, 0x28,
+    0x41, 0x1D, 0x00, 0x81, 0x82, 0x6C, 0x15, 0x94, 0x2E, 0x9A, 0x88, 0x78, 0x08, 0xE8, 0x08, 0xC9,
+    0x88, 0xCB, 0x3B, 0xE3, 0x45, 0x51, 0x41, 0x54, 0x00, 0x8C, 0x2A, 0xAE, 0x0A, 0x18, 0x47, 0x40,
+    0x26, 0x04, 0x2E, 0x02, 0x3A, 0x02, 0x0A, 0x70, 0x58, 0x42, 0x17, 0x44, 0x14, 0x64, 0x8C, 0x85,
+    0x94, 0xEF, 0xAA, 0x00, 0xA2, 0x80, 0x00, 0xA0, 0x00, 0x10, 0xA2, 0x60, 0x23, 0xA0, 0x20, 0x84,
+    0x97, 0x0A, 0x5C, 0x04, 0x74, 0x04, 0x64, 0xA8, 0x49, 0x63, 0xE1, 0x91, 0x42, 0xCC, 0x00, 0xF7,
+    0x2A, 0x80, 0x19, 0xE2, 0x08, 0x55, 0xA0, 0x15, 0xE1, 0x0C, 0x4F, 0xAD, 0x01, 0x04, 0xE2, 0x7A,
+    0x34, 0x08, 0x4F, 0xAD, 0x00, 0xA2, 0x0E, 0x9B, 0x04, 0x24, 0x20, 0x4F, 0x94, 0xB7, 0x49, 0x83,
+    0x40, 0x48, 0x49, 0xC2, 0x24, 0x25, 0x8E, 0x85, 0x85, 0x0A, 0x32, 0xA8, 0x00, 0x00, 0x55, 0x00,
+    0x00, 0x14, 0x41, 0x0D, 0xF5, 0xA0, 0x10, 0x42, 0x04, 0x4F, 0xAD, 0x01, 0x04, 0xC2, 0x0B, 0x08,
+    0x1D, 0x10, 0xA9, 0xCD, 0x50, 0xDC, 0x84, 0x9C, 0x28, 0x74, 0x67, 0x6B, 0xE8, 0x50, 0x00, 0x00,
+    0x43, 0x61, 0xA0, 0x08, 0x6C, 0x35, 0x02, 0x20, 0x9F, 0x5A, 0x02, 0x18, 0x63, 0x3B, 0xE8, 0x0A,
+    0x11, 0x3E, 0xB4, 0x04, 0xC7, 0x47, 0x61, 0x11, 0xD0, 0x95, 0x36, 0xB7, 0xCE, 0x80, 0x8B, 0x09,
+    0x44, 0x03, 0xFB, 0xCF, 0x81, 0x3A, 0x03, 0x88, 0x03, 0xF0, 0x0F, 0xC1, 0x87, 0x00, 0x00, 0x02,
+    0x30, 0x00, 0x14, 0x37, 0x09, 0xD4, 0x02, 0xD4, 0x79, 0xE7, 0xC1, 0x30, 0x6A, 0xC2, 0x5F, 0x44,
+    0xDA, 0x0F, 0x44, 0x1C, 0x13, 0x85, 0xE8, 0xD0, 0x61, 0x3B, 0x74, 0x02, 0x13, 0x3C, 0xF8, 0x52,
+    0x2B, 0xEB, 0x3A, 0xD7, 0x7F, 0xEA, 0x5C, 0xA7, 0x57, 0xC8, 0x4A, 0x38, 0x6B, 0x79, 0x61, 0x4A,
+    0x99, 0x03, 0x40, 0x47, 0x39, 0x06, 0x95, 0x4E, 0xD8, 0xCA, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x06, 0x1D, 0x5D, 0x40, 0x43, 0x09, 0x27, 0x6C, 0x01, 0x07, 0x57, 0x50, 0x11, 0x56, 0x50, 0xC6,
+    0x77, 0xD5, 0xA9, 0x00, 0x00, 0x00, 0x11, 0x80, 0x04, 0xB8, 0x61, 0x75, 0x01, 0x09, 0x05, 0x8D,
+    0xC0, 0x2E, 0xC4, 0xB8, 0x5D, 0x40, 0x49, 0x6A, 0x84, 0x63, 0xA1, 0x2E, 0xA5, 0xB2, 0x09, 0x40,
+    0x4A, 0x04, 0x6C, 0x0A, 0xA0, 0x28, 0x06, 0x7C, 0x14, 0xC1, 0x28, 0x00, 0x06, 0x3A, 0x64, 0x12,
+    0x28, 0x05, 0x3C, 0x83, 0x49, 0xD1, 0x40, 0x41, 0x5A, 0x4F, 0x48, 0x52, 0x5B, 0xAF, 0xCD, 0x82,
+    0x73, 0xA6, 0x2A, 0xA6, 0x5A, 0x68, 0x90, 0x9C, 0x13, 0xD7, 0xFA, 0xBA, 0xB9, 0x37, 0x55, 0x6D,
+    0x29, 0x42, 0x31, 0xD0, 0x95, 0xBE, 0x54, 0xAD, 0x80, 0x0B, 0xBC, 0x00, 0x23, 0x85, 0x51, 0x54,
+    0x28, 0x00, 0x05, 0x50, 0x01, 0x53, 0x20, 0xCE, 0x8A, 0x01, 0x12, 0x24, 0x92, 0x74, 0x50, 0x10,
+    0x56, 0x99, 0x5F, 0xE4, 0x96, 0x88, 0x08, 0xC8, 0x31, 0x56, 0xF9, 0x52, 0xA5, 0x00, 0x00, 0x08,
+    0x85, 0x00, 0x09, 0x21, 0x12, 0x74, 0x50, 0x0B, 0x2E, 0x67, 0x8B, 0x04, 0x25, 0xA1, 0x38, 0x2C,
+    0x92, 0x74, 0x50, 0x12, 0x56, 0x23, 0xA1, 0x4B, 0x6B, 0x9F, 0x5C, 0x80, 0x02, 0xCC, 0x3B, 0x87,
+    0x72, 0x6E, 0x1D, 0xC0, 0x8C, 0x52, 0x80, 0x05, 0x44, 0xC2, 0x4D, 0x01, 0x08, 0xE2, 0x43, 0x4F,
+    0x36, 0x40, 0xEE, 0xA2, 0x5D, 0x27, 0xA2, 0x31, 0x9A, 0xF1, 0xE9, 0xB4, 0xC2, 0x43, 0xD0, 0xD9,
+    0xAB, 0x25, 0x10, 0x41, 0xA0, 0x20, 0xA5, 0xA8, 0xAE, 0xC1, 0x33, 0x5E, 0xFA, 0xBC, 0x7A, 0xAC,
+    0x64, 0x1E, 0xE9, 0xC9, 0xA4, 0x9C, 0x22, 0x21, 0x4E, 0xA7, 0x4F, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x80, 0x00, 0x93, 0x0D, 0x09, 0xA0, 0x21, 0x98, 0x85, 0xBE, 0x1F, 0x00, 0x01, 0x26,
+    0x84, 0xD0, 0x09, 0xCC, 0xF2, 0xA2, 0x25, 0xEA, 0x5B, 0x5C, 0x32, 0x19, 0x27, 0xC6, 0x4A, 0xD1,
+    0x88, 0xF6, 0xB5, 0x34, 0x04, 0x13, 0xB5, 0xEA, 0x15, 0xE3, 0x0D, 0xA9, 0xA0, 0x10, 0x61, 0xB5,
+    0xA9, 0xA0, 0x23, 0xA4, 0x69, 0x52, 0xD8, 0xE7, 0xC1, 0x06, 0x24, 0x12, 0x20, 0xC4, 0x85, 0x14,
+    0x18, 0x6F, 0x6B, 0x53, 0x40, 0x2B, 0xC6, 0x23, 0x5A, 0x9A, 0x01, 0x38, 0x20, 0xDE, 0xD6, 0xA6,
+    0x80, 0x82, 0xA7, 0x8E, 0x59, 0x41, 0xE9, 0xBB, 0x46, 0x48, 0x44, 0x85, 0x35, 0xCF, 0x2D, 0x16,
+    0x8B, 0x45, 0xA7, 0x00, 0xB5, 0x5C, 0x30, 0xC2, 0xED, 0xD0, 0x0A, 0xE2, 0x06, 0xF7, 0x6E, 0x80,
+    0x84, 0xD7, 0x05, 0xF3, 0x85, 0x9D, 0x44, 0x13, 0x05, 0xEF, 0x20, 0xC2, 0xDD, 0x00, 0x84, 0xCF,
+    0x52, 0x72, 0x86, 0x11, 0x11, 0x09, 0x53, 0x1A, 0xF8, 0x46, 0x77, 0xD2, 0x08, 0x6B, 0x85, 0xA6,
+    0xB8, 0xB4, 0x6B, 0x8B, 0x46, 0xBB, 0xDA, 0x2D, 0x13, 0xC4, 0xF1, 0x3C, 0x4F, 0x20, 0x44, 0x18,
+    0x5D, 0xBA, 0x01, 0x1E, 0x21, 0x1E, 0xED, 0xD0, 0x10, 0x56, 0xF2, 0x5F, 0xD4, 0x20, 0x6E, 0xDD,
+    0x01, 0x05, 0x61, 0x1D, 0x8C, 0x41, 0xE8, 0xAD, 0x82, 0x80, 0xBE, 0x1B, 0x45, 0xDC, 0x75, 0x44,
+    0x64, 0x9D, 0xAF, 0x8D, 0x05, 0x14, 0x5D, 0x17, 0x45, 0x80, 0x14, 0x58, 0x00, 0x83, 0x10, 0x2E,
+    0xDD, 0x01, 0x0C, 0x24, 0x9D, 0xB0, 0x05, 0x18, 0x5D, 0xBA, 0x02, 0x42, 0xD2, 0x32, 0x14, 0xCC,
+    0x84, 0xF1, 0x6E, 0x01, 0x45, 0xB8, 0xB7, 0x00, 0x00, 0x00, 0x5B, 0x8B, 0x70, 0x84, 0x11, 0xEE,
+    0xDD, 0x01, 0x10, 0x23, 0x29, 0xA7, 0x80, 0x14, 0x8F, 0x76, 0xE8, 0x09, 0x8B, 0x11, 0x0A, 0x74,
+    0x29, 0xD1, 0x94, 0xEF, 0x9D, 0x03, 0x57, 0x26, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xD8, 0x52,
+    0x15, 0x11, 0xFC, 0x00, 0x03, 0xB2, 0x22, 0x08, 0x69, 0x70, 0x41, 0xA0, 0x20, 0xB8, 0xB2, 0x81,
+    0x4D, 0x64, 0x7D, 0x15, 0x50, 0x52, 0x54, 0x5D, 0x34, 0x5A, 0xC2, 0x7A, 0x4B, 0x2F, 0xEF, 0x97,
+    0xF3, 0xD0, 0xDC, 0x6A, 0x76, 0xB0, 0x9E, 0x82, 0xCB, 0xF9, 0x15, 0xF7, 0x54, 0xBE, 0xAB, 0x3E,
+    0x23, 0xCA, 0x14, 0x4A, 0xB7, 0x6B, 0xBF, 0x2B, 0xDE, 0x12, 0xBB, 0xF3, 0x04, 0xC2, 0x92, 0x00,
+    0xD0, 0x08, 0x7D, 0x51, 0x44, 0xB4, 0x84, 0x45, 0x3A, 0x9D, 0x19, 0x4E, 0x97, 0xC9, 0x88, 0x00,
+    0x62, 0x31, 0x18, 0x80, 0x02, 0x30, 0x00, 0xE9, 0x10, 0x62, 0x4B, 0x86, 0x80, 0xD0, 0x09, 0x4C,
+    0xF3, 0xD2, 0x42, 0x51, 0x01, 0xA0, 0x20, 0x86, 0x97, 0x68, 0x81, 0x86, 0x60, 0x96, 0x33, 0x7C,
+    0x00, 0x04, 0xBA, 0x03, 0x40, 0x27, 0x33, 0xCA, 0x8C, 0x92, 0x14, 0xC7, 0x95, 0x2E, 0x5A, 0x4D,
+    0x0A, 0x1A, 0x09, 0xA0, 0x02, 0xC8, 0xE1, 0x94, 0x34, 0x02, 0xCB, 0x82, 0x1E, 0x45, 0x0D, 0x01,
+    0x05, 0x67, 0x95, 0x6B, 0x0E, 0x45, 0x0D, 0x01, 0x04, 0xF2, 0x3C, 0x44, 0x3E, 0x99, 0xF4, 0x54,
+    0x94, 0xE8, 0x95, 0x2C, 0x42, 0x14, 0x64, 0x00, 0x10, 0xF4, 0x38, 0x92, 0x28, 0x68, 0x04, 0xE6,
+    0xAB, 0x36, 0x20, 0x44, 0x64, 0x52, 0xC0, 0x29, 0xE4, 0x50, 0xD0, 0x14, 0x1E, 0xA0, 0x8C, 0x85,
+    0x32, 0x58, 0xF8, 0xCA, 0x95, 0xBE, 0x33, 0xA0, 0x9A, 0x35, 0x4D, 0x40, 0x72, 0x82, 0xED, 0x01,
+    0x44, 0x01, 0x70, 0x01, 0x18, 0x21, 0x00, 0x07, 0xE1, 0x99, 0x00, 0x3F, 0x03, 0xD9, 0x02, 0x88,
+    0x06, 0xCC, 0x00, 0x00, 0x03, 0xF5, 0xAA, 0x82, 0x9D, 0x00, 0xAF, 0x6E, 0x79, 0xEA, 0x16, 0x68,
+    0xB2, 0x6A, 0xAB, 0x9A, 0x24, 0x15, 0x26, 0xDF, 0x7A, 0x22, 0x0B, 0xE4, 0x9B, 0xCB, 0x4A, 0x93,
+    0x69, 0x94, 0xC2, 0x43, 0xE5, 0x5B, 0x71, 0xA4, 0x6E, 0xAB, 0x91, 0x15, 0xAA, 0xCA, 0x86, 0x90,
+    0x96, 0x55, 0x0D, 0x52, 0x35, 0x68, 0xCD, 0x53, 0xAA, 0x0B, 0x54, 0xB7, 0x11, 0x41, 0x2B, 0xE5,
+    0x5E, 0x67, 0x10, 0xB1, 0xF2, 0xAD, 0x36, 0xF8, 0x87, 0x52, 0xD8, 0xD8, 0x00, 0x00, 0xFD, 0x1A,
+    0x34, 0x37, 0xCE, 0x80, 0x56, 0xF3, 0x3C, 0xA8, 0x46, 0x52, 0xDC, 0xFB, 0xE2, 0x35, 0xF3, 0xA0,
+    0x13, 0x99, 0xE5, 0x46, 0x59, 0xC4, 0x44, 0x3A, 0xB7, 0x07, 0xE0, 0x8C, 0x00, 0x00, 0x0B, 0x98,
+    0x00, 0x10, 0x41, 0x96, 0x74, 0x02, 0x8B, 0x99, 0xE5, 0x42, 0x09, 0xD1, 0x60, 0x41, 0x16, 0x74,
+    0x04, 0x65, 0xA1, 0x2A, 0x5B, 0x6B, 0x90, 0x00, 0x08, 0xC0, 0x00, 0x00, 0x9C, 0x00, 0x01, 0x14,
+    0x1D, 0x67, 0x40, 0x44, 0x42, 0x14, 0xB6, 0xD6, 0x84, 0x00, 0x00, 0x00, 0x45, 0x56, 0x74, 0x04,
+    0xB7, 0xAC, 0x25, 0x43, 0x1F, 0x19, 0x4E, 0xB7, 0xD7, 0xBC, 0x19, 0xFE, 0xD4, 0x32, 0xC0, 0x2A,
+    0x00, 0x23, 0x00, 0x01, 0xEC, 0x24, 0x00, 0x07, 0xB6, 0xC0, 0x00, 0x00, 0x00, 0x11, 0x81, 0x86,
+    0x74, 0x04, 0x16, 0x31, 0xB4, 0x17, 0xA2, 0xD6, 0x09, 0x96, 0xF7, 0xC4, 0x60, 0x67, 0x40, 0x27,
+    0x33, 0xCA, 0x8C, 0x92, 0x99, 0x2B, 0x7D, 0x2A, 0x28, 0x54, 0x95, 0x40, 0x00, 0x00, 0x02, 0xA4,
+    0xC1, 0xCA, 0x74, 0x02, 0x24, 0x43, 0x26, 0x53, 0xA0, 0x20, 0x98, 0xC9, 0x7C, 0x34, 0xCA, 0x74,
+    0x02, 0x1B, 0x4D, 0x96, 0x42, 0x56, 0x32, 0x18, 0xEF, 0x95, 0x6D, 0x07, 0x83, 0x8A, 0x20, 0xE0,
+    0x08, 0x38, 0x02, 0x0E, 0x86, 0x11, 0x32, 0x9D, 0x01, 0x10, 0xE3, 0x21, 0xE5, 0x64, 0x80, 0x00,
+    0x00, 0x14, 0xC9, 0x94, 0xE8, 0x04, 0xE6, 0x78, 0xB5, 0xDF, 0x6D, 0x84, 0x43, 0x21, 0x4C, 0x74,
+    0x25, 0x4B, 0x63, 0x5C, 0xF8, 0x4A, 0x74, 0xAD, 0xF2, 0x00, 0xA0, 0x0C, 0xA0, 0x26, 0x30, 0xB0,
+    0x87, 0x07, 0x9F, 0x97, 0x08, 0x49, 0x15, 0x56, 0x56, 0x1C, 0x96, 0x30, 0x09, 0x00, 0x6E, 0x08,
+    0x25, 0x42, 0x41, 0x25, 0x3C, 0x1F, 0xF0, 0x03, 0xA1, 0x9F, 0x41, 0x86, 0x65, 0x4A, 0x60, 0x16,
+    0x46, 0x9E, 0x86, 0xA9, 0x74, 0xCC, 0x22, 0x04, 0x60, 0x7A, 0x05, 0x14, 0x4E, 0x01, 0x30, 0x3D,
+    0x1E, 0x20, 0xA7, 0x37, 0xD7, 0xF5, 0x82, 0x64, 0x2D, 0xE6, 0x3A, 0x50, 0x08, 0x18, 0x61, 0x10,
+    0x20, 0x82, 0x76, 0x3D, 0xBB, 0x95, 0x0E, 0xE0, 0xA8, 0x2B, 0x20, 0x08, 0x26, 0x9B, 0x19, 0x56,
+    0x04, 0x10, 0x31, 0x51, 0xC0, 0xA0, 0x08, 0x71, 0xB8, 0xCF, 0x50, 0x02, 0x0C, 0xEF, 0xFC, 0x00,
+    0x3C, 0xCF, 0x72, 0xC1, 0x03, 0x50, 0x61, 0x01, 0x80, 0x74, 0xB8, 0x28, 0x61, 0x95, 0xA0, 0x30,
+    0x11, 0x16, 0x70, 0xA1, 0x2E, 0x03, 0xD7, 0xE0, 0x23, 0x06, 0xE6, 0x73, 0xD8, 0x08, 0x1C, 0x4F,
+    0x94, 0x00, 0x60, 0x1E, 0x73, 0x7C, 0x00, 0x60, 0x20, 0x98, 0xB7, 0x65, 0x6C, 0x50, 0x40, 0xAF,
+    0x20, 0x20, 0x84, 0x86, 0x0D, 0xEA, 0x03, 0xCC, 0xC2, 0xDC, 0x10, 0x3B, 0xD8, 0xCE, 0x08, 0xF7,
+    0xAC, 0x10, 0x4F, 0x57, 0xB2, 0x63, 0x4B, 0x82, 0x9A, 0xA3, 0x58, 0x10, 0x70, 0x43, 0x3B, 0x13,
+    0x82, 0x8D, 0xE3, 0x58, 0x21, 0x29, 0xE5, 0x70, 0x65, 0x38, 0xBC, 0x8A, 0x6E, 0x09, 0x27, 0xB4,
+    0x10, 0x91, 0x24, 0x65, 0x10, 0x8D, 0x51, 0x40, 0xCA, 0xD0, 0x32, 0x29, 0xCC, 0xF2, 0x9A, 0x92,
+    0xE0, 0xB4, 0x41, 0x5A, 0x08, 0x69, 0x2A, 0x5F, 0x34, 0xD9, 0x40, 0x50, 0xCE, 0x4C, 0xC2, 0x19,
+    0x40, 0xE9, 0x98, 0x44, 0x10, 0xC1, 0x06, 0x49, 0x9C, 0xCD, 0xA4, 0xD3, 0x08, 0x82, 0x18, 0x16,
+    0x61, 0x83, 0x27, 0x5A, 0x69, 0x00, 0xE5, 0x34, 0x85, 0xC5, 0x48, 0xCA, 0x86, 0x4A, 0x82, 0x81,
+    0x43, 0x60, 0xA0, 0x81, 0x70, 0xE0, 0xBC, 0x06, 0x80, 0x79, 0x16, 0xDC, 0x0B, 0x20, 0x72, 0x88,
+    0xBC, 0xE5, 0x60, 0xCE, 0x24, 0xE0, 0x99, 0xF2, 0x65, 0x5B, 0xC0, 0x40, 0xA9, 0x30, 0x20, 0x82,
+    0x77, 0xB1, 0x43, 0x39, 0xFC, 0x0D, 0x99, 0x03, 0x16, 0x5C, 0xE5, 0x61, 0x32, 0xC5, 0x81, 0x48,
+    0x74, 0xB2, 0x40, 0x08, 0xDF, 0x3E, 0x32, 0x85, 0xA0, 0x04, 0x60, 0x22, 0xEC, 0x47, 0x54, 0x19,
+    0x01, 0xAA, 0xFB, 0x82, 0x40, 0x43, 0x41, 0x58, 0xE7, 0x99, 0x28, 0x0C, 0xA9, 0x5C, 0x08, 0x15,
+    0xE7, 0x04, 0x0D, 0x27, 0xDC, 0x10, 0x41, 0x32, 0x6A, 0xA2, 0x18, 0x10, 0x2B, 0xE6, 0x08, 0x20,
+    0x98, 0x25, 0x65, 0x4B, 0x90, 0x41, 0x0D, 0x16, 0x22, 0x28, 0x28, 0x8C, 0x5A, 0x8F, 0x04, 0x0A,
+    0xEA, 0x82, 0x05, 0x30, 0x41, 0x03, 0x51, 0xFC, 0x04, 0x11, 0x5B, 0x44, 0x25, 0xCF, 0xAD, 0x65,
+    0x80, 0x96, 0x0D, 0x30, 0x11, 0x81, 0xDD, 0xC2, 0x59, 0x1C, 0x10, 0x3B, 0x1E, 0x53, 0x81, 0x90,
+    0x33, 0x8A, 0x2E, 0x57, 0xAB, 0x32, 0x3E, 0x09, 0x85, 0x26, 0x50, 0x20, 0xD0, 0x0A, 0x8A, 0x00,
+    0x80, 0x41, 0x3B, 0xD2, 0xB5, 0x92, 0xCE, 0x08, 0xF7, 0x1C, 0x10, 0xD1, 0x72, 0x1E, 0x45, 0x09,
+    0xEE, 0xCA, 0x51, 0x08, 0x97, 0x1C, 0x0A, 0x2E, 0x72, 0xBE, 0xA0, 0x95, 0xFC, 0xE5, 0x7E, 0x61,
+    0xC1, 0x31, 0x48, 0xF2, 0x8B, 0x9A, 0x6B, 0xC9, 0xCE, 0x57, 0xC0, 0xA4, 0x44, 0xCC, 0xAF, 0x84,
+    0x94, 0x06, 0x90, 0xF1, 0x05, 0x92, 0x8A, 0x02, 0x06, 0x7B, 0x96, 0x15, 0xC0, 0xE5, 0x45, 0x38,
+    0x09, 0x40, 0xEE, 0x5B, 0x38, 0x2A, 0xDC, 0xFB, 0x82, 0x32, 0x4C, 0x55, 0xB6, 0x54, 0xB0, 0x65,
+    0x00, 0xFA, 0x2A, 0x8D, 0xD8, 0x8A, 0x96, 0x02, 0x06, 0x92, 0x28, 0x08, 0x18, 0x34, 0x98, 0x20,
+    0x42, 0xC1, 0x0A, 0x2E, 0x04, 0x10, 0x4C, 0x14, 0xA8, 0x8D, 0x04, 0x08, 0xC0, 0x41, 0x04, 0xE1,
+    0x7C, 0xF5, 0x47, 0x01, 0x04, 0x23, 0x85, 0x2F, 0x28, 0xA1, 0x0E, 0x08, 0x12, 0x80, 0x82, 0x08,
+    0x51, 0x30, 0x20, 0x88, 0xA4, 0x32, 0x13, 0xA0, 0x96, 0x11, 0x9F, 0xED, 0xEB, 0x53, 0x30, 0x01,
+    0xC0, 0x7A, 0x39, 0x3C, 0x09, 0xE0, 0x84, 0x84, 0xB2, 0x88, 0x23, 0xCB, 0x49, 0x82, 0xC0, 0x33,
+    0x93, 0xC0, 0x9E, 0x04, 0x4C, 0x12, 0xDE, 0x8B, 0x04, 0x0B, 0x3E, 0x02, 0x08, 0x47, 0x2B, 0x1E,
+    0xA0, 0x03, 0x30, 0x3C, 0x0E, 0x6F, 0x04, 0x13, 0x86, 0xEA, 0x12, 0x62, 0x85, 0x93, 0x78, 0x14,
+    0x3C, 0x11, 0x93, 0x78, 0x20, 0x9C, 0xEE, 0x50, 0xCE, 0x4F, 0x03, 0xA3, 0xC1, 0x04, 0xEF, 0x4A,
+    0x34, 0x48, 0x8E, 0xA3, 0xC1, 0x04, 0x2B, 0x79, 0x38, 0x2A, 0x5D, 0x47, 0x82, 0x3C, 0x9A, 0x35,
+    0xB9, 0xF2, 0x9D, 0x25, 0x93, 0x30, 0x04, 0x58, 0x00, 0x83, 0x00, 0x2F, 0x80, 0x02, 0x30, 0x01,
+    0x4A, 0x7E, 0x8F, 0x66, 0xBC, 0x60, 0x50, 0x0E, 0x54, 0x53, 0x9C, 0x25, 0x29, 0x5F, 0x2C, 0x0B,
+    0x90, 0x20, 0x4C, 0x0F, 0x27, 0x99, 0x2C, 0xC0, 0x8C, 0x00, 0x82, 0x09, 0xA7, 0x47, 0x99, 0x81,
+    0xE0, 0x20, 0x67, 0x27, 0x80, 0x82, 0x1B, 0x1E, 0x37, 0x48, 0x0C, 0xA2, 0xD0, 0x06, 0x55, 0xEC,
+    0x04, 0x0A, 0xFB, 0x82, 0x08, 0x6D, 0x0A, 0x5F, 0x50, 0x0A, 0x00, 0xA2, 0x8C, 0x48, 0x20, 0x40,
+    0x84, 0x04, 0x08, 0x30, 0x41, 0x15, 0xD9, 0x19, 0xD0, 0xEA, 0x01, 0xBA, 0x01, 0x1D, 0x56, 0xA0,
+    0x38, 0x03, 0x1E, 0xF2, 0x2D, 0xB8, 0x08, 0x20, 0xA9, 0x2E, 0xA6, 0x19, 0xC8, 0xE0, 0x89, 0x3A,
+    0x01, 0x05, 0xC5, 0xBD, 0x99, 0x90, 0x4D, 0x64, 0x28, 0x85, 0x04, 0x0B, 0x4E, 0x02, 0x08, 0x27,
+    0x9D, 0x51, 0xAD, 0x5A, 0x18, 0xD0, 0x08, 0x27, 0x2C, 0xD4, 0x2C, 0xF8, 0x25, 0x46, 0x80, 0x28,
+    0x78, 0x2C, 0xEA, 0x34, 0x02, 0x1A, 0x18, 0x97, 0xC9, 0x11, 0xD8, 0x8D, 0x5E, 0x20, 0xE8, 0x80,
+    0x33, 0xC5, 0xCC, 0xF2, 0x9A, 0xE1, 0xE0, 0xB7, 0x4D, 0x10, 0x06, 0x13, 0xB8, 0x28, 0x9F, 0x44,
+    0x02, 0x4A, 0x89, 0xB0, 0x95, 0x2E, 0x7C, 0xAB, 0x93, 0x40, 0x23, 0x71, 0x07, 0x34, 0x44, 0x23,
+    0x57, 0x84, 0xB2, 0x81, 0xD9, 0x57, 0xDC, 0x10, 0x3A, 0x51, 0x4E, 0x05, 0x30, 0x38, 0x46, 0x51,
+    0x00, 0x50, 0x3E, 0x51, 0x4E, 0x06, 0x99, 0x81, 0xC2, 0xC0, 0xF3, 0x8C, 0xC9, 0xF1, 0xE8, 0x14,
+    0x70, 0x5A, 0x20, 0x34, 0xDC, 0xC1, 0x06, 0x29, 0xAD, 0x51, 0xED, 0x51, 0x4E, 0x32, 0x3C, 0x55,
+    0x09, 0x60, 0x9E, 0x88, 0x48, 0x2E, 0x4A, 0x19, 0x4C, 0x09, 0xCC, 0xF1, 0x63, 0x25, 0x24, 0x63,
+    0x9F, 0x09, 0x11, 0x88, 0xC8, 0xF3, 0x38, 0x8C, 0x46, 0xC8, 0xA7, 0x02, 0x98, 0x15, 0xE4, 0x0C,
+    0xB3, 0x03, 0x3C, 0x9C, 0xCF, 0x29, 0x52, 0x41, 0x1E, 0x59, 0x81, 0xDE, 0x88, 0x11, 0x82, 0x5E,
+    0x12, 0x82, 0x84, 0x90, 0x43, 0xDC, 0x59, 0x82, 0x32, 0xD8, 0x54, 0xAD, 0xD2, 0x99, 0x74, 0x21,
+    0xA0, 0x8D, 0x50, 0x04, 0xE1, 0x54, 0xCF, 0x79, 0xC2, 0x20, 0x1A, 0x4F, 0xBF, 0x1B, 0x5D, 0x42,
+    0x16, 0x09, 0x8B, 0x36, 0x51, 0xC1, 0x10, 0x0B, 0x5E, 0x04, 0x40, 0x41, 0x39, 0x64, 0x8D, 0x91,
+    0x4E, 0x02, 0x50, 0x38, 0x4B, 0x9E, 0x02, 0x08, 0x26, 0x98, 0x5E, 0x50, 0x88, 0x11, 0x81, 0xA7,
+    0x3E, 0x08, 0x14, 0x90, 0x11, 0x1A, 0xB2, 0x99, 0xB2, 0x03, 0x8C, 0x0B, 0xC0, 0x6E, 0x01, 0x95,
+    0x0D, 0x01, 0x03, 0x15, 0x1C, 0x04, 0x08, 0xF8, 0x41, 0x1A, 0x26, 0x27, 0x01, 0x04, 0x13, 0x49,
+    0xCC, 0xAA, 0x28, 0x08, 0x15, 0x1C, 0x15, 0xC5, 0x29, 0x01, 0x09, 0x2F, 0x4D, 0x45, 0x6C, 0x56,
+    0x90, 0x79, 0xC6, 0xA8, 0x8D, 0x04, 0xEB, 0x7A, 0x85, 0x37, 0x04, 0x4B, 0x88, 0x08, 0x26, 0x34,
+    0xD8, 0x4E, 0x68, 0xB2, 0x4E, 0x71, 0xBA, 0xD5, 0x41, 0x8B, 0xE5, 0x72, 0x94, 0x83, 0x1A, 0x12,
+    0xF1, 0x12, 0xA1, 0xE7, 0x1B, 0xC7, 0x74, 0x99, 0x40, 0x44, 0x4A, 0xD8, 0xE7, 0xD2, 0xA0, 0x08,
+    0x07, 0xF6, 0x7A, 0x00, 0x11, 0x80, 0x32, 0x60, 0x15, 0xAC, 0xBC, 0x46, 0x01, 0x00, 0x80, 0x0A,
+    0x80, 0x04, 0xD3, 0x3C, 0xB0, 0x00, 0xA0, 0x76, 0x52, 0x7C, 0xE5, 0x7D, 0xDE, 0x41, 0x95, 0x1D,
+    0x7B, 0x12, 0xAA, 0x58, 0x01, 0x41, 0x04, 0xCF, 0x73, 0xCA, 0x89, 0x80, 0x40, 0x32, 0x6D, 0xCE,
+    0x57, 0xA9, 0x44, 0x13, 0x85, 0x2C, 0x1E, 0xCF, 0x94, 0x38, 0xC1, 0x6D, 0x5E, 0x73, 0x7F, 0x06,
+    0x83, 0xE7, 0x34, 0x89, 0x80, 0x84, 0xE1, 0xBA, 0x55, 0x23, 0xE3, 0x59, 0x05, 0xA1, 0x7C, 0x84,
+    0x76, 0xC7, 0x56, 0x1B, 0x68, 0x84, 0xCC, 0x03, 0x20, 0x41, 0x84, 0xAA, 0xB9, 0x20, 0x81, 0xE7,
+    0x30, 0xF0, 0x02, 0x81, 0xA9, 0x3E, 0x72, 0xBD, 0xAA, 0xE1, 0xA0, 0x25, 0x4B, 0xD2, 0x9D, 0xC8,
+    0xD8, 0xB2, 0xE0, 0x19, 0x02, 0xD2, 0x7C, 0xAF, 0x8D, 0x95, 0xB8, 0x45, 0xB9, 0x58, 0xC0, 0x25,
+    0x20, 0xCA, 0x61, 0xBE, 0xB3, 0x14, 0x3C, 0x1A, 0x74, 0x4B, 0x18, 0x09, 0x2B, 0x90, 0x48, 0x54,
+    0x25, 0xAF, 0xAD, 0xD5, 0x38, 0xFD, 0x6E, 0x08, 0x00, 0xAF, 0x0A, 0x50, 0xD2, 0x08, 0xC2, 0x33,
+    0x16, 0xC5, 0x09, 0xC0, 0x67, 0xC8, 0x20, 0x10, 0x0C, 0x54, 0x50, 0x27, 0x01, 0xD1, 0x44, 0x40,
+    0x5C, 0xD1, 0x0F, 0x70, 0x20, 0x98, 0x2F, 0x79, 0x51, 0x40, 0x9C, 0x06, 0x91, 0xB8, 0x08, 0x10,
+    0xB0, 0x4C, 0x8B, 0x3C, 0xB4, 0xE0, 0x4E, 0x02, 0x97, 0x81, 0x38, 0x10, 0x91, 0x24, 0x31, 0x18,
+    0x79, 0x6A, 0x40, 0x0E, 0x07, 0x2C, 0xC2, 0x20, 0x0A, 0x07, 0xA1, 0x5A, 0xF4, 0x98, 0x07, 0x04,
+    0x24, 0x1C, 0x74, 0x19, 0x44, 0x54, 0xA0, 0x10, 0x25, 0x60, 0x85, 0xB3, 0x02, 0x08, 0x2E, 0x4B,
+    0xEC, 0xDB, 0x4B, 0x82, 0x08, 0x27, 0x12, 0x14, 0x32, 0x29, 0xC0, 0xC2, 0xE0, 0x41, 0x3E, 0x68,
+    0xA1, 0x69, 0xC1, 0x10, 0x17, 0x02, 0x08, 0x65, 0x92, 0x70, 0x5A, 0x20, 0x2E, 0x04, 0x14, 0x4A,
+    0xCA, 0xD0, 0x4C, 0x54, 0x3C, 0x82, 0x0C, 0xAE, 0x02, 0xD3, 0x99, 0xE7, 0xC1, 0x3C, 0x8A, 0x8D,
+    0x0A, 0x25, 0x8A, 0xE0, 0x41, 0x31, 0x24, 0xF8, 0xA5, 0xB1, 0x5C, 0x04, 0xE6, 0x79, 0x52, 0xDD,
+    0x40, 0x8C, 0xA7, 0x4B, 0x9F, 0x29, 0xD7, 0x22, 0x14, 0x80, 0x9A, 0x09, 0xC0, 0x12, 0x40, 0xF6,
+    0x01, 0xB0, 0x00, 0xF0, 0x6A, 0xE2, 0xC5, 0x85, 0xA3, 0x56, 0x13, 0x48, 0x30, 0x04, 0x0F, 0x51,
+    0x07, 0x9C, 0x2B, 0x9D, 0x9C, 0x38, 0x2C, 0x93, 0x83, 0x17, 0x01, 0x1D, 0x00, 0x8E, 0x82, 0xE0,
+    0xBE, 0x34, 0x74, 0xB8, 0x54, 0x02, 0x86, 0xF0, 0x4D, 0x30, 0xBE, 0x2D, 0xC2, 0xEA, 0x01, 0x39,
+    0x9E, 0x54, 0x28, 0xCC, 0x92, 0xBB, 0x95, 0x80, 0x08, 0xD9, 0xED, 0xE0, 0x54, 0x04, 0x13, 0x05,
+    0x2C, 0xA4, 0x02, 0xA0, 0x10, 0xDB, 0xE4, 0x3C, 0xC2, 0x41, 0x50, 0xD4, 0x82, 0x36, 0x45, 0x38,
+    0x0C, 0x80, 0xAF, 0x1F, 0x09, 0xF1, 0x48, 0x27, 0xBC, 0xD4, 0x2C, 0xF8, 0x22, 0x13, 0x40, 0x28,
+    0x78, 0x2C, 0xD0, 0x9A, 0x02, 0x14, 0x1E, 0xC6, 0xD5, 0xD4, 0xDB, 0x2E, 0xC1, 0x81, 0xED, 0x59,
+    0x4E, 0xA1, 0xE7, 0x0A, 0xC8, 0xB8, 0x28, 0x09, 0x53, 0xA0, 0x98, 0xA8, 0x51, 0x32, 0x08, 0x16,
+    0x9C, 0x0A, 0x80, 0x86, 0xF4, 0x12, 0x96, 0xB6, 0x2D, 0x6C, 0xBE, 0xCF, 0xE2, 0xD1, 0xE0, 0x82,
+    0x2C, 0x26, 0x32, 0xA2, 0x57, 0xA6, 0xE1, 0x00, 0x6A, 0x00, 0xA0, 0x00, 0x46, 0x00, 0x1E, 0x57,
+    0xB4, 0x2A, 0x01, 0x91, 0x4E, 0x06, 0x1A, 0x01, 0x4A, 0x7D, 0xF0, 0xDC, 0xD2, 0x50, 0x42, 0x23,
+    0x37, 0xC3, 0x9F, 0x4A, 0x41, 0x09, 0xF2, 0x4E, 0x0B, 0x44, 0x06, 0x80, 0x8E, 0xA8, 0x04, 0x85,
+    0x7C, 0xA7, 0x72, 0x14, 0xCB, 0x54, 0xC4, 0x64, 0x7C, 0x23, 0x00, 0x15, 0xED, 0x0E, 0x74, 0x03,
+    0x05, 0x9C, 0x0A, 0x80, 0x82, 0x14, 0xB8, 0xAD, 0xE0, 0x8F, 0x9D, 0x01, 0x05, 0x78, 0x44, 0xFA,
+    0x52, 0xF3, 0x85, 0x1C, 0x0C, 0x13, 0x14, 0x2C, 0xA0, 0xB4, 0xC3, 0x95, 0x9C, 0xD5, 0x77, 0xC1,
+    0x79, 0x6B, 0x2C, 0x07, 0x44, 0xA4, 0x57, 0x84, 0x49, 0x7C, 0xAC, 0x01, 0x86, 0x4F, 0x18, 0x01,
+    0xA0, 0x11, 0xC0, 0x0E, 0x51, 0x9A, 0xA2, 0xC5, 0x6F, 0x35, 0x41, 0xAA, 0x2E, 0x08, 0x59, 0xD0,
+    0x0A, 0xEE, 0x0A, 0x22, 0xCE, 0x80, 0x82, 0x73, 0xA5, 0x02, 0x73, 0x85, 0xD7, 0x02, 0x1B, 0x5D,
+    0x60, 0x90, 0xCD, 0x84, 0x64, 0x2B, 0xE5, 0x4A, 0x92, 0x18, 0x14, 0x04, 0xAA, 0x4A, 0x82, 0x80,
+    0xD4, 0x19, 0x58, 0x80, 0x3D, 0x5F, 0x9E, 0x00, 0x50, 0x3B, 0x93, 0x3E, 0x02, 0x50, 0x41, 0x89,
+    0x8B, 0x74, 0x16, 0x52, 0x88, 0x02, 0x82, 0x09, 0xCA, 0x84, 0x6D, 0x67, 0xF0, 0x29, 0x01, 0xA8,
+    0xFE, 0x71, 0xBB, 0xC7, 0x42, 0x8C, 0xCA, 0xFB, 0x9A, 0x80, 0x00, 0x8D, 0x82, 0x56, 0x80, 0x50,
+    0x26, 0x60, 0x85, 0x14, 0x27, 0x05, 0xCB, 0xEB, 0x20, 0x21, 0x61, 0xBD, 0x04, 0xA5, 0xA9, 0xEE,
+    0x53, 0xF5, 0xA7, 0x91, 0x04, 0xD7, 0xA2, 0x00, 0x94, 0x09, 0xC0, 0x4A, 0x08, 0x48, 0x79, 0x6E,
+    0x50, 0xAA, 0xE2, 0xC9, 0x56, 0x01, 0x00, 0xC8, 0xCF, 0x04, 0x28, 0x64, 0x08, 0x27, 0x2B, 0x51,
+    0xAE, 0x78, 0x18, 0x64, 0x07, 0x92, 0x4D, 0xC0, 0x0A, 0x08, 0xA9, 0x70, 0x46, 0x89, 0x4C, 0xDC,
+    0x32, 0x28, 0x06, 0x56, 0x0A, 0x1B, 0x82, 0x05, 0x0C, 0x01, 0x03, 0x07, 0x05, 0x04, 0x0C, 0x74,
+    0xC8, 0x10, 0x41, 0x75, 0x11, 0x7E, 0xDA, 0xCF, 0x80, 0x94, 0x10, 0xDE, 0x12, 0xBE, 0x57, 0x12,
+    0xEB, 0x13, 0xCE, 0xBF, 0xDF, 0x58, 0x96, 0x64, 0x18, 0x21, 0x90, 0xA6, 0x42, 0x5B, 0x29, 0xD2,
+    0xC0, 0x03, 0xC0, 0x1B, 0x40, 0x26, 0x60, 0x0E, 0x90, 0xC6, 0x00, 0x7D, 0x20, 0x09, 0x20, 0x13,
+    0xFC, 0x8A, 0x50, 0xC6, 0x00, 0x5B, 0x20, 0x3A, 0xEC, 0x94, 0x5C, 0x10, 0x35, 0x1F, 0xCE, 0x37,
+    0xC0, 0x46, 0x45, 0x39, 0xC6, 0xDE, 0xD0, 0xD6, 0x77, 0x38, 0xDE, 0xA4, 0xE0, 0xBC, 0x2F, 0xAC,
+    0x89, 0xBE, 0xA5, 0x8A, 0x3A, 0x09, 0x93, 0x55, 0x12, 0x60, 0x81, 0x39, 0xC2, 0x14, 0x2E, 0x12,
+    0x04, 0x97, 0x25, 0x12, 0xAD, 0x79, 0xC2, 0x1D, 0xF1, 0x53, 0xCE, 0x10, 0xF2, 0x6F, 0x37, 0x8F,
+    0x9C, 0x22, 0x45, 0xA1, 0xA4, 0x45, 0x73, 0xD0, 0x62, 0x32, 0x22, 0x3C, 0x4B, 0x16, 0x40, 0x42,
+    0xF1, 0xBC, 0xA9, 0x41, 0x0A, 0x60, 0x4E, 0x0A, 0xFB, 0x16, 0x40, 0x82, 0x11, 0x48, 0xAE, 0xE0,
+    0xA5, 0xB1, 0x64, 0x08, 0x70, 0x79, 0x25, 0x48, 0x12, 0x80, 0x05, 0xD0, 0x02, 0x65, 0x70, 0x78,
+    0xD8, 0x2E, 0x94, 0xBC, 0x14, 0x45, 0xA5, 0x0B, 0x20, 0x41, 0x38, 0x4A, 0x81, 0x39, 0xC2, 0x02,
+    0x5D, 0x45, 0xCE, 0x37, 0xF6, 0xF8, 0x27, 0x7D, 0x15, 0xB3, 0x83, 0xCE, 0x37, 0x88, 0x98, 0x51,
+    0x93, 0x1F, 0x7A, 0x2C, 0x00, 0x16, 0xAB, 0xF8, 0x2D, 0x10, 0x59, 0x02, 0x09, 0xD2, 0xD5, 0xA9,
+    0xC1, 0x9F, 0x44, 0x16, 0x40, 0x50, 0xF3, 0x8D, 0xEA, 0xF2, 0x7B, 0x5C, 0x32, 0x14, 0xC8, 0x5B,
+    0x1B, 0x29, 0xD2, 0xD7, 0xC6, 0x41, 0x40, 0xAA, 0x52, 0x89, 0x05, 0x74, 0x04, 0x63, 0xF2, 0x44,
+    0x73, 0x3D, 0xDF, 0xEA, 0x0D, 0xC3, 0x41, 0x0B, 0x7C, 0x42, 0xC0, 0x73, 0x02, 0x5B, 0x35, 0xE3,
+    0x08, 0xA0, 0x7A, 0x3D, 0xC1, 0x02, 0x40, 0x60, 0xD2, 0x61, 0x50, 0xA0, 0x77, 0xA2, 0x9C, 0x0A,
+    0x65, 0x03, 0xB9, 0x25, 0xE0, 0xB3, 0x4B, 0x86, 0x50, 0x41, 0x3A, 0x2A, 0xB5, 0x4B, 0x41, 0x10,
+    0x59, 0x94, 0x0C, 0x12, 0x88, 0x41, 0x86, 0xB3, 0x28, 0x21, 0x21, 0xE9, 0x91, 0x42, 0xAB, 0x25,
+    0x9C, 0x0C, 0xC5, 0x03, 0x55, 0x9C, 0x11, 0x26, 0x28, 0x10, 0xB0, 0x42, 0x8B, 0x93, 0x81, 0x14,
+    0x11, 0x10, 0x42, 0xB5, 0xF2, 0x1E, 0x3E, 0x1E, 0x61, 0x50, 0xB4, 0x22, 0x81, 0x51, 0x4D, 0x77,
+    0xC9, 0x83, 0x3E, 0x04, 0x50, 0x31, 0x51, 0xC0, 0x8A, 0x08, 0x27, 0x73, 0xD4, 0xB2, 0x67, 0xCD,
+    0xF0, 0x98, 0x21, 0x21, 0xEB, 0x60, 0xF2, 0x32, 0x30, 0x3B, 0x14, 0x0A, 0xCE, 0x08, 0xFB, 0x14,
+    0x10, 0x4C, 0xC5, 0xB0, 0x9C, 0xD1, 0x64, 0x9C, 0x15, 0x8F, 0xB1, 0x41, 0x11, 0x2C, 0x0A, 0x67,
+    0x71, 0x1A, 0x10, 0xAA, 0x00, 0x50, 0xD0, 0x35, 0x94, 0x0C, 0xD5, 0xF0, 0x56, 0x85, 0x65, 0x02,
+    0x06, 0x08, 0x5B, 0x46, 0x88, 0xA8, 0x26, 0x0A, 0x19, 0x46, 0xE9, 0xAA, 0xA5, 0xC2, 0x61, 0x41,
+    0x0E, 0x28, 0x24, 0xAF, 0x5E, 0x23, 0x00, 0x23, 0x00, 0x08, 0xDA, 0x8F, 0xE0, 0x32, 0x03, 0x50,
+    0xA2, 0x01, 0xC0, 0x86, 0xF3, 0x88, 0xAF, 0x00, 0x5B, 0x24, 0x9E, 0x47, 0x12, 0xD3, 0x82, 0x22,
+    0x45, 0x28, 0x20, 0x9D, 0x14, 0x50, 0xB4, 0xE0, 0x92, 0x29, 0x40, 0x9C, 0xD1, 0x09, 0x0D, 0x53,
+    0x0C, 0xA8, 0x16, 0x95, 0x29, 0xB3, 0x52, 0x7C, 0x0C, 0x34, 0x28, 0x20, 0x9E, 0x54, 0x5A, 0xD4,
+    0x9F, 0x04, 0x0D, 0x0A, 0x05, 0xC7, 0x05, 0x9D, 0x03, 0x42, 0x82, 0x11, 0xDE, 0x12, 0xBC, 0x32,
+    0x8D, 0x08, 0xA0, 0x64, 0x53, 0x81, 0x14, 0x0D, 0x49, 0xF0, 0x3A, 0x14, 0x10, 0x90, 0x50, 0xA5,
+    0x00, 0x79, 0x45, 0xC0, 0x24, 0x04, 0x67, 0x2B, 0x25, 0xA1, 0x67, 0xC1, 0x28, 0x1A, 0x14, 0x11,
+    0x55, 0x54, 0xBE, 0x14, 0xC8, 0xFA, 0x95, 0x96, 0x80, 0xF0, 0x96, 0xAF, 0x18, 0x24, 0x03, 0x25,
+    0x9C, 0x0A, 0x8C, 0x28, 0x1E, 0x89, 0x67, 0x03, 0xA3, 0x0A, 0x06, 0x40, 0x78, 0x2D, 0xD0, 0x96,
+    0x14, 0x08, 0xF8, 0x27, 0x84, 0x92, 0x08, 0x57, 0xC1, 0x85, 0x02, 0x40, 0x52, 0xBE, 0x0C, 0x28,
+    0x20, 0x9E, 0x68, 0x64, 0xD3, 0x0F, 0x03, 0x43, 0xD8, 0x50, 0x34, 0xE7, 0xC1, 0x83, 0x39, 0xA1,
+    0xEC, 0x28, 0x25, 0x41, 0xA1, 0x21, 0x52, 0xC7, 0x3E, 0x53, 0xD0, 0x03, 0x4F, 0xB6, 0x9D, 0xEB,
+    0x60, 0x02, 0x08, 0x04, 0xB0, 0x06, 0x1D, 0xEC, 0x28, 0x08, 0xD0, 0x00, 0xF0, 0x00, 0xF2, 0x84,
+    0xE1, 0x14, 0x0A, 0x16, 0x86, 0x42, 0x81, 0xE6, 0xE7, 0x8C, 0x09, 0x01, 0x9C, 0xDE, 0x08, 0x12,
+    0x14, 0x10, 0x43, 0x2A, 0xB7, 0xC8, 0x53, 0x83, 0x04, 0xD6, 0xF4, 0x0E, 0x0C, 0x0D, 0x3B, 0x8E,
+    0xE0, 0x41, 0x05, 0x85, 0x7D, 0x67, 0x41, 0x6A, 0x2F, 0x51, 0x60, 0x8A, 0x08, 0x8A, 0x60, 0x52,
+    0xE7, 0x90, 0x61, 0x18, 0x96, 0x84, 0x2B, 0xD0, 0x1B, 0x4A, 0x05, 0x95, 0x04, 0x4B, 0x4A, 0x04,
+    0x7C, 0x10, 0xA2, 0x64, 0xE6, 0x88, 0xB8, 0x47, 0x2A, 0x26, 0x8D, 0xFA, 0x4C, 0x40, 0xB4, 0xA0,
+    0x53, 0xF3, 0x3C, 0xA5, 0x9F, 0x34, 0x56, 0xC7, 0x4E, 0x46, 0x53, 0xA1, 0x2C, 0x71, 0x70, 0x46,
+    0x3F, 0x44, 0xB9, 0x96, 0xC3, 0xF4, 0x40, 0x8F, 0x69, 0x40, 0xB3, 0xE6, 0x79, 0x4A, 0x8E, 0x68,
+    0xAD, 0x59, 0xF0, 0x51, 0xBD, 0xA5, 0x02, 0x9F, 0x82, 0xA1, 0xED, 0x28, 0x20, 0x84, 0x68, 0x27,
+    0x34, 0xC8, 0xE1, 0xAC, 0x68, 0x9D, 0x00, 0x00, 0x00, 0xB9, 0x3A, 0x25, 0xE4, 0xB8, 0xDB, 0x09,
+    0x0A, 0x87, 0xC2, 0x54, 0x01, 0x40, 0x18, 0xD0, 0x32, 0x02, 0x2C, 0x91, 0x60, 0x11, 0x10, 0x0A,
+    0x00, 0x8C, 0x00, 0xA1, 0x4A, 0x20, 0x9F, 0x22, 0x81, 0x9E, 0xDE, 0x07, 0x22, 0x81, 0xAA, 0xFE,
+    0x0B, 0x97, 0xD7, 0x72, 0x28, 0x20, 0xB4, 0xAF, 0xB1, 0x92, 0x20, 0x22, 0x82, 0x0B, 0x5C, 0x1A,
+    0xFB, 0x2D, 0x79, 0xC6, 0xB6, 0x01, 0x04, 0xE3, 0x32, 0xD5, 0x28, 0x84, 0x33, 0xE4, 0x50, 0x28,
+    0xB8, 0x21, 0x4C, 0xF9, 0x14, 0x10, 0x4E, 0xDB, 0xB7, 0x79, 0x24, 0xDC, 0x0E, 0xE1, 0x91, 0x40,
+    0xED, 0x92, 0x78, 0x39, 0x93, 0x26, 0xDC, 0x32, 0x28, 0x23, 0xA9, 0xC4, 0x2A, 0x29, 0x6B, 0xE4,
+    0xBA, 0x12, 0x5B, 0xC4, 0x34, 0x7B, 0x5A, 0x82, 0xD5, 0xA7, 0x04, 0x41, 0x64, 0x50, 0x2D, 0xF9,
+    0x9E, 0x2C, 0x10, 0xA2, 0xE4, 0xE6, 0xBA, 0x35, 0x04, 0xAF, 0x2A, 0xC1, 0x02, 0xBB, 0x80, 0x82,
+    0x09, 0x9D, 0x75, 0x12, 0xA0, 0x81, 0x38, 0x21, 0x64, 0x50, 0x41, 0x31, 0x90, 0xA2, 0x04, 0x10,
+    0x27, 0x05, 0xA2, 0x0B, 0x22, 0x82, 0x09, 0x8B, 0x37, 0xC5, 0xB9, 0x64, 0x50, 0x27, 0x33, 0xCA,
+    0x86, 0x99, 0x86, 0x54, 0x12, 0x51, 0x87, 0x62, 0xDD, 0x05, 0x91, 0x40, 0x9C, 0xCF, 0x16, 0x13,
+    0xE4, 0xFC, 0xC8, 0xAA, 0x00, 0x00, 0x9C, 0x1A, 0x88, 0x2C, 0x8A, 0x0B, 0x10, 0x46, 0xC2, 0x21,
+    0x90, 0xA6, 0x3A, 0x54, 0xB6, 0x35, 0xCF, 0x84, 0xA7, 0x4A, 0xDA, 0xF8, 0xC8, 0x04, 0xF0, 0x30,
+    0x80, 0x0B, 0xC0, 0x8F, 0xF8, 0xAE, 0x58, 0xCC, 0x20, 0x5A, 0x70, 0x10, 0xA8, 0x26, 0x60, 0x38,
+    0x79, 0x1B, 0x62, 0x3C, 0x89, 0x46, 0x39, 0x8B, 0x78, 0x3E, 0xD0, 0x08, 0x5A, 0xBE, 0x41, 0xCF,
+    0x60, 0xF2, 0x20, 0x14, 0xC8, 0x73, 0xA8, 0x50, 0x88, 0x1C, 0x30, 0x01, 0xDB, 0xA5, 0x85, 0x9A,
+    0x84, 0x40, 0xB8, 0xA0, 0x82, 0x70, 0xD1, 0x1B, 0x5D, 0x81, 0x02, 0x60, 0x60, 0xD2, 0x60, 0x94,
+    0x10, 0x4F, 0x59, 0x23, 0x57, 0xE4, 0x09, 0x14, 0x0D, 0x57, 0xE4, 0x2D, 0xC8, 0xA0, 0x82, 0x77,
+    0xB1, 0x1A, 0x96, 0x00, 0x30, 0xA0, 0x67, 0x96, 0x01, 0x41, 0x85, 0x04, 0x13, 0xA6, 0xCC, 0x9D,
+    0x85, 0x98, 0x50, 0x5A, 0xA5, 0xF8, 0x26, 0x0B, 0xD9, 0x44, 0x02, 0x50, 0x23, 0x01, 0x28, 0x21,
+    0xA8, 0xCE, 0xA5, 0x81, 0xE8, 0xA3, 0x74, 0x54, 0xB0, 0x12, 0x81, 0xD2, 0x8A, 0x70, 0x09, 0x82,
+    0x12, 0x03, 0x29, 0x94, 0x2D, 0x30, 0xCA, 0x20, 0x26, 0x50, 0x3C, 0xC2, 0x56, 0x85, 0x59, 0x14,
+    0x08, 0x18, 0x26, 0x28, 0xDB, 0x46, 0xEB, 0xAD, 0x6A, 0x51, 0x05, 0x59, 0x94, 0x11, 0x52, 0x41,
+    0x95, 0xD3, 0xA8, 0x78, 0x82, 0x67, 0x5D, 0x22, 0x94, 0x2D, 0x04, 0xA0, 0x67, 0x26, 0x60, 0x94,
+    0x0A, 0x8A, 0x71, 0x80, 0xBA, 0x2A, 0x66, 0x08, 0xCA, 0x07, 0x08, 0xCA, 0x2E, 0x30, 0x12, 0x18,
+    0x21, 0x2B, 0xCA, 0x8A, 0x02, 0x50, 0x43, 0x49, 0x56, 0xC7, 0x16, 0x54, 0x21, 0xE5, 0x45, 0x00,
+    0x90, 0x1D, 0x85, 0x98, 0x50, 0x41, 0x25, 0xC5, 0x04, 0x15, 0x85, 0x31, 0xEE, 0x08, 0x5B, 0x40,
+    0x25, 0x04, 0x13, 0xA0, 0xA8, 0xD2, 0xE1, 0x25, 0x85, 0x03, 0x4C, 0x22, 0x01, 0xC5, 0x04, 0x65,
+    0xD0, 0xAF, 0x94, 0xEB, 0x7B, 0x3B, 0x67, 0x42, 0x9E, 0x16, 0xBC, 0xC0, 0xA1, 0x69, 0x30, 0x83,
+    0x42, 0x81, 0xDB, 0x24, 0x9B, 0x64, 0xFA, 0xBD, 0xDB, 0x24, 0xA1, 0x82, 0x0C, 0x8A, 0x08, 0x4C,
+    0x6A, 0x57, 0x4A, 0x7C, 0x3D, 0x09, 0x09, 0x0B, 0xC6, 0x50, 0x12, 0x80, 0x94, 0x10, 0x42, 0x79,
+    0x81, 0x28, 0x21, 0x04, 0x68, 0x98, 0x09, 0x41, 0x21, 0x46, 0x42, 0x58, 0xF8, 0x4A, 0x74, 0x12,
+    0x02, 0x15, 0x1C, 0xEE, 0x1B, 0x91, 0xF2, 0x68, 0xC2, 0x52, 0x8B, 0x64, 0x22, 0xAA, 0x2F, 0xCA,
+    0xB1, 0x26, 0x69, 0xCC, 0x3B, 0x21, 0x95, 0x9E, 0x58, 0x72, 0xAC, 0x35, 0x15, 0x14, 0x09, 0xF3,
+    0x28, 0x1A, 0x89, 0x67, 0x2A, 0xC2, 0x01, 0xD1, 0x39, 0x87, 0x95, 0x60, 0x9E, 0xC6, 0x28, 0xB7,
+    0x5E, 0x3B, 0x04, 0xC9, 0x43, 0xCA, 0x8B, 0x82, 0x50, 0x34, 0xE6, 0x10, 0x9E, 0xC2, 0x82, 0x33,
+    0x4A, 0x65, 0xB6, 0x55, 0xB5, 0xF1, 0x75, 0xA4, 0x07, 0x60, 0x11, 0xE7, 0x66, 0xE7, 0x2D, 0x24,
+    0x50, 0x12, 0x82, 0x09, 0x8A, 0x86, 0x52, 0xE0, 0x94, 0x09, 0x40, 0x4A, 0x50, 0x42, 0x58, 0x52,
+    0xF8, 0x71, 0x1E, 0x10, 0xE0, 0x94, 0x12, 0xD4, 0x3D, 0x84, 0x85, 0x3A, 0x56, 0xF9, 0x56, 0xC1,
+    0x18, 0xD8, 0x66, 0x13, 0x80, 0x03, 0xA6, 0x00, 0x09, 0x68, 0xDA, 0x90, 0xC5, 0x2A, 0x58, 0x11,
+    0x8A, 0x06, 0xAB, 0xF2, 0x0C, 0x8A, 0x06, 0x31, 0x45, 0x9E, 0x53, 0xDD, 0xB2, 0x4A, 0x1B, 0x44,
+    0xD2, 0x22, 0x08, 0x69, 0x76, 0x9B, 0x54, 0x13, 0x05, 0x2C, 0xA3, 0x41, 0x28, 0x11, 0x9A, 0xAF,
+    0x38, 0x28, 0x4B, 0xEB, 0xF4, 0x5C, 0xC1, 0x44, 0xD3, 0x36, 0xC1, 0x2B, 0x75, 0x55, 0x90, 0x9A,
+    0x14, 0xBF, 0xE8, 0x54, 0x39, 0xDB, 0x40, 0xC8, 0x47, 0x5B, 0x1E, 0x8C, 0x02, 0x30, 0x34, 0x98,
+    0xA0, 0x82, 0x65, 0xBD, 0xF1, 0x18, 0x93, 0x14, 0x09, 0xCC, 0xF2, 0xA6, 0x29, 0x21, 0x10, 0xCC,
+    0x76, 0x3E, 0x11, 0x9D, 0xF4, 0xCB, 0x07, 0xEA, 0x4A, 0x08, 0x1F, 0x80, 0x04, 0x58, 0x00, 0x11,
+    0x84, 0x61, 0x18, 0x46, 0xAF, 0x60, 0x56, 0x28, 0x14, 0x28, 0xCF, 0x3E, 0x09, 0x82, 0xF6, 0x11,
+    0x1A, 0x26, 0xD1, 0x9A, 0x20, 0xE1, 0x1D, 0x2C, 0x82, 0x30, 0x08, 0xC0, 0xDF, 0x62, 0x81, 0x5F,
+    0xC1, 0x18, 0xFB, 0x14, 0x10, 0x9A, 0x14, 0xBE, 0x31, 0x3F, 0x3A, 0xD3, 0x12, 0x84, 0xA7, 0x05,
+    0xF7, 0x1D, 0xF6, 0xA9, 0x98, 0x25, 0x04, 0x93, 0x88, 0xE8, 0x53, 0xA3, 0x3B, 0xE7, 0x40, 0x1F,
+    0x80, 0x00, 0x01, 0x18, 0x00, 0x00, 0x11, 0x01, 0x86, 0xC5, 0x02, 0xA3, 0x99, 0xE5, 0x44, 0x30,
+    0x8E, 0xA7, 0x64, 0x00, 0x1F, 0x00, 0x44, 0x06, 0xC5, 0x02, 0x73, 0x3C, 0xA9, 0x50, 0x48, 0x88,
+    0x64, 0x29, 0xAE, 0x9D, 0xB0, 0x00, 0xE8, 0x00, 0x5B, 0xDE, 0xE2, 0x00, 0xE8, 0x00, 0xE8, 0x00,
+    0xE8, 0x02, 0x03, 0x35, 0x30, 0x01, 0x6B, 0x35, 0x30, 0xAE, 0x98, 0x69, 0x70, 0xCA, 0x08, 0x2C,
+    0x70, 0x66, 0xED, 0x53, 0x3E, 0x13, 0x46, 0xF0, 0x50, 0x97, 0x5E, 0xA4, 0xC2, 0x70, 0xCA, 0x08,
+    0x4E, 0x0B, 0x9F, 0xFB, 0x1D, 0xC5, 0xDB, 0xAE, 0x00, 0x90, 0x91, 0x21, 0x2A, 0x5B, 0x5F, 0x3A,
+    0x80, 0x11, 0xA0, 0x02, 0xA8, 0x00, 0xAA, 0x28, 0x2A, 0xAA, 0x66, 0x1B, 0x86, 0x50, 0x22, 0x44,
+    0x9A, 0x5C, 0x32, 0x82, 0x0A, 0x93, 0x38, 0x5D, 0x27, 0xA2, 0x06, 0x3A, 0x56, 0x12, 0x3E, 0x75,
+    0xBE, 0x26, 0x33, 0x10, 0x00, 0xA0, 0x00, 0x00, 0x98, 0xA4, 0xC4, 0x4B, 0x86, 0x50, 0x44, 0x08,
+    0x48, 0x5B, 0xE0, 0x37, 0xD2, 0xF5, 0x9D, 0x36, 0x04, 0x65, 0x32, 0x56, 0xD7, 0xC6, 0x55, 0xB5,
+    0xF0, 0x00, 0x5F, 0xC0, 0x00, 0xF0, 0x00, 0xCC, 0x00, 0x11, 0xF7, 0xAB, 0xAB, 0xF7, 0x1A, 0x00,
+    0x12, 0xF0, 0x00, 0xC6, 0x00, 0x07, 0x80, 0x02, 0x0F, 0xED, 0x3B, 0xFD, 0x53, 0x60, 0x00, 0x78,
+    0x00, 0x0F, 0x35, 0x5E, 0x30, 0x00, 0xA1, 0x68, 0x44, 0x28, 0x15, 0x14, 0xDB, 0x36, 0x06, 0x45,
+    0x39, 0xCA, 0xED, 0xFD, 0x82, 0xE0, 0xA6, 0xA1, 0xD4, 0x6E, 0x9B, 0x04, 0x29, 0xA0, 0x33, 0xFF,
+    0xF4, 0xD7, 0xBE, 0x15, 0x29, 0xCA, 0xED, 0x5D, 0x84, 0xE0, 0xA5, 0xF7, 0x6D, 0xDE, 0x36, 0x93,
+    0x04, 0xA0, 0x8C, 0x75, 0x2D, 0xB1, 0x9D, 0xF4, 0x01, 0x18, 0x00, 0x00, 0x00, 0x23, 0x43, 0x09,
+    0x0A, 0x08, 0x46, 0x52, 0xDC, 0x03, 0xE2, 0x34, 0x24, 0x28, 0x13, 0x99, 0xE5, 0x49, 0x9A, 0x08,
+    0x53, 0x39, 0xF2, 0x9D, 0x2D, 0x77, 0xF4, 0x40, 0x01, 0x68, 0x00, 0x73, 0xBE, 0xEA, 0x3F, 0xA6,
+    0xC4, 0x00, 0xC2, 0x80, 0x0D, 0x60, 0x02, 0x75, 0x79, 0xC2, 0x56, 0x54, 0x0D, 0x12, 0x29, 0x41,
+    0x06, 0x68, 0x95, 0xDF, 0x49, 0x4B, 0xED, 0x8A, 0xD4, 0x13, 0xA2, 0x48, 0xD2, 0x81, 0x48, 0xA5,
+    0x02, 0xA2, 0x81, 0x14, 0xA0, 0x85, 0x34, 0x15, 0xF7, 0x7A, 0x22, 0xEF, 0x44, 0x25, 0x02, 0x2C,
+    0xCA, 0x08, 0x49, 0x32, 0x25, 0x29, 0xA6, 0x28, 0x78, 0x04, 0x81, 0x22, 0x66, 0x29, 0xD0, 0xA7,
+    0x4A, 0x99, 0xBC, 0x41, 0xE0, 0x00, 0x00, 0x00, 0x4A, 0x00, 0x05, 0xA0, 0x00, 0xB5, 0xFF, 0x97,
+    0x40, 0x01, 0x40, 0x00, 0x5A, 0x54, 0x50, 0x39, 0x14, 0xA0, 0x54, 0x70, 0x4A, 0x22, 0x45, 0x28,
+    0x20, 0xAD, 0x14, 0xA7, 0xA9, 0x4D, 0x37, 0xA8, 0xE9, 0xB8, 0x8E, 0xA7, 0x4A, 0x99, 0x0D, 0x4B,
+    0xC3, 0x41, 0xA9, 0x78, 0xE6, 0x5E, 0x11, 0x64, 0x50, 0x25, 0x37, 0xD0, 0x0B, 0x84, 0x13, 0xCB,
+    0x20, 0xB4, 0x44, 0x8A, 0x50, 0x4C, 0x7B, 0x36, 0x12, 0x9D, 0xF1, 0x94, 0xEB, 0x7C, 0xEB, 0x67,
+    0x10, 0x16, 0xB0, 0x18, 0x32, 0x43, 0xB6, 0x85, 0x01, 0x0C, 0x01, 0x08, 0x00, 0xA4, 0x02, 0xB8,
+    0x10, 0xC9, 0x21, 0xC0, 0x43, 0x1A, 0x89, 0x66, 0xFA, 0x36, 0xAE, 0x1A, 0x4F, 0x9B, 0xE4, 0x65,
+    0x3C, 0xC2, 0x56, 0xEE, 0xB1, 0xC5, 0x0B, 0x05, 0xD7, 0x45, 0x5A, 0xE0, 0x94, 0x08, 0x88, 0x2E,
+    0xA5, 0xEC, 0x07, 0x4E, 0x6E, 0xAF, 0xA6, 0x09, 0xC3, 0x44, 0x8B, 0x49, 0xEF, 0x8F, 0xA8, 0x93,
+    0xDD, 0x2E, 0xFC, 0x75, 0x44, 0xF2, 0x9D, 0x2F, 0x9D, 0x17, 0x61, 0x20, 0xA2, 0x9B, 0x9E, 0x23,
+    0xF0, 0x00, 0xB4, 0x9E, 0xF9, 0xB1, 0xAB, 0x3E, 0x07, 0x40, 0xD0, 0xA0, 0x4A, 0x09, 0x3A, 0x06,
+    0x85, 0x04, 0x14, 0x52, 0x72, 0xC9, 0x3D, 0xF3, 0x3D, 0xA0, 0x9E, 0x74, 0x88, 0x9C, 0xD3, 0x41,
+    0x82, 0x86, 0xD2, 0x35, 0xA4, 0x93, 0x6E, 0xA7, 0x66, 0x3A, 0x8E, 0x12, 0x16, 0x53, 0xBE, 0x41,
+    0xFA, 0xA4, 0x1F, 0x00, 0x03, 0x9A, 0xA4, 0x00, 0x49, 0xEF, 0x9A, 0xFA, 0x9C, 0xD5, 0x38, 0x42,
+    0x79, 0x2F, 0x89, 0x80, 0x00, 0x00, 0x13, 0x9B, 0xE5, 0xF0, 0xCC, 0x7D, 0x42, 0x95, 0x2D, 0x8D,
+    0x7C, 0x23, 0x4B, 0xE8, 0x12, 0x00, 0x16, 0x80, 0x19, 0xF7, 0x79, 0x80, 0x7E, 0xE2, 0xD5, 0x00,
+    0xDD, 0x91, 0x90, 0x01, 0xFE, 0x4B, 0x80, 0x04, 0x60, 0x0F, 0xD5, 0x2C, 0x09, 0x65, 0x02, 0x85,
+    0xB9, 0xE7, 0xA0, 0x60, 0x85, 0xB4, 0x68, 0xA0, 0x82, 0x64, 0xA1, 0x94, 0x66, 0x9B, 0x5B, 0x4E,
+    0x61, 0xE5, 0x4A, 0x4A, 0xC1, 0x40, 0x53, 0x3B, 0xA6, 0x97, 0x04, 0xC1, 0x4B, 0x48, 0xDD, 0x56,
+    0xDC, 0x15, 0x21, 0x95, 0xDE, 0xE9, 0x3E, 0x22, 0xA8, 0x29, 0x5B, 0x1F, 0x5B, 0x18, 0x1A, 0x0F,
+    0x41, 0xA0, 0x69, 0x29, 0xAA, 0x30, 0x46, 0x06, 0x95, 0x94, 0x10, 0x42, 0xB7, 0x93, 0x82, 0x31,
+    0x2B, 0x28, 0x25, 0xA8, 0xEA, 0x5B, 0x5D, 0x19, 0x4E, 0x97, 0xCE, 0x82, 0x30, 0x8C, 0xB5, 0x08,
+    0xC5, 0x70, 0xE8, 0x57, 0x41, 0xC7, 0xD0, 0x00, 0x57, 0x4A, 0x06, 0x15, 0x94, 0x08, 0xDC, 0xF3,
+    0xD6, 0x9C, 0xD1, 0x65, 0x04, 0x2D, 0xA3, 0x44, 0x64, 0x14, 0xD1, 0xB6, 0xD4, 0xE6, 0x9A, 0xA4,
+    0x13, 0x29, 0xCF, 0x88, 0xD0, 0xAC, 0xA0, 0x4E, 0x67, 0x95, 0x08, 0xC7, 0x96, 0x5F, 0x00, 0x4A,
+    0x05, 0x65, 0x02, 0x73, 0x3C, 0xA9, 0x8C, 0xA8, 0x52, 0xA5, 0xB1, 0xCF, 0x84, 0x67, 0x7D, 0x15,
+    0x70, 0xB3, 0x09, 0x40, 0x94, 0x04, 0x38, 0x64, 0x28, 0x08, 0x29, 0x01, 0x18, 0x11, 0x81, 0x18,
+    0x11, 0xAA, 0x68, 0x13, 0x4A, 0x04, 0x0C, 0x10, 0x9E, 0x6D, 0x17, 0x88, 0xF8, 0x41, 0x1A, 0x26,
+    0x68, 0x87, 0x47, 0xC1, 0x48, 0xE7, 0x5F, 0x4E, 0x69, 0xA3, 0x42, 0x4A, 0x42, 0xF9, 0xB8, 0x65,
+    0x29, 0xA6, 0x00, 0x83, 0xD5, 0x73, 0x42, 0x48, 0x52, 0xFD, 0x04, 0x1B, 0x55, 0x8D, 0x19, 0x27,
+    0x5B, 0x1F, 0x4A, 0xE4, 0x00, 0x23, 0x4B, 0x14, 0x40, 0x00, 0x04, 0xA0, 0x69, 0x69, 0x40, 0xE5,
+    0x98, 0x45, 0xBE, 0xA3, 0x34, 0x20, 0x9E, 0x59, 0x13, 0x82, 0x51, 0x2D, 0x28, 0x21, 0xA4, 0x68,
+    0x9D, 0x00, 0x00, 0x09, 0xC6, 0xBA, 0xC1, 0x2D, 0x41, 0x11, 0x0C, 0x78, 0xCE, 0x96, 0xBE, 0x34,
+    0x0D, 0x8A, 0xA0, 0xD9, 0x30, 0x39, 0x21, 0x60, 0xD8, 0x36, 0x39, 0x07, 0xC3, 0x92, 0x4F, 0x5C,
+    0x8F, 0x43, 0x86, 0x16, 0x94, 0x09, 0x3C, 0xF3, 0xD6, 0x7C, 0xD1, 0x65, 0x04, 0x27, 0x9B, 0x44,
+    0x64, 0x43, 0x08, 0xC8, 0xA5, 0x80, 0x7D, 0xF0, 0x04, 0x38, 0x5A, 0x50, 0x27, 0x33, 0xCA, 0x8A,
+    0xA0, 0x90, 0xA7, 0xBE, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x01, 0x26, 0x16, 0x94, 0x09, 0xCC,
+    0xF2, 0xA5, 0xA8, 0x22, 0x19, 0x10, 0xA6, 0x42, 0x76, 0xBE, 0x02, 0x31, 0xE0, 0xB4, 0x4A, 0x02,
+    0x30, 0x00, 0xEC, 0x64, 0x03, 0xA0, 0x00, 0x52, 0x49, 0x86, 0xF6, 0x94, 0x08, 0x8C, 0xF3, 0xD0,
+    0x7A, 0x2D, 0xE0, 0x84, 0x73, 0x68, 0x91, 0x84, 0x12, 0x5B, 0x00, 0x83, 0x7B, 0x4A, 0x08, 0x29,
+    0x1C, 0xE6, 0xC9, 0xCD, 0x31, 0xD8, 0x48, 0x1A, 0x26, 0x01, 0x79, 0xAA, 0xE1, 0x86, 0x61, 0x29,
+    0xD9, 0x01, 0xF0, 0x04, 0x43, 0xDA, 0x50, 0x27, 0x33, 0xCA, 0x8A, 0xA0, 0x8C, 0x85, 0xBE, 0x2E,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x04, 0xE0, 0x93, 0x7B, 0x4A, 0x09, 0x2A, 0x18, 0x90, 0x95, 0x2D,
+    0x8D, 0x7D, 0x42, 0x30, 0x8D, 0xAB, 0x08, 0xCD, 0xF1, 0x79, 0x5C, 0x37, 0xCD, 0xF5, 0x4C, 0xF7,
+    0x42, 0xA6, 0xE9, 0x61, 0x66, 0xA1, 0x10, 0x4E, 0x28, 0x20, 0x9C, 0xA9, 0x5A, 0xD3, 0x08, 0x81,
+    0x4B, 0x8A, 0x07, 0x2C, 0xC2, 0x20, 0xD8, 0x97, 0x14, 0x10, 0x4E, 0xC4, 0xAE, 0x72, 0xCC, 0x22,
+    0xDF, 0x48, 0x55, 0xD8, 0x59, 0x85, 0x05, 0xAA, 0xED, 0x84, 0xF0, 0xA5, 0xFF, 0xE5, 0x67, 0x23,
+    0xEF, 0xA7, 0xA9, 0x11, 0x55, 0x2A, 0xD8, 0xF0, 0xEC, 0xBC, 0x49, 0xCB, 0xC7, 0x61, 0x66, 0x14,
+    0x10, 0x69, 0x71, 0x41, 0x04, 0xF3, 0x62, 0xD5, 0x08, 0x82, 0x62, 0x5C, 0x50, 0x34, 0xC2, 0x21,
+    0x0A, 0xC4, 0xB8, 0xA0, 0x82, 0x72, 0xB1, 0x2B, 0x4C, 0x22, 0xD7, 0x72, 0x9C, 0xB3, 0x08, 0xB5,
+    0x5F, 0x51, 0x94, 0xB2, 0x15, 0xF2, 0x9D, 0xC3, 0x74, 0x58, 0x00, 0x0D, 0xC9, 0x50, 0xDD, 0xCB,
+    0x30, 0x88, 0x46, 0x25, 0xC5, 0x04, 0x13, 0x96, 0x68, 0x9A, 0x61, 0x16, 0x8A, 0x25, 0x08, 0xB5,
+    0x4E, 0x30, 0x4E, 0x12, 0xAD, 0x41, 0x06, 0x56, 0x25, 0xC5, 0x02, 0x84, 0x42, 0xCC, 0xAC, 0x4B,
+    0x8A, 0x08, 0xCA, 0x90, 0x48, 0x59, 0xDF, 0x06, 0x39, 0x18, 0x1B, 0xAF, 0xE4, 0x61, 0x18, 0xD3,
+    0x08, 0x85, 0x2B, 0x12, 0xE2, 0x82, 0x09, 0xA6, 0x17, 0xD4, 0x22, 0xD5, 0x12, 0xA0, 0xB5, 0x5C,
+    0x10, 0x4F, 0x30, 0xC9, 0x50, 0x8B, 0x4D, 0x32, 0x12, 0x04, 0x19, 0xC0, 0x14, 0x89, 0x32, 0xB1,
+    0x2E, 0x28, 0x20, 0x98, 0x22, 0x69, 0x05, 0xAA, 0xC2, 0x18, 0x33, 0x2B, 0x12, 0xE2, 0x82, 0x42,
+    0x44, 0x12, 0x16, 0x33, 0xBE, 0x34, 0x65, 0x17, 0x0B, 0x94, 0x31, 0xB5, 0x08, 0xB9, 0x42, 0x28,
+    0x66, 0x56, 0x25, 0xC5, 0x02, 0x84, 0x43, 0x4C, 0xAC, 0x4B, 0x8A, 0x04, 0xE0, 0xC2, 0x0C, 0xCA,
+    0xC4, 0xB8, 0xA0, 0x82, 0xA0, 0x8A, 0x90, 0x41, 0x69, 0xB1, 0x50, 0x9A, 0x36, 0x11, 0x90, 0xA9,
+    0x53, 0x1C, 0xF8, 0x4A, 0xB7, 0xC6, 0x6E, 0x5B, 0x60, 0x02, 0x5C, 0xF9, 0x0F, 0xC0, 0x07, 0x84,
+    0x01, 0xA4, 0x00, 0x07, 0x20, 0x00, 0xE4, 0x00, 0x0B, 0x7E, 0x46, 0x38, 0x05, 0xD2, 0x00, 0x05,
+    0xA0, 0x04, 0xA4, 0x04, 0x13, 0x80, 0x17, 0xD0, 0x01, 0xCE, 0x00, 0x1C, 0x95, 0xF4, 0x0D, 0x0F,
+    0x99, 0x41, 0x06, 0x08, 0x7D, 0x75, 0x8A, 0x53, 0x7C, 0xD1, 0xC8, 0x27, 0x0D, 0x54, 0xB0, 0xCA,
+    0x2D, 0xF1, 0xCD, 0xDC, 0x23, 0x28, 0xB8, 0x56, 0x17, 0xC2, 0x41, 0x5F, 0x50, 0x0A, 0x6E, 0x15,
+    0xBB, 0x70, 0xA0, 0x12, 0xA2, 0xB6, 0x83, 0x7A, 0x8D, 0x4B, 0x90, 0x01, 0x0D, 0xE5, 0x43, 0xEB,
+    0x78, 0xF4, 0x00, 0x07, 0xEE, 0xEE, 0x15, 0xA4, 0x71, 0x20, 0x12, 0xA1, 0xF5, 0xAC, 0xBE, 0xDD,
+    0xC1, 0xAC, 0xBE, 0xFE, 0x72, 0xDF, 0x3C, 0x4E, 0x1C, 0x06, 0x57, 0xD6, 0xB1, 0x62, 0xB1, 0x60,
+    0x00, 0xA1, 0x4A, 0x20, 0x6B, 0x32, 0x82, 0x09, 0xC2, 0x35, 0x4C, 0x32, 0x8B, 0x85, 0x4F, 0xDA,
+    0x94, 0x41, 0x86, 0xB3, 0x28, 0x25, 0x4C, 0x82, 0x3A, 0x14, 0xE7, 0xCA, 0x97, 0xC8, 0x00, 0x55,
+    0x00, 0x0A, 0xA0, 0x02, 0xA4, 0x00, 0x2A, 0x80, 0x05, 0x5B, 0x87, 0xB6, 0x00, 0x00, 0x00, 0x01,
+    0x40, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0x8A, 0x06, 0x59, 0x94, 0x08, 0x81, 0x28, 0x82, 0xCC, 0xA0,
+    0x82, 0x6A, 0x21, 0xF0, 0xD0, 0x59, 0x94, 0x09, 0x4D, 0x36, 0x58, 0xC9, 0x11, 0xD4, 0xE9, 0x53,
+    0x22, 0x00, 0x00, 0x02, 0x46, 0x3A, 0x91, 0xA5, 0x38, 0x54, 0x0D, 0xA7, 0x35, 0x5D, 0x30, 0x82,
+    0x79, 0x64, 0x16, 0x88, 0x2C, 0xCA, 0x09, 0x09, 0x60, 0x8E, 0x85, 0x3A, 0x14, 0xC9, 0x54, 0xAA,
+    0xC9, 0x2A, 0xA4, 0x00, 0x02, 0x82, 0xAA, 0xA2, 0x81, 0xBE, 0x65, 0x02, 0x20, 0x4A, 0x21, 0xF3,
+    0x28, 0x20, 0xB1, 0x14, 0x94, 0x44, 0xA6, 0x9B, 0xF4, 0x13, 0xD1, 0x12, 0x93, 0x9B, 0x23, 0xCA,
+    0x32, 0x44, 0x75, 0x3A, 0x54, 0xCC, 0x0C, 0x00, 0x00, 0x14, 0x10, 0xA0, 0x69, 0x41, 0x10, 0xF9,
+    0x94, 0x09, 0xCD, 0x56, 0x0C, 0x23, 0x9E, 0x59, 0x48, 0x00, 0x5A, 0x21, 0xF3, 0x28, 0x13, 0x99,
+    0xE2, 0xC8, 0x4A, 0x42, 0x35, 0x46, 0x77, 0xCE, 0x9C, 0x23, 0x20, 0x02, 0x71, 0x38, 0x9C, 0x00,
+    0x27, 0x1C, 0x23, 0x28, 0x83, 0xAC, 0xCA, 0x08, 0x27, 0x28, 0x54, 0x20, 0x82, 0x0D, 0x66, 0x50,
+    0x29, 0x45, 0xC2, 0x92, 0x02, 0x0B, 0x02, 0x39, 0xB5, 0x61, 0x94, 0x5A, 0x66, 0xF2, 0x13, 0x11,
+    0x90, 0xB3, 0xB5, 0xF1, 0xA6, 0x19, 0xA4, 0x64, 0x69, 0x34, 0x80, 0x0D, 0x20, 0x06, 0x19, 0x44,
+    0x20, 0x6B, 0x32, 0x81, 0x46, 0x21, 0x4A, 0x30, 0xD6, 0x65, 0x04, 0x13, 0x0C, 0xAF, 0x29, 0x45,
+    0xA6, 0xE0, 0x82, 0xE1, 0x45, 0xEF, 0x1D, 0x22, 0x21, 0x65, 0x3B, 0x5F, 0x09, 0xB3, 0x22, 0x6C,
+    0x64, 0x32, 0x4D, 0x8C, 0x93, 0x82, 0x14, 0x61, 0xAC, 0xCA, 0x05, 0x28, 0x85, 0x18, 0x6B, 0x32,
+    0x81, 0x38, 0x28, 0x8A, 0x30, 0xD6, 0x65, 0x04, 0x15, 0x14, 0x52, 0x7A, 0x0B, 0x4D, 0xB2, 0x53,
+    0x72, 0x74, 0x25, 0x6C, 0x7C, 0x25, 0x4A, 0x81, 0x74, 0x2D, 0xE5, 0x5B, 0x10, 0xA0, 0x0B, 0xD5,
+    0x28, 0x7D, 0x30, 0xA0, 0x8D, 0x1C, 0x19, 0x0F, 0x4A, 0x25, 0x9C, 0x29, 0x20, 0x1D, 0x13, 0x98,
+    0x77, 0xC1, 0x44, 0x4A, 0x41, 0x3A, 0x68, 0x81, 0x19, 0xC2, 0xA0, 0xA9, 0x52, 0xCE, 0x14, 0x7C,
+    0xF0, 0xA0, 0xF4, 0x26, 0xF1, 0xB0, 0x00, 0x65, 0x2E, 0x01, 0x00, 0xA8, 0xBF, 0x0A, 0x36, 0xE8,
+    0x29, 0x7D, 0x20, 0xDA, 0x25, 0x21, 0x21, 0x2F, 0x9A, 0x81, 0x42, 0x5C, 0x34, 0x25, 0x85, 0x02,
+    0xCC, 0x20, 0xBD, 0x85, 0x03, 0x4E, 0x61, 0xE1, 0x4F, 0xC7, 0x16, 0x10, 0x0A, 0x12, 0xFA, 0x5D,
+    0x4E, 0xDD, 0x70, 0x80, 0x41, 0x80, 0x2A, 0x00, 0x15, 0x33, 0xCB, 0x0E, 0x14, 0x3E, 0xED, 0x44,
+    0xB3, 0x85, 0x0E, 0x6B, 0xA2, 0x73, 0x0F, 0x0A, 0x19, 0xE8, 0x30, 0x62, 0x28, 0x5B, 0xC1, 0x28,
+    0x22, 0x25, 0x27, 0x95, 0x32, 0x32, 0x19, 0x27, 0x06, 0x4B, 0x46, 0x08, 0x9A, 0x51, 0x85, 0x04,
+    0x13, 0xA6, 0x8A, 0x11, 0x81, 0xD2, 0x8C, 0x28, 0x15, 0x2C, 0xE1, 0x49, 0xA7, 0x1D, 0x2C, 0x3A,
+    0x56, 0xF9, 0x57, 0x22, 0x42, 0x8A, 0x0D, 0x06, 0x24, 0x41, 0x89, 0x03, 0x4D, 0x28, 0xC2, 0x81,
+    0x52, 0xC1, 0x29, 0x46, 0x14, 0x09, 0xC1, 0x18, 0x9A, 0x51, 0x85, 0x04, 0x15, 0x25, 0x92, 0xE2,
+    0x33, 0x4D, 0xDA, 0x4A, 0x56, 0x23, 0xA1, 0x4E, 0x7D, 0x6F, 0x92, 0xA9, 0x55, 0xBA, 0x55, 0x2A,
+    0xA4, 0x00, 0x02, 0x82, 0xAA, 0xA2, 0xE1, 0xA5, 0x85, 0x02, 0x20, 0x4B, 0xA1, 0x2C, 0x28, 0x20,
+    0xB1, 0x17, 0xB4, 0x24, 0xBE, 0x9B, 0xF2, 0x22, 0x0A, 0x67, 0x7A, 0xB2, 0xCC, 0x3C, 0x27, 0x7A,
+    0x24, 0x28, 0x45, 0x3A, 0x9D, 0x19, 0xDF, 0x36, 0x58, 0x00, 0x00, 0x00, 0x16, 0x5D, 0x96, 0x14,
+    0x00, 0x09, 0x71, 0x10, 0x96, 0x14, 0x10, 0xA0, 0x58, 0xCE, 0x85, 0xE6, 0x85, 0xE5, 0x39, 0xC2,
+    0x85, 0x66, 0x2C, 0x20, 0x54, 0x25, 0x8F, 0x00, 0x6A, 0xB9, 0x41, 0x00, 0xC5, 0x00, 0xC5, 0x01,
+    0x0C, 0x82, 0x77, 0x95, 0x2A, 0x96, 0x1C, 0x27, 0x08, 0x12, 0x01, 0xBE, 0x0C, 0x28, 0x20, 0x9A,
+    0x0F, 0x7C, 0x27, 0xC1, 0x85, 0x02, 0x43, 0x85, 0x03, 0x24, 0x14, 0xBC, 0xB5, 0xE5, 0x2C, 0x03,
+    0x83, 0x0A, 0x08, 0xE9, 0x41, 0x0A, 0x96, 0x3E, 0x57, 0x44, 0x95, 0xC5, 0x42, 0xAB, 0x28, 0xA9,
+    0x12, 0xD3, 0x98, 0x78, 0x4D, 0x5C, 0xA9, 0x60, 0x23, 0xE0, 0xC2, 0x81, 0x38, 0x24, 0x0A, 0xF8,
+    0x30, 0xA0, 0x83, 0x02, 0xC2, 0x7B, 0xED, 0x21, 0xA6, 0xE1, 0x31, 0xA5, 0x11, 0xD0, 0x95, 0x31,
+    0xCF, 0x84, 0xE9, 0x90, 0x8F, 0x84, 0x7C, 0x39, 0x60, 0x91, 0x08, 0xF8, 0x0A, 0x02, 0x3E, 0x0D,
+    0xE0, 0xC2, 0x81, 0x6A, 0xE7, 0x61, 0x1F, 0x58, 0x70, 0x18, 0x30, 0xA0, 0x74, 0x4E, 0x61, 0x0D,
+    0xEC, 0x28, 0x19, 0x13, 0x08, 0x93, 0x43, 0xD8, 0x50, 0x22, 0x20, 0xC2, 0x77, 0x98, 0x72, 0x59,
+    0x87, 0x4D, 0x8A, 0x0A, 0xCA, 0x8A, 0xA0, 0x90, 0xE1, 0x58, 0xD9, 0x04, 0xE8, 0x9A, 0x46, 0x9C,
+    0xC3, 0xAA, 0xE0, 0x59, 0x87, 0x84, 0xE7, 0xAC, 0x26, 0x15, 0x0F, 0xF8, 0x4B, 0x35, 0xD9, 0x68,
+    0xF2, 0x92, 0x20, 0x90, 0xA7, 0x53, 0xA7, 0x7C, 0x64, 0x64, 0x32, 0x3A, 0x00, 0x00, 0x00, 0x05,
+    0xA8, 0xC8, 0x64, 0x00, 0x69, 0xCC, 0x22, 0x21, 0xEC, 0x28, 0x12, 0x70, 0x57, 0x30, 0xDA, 0x94,
+    0x0E, 0x89, 0xF4, 0x9C, 0x13, 0x86, 0x70, 0x93, 0x9A, 0xEA, 0x84, 0x43, 0x84, 0x85, 0xBE, 0x12,
+    0x24, 0x48, 0x90, 0x39, 0xA1, 0xEC, 0x28, 0x20, 0x9C, 0x33, 0x52, 0x2C, 0xE6, 0x87, 0xB0, 0xA0,
+    0x40, 0x8B, 0x34, 0x3D, 0x85, 0x05, 0x58, 0x4B, 0x61, 0x21, 0x4C, 0x84, 0xA9, 0x6C, 0x6B, 0xE1,
+    0x19, 0xD2, 0xB6, 0xBE, 0x74, 0x0C, 0x82, 0x29, 0x20, 0x03, 0xF6, 0x17, 0x10, 0x0A, 0xD8, 0x00,
+    0x48, 0x05, 0xA8, 0x01, 0x63, 0x57, 0x9C, 0x04, 0xDB, 0x5B, 0x60, 0x10, 0x5A, 0x00, 0xC6, 0x02,
+    0xFA, 0x06, 0x5E, 0x07, 0xF4, 0x1F, 0x5A, 0x02, 0x40, 0x09, 0x48, 0x01, 0x62, 0x02, 0xFA, 0xA8,
+    0xBE, 0xF8, 0x82, 0x88, 0x58, 0x21, 0xA5, 0xC1, 0xA0, 0xB2, 0x28, 0x20, 0xC1, 0xE6, 0x9E, 0x9E,
+    0x63, 0x14, 0x41, 0x48, 0xA0, 0x82, 0x79, 0xD5, 0x53, 0x04, 0xAD, 0xE1, 0x50, 0xF4, 0xF3, 0x09,
+    0x5B, 0xA6, 0xF9, 0x0A, 0x05, 0x0B, 0xE9, 0xBD, 0xA9, 0xC3, 0xD1, 0xDC, 0xAE, 0xB9, 0x58, 0x27,
+    0xB8, 0x57, 0xBB, 0x64, 0x93, 0x70, 0xAB, 0x9A, 0x7B, 0xB6, 0x49, 0x43, 0x6A, 0xA8, 0x60, 0x9C,
+    0xA8, 0x51, 0x04, 0x28, 0xBB, 0x54, 0xB9, 0x04, 0x34, 0xBB, 0x7C, 0x1C, 0xB8, 0x30, 0x79, 0xA7,
+    0x25, 0x20, 0xAC, 0xCD, 0xBD, 0x0A, 0x51, 0x6B, 0xB9, 0x10, 0xD6, 0x57, 0xCE, 0xB5, 0xD2, 0xDC,
+    0xDE, 0x3E, 0x76, 0x75, 0x2E, 0x12, 0xAA, 0x1B, 0x86, 0x51, 0xE3, 0x04, 0xAD, 0x0E, 0x75, 0x91,
+    0x41, 0x04, 0xE5, 0xBA, 0x34, 0x68, 0x35, 0x91, 0x40, 0xED, 0x92, 0x4D, 0xAE, 0x51, 0x45, 0x96,
+    0xC2, 0x53, 0x3E, 0xBF, 0xEA, 0x5F, 0xFB, 0x35, 0x76, 0x54, 0x7F, 0x81, 0x7F, 0xE3, 0xD3, 0x55,
+    0xF9, 0xD9, 0x7F, 0x11, 0x16, 0xD0, 0x95, 0x17, 0x05, 0xB4, 0x8E, 0xA5, 0xCA, 0x56, 0x92, 0x4C,
+    0x08, 0x64, 0x50, 0x41, 0x53, 0x6F, 0x47, 0x34, 0x92, 0x6E, 0x13, 0x6F, 0xB1, 0x60, 0xFD, 0x84,
+    0xA9, 0xAF, 0xF4, 0xC7, 0xDF, 0x1F, 0xE1, 0x95, 0x14, 0x27, 0xD8, 0x94, 0x26, 0x14, 0xCD, 0xC9,
+    0xBA, 0x83, 0x41, 0x06, 0x67, 0xC8, 0xA0, 0x88, 0x97, 0xA5, 0x55, 0xC9, 0xA0, 0xD0, 0xD5, 0x34,
+    0x41, 0x36, 0x6A, 0xF8, 0x55, 0xDC, 0x8A, 0x04, 0xC8, 0x8F, 0xAE, 0xE4, 0x50, 0x41, 0x3B, 0xEA,
+    0xA1, 0x32, 0x1D, 0x77, 0x22, 0x81, 0x5F, 0x90, 0xF7, 0x22, 0x82, 0x22, 0x32, 0x95, 0x32, 0x0A,
+    0x24, 0x8A, 0x2A, 0x21, 0xBE, 0xBB, 0x91, 0x40, 0xAF, 0xC8, 0x95, 0xDC, 0x8A, 0x08, 0x2A, 0x7E,
+    0x6B, 0x94, 0xCE, 0x8A, 0x99, 0xAA, 0x50, 0xC8, 0x53, 0x1D, 0x2B, 0x63, 0x5D, 0x09, 0x58, 0x23,
+    0x53, 0x8F, 0x36, 0x00, 0x23, 0x20, 0x00, 0x02, 0xF4, 0x44, 0x00, 0x0B, 0xD5, 0x39, 0x4E, 0x46,
+    0x86, 0xF9, 0x14, 0x0C, 0x62, 0x8B, 0x3C, 0x58, 0x41, 0x52, 0xDC, 0x08, 0xD7, 0xC8, 0xA0, 0x82,
+    0x93, 0x36, 0xD4, 0xA5, 0x16, 0x9A, 0x64, 0x13, 0xB4, 0xD1, 0x53, 0x9A, 0x62, 0xD0, 0x4C, 0x23,
+    0x3E, 0x11, 0x9F, 0x22, 0x81, 0x05, 0xC2, 0x59, 0x06, 0x0A, 0x4A, 0x69, 0x96, 0xCB, 0x98, 0x8D,
+    0x02, 0x8C, 0x87, 0x95, 0xAF, 0x2A, 0x8A, 0x00, 0x65, 0x2A, 0x8A, 0x00, 0x65, 0x2A, 0x8A, 0x00,
+    0x64, 0x9C, 0x10, 0x45, 0x33, 0xE4, 0x50, 0x41, 0x81, 0x45, 0x2A, 0x50, 0x82, 0xE1, 0x29, 0xB7,
+    0x31, 0x4F, 0x08, 0x88, 0x74, 0x29, 0xD1, 0x94, 0xEF, 0x90, 0x74, 0xE3, 0x10, 0x0E, 0x36, 0xB8,
+    0xE3, 0x1F, 0x41, 0xD1, 0x5C, 0x1D, 0x4A, 0x4B, 0x04, 0x6E, 0xDA, 0x19, 0x25, 0xC3, 0x2C, 0x8A,
+    0x04, 0x46, 0x79, 0xF0, 0x42, 0x8B, 0xB4, 0x54, 0xC1, 0x6A, 0x2F, 0x35, 0x7D, 0x37, 0x68, 0x2D,
+    0x45, 0x26, 0x49, 0xA6, 0x87, 0x09, 0xA8, 0xA5, 0xE5, 0xBF, 0x2D, 0xFD, 0x57, 0xEC, 0x35, 0x05,
+    0x11, 0xB8, 0x3E, 0x00, 0x57, 0xE2, 0x5C, 0xB2, 0x28, 0x20, 0x86, 0x97, 0x6A, 0x9E, 0x24, 0x40,
+    0xA2, 0x3A, 0x9D, 0x1A, 0x5F, 0x32, 0x64, 0xE0, 0x0C, 0x92, 0x64, 0xE0, 0x04, 0x80, 0x00, 0x00,
+    0x08, 0x80, 0x12, 0x40, 0x0C, 0x82, 0x5D, 0x05, 0x91, 0x40, 0x9C, 0xE1, 0x25, 0xC6, 0x87, 0xE1,
+    0x27, 0xF7, 0x04, 0x34, 0xBB, 0x84, 0x94, 0xAC, 0x38, 0x04, 0xB1, 0x9C, 0xA2, 0x90, 0x00, 0x00,
+    0x00, 0x07, 0x09, 0x41, 0x79, 0x2A, 0xD8, 0x48, 0x54, 0xAA, 0x77, 0xC6, 0x4B, 0x51, 0x50, 0x54,
+    0x08, 0x82, 0x25, 0xC0, 0x54, 0x15, 0x02, 0x25, 0x7E, 0x76, 0xDA, 0xC5, 0xE6, 0x12, 0xB4, 0x3A,
+    0xC8, 0xA0, 0x82, 0x70, 0xCD, 0x12, 0x95, 0xBB, 0x65, 0x32, 0xC1, 0x2B, 0x74, 0x42, 0xC2, 0x41,
+    0x43, 0x39, 0x12, 0x84, 0x68, 0x53, 0xAC, 0x8A, 0x08, 0x26, 0x09, 0x5F, 0x52, 0xB7, 0x55, 0xEE,
+    0x8D, 0x10, 0x33, 0xAC, 0x8A, 0x08, 0xEA, 0x20, 0x4B, 0x19, 0xDF, 0x1A, 0x43, 0x46, 0xE0, 0xCB,
+    0x1E, 0x0C, 0x80, 0x00, 0xC9, 0x82, 0x56, 0x89, 0x3A, 0xC8, 0xA0, 0x82, 0x90, 0x96, 0x10, 0xA5,
+    0x6E, 0x8A, 0x58, 0x27, 0x68, 0x52, 0x06, 0x19, 0xD6, 0x45, 0x04, 0x13, 0x15, 0xAC, 0xA3, 0x74,
+    0xCB, 0xC5, 0x28, 0x67, 0x59, 0x14, 0x12, 0x14, 0xD0, 0x90, 0xB1, 0x94, 0xEF, 0xAA, 0xEC, 0x92,
+    0x16, 0xC2, 0x92, 0x48, 0x29, 0x24, 0x82, 0x91, 0x0A, 0x19, 0xD6, 0x45, 0x02, 0x95, 0xA2, 0x86,
+    0x75, 0x91, 0x40, 0x9C, 0x15, 0xA5, 0x0C, 0xEB, 0x22, 0x82, 0x0A, 0x8A, 0xDA, 0x71, 0x1B, 0xA6,
+    0xD9, 0x19, 0xBA, 0x09, 0x5B, 0x19, 0xDE, 0x02, 0xA0, 0x77, 0x01, 0xD8, 0x1D, 0xC0, 0xEE, 0x0C,
+    0x37, 0xBB, 0x64, 0x94, 0x30, 0x61, 0x91, 0x40, 0xF7, 0x92, 0x4C, 0x23, 0x6E, 0x19, 0x14, 0x10,
+    0x5D, 0x76, 0xDF, 0x34, 0xED, 0x92, 0x4D, 0xA6, 0xBD, 0x25, 0x41, 0x2A, 0x96, 0xD7, 0x46, 0x53,
+    0xB8, 0x00, 0x1B, 0x86, 0xE8, 0xB0, 0x6E, 0x00, 0x12, 0xA0, 0x06, 0x80, 0xED, 0x92, 0x4C, 0x25,
+    0xC3, 0x22, 0x82, 0x09, 0xDB, 0x24, 0x4D, 0x24, 0x9B, 0x45, 0x12, 0xA4, 0xDA, 0xA6, 0x38, 0x27,
+    0x4B, 0x56, 0xA1, 0x83, 0x6D, 0xC3, 0x22, 0x81, 0x52, 0x61, 0x64, 0xDB, 0x86, 0x45, 0x04, 0x75,
+    0x28, 0xA6, 0x4A, 0xDD, 0x2A, 0x16, 0x85, 0xA0, 0x6E, 0x00, 0x00, 0x08, 0x41, 0x68, 0xD2, 0x49,
+    0x85, 0x6D, 0xC3, 0x22, 0x82, 0x09, 0xCD, 0x25, 0x22, 0x49, 0xB7, 0x0C, 0x8A, 0x04, 0x30, 0xC9,
+    0x93, 0x6E, 0x19, 0x14, 0x10, 0x4C, 0x99, 0x34, 0x86, 0xD5, 0x39, 0xAA, 0x4D, 0xA6, 0x17, 0x15,
+    0x06, 0x2A, 0xDF, 0x4A, 0x97, 0x32, 0xB2, 0x97, 0x32, 0x8A, 0x99, 0x36, 0xE1, 0x91, 0x40, 0xA9,
+    0x30, 0xD2, 0x6D, 0xC3, 0x22, 0x82, 0x0A, 0x92, 0x6A, 0x9D, 0x0D, 0xA2, 0x7C
 };
+#endif
@@ -8,6 +8,8 @@
 #define QUICK_TAP_TERM 120        // Repeat key on fast double-tap instead of hold
 #define PERMISSIVE_HOLD           // Register hold earlier during fast rolls
 #define CHORDAL_HOLD              // Same-hand keys = tap, opposite-hand = hold
+#define FLOW_TAP_TERM 150         // Mid-word home row mod = instant tap (per key in keymap.c)
+#define FLOW_TAP_TERM_SHIFT 100   // Shorter streak window on the Shift pinkies
 
 #ifdef KEYBOARD_crkbd_rev1_legacy
 #    undef USE_I2C
@@ -19,8 +21,25 @@
 #define COMBO_TERM 80
 #define COMBO_STRICT_TIMER
 
-// Anti-mash guard: suppress accidental simultaneous keypresses within this window (ms)
+// Anti-mash guard: drop presses once this many neighbouring keys land with
+// under MASH_GUARD_TERM ms between each press and the next (lib/mash_guard.h).
+// Mod-tap and layer-tap keys never count towards a mash: the tapping code has
+// already resolved them, and dropping one would lose a held mod or layer.
 #define MASH_GUARD_TERM 8
+#define MASH_GUARD_MIN_KEYS 3
+
+// Autocorrect: walk the trie in userspace, starting from a 28-entry jump table
+// instead of scanning the root's children. Needs an autocorrect_data.h from
+// autocorrdata.py; QMK's own copy shrinks to a 1-byte placeholder, so this
+// costs only the 56-byte table.
+// #define AUTOCORRECT_JUMP_TABLE
+
+// Autocorrect: walk a bit-packed copy of the trie instead. Trades speed for
+// flash: about a third the size of QMK's stock format, but against the stock
+// walk +89% trie reads and +196% time per keystroke on the replay corpus.
+// QMK's own copy shrinks to a 1-byte placeholder. Alternative to
+// AUTOCORRECT_JUMP_TABLE.
+// #define AUTOCORRECT_COMPACT_TRIE
 
 // Trackpad support
 #define AZOTEQ_IQS5XX_WIDTH_MM  43
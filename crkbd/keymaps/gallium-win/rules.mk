@@ -22,3 +22,12 @@ REPEAT_KEY_ENABLE   = no
 TAP_DANCE_ENABLE    = no
 POINTING_DEVICE_ENABLE = yes
 POINTING_DEVICE_DRIVER = azoteq_iqs5xx
+
+# Keystroke latency tracer (lib/latency_trace.h): dumps per-stage key event
+# timestamps over the console for lib/latency_trace.py
+LATENCY_TRACE_ENABLE = no
+
+ifeq ($(strip $(LATENCY_TRACE_ENABLE)), yes)
+    OPT_DEFS += -DLATENCY_TRACE_ENABLE
+    CONSOLE_ENABLE = yes
+endif
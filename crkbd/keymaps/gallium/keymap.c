@@ -14,6 +14,7 @@
 
 #include QMK_KEYBOARD_H
 #include <stdio.h>
+#include "keyboards/crkbd/lib/latency_trace.h" // no-op unless LATENCY_TRACE_ENABLE
 
 // ─── Layer Names ────────────────────────────────────────────────────────────
 
@@ -76,6 +77,7 @@ enum combo_events {
 #include "combos.def"
 
 void process_combo_event(uint16_t combo_index, bool pressed) {
+    latency_trace_combo(combo_index, pressed);
     if (!pressed) return;
     switch (combo_index) {
         case WC_THE:   SEND_STRING("the "); break;
@@ -213,14 +215,47 @@ const char chordal_hold_layout[MATRIX_ROWS][MATRIX_COLS] PROGMEM =
                        '*', '*', '*',  '*', '*', '*'
     );
 
+// ─── Flow Tap (typing-streak fast path) ─────────────────────────────────────
+// Mid-word, a home row mod pressed within its window of the previous letter,
+// with no modifier held, is a tap at once: it skips the tapping term and the
+// permissive/chordal hold checks.
+// The Shift pinkies get a shorter window so camelCase capitals can still
+// hold. 0 = always resolve.
+// Replay a latency trace through this table with lib/flow_tap_replay.py.
+
+#define FT_HOME FLOW_TAP_TERM
+#define FT_SHFT FLOW_TAP_TERM_SHIFT
+
+const uint16_t flow_tap_terms[MATRIX_ROWS][MATRIX_COLS] PROGMEM =
+    LAYOUT_split_3x6_3(
+        0, 0,       0,       0,       0,       0,          0,       0,       0,       0,       0,       0,
+        0, FT_SHFT, FT_HOME, FT_HOME, FT_HOME, 0,          FT_HOME, 0,       FT_HOME, FT_HOME, FT_SHFT, 0,
+        0, 0,       0,       0,       0,       0,          0,       0,       0,       0,       0,       0,
+                                      0,       0,       0,          0,       0,       0
+    );
+
+uint16_t get_flow_tap_term(uint16_t keycode, keyrecord_t *record, uint16_t prev_keycode) {
+    // Combos have no matrix position; a held mod means a shortcut is coming
+    if (!IS_KEYEVENT(record->event) || get_mods()) {
+        return 0;
+    }
+    if (IS_QK_MOD_TAP(prev_keycode)) {
+        prev_keycode = QK_MOD_TAP_GET_TAP_KEYCODE(prev_keycode);
+    } else if (IS_QK_LAYER_TAP(prev_keycode)) {
+        prev_keycode = QK_LAYER_TAP_GET_TAP_KEYCODE(prev_keycode);
+    }
+    if (prev_keycode < KC_A || prev_keycode > KC_Z) {
+        return 0;
+    }
+    return pgm_read_word(&flow_tap_terms[record->event.key.row][record->event.key.col]);
+}
+
 // ─── Last Key Tracking & Mash Guard ─────────────────────────────────────────
 
 static char last_key_char = 0;
 
-// Mash guard state: uses original hardware event timestamp to detect truly
-// simultaneous accidental keypresses. Bypasses for mod-tap / layer-tap keys.
-static uint16_t mash_last_event_time = 0;
-static uint16_t mash_last_keycode    = KC_NO;
+// Mash guard: windowed classifier over the last few presses' positions
+#include "keyboards/crkbd/lib/mash_guard.h"
 
 static char keycode_to_char(uint16_t keycode, uint8_t mods) {
     if (keycode >= QK_MOD_TAP && keycode <= QK_MOD_TAP_MAX) {
@@ -248,25 +283,35 @@ static char keycode_to_char(uint16_t keycode, uint8_t mods) {
     return 0;
 }
 
+// ─── Autocorrect (userspace trie walk) ──────────────────────────────────────
+
+#if defined(AUTOCORRECT_JUMP_TABLE) || defined(AUTOCORRECT_COMPACT_TRIE)
+#    define AUTOCORRECT_TRIE_WALK // the packed trie, not QMK's placeholder
+#    include "autocorrect_data.h"
+#    include "keyboards/crkbd/lib/autocorrect_process.h"
+#endif
+
 bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    latency_trace_hold(keycode, record);
+
     if (record->event.pressed) {
-        bool prev_is_special = (mash_last_keycode >= QK_MOD_TAP   && mash_last_keycode <= QK_MOD_TAP_MAX) ||
-                               (mash_last_keycode >= QK_LAYER_TAP && mash_last_keycode <= QK_LAYER_TAP_MAX);
-        bool curr_is_special = (keycode >= QK_MOD_TAP   && keycode <= QK_MOD_TAP_MAX) ||
-                               (keycode >= QK_LAYER_TAP && keycode <= QK_LAYER_TAP_MAX);
-
-        if (!prev_is_special && !curr_is_special &&
-            TIMER_DIFF_16(record->event.time, mash_last_event_time) < MASH_GUARD_TERM) {
-            return false;  // suppress accidental simultaneous press
+        // Mash guard: drop presses that end a mash across neighbouring keys
+        if (mash_guard(keycode, record)) {
+            return false;
         }
 
-        mash_last_event_time = record->event.time;
-        mash_last_keycode    = keycode;
-
         char c = keycode_to_char(keycode, get_mods());
         if (c) last_key_char = c;
     }
+#if defined(AUTOCORRECT_JUMP_TABLE) || defined(AUTOCORRECT_COMPACT_TRIE)
+    return process_autocorrect_trie(keycode, record);
+#else
     return true;
+#endif
+}
+
+void housekeeping_task_user(void) {
+    latency_trace_task();
 }
 
 // ─── OLED Display (graphical vertical layout, 32x128) ────────────────────────
@@ -277,7 +322,7 @@ oled_rotation_t oled_init_user(oled_rotation_t rotation) {
     return OLED_ROTATION_270;
 }
 
-extern const unsigned char font[] PROGMEM;
+#include "keyboards/crkbd/lib/glcdfont_scaled.h"
 
 // ─── Modifier Icon Bitmaps (14x14, row-major, 2 bytes/row in PROGMEM) ───────
 
@@ -344,25 +389,33 @@ static void render_icon_14x14(uint8_t x, uint8_t y, const uint8_t *icon) {
     }
 }
 
+// Logical row stride of the OLED buffer under OLED_ROTATION_270 (32 px wide)
+#define OLED_ROW_BYTES OLED_DISPLAY_HEIGHT
+
+// Blits a pre-scaled glyph (glcdfont_scaled.h) one buffer byte at a time.
+// y need not be page-aligned: each column is shifted into place and merged
+// with the neighbouring pixels above and below it.
 static void render_scaled_char(uint8_t x, uint8_t y, char c, uint8_t scale) {
-    const uint8_t *glyph = &font[(uint8_t)c * OLED_FONT_WIDTH];
-    for (uint8_t col = 0; col < 5; col++) {
-        uint8_t col_data = pgm_read_byte(&glyph[col]);
-        for (uint8_t row = 0; row < 8; row++) {
-            bool on = (col_data >> row) & 1;
-            for (uint8_t dx = 0; dx < scale; dx++)
-                for (uint8_t dy = 0; dy < scale; dy++)
-                    oled_write_pixel(x + col * scale + dx, y + row * scale + dy, on);
+    const uint8_t *glyph = scale == 3 ? font_3x_glyph(c) : font_2x_glyph(c);
+    uint8_t  width = scale == 3 ? FONT_3X_WIDTH : FONT_2X_WIDTH;
+    uint8_t  shift = y & 7;
+    uint8_t  span  = scale + (shift ? 1 : 0);
+    uint16_t base  = (y >> 3) * OLED_ROW_BYTES + x;
+    uint32_t mask  = (((uint32_t)1 << (scale * 8)) - 1) << shift;
+    for (uint8_t col = 0; col < width; col++) {
+        uint32_t bits = 0;
+        for (uint8_t page = 0; page < scale; page++)
+            bits |= (uint32_t)pgm_read_byte(&glyph[page * width + col]) << (page * 8);
+        bits <<= shift;
+        for (uint8_t page = 0; page < span; page++) {
+            uint16_t index = base + page * OLED_ROW_BYTES + col;
+            uint8_t  m     = mask >> (page * 8);
+            uint8_t  old   = *oled_read_raw(index).current_element;
+            oled_write_raw_byte((old & ~m) | ((bits >> (page * 8)) & m), index);
         }
     }
 }
 
-static void clear_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h) {
-    for (uint8_t py = y; py < y + h; py++)
-        for (uint8_t px = x; px < x + w; px++)
-            oled_write_pixel(px, py, false);
-}
-
 static const char *get_layer_name(void) {
     switch (get_highest_layer(layer_state)) {
         case _BASE:    return "Base";
@@ -374,38 +427,76 @@ static const char *get_layer_name(void) {
     }
 }
 
+// ─── Widget Cache ────────────────────────────────────────────────────────────
+// Each widget remembers what it last drew and repaints only when its input
+// changes. The driver marks a block dirty only when a buffer byte changes, so
+// an idle frame touches no pixels and flushes nothing over I2C.
+
+static bool    oled_primed  = false;
+static uint8_t drawn_layer  = 0;
+static uint8_t drawn_mods   = 0;  // bit 0-3 = shift, ctrl, alt, gui active
+static char    drawn_key    = 0;
+static bool    drawn_caps   = false;
+static uint8_t drawn_wpm    = 0;
+static char    drawn_digits[3] = {0};
+
+static uint8_t mod_groups(uint8_t mods) {
+    return ((mods & MOD_MASK_SHIFT) ? 1 : 0) | ((mods & MOD_MASK_CTRL) ? 2 : 0) |
+           ((mods & MOD_MASK_ALT)   ? 4 : 0) | ((mods & MOD_MASK_GUI)  ? 8 : 0);
+}
+
 bool oled_task_user(void) {
     if (!is_keyboard_master()) return false;
 
-    oled_set_cursor(0, 0);
-    oled_write_ln_P(PSTR("GALLM"), false);
+    if (!oled_primed) {
+        oled_set_cursor(0, 0);
+        oled_write_ln_P(PSTR("GALLM"), false);
+        oled_set_cursor(0, 14);
+        oled_write_ln_P(PSTR(" WPM"), false);
+    }
 
-    oled_set_cursor(0, 1);
-    oled_write_ln(get_layer_name(), false);
+    uint8_t layer = get_highest_layer(layer_state);
+    if (!oled_primed || layer != drawn_layer) {
+        oled_set_cursor(0, 1);
+        oled_write_ln(get_layer_name(), false);
+        drawn_layer = layer;
+    }
 
-    uint8_t mods = get_mods() | get_oneshot_mods();
-    render_icon_14x14(1, 18,  (mods & MOD_MASK_SHIFT) ? icon_shift_filled : icon_shift_small);
-    render_icon_14x14(17, 18, (mods & MOD_MASK_CTRL)  ? icon_ctrl_filled  : icon_ctrl_small);
-    render_icon_14x14(1, 34,  (mods & MOD_MASK_ALT)   ? icon_opt_filled   : icon_opt_small);
-    render_icon_14x14(17, 34, (mods & MOD_MASK_GUI)   ? icon_cmd_filled   : icon_cmd_small);
+    uint8_t mods    = mod_groups(get_mods() | get_oneshot_mods());
+    uint8_t changed = oled_primed ? (mods ^ drawn_mods) : 0x0F;
+    if (changed & 1) render_icon_14x14(1, 18,  (mods & 1) ? icon_shift_filled : icon_shift_small);
+    if (changed & 2) render_icon_14x14(17, 18, (mods & 2) ? icon_ctrl_filled  : icon_ctrl_small);
+    if (changed & 4) render_icon_14x14(1, 34,  (mods & 4) ? icon_opt_filled   : icon_opt_small);
+    if (changed & 8) render_icon_14x14(17, 34, (mods & 8) ? icon_cmd_filled   : icon_cmd_small);
+    drawn_mods = mods;
 
-    clear_rect(8, 52, 15, 24);
-    if (last_key_char) {
+    // The scaled glyph covers its whole 15x24 cell, so it needs no clear
+    if (last_key_char != drawn_key) {
         render_scaled_char(8, 52, last_key_char, 3);
+        drawn_key = last_key_char;
     }
 
-    oled_set_cursor(0, 10);
-    oled_write_ln_P(is_caps_word_on() ? PSTR("  CW") : PSTR(""), false);
-
-    char wpm_str[4];
-    snprintf(wpm_str, sizeof(wpm_str), "%3d", get_current_wpm());
-    render_scaled_char(1, 96, wpm_str[0], 2);
-    render_scaled_char(11, 96, wpm_str[1], 2);
-    render_scaled_char(21, 96, wpm_str[2], 2);
+    bool caps = is_caps_word_on();
+    if (!oled_primed || caps != drawn_caps) {
+        oled_set_cursor(0, 10);
+        oled_write_ln_P(caps ? PSTR("  CW") : PSTR(""), false);
+        drawn_caps = caps;
+    }
 
-    oled_set_cursor(0, 14);
-    oled_write_ln_P(PSTR(" WPM"), false);
+    uint8_t wpm = get_current_wpm();
+    if (!oled_primed || wpm != drawn_wpm) {
+        char wpm_str[4];
+        snprintf(wpm_str, sizeof(wpm_str), "%3d", wpm);
+        for (uint8_t i = 0; i < 3; i++) {
+            if (wpm_str[i] != drawn_digits[i]) {
+                render_scaled_char(1 + i * 10, 96, wpm_str[i], 2);
+                drawn_digits[i] = wpm_str[i];
+            }
+        }
+        drawn_wpm = wpm;
+    }
 
+    oled_primed = true;
     return false;
 }
 
@@ -0,0 +1,85 @@
+// Userspace autocorrect: QMK's process_autocorrect() with the trie walk
+// swapped for lib/autocorrect_trie.h, for walk variants QMK's own code
+// cannot read (AUTOCORRECT_JUMP_TABLE, AUTOCORRECT_COMPACT_TRIE).
+//
+// The keymap includes its autocorrect_data.h, then this file, and returns
+// process_autocorrect_trie() from the end of process_record_user(). QMK's
+// walk is switched off through process_autocorrect_user(); its enable state
+// and AC_* keycodes still apply.
+
+#pragma once
+
+#include "keyboards/crkbd/lib/autocorrect_trie.h"
+
+static autocorrect_trie_buffer_t autocorrect_buffer = AUTOCORRECT_TRIE_BUFFER_INIT;
+
+// process_record_user() already ran this key through the walk below
+bool process_autocorrect_user(uint16_t *keycode, keyrecord_t *record, uint8_t *typo_buffer_size, uint8_t *mods) {
+    return false;
+}
+
+// Same key handling as process_autocorrect(); false when a correction
+// swallowed the key.
+static bool process_autocorrect_trie(uint16_t keycode, keyrecord_t *record) {
+    if (!autocorrect_is_enabled()) {
+        autocorrect_buffer.size = 0;
+        return true;
+    }
+    if (!record->event.pressed) {
+        return true;
+    }
+
+    uint8_t mods = get_mods();
+#ifndef NO_ACTION_ONESHOT
+    mods |= get_oneshot_mods();
+#endif
+    if (!process_autocorrect_default_handler(&keycode, record, &autocorrect_buffer.size, &mods)) {
+        return true;
+    }
+
+    switch (keycode) {
+        case KC_A ... KC_Z:
+            break;
+        case KC_1 ... KC_0:
+        case KC_TAB ... KC_SEMICOLON:
+        case KC_GRAVE ... KC_SLASH:
+            keycode = KC_SPC; // word boundary
+            break;
+        case KC_ENTER:
+            autocorrect_buffer.size = 0;
+            keycode                 = KC_SPC;
+            break;
+        case KC_BSPC:
+            if (autocorrect_buffer.size > 0) --autocorrect_buffer.size;
+            return true;
+        case KC_QUOTE:
+            if (mods & MOD_MASK_SHIFT) keycode = KC_SPC; // " is a boundary
+            break;
+        default:
+            autocorrect_buffer.size = 0;
+            return true;
+    }
+
+    autocorrect_trie_push(&autocorrect_buffer, keycode);
+    autocorrect_trie_leaf_t leaf = autocorrect_trie_match(AUTOCORRECT_TRIE_DATA, &autocorrect_buffer);
+    if (!leaf) {
+        return true;
+    }
+
+    for (uint8_t i = autocorrect_trie_backspaces(AUTOCORRECT_TRIE_DATA, leaf); i > 0; --i) {
+        tap_code(KC_BSPC);
+    }
+#ifdef AUTOCORRECT_COMPACT_TRIE
+    send_string(autocorrect_trie_correction(AUTOCORRECT_TRIE_DATA, leaf)); // decoded into RAM
+#else
+    send_string_P(autocorrect_trie_correction(AUTOCORRECT_TRIE_DATA, leaf));
+#endif
+
+    if (keycode == KC_SPC) {
+        autocorrect_buffer.buffer[0] = KC_SPC;
+        autocorrect_buffer.size      = 1;
+        return true;
+    }
+    autocorrect_buffer.size = 0;
+    return false;
+}
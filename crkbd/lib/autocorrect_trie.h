@@ -0,0 +1,273 @@
+// Autocorrect trie walk over an autocorrect_data.h dictionary.
+//
+// Mirrors the typo buffer and lookup in QMK's process_autocorrect() step for
+// step, with no QMK dependencies, so the same code can be compiled for the
+// board and on the host (keymaps/autocorrect/autocorrect_replay.c).
+//
+// Include the generated autocorrect_data.h first: it provides
+// autocorrect_data[], DICTIONARY_SIZE and AUTOCORRECT_MIN/MAX_LENGTH,
+// autocorrect_jump_table[] when AUTOCORRECT_JUMP_TABLE is defined, and
+// autocorrect_compact_data[] instead when AUTOCORRECT_COMPACT_TRIE is.
+// Callers walk AUTOCORRECT_TRIE_DATA, whichever of them is in use.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifndef AUTOCORRECT_TRIE_READ
+#    if defined(pgm_read_byte)
+#        define AUTOCORRECT_TRIE_READ(data, i) pgm_read_byte((data) + (i))
+#    else
+#        define AUTOCORRECT_TRIE_READ(data, i) ((data)[i])
+#    endif
+#endif
+#ifndef AUTOCORRECT_TRIE_READ_WORD
+#    if defined(pgm_read_word)
+#        define AUTOCORRECT_TRIE_READ_WORD(table, i) pgm_read_word((table) + (i))
+#    else
+#        define AUTOCORRECT_TRIE_READ_WORD(table, i) ((table)[i])
+#    endif
+#endif
+
+#if defined(AUTOCORRECT_JUMP_TABLE) && !defined(AUTOCORRECT_JUMP_TABLE_SIZE)
+#    error "AUTOCORRECT_JUMP_TABLE needs an autocorrect_data.h generated with a jump table (autocorrdata.py without --no-share)"
+#endif
+#if defined(AUTOCORRECT_COMPACT_TRIE) && !defined(AUTOCORRECT_COMPACT_SIZE)
+#    error "AUTOCORRECT_COMPACT_TRIE needs an autocorrect_data.h generated with a compact trie (autocorrdata.py without --no-share)"
+#endif
+#if defined(AUTOCORRECT_COMPACT_TRIE) && defined(AUTOCORRECT_JUMP_TABLE)
+#    error "AUTOCORRECT_COMPACT_TRIE and AUTOCORRECT_JUMP_TABLE are alternative walks; define one"
+#endif
+
+#ifdef AUTOCORRECT_COMPACT_TRIE
+#    define AUTOCORRECT_TRIE_DATA autocorrect_compact_data
+#    define AUTOCORRECT_TRIE_BYTES AUTOCORRECT_COMPACT_SIZE
+// Leaves are bit positions
+typedef uint32_t autocorrect_trie_leaf_t;
+#else
+#    define AUTOCORRECT_TRIE_DATA autocorrect_data
+#    ifdef AUTOCORRECT_JUMP_TABLE
+#        define AUTOCORRECT_TRIE_BYTES (DICTIONARY_SIZE + 2 * AUTOCORRECT_JUMP_TABLE_SIZE)
+#    else
+#        define AUTOCORRECT_TRIE_BYTES DICTIONARY_SIZE
+#    endif
+typedef uint16_t autocorrect_trie_leaf_t;
+#endif
+
+// Buffer codes are HID keycodes: letters, apostrophe, and the word boundary
+// (the ':' in dictionary entries) stored as space.
+#define AUTOCORRECT_CODE_A 0x04     // KC_A
+#define AUTOCORRECT_CODE_SPACE 0x2C // KC_SPC
+#define AUTOCORRECT_CODE_QUOTE 0x34 // KC_QUOT
+
+typedef struct {
+    uint8_t buffer[AUTOCORRECT_MAX_LENGTH];
+    uint8_t size;
+} autocorrect_trie_buffer_t;
+
+// Start of text counts as a word boundary, like QMK's initial typo buffer.
+#define AUTOCORRECT_TRIE_BUFFER_INIT {{AUTOCORRECT_CODE_SPACE}, 1}
+
+// Append a code, dropping the oldest one when the buffer is full.
+static inline void autocorrect_trie_push(autocorrect_trie_buffer_t *b, uint8_t code) {
+    if (b->size >= AUTOCORRECT_MAX_LENGTH) {
+        memmove(b->buffer, b->buffer + 1, AUTOCORRECT_MAX_LENGTH - 1);
+        b->size = AUTOCORRECT_MAX_LENGTH - 1;
+    }
+    b->buffer[b->size++] = code;
+}
+
+#ifndef AUTOCORRECT_COMPACT_TRIE
+#    ifdef AUTOCORRECT_JUMP_TABLE
+// Jump table slot of a buffer code: a-z, ', boundary.
+static inline uint8_t autocorrect_jump_slot(uint8_t code) {
+    if (code == AUTOCORRECT_CODE_QUOTE) return 26;
+    if (code == AUTOCORRECT_CODE_SPACE) return 27;
+    return code - AUTOCORRECT_CODE_A;
+}
+#    endif
+
+// Walk the trie from the newest code. Returns the offset of the matching
+// leaf in data (never 0: the root is always a node), or 0 for no typo.
+static inline autocorrect_trie_leaf_t autocorrect_trie_match(const uint8_t *data, const autocorrect_trie_buffer_t *b) {
+    if (b->size < AUTOCORRECT_MIN_LENGTH) {
+        return 0;
+    }
+
+    int8_t   i = b->size - 1;
+    uint16_t state;
+    uint8_t  code;
+#    ifdef AUTOCORRECT_JUMP_TABLE
+    // The root step is one table read instead of a scan of up to 28 children
+    state = AUTOCORRECT_TRIE_READ_WORD(autocorrect_jump_table, autocorrect_jump_slot(b->buffer[i]));
+    if (!state) return 0;
+    code = AUTOCORRECT_TRIE_READ(data, state);
+    if (code & 128) {
+        return state;
+    }
+    --i;
+#    else
+    state = 0;
+    code  = AUTOCORRECT_TRIE_READ(data, state);
+#    endif
+    for (; i >= 0; --i) {
+        uint8_t const key_i = b->buffer[i];
+
+        if (code & 64) { // Node with multiple children: find the key's link
+            code &= 63;
+            for (; code != key_i; code = AUTOCORRECT_TRIE_READ(data, (state += 3))) {
+                if (!code) return 0;
+            }
+            state = AUTOCORRECT_TRIE_READ(data, state + 1) | AUTOCORRECT_TRIE_READ(data, state + 2) << 8;
+        } else if (code != key_i) { // Chain node: the next code must match
+            return 0;
+        } else if (!(code = AUTOCORRECT_TRIE_READ(data, (++state)))) {
+            ++state;
+        }
+
+        // Safeguard against corrupt data, as in process_autocorrect()
+        if (state >= DICTIONARY_SIZE) return 0;
+
+        code = AUTOCORRECT_TRIE_READ(data, state);
+        if (code & 128) {
+            return state;
+        }
+    }
+    return 0;
+}
+
+// Characters to erase before typing the leaf's correction (on key press).
+static inline uint8_t autocorrect_trie_backspaces(const uint8_t *data, autocorrect_trie_leaf_t leaf) {
+    return AUTOCORRECT_TRIE_READ(data, leaf) & 63;
+}
+
+// The NUL-terminated correction suffix, in the same memory as data.
+static inline const char *autocorrect_trie_correction(const uint8_t *data, autocorrect_trie_leaf_t leaf) {
+    return (const char *)(data + leaf + 1);
+}
+
+#else
+// Bit-packed trie from autocorrdata.py (format in its "compact" region):
+// 5-bit symbols, per-node offset widths, shared subtrees reached by signed
+// offsets. Same walk as above, one symbol per buffer code.
+
+#    define AUTOCORRECT_COMPACT_BACKSPACE_BITS 4
+#    define AUTOCORRECT_COMPACT_QUOTE 27
+#    define AUTOCORRECT_COMPACT_BOUNDARY 28
+#    define AUTOCORRECT_COMPACT_ESCAPE 31
+
+enum { AUTOCORRECT_COMPACT_LEAF, AUTOCORRECT_COMPACT_CHAIN, AUTOCORRECT_COMPACT_BRANCH, AUTOCORRECT_COMPACT_LINK };
+
+// n (at most 25) bits starting at bit pos, most significant first.
+static inline uint32_t autocorrect_compact_bits(const uint8_t *data, uint32_t pos, uint8_t n) {
+    uint32_t i     = pos >> 3;
+    uint8_t  avail = 8 - (pos & 7);
+    uint32_t bits  = AUTOCORRECT_TRIE_READ(data, i) & (0xFF >> (pos & 7));
+    while (avail < n) {
+        bits = bits << 8 | AUTOCORRECT_TRIE_READ(data, ++i);
+        avail += 8;
+    }
+    return bits >> (avail - n);
+}
+
+// Two's complement offset of the given width.
+static inline int32_t autocorrect_compact_offset(const uint8_t *data, uint32_t pos, uint8_t width) {
+    uint32_t const sign = (uint32_t)1 << (width - 1);
+    return (int32_t)(autocorrect_compact_bits(data, pos, width) ^ sign) - (int32_t)sign;
+}
+
+// Tag of the node at *pos after following links; moves *pos past the tag.
+static inline uint8_t autocorrect_compact_node(const uint8_t *data, uint32_t *pos) {
+    uint8_t tag;
+    while ((tag = autocorrect_compact_bits(data, *pos, 2)) == AUTOCORRECT_COMPACT_LINK) {
+        uint8_t const width = autocorrect_compact_bits(data, *pos + 2, 5);
+        *pos += 7 + width + autocorrect_compact_offset(data, *pos + 7, width);
+    }
+    *pos += 2;
+    return tag;
+}
+
+static inline uint8_t autocorrect_compact_symbol(uint8_t code) {
+    if (code == AUTOCORRECT_CODE_QUOTE) return AUTOCORRECT_COMPACT_QUOTE;
+    if (code == AUTOCORRECT_CODE_SPACE) return AUTOCORRECT_COMPACT_BOUNDARY;
+    return code - AUTOCORRECT_CODE_A + 1;
+}
+
+// Walk the trie from the newest code. Returns the bit position of the
+// matching leaf's backspace count (never 0: the root is always a node), or 0
+// for no typo.
+static inline autocorrect_trie_leaf_t autocorrect_trie_match(const uint8_t *data, const autocorrect_trie_buffer_t *b) {
+    if (b->size < AUTOCORRECT_MIN_LENGTH) {
+        return 0;
+    }
+
+    uint32_t pos  = 0;
+    uint8_t  tag  = autocorrect_compact_node(data, &pos);
+    uint8_t  left = 0; // Chain symbols still to match at pos
+    for (int8_t i = b->size - 1; i >= 0; --i) {
+        uint8_t const key = autocorrect_compact_symbol(b->buffer[i]);
+
+        if (tag == AUTOCORRECT_COMPACT_CHAIN) { // The next symbol must match
+            if (!left) {
+                left = autocorrect_compact_bits(data, pos, 2) + 1;
+                pos += 2;
+            }
+            if (autocorrect_compact_bits(data, pos, 5) != key) return 0;
+            pos += 5;
+            if (--left) continue;
+        } else { // Branch: find the key's symbol, then its child
+            uint8_t const  count   = autocorrect_compact_bits(data, pos, 5) + 1;
+            uint8_t const  width   = autocorrect_compact_bits(data, pos + 5, 5);
+            uint32_t const symbols = pos + 10;
+            uint32_t const offsets = symbols + 5 * count;
+            uint8_t        j       = 0;
+            while (autocorrect_compact_bits(data, symbols + 5 * j, 5) != key) {
+                if (++j == count) return 0;
+            }
+            pos = offsets + width * (count - 1);
+            if (j) pos += autocorrect_compact_offset(data, offsets + width * (j - 1), width);
+        }
+
+        // Safeguard against corrupt data, as in process_autocorrect()
+        if (pos >= (uint32_t)AUTOCORRECT_COMPACT_SIZE * 8) return 0;
+
+        tag = autocorrect_compact_node(data, &pos);
+        if (tag == AUTOCORRECT_COMPACT_LEAF) {
+            return pos;
+        }
+    }
+    return 0;
+}
+
+// Characters to erase before typing the leaf's correction (on key press).
+static inline uint8_t autocorrect_trie_backspaces(const uint8_t *data, autocorrect_trie_leaf_t leaf) {
+    return autocorrect_compact_bits(data, leaf, AUTOCORRECT_COMPACT_BACKSPACE_BITS);
+}
+
+// The correction suffix, decoded into a static buffer (RAM, not data's
+// memory) that the next call overwrites.
+static inline const char *autocorrect_trie_correction(const uint8_t *data, autocorrect_trie_leaf_t leaf) {
+    static char correction[AUTOCORRECT_COMPACT_MAX_CORRECTION + 1];
+    uint32_t    pos = leaf + AUTOCORRECT_COMPACT_BACKSPACE_BITS;
+    uint8_t     n   = 0;
+    while (n < AUTOCORRECT_COMPACT_MAX_CORRECTION) {
+        uint8_t const symbol = autocorrect_compact_bits(data, pos, 5);
+        if (!symbol) break;
+        if (symbol == AUTOCORRECT_COMPACT_ESCAPE) {
+            correction[n++] = autocorrect_compact_bits(data, pos + 5, 7);
+            pos += 7;
+        } else if (symbol == AUTOCORRECT_COMPACT_QUOTE) {
+            correction[n++] = '\'';
+        } else if (symbol == AUTOCORRECT_COMPACT_BOUNDARY) {
+            correction[n++] = ' ';
+        } else {
+            correction[n++] = 'a' + symbol - 1;
+        }
+        pos += 5;
+    }
+    correction[n] = '\0';
+    return correction;
+}
+#endif
@@ -0,0 +1,137 @@
+// Single-producer, single-consumer state mailbox between the RP2040's cores.
+//
+// Holds the latest value of a fixed-size struct; posts overwrite, nothing
+// queues. Two slots, each guarded by a sequence counter that is odd while the
+// slot is being written: the writer always fills the slot the reader was not
+// pointed at, then publishes it, so posting never waits. A take copies the
+// published slot out and checks its counter did not move during the copy;
+// if the writer lapped it (posted twice during one copy) the take fails, so
+// taking never waits either. A failed take may leave a torn copy behind, so
+// take into a spare and keep what it had if the take fails.
+//
+// Only aligned 32-bit loads and stores and full barriers are used: the
+// Cortex-M0+ has no exclusive load/store, and SIO spinlocks would make one
+// core wait on the other.
+//
+//   static core1_mailbox_t box;
+//   static status_t        box_slots[2];
+//   core1_mailbox_post(&box, box_slots, sizeof(status_t), &status);   // producer
+//   if (core1_mailbox_take(&box, box_slots, sizeof(status_t), &copy)) // consumer
+//
+// The park handshake at the end keeps core1 off flash while core0 writes it.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Orders the slot copy against the counters on both cores (DMB on ARMv6-M)
+#define core1_mailbox_barrier() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+// Slot copy; core1_mailbox_test.c hooks it to post in the middle of a take
+#ifndef CORE1_MAILBOX_COPY
+#    define CORE1_MAILBOX_COPY memcpy
+#endif
+
+typedef struct {
+    volatile uint32_t seq[2];    // per slot; odd while being written
+    volatile uint32_t latest;    // slot of the last completed post
+    volatile uint32_t posted;    // completed posts, for core1_mailbox_fresh()
+    uint32_t          taken;     // consumer side: posted as of its last take
+} core1_mailbox_t;
+
+static inline void core1_mailbox_post(core1_mailbox_t *box, void *slots, size_t size, const void *value) {
+    uint32_t const slot = box->latest ^ 1;
+    box->seq[slot]++;
+    core1_mailbox_barrier();
+    CORE1_MAILBOX_COPY((uint8_t *)slots + slot * size, value, size);
+    core1_mailbox_barrier();
+    box->seq[slot]++;
+    box->latest = slot;
+    core1_mailbox_barrier();
+    box->posted++;
+}
+
+// True when a post landed since the consumer's last successful take. Always
+// inlined, so a RAM-resident wait loop can poll it while flash is busy.
+static inline __attribute__((always_inline)) bool core1_mailbox_fresh(const core1_mailbox_t *box) {
+    return box->posted != box->taken;
+}
+
+// Copy the latest post into value if there is a new one. False if there is
+// nothing new or the writer got in the way; value may then hold a torn copy.
+static inline bool core1_mailbox_take(core1_mailbox_t *box, const void *slots, size_t size, void *value) {
+    uint32_t const posted = box->posted;
+    if (posted == box->taken) return false;
+    core1_mailbox_barrier();
+    uint32_t const slot = box->latest;
+    uint32_t const seq  = box->seq[slot];
+    if (seq & 1) return false;
+    core1_mailbox_barrier();
+    CORE1_MAILBOX_COPY(value, (const uint8_t *)slots + slot * size, size);
+    core1_mailbox_barrier();
+    if (box->seq[slot] != seq) return false;
+    box->taken = posted;
+    return true;
+}
+
+// ─── Park Handshake ──────────────────────────────────────────────────────────
+// Holds core1 in its RAM-resident wait loop while core0 has flash busy. Core1
+// clears busy at the top of its wait loop and sets it on the way out, then
+// looks at hold again (Dekker-style); core0 sets hold, then waits for busy to
+// clear. With a full barrier between each store and the load after it, at
+// least one side sees the other, so core1 never runs from flash while core0
+// is past core1_park(). Core1 should also check core1_park_held() between
+// steps of long work and return to the loop, so the wait is one step long.
+//
+//   for (;;) {                                   // core1, in RAM
+//       core1_park_idle(&park);
+//       while (core1_park_held(&park) || !work) __WFE();
+//       if (!core1_park_leave(&park)) continue;
+//       ...
+//   }
+//   core1_park(&park); ... flash ...; core1_unpark(&park);   // core0
+
+// Body of core0's wait; core1_mailbox_test.c yields the host thread there
+#ifndef CORE1_PARK_WAIT
+#    define CORE1_PARK_WAIT()
+#endif
+
+typedef struct {
+    volatile uint32_t hold; // set by core0: stay in the wait loop
+    volatile uint32_t busy; // set by core1: out of the wait loop
+} core1_park_t;
+
+static inline __attribute__((always_inline)) bool core1_park_held(const core1_park_t *park) {
+    return park->hold;
+}
+
+// Core1, at the top of its wait loop
+static inline __attribute__((always_inline)) void core1_park_idle(core1_park_t *park) {
+    park->busy = 0;
+    core1_mailbox_barrier();
+}
+
+// Core1, leaving the wait loop; false if core0 holds it, so go back
+static inline __attribute__((always_inline)) bool core1_park_leave(core1_park_t *park) {
+    park->busy = 1;
+    core1_mailbox_barrier();
+    return !park->hold;
+}
+
+// Core0: returns once core1 is in its wait loop and will stay there
+static inline void core1_park(core1_park_t *park) {
+    park->hold = 1;
+    core1_mailbox_barrier();
+    while (park->busy) {
+        CORE1_PARK_WAIT();
+    }
+}
+
+static inline void core1_unpark(core1_park_t *park) {
+    core1_mailbox_barrier();
+    park->hold = 0;
+    core1_mailbox_barrier();
+}
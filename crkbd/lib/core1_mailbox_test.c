@@ -0,0 +1,281 @@
+// Host test for lib/core1_mailbox.h, with pthreads standing in for the cores.
+//
+//   accounting  fresh and take on an empty box, after one post, and after
+//               several posts (only the newest is taken)
+//   lapped      posts made half way through a take's copy, through the
+//               CORE1_MAILBOX_COPY hook: one post fills the other slot and
+//               the take still succeeds; two lap the reader and it must fail
+//   threads     a producer thread and a consumer thread in lockstep, each
+//               take racing the next post and every copy yielding half way:
+//               every successful take must be a whole value (no torn copy)
+//               newer than the one before, the last take must be the last
+//               post, and at least a quarter of the takes must have had a
+//               post writing during them
+//   park        core1_park() between a core0 thread "writing flash" and a
+//               core1 thread running c1_main()'s loop: core1 must never draw
+//               during a write, and parks must land both while core1 waits
+//               and while it draws (cutting the frame short)
+// Exits non-zero on the first failure.
+//   cc -O2 -pthread -o core1_mailbox_test core1_mailbox_test.c && ./core1_mailbox_test
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void *test_copy(void *dst, const void *src, size_t size);
+#define CORE1_MAILBOX_COPY test_copy
+#define CORE1_PARK_WAIT()  sched_yield()
+#include "core1_mailbox.h"
+
+#define CHECK(cond)                                                                   \
+    do {                                                                              \
+        if (!(cond)) {                                                                \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(1);                                                                  \
+        }                                                                             \
+    } while (0)
+
+// 256 bytes, so a copy is long enough for the other thread to get in
+typedef struct {
+    uint32_t n;
+    uint32_t check[63];
+} value_t;
+
+static void fill(value_t *value, uint32_t n) {
+    value->n = n;
+    for (uint32_t i = 0; i < 63; i++) value->check[i] = n * 2654435761u + i;
+}
+
+static bool whole(const value_t *value) {
+    for (uint32_t i = 0; i < 63; i++) {
+        if (value->check[i] != value->n * 2654435761u + i) return false;
+    }
+    return true;
+}
+
+static core1_mailbox_t box;
+static value_t         slots[2];
+
+static void post(uint32_t n) {
+    value_t value;
+    fill(&value, n);
+    core1_mailbox_post(&box, slots, sizeof(value_t), &value);
+}
+
+static bool take(value_t *value) {
+    return core1_mailbox_take(&box, slots, sizeof(value_t), value);
+}
+
+// ─── Copy Hook ───────────────────────────────────────────────────────────────
+// Posts mid_copy_posts values (mid_copy_next, +1, ...) after the first half of
+// the next copy, as a writer on the other core would
+
+static int      mid_copy_posts;
+static uint32_t mid_copy_next;
+static volatile int yield_mid_copy; // threads: let the other thread in half way
+
+static void *test_copy(void *dst, const void *src, size_t size) {
+    int const posts = mid_copy_posts;
+    if (posts) mid_copy_posts = 0; // the posts below copy too
+    memcpy(dst, src, size / 2);
+    for (int i = 0; i < posts; i++) post(mid_copy_next++);
+    if (yield_mid_copy) sched_yield();
+    memcpy((uint8_t *)dst + size / 2, (const uint8_t *)src + size / 2, size - size / 2);
+    return dst;
+}
+
+// ─── Tests ───────────────────────────────────────────────────────────────────
+
+static void test_accounting(void) {
+    value_t value;
+    memset(&box, 0, sizeof(box));
+    fill(&value, 0);
+
+    CHECK(!core1_mailbox_fresh(&box));
+    CHECK(!take(&value) && value.n == 0);
+
+    post(1);
+    CHECK(core1_mailbox_fresh(&box));
+    CHECK(take(&value) && value.n == 1 && whole(&value));
+    CHECK(!core1_mailbox_fresh(&box));
+    CHECK(!take(&value) && value.n == 1);
+
+    post(2);
+    post(3);
+    post(4);
+    CHECK(core1_mailbox_fresh(&box));
+    CHECK(take(&value) && value.n == 4 && whole(&value));
+    CHECK(!core1_mailbox_fresh(&box));
+}
+
+static void test_lapped(void) {
+    value_t value;
+    memset(&box, 0, sizeof(box));
+
+    // One post during the copy fills the other slot: the take gets the value
+    // it started on, and the new post is still fresh
+    post(1);
+    mid_copy_posts = 1;
+    mid_copy_next  = 2;
+    CHECK(take(&value) && value.n == 1 && whole(&value));
+    CHECK(core1_mailbox_fresh(&box));
+    CHECK(take(&value) && value.n == 2 && whole(&value));
+
+    // Two posts during the copy overwrite the slot being read: the take fails
+    // and the newest post stays fresh
+    post(3);
+    mid_copy_posts = 2;
+    mid_copy_next  = 4;
+    CHECK(!take(&value));
+    CHECK(core1_mailbox_fresh(&box));
+    CHECK(take(&value) && value.n == 5 && whole(&value));
+    CHECK(!core1_mailbox_fresh(&box));
+}
+
+// ─── Threads ─────────────────────────────────────────────────────────────────
+// The threads run in lockstep: after each post the producer waits until the
+// consumer has started a take, so every take races the next post, and each
+// copy yields the host thread half way through, so the other thread gets in
+// there even on a single-CPU host.
+
+#define THREAD_POSTS 200000u
+
+static volatile uint32_t consumer_ready, producer_done, takes_started;
+
+static void *producer(void *arg) {
+    (void)arg;
+    while (!consumer_ready) sched_yield();
+    for (uint32_t n = 1; n <= THREAD_POSTS; n++) {
+        uint32_t const started = takes_started;
+        post(n);
+        while (takes_started == started) sched_yield();
+    }
+    core1_mailbox_barrier();
+    producer_done = 1;
+    return NULL;
+}
+
+static void test_threads(void) {
+    memset(&box, 0, sizeof(box));
+    yield_mid_copy = 1;
+    pthread_t thread;
+    CHECK(pthread_create(&thread, NULL, producer, NULL) == 0);
+
+    value_t  value;
+    uint32_t last = 0, takes = 0, failed = 0, raced = 0;
+    consumer_ready = 1;
+    for (;;) {
+        bool const done = producer_done;
+        core1_mailbox_barrier();
+        if (!core1_mailbox_fresh(&box)) {
+            if (done) break;
+            sched_yield();
+            continue;
+        }
+        uint32_t const writes = box.seq[0] + box.seq[1];
+        takes_started++;
+        bool const took = take(&value);
+        if (box.seq[0] + box.seq[1] != writes) raced++; // a post wrote during this take
+        if (!took) {
+            failed++;
+            continue;
+        }
+        CHECK(whole(&value));
+        CHECK(value.n > last);
+        last = value.n;
+        takes++;
+    }
+    pthread_join(thread, NULL);
+    yield_mid_copy = 0;
+
+    CHECK(last == THREAD_POSTS);
+    CHECK(!take(&value));
+    printf("threads: %u posts, %u takes, %u raced by a post, %u failed\n", THREAD_POSTS, takes, raced, failed);
+    CHECK(takes >= THREAD_POSTS / 2);
+    CHECK(raced >= THREAD_POSTS / 4);
+}
+
+// ─── Park ────────────────────────────────────────────────────────────────────
+// A core1 thread runs c1_main()'s loop from the combined keymap: wait, leave,
+// then a frame of PARK_STEPS steps that each "read flash" and check it is not
+// being written, with core1_park_held() between steps. A core0 thread posts
+// work and parks core1 around "flash writes" at random moments. No step may
+// ever see a write in progress; both the park-while-drawing and the
+// cut-short-frame paths must be taken.
+
+#define PARK_WRITES 20000u
+#define PARK_STEPS  8
+
+static core1_park_t      park;
+static volatile uint32_t flash_writing, park_done, work_posted;
+static uint32_t          work_taken, frames, cut_short, flash_violations;
+
+static void *core1(void *arg) {
+    (void)arg;
+    bool unfinished = false;
+    for (;;) {
+        core1_park_idle(&park);
+        while (core1_park_held(&park) || !(unfinished || work_posted != work_taken)) {
+            if (park_done) return NULL;
+            sched_yield(); // __WFE()
+        }
+        sched_yield(); // core0 parks between the wait and the leave
+        if (!core1_park_leave(&park)) continue;
+
+        work_taken = work_posted;
+        unfinished = true;
+        uint8_t step;
+        for (step = 0; step < PARK_STEPS; step++) {
+            if (flash_writing) flash_violations++;
+            sched_yield(); // the widget's work, from flash
+            if (flash_writing) flash_violations++;
+            if (core1_park_held(&park)) break; // OLED_RENDER_YIELD()
+        }
+        if (step < PARK_STEPS) {
+            cut_short++;
+        } else {
+            unfinished = false;
+            frames++;
+        }
+    }
+}
+
+static void test_park(void) {
+    pthread_t thread;
+    uint32_t  waited = 0, seed = 1;
+    CHECK(pthread_create(&thread, NULL, core1, NULL) == 0);
+    for (uint32_t i = 0; i < PARK_WRITES; i++) {
+        work_posted++;
+        seed = seed * 1103515245u + 12345u;
+        for (uint32_t spin = (seed >> 16) % (2 * PARK_STEPS); spin; spin--) sched_yield();
+
+        if (park.busy) waited++; // core1 is drawing: the park has to wait
+        core1_park(&park);
+        flash_writing = 1;
+        sched_yield();
+        flash_writing = 0;
+        core1_unpark(&park);
+    }
+    park_done = 1;
+    pthread_join(thread, NULL);
+
+    printf("park: %u flash writes, %u parked while drawing, %u frames, %u cut short\n", PARK_WRITES, waited,
+           frames, cut_short);
+    CHECK(flash_violations == 0);
+    CHECK(waited >= PARK_WRITES / 10);
+    CHECK(cut_short >= PARK_WRITES / 10);
+    CHECK(frames >= PARK_WRITES / 10);
+}
+
+int main(void) {
+    test_accounting();
+    test_lapped();
+    test_threads();
+    test_park();
+    printf("core1_mailbox: all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,280 @@
+#!/usr/bin/env python3
+"""
+Flow Tap Replay for the Corne
+Replays recorded typing (lib/latency_trace.h console dumps) through a
+keymap's flow_tap_terms table, to show how often the typing-streak fast path
+would turn an intended home row mod hold into a tap, and how much decision
+latency it saves on the taps it gets right.
+"""
+
+import re
+import sys
+import json
+import argparse
+from pathlib import Path
+from statistics import median
+
+from latency_trace import NO_KEY, QK_MOD_TAP, is_tap_hold, key_name, parse_dumps
+
+
+# region keymap
+INFO_JSON = Path(__file__).resolve().parent.parent / 'info.json'
+LAYOUT = 'LAYOUT_split_3x6_3'
+DEFINE = re.compile(r'^[ \t]*#[ \t]*define[ \t]+(\w+)[ \t]+([^\s/]+)', re.MULTILINE)
+MOD_TAP_TERM = re.compile(r'get_tapping_term\s*\([^)]*\)\s*\{\s*if\s*\(IS_QK_MOD_TAP\(keycode\)\)\s*\{\s*return\s+(\w+);')
+
+
+def layout_keys(info_json: Path) -> list[int]:
+    """Trace key (row << 4 | col) of each LAYOUT_split_3x6_3 argument, in order."""
+    with open(info_json, 'r', encoding='utf-8') as f:
+        layout = json.load(f)['layouts'][LAYOUT]['layout']
+    return [row << 4 | col for row, col in (key['matrix'] for key in layout)]
+
+
+def layout_table(source: str, name: str) -> list[str]:
+    """The LAYOUT_split_3x6_3(...) arguments a per-position table is built from."""
+    m = re.search(rf'\b{name}\s*\[MATRIX_ROWS\]\s*\[MATRIX_COLS\][^=]*=\s*{LAYOUT}\(([^()]*)\)', source)
+    if not m:
+        raise SystemExit(f"error: no {name} table in the keymap")
+    return [arg.strip() for arg in m.group(1).split(',')]
+
+
+def resolve(token: str, defines: dict[str, str]) -> int:
+    seen = set()
+    while token in defines and token not in seen:
+        seen.add(token)
+        token = defines[token]
+    try:
+        return int(token, 0)
+    except ValueError:
+        raise SystemExit(f"error: cannot resolve '{token}' to a number (pass it with -D)") from None
+
+
+class Keymap:
+    """What the replay needs from a keymap directory: the flow tap window and hand of each key, and the tapping terms."""
+
+    def __init__(self, keymap_dir: Path, overrides: dict[str, str]):
+        keymap = (keymap_dir / 'keymap.c').read_text(encoding='utf-8')
+        config = (keymap_dir / 'config.h').read_text(encoding='utf-8')
+        defines = dict(DEFINE.findall(config))
+        defines.update(DEFINE.findall(keymap))
+        defines.update(overrides)
+
+        keys = layout_keys(INFO_JSON)
+        terms = layout_table(keymap, 'flow_tap_terms')
+        hands = layout_table(keymap, 'chordal_hold_layout')
+        if not len(keys) == len(terms) == len(hands):
+            raise SystemExit(f"error: expected {len(keys)} keys per table")
+        self.flow_tap_term = {key: resolve(term, defines) for key, term in zip(keys, terms)}
+        self.hand = {key: hand.strip("'") for key, hand in zip(keys, hands)}
+        self.tapping_term = resolve('TAPPING_TERM', defines)
+        m = MOD_TAP_TERM.search(keymap)  # get_tapping_term() giving mod-taps their own term
+        self.mod_tap_term = resolve(m.group(1), defines) if m else self.tapping_term
+
+    def term(self, keycode: int) -> float:
+        return self.mod_tap_term if QK_MOD_TAP[0] <= keycode <= QK_MOD_TAP[1] else self.tapping_term
+
+    def opposite_hands(self, a: int, b: int) -> bool:
+        """Chordal hold's rule: '*' keys count as the other hand from every key."""
+        ha, hb = self.hand.get(a, '*'), self.hand.get(b, '*')
+        return ha == '*' or hb == '*' or ha != hb
+
+
+# region replay
+KC_A, KC_Z = 0x04, 0x1D
+KC_LCTL, KC_RGUI = 0xE0, 0xE7
+
+
+def tap_keycode(keycode: int) -> int:
+    return keycode & 0xFF if is_tap_hold(keycode) else keycode
+
+
+class Press:
+    __slots__ = ('down', 'up', 'down_seq', 'up_seq', 'key', 'keycode', 'interrupts')
+
+    def __init__(self, down, down_seq: int, key: int, keycode: int):
+        self.down = down
+        self.up = None
+        self.down_seq = down_seq  # event order within the run, as the clock wraps
+        self.up_seq = None
+        self.key = key
+        self.keycode = keycode
+        self.interrupts: list['Press'] = []  # presses that came in while this key was down
+
+    def held_ms(self) -> float:
+        return self.up.ms_since(self.down)
+
+
+def collect_presses(runs) -> list[list[Press]]:
+    """Pair each scan-stage press with its release; presses never released are dropped."""
+    out = []
+    for run in runs:
+        presses, down = [], {}
+        for seq, event in enumerate(run):
+            if event.stage != 'S' or event.key == NO_KEY:
+                continue
+            if event.pressed:
+                press = Press(event, seq, event.key, event.keycode)
+                for other in down.values():
+                    other.interrupts.append(press)
+                down[event.key] = press
+                presses.append(press)
+            elif event.key in down:
+                press = down.pop(event.key)
+                press.up, press.up_seq = event, seq
+        out.append([p for p in presses if p.up])
+    return out
+
+
+def decided_hold(press: Press, keymap: Keymap) -> bool:
+    """
+    What the firmware without the fast path made of a tap-hold press, taken as
+    what was meant: the recording is of someone typing on that firmware, who
+    would have fixed what it got wrong. Held past the tapping term, or another
+    key pressed and released inside the hold on the other hand (permissive
+    hold filtered by chordal hold), is a hold.
+    """
+    if press.held_ms() >= keymap.term(press.keycode):
+        return True
+    return any(other.up and other.up_seq < press.up_seq and keymap.opposite_hands(press.key, other.key)
+               for other in press.interrupts)
+
+
+def tap_decided_ms(press: Press, keymap: Keymap) -> float:
+    """When the firmware without the fast path settled a tap: at release, or at a same-hand press."""
+    same_hand = [other.down.ms_since(press.down) for other in press.interrupts
+                 if not keymap.opposite_hands(press.key, other.key)]
+    return min([press.held_ms()] + same_hand)
+
+
+def mods_held(at: Press, earlier: list[Press], keymap: Keymap) -> bool:
+    """get_mods() at a press: a modifier key down, or a mod-tap held past its term."""
+    for press in earlier:
+        if press.up_seq < at.down_seq:
+            continue  # released before this press
+        if KC_LCTL <= press.keycode <= KC_RGUI:
+            return True
+        if is_tap_hold(press.keycode) and at.down.ms_since(press.down) >= keymap.term(press.keycode):
+            return True
+    return False
+
+
+class Outcome:
+    __slots__ = ('presses', 'streak', 'wrong_taps', 'saved_ms')
+
+    def __init__(self):
+        self.presses = 0
+        self.streak = 0
+        self.wrong_taps: list[tuple[Press, Press, float]] = []
+        self.saved_ms: list[float] = []
+
+
+def replay(runs: list[list[Press]], keymap: Keymap) -> dict[int, Outcome]:
+    """Per tap-hold key position, what get_flow_tap_term() would have done."""
+    outcomes: dict[int, Outcome] = {}
+    for presses in runs:
+        for i, press in enumerate(presses):
+            window = keymap.flow_tap_term.get(press.key, 0)
+            if not is_tap_hold(press.keycode) or not window:
+                continue
+            outcome = outcomes.setdefault(press.key, Outcome())
+            outcome.presses += 1
+            if not i:
+                continue
+            prev = presses[i - 1]
+            gap = press.down.ms_since(prev.down)
+            if not KC_A <= tap_keycode(prev.keycode) <= KC_Z or gap >= window:
+                continue
+            if mods_held(press, presses[max(0, i - 16):i], keymap):
+                continue
+            outcome.streak += 1
+            if decided_hold(press, keymap):
+                outcome.wrong_taps.append((press, prev, gap))
+            else:
+                outcome.saved_ms.append(tap_decided_ms(press, keymap))
+    return outcomes
+
+
+# region report
+def rate(part: int, whole: int) -> str:
+    return f"{100 * part / whole:5.1f}%" if whole else "    -"
+
+
+def print_report(outcomes: dict[int, Outcome], keymap: Keymap, top: int):
+    print(f"{'key':>5} {'window':>6} {'presses':>8} {'streak':>7} {'wrong taps':>11} {'saved p50':>10}")
+    totals = Outcome()
+    for key in sorted(outcomes, key=lambda k: (k & 0x40, k)):
+        o = outcomes[key]
+        saved = f"{median(o.saved_ms):7.1f} ms" if o.saved_ms else ' ' * 10
+        print(f"{key_name(key):>5} {keymap.flow_tap_term[key]:4d}ms {o.presses:8d} {o.streak:7d} "
+              f"{len(o.wrong_taps):4d} {rate(len(o.wrong_taps), o.streak)} {saved}")
+        totals.presses += o.presses
+        totals.streak += o.streak
+        totals.wrong_taps += o.wrong_taps
+        totals.saved_ms += o.saved_ms
+
+    print(f"\n{totals.presses} tap-hold presses, {totals.streak} in a typing streak "
+          f"({rate(totals.streak, totals.presses).strip()})")
+    print(f"  wrong taps (held on purpose, fast path tapped): {len(totals.wrong_taps)} "
+          f"({rate(len(totals.wrong_taps), totals.streak).strip()} of streak presses)")
+    if totals.saved_ms:
+        print(f"  decision latency saved on streak taps: median {median(totals.saved_ms):.1f} ms, "
+              f"total {sum(totals.saved_ms) / 1000:.1f} s")
+
+    if totals.wrong_taps and top:
+        print(f"\nWrong taps (first {top}): key, previous key, gap after it, hold length")
+        for press, prev, gap in totals.wrong_taps[:top]:
+            print(f"  {key_name(press.key):>5} 0x{press.keycode:04X}  after 0x{prev.keycode:04X} "
+                  f"{gap:6.1f} ms, held {press.held_ms():6.1f} ms")
+
+
+# region cli
+def parse_define(text: str) -> tuple[str, str]:
+    name, sep, value = text.partition('=')
+    if not sep or not name:
+        raise argparse.ArgumentTypeError(f"expected NAME=VALUE, got '{text}'")
+    return name, value
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Replay lib/latency_trace.h dumps through a keymap's flow_tap_terms "
+                    "and report misfires per key",
+        epilog='Example: %(prog)s --keymap ../keymaps/qwerty -D FLOW_TAP_TERM=120 trace.log',
+    )
+    parser.add_argument('logs', nargs='*', help='Console logs to read (default: stdin)')
+    parser.add_argument('--keymap', type=Path, required=True,
+                        help='Keymap directory holding keymap.c and config.h')
+    parser.add_argument('-D', dest='defines', type=parse_define, action='append', default=[],
+                        metavar='NAME=VALUE',
+                        help='Override a config.h/keymap.c define, e.g. FLOW_TAP_TERM=120; a '
+                             'get_tapping_term() mod-tap term (TAPPING_TERM_MOD_TAP) is read from keymap.c')
+    parser.add_argument('--top', type=int, default=10, help='Wrong taps to list (default: 10, 0 to skip)')
+    parser.add_argument('--json', action='store_true', help='Print the per-key counts as JSON instead')
+    args = parser.parse_args()
+
+    keymap = Keymap(args.keymap, dict(args.defines))
+    lines = []
+    for path in args.logs or ['-']:
+        with (sys.stdin if path == '-' else open(path, 'r', encoding='utf-8', errors='replace')) as f:
+            lines += f.readlines()
+    runs, dropped = parse_dumps(lines)
+    if not runs:
+        raise SystemExit("error: no latency trace events found (is LATENCY_TRACE_ENABLE = yes?)")
+
+    outcomes = replay(collect_presses(runs), keymap)
+    if args.json:
+        json.dump({key_name(key): {'window': keymap.flow_tap_term[key], 'presses': o.presses,
+                                   'streak': o.streak, 'wrong_taps': len(o.wrong_taps),
+                                   'saved_ms_p50': median(o.saved_ms) if o.saved_ms else None}
+                   for key, o in sorted(outcomes.items())}, sys.stdout, indent=2)
+        print()
+    else:
+        print_report(outcomes, keymap, args.top)
+    if dropped:
+        print(f"\n{dropped} events were dropped on the board; presses around them are skipped",
+              file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
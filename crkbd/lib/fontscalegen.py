@@ -0,0 +1,219 @@
+#!/usr/bin/env python3
+"""
+Scaled Glyph Generator for the Corne OLED
+Pre-scales glcdfont_custom.c into OLED page/column byte tables so the keymaps
+can blit big characters a byte at a time instead of pixel by pixel.
+"""
+
+import re
+import sys
+import argparse
+from pathlib import Path
+
+
+FONT_WIDTH = 6      # bytes per glyph in glcdfont_custom.c
+GLYPH_COLS = 5      # the 6th column is inter-character spacing, never drawn
+GLYPH_ROWS = 8
+PRINTABLE = "".join(chr(c) for c in range(0x20, 0x7F))
+
+# (table name, scale, characters) — only what the status widgets draw
+TABLES = [
+    ("font_3x", 3, PRINTABLE),
+    ("font_2x", 2, " 0123456789"),
+]
+
+
+# region font parsing
+def load_font(path: Path) -> list[list[int]]:
+    """Parse the font[] array out of glcdfont_custom.c into per-glyph column bytes."""
+    text = path.read_text(encoding="utf-8")
+    text = re.sub(r"//[^\n]*", "", text)
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    body = re.search(r"font\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", text, flags=re.S)
+    if not body:
+        raise SystemExit(f"error: no font[] PROGMEM array in {path}")
+    data = [int(tok, 16) for tok in re.findall(r"0x[0-9A-Fa-f]{2}", body.group(1))]
+    if len(data) % FONT_WIDTH:
+        raise SystemExit(f"error: font[] length {len(data)} is not a multiple of {FONT_WIDTH}")
+    return [data[i:i + FONT_WIDTH] for i in range(0, len(data), FONT_WIDTH)]
+
+
+# region scaling
+def scale_glyph(columns: list[int], scale: int) -> list[int]:
+    """
+    Upscale one glyph into page-major OLED bytes.
+
+    Output is `scale` pages of `GLYPH_COLS * scale` columns each; bit n of a
+    byte is pixel row n within its page, matching the SSD1306 buffer layout.
+    """
+    width = GLYPH_COLS * scale
+    out = [0] * (width * scale)
+    for col in range(GLYPH_COLS):
+        bits = 0
+        for row in range(GLYPH_ROWS):
+            if (columns[col] >> row) & 1:
+                bits |= ((1 << scale) - 1) << (row * scale)
+        for dx in range(scale):
+            for page in range(scale):
+                out[page * width + col * scale + dx] = (bits >> (page * 8)) & 0xFF
+    return out
+
+
+# region verification
+class Canvas:
+    """Logical 32x128 OLED buffer (OLED_ROTATION_270), index = x + (y / 8) * 32."""
+    WIDTH = 32
+    HEIGHT = 128
+
+    def __init__(self, fill: int = 0):
+        self.buf = [fill] * (self.WIDTH * self.HEIGHT // 8)
+        self.writes = 0
+
+    def write_pixel(self, x: int, y: int, on: bool):
+        if x >= self.WIDTH or y >= self.HEIGHT:
+            return
+        idx = x + (y // 8) * self.WIDTH
+        if on:
+            self.buf[idx] |= 1 << (y % 8)
+        else:
+            self.buf[idx] &= ~(1 << (y % 8)) & 0xFF
+        self.writes += 1
+
+    def write_byte(self, data: int, idx: int):
+        if idx < len(self.buf):
+            self.buf[idx] = data
+            self.writes += 1
+
+
+def render_per_pixel(canvas: Canvas, x: int, y: int, columns: list[int], scale: int):
+    """Reference: the old render_scaled_char, one oled_write_pixel per output pixel."""
+    for col in range(GLYPH_COLS):
+        for row in range(GLYPH_ROWS):
+            on = bool((columns[col] >> row) & 1)
+            for dx in range(scale):
+                for dy in range(scale):
+                    canvas.write_pixel(x + col * scale + dx, y + row * scale + dy, on)
+
+
+def render_blit(canvas: Canvas, x: int, y: int, glyph: list[int], scale: int):
+    """Mirror of the keymaps' render_scaled_char byte blitter."""
+    width = GLYPH_COLS * scale
+    shift = y & 7
+    base = (y >> 3) * Canvas.WIDTH + x
+    span = scale + (1 if shift else 0)
+    mask = ((1 << (scale * 8)) - 1) << shift
+    for col in range(width):
+        bits = 0
+        for page in range(scale):
+            bits |= glyph[page * width + col] << (page * 8)
+        bits <<= shift
+        for page in range(span):
+            m = (mask >> (page * 8)) & 0xFF
+            idx = base + page * Canvas.WIDTH + col
+            old = canvas.buf[idx] if idx < len(canvas.buf) else 0
+            canvas.write_byte((old & ~m & 0xFF) | ((bits >> (page * 8)) & m), idx)
+
+
+def verify(font: list[list[int]], tables: dict[str, list[list[int]]], verbose: bool) -> bool:
+    """Check every generated glyph against the per-pixel reference at every y alignment."""
+    ok = True
+    for name, scale, chars in TABLES:
+        pixel_writes = blit_writes = draws = 0
+        for i, ch in enumerate(chars):
+            columns = font[ord(ch)]
+            for y in range(8, 16):
+                for fill in (0x00, 0xFF):
+                    ref, out = Canvas(fill), Canvas(fill)
+                    render_per_pixel(ref, 1, y, columns, scale)
+                    render_blit(out, 1, y, tables[name][i], scale)
+                    if ref.buf != out.buf:
+                        print(f"  MISMATCH {name} {ch!r} at y={y} fill=0x{fill:02X}", file=sys.stderr)
+                        ok = False
+                    pixel_writes += ref.writes
+                    blit_writes += out.writes
+                    draws += 1
+        if verbose:
+            print(f"  {name}: {len(chars)} glyphs, "
+                  f"{pixel_writes / draws:.0f} pixel writes -> {blit_writes / draws:.0f} byte writes per draw "
+                  f"({pixel_writes / blit_writes:.1f}x fewer)", file=sys.stderr)
+    return ok
+
+
+# region output
+def emit_header(font_path: Path, tables: dict[str, list[list[int]]]) -> str:
+    lines = [
+        f"// Generated by fontscalegen.py from {font_path.name} — do not edit by hand.",
+        "// Each glyph is `scale` OLED pages of (5 * scale) column bytes, page-major;",
+        "// bit n of a byte is pixel row n within that page.",
+        "",
+        "#pragma once",
+        "",
+        "#include \"progmem.h\"",
+        "",
+    ]
+    for name, scale, chars in TABLES:
+        width = GLYPH_COLS * scale
+        size = width * scale
+        upper = name.upper()
+        lines.append(f"#define {upper}_WIDTH {width}")
+        lines.append(f"#define {upper}_PAGES {scale}")
+        lines.append("")
+        lines.append(f"static const uint8_t {name}[{len(chars)}][{size}] PROGMEM = {{")
+        for ch, glyph in zip(chars, tables[name]):
+            label = "space" if ch == " " else ("backslash" if ch == "\\" else ch)
+            lines.append(f"    {{   // 0x{ord(ch):02X} {label}")
+            for page in range(scale):
+                row = glyph[page * width:(page + 1) * width]
+                lines.append("        " + ", ".join(f"0x{b:02X}" for b in row) + ",")
+            lines.append("    },")
+        lines.append("};")
+        lines.append("")
+
+    lines += [
+        "// Unsupported characters fall back to a blank glyph.",
+        "static inline const uint8_t *font_3x_glyph(char c) {",
+        "    if (c < 0x20 || c > 0x7E) c = ' ';",
+        "    return font_3x[c - 0x20];",
+        "}",
+        "",
+        "static inline const uint8_t *font_2x_glyph(char c) {",
+        "    return font_2x[(c >= '0' && c <= '9') ? c - '0' + 1 : 0];",
+        "}",
+        "",
+    ]
+    return "\n".join(lines)
+
+
+# region cli
+def main():
+    here = Path(__file__).resolve().parent
+    parser = argparse.ArgumentParser(description="Generate pre-scaled OLED glyph tables")
+    parser.add_argument("--font", type=Path, default=here / "glcdfont_custom.c",
+                        help="Source font (default: glcdfont_custom.c next to this script)")
+    parser.add_argument("-o", "--output", type=Path, default=here / "glcdfont_scaled.h",
+                        help="Output header (default: glcdfont_scaled.h next to this script)")
+    parser.add_argument("--check", action="store_true",
+                        help="Verify against the existing header instead of writing it")
+    parser.add_argument("-v", "--verbose", action="store_true", help="Print write-count statistics")
+    args = parser.parse_args()
+
+    font = load_font(args.font)
+    tables = {name: [scale_glyph(font[ord(ch)], scale) for ch in chars] for name, scale, chars in TABLES}
+
+    if not verify(font, tables, args.verbose):
+        raise SystemExit("error: scaled glyphs do not match the per-pixel reference")
+
+    header = emit_header(args.font, tables)
+    if args.check:
+        current = args.output.read_text(encoding="utf-8") if args.output.exists() else ""
+        if current != header:
+            raise SystemExit(f"error: {args.output} is stale; re-run fontscalegen.py")
+        print(f"{args.output} is up to date", file=sys.stderr)
+        return
+
+    args.output.write_text(header, encoding="utf-8")
+    print(f"Wrote {args.output}", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,145 @@
+// Keystroke latency tracer: timestamps every key event at each stage QMK
+// passes it through, keeps the events in a RAM ring buffer and dumps them
+// over the console once typing pauses, for lib/latency_trace.py.
+//
+// Stages, as seen from userspace:
+//   scan   pre_process_record_user(): the debounced change, in the same scan
+//          loop that detected it, before combos and tap-hold buffering
+//   combo  process_combo_event(): a combo fired (keycode field = combo index)
+//   hold   process_record_user(): the event left the combo and tap-hold
+//          buffers, i.e. its tap or hold was decided
+//   report post_process_record_user(): the action ran and its HID report
+//          was handed to the USB stack
+//
+// Enabled by LATENCY_TRACE_ENABLE = yes in rules.mk (which turns the console
+// on). The keymap includes this file and calls latency_trace_hold(),
+// latency_trace_combo() and latency_trace_task() from its own hooks; they
+// compile to nothing when tracing is off. When on, this file defines
+// pre_process_record_user() and post_process_record_user().
+
+#pragma once
+
+#ifdef LATENCY_TRACE_ENABLE
+
+#    include "print.h"
+
+// Events kept between dumps (power of two); 8 bytes each
+#    ifndef LATENCY_TRACE_SIZE
+#        define LATENCY_TRACE_SIZE 256
+#    endif
+// Quiet time (ms) after the last event before the buffer is dumped
+#    ifndef LATENCY_TRACE_IDLE_MS
+#        define LATENCY_TRACE_IDLE_MS 500
+#    endif
+// Events printed per housekeeping pass, so a dump never blocks for long
+#    ifndef LATENCY_TRACE_DUMP_BATCH
+#        define LATENCY_TRACE_DUMP_BATCH 8
+#    endif
+
+_Static_assert((LATENCY_TRACE_SIZE & (LATENCY_TRACE_SIZE - 1)) == 0, "LATENCY_TRACE_SIZE must be a power of two");
+
+// Free-running 32-bit clock: the ChibiOS system timer (1 MHz on the RP2040),
+// else the millisecond timer.
+#    ifndef LATENCY_TRACE_CLOCK
+#        ifdef PROTOCOL_CHIBIOS
+#            include <ch.h>
+#            define LATENCY_TRACE_CLOCK() ((uint32_t)chVTGetSystemTimeX())
+#            define LATENCY_TRACE_CLOCK_HZ CH_CFG_ST_FREQUENCY
+#        else
+#            define LATENCY_TRACE_CLOCK() timer_read32()
+#            define LATENCY_TRACE_CLOCK_HZ 1000
+#        endif
+#    endif
+
+enum {
+    LATENCY_TRACE_SCAN,
+    LATENCY_TRACE_COMBO,
+    LATENCY_TRACE_HOLD,
+    LATENCY_TRACE_REPORT,
+};
+#    define LATENCY_TRACE_PRESSED 0x80
+#    define LATENCY_TRACE_NO_KEY 0xFF
+
+typedef struct {
+    uint32_t time;    // LATENCY_TRACE_CLOCK ticks
+    uint16_t keycode; // combo index for LATENCY_TRACE_COMBO
+    uint8_t  key;     // row << 4 | col, LATENCY_TRACE_NO_KEY for combos
+    uint8_t  stage;   // LATENCY_TRACE_* | LATENCY_TRACE_PRESSED
+} latency_trace_event_t;
+
+static latency_trace_event_t latency_trace_events[LATENCY_TRACE_SIZE];
+static uint16_t              latency_trace_head;    // next slot to write
+static uint16_t              latency_trace_tail;    // next slot to dump
+static uint16_t              latency_trace_dropped; // overwritten before a dump
+static uint16_t              latency_trace_last;    // timer_read() of the last event
+static bool                  latency_trace_dumping;
+
+static void latency_trace_record(uint8_t stage, uint8_t key, uint16_t keycode, bool pressed) {
+    uint16_t const next = (latency_trace_head + 1) & (LATENCY_TRACE_SIZE - 1);
+    if (next == latency_trace_tail) { // full: drop the oldest event
+        latency_trace_tail = (latency_trace_tail + 1) & (LATENCY_TRACE_SIZE - 1);
+        ++latency_trace_dropped;
+    }
+    latency_trace_events[latency_trace_head] = (latency_trace_event_t){
+        .time    = LATENCY_TRACE_CLOCK(),
+        .keycode = keycode,
+        .key     = key,
+        .stage   = stage | (pressed ? LATENCY_TRACE_PRESSED : 0),
+    };
+    latency_trace_head = next;
+    latency_trace_last = timer_read();
+}
+
+static void latency_trace_key(uint8_t stage, uint16_t keycode, keyrecord_t *record) {
+    uint8_t key = LATENCY_TRACE_NO_KEY;
+    if (IS_KEYEVENT(record->event)) {
+        key = record->event.key.row << 4 | record->event.key.col;
+    }
+    latency_trace_record(stage, key, keycode, record->event.pressed);
+}
+
+bool pre_process_record_user(uint16_t keycode, keyrecord_t *record) {
+    latency_trace_key(LATENCY_TRACE_SCAN, keycode, record);
+    return true;
+}
+
+void post_process_record_user(uint16_t keycode, keyrecord_t *record) {
+    latency_trace_key(LATENCY_TRACE_REPORT, keycode, record);
+}
+
+static inline void latency_trace_hold(uint16_t keycode, keyrecord_t *record) {
+    latency_trace_key(LATENCY_TRACE_HOLD, keycode, record);
+}
+
+static inline void latency_trace_combo(uint16_t combo_index, bool pressed) {
+    latency_trace_record(LATENCY_TRACE_COMBO, LATENCY_TRACE_NO_KEY, combo_index, pressed);
+}
+
+// Dump a batch once typing has paused. Each dump starts with
+// "lt hz <clock Hz> dropped <count>", then one line per event:
+// "lt <time> <stage S/C/H/R> <key> <d/u> <keycode>", all hex.
+static void latency_trace_task(void) {
+    if (latency_trace_tail == latency_trace_head) {
+        latency_trace_dumping = false;
+        return;
+    }
+    if (timer_elapsed(latency_trace_last) < LATENCY_TRACE_IDLE_MS) return;
+
+    if (!latency_trace_dumping) {
+        uprintf("lt hz %lu dropped %u\n", (unsigned long)LATENCY_TRACE_CLOCK_HZ, latency_trace_dropped);
+        latency_trace_dropped = 0;
+        latency_trace_dumping = true;
+    }
+    for (uint8_t n = 0; n < LATENCY_TRACE_DUMP_BATCH && latency_trace_tail != latency_trace_head; ++n) {
+        latency_trace_event_t const *e = &latency_trace_events[latency_trace_tail];
+        uprintf("lt %08lX %c %02X %c %04X\n", (unsigned long)e->time, "SCHR"[e->stage & 3], e->key,
+                e->stage & LATENCY_TRACE_PRESSED ? 'd' : 'u', e->keycode);
+        latency_trace_tail = (latency_trace_tail + 1) & (LATENCY_TRACE_SIZE - 1);
+    }
+}
+
+#else
+static inline void latency_trace_hold(uint16_t keycode, keyrecord_t *record) {}
+static inline void latency_trace_combo(uint16_t combo_index, bool pressed) {}
+static inline void latency_trace_task(void) {}
+#endif
@@ -0,0 +1,218 @@
+#!/usr/bin/env python3
+"""
+Keystroke Latency Analyzer for the Corne
+Turns lib/latency_trace.h console dumps (qmk console or hid_listen output)
+into per-stage latency histograms, to show what the tapping term, combo
+term and per-key home row mod terms cost in practice.
+"""
+
+import re
+import sys
+import json
+import argparse
+from statistics import median
+
+
+# region parsing
+HEADER = re.compile(r'\blt hz (\d+) dropped (\d+)')
+EVENT = re.compile(r'\blt ([0-9A-Fa-f]{8}) ([SCHR]) ([0-9A-Fa-f]{2}) ([du]) ([0-9A-Fa-f]{4})\b')
+NO_KEY = 0xFF
+CLOCK_WRAP = 1 << 32
+
+# QMK keycode ranges whose press waits for a tap-or-hold decision
+QK_MOD_TAP = (0x2000, 0x3FFF)
+QK_LAYER_TAP = (0x4000, 0x4FFF)
+
+
+class Event:
+    __slots__ = ('time', 'stage', 'key', 'pressed', 'keycode', 'hz')
+
+    def __init__(self, time: int, stage: str, key: int, pressed: bool, keycode: int, hz: int):
+        self.time = time
+        self.stage = stage
+        self.key = key
+        self.pressed = pressed
+        self.keycode = keycode
+        self.hz = hz
+
+    def ms_since(self, earlier: 'Event') -> float:
+        return ((self.time - earlier.time) % CLOCK_WRAP) * 1000 / self.hz
+
+
+def parse_dumps(lines) -> tuple[list[list[Event]], int]:
+    """
+    Split console output into runs of consecutive events. A dump that
+    reports dropped events starts a new run, since events are missing
+    between it and the previous one. Returns the runs and the drop total.
+    """
+    runs: list[list[Event]] = [[]]
+    hz, dropped = None, 0
+    for line in lines:
+        m = HEADER.search(line)
+        if m:
+            hz = int(m.group(1))
+            if int(m.group(2)):
+                dropped += int(m.group(2))
+                runs.append([])
+            continue
+        m = EVENT.search(line)
+        if m and hz:
+            runs[-1].append(Event(int(m.group(1), 16), m.group(2), int(m.group(3), 16), m.group(4) == 'd',
+                                  int(m.group(5), 16), hz))
+    return [run for run in runs if run], dropped
+
+
+def key_name(key: int) -> str:
+    return f"{key >> 4}x{key & 15}"
+
+
+def is_tap_hold(keycode: int) -> bool:
+    return any(lo <= keycode <= hi for lo, hi in (QK_MOD_TAP, QK_LAYER_TAP))
+
+
+# region pairing
+STAGES = [
+    ('scan -> hold, tap-hold keys', 'Tap-or-hold decision (TAPPING_TERM, per-key terms, permissive hold)'),
+    ('scan -> hold, other keys', 'Held back by the combo buffer (COMBO_TERM) or behind an undecided tap-hold key'),
+    ('scan -> combo', 'First key of a combo to the combo firing'),
+    ('hold -> report', 'Keymap code and the action up to the HID report'),
+    ('scan -> report', 'End to end'),
+]
+
+
+def pair_events(runs: list[list[Event]], combo_term: float) -> tuple[dict[str, list[float]],
+                                                                     dict[tuple[int, int], list[float]]]:
+    """
+    Follow each key press through the stages. Returns the latencies (ms) per
+    stage, and the scan -> hold latencies per (key, keycode).
+
+    The combo and tap-hold buffers release a key's presses in the order they
+    came in, so a hold pairs with the key's oldest waiting scan. A combo
+    eats the presses still waiting that came in within combo_term of it.
+    The report, if any, follows its hold within the same process_record()
+    call; a hold without one was swallowed by the keymap.
+    """
+    latencies: dict[str, list[float]] = {name: [] for name, _ in STAGES}
+    per_key: dict[tuple[int, int], list[float]] = {}
+    for run in runs:
+        scanned: dict[int, list[Event]] = {}
+        held: dict[int, tuple[Event, Event]] = {}
+        for event in run:
+            if not event.pressed:
+                continue
+            if event.stage == 'S' and event.key != NO_KEY:
+                scanned.setdefault(event.key, []).append(event)
+            elif event.stage == 'C':
+                members = [e for waiting in scanned.values() for e in waiting if event.ms_since(e) <= combo_term]
+                if members:
+                    latencies['scan -> combo'].append(max(event.ms_since(e) for e in members))
+                for waiting in scanned.values():
+                    waiting[:] = [e for e in waiting if e not in members]
+            elif event.stage == 'H' and scanned.get(event.key):
+                scan = scanned[event.key].pop(0)
+                delay = event.ms_since(scan)
+                stage = 'scan -> hold, tap-hold keys' if is_tap_hold(scan.keycode) else 'scan -> hold, other keys'
+                latencies[stage].append(delay)
+                per_key.setdefault((scan.key, scan.keycode), []).append(delay)
+                held[event.key] = (scan, event)
+            elif event.stage == 'R' and event.key in held:
+                scan, hold = held.pop(event.key)
+                latencies['hold -> report'].append(event.ms_since(hold))
+                latencies['scan -> report'].append(event.ms_since(scan))
+    return latencies, per_key
+
+
+# region report
+BUCKETS_MS = [1, 2, 5, 10, 20, 50, 100, 150, 200, 250, 300, 400, 500]
+
+
+def percentile(values: list[float], p: float) -> float:
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(p / 100 * len(ordered)))]
+
+
+def summarize(values: list[float]) -> dict:
+    if not values:
+        return {'count': 0}
+    return {
+        'count': len(values),
+        'p50': percentile(values, 50),
+        'p90': percentile(values, 90),
+        'p99': percentile(values, 99),
+        'max': max(values),
+    }
+
+
+def histogram(values: list[float], width: int = 40) -> list[str]:
+    counts = [0] * (len(BUCKETS_MS) + 1)
+    for v in values:
+        counts[next((i for i, edge in enumerate(BUCKETS_MS) if v < edge), len(BUCKETS_MS))] += 1
+    peak = max(counts)
+    lines = []
+    for i, count in enumerate(counts):
+        if not count:
+            continue
+        label = f"< {BUCKETS_MS[i]}" if i < len(BUCKETS_MS) else f">= {BUCKETS_MS[-1]}"
+        lines.append(f"  {label:>7} ms {count:6d} {'#' * max(1, round(width * count / peak))}")
+    return lines
+
+
+def print_report(latencies: dict[str, list[float]], per_key: dict[tuple[int, int], list[float]],
+                 dropped: int, top: int):
+    for name, description in STAGES:
+        values = latencies[name]
+        stats = summarize(values)
+        print(f"{name}: {description}")
+        if not values:
+            print("  no events\n")
+            continue
+        print(f"  {stats['count']} presses, p50 {stats['p50']:.2f} ms, p90 {stats['p90']:.2f} ms, "
+              f"p99 {stats['p99']:.2f} ms, max {stats['max']:.2f} ms")
+        print("\n".join(histogram(values)) + "\n")
+
+    if per_key and top:
+        print(f"Slowest keys from scan to hold (median, top {top}):")
+        ranked = sorted(per_key.items(), key=lambda kv: -median(kv[1]))[:top]
+        for (key, keycode), values in ranked:
+            kind = 'tap-hold' if is_tap_hold(keycode) else 'other'
+            print(f"  {key_name(key):>5} 0x{keycode:04X} {kind:<8} {len(values):5d} presses, "
+                  f"median {median(values):7.2f} ms, max {max(values):7.2f} ms")
+    if dropped:
+        print(f"\n{dropped} events were dropped on the board (raise LATENCY_TRACE_SIZE "
+              f"or pause typing more often)", file=sys.stderr)
+
+
+# region cli
+def main():
+    parser = argparse.ArgumentParser(
+        description='Per-stage keystroke latency histograms from lib/latency_trace.h console dumps',
+        epilog='Example: qmk console | tee trace.log, type for a while, then: %(prog)s trace.log',
+    )
+    parser.add_argument('logs', nargs='*', help='Console logs to read (default: stdin)')
+    parser.add_argument('--combo-term', type=float, default=80,
+                        help="The keymap's COMBO_TERM in ms: presses this close before a combo fired "
+                             "are taken as its keys (default: 80)")
+    parser.add_argument('--top', type=int, default=10,
+                        help='Keys to list in the slowest-decision table (default: 10, 0 to skip)')
+    parser.add_argument('--json', action='store_true', help='Print the per-stage statistics as JSON instead')
+    args = parser.parse_args()
+
+    lines = []
+    for path in args.logs or ['-']:
+        with (sys.stdin if path == '-' else open(path, 'r', encoding='utf-8', errors='replace')) as f:
+            lines += f.readlines()
+    runs, dropped = parse_dumps(lines)
+    if not runs:
+        raise SystemExit("error: no latency trace events found (is LATENCY_TRACE_ENABLE = yes?)")
+
+    latencies, per_key = pair_events(runs, args.combo_term)
+    if args.json:
+        json.dump({'dropped': dropped, 'stages': {name: summarize(latencies[name]) for name, _ in STAGES}},
+                  sys.stdout, indent=2)
+        print()
+    else:
+        print_report(latencies, per_key, dropped, args.top)
+
+
+if __name__ == "__main__":
+    main()
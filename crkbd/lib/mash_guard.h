@@ -0,0 +1,79 @@
+// Mash guard: drops the presses that end an accidental mash, i.e. several
+// physically adjacent keys landing together under a palm or a sliding finger,
+// while fast rolls between two neighbouring keys still type.
+//
+// The last MASH_GUARD_HISTORY plain presses are kept in a ring with their
+// matrix position. A press extends the longest chain of neighbouring keys
+// whose latest press landed less than MASH_GUARD_TERM before it, the same gap
+// the guard has always used between two presses; a press that makes the chain
+// MASH_GUARD_MIN_KEYS long is a mash and is dropped, as is every further
+// neighbour that keeps within the gap. Mod-tap and layer-tap keys are left to
+// the tapping code and never join a chain. One pass over a fixed-size ring
+// per press.
+//
+// Neighbours are keys on the same half one row and column apart on the
+// matrix: crkbd's matrix follows corne.json's grid on both halves (mirrored
+// on the right) and puts the thumb keys under columns 3-5.
+//
+// Dropped presses are counted in mash_guard_dropped and reported on the
+// console (with debug on) for tuning the term and key count.
+
+#pragma once
+
+// Largest gap (ms) between two presses of one mash
+#ifndef MASH_GUARD_TERM
+#    define MASH_GUARD_TERM 8
+#endif
+// Neighbouring keys in the window that make a mash
+#ifndef MASH_GUARD_MIN_KEYS
+#    define MASH_GUARD_MIN_KEYS 3
+#endif
+// Presses kept (power of two, at least MASH_GUARD_MIN_KEYS - 1)
+#ifndef MASH_GUARD_HISTORY
+#    define MASH_GUARD_HISTORY 4
+#endif
+
+_Static_assert((MASH_GUARD_HISTORY & (MASH_GUARD_HISTORY - 1)) == 0, "MASH_GUARD_HISTORY must be a power of two");
+_Static_assert(MASH_GUARD_HISTORY >= MASH_GUARD_MIN_KEYS - 1, "MASH_GUARD_HISTORY is too short for MASH_GUARD_MIN_KEYS");
+
+typedef struct {
+    uint16_t time;  // event time of this press
+    keypos_t key;
+    uint8_t  chain; // presses in its chain, this one included; 0 = empty slot
+} mash_guard_press_t;
+
+static mash_guard_press_t mash_guard_ring[MASH_GUARD_HISTORY];
+static uint8_t            mash_guard_head;
+static uint16_t           mash_guard_dropped;
+
+static inline bool mash_guard_neighbours(keypos_t a, keypos_t b) {
+    if ((a.row < MATRIX_ROWS / 2) != (b.row < MATRIX_ROWS / 2)) return false;
+    uint8_t const rows = a.row > b.row ? a.row - b.row : b.row - a.row;
+    uint8_t const cols = a.col > b.col ? a.col - b.col : b.col - a.col;
+    return rows <= 1 && cols <= 1;
+}
+
+// Call on every event from process_record_user(); true = drop this press.
+// Uses the hardware event time, so combo and tap-hold buffering don't skew it.
+static bool mash_guard(uint16_t keycode, keyrecord_t *record) {
+    if (!record->event.pressed || !IS_KEYEVENT(record->event) || IS_QK_MOD_TAP(keycode) ||
+        IS_QK_LAYER_TAP(keycode)) {
+        return false;
+    }
+
+    mash_guard_press_t press = {.time = record->event.time, .key = record->event.key, .chain = 1};
+    for (uint8_t i = 0; i < MASH_GUARD_HISTORY; ++i) {
+        mash_guard_press_t const *prev = &mash_guard_ring[i];
+        if (prev->chain >= press.chain && TIMER_DIFF_16(record->event.time, prev->time) < MASH_GUARD_TERM &&
+            mash_guard_neighbours(press.key, prev->key)) {
+            press.chain = prev->chain < MASH_GUARD_MIN_KEYS ? prev->chain + 1 : MASH_GUARD_MIN_KEYS;
+        }
+    }
+    mash_guard_ring[mash_guard_head] = press;
+    mash_guard_head                  = (mash_guard_head + 1) & (MASH_GUARD_HISTORY - 1);
+
+    if (press.chain < MASH_GUARD_MIN_KEYS) return false;
+    ++mash_guard_dropped;
+    dprintf("mash guard: dropped %u\n", mash_guard_dropped);
+    return true;
+}
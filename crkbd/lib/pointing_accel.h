@@ -0,0 +1,114 @@
+// Pointer acceleration and smoothing for the trackpad, all in fixed point.
+//
+// Each report's x/y motion goes through a one-pole IIR filter (in 1/16
+// counts, weight 1/2^POINTING_SMOOTH_SHIFT for the new sample) to take out
+// jitter, then is scaled by a gain looked up from the smoothed speed in a
+// PROGMEM curve: below 1.0 for slow, precise movement, rising for fast flicks. The fraction
+// left after scaling is carried to the next report, so slow motion at a gain
+// under 1.0 still moves the pointer instead of rounding away.
+//
+// A report with no motion leaves the filter and carry alone: the pad skips
+// reports between samples, and lib/pointing_batch.h sends one batch per
+// interval with empty reports in between, so zeros mid-stroke are not the
+// finger slowing down. Only after POINTING_ACCEL_IDLE_MS without motion are
+// the filter and carry dropped, so nothing drifts after the finger stops; the
+// next stroke then seeds the filter with its first sample instead of easing
+// in from 0. lib/pointing_accel_test.c replays both patterns on the host.
+//
+// Speed is max(|x|, |y|) + min(|x|, |y|) / 2 of the smoothed motion, in
+// counts per report, so the curve depends on the report interval (1 ms with
+// QMK's split pointing sync, SPLIT_POINTING_BATCH_INTERVAL with
+// lib/pointing_batch.h). Scroll and buttons pass through untouched.
+//
+// Cost per report: a timer read, two multiplies, a table read, and shifts and
+// adds; an empty report is a timer read and a compare.
+
+#pragma once
+
+// New-sample weight of the smoothing filter: 1/2^shift (0 = no smoothing)
+#ifndef POINTING_SMOOTH_SHIFT
+#    define POINTING_SMOOTH_SHIFT 1
+#endif
+
+// Time without motion after which the filter and carry are dropped; longer
+// than the gap between two samples, batched or not
+#ifndef POINTING_ACCEL_IDLE_MS
+#    define POINTING_ACCEL_IDLE_MS 50
+#endif
+
+// Gain per speed step (counts per report), Q8: 256 = 1.0, at most 1023 so
+// 16-bit reports can't overflow. Speeds past the last entry use the last one.
+#ifndef POINTING_ACCEL_CURVE
+// clang-format off
+#    define POINTING_ACCEL_CURVE { \
+        192, 192, 211, 231, 250, 270, 289, 309, \
+        328, 348, 367, 387, 406, 426, 445, 465, \
+        484, 504, 523, 543, 562, 582, 601, 621, \
+        640, 640, 640, 640, 640, 640, 640, 640, \
+    }
+// clang-format on
+#endif
+
+_Static_assert(POINTING_SMOOTH_SHIFT <= 4, "POINTING_SMOOTH_SHIFT above 4 lags the pointer badly");
+
+static const uint16_t PROGMEM pointing_accel_curve[] = POINTING_ACCEL_CURVE;
+
+#define POINTING_ACCEL_STEPS (sizeof(pointing_accel_curve) / sizeof(pointing_accel_curve[0]))
+
+#define POINTING_FRAC_BITS  4                       // fraction bits of the filter
+#define POINTING_FRAC_ONE   (1 << POINTING_FRAC_BITS)
+#define POINTING_CARRY_BITS (POINTING_FRAC_BITS + 8) // and of the carry: filter times Q8 gain
+
+static int32_t  pointing_smooth[2];         // filtered x, y in 1/16 counts
+static int32_t  pointing_carry[2];          // fraction of a count not sent yet, 1/4096 counts
+static uint16_t pointing_accel_motion_time; // timer_read() of the last motion
+static bool     pointing_accel_idle = true; // filter and carry dropped, seed on the next motion
+
+static inline int32_t pointing_accel_abs(int32_t value) {
+    return value < 0 ? -value : value;
+}
+
+// Scales one axis; returns whole counts and keeps the whole fraction, down to
+// the product's last bit, so a steady stroke sends exactly its counts times
+// the gain however many reports it is spread over
+static inline int32_t pointing_accel_axis(uint8_t axis, uint16_t gain) {
+    int32_t const total = pointing_smooth[axis] * gain + pointing_carry[axis];
+    int32_t const out   = total >> POINTING_CARRY_BITS;
+    pointing_carry[axis] = total - out * (1 << POINTING_CARRY_BITS);
+    return out < XY_REPORT_MIN ? XY_REPORT_MIN : out > XY_REPORT_MAX ? XY_REPORT_MAX : out;
+}
+
+// From pointing_device_task_user() on the master
+static report_mouse_t pointing_accel_apply(report_mouse_t report) {
+    if (!report.x && !report.y) {
+        if (!pointing_accel_idle && TIMER_DIFF_16(timer_read(), pointing_accel_motion_time) >= POINTING_ACCEL_IDLE_MS) {
+            pointing_smooth[0] = pointing_smooth[1] = 0;
+            pointing_carry[0] = pointing_carry[1] = 0;
+            pointing_accel_idle                   = true;
+        }
+        return report;
+    }
+    pointing_accel_motion_time = timer_read();
+
+    if (pointing_accel_idle) {
+        pointing_smooth[0]  = (int32_t)report.x * POINTING_FRAC_ONE;
+        pointing_smooth[1]  = (int32_t)report.y * POINTING_FRAC_ONE;
+        pointing_accel_idle = false;
+    } else {
+        // Dividing (not shifting) rounds the filter step toward zero both
+        // ways, so back-and-forth jitter doesn't add up to drift in one
+        // direction
+        pointing_smooth[0] += ((int32_t)report.x * POINTING_FRAC_ONE - pointing_smooth[0]) / (1 << POINTING_SMOOTH_SHIFT);
+        pointing_smooth[1] += ((int32_t)report.y * POINTING_FRAC_ONE - pointing_smooth[1]) / (1 << POINTING_SMOOTH_SHIFT);
+    }
+
+    int32_t const ax    = pointing_accel_abs(pointing_smooth[0]);
+    int32_t const ay    = pointing_accel_abs(pointing_smooth[1]);
+    uint32_t      speed = (ax > ay ? ax + ay / 2 : ay + ax / 2) >> POINTING_FRAC_BITS;
+    if (speed >= POINTING_ACCEL_STEPS) speed = POINTING_ACCEL_STEPS - 1;
+    uint16_t const gain = pgm_read_word(&pointing_accel_curve[speed]);
+
+    report.x = pointing_accel_axis(0, gain);
+    report.y = pointing_accel_axis(1, gain);
+    return report;
+}
@@ -0,0 +1,177 @@
+// Host replay test for lib/pointing_accel.h.
+//
+// Feeds pointing_accel_apply() one report per millisecond from traces built
+// the way the trackpad produces them, and compares the counts that come out
+// with the counts that went in times the curve's gain at the trace's speed:
+//   sparse     1, 0, 1, 0, ...: a slow stroke with empty reports in between
+//   batched    10 then 7 empty reports, repeated: lib/pointing_batch.h at
+//              SPLIT_POINTING_BATCH_INTERVAL 8
+//   steady     3 every report
+//   jitter     +1, -1, ...: must not add up to drift either way
+// and checks the state the stateful cases depend on:
+//   seed       the first motion after idle seeds the filter with itself
+//   pause      a pause shorter than POINTING_ACCEL_IDLE_MS keeps the filter
+//   stop       after POINTING_ACCEL_IDLE_MS without motion the filter and
+//              carry are dropped, and nothing comes out while idle
+// Then replays a mixed trace for the cost per report. Exits non-zero on the
+// first failure.
+//   cc -O2 -o pointing_accel_test pointing_accel_test.c && ./pointing_accel_test [REPORTS]
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define CHECK(cond)                                                                   \
+    do {                                                                              \
+        if (!(cond)) {                                                                \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(1);                                                                  \
+        }                                                                             \
+    } while (0)
+
+// ─── QMK Stubs ───────────────────────────────────────────────────────────────
+
+#define PROGMEM
+#define pgm_read_word(address) (*(address))
+#define XY_REPORT_MIN          -32767
+#define XY_REPORT_MAX          32767
+#define TIMER_DIFF_16(a, b)    ((uint16_t)((a) - (b)))
+
+typedef struct {
+    uint8_t buttons;
+    int16_t x, y;
+    int8_t  v, h;
+} report_mouse_t;
+
+static uint16_t now_ms;
+
+static uint16_t timer_read(void) {
+    return now_ms;
+}
+
+// ─── Module Under Test ───────────────────────────────────────────────────────
+
+#include "pointing_accel.h"
+
+// ─── Replay ──────────────────────────────────────────────────────────────────
+
+static void reset(void) {
+    pointing_smooth[0] = pointing_smooth[1] = 0;
+    pointing_carry[0] = pointing_carry[1] = 0;
+    pointing_accel_idle                   = true;
+    now_ms += 1000;
+}
+
+// One report, one millisecond after the last
+static int16_t feed(int16_t x) {
+    report_mouse_t report = {.x = x};
+    now_ms++;
+    return pointing_accel_apply(report).x;
+}
+
+static uint16_t gain_at(uint32_t speed) {
+    return pointing_accel_curve[speed < POINTING_ACCEL_STEPS ? speed : POINTING_ACCEL_STEPS - 1];
+}
+
+typedef struct {
+    const char   *name;
+    const int16_t pattern[8]; // repeated
+    uint8_t       length;
+    uint32_t      speed; // smoothed speed the pattern settles at
+} trace_t;
+
+// clang-format off
+static const trace_t traces[] = {
+    {"sparse",  {1, 0},                   2, 1},
+    {"batched", {10, 0, 0, 0, 0, 0, 0, 0}, 8, 10},
+    {"steady",  {3},                      1, 3},
+    {"jitter",  {1, -1},                  2, 0},
+};
+// clang-format on
+
+#define REPEATS 500
+
+static void test_traces(void) {
+    printf("%-8s %6s %6s %9s\n", "trace", "in", "out", "expected");
+    for (size_t t = 0; t < sizeof(traces) / sizeof(traces[0]); t++) {
+        const trace_t *trace = &traces[t];
+        int32_t        in = 0, out = 0;
+        reset();
+        for (int r = 0; r < REPEATS; r++) {
+            for (uint8_t i = 0; i < trace->length; i++) {
+                in += trace->pattern[i];
+                out += feed(trace->pattern[i]);
+            }
+        }
+        int32_t const expected = in * gain_at(trace->speed) / 256;
+        printf("%-8s %6d %6d %9d\n", trace->name, in, out, expected);
+        if (trace->speed) {
+            CHECK(out >= expected - 1 && out <= expected + 1);
+        } else {
+            CHECK(out >= -1 && out <= 1);
+        }
+    }
+}
+
+static void test_seed(void) {
+    reset();
+    int16_t const out = feed(10);
+    CHECK(pointing_smooth[0] == 10 * POINTING_FRAC_ONE);
+    CHECK(out == 10 * gain_at(10) / 256);
+}
+
+static void test_pause(void) {
+    reset();
+    for (int i = 0; i < 100; i++) feed(8);
+    int32_t const smooth = pointing_smooth[0];
+    for (int i = 0; i < POINTING_ACCEL_IDLE_MS - 1; i++) CHECK(feed(0) == 0);
+    CHECK(!pointing_accel_idle && pointing_smooth[0] == smooth);
+    feed(8);
+    CHECK(pointing_smooth[0] == smooth); // settled at 8, not reseeded from 0
+}
+
+static void test_stop(void) {
+    reset();
+    for (int i = 0; i < 100; i++) feed(i % 3 ? 1 : 2); // leaves a fraction in the carry
+    for (int i = 0; i < POINTING_ACCEL_IDLE_MS; i++) CHECK(feed(0) == 0);
+    CHECK(pointing_accel_idle);
+    CHECK(!pointing_smooth[0] && !pointing_carry[0]);
+    for (int i = 0; i < 1000; i++) CHECK(feed(0) == 0);
+
+    // The next stroke starts slow, not at the last stroke's speed
+    feed(1);
+    CHECK(pointing_smooth[0] == POINTING_FRAC_ONE);
+}
+
+// A stroke that speeds up and slows down, with a pause and the empty reports
+// between batches, as one long trace
+static void test_cost(unsigned long reports) {
+    static int16_t trace[4096];
+    for (size_t i = 0; i < sizeof(trace) / sizeof(trace[0]); i++) {
+        size_t const phase = i % 1024;
+        trace[i]           = phase >= 768 ? 0 : i % 8 ? 0 : (int16_t)(phase < 384 ? phase / 16 : (768 - phase) / 16);
+    }
+
+    reset();
+    volatile int32_t sink = 0; // keeps the loop from being optimized out
+    struct timespec  start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (unsigned long i = 0; i < reports; i++) sink += feed(trace[i & 4095]);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double const elapsed = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+    printf("%lu reports, %.1f ns/report\n", reports, elapsed / reports);
+}
+
+int main(int argc, char **argv) {
+    test_traces();
+    test_seed();
+    test_pause();
+    test_stop();
+    test_cost(argc > 1 ? strtoul(argv[1], NULL, 10) : 10000000);
+    printf("pointing_accel: all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,181 @@
+// Split pointing batch: the trackpad half reads the IQS5xx itself and adds
+// every sample's motion into one pending report, which the master pulls over a
+// user split transaction (SPLIT_TRANSACTION_IDS_USER SPLIT_POINTING_BATCH) once
+// every SPLIT_POINTING_BATCH_INTERVAL ms. Used instead of SPLIT_POINTING_ENABLE,
+// whose master asks the other half for the report checksum on every pointing
+// task run, and where a sample the master has not fetched yet is overwritten
+// by the next one.
+//
+// Each pull takes at most one report's worth of motion (XY_REPORT_MIN..MAX,
+// HV_REPORT_MIN..MAX) out of the pending sums; the rest stays pending for the
+// next pull, so a fast flick arrives late rather than cut short (the pending
+// sums saturate at int16, some 250 reports of backlog). Buttons (the
+// IQS5xx's taps and press and hold) are the latest sample's state plus any
+// button pressed during the batch, so a tap that starts and ends between two
+// pulls still clicks.
+//
+// Nothing is lost to a failed transaction: the slave numbers each chunk and
+// keeps it until the master's next pull acknowledges that number, and sends
+// the same chunk again otherwise.
+//
+// pointing_batch_samples and pointing_batch_pulls count what the master got;
+// their ratio is the samples coalesced per transaction (POINTING_DEVICE_DEBUG
+// prints them per pull).
+//
+// The trackpad half polls on lib/pointing_poll.h's adaptive interval, or, with
+// AZOTEQ_IQS5XX_RDY_PIN defined, only while the IQS5xx holds RDY high (new
+// data ready), so an untouched pad leaves the I2C bus to the OLED.
+//
+// Needs POINTING_DEVICE_DRIVER = custom with the azoteq_iqs5xx driver source
+// added to SRC (see rules.mk); the keymap forwards the driver hooks here.
+
+#pragma once
+
+#include <string.h>
+#include "transactions.h"
+#include "drivers/sensors/azoteq_iqs5xx.h"
+#include "keyboards/crkbd/lib/pointing_poll.h"
+
+// Milliseconds between the master's pulls
+#ifndef SPLIT_POINTING_BATCH_INTERVAL
+#    define SPLIT_POINTING_BATCH_INTERVAL 8
+#endif
+
+#ifdef POINTING_DEVICE_LEFT
+#    define POINTING_BATCH_THIS_SIDE is_keyboard_left()
+#else
+#    define POINTING_BATCH_THIS_SIDE !is_keyboard_left()
+#endif
+
+typedef struct {
+    int16_t x, y, h, v;
+    uint8_t buttons;
+    uint8_t samples; // saturates at 255
+    uint8_t seq;     // chunk number; the master acknowledges it on its next pull
+} pointing_batch_t;
+
+_Static_assert(sizeof(pointing_batch_t) <= RPC_S2M_BUFFER_SIZE, "pointing_batch_t exceeds RPC_S2M_BUFFER_SIZE");
+
+// Trackpad half
+static pointing_batch_t pointing_batch_pending;  // sums not handed out yet
+static pointing_batch_t pointing_batch_inflight; // last chunk sent, until acknowledged
+static uint8_t          pointing_batch_buttons;  // latest sample's
+static uint16_t         pointing_batch_timer;
+#ifndef AZOTEQ_IQS5XX_RDY_PIN
+static pointing_poll_t pointing_batch_poll = POINTING_POLL_INIT;
+#endif
+
+// Master
+static uint32_t pointing_batch_samples;
+static uint32_t pointing_batch_pulls;
+
+static inline int16_t pointing_batch_add(int16_t sum, int16_t delta) {
+    int32_t const total = (int32_t)sum + delta;
+    return total > INT16_MAX ? INT16_MAX : total < INT16_MIN ? INT16_MIN : total;
+}
+
+static inline int16_t pointing_batch_clamp(int16_t value, int16_t min, int16_t max) {
+    return value > max ? max : value < min ? min : value;
+}
+
+// Trackpad half: up to one report's worth of *pending, taken out of it
+static int16_t pointing_batch_take(int16_t *pending, int16_t min, int16_t max) {
+    int16_t const chunk = pointing_batch_clamp(*pending, min, max);
+    *pending -= chunk;
+    return chunk;
+}
+
+// Trackpad half: once the master has the last chunk (it sends back its
+// number), cut the next one from the pending sums; otherwise send it again
+static void pointing_batch_reply(uint8_t in_len, const void *in_data, uint8_t out_len, void *out_data) {
+    if (in_len < 1 || out_len < sizeof(pointing_batch_t)) return;
+    pointing_batch_t *chunk = &pointing_batch_inflight;
+
+    if (*(const uint8_t *)in_data == chunk->seq) {
+        pointing_batch_t *batch = &pointing_batch_pending;
+        *chunk = (pointing_batch_t){
+            .x       = pointing_batch_take(&batch->x, XY_REPORT_MIN, XY_REPORT_MAX),
+            .y       = pointing_batch_take(&batch->y, XY_REPORT_MIN, XY_REPORT_MAX),
+            .h       = pointing_batch_take(&batch->h, HV_REPORT_MIN, HV_REPORT_MAX),
+            .v       = pointing_batch_take(&batch->v, HV_REPORT_MIN, HV_REPORT_MAX),
+            .buttons = batch->buttons,
+            .samples = batch->samples,
+            .seq     = chunk->seq + 1,
+        };
+        batch->buttons = pointing_batch_buttons;
+        batch->samples = 0;
+    }
+    memcpy(out_data, chunk, sizeof(pointing_batch_t));
+}
+
+// Trackpad half: read one sample into the pending batch; true if it moved or
+// pressed a button
+static bool pointing_batch_sample(void) {
+    report_mouse_t const sample = azoteq_iqs5xx_get_report((report_mouse_t){0});
+    pointing_batch_t    *batch  = &pointing_batch_pending;
+
+    batch->x = pointing_batch_add(batch->x, sample.x);
+    batch->y = pointing_batch_add(batch->y, sample.y);
+    batch->h = pointing_batch_add(batch->h, sample.h);
+    batch->v = pointing_batch_add(batch->v, sample.v);
+    batch->buttons |= sample.buttons;
+    pointing_batch_buttons = sample.buttons;
+    if (batch->samples < UINT8_MAX) batch->samples++;
+    return sample.x || sample.y || sample.h || sample.v || sample.buttons;
+}
+
+// From pointing_device_driver_init()
+static void pointing_batch_init(void) {
+    if (POINTING_BATCH_THIS_SIDE) {
+#ifdef AZOTEQ_IQS5XX_RDY_PIN
+        gpio_set_pin_input(AZOTEQ_IQS5XX_RDY_PIN);
+#endif
+        azoteq_iqs5xx_init();
+    }
+    transaction_register_rpc(SPLIT_POINTING_BATCH, pointing_batch_reply);
+}
+
+// From housekeeping_task_user(): samples when the poll policy says so
+static void pointing_batch_task(void) {
+    if (is_keyboard_master() || !POINTING_BATCH_THIS_SIDE) return;
+    uint16_t const elapsed = TIMER_DIFF_16(timer_read(), pointing_batch_timer);
+#ifdef AZOTEQ_IQS5XX_RDY_PIN
+    if (!gpio_read_pin(AZOTEQ_IQS5XX_RDY_PIN) || elapsed < POINTING_POLL_ACTIVE_MS) return;
+    pointing_batch_timer = timer_read();
+    pointing_batch_sample();
+#else
+    if (elapsed < pointing_batch_poll.interval) return;
+    pointing_batch_timer = timer_read();
+    pointing_poll_update(&pointing_batch_poll, pointing_batch_sample(), elapsed);
+#endif
+}
+
+// From pointing_device_driver_get_report() on the master: one transaction per
+// interval; in between the buttons hold and there is no motion
+static report_mouse_t pointing_batch_pull(report_mouse_t report) {
+    static uint16_t last_pull = 0;
+    static uint8_t  buttons   = 0;
+    static uint8_t  have      = 0; // number of the last chunk received
+
+    report.buttons = buttons;
+    if (TIMER_DIFF_16(timer_read(), last_pull) < SPLIT_POINTING_BATCH_INTERVAL) return report;
+    last_pull = timer_read();
+
+    pointing_batch_t batch;
+    if (!transaction_rpc_exec(SPLIT_POINTING_BATCH, sizeof(have), &have, sizeof(batch), &batch)) return report;
+    have = batch.seq;
+
+    report.x       = batch.x;
+    report.y       = batch.y;
+    report.h       = batch.h;
+    report.v       = batch.v;
+    report.buttons = buttons = batch.buttons;
+
+    pointing_batch_samples += batch.samples;
+    pointing_batch_pulls++;
+    if (batch.samples > 1) {
+        pd_dprintf("pointing batch: %u samples, %lu in %lu pulls\n", batch.samples,
+                   (unsigned long)pointing_batch_samples, (unsigned long)pointing_batch_pulls);
+    }
+    return report;
+}
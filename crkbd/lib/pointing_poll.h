@@ -0,0 +1,53 @@
+// Adaptive poll interval for a trackpad read over I2C. While samples carry
+// motion or buttons it polls every POINTING_POLL_ACTIVE_MS; once the pad has
+// been quiet for POINTING_POLL_HOLD_MS, each further quiet poll doubles the
+// interval up to POINTING_POLL_IDLE_MS, and the first active sample snaps it
+// back. An untouched pad then costs one bus transaction per idle interval.
+// Only lib/pointing_batch.h drives it, so it runs in SPLIT_POINTING_BATCH_ENABLE
+// builds alone; everywhere else the pad keeps QMK's stock polling.
+//
+// Plain C without QMK dependencies, so a host-side mock device can drive it
+// (pointing_poll_test.c).
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Interval (ms) while the pad is in use
+#ifndef POINTING_POLL_ACTIVE_MS
+#    define POINTING_POLL_ACTIVE_MS 1
+#endif
+// Longest interval (ms) the backoff reaches; also the worst-case delay before
+// the first sample of a new touch
+#ifndef POINTING_POLL_IDLE_MS
+#    define POINTING_POLL_IDLE_MS 64
+#endif
+// Quiet time (ms) before the backoff starts, so pauses mid-gesture stay fast
+#ifndef POINTING_POLL_HOLD_MS
+#    define POINTING_POLL_HOLD_MS 500
+#endif
+
+_Static_assert(POINTING_POLL_ACTIVE_MS >= 1, "POINTING_POLL_ACTIVE_MS must be at least 1");
+_Static_assert(POINTING_POLL_IDLE_MS >= POINTING_POLL_ACTIVE_MS && POINTING_POLL_IDLE_MS <= 0x7FFF,
+               "POINTING_POLL_IDLE_MS must be between POINTING_POLL_ACTIVE_MS and 32767");
+
+typedef struct {
+    uint16_t interval; // ms from this poll to the next
+    uint16_t quiet;    // ms since the last active sample, saturating
+} pointing_poll_t;
+
+#define POINTING_POLL_INIT {.interval = POINTING_POLL_ACTIVE_MS, .quiet = 0}
+
+// After each poll: active = the sample moved or pressed a button,
+// elapsed = ms since the previous poll
+static inline void pointing_poll_update(pointing_poll_t *poll, bool active, uint16_t elapsed) {
+    if (active) {
+        poll->interval = POINTING_POLL_ACTIVE_MS;
+        poll->quiet    = 0;
+        return;
+    }
+    poll->quiet = elapsed > UINT16_MAX - poll->quiet ? UINT16_MAX : poll->quiet + elapsed;
+    if (poll->quiet < POINTING_POLL_HOLD_MS) return;
+    poll->interval = poll->interval >= POINTING_POLL_IDLE_MS / 2 ? POINTING_POLL_IDLE_MS : poll->interval * 2;
+}
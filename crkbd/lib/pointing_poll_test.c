@@ -0,0 +1,87 @@
+// Host test for lib/pointing_poll.h.
+//
+// Drives pointing_poll_update() the way pointing_batch_task() does, once per
+// millisecond tick, against a mock IQS5xx that reports motion while a finger
+// is on the pad in the trace, and counts the I2C reads:
+//   idle    untouched for 10 s
+//   touch   one long stroke
+//   pause   strokes with pauses shorter than POINTING_POLL_HOLD_MS between
+//   wake    idle, then a touch: how long until the first read sees it
+// Checks the read rate against what the policy promises: one read per
+// POINTING_POLL_ACTIVE_MS while in use (pauses included), one per
+// POINTING_POLL_IDLE_MS once idle, and a new touch seen within
+// POINTING_POLL_IDLE_MS. Exits non-zero if any of them is off.
+//   cc -O2 -o pointing_poll_test pointing_poll_test.c && ./pointing_poll_test
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "pointing_poll.h"
+
+typedef struct {
+    uint32_t from_ms, to_ms; // finger on the pad
+} stroke_t;
+
+typedef struct {
+    const char     *name;
+    uint32_t        length_ms;
+    const stroke_t *strokes;
+    uint8_t         count;
+    uint32_t        rate_from_ms, rate_to_ms; // window the read rate is checked over
+    uint16_t        interval_ms;              // the interval expected there
+} trace_t;
+
+static const stroke_t touch_strokes[] = {{0, 5000}};
+static const stroke_t pause_strokes[] = {{0, 800}, {1200, 2000}, {2300, 3500}, {3900, 5000}};
+static const stroke_t wake_strokes[]  = {{8037, 9000}};
+
+// clang-format off
+static const trace_t traces[] = {
+    {"idle",  10000, NULL,          0, 2000, 10000, POINTING_POLL_IDLE_MS},
+    {"touch",  5000, touch_strokes, 1,    0,  5000, POINTING_POLL_ACTIVE_MS},
+    {"pause",  5000, pause_strokes, 4,    0,  5000, POINTING_POLL_ACTIVE_MS},
+    {"wake",   9000, wake_strokes,  1, 8100,  9000, POINTING_POLL_ACTIVE_MS},
+};
+// clang-format on
+
+// The mock device: a read reports motion while a stroke covers that moment
+static const stroke_t *touching(const trace_t *trace, uint32_t now) {
+    for (uint8_t i = 0; i < trace->count; i++) {
+        if (now >= trace->strokes[i].from_ms && now < trace->strokes[i].to_ms) return &trace->strokes[i];
+    }
+    return NULL;
+}
+
+int main(void) {
+    bool ok = true;
+    printf("%-6s %9s %9s %17s\n", "trace", "reads/s", "expected", "worst wake (ms)");
+    for (size_t t = 0; t < sizeof(traces) / sizeof(traces[0]); t++) {
+        const trace_t  *trace = &traces[t];
+        pointing_poll_t poll  = POINTING_POLL_INIT;
+        uint16_t        timer = 0;
+        uint32_t        reads = 0, worst_wake = 0;
+        const stroke_t *seen  = NULL; // stroke the last read reported
+
+        for (uint32_t now = 0; now < trace->length_ms; now++) {
+            uint16_t const elapsed = (uint16_t)now - timer;
+            if (elapsed < poll.interval) continue;
+            timer = (uint16_t)now;
+
+            const stroke_t *stroke = touching(trace, now); // one I2C read
+            pointing_poll_update(&poll, stroke != NULL, elapsed);
+            if (now >= trace->rate_from_ms && now < trace->rate_to_ms) reads++;
+            if (stroke && stroke != seen && now - stroke->from_ms > worst_wake) worst_wake = now - stroke->from_ms;
+            seen = stroke;
+        }
+
+        uint32_t const window   = trace->rate_to_ms - trace->rate_from_ms;
+        uint32_t const expected = window / trace->interval_ms;
+        bool const     rate_ok  = reads + 1 >= expected && reads <= expected + 1;
+        bool const     wake_ok  = worst_wake <= POINTING_POLL_IDLE_MS;
+        ok &= rate_ok && wake_ok;
+        printf("%-6s %9.1f %9.1f %17u%s\n", trace->name, reads * 1000.0 / window, expected * 1000.0 / window,
+               worst_wake, rate_ok && wake_ok ? "" : "  FAIL");
+    }
+    return ok ? 0 : 1;
+}
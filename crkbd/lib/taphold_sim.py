@@ -0,0 +1,539 @@
+#!/usr/bin/env python3
+"""
+Tap-Hold Parameter Sweep for the Corne
+Replays recorded typing (lib/latency_trace.h console dumps) through a model of
+the keymap's tap-hold, combo and mash guard decisions for every combination
+of TAPPING_TERM, QUICK_TAP_TERM, PERMISSIVE_HOLD, CHORDAL_HOLD, COMBO_TERM,
+MASH_GUARD_TERM, MASH_GUARD_MIN_KEYS (and any other define the keymap's logic reads), in parallel
+across all cores, and ranks the configurations by misfires and added latency.
+
+What was meant is read off the recording's own timing (see label_*), so the
+ranking compares configurations against each other rather than against truth.
+"""
+
+import os
+import re
+import sys
+import json
+import time
+import argparse
+import itertools
+from pathlib import Path
+from multiprocessing import Pool
+
+from latency_trace import NO_KEY, QK_MOD_TAP, is_tap_hold, parse_dumps
+from flow_tap_replay import INFO_JSON, LAYOUT, MOD_TAP_TERM, layout_keys, layout_table, parse_define, resolve
+
+
+# region keymap
+DEFINE_LINE = re.compile(r'^[ \t]*#[ \t]*define[ \t]+(\w+)[ \t]+(?!//)(\S.*?)[ \t]*(?://.*)?$', re.MULTILINE)
+COMBO_KEYS = re.compile(r'const\s+uint16_t\s+PROGMEM\s+(\w+)\s*\[\]\s*=\s*\{([^;]*)\};')
+
+PARAMS = ['TAPPING_TERM', 'QUICK_TAP_TERM', 'PERMISSIVE_HOLD', 'CHORDAL_HOLD', 'COMBO_TERM', 'MASH_GUARD_TERM',
+          'MASH_GUARD_MIN_KEYS']
+FLAGS = {'PERMISSIVE_HOLD', 'CHORDAL_HOLD'}
+KC_A, KC_Z = 0x04, 0x1D
+KC_LCTL, KC_RGUI = 0xE0, 0xE7
+MASH_GUARD_HISTORY = 4
+
+
+def split_args(text: str) -> list[str]:
+    """Split a C argument list on top-level commas, dropping whitespace and comments."""
+    text = re.sub(r'//[^\n]*|/\*.*?\*/', '', text, flags=re.DOTALL)
+    args, depth, start = [], 0, 0
+    for i, c in enumerate(text):
+        if c == '(':
+            depth += 1
+        elif c == ')':
+            depth -= 1
+        elif c == ',' and not depth:
+            args.append(text[start:i])
+            start = i + 1
+    args.append(text[start:])
+    return [re.sub(r'\s+', '', arg) for arg in args if arg.strip()]
+
+
+def layer_tokens(source: str, index: int) -> list[str]:
+    """Keycode names of the index-th LAYOUT_split_3x6_3(...) layer in the keymaps array."""
+    layers = list(re.finditer(rf'\[\s*\w+\s*\]\s*=\s*{LAYOUT}\(', source))
+    if index >= len(layers):
+        raise SystemExit(f"error: the keymap has no layer {index}")
+    start, depth = layers[index].end(), 1
+    for i in range(start, len(source)):
+        depth += {'(': 1, ')': -1}.get(source[i], 0)
+        if not depth:
+            return split_args(source[start:i])
+    raise SystemExit("error: unterminated layer")
+
+
+class KeymapModel:
+    """The parts of a keymap directory its tap-hold, combo and mash guard decisions read."""
+
+    def __init__(self, keymap_dir: Path, overrides: dict[str, str], combo_skip: str | None):
+        keymap = (keymap_dir / 'keymap.c').read_text(encoding='utf-8')
+        config = (keymap_dir / 'config.h').read_text(encoding='utf-8')
+        combos = keymap_dir / 'combos.def'
+        combos = combos.read_text(encoding='utf-8') if combos.exists() else keymap
+        source = config + keymap
+
+        self.defines = {name: re.sub(r'\s+', '', value) for name, value in DEFINE_LINE.findall(source)}
+        self.defines.update(overrides)
+        for flag in FLAGS:
+            present = re.search(rf'^\s*#\s*define\s+{flag}\b', source, re.MULTILINE)
+            self.defines.setdefault(flag, '1' if present else '0')
+        self.defines.update({flag: overrides[flag] for flag in FLAGS if flag in overrides})
+
+        keys = layout_keys(INFO_JSON)
+        self.hand = {key: hand.strip("'") for key, hand in zip(keys, layout_table(keymap, 'chordal_hold_layout'))}
+        try:
+            self.flow_tap_terms = dict(zip(keys, layout_table(keymap, 'flow_tap_terms')))
+        except SystemExit:
+            self.flow_tap_terms = {}
+        m = MOD_TAP_TERM.search(keymap)
+        self.mod_tap_term = m.group(1) if m else 'TAPPING_TERM'
+
+        # Combos are keyed on the COMBO_ONLY_FROM_LAYER layer's keycode names
+        layer = layer_tokens(keymap, resolve(self.defines.get('COMBO_ONLY_FROM_LAYER', '0'), self.defines))
+        by_name = {self.expand(token): key for token, key in zip(layer, keys)}
+        self.combos: dict[str, frozenset[int]] = {}
+        for name, body in COMBO_KEYS.findall(combos):
+            if combo_skip and re.search(combo_skip, name):
+                continue
+            names = [self.expand(arg) for arg in split_args(body) if arg != 'COMBO_END']
+            if names and all(n in by_name for n in names):
+                self.combos[name] = frozenset(by_name[n] for n in names)
+
+    def expand(self, token: str) -> str:
+        seen = set()
+        while token in self.defines and token not in seen:
+            seen.add(token)
+            token = self.defines[token]
+        return token
+
+    def params(self) -> list[str]:
+        """The defines the modelled logic reads, in sweep order."""
+        extra = [self.mod_tap_term] if self.mod_tap_term not in PARAMS and not self.mod_tap_term.isdigit() else []
+        terms = {t for t in self.flow_tap_terms.values() if not t.isdigit()}
+        return PARAMS + extra + sorted(self.expand_names(terms))
+
+    def expand_names(self, tokens: set[str]) -> set[str]:
+        """Resolve local aliases (FT_HOME -> FLOW_TAP_TERM) to the define a sweep should set."""
+        names = set()
+        for token in tokens:
+            while token in self.defines and self.defines[token] in self.defines:
+                token = self.defines[token]
+            names.add(token)
+        return names
+
+    def baseline(self) -> dict[str, int]:
+        return {name: resolve(name, self.defines) for name in self.params()}
+
+
+# region presses
+class Press:
+    __slots__ = ('down', 'up', 'key', 'keycode', 'hand', 'tap_hold', 'mod', 'alpha', 'interrupts')
+
+    def __init__(self, down: float, key: int, keycode: int, hand: str):
+        self.down = down  # ms since the start of the run
+        self.up = None
+        self.key = key
+        self.keycode = keycode
+        self.hand = hand
+        self.tap_hold = is_tap_hold(keycode)
+        self.mod = QK_MOD_TAP[0] <= keycode <= QK_MOD_TAP[1] or KC_LCTL <= keycode <= KC_RGUI
+        self.alpha = KC_A <= (keycode & 0xFF if self.tap_hold else keycode) <= KC_Z
+        self.interrupts: list[int] = []  # indices of presses that came in while this key was down
+
+
+def runs_of_presses(runs, hand: dict[int, str]) -> list[list[Press]]:
+    """Scan-stage presses with their releases, on an unwrapped ms clock; unreleased presses are dropped."""
+    out = []
+    for run in runs:
+        presses, down, now, last = [], {}, 0.0, None
+        for event in run:
+            if event.stage != 'S' or event.key == NO_KEY:
+                continue
+            now += event.ms_since(last) if last else 0.0
+            last = event
+            if event.pressed:
+                down[event.key] = Press(now, event.key, event.keycode, hand.get(event.key, '*'))
+                presses.append(down[event.key])
+            elif event.key in down:
+                down.pop(event.key).up = now
+        presses = [p for p in presses if p.up is not None]
+        for i, p in enumerate(presses):
+            j = i + 1
+            while j < len(presses) and presses[j].down < p.up:
+                p.interrupts.append(j)
+                j += 1
+        if presses:
+            out.append(presses)
+    return out
+
+
+def opposite_hands(a: Press, b: Press) -> bool:
+    return a.hand == '*' or b.hand == '*' or a.hand != b.hand
+
+
+# region labels
+# What was meant, from timing alone and the same for every configuration.
+class Labels:
+    def __init__(self, presses: list[Press], combos: list[frozenset[int]], hold_ms: float, tail_ms: float,
+                 chord_ms: float, mash_ms: float):
+        self.hold = [label_hold(p, presses, hold_ms, tail_ms) for p in presses]
+        self.chords = label_chords(presses, combos, chord_ms)
+        self.mash = [any(p.down - presses[k].down < mash_ms and neighbours(p.key, presses[k].key)
+                         for k in range(max(0, i - MASH_GUARD_HISTORY), i)) for i, p in enumerate(presses)]
+
+
+def label_hold(p: Press, presses: list[Press], hold_ms: float, tail_ms: float) -> bool:
+    """
+    A hold wraps another key's whole press and lingers after it (a roll lets go
+    right away), or is held hold_ms with nothing pressed during it.
+    """
+    if not p.tap_hold:
+        return False
+    if not p.interrupts:
+        return p.up - p.down >= hold_ms
+    return any(presses[j].up < p.up and p.up - presses[j].up >= tail_ms for j in p.interrupts)
+
+
+def label_chords(presses: list[Press], combos: list[frozenset[int]], chord_ms: float) -> set[frozenset[int]]:
+    """Presses of all of a combo's keys within chord_ms, all down together; the largest combo wins."""
+    chords, taken = set(), set()
+    for i, p in enumerate(presses):
+        if i in taken:
+            continue
+        best = None
+        for combo in combos:
+            if p.key not in combo:
+                continue
+            group, keys = [i], {p.key}
+            for j in range(i + 1, len(presses)):
+                q = presses[j]
+                if q.down - p.down > chord_ms or q.key not in combo or q.key in keys:
+                    break
+                group.append(j)
+                keys.add(q.key)
+            if keys == combo and max(presses[g].down for g in group) < min(presses[g].up for g in group):
+                if not best or len(group) > len(best):
+                    best = group
+        if best:
+            chords.add(frozenset(best))
+            taken.update(best)
+    return chords
+
+
+# region model
+class Result:
+    __slots__ = ('config', 'wrong_hold', 'wrong_tap', 'wrong_combo', 'missed_combo', 'dropped', 'mashed',
+                 'latency_ms', 'presses')
+
+    def __init__(self, config: dict[str, int]):
+        self.config = config
+        self.wrong_hold = self.wrong_tap = self.wrong_combo = self.missed_combo = 0
+        self.dropped = self.mashed = self.presses = 0
+        self.latency_ms = 0.0
+
+    def errors(self) -> int:
+        return self.wrong_hold + self.wrong_tap + self.wrong_combo + self.missed_combo + self.dropped + self.mashed
+
+    def as_dict(self) -> dict:
+        d = {name: getattr(self, name) for name in self.__slots__ if name != 'config'}
+        d['latency_ms'] = round(self.latency_ms, 1)
+        return {'config': self.config, 'errors': self.errors(), **d}
+
+
+def fire_combos(presses: list[Press], combos: list[frozenset[int]], term: float):
+    """
+    The combo engine with COMBO_STRICT_TIMER: from a combo key's press, collect
+    further keys of a still-possible combo until COMBO_TERM runs out, another
+    key comes in, or a collected key is let go; then fire the combo the keys
+    make up, if any. Returns the fired groups and the added latency.
+    """
+    fired, consumed, latency = [], set(), 0.0
+    starts = {key for combo in combos for key in combo}
+    for i, p in enumerate(presses):
+        if i in consumed or p.key not in starts:
+            continue
+        candidates = [c for c in combos if p.key in c]
+        group, keys = [i], frozenset([p.key])
+        deadline = p.down + term
+        while True:
+            complete = keys in candidates
+            if complete and not any(keys < c for c in candidates):
+                resolved = presses[group[-1]].down
+                break
+            j = group[-1] + 1
+            first_up = min(presses[g].up for g in group)
+            if j >= len(presses) or presses[j].down >= min(deadline, first_up):
+                resolved = min(deadline, first_up)
+                break
+            q = presses[j]
+            grown = keys | {q.key}
+            if q.key in keys or not any(grown <= c for c in candidates):
+                resolved = q.down
+                break
+            group.append(j)
+            keys = grown
+            candidates = [c for c in candidates if keys <= c]
+        if keys in candidates:
+            fired.append(frozenset(group))
+            consumed.update(group)
+            latency += resolved - presses[group[-1]].down
+        else:
+            latency += sum(resolved - presses[g].down for g in group)
+    return fired, consumed, latency
+
+
+def neighbours(a: int, b: int) -> bool:
+    """lib/mash_guard.h: same half, at most one row and one column apart on the matrix."""
+    (ra, ca), (rb, cb) = divmod(a, 16), divmod(b, 16)
+    return (ra < 4) == (rb < 4) and abs(ra - rb) <= 1 and abs(ca - cb) <= 1
+
+
+def mash_guard(presses: list[Press], consumed: set[int], term: float, min_keys: int) -> list[bool]:
+    """
+    lib/mash_guard.h: a plain press extends the longest chain of neighbouring
+    presses among the last few that started less than MASH_GUARD_TERM ago, and
+    is dropped once the chain is MASH_GUARD_MIN_KEYS long.
+    """
+    dropped = [False] * len(presses)
+    ring: list[tuple[float, int, int]] = []  # (chain start, key, chain length)
+    for i, p in enumerate(presses):
+        if i in consumed or p.tap_hold:
+            continue
+        start, chain = p.down, 1
+        for prev_start, key, prev_chain in ring:
+            if prev_chain >= chain and p.down - prev_start < term and neighbours(p.key, key):
+                start, chain = prev_start, min(prev_chain + 1, min_keys)
+        ring = ring[-(MASH_GUARD_HISTORY - 1):] + [(start, p.key, chain)]
+        dropped[i] = chain >= min_keys
+    return dropped
+
+
+class Model:
+    """A keymap's decisions, with the parameters resolved for one configuration."""
+
+    def __init__(self, keymap: KeymapModel, config: dict[str, int]):
+        defines = dict(keymap.defines)
+        defines.update({name: str(value) for name, value in config.items()})
+        self.tapping_term = resolve('TAPPING_TERM', defines)
+        self.mod_tap_term = resolve(keymap.mod_tap_term, defines)
+        self.quick_tap_term = resolve('QUICK_TAP_TERM', defines)
+        self.permissive = bool(resolve('PERMISSIVE_HOLD', defines))
+        self.chordal = bool(resolve('CHORDAL_HOLD', defines))
+        self.flow_tap = {key: resolve(token, defines) for key, token in keymap.flow_tap_terms.items()}
+
+    def term(self, p: Press) -> float:
+        return self.mod_tap_term if QK_MOD_TAP[0] <= p.keycode <= QK_MOD_TAP[1] else self.tapping_term
+
+    def mods_held(self, presses: list[Press], i: int, hold_at: list) -> bool:
+        at = presses[i].down
+        for k in range(max(0, i - 16), i):
+            q = presses[k]
+            if q.mod and q.up > at and (not q.tap_hold or (hold_at[k] is not None and hold_at[k] <= at)):
+                return True
+        return False
+
+    def decide(self, presses: list[Press], i: int, hold_at: list, tapped: list) -> tuple[bool, float]:
+        """(hold?, decision time) for the tap-hold press i, as QMK's action_tapping would settle it."""
+        p = presses[i]
+        if i and self.flow_tap.get(p.key):
+            prev = presses[i - 1]
+            if prev.alpha and p.down - prev.down < self.flow_tap[p.key] and not self.mods_held(presses, i, hold_at):
+                return False, p.down
+        for k in range(i - 1, max(-1, i - 16), -1):
+            q = presses[k]
+            if q.key == p.key:
+                if tapped[k] and p.down - q.up < self.quick_tap_term:
+                    return False, p.down
+                break
+
+        settle, hold = p.up, False
+        if p.down + self.term(p) < settle:
+            settle, hold = p.down + self.term(p), True
+        for j in p.interrupts:
+            q = presses[j]
+            if q.down >= settle:
+                break
+            if self.chordal and not opposite_hands(p, q):
+                return False, q.down
+            if self.permissive and q.up < settle:
+                settle, hold = q.up, True
+        return hold, settle
+
+
+def simulate(runs: list[list[Press]], labels: list[Labels], keymap: KeymapModel,
+             combos: list[frozenset[int]], config: dict[str, int]) -> Result:
+    model = Model(keymap, config)
+    result = Result(config)
+    for presses, label in zip(runs, labels):
+        fired, consumed, latency = fire_combos(presses, combos, config['COMBO_TERM'])
+        result.latency_ms += latency
+        result.wrong_combo += len(set(fired) - label.chords)
+        result.missed_combo += len(label.chords - set(fired))
+
+        dropped = mash_guard(presses, consumed, config['MASH_GUARD_TERM'], config['MASH_GUARD_MIN_KEYS'])
+        for i, p in enumerate(presses):
+            if i not in consumed and not p.tap_hold:
+                result.dropped += dropped[i] and not label.mash[i]
+                result.mashed += label.mash[i] and not dropped[i]
+
+        hold_at, tapped = [None] * len(presses), [False] * len(presses)
+        for i, p in enumerate(presses):
+            result.presses += 1
+            if i in consumed or not p.tap_hold:
+                continue
+            hold, settled = model.decide(presses, i, hold_at, tapped)
+            if hold:
+                hold_at[i] = settled
+            else:
+                tapped[i] = True
+                result.latency_ms += settled - p.down
+            # Keys pressed while it was undecided wait for it
+            result.latency_ms += sum(settled - presses[j].down for j in p.interrupts if presses[j].down < settled)
+            result.wrong_hold += hold and not label.hold[i]
+            result.wrong_tap += label.hold[i] and not hold
+    return result
+
+
+# region sweep
+_worker: tuple = ()
+
+
+def init_worker(runs, labels, keymap, combos):
+    global _worker
+    _worker = (runs, labels, keymap, combos)
+
+
+def run_config(config: dict[str, int]) -> Result:
+    return simulate(*_worker, config)
+
+
+def parse_sweep(text: str) -> tuple[str, list[int]]:
+    """NAME=a,b,c or NAME=lo:hi:step (inclusive)."""
+    name, sep, values = text.partition('=')
+    if not sep or not name:
+        raise argparse.ArgumentTypeError(f"expected NAME=VALUES, got '{text}'")
+    try:
+        if ':' in values:
+            lo, hi, step = (int(v) for v in values.split(':'))
+            return name, list(range(lo, hi + 1, step))
+        return name, [int(v) for v in values.split(',')]
+    except ValueError:
+        raise argparse.ArgumentTypeError(f"bad values in '{text}'") from None
+
+
+def rank_key(r: Result):
+    return r.errors(), r.latency_ms
+
+
+def print_report(results: list[Result], baseline: Result, swept: list[str], top: int):
+    header = ' '.join(f"{name:>{max(6, len(name))}}" for name in swept)
+    print(f"{'rank':>4} {header} {'w-hold':>6} {'w-tap':>5} {'combo':>7} {'mash':>7} {'errors':>6} {'+ms/key':>7}")
+
+    def row(label: str, r: Result):
+        values = ' '.join(f"{r.config[name]:>{max(6, len(name))}}" for name in swept)
+        per_key = r.latency_ms / r.presses if r.presses else 0
+        print(f"{label:>4} {values} {r.wrong_hold:6d} {r.wrong_tap:5d} {r.wrong_combo:3d}/{r.missed_combo:<3d} "
+              f"{r.dropped:3d}/{r.mashed:<3d} {r.errors():6d} {per_key:7.2f}")
+
+    for rank, r in enumerate(results[:top], 1):
+        row(str(rank), r)
+    print()
+    row('now', baseline)
+    print("\ncombo = fired unintended / missed intended, mash = real keys dropped / mashes let through,\n"
+          "+ms/key = decision and combo wait added per key press", file=sys.stderr)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Sweep tap-hold, combo and mash guard parameters over recorded typing '
+                    '(lib/latency_trace.h dumps) and rank the configurations',
+        epilog='Example: %(prog)s --keymap ../keymaps/qwerty -s TAPPING_TERM=150:250:10 '
+               '-s PERMISSIVE_HOLD=0,1 -s COMBO_TERM=40,60,80 trace.log',
+    )
+    parser.add_argument('logs', nargs='*', help='Console logs to read (default: stdin)')
+    parser.add_argument('--keymap', type=Path, required=True,
+                        help='Keymap directory holding keymap.c, config.h and combos.def')
+    parser.add_argument('-s', '--sweep', type=parse_sweep, action='append', default=[], metavar='NAME=VALUES',
+                        help='Values to try for a parameter: a,b,c or lo:hi:step. Parameters: '
+                             + ', '.join(PARAMS) + ", plus the keymap's per-key terms")
+    parser.add_argument('-D', dest='defines', type=parse_define, action='append', default=[], metavar='NAME=VALUE',
+                        help='Override a config.h/keymap.c define for every configuration')
+    parser.add_argument('--skip-combos', metavar='REGEX',
+                        help="Leave out combos whose array name matches, e.g. '^gwc_' for QWERTY typing "
+                             "on the combined keymap's combo window")
+    labels = parser.add_argument_group('what counts as meant')
+    labels.add_argument('--hold-ms', type=float, default=250,
+                        help='A tap-hold key held this long with no other key is a hold (default: 250)')
+    labels.add_argument('--tail-ms', type=float, default=30,
+                        help='A tap-hold key wrapping another key and released this long after it '
+                             'is a hold (default: 30)')
+    labels.add_argument('--chord-ms', type=float, default=35,
+                        help="A combo's keys all pressed within this is a chord (default: 35)")
+    labels.add_argument('--mash-ms', type=float, default=10,
+                        help='A press this close after one on a neighbouring key is a mash (default: 10)')
+    parser.add_argument('-j', '--jobs', type=int, default=os.cpu_count(), help='Worker processes (default: all cores)')
+    parser.add_argument('--top', type=int, default=15, help='Configurations to list (default: 15)')
+    parser.add_argument('--json', action='store_true', help='Print every configuration as JSON, best first')
+    parser.add_argument('-v', '--verbose', action='store_true', help='Print keymap and timing details to stderr')
+    args = parser.parse_args()
+
+    keymap = KeymapModel(args.keymap, dict(args.defines), args.skip_combos)
+    combos = sorted(set(keymap.combos.values()), key=sorted)
+
+    lines = []
+    for path in args.logs or ['-']:
+        with (sys.stdin if path == '-' else open(path, 'r', encoding='utf-8', errors='replace')) as f:
+            lines += f.readlines()
+    runs, dropped = parse_dumps(lines)
+    runs = runs_of_presses(runs, keymap.hand)
+    if not runs:
+        raise SystemExit("error: no latency trace presses found (is LATENCY_TRACE_ENABLE = yes?)")
+    run_labels = [Labels(presses, combos, args.hold_ms, args.tail_ms, args.chord_ms, args.mash_ms)
+                  for presses in runs]
+
+    baseline = keymap.baseline()
+    sweeps = dict(args.sweep)
+    unknown = set(sweeps) - set(baseline)
+    if unknown:
+        raise SystemExit(f"error: cannot sweep {', '.join(sorted(unknown))}; "
+                         f"parameters: {', '.join(baseline)}")
+    swept = [name for name in baseline if name in sweeps]
+    grid = [{**baseline, **dict(zip(swept, values))}
+            for values in itertools.product(*(sweeps[name] for name in swept))]
+
+    if args.verbose:
+        print(f"{sum(map(len, runs))} presses in {len(runs)} runs, {len(combos)} combos, "
+              f"{sum(len(l.chords) for l in run_labels)} chords, "
+              f"{sum(sum(l.hold) for l in run_labels)} holds meant", file=sys.stderr)
+        print(f"baseline: {baseline}", file=sys.stderr)
+    if dropped:
+        print(f"{dropped} events were dropped on the board; runs are split around them", file=sys.stderr)
+
+    start = time.perf_counter()
+    jobs = max(1, min(args.jobs or 1, len(grid)))
+    work = (runs, run_labels, keymap, combos)
+    if jobs == 1:
+        init_worker(*work)
+        results = [run_config(config) for config in grid]
+    else:
+        with Pool(jobs, initializer=init_worker, initargs=work) as pool:
+            results = list(pool.imap(run_config, grid, chunksize=max(1, len(grid) // (jobs * 4))))
+    results.sort(key=rank_key)
+    init_worker(*work)
+    now = run_config(baseline)
+    if args.verbose:
+        print(f"{len(grid)} configurations on {jobs} workers in {time.perf_counter() - start:.2f}s", file=sys.stderr)
+
+    if args.json:
+        json.dump({'baseline': now.as_dict(), 'ranked': [r.as_dict() for r in results]}, sys.stdout, indent=2)
+        print()
+    else:
+        print_report(results, now, swept or PARAMS, args.top)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,161 @@
+// Word chord output queue: types chord text one HID report per call to
+// wc_step(), from housekeeping_task_user(), instead of a blocking SEND_STRING,
+// so the matrix scan keeps running while a word goes out.
+//
+// Keys typed while chord text is still pending must land after it. Rather than
+// draining the queue on the spot (one report per character, which stalls the
+// scan just like SEND_STRING did), wc_defer() puts a key's press, and later its
+// release, into the same queue behind the text. Deferred keys skip the rest of
+// process_record (autocorrect, Caps Word), which only matters for keys pressed
+// within a few milliseconds of a chord. Modifiers must wait the same way, or
+// they would apply to the text still going out: the keymap passes a held
+// mod-tap to wc_defer() as its mods alone, and its WC_REGISTER sends those as
+// held mods.
+//
+// No QMK dependencies beyond the report hooks, so the same code runs on the
+// host (word_chord_bench.c). Define before including:
+//   WC_COUNT, WC_MAX_LEN   size of the string pool
+//   wc_strings             const char [WC_COUNT][WC_MAX_LEN], PROGMEM on the board
+// and optionally WC_REGISTER, WC_UNREGISTER, WC_CHAR_KEYCODE and WC_READ_CHAR.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef WC_REGISTER
+#    define WC_REGISTER(keycode) register_code16(keycode)
+#endif
+#ifndef WC_UNREGISTER
+#    define WC_UNREGISTER(keycode) unregister_code16(keycode)
+#endif
+#ifndef WC_CHAR_KEYCODE
+#    define WC_CHAR_KEYCODE(c) pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)(c)])
+#endif
+#ifndef WC_READ_CHAR
+#    define WC_READ_CHAR(word, pos) pgm_read_byte(&(word)[pos])
+#endif
+
+// Queue entries, power of two: chords plus the keys waiting behind them
+#ifndef WC_QUEUE_SIZE
+#    define WC_QUEUE_SIZE 16
+#endif
+// Keys whose press is queued and whose release hasn't come in yet
+#ifndef WC_DEFERRED_MAX
+#    define WC_DEFERRED_MAX 4
+#endif
+
+_Static_assert((WC_QUEUE_SIZE & (WC_QUEUE_SIZE - 1)) == 0, "WC_QUEUE_SIZE must be a power of two");
+
+// An entry is a string pool index, or a keycode tagged as a press or release
+#define WC_PRESS   0x8000
+#define WC_RELEASE 0x4000
+#define WC_KEYCODE 0x3FFF
+
+static uint16_t wc_queue[WC_QUEUE_SIZE];
+static uint8_t  wc_head = 0;
+static uint8_t  wc_tail = 0;
+static uint8_t  wc_pos  = 0; // next character of the word at wc_head
+static uint8_t  wc_held = 0; // character key registered by the queue, 0 = none
+static uint16_t wc_deferred[WC_DEFERRED_MAX];
+
+static inline bool wc_idle(void) {
+    return wc_head == wc_tail && !wc_held;
+}
+
+static inline uint8_t wc_room(void) {
+    return (wc_head - wc_tail - 1) & (WC_QUEUE_SIZE - 1);
+}
+
+static inline void wc_push(uint16_t entry) {
+    wc_queue[wc_tail] = entry;
+    wc_tail           = (wc_tail + 1) & (WC_QUEUE_SIZE - 1);
+}
+
+// Queue a word from the string pool; dropped if the queue is full
+static void wc_enqueue(uint8_t word) {
+    if (wc_room()) wc_push(word);
+}
+
+// Emit a single report: release the held character, or the next entry's
+// press or release. False when there was nothing to send.
+static bool wc_step(void) {
+    if (wc_held) {
+        WC_UNREGISTER(wc_held);
+        wc_held = 0;
+        return true;
+    }
+    if (wc_head == wc_tail) return false;
+
+    uint16_t const entry = wc_queue[wc_head];
+    if (entry & (WC_PRESS | WC_RELEASE)) {
+        if (entry & WC_PRESS) {
+            WC_REGISTER(entry & WC_KEYCODE);
+        } else {
+            WC_UNREGISTER(entry & WC_KEYCODE);
+        }
+        wc_head = (wc_head + 1) & (WC_QUEUE_SIZE - 1);
+        return true;
+    }
+
+    const char *word = wc_strings[entry];
+    wc_held          = WC_CHAR_KEYCODE(WC_READ_CHAR(word, wc_pos));
+    WC_REGISTER(wc_held);
+    if (!WC_READ_CHAR(word, ++wc_pos)) {
+        wc_pos  = 0;
+        wc_head = (wc_head + 1) & (WC_QUEUE_SIZE - 1);
+    }
+    return true;
+}
+
+// Last resort when the queue is full: send everything now
+static void wc_flush(void) {
+    while (wc_step());
+}
+
+// Call on every key event with the keycode the key sends on its own (KC_NO =
+// 0 for keys that do more than send a keycode). True = the event is queued
+// behind pending chord text and must not be processed further.
+static bool wc_defer(uint16_t keycode, bool pressed) {
+    if (!keycode) return false;
+
+    if (pressed) {
+        if (wc_idle()) return false;
+        for (uint8_t i = 0; i < WC_DEFERRED_MAX; i++) {
+            if (!wc_deferred[i]) {
+                if (wc_room() < 2) break; // keep a slot for its release
+                wc_deferred[i] = keycode;
+                wc_push(WC_PRESS | keycode);
+                return true;
+            }
+        }
+        wc_flush(); // no room: fall back to sending the text first
+        return false;
+    }
+
+    for (uint8_t i = 0; i < WC_DEFERRED_MAX; i++) {
+        if (wc_deferred[i] == keycode) {
+            wc_deferred[i] = 0;
+            if (wc_idle()) {
+                WC_UNREGISTER(keycode); // its press already went out
+            } else {
+                if (!wc_room()) wc_flush();
+                wc_push(WC_RELEASE | keycode);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+// Tap a keycode in order with any pending chord text
+static void wc_tap(uint16_t keycode) {
+    if (wc_room() < 2) wc_flush();
+    if (wc_idle()) {
+        WC_REGISTER(keycode);
+        WC_UNREGISTER(keycode);
+        return;
+    }
+    wc_push(WC_PRESS | keycode);
+    wc_push(WC_RELEASE | keycode);
+}
@@ -0,0 +1,145 @@
+// Host scan-gap benchmark for lib/word_chord.h.
+//
+// Runs a simulated main loop (one matrix scan, then housekeeping, per pass)
+// through a burst of word chords with keys typed while the text goes out, and
+// reports the longest time between two scans for three ways of sending:
+//   blocking   SEND_STRING from process_combo_event (before the queue)
+//   flush      the queue, drained on the spot by every new keypress
+//   queue      the queue, with new keys deferred behind the text (wc_defer)
+// Every HID report costs REPORT_US, the wait for the USB endpoint. The burst
+// ends with a chord, a tapped key (wc_tap, as the clipboard keys do) and a
+// Shift held from a home row mod-tap while that text is still queued. Also
+// checks that the host sees the chord text first and the typed keys after it,
+// in order, with only the key typed under Shift shifted. Exits non-zero if
+// the queue's worst gap exceeds one report plus a scan, or any mode reorders
+// or shifts the wrong text.
+//   cc -O2 -o word_chord_bench word_chord_bench.c && ./word_chord_bench
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+#define SCAN_US   200  // one matrix scan and the keymap code around it
+#define REPORT_US 1000 // one HID report at a 1 ms USB polling interval
+
+#define SHIFT 0x0200 // LSFT(KC_NO): a held LSFT_T() as the keymap queues it
+
+static uint32_t now_us;
+static char     sent[256];
+static size_t   sent_len;
+static bool     shifted;
+
+// Keycodes are plain ASCII here, so the host's text is the registered keys
+static void report(uint16_t keycode, bool pressed) {
+    if (keycode == SHIFT) {
+        shifted = pressed;
+    } else if (pressed && sent_len < sizeof(sent) - 1) {
+        sent[sent_len++] = shifted ? (char)toupper(keycode) : (char)keycode;
+    }
+    now_us += REPORT_US;
+}
+
+#define WC_REGISTER(keycode)    report(keycode, true)
+#define WC_UNREGISTER(keycode)  report(keycode, false)
+#define WC_CHAR_KEYCODE(c)      (c)
+#define WC_READ_CHAR(word, pos) ((word)[pos])
+
+#define WC_COUNT   4
+#define WC_MAX_LEN 7
+static const char wc_strings[WC_COUNT][WC_MAX_LEN] = {"which ", "would ", "there ", "about "};
+
+#include "word_chord.h"
+
+// ─── Scenario ────────────────────────────────────────────────────────────────
+
+enum { KEY = -1, TAP = -2, MOD = -3 };
+
+typedef struct {
+    uint32_t at_us;
+    int8_t   chord; // string pool index, or KEY, TAP or MOD
+    uint16_t key;
+    bool     pressed;
+} event_t;
+
+// Four chords in quick succession, then a word typed over the chord text;
+// then a chord, a tap and a shifted key over that chord's text
+static const event_t events[] = {
+    {0, 0, 0, true},          {2000, 1, 0, true},        {4000, 2, 0, true},       {6000, 3, 0, true},
+    {9000, KEY, 'n', true},   {12000, KEY, 'o', true},   {15000, KEY, 'n', false}, {16000, KEY, 'w', true},
+    {19000, KEY, 'o', false}, {24000, KEY, 'w', false},  {80000, 0, 0, true},      {81000, TAP, ',', true},
+    {82000, MOD, SHIFT, true}, {83000, KEY, 'n', true},  {84000, KEY, 'n', false}, {85000, MOD, SHIFT, false},
+};
+#define EVENT_COUNT (sizeof(events) / sizeof(events[0]))
+static const char expected[] = "which would there about nowwhich ,N";
+
+enum { MODE_BLOCKING, MODE_FLUSH, MODE_QUEUE };
+static const char *const mode_names[] = {"blocking", "flush", "queue"};
+
+static void handle(int mode, const event_t *event) {
+    if (event->chord >= 0) {
+        if (mode == MODE_BLOCKING) {
+            for (const char *c = wc_strings[event->chord]; *c; c++) {
+                report(*c, true);
+                report(*c, false);
+            }
+        } else {
+            wc_enqueue(event->chord);
+        }
+        return;
+    }
+    if (event->chord == TAP) {
+        if (mode == MODE_QUEUE) {
+            wc_tap(event->key);
+            return;
+        }
+        if (mode == MODE_FLUSH) wc_flush();
+        report(event->key, true);
+        report(event->key, false);
+        return;
+    }
+    if (mode == MODE_FLUSH && event->pressed) wc_flush();
+    if (mode == MODE_QUEUE && wc_defer(event->key, event->pressed)) return;
+    report(event->key, event->pressed);
+}
+
+static uint32_t run(int mode) {
+    memset(wc_queue, 0, sizeof(wc_queue));
+    memset(wc_deferred, 0, sizeof(wc_deferred));
+    wc_head = wc_tail = wc_pos = wc_held = 0;
+    now_us = 0;
+    sent_len = 0;
+    shifted  = false;
+
+    uint32_t worst = 0, last_scan = 0;
+    size_t   next = 0;
+    for (;;) {
+        // Matrix scan: deliver what happened up to now, nothing later
+        uint32_t const scan_us = now_us;
+        if (scan_us - last_scan > worst) worst = scan_us - last_scan;
+        last_scan = scan_us;
+        if (next == EVENT_COUNT && wc_idle()) break;
+        while (next < EVENT_COUNT && events[next].at_us <= scan_us)
+            handle(mode, &events[next++]);
+        now_us += SCAN_US;
+
+        // housekeeping_task_user()
+        if (mode != MODE_BLOCKING) wc_step();
+    }
+    sent[sent_len] = 0;
+    return worst;
+}
+
+int main(void) {
+    bool ok = true;
+    printf("%-9s %16s  %s\n", "mode", "worst scan gap", "host text");
+    for (int mode = MODE_BLOCKING; mode <= MODE_QUEUE; mode++) {
+        uint32_t const worst   = run(mode);
+        bool const     ordered = !strcmp(sent, expected);
+        printf("%-9s %13.1f ms  \"%s\"%s\n", mode_names[mode], worst / 1000.0, sent, ordered ? "" : "  MISMATCH");
+        ok &= ordered;
+        if (mode == MODE_QUEUE) ok &= worst <= REPORT_US + SCAN_US;
+    }
+    return ok ? 0 : 1;
+}